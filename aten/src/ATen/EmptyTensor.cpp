@@ -286,6 +286,39 @@ TensorBase empty_strided_cpu(
   return at::detail::empty_strided_cpu(size, stride, dtype, pin_memory);
 }
 
+ResolvedOptions ResolvedOptions::resolve_cpu(const TensorOptions& options) {
+  TORCH_CHECK(
+      device_or_default(options.device_opt()).type() == DeviceType::CPU,
+      "ResolvedOptions::resolve_cpu expects CPU options, got ",
+      options.device());
+  TORCH_CHECK(
+      layout_or_default(options.layout_opt()) == Layout::Strided,
+      "ResolvedOptions::resolve_cpu expects strided options, got layout ",
+      options.layout());
+  ResolvedOptions resolved;
+  resolved.dtype = dtype_or_default(optTypeMetaToScalarType(options.dtype_opt()));
+  resolved.key_set = c10::DispatchKeySet(c10::DispatchKey::CPU);
+  resolved.allocator =
+      GetCPUAllocatorMaybePinned(pinned_memory_or_default(options.pinned_memory_opt()));
+  return resolved;
+}
+
+TensorBase empty_resolved(
+    IntArrayRef size,
+    const ResolvedOptions& options,
+    c10::optional<c10::MemoryFormat> memory_format_opt) {
+  return empty_generic(
+      size, options.allocator, options.key_set, options.dtype, memory_format_opt);
+}
+
+TensorBase empty_strided_resolved(
+    IntArrayRef size,
+    IntArrayRef stride,
+    const ResolvedOptions& options) {
+  return empty_strided_generic(
+      size, stride, options.allocator, options.key_set, options.dtype);
+}
+
 TensorBase empty_strided_cpu(
     IntArrayRef size,
     IntArrayRef stride,
@@ -56,6 +56,32 @@ TORCH_API TensorBase empty_strided_symint_generic(
     c10::DispatchKeySet ks,
     ScalarType scalar_type);
 
+// Precomputed resolution of TensorOptions for repeated factory calls.
+// Resolving a TensorOptions (defaulting dtype/layout/device, picking the
+// allocator and dispatch key set) is redone on every at::empty/at::zeros
+// call even when the options never change, e.g. in graph-capture replays.
+// Callers that create many tensors with identical options can resolve once
+// and pass the result to empty_resolved/empty_strided_resolved, which go
+// straight to the generic constructors.  Only strided CPU options are
+// supported; other devices go through their backend factories as usual.
+struct TORCH_API ResolvedOptions {
+  ScalarType dtype;
+  c10::DispatchKeySet key_set;
+  c10::Allocator* allocator;
+
+  static ResolvedOptions resolve_cpu(const TensorOptions& options);
+};
+
+TORCH_API TensorBase empty_resolved(
+    IntArrayRef size,
+    const ResolvedOptions& options,
+    c10::optional<c10::MemoryFormat> memory_format_opt = c10::nullopt);
+
+TORCH_API TensorBase empty_strided_resolved(
+    IntArrayRef size,
+    IntArrayRef stride,
+    const ResolvedOptions& options);
+
 TORCH_API TensorBase empty_cpu(
     IntArrayRef size,
     ScalarType dtype,
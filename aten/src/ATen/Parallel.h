@@ -1,8 +1,10 @@
 #pragma once
 #include <ATen/Config.h>
 #include <c10/macros/Macros.h>
+#include <cstdint>
 #include <functional>
 #include <string>
+#include <vector>
 
 namespace at {
 
@@ -135,6 +137,35 @@ TORCH_API void set_num_interop_threads(int);
 // Returns the number of threads used for inter-op parallelism
 TORCH_API int get_num_interop_threads();
 
+// Utilization counters of a task thread pool, see get_interop_pool_stats and
+// get_intraop_pool_stats
+struct ThreadPoolStats {
+  // number of worker threads in the pool
+  size_t threads = 0;
+  // workers currently waiting for a task
+  size_t idle = 0;
+  // tasks waiting for a worker
+  size_t queued = 0;
+  // tasks finished since the pool was created
+  uint64_t tasks_completed = 0;
+};
+
+// Returns utilization counters for the inter-op thread pool; initializes the
+// pool if it has not been used yet
+TORCH_API ThreadPoolStats get_interop_pool_stats();
+
+// Pins the inter-op pool's worker threads to `core_ids`, assigned
+// round-robin; initializes the pool if it has not been used yet. Returns
+// false on platforms without thread affinity support.
+TORCH_API bool set_interop_thread_affinity(const std::vector<size_t>& core_ids);
+
+// Intra-op counterparts of the two functions above. Only effective with the
+// native parallel backend, which owns its worker threads; with OpenMP or TBB
+// the threads belong to the runtime and the calls report no pool / return
+// false.
+TORCH_API ThreadPoolStats get_intraop_pool_stats();
+TORCH_API bool set_intraop_thread_affinity(const std::vector<size_t>& core_ids);
+
 // Launches inter-op parallel task
 TORCH_API void launch(std::function<void()> func);
 namespace internal {
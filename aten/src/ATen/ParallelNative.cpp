@@ -6,11 +6,14 @@
 
 #ifndef C10_MOBILE
 #include <c10/core/thread_pool.h>
+#include <c10/util/env.h>
 #include <c10/util/irange.h>
+#include <c10/util/numa.h>
 #else
 #include <caffe2/utils/threadpool/pthreadpool-cpp.h>
 #endif // C10_MOBILE
 
+#include <algorithm>
 #include <atomic>
 #include <utility>
 
@@ -73,13 +76,61 @@ int _num_pool_threads(int nthreads) {
   return nthreads - 1;
 }
 
+// When AT_INTRAOP_SPREAD_NUMA is set (and NUMA is enabled via the
+// caffe2_cpu_numa_enabled flag), pins the intra-op workers to cores
+// interleaved across NUMA nodes. Worker threads then stop migrating between
+// sockets, so pages they first-touch in one parallel region stay local to
+// the socket that keeps processing them — without this, reductions over
+// ranges owned by the remote node run at roughly half the memory bandwidth.
+// parallel_for itself only sees index ranges, not pointers, so per-range
+// ownership cannot be detected at this level; stable worker placement is the
+// piece this layer can provide.
+void _maybe_spread_pool_across_numa_nodes(TaskThreadPoolBase& pool) {
+  if (c10::utils::check_env("AT_INTRAOP_SPREAD_NUMA") != true) {
+    return;
+  }
+  if (!c10::IsNUMAEnabled()) {
+    TORCH_WARN("AT_INTRAOP_SPREAD_NUMA is set but NUMA is not available");
+    return;
+  }
+  const auto num_nodes = c10::GetNumNUMANodes();
+  if (num_nodes <= 1) {
+    return;
+  }
+  std::vector<std::vector<int>> node_cpus;
+  size_t max_cpus_per_node = 0;
+  for (const auto node : c10::irange(num_nodes)) {
+    node_cpus.push_back(c10::GetNUMANodeCPUs(node));
+    max_cpus_per_node = std::max(max_cpus_per_node, node_cpus.back().size());
+  }
+  // Interleave cores node by node so that worker i lands on node
+  // (i % num_nodes), spreading the pool evenly across sockets.
+  std::vector<size_t> core_ids;
+  for (const auto cpu_idx : c10::irange(max_cpus_per_node)) {
+    for (const auto node : c10::irange(num_nodes)) {
+      if (cpu_idx < node_cpus[node].size()) {
+        core_ids.push_back(static_cast<size_t>(node_cpus[node][cpu_idx]));
+      }
+    }
+  }
+  auto* thread_pool = dynamic_cast<c10::ThreadPool*>(&pool);
+  if (thread_pool == nullptr || core_ids.empty() ||
+      !thread_pool->setThreadAffinity(core_ids)) {
+    TORCH_WARN("Failed to spread the intra-op pool across NUMA nodes");
+  }
+}
+
 TaskThreadPoolBase& _get_intraop_pool() {
-  static std::shared_ptr<TaskThreadPoolBase> pool =
-      ThreadPoolRegistry()->Create(
-          "C10",
-          /* device_id */ 0,
-          /* pool_size */ _num_pool_threads(num_intraop_threads.exchange(CONSUMED)),
-          /* create_new */ true); // create a separate thread pool for intra-op
+  static std::shared_ptr<TaskThreadPoolBase> pool = []() {
+    auto created = ThreadPoolRegistry()->Create(
+        "C10",
+        /* device_id */ 0,
+        /* pool_size */
+        _num_pool_threads(num_intraop_threads.exchange(CONSUMED)),
+        /* create_new */ true); // create a separate thread pool for intra-op
+    _maybe_spread_pool_across_numa_nodes(*created);
+    return created;
+  }();
   return *pool;
 }
 
@@ -87,7 +138,11 @@ TaskThreadPoolBase& _get_intraop_pool() {
 
 // Run lambda function `fn` over `task_id` in [0, `range`) with threadpool.
 // `fn` will be called with params: (thread_pool_task_id, task_id).
-void _run_with_pool(const std::function<void(int, size_t)>& fn, size_t range) {
+// `fn` is non-owning; the caller (invoke_parallel) blocks until all tasks
+// have run, which keeps the referenced closure alive. The queued per-task
+// closures are then just (function_ref, index) pairs, stored inline by the
+// pool's c10::SmallFunction task type -- no allocation per task.
+void _run_with_pool(c10::function_ref<void(int, size_t)> fn, size_t range) {
 #ifndef C10_MOBILE
   for (const auto i : c10::irange(1, range)) {
     _get_intraop_pool().run([fn, i]() { fn((int)i, i); });
@@ -141,7 +196,7 @@ void invoke_parallel(
   const int64_t begin,
   const int64_t end,
   const int64_t grain_size,
-  const std::function<void(int64_t, int64_t)>& f) {
+  c10::function_ref<void(int64_t, int64_t)> f) {
   at::internal::lazy_init_num_threads();
 
   // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
@@ -158,6 +213,9 @@ void invoke_parallel(
     std::condition_variable cv;
   } state;
 
+  // This closure stays on the stack until the wait loop below sees
+  // remaining == 0; workers reach it through the non-owning reference that
+  // _run_with_pool queues, so no task ever copies it.
   auto task = [f, &state, begin, end, chunk_size]
       (int /* unused */, size_t task_id) {
     int64_t local_start = begin + task_id * chunk_size;
@@ -180,13 +238,30 @@ void invoke_parallel(
     }
   };
   state.remaining = num_tasks;
-  _run_with_pool(std::move(task), num_tasks);
-
-  // Wait for all tasks to finish.
+  _run_with_pool(task, num_tasks);
+
+  // Wait for all tasks to finish, cooperatively: while this batch is still
+  // in flight, steal pending intra-op tasks and run them inline instead of
+  // sleeping. Concurrent parallel regions (e.g. ops issued through
+  // at::launch) queue onto the same pool, and a region whose tasks sit
+  // behind another batch would otherwise convoy on a sleeping caller. Once
+  // the queue is empty, all of this batch's tasks are executing on workers
+  // and blocking is safe.
   {
     std::unique_lock<std::mutex> lk(state.mutex);
-    if (state.remaining != 0) {
-      state.cv.wait(lk);
+    while (state.remaining != 0) {
+      bool ran_pending_task = false;
+#ifndef C10_MOBILE
+      lk.unlock();
+      if (auto* thread_pool =
+              dynamic_cast<c10::ThreadPool*>(&_get_intraop_pool())) {
+        ran_pending_task = thread_pool->tryRunTaskInline();
+      }
+      lk.lock();
+#endif // C10_MOBILE
+      if (!ran_pending_task && state.remaining != 0) {
+        state.cv.wait(lk);
+      }
     }
   }
   if (state.eptr) {
@@ -275,6 +350,32 @@ bool in_parallel_region() {
 #endif // C10_MOBILE
 }
 
+ThreadPoolStats get_intraop_pool_stats() {
+  ThreadPoolStats stats;
+#ifndef C10_MOBILE
+  auto& pool = _get_intraop_pool();
+  stats.threads = pool.size();
+  stats.idle = pool.numAvailable();
+  if (auto* thread_pool = dynamic_cast<c10::ThreadPool*>(&pool)) {
+    stats.queued = thread_pool->queueSize();
+    stats.tasks_completed = thread_pool->numTasksCompleted();
+  }
+#endif // C10_MOBILE
+  return stats;
+}
+
+bool set_intraop_thread_affinity(const std::vector<size_t>& core_ids) {
+#ifndef C10_MOBILE
+  if (auto* thread_pool =
+          dynamic_cast<c10::ThreadPool*>(&_get_intraop_pool())) {
+    return thread_pool->setThreadAffinity(core_ids);
+  }
+#else
+  (void)core_ids;
+#endif // C10_MOBILE
+  return false;
+}
+
 void intraop_launch(std::function<void()> func) {
 #ifndef C10_MOBILE
   if (!in_parallel_region() && get_num_threads() > 1) {
@@ -5,17 +5,21 @@
 #include <exception>
 
 #include <c10/util/Exception.h>
+#include <c10/util/FunctionRef.h>
 
 #define INTRA_OP_PARALLEL
 
 namespace at {
 namespace internal {
 
+// `f` is a non-owning reference: invoke_parallel blocks until every task has
+// finished, so the caller's closure always outlives its uses and no
+// std::function needs to be materialized on the parallel_for hot path.
 TORCH_API void invoke_parallel(
     const int64_t begin,
     const int64_t end,
     const int64_t grain_size,
-    const std::function<void(int64_t, int64_t)>& f);
+    c10::function_ref<void(int64_t, int64_t)> f);
 
 } // namespace internal
 
@@ -94,6 +94,17 @@ void intraop_launch(std::function<void()> func) {
   }
 }
 
+ThreadPoolStats get_intraop_pool_stats() {
+  // TBB owns the intra-op threads; there is no pool to report on.
+  return ThreadPoolStats();
+}
+
+bool set_intraop_thread_affinity(const std::vector<size_t>& /* core_ids */) {
+  // TBB owns the intra-op threads; use a tbb::task_arena with an affinity
+  // observer instead.
+  return false;
+}
+
 c10::intrusive_ptr<c10::ivalue::Future> intraop_launch_future(
     std::function<void()> func) {
   auto future = c10::make_intrusive<c10::ivalue::Future>(NoneType::get());
@@ -106,6 +106,16 @@ void intraop_launch(std::function<void()> func) {
   func();
 }
 
+ThreadPoolStats get_intraop_pool_stats() {
+  // OpenMP owns the intra-op threads; there is no pool to report on.
+  return ThreadPoolStats();
+}
+
+bool set_intraop_thread_affinity(const std::vector<size_t>& /* core_ids */) {
+  // OpenMP owns the intra-op threads; use OMP_PLACES / OMP_PROC_BIND instead.
+  return false;
+}
+
 c10::intrusive_ptr<c10::ivalue::Future> intraop_launch_future(
     std::function<void()> func) {
   func();
@@ -69,6 +69,41 @@ int get_num_interop_threads() {
   }
 }
 
+namespace {
+
+// The registry hands out TaskThreadPoolBase; the counters and affinity
+// control live on c10::ThreadPool, which every pool created through the
+// registry derives from.
+ThreadPoolStats pool_stats(TaskThreadPoolBase& pool) {
+  ThreadPoolStats stats;
+  stats.threads = pool.size();
+  stats.idle = pool.numAvailable();
+  if (auto* thread_pool = dynamic_cast<c10::ThreadPool*>(&pool)) {
+    stats.queued = thread_pool->queueSize();
+    stats.tasks_completed = thread_pool->numTasksCompleted();
+  }
+  return stats;
+}
+
+bool pool_set_affinity(
+    TaskThreadPoolBase& pool,
+    const std::vector<size_t>& core_ids) {
+  if (auto* thread_pool = dynamic_cast<c10::ThreadPool*>(&pool)) {
+    return thread_pool->setThreadAffinity(core_ids);
+  }
+  return false;
+}
+
+} // namespace
+
+ThreadPoolStats get_interop_pool_stats() {
+  return pool_stats(get_pool());
+}
+
+bool set_interop_thread_affinity(const std::vector<size_t>& core_ids) {
+  return pool_set_affinity(get_pool(), core_ids);
+}
+
 namespace internal {
 void launch_no_thread_state(std::function<void()> fn) {
 #if AT_EXPERIMENTAL_SINGLE_THREAD_POOL
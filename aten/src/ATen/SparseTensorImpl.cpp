@@ -55,6 +55,7 @@ void SparseTensorImpl::release_resources() {
   TensorImpl::release_resources();
   values_.reset();
   indices_.reset();
+  invalidate_cached_crow_indices();
 }
 
 void SparseTensorImpl::set_size(int64_t dim, int64_t new_size) {
@@ -106,6 +107,7 @@ void SparseTensorImpl::set_indices_and_values_unsafe(const Tensor& indices, cons
 
   indices_ = indices;
   values_ = values;
+  invalidate_cached_crow_indices();
   AT_ASSERT(device() == values_.device());
   AT_ASSERT(values_.device() == indices_.device());
 
@@ -5,6 +5,8 @@
 #include <c10/util/Exception.h>
 #include <c10/util/irange.h>
 
+#include <mutex>
+
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #else
@@ -38,6 +40,22 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
   // because many algorithms proceed by merging two sorted lists (of indices).
   bool coalesced_ = false;
 
+  // Lazily computed CSR row pointers for 2-dimensional coalesced tensors,
+  // filled in by the COO -> CSR conversion (see coo_to_sparse_csr in
+  // TensorConversions.cpp) so that repeatedly converting the same tensor
+  // (e.g. an adjacency matrix multiplied every step) skips the conversion.
+  // A coalesced tensor's col_indices and values alias indices_[1] and
+  // values_ directly, so only crow_indices needs to be remembered. This is
+  // derived data invisible to the logical tensor, hence mutable; it must be
+  // reset whenever indices_ or the sparse shape change.
+  //
+  // The cache is filled in from to_sparse_csr, a logically read-only op
+  // that may run concurrently on the same tensor, so every access goes
+  // through cached_crow_indices_mutex_: an unguarded fill would race a
+  // concurrent read on the non-atomic intrusive_ptr inside the Tensor.
+  mutable Tensor cached_crow_indices_;
+  mutable std::mutex cached_crow_indices_mutex_;
+
   // compute_numel with integer multiplication overflow check, see gh-57542
   void refresh_numel() {
     TensorImpl::safe_refresh_numel();
@@ -72,6 +90,29 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
     return values_;
   }
 
+  // Returns the cached CSR row pointers, or an undefined tensor when they
+  // have not been computed (or were invalidated) for the current indices.
+  // Returns by value so the handle is copied under the lock; a reference
+  // could be invalidated by a concurrent fill or reset.
+  Tensor cached_crow_indices() const {
+    std::lock_guard<std::mutex> lock(cached_crow_indices_mutex_);
+    return cached_crow_indices_;
+  }
+  void set_cached_crow_indices(const Tensor& crow_indices) const {
+    std::lock_guard<std::mutex> lock(cached_crow_indices_mutex_);
+    // When two conversions race, keep the first fill; both computed the
+    // same row pointers from the same indices.
+    if (!cached_crow_indices_.defined()) {
+      cached_crow_indices_ = crow_indices;
+    }
+  }
+  // Drops the cached row pointers; called whenever indices_ or the sparse
+  // shape change, as the cache would no longer describe the tensor.
+  void invalidate_cached_crow_indices() const {
+    std::lock_guard<std::mutex> lock(cached_crow_indices_mutex_);
+    cached_crow_indices_.reset();
+  }
+
   void set_size(int64_t dim, int64_t new_size) override;
   void set_stride(int64_t dim, int64_t new_stride) override;
   void set_storage_offset(int64_t storage_offset) override;
@@ -217,6 +258,7 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
           values_size.end(), dense_size.begin(), dense_size.end());
       at::symint::resize_<T>(values_, values_size);
       at::symint::resize_<T>(indices_, {T(sparse_dim), nnz});
+      invalidate_cached_crow_indices();
     }
 
     if (!size_equals_sizes) {
@@ -291,6 +333,7 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
     AT_ASSERT(new_nnz <= nnz());
     indices_ = indices_.narrow(1, 0, new_nnz);
     values_ = values_.narrow(0, 0, new_nnz);
+    invalidate_cached_crow_indices();
     if (new_nnz < 2) {
       coalesced_ = true;
     }
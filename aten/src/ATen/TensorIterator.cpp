@@ -23,10 +23,14 @@
 
 #include <c10/util/irange.h>
 #include <c10/util/SmallBuffer.h>
+#include <c10/util/env.h>
+#include <c10/util/hash.h>
 
 #include <array>
 #include <algorithm>
 #include <cmath>
+#include <list>
+#include <unordered_map>
 
 namespace at {
 
@@ -1456,6 +1460,127 @@ FastSetupType TensorIteratorBase::compute_fast_setup_type(const TensorIteratorCo
   return FastSetupType::NONE;
 }
 
+namespace {
+
+// [Note: TensorIterator build cache]
+// Inference workloads frequently call the same op on tensors with identical
+// metadata (shapes/strides/dtypes/devices), in which case build() recomputes
+// the exact same broadcast shape, promoted types and coalesced layout on every
+// call.  When AT_TENSORITER_BUILD_CACHE=1 we memoize the layout computed by
+// build() in a small per-thread LRU keyed on operand metadata and config
+// flags, and replay it on a hit, skipping compute_shape/compute_types/
+// reorder_dimensions/coalesce_dimensions.  Memory-overlap checks still run on
+// every call since they depend on data pointers, not just metadata.
+//
+// Caching is restricted to calls where replay is a pure metadata restore:
+// all operands defined (no output allocation), no resizing, no dtype-cast
+// temporaries, no named tensors and no meta tensors.
+
+// Flattened encoding of config flags + per-operand (device, dtype, sizes,
+// strides).  Encoded as int64 words so equality and hashing are trivial.
+struct BuildCacheKey {
+  SmallVector<int64_t, 32> words;
+
+  bool operator==(const BuildCacheKey& other) const {
+    return words == other.words;
+  }
+};
+
+struct BuildCacheKeyHash {
+  size_t operator()(const BuildCacheKey& key) const {
+    size_t seed = key.words.size();
+    for (auto word : key.words) {
+      seed = c10::hash_combine(seed, static_cast<size_t>(word));
+    }
+    return seed;
+  }
+};
+
+struct BuildCacheValue {
+  DimVector shape;
+  DimVector perm;
+  SmallVector<OperandInfo::StrideVector, 4> stride_bytes;
+  SmallVector<ScalarType, 4> target_dtype;
+  ScalarType common_dtype;
+  Device common_device;
+  bool has_coalesced_dimensions;
+  bool all_ops_same_shape;
+  bool all_ops_are_scalars;
+};
+
+class BuildCache {
+ public:
+  static constexpr size_t kCapacity = 128;
+
+  const BuildCacheValue* lookup(const BuildCacheKey& key) {
+    auto it = map_.find(key);
+    if (it == map_.end()) {
+      return nullptr;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return &it->second->second;
+  }
+
+  void insert(BuildCacheKey key, BuildCacheValue value) {
+    if (map_.count(key)) {
+      return;
+    }
+    if (entries_.size() >= kCapacity) {
+      map_.erase(entries_.back().first);
+      entries_.pop_back();
+    }
+    entries_.emplace_front(std::move(key), std::move(value));
+    map_.emplace(entries_.front().first, entries_.begin());
+  }
+
+ private:
+  std::list<std::pair<BuildCacheKey, BuildCacheValue>> entries_;
+  std::unordered_map<BuildCacheKey, decltype(entries_)::iterator, BuildCacheKeyHash> map_;
+};
+
+BuildCache& build_cache() {
+  static thread_local BuildCache cache;
+  return cache;
+}
+
+bool build_cache_enabled() {
+  static bool enabled = c10::utils::check_env("AT_TENSORITER_BUILD_CACHE") == true;
+  return enabled;
+}
+
+// Returns false if any operand makes the call ineligible for caching
+// (undefined tensors, named tensors, symbolic sizes).  The config-dependent
+// part of the key is passed in pre-flattened by build(), which has access to
+// TensorIteratorConfig's private fields.
+bool compute_build_cache_key(
+    uint64_t config_flags,
+    ArrayRef<c10::MaybeOwned<TensorBase>> tensors,
+    BuildCacheKey& key) {
+  key.words.push_back(static_cast<int64_t>(config_flags));
+  key.words.push_back(static_cast<int64_t>(tensors.size()));
+  for (const auto& t : tensors) {
+    if (!t->defined() || t->has_names()) {
+      return false;
+    }
+    auto* impl = t->unsafeGetTensorImpl();
+    if (impl->has_symbolic_sizes_strides()) {
+      return false;
+    }
+    key.words.push_back(
+        (static_cast<int64_t>(t->device().type()) << 32) |
+        (static_cast<int64_t>(t->device().index()) << 16) |
+        static_cast<int64_t>(t->scalar_type()));
+    auto sizes = t->sizes();
+    auto strides = t->strides();
+    key.words.push_back(static_cast<int64_t>(sizes.size()));
+    key.words.append(sizes.begin(), sizes.end());
+    key.words.append(strides.begin(), strides.end());
+  }
+  return true;
+}
+
+} // namespace
+
 TensorIteratorBase::TensorIteratorBase() = default;
 
 void TensorIteratorBase::build(TensorIteratorConfig& config) {
@@ -1463,6 +1588,28 @@ void TensorIteratorBase::build(TensorIteratorConfig& config) {
   is_reduction_ = config.is_reduction_;
   enforce_linear_iteration_ = config.enforce_linear_iteration_;
 
+  // check whether an identical-metadata call has been memoized
+  // (see [Note: TensorIterator build cache])
+  BuildCacheKey cache_key;
+  bool cacheable = build_cache_enabled() && !is_meta_ &&
+      !config.static_dtype_ && !config.static_device_ && !config.static_shape_;
+  if (cacheable) {
+    uint64_t config_flags = 0;
+    config_flags |= static_cast<uint64_t>(config.check_mem_overlap_) << 0;
+    config_flags |= static_cast<uint64_t>(config.allow_cpu_scalars_) << 1;
+    config_flags |= static_cast<uint64_t>(config.is_reduction_) << 2;
+    config_flags |= static_cast<uint64_t>(config.resize_outputs_) << 3;
+    config_flags |= static_cast<uint64_t>(config.check_all_same_dtype_) << 4;
+    config_flags |= static_cast<uint64_t>(config.check_all_same_device_) << 5;
+    config_flags |= static_cast<uint64_t>(config.enforce_safe_casting_to_output_) << 6;
+    config_flags |= static_cast<uint64_t>(config.enforce_linear_iteration_) << 7;
+    config_flags |= static_cast<uint64_t>(config.promote_inputs_to_common_dtype_) << 8;
+    config_flags |= static_cast<uint64_t>(config.promote_integer_inputs_to_float_) << 9;
+    config_flags |= static_cast<uint64_t>(config.cast_common_dtype_to_outputs_) << 10;
+    config_flags |= static_cast<uint64_t>(config.num_outputs_) << 32;
+    cacheable = compute_build_cache_key(config_flags, config.tensors_, cache_key);
+  }
+
   // fill in operands_ based on configuration
   populate_operands(config);
   // set is_output and is_read_write flags on appropriate tensors
@@ -1470,6 +1617,30 @@ void TensorIteratorBase::build(TensorIteratorConfig& config) {
   // Check that the outputs have no internal overlap
   // and do not share memory with inputs.
   compute_mem_overlaps(config);
+
+  if (cacheable) {
+    if (const auto* cached = build_cache().lookup(cache_key)) {
+      shape_ = cached->shape;
+      perm_ = cached->perm;
+      has_coalesced_dimensions_ = cached->has_coalesced_dimensions;
+      all_ops_same_shape_ = cached->all_ops_same_shape;
+      all_ops_are_scalars_ = cached->all_ops_are_scalars;
+      common_dtype_ = cached->common_dtype;
+      common_device_ = cached->common_device;
+      for (const auto i : c10::irange(operands_.size())) {
+        auto& op = operands_[i];
+        op.stride_bytes = cached->stride_bytes[i];
+        op.target_dtype = cached->target_dtype[i];
+        op.current_dtype = op.tensor_base().scalar_type();
+        op.device = op.tensor_base().device();
+        op.data = op.tensor_base().data_ptr();
+      }
+      int64_t ndim_offsets = (ndim() ? ndim() : 1);
+      view_offsets_ = DimVector(ndim_offsets, 0);
+      return;
+    }
+  }
+
   // Check that input dimensions are aligned correctly & compute outnames.
   compute_names(config);
   // compute the broadcasted shape
@@ -1521,6 +1692,32 @@ void TensorIteratorBase::build(TensorIteratorConfig& config) {
   // a valid value for the offset
   int64_t ndim_offsets = (ndim() ? ndim() : 1);
   view_offsets_ = DimVector(ndim_offsets, 0);
+
+  if (cacheable) {
+    // Only memoize calls whose replay is a pure metadata restore: no output
+    // resizing and no dtype-cast temporaries were needed for this build.
+    for (auto& op : operands_) {
+      if (op.will_resize || op.original_tensor_base().defined()) {
+        return;
+      }
+    }
+    if (!names_.empty()) {
+      return;
+    }
+    BuildCacheValue value;
+    value.shape = shape_;
+    value.perm = perm_;
+    value.common_dtype = common_dtype_;
+    value.common_device = common_device_;
+    value.has_coalesced_dimensions = has_coalesced_dimensions_;
+    value.all_ops_same_shape = all_ops_same_shape_;
+    value.all_ops_are_scalars = all_ops_are_scalars_;
+    for (auto& op : operands_) {
+      value.stride_bytes.push_back(op.stride_bytes);
+      value.target_dtype.push_back(op.target_dtype);
+    }
+    build_cache().insert(std::move(cache_key), std::move(value));
+  }
 }
 
 // This is the structured kernels' implementation of set_output.  It is
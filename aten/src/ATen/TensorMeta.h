@@ -2,7 +2,9 @@
 
 #include <ATen/DimVector.h>
 #include <ATen/core/Dimname.h>
+#include <ATen/core/TensorBase.h>
 #include <c10/core/TensorOptions.h>
+#include <c10/util/env.h>
 #include <c10/util/strides.h>
 
 C10_CLANG_DIAGNOSTIC_PUSH()
@@ -132,6 +134,97 @@ struct TORCH_API MetaBase {
   virtual ~MetaBase() {}
 };
 
+// Note: [frozen meta]
+// Structured kernels re-run output shape/dtype inference in meta() on every
+// invocation.  In serving loops where shapes never change this is pure
+// overhead.  When AT_FROZEN_META=1, meta functions that opt in can memoize
+// the parameters of their previous set_output call in a thread-local
+// FrozenMetaCache and replay them when a cheap metadata fingerprint of the
+// inputs (plus any shape-affecting scalar arguments) matches, skipping shape
+// inference and input validation for the repeated call.
+//
+// Replay goes through set_output_raw_strided with an empty strides hint, so
+// only meta functions that themselves use that variant for a single unnamed
+// output should adopt the cache.  Named tensors and symbolic shapes make a
+// fingerprint ineligible.
+inline bool frozen_meta_enabled() {
+  static bool enabled = c10::utils::check_env("AT_FROZEN_META") == true;
+  return enabled;
+}
+
+class MetaFingerprint {
+ public:
+  void add(int64_t v) {
+    words_.push_back(v);
+  }
+
+  void add(IntArrayRef values) {
+    words_.push_back(static_cast<int64_t>(values.size()));
+    words_.append(values.begin(), values.end());
+  }
+
+  // Returns false (and poisons the fingerprint) if the tensor's metadata
+  // cannot be fingerprinted exactly.
+  bool add(const TensorBase& t) {
+    if (!t.defined()) {
+      words_.push_back(-1);
+      return true;
+    }
+    if (t.has_names() || t.unsafeGetTensorImpl()->has_symbolic_sizes_strides()) {
+      eligible_ = false;
+      return false;
+    }
+    words_.push_back(
+        (static_cast<int64_t>(t.device().type()) << 32) |
+        (static_cast<int64_t>(t.device().index()) << 16) |
+        static_cast<int64_t>(t.scalar_type()));
+    add(t.sizes());
+    add(t.strides());
+    return true;
+  }
+
+  bool eligible() const {
+    return eligible_;
+  }
+
+  bool operator==(const MetaFingerprint& other) const {
+    return words_ == other.words_;
+  }
+
+ private:
+  c10::SmallVector<int64_t, 16> words_;
+  bool eligible_ = true;
+};
+
+class FrozenMetaCache {
+ public:
+  // Re-issues the memoized set_output call if `fp` matches the recorded
+  // fingerprint.  Returns true on a hit.
+  bool try_replay(MetaBase& meta, const MetaFingerprint& fp) {
+    if (!valid_ || !fp.eligible() || !(fp == fingerprint_)) {
+      return false;
+    }
+    meta.set_output_raw_strided(0, sizes_, {}, options_);
+    return true;
+  }
+
+  void record(MetaFingerprint fp, IntArrayRef sizes, TensorOptions options) {
+    if (!fp.eligible()) {
+      return;
+    }
+    fingerprint_ = std::move(fp);
+    sizes_ = DimVector(sizes);
+    options_ = options;
+    valid_ = true;
+  }
+
+ private:
+  bool valid_ = false;
+  MetaFingerprint fingerprint_;
+  DimVector sizes_;
+  TensorOptions options_;
+};
+
 } // namespace impl
 
 } // namespace at
@@ -265,13 +265,16 @@ class TORCH_API TensorBase {
     // Setting channels_last_strides_exact_match to true forces function to
     // check 0,1 - sized dimension strides.
     if (layout() == at::kStrided) {
-      if (impl_->is_strides_like_channels_last()) {
+      // One branch-free fetch of the cached format flags instead of separate
+      // policy-checked accessors per memory format.
+      const auto format_bits = impl_->memory_format_bits();
+      if (format_bits & c10::TensorImpl::CHANNELS_LAST_STRIDES_BIT) {
         if (!channels_last_strides_exact_match ||
             get_channels_last_strides_2d(sizes()) == strides()) {
           return at::MemoryFormat::ChannelsLast;
         }
       }
-      else if (impl_->is_strides_like_channels_last_3d()) {
+      else if (format_bits & c10::TensorImpl::CHANNELS_LAST_3D_STRIDES_BIT) {
         if (!channels_last_strides_exact_match ||
             get_channels_last_strides_3d(sizes()) == strides()) {
           return at::MemoryFormat::ChannelsLast3d;
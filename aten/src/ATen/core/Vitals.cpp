@@ -1,6 +1,10 @@
 #include <ATen/core/Vitals.h>
+#include <chrono>
+#include <condition_variable>
 #include <cstdlib>
 #include <iostream>
+#include <mutex>
+#include <thread>
 
 namespace at {
 namespace vitals {
@@ -95,5 +99,124 @@ APIVitals::APIVitals() : vitals_enabled(false), name_map_() {
   setVital("CUDA", "used", "False", /* force = */ true);
 }
 
+namespace {
+
+// See Note [Torch metrics]. The maps hold leaked metric objects so references
+// handed to producers never dangle, even during static destruction.
+std::mutex& metricsMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::map<std::string, MetricCounter*>& counterRegistry() {
+  static auto* registry = new std::map<std::string, MetricCounter*>();
+  return *registry;
+}
+
+std::map<std::string, MetricHistogram*>& histogramRegistry() {
+  static auto* registry = new std::map<std::string, MetricHistogram*>();
+  return *registry;
+}
+
+struct MetricsExporter {
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::thread thread;
+  bool running = false;
+  bool stop_requested = false;
+};
+
+MetricsExporter& metricsExporter() {
+  static auto* exporter = new MetricsExporter();
+  return *exporter;
+}
+
+} // namespace
+
+MetricCounter& getCounter(const std::string& name) {
+  std::lock_guard<std::mutex> guard(metricsMutex());
+  auto& registry = counterRegistry();
+  auto iter = registry.find(name);
+  if (iter == registry.end()) {
+    iter = registry.emplace(name, new MetricCounter()).first;
+  }
+  return *iter->second;
+}
+
+MetricHistogram& getHistogram(const std::string& name) {
+  std::lock_guard<std::mutex> guard(metricsMutex());
+  auto& registry = histogramRegistry();
+  auto iter = registry.find(name);
+  if (iter == registry.end()) {
+    iter = registry.emplace(name, new MetricHistogram()).first;
+  }
+  return *iter->second;
+}
+
+MetricsSnapshot snapshotMetrics() {
+  MetricsSnapshot snapshot;
+  std::lock_guard<std::mutex> guard(metricsMutex());
+  for (const auto& entry : counterRegistry()) {
+    snapshot.counters.emplace(entry.first, entry.second->value());
+  }
+  for (const auto& entry : histogramRegistry()) {
+    MetricsSnapshot::Histogram hist;
+    for (size_t i = 0; i < MetricHistogram::kNumBuckets; ++i) {
+      hist.buckets[i] = entry.second->bucket(i);
+    }
+    hist.count = entry.second->count();
+    hist.sum = entry.second->sum();
+    snapshot.histograms.emplace(entry.first, hist);
+  }
+  return snapshot;
+}
+
+bool startMetricsExportThread(
+    std::function<void(const MetricsSnapshot&)> hook,
+    int64_t interval_ms) {
+  auto& exporter = metricsExporter();
+  std::lock_guard<std::mutex> guard(exporter.mutex);
+  if (exporter.running) {
+    return false;
+  }
+  exporter.running = true;
+  exporter.stop_requested = false;
+  exporter.thread =
+      std::thread([hook = std::move(hook), interval_ms, &exporter]() {
+        std::unique_lock<std::mutex> lock(exporter.mutex);
+        while (!exporter.stop_requested) {
+          exporter.cv.wait_for(
+              lock, std::chrono::milliseconds(interval_ms), [&exporter] {
+                return exporter.stop_requested;
+              });
+          if (exporter.stop_requested) {
+            break;
+          }
+          lock.unlock();
+          hook(snapshotMetrics());
+          lock.lock();
+        }
+      });
+  return true;
+}
+
+void stopMetricsExportThread() {
+  auto& exporter = metricsExporter();
+  std::thread joinable;
+  {
+    std::lock_guard<std::mutex> guard(exporter.mutex);
+    if (!exporter.running) {
+      return;
+    }
+    exporter.stop_requested = true;
+    joinable = std::move(exporter.thread);
+    exporter.running = false;
+  }
+  exporter.cv.notify_all();
+  if (joinable.joinable()) {
+    joinable.join();
+  }
+}
+
 } // namespace vitals
 } // namespace at
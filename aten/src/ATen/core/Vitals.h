@@ -1,5 +1,9 @@
 #pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <cstring>
+#include <functional>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -80,6 +84,90 @@ class TORCH_API APIVitals {
 
 extern TORCH_API APIVitals VitalsAPI;
 
+// Note [Torch metrics]
+// ~~~~~~~~~~~~~~~~~~~~
+// Vitals record descriptive string key-values printed at exit; metrics are
+// their numeric counterpart: always-on counters and log2-scale histograms
+// that any subsystem can bump from hot paths and a telemetry agent can
+// scrape while the process runs. A subsystem registers a metric once by
+// name (getCounter/getHistogram, which take a lock and leak the returned
+// object so the reference stays valid forever), caches the reference, and
+// updates it with relaxed atomics -- no lock, branch, or allocation on the
+// update path. Scraping goes through snapshotMetrics(); alternatively
+// startMetricsExportThread() invokes a caller-supplied hook with a fresh
+// snapshot at a fixed interval.
+
+class TORCH_API MetricCounter {
+ public:
+  void add(uint64_t n = 1) {
+    value_.fetch_add(n, std::memory_order_relaxed);
+  }
+  uint64_t value() const {
+    return value_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<uint64_t> value_{0};
+};
+
+class TORCH_API MetricHistogram {
+ public:
+  // Bucket i counts observations in [2^(i-1), 2^i), bucket 0 counts zeros;
+  // values are whatever unit the producer chooses (ns, bytes, ...).
+  static constexpr size_t kNumBuckets = 64;
+
+  void observe(uint64_t value) {
+    size_t bucket = 0;
+    while ((1ull << bucket) <= value && bucket < kNumBuckets - 1) {
+      ++bucket;
+    }
+    buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+  }
+
+  uint64_t count() const {
+    return count_.load(std::memory_order_relaxed);
+  }
+  uint64_t sum() const {
+    return sum_.load(std::memory_order_relaxed);
+  }
+  uint64_t bucket(size_t i) const {
+    return buckets_[i].load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::array<std::atomic<uint64_t>, kNumBuckets> buckets_{};
+  std::atomic<uint64_t> count_{0};
+  std::atomic<uint64_t> sum_{0};
+};
+
+// Registers (on first use) and returns the metric with the given name.
+// The returned reference is valid for the lifetime of the process; cache it
+// rather than re-resolving the name on hot paths.
+TORCH_API MetricCounter& getCounter(const std::string& name);
+TORCH_API MetricHistogram& getHistogram(const std::string& name);
+
+struct TORCH_API MetricsSnapshot {
+  struct Histogram {
+    std::array<uint64_t, MetricHistogram::kNumBuckets> buckets{};
+    uint64_t count = 0;
+    uint64_t sum = 0;
+  };
+  std::map<std::string, uint64_t> counters;
+  std::map<std::string, Histogram> histograms;
+};
+
+TORCH_API MetricsSnapshot snapshotMetrics();
+
+// Starts (at most one) background thread that calls `hook` with a fresh
+// snapshot every `interval_ms`. Returns false if an export thread is already
+// running. The hook runs on the export thread and must not register metrics.
+TORCH_API bool startMetricsExportThread(
+    std::function<void(const MetricsSnapshot&)> hook,
+    int64_t interval_ms);
+TORCH_API void stopMetricsExportThread();
+
 } // namespace vitals
 } // namespace at
 
@@ -83,6 +83,62 @@ torch::jit::Stack boxArgs(Args... args) {
   return stack;
 }
 
+// [Note: boxed-call stack reuse]
+// Every unboxed->boxed crossing (conj/neg fallbacks, functionalization,
+// vmap, ...) used to materialize a fresh std::vector<IValue>, i.e. one heap
+// allocation per boxed call.  The boxed kernel ABI is fixed on
+// torch::jit::Stack (an alias of std::vector<IValue>), so we cannot swap in
+// a SmallVector; instead we keep a small per-thread freelist of stacks whose
+// capacity is retained across calls.  In steady state, boxed calls with a
+// typical argument count never touch the heap.
+class ReusableBoxedStack final {
+ public:
+  ReusableBoxedStack() : stack_(acquire()) {}
+  ReusableBoxedStack(const ReusableBoxedStack&) = delete;
+  ReusableBoxedStack& operator=(const ReusableBoxedStack&) = delete;
+  ~ReusableBoxedStack() {
+    release(std::move(stack_));
+  }
+
+  torch::jit::Stack& get() {
+    return stack_;
+  }
+
+ private:
+  // Enough for the overwhelming majority of op schemas; a stack that grew
+  // beyond this is returned to the allocator rather than retained.
+  static constexpr size_t kRetainedCapacity = 16;
+  static constexpr size_t kMaxPooledStacks = 8;
+
+  static std::vector<torch::jit::Stack>& pool() {
+    static thread_local std::vector<torch::jit::Stack> pool_;
+    return pool_;
+  }
+
+  static torch::jit::Stack acquire() {
+    auto& p = pool();
+    if (!p.empty()) {
+      auto stack = std::move(p.back());
+      p.pop_back();
+      return stack;
+    }
+    torch::jit::Stack stack;
+    stack.reserve(kRetainedCapacity);
+    return stack;
+  }
+
+  static void release(torch::jit::Stack&& stack) {
+    auto& p = pool();
+    if (p.size() < kMaxPooledStacks && stack.capacity() <= kRetainedCapacity) {
+      stack.clear();
+      p.push_back(std::move(stack));
+    }
+  }
+
+  torch::jit::Stack stack_;
+};
+
+
 template <class T>
 static inline constexpr size_t boxed_size_one() {
   static_assert(!std::is_same<std::decay_t<T>, c10::TensorOptions>::value, "need to patch this path to support TensorOptions passed by reference");
@@ -107,6 +163,13 @@ static inline constexpr size_t boxed_size() {
   return BoxedSize<Args...>::value;
 }
 
+// boxArgs variant filling a caller-provided (typically recycled) stack.
+template <class... Args>
+void boxArgsToStack(torch::jit::Stack& stack, Args... args) {
+  stack.reserve(boxed_size<Args...>());
+  torch::jit::push(stack, std::forward<Args>(args)...);
+}
+
 using IValueAlignedStorage = std::aligned_storage_t<sizeof(IValue), alignof(IValue)>;
 
 template <typename T>
@@ -223,7 +286,10 @@ struct BoxedKernelWrapper<
     DispatchKeySet dispatchKeySet,
     Args... args
   ) {
-    torch::jit::Stack stack = boxArgs<Args...>(std::forward<Args>(args)...);
+    // see [Note: boxed-call stack reuse]
+    ReusableBoxedStack reusable_stack;
+    torch::jit::Stack& stack = reusable_stack.get();
+    boxArgsToStack<Args...>(stack, std::forward<Args>(args)...);
     boxed_kernel_func.callBoxed(opHandle, dispatchKeySet, &stack);
 
     return guts::if_constexpr<!std::is_same<void, Result>::value>(
@@ -263,7 +329,9 @@ struct BoxedKernelWrapper<
     DispatchKeySet dispatchKeySet,
     at::Tensor& outArg, OtherArgs... otherArgs
   ) {
-    torch::jit::Stack stack = boxArgs<at::Tensor&, OtherArgs...>(outArg, std::forward<OtherArgs>(otherArgs)...);
+    ReusableBoxedStack reusable_stack;
+    torch::jit::Stack& stack = reusable_stack.get();
+    boxArgsToStack<at::Tensor&, OtherArgs...>(stack, outArg, std::forward<OtherArgs>(otherArgs)...);
     boxed_kernel_func.callBoxed(opHandle, dispatchKeySet, &stack);
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
       stack.size() == 1,
@@ -289,7 +357,9 @@ struct BoxedKernelWrapper<
     DispatchKeySet dispatchKeySet,
     const at::Tensor& outArg, OtherArgs... otherArgs
   ) {
-    torch::jit::Stack stack = boxArgs(outArg, otherArgs...);
+    ReusableBoxedStack reusable_stack;
+    torch::jit::Stack& stack = reusable_stack.get();
+    boxArgsToStack(stack, outArg, otherArgs...);
     boxed_kernel_func.callBoxed(opHandle, dispatchKeySet, &stack);
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
       stack.size() == 1,
@@ -326,7 +396,9 @@ struct BoxedKernelWrapper<
     DispatchKeySet dispatchKeySet,
     FirstArg firstArg, RestArgs... restArgs
   ) {
-    torch::jit::Stack stack = boxArgs<FirstArg, RestArgs...>(std::forward<FirstArg>(firstArg), std::forward<RestArgs>(restArgs)...);
+    ReusableBoxedStack reusable_stack;
+    torch::jit::Stack& stack = reusable_stack.get();
+    boxArgsToStack<FirstArg, RestArgs...>(stack, std::forward<FirstArg>(firstArg), std::forward<RestArgs>(restArgs)...);
     boxed_kernel_func.callBoxed(opHandle, dispatchKeySet, &stack);
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
       stack.size() == 1,
@@ -365,7 +437,9 @@ struct BoxedKernelWrapper<
     using ArgTuple = std::tuple<Args...>;
     constexpr int RetCount = std::tuple_size<Result>();
 
-    torch::jit::Stack stack = boxArgs<Args...>(std::forward<Args>(args)...);
+    ReusableBoxedStack reusable_stack;
+    torch::jit::Stack& stack = reusable_stack.get();
+    boxArgsToStack<Args...>(stack, std::forward<Args>(args)...);
     boxed_kernel_func.callBoxed(opHandle, dispatchKeySet, &stack);
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
       stack.size() == RetCount,
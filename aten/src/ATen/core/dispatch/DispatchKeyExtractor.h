@@ -5,6 +5,7 @@
 #include <ATen/core/jit_type.h>
 #include <c10/util/Bitset.h>
 #include <c10/core/DispatchKeySet.h>
+#include <c10/core/impl/LocalDispatchKeySet.h>
 #include <c10/util/irange.h>
 #include <ATen/core/Variadic.h>
 #include <ATen/core/stack.h>
@@ -37,6 +38,20 @@ static inline DispatchKeySet computeDispatchKeySet(
     // function (as opposed to just applying it to the input 'ks').
     DispatchKeySet key_mask
 ) {
+#if !defined(_MSC_VER) && !defined(C10_ANDROID) && !defined(C10_IPHONE)
+  // Fast path for the common case of plain dense CPU/CUDA calls: TLS is
+  // zero-initialized and stays all-zero as long as no dispatch-key guard
+  // (autograd exclusion, InferenceMode, Python mode, functorch, ...) is
+  // active on this thread.  Two raw word compares tell us the TLS is
+  // untouched, in which case the include/exclude adjustment reduces to the
+  // constexpr default sets and folds into compile-time constants, skipping
+  // the LocalDispatchKeySet construction (XOR-decoding) entirely.
+  const auto& raw_tls = c10::impl::raw_local_dispatch_key_set;
+  if (C10_LIKELY(raw_tls.included_ == 0 && raw_tls.excluded_ == 0)) {
+    return (((ks | c10::default_included_set) - c10::default_excluded_set) &
+            key_mask);
+  }
+#endif
   c10::impl::LocalDispatchKeySet local = c10::impl::tls_local_dispatch_key_set();
   // TODO: It's a bit irritating that we have to do logical ORs here, it would
   // be nice to only do one.  Can always_included be folded into the TLS?  Well,
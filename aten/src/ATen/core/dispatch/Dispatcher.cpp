@@ -1,4 +1,6 @@
 #include <ATen/core/dispatch/Dispatcher.h>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <list>
 #include <sstream>
@@ -6,6 +8,38 @@
 
 namespace c10 {
 
+namespace {
+
+// [Note: per-thread operator lookup cache]
+// findOp() goes through a LeftRight-guarded hash map; under many-threaded
+// serving the read-side reference counting and hashing of OperatorName show
+// up in profiles for callers that look up the same handful of operators over
+// and over (e.g. custom-op callers of Dispatcher::call that cannot use a
+// cached TypedOperatorHandle).  Keep a small per-thread direct-mapped cache
+// of positive lookups in front of the table.  The cache is invalidated
+// wholesale whenever the lookup table is mutated, via a global epoch counter
+// bumped on every registration/deregistration.
+struct OperatorLookupThreadCache final {
+  static constexpr size_t kNumSlots = 64;
+
+  struct Slot {
+    OperatorName name{"", ""};
+    c10::optional<OperatorHandle> handle;
+  };
+
+  uint64_t epoch = 0;
+  std::array<Slot, kNumSlots> slots;
+};
+
+std::atomic<uint64_t> operatorLookupTableEpoch{0};
+
+OperatorLookupThreadCache& operatorLookupThreadCache() {
+  static thread_local OperatorLookupThreadCache cache;
+  return cache;
+}
+
+} // namespace
+
 bool show_dispatch_trace() {
     static char const* temp = getenv("TORCH_SHOW_DISPATCH_TRACE");
     return temp != nullptr;
@@ -64,13 +98,35 @@ C10_EXPORT Dispatcher& Dispatcher::realSingleton() {
 }
 
 c10::optional<OperatorHandle> Dispatcher::findOp(const OperatorName& overload_name) {
-  return operatorLookupTable_.read([&] (const ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) -> c10::optional<OperatorHandle> {
+  // see [Note: per-thread operator lookup cache]
+  auto& cache = operatorLookupThreadCache();
+  const auto epoch = operatorLookupTableEpoch.load(std::memory_order_acquire);
+  if (cache.epoch != epoch) {
+    for (auto& slot : cache.slots) {
+      slot.handle = c10::nullopt;
+    }
+    cache.epoch = epoch;
+  }
+  auto& slot = cache.slots[
+      std::hash<OperatorName>()(overload_name) % OperatorLookupThreadCache::kNumSlots];
+  if (slot.handle.has_value() && slot.name == overload_name) {
+    return slot.handle;
+  }
+  auto result = operatorLookupTable_.read([&] (const ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) -> c10::optional<OperatorHandle> {
     auto found = operatorLookupTable.find(overload_name);
     if (found == operatorLookupTable.end()) {
       return c10::nullopt;
     }
     return found->second;
   });
+  // Only positive lookups are cached; a negative result may be invalidated by
+  // a registration on another thread without this thread observing a bump of
+  // the epoch counter in time.
+  if (result.has_value()) {
+    slot.name = overload_name;
+    slot.handle = result;
+  }
+  return result;
 }
 
 // NB: If you add more waitFor* implementations, you also have to add
@@ -160,6 +216,7 @@ OperatorHandle Dispatcher::findOrRegisterName_(const OperatorName& op_name) {
   operatorLookupTable_.write([&] (ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) {
     operatorLookupTable.emplace(op_name, handle);
   });
+  operatorLookupTableEpoch.fetch_add(1, std::memory_order_acq_rel);
 
   return handle;
 }
@@ -317,6 +374,7 @@ void Dispatcher::cleanup(const OperatorHandle& op, const OperatorName& op_name)
     operatorLookupTable_.write([&] (ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) {
       operatorLookupTable.erase(op_name);
     });
+    operatorLookupTableEpoch.fetch_add(1, std::memory_order_acq_rel);
   }
 }
 
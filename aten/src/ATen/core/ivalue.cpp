@@ -10,8 +10,11 @@
 #include <c10/util/StringUtil.h>
 #include <c10/util/hash.h>
 #include <c10/util/irange.h>
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
 
 namespace c10 {
@@ -54,6 +57,48 @@ TORCH_API c10::intrusive_ptr<ConstantString> ConstantString::create(
   return c10::make_intrusive<ConstantString>(std::string(str_));
 }
 
+namespace {
+// Process-wide table backing ConstantString::intern. Entries are weak, so
+// interned strings die normally once their last user goes away; expired
+// entries are swept lazily when the table grows past a high-water mark.
+struct InternedStringsTable {
+  std::mutex mutex;
+  std::unordered_map<std::string, c10::weak_intrusive_ptr<ConstantString>> map;
+  size_t sweep_threshold = 256;
+};
+
+InternedStringsTable& internedStringsTable() {
+  static InternedStringsTable table;
+  return table;
+}
+} // namespace
+
+TORCH_API c10::intrusive_ptr<ConstantString> ConstantString::intern(
+    const std::string& str_) {
+  auto& table = internedStringsTable();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  auto it = table.map.find(str_);
+  if (it != table.map.end()) {
+    if (auto interned = it->second.lock()) {
+      return interned;
+    }
+  }
+  auto interned = c10::make_intrusive<ConstantString>(str_);
+  if (table.map.size() >= table.sweep_threshold) {
+    for (auto entry = table.map.begin(); entry != table.map.end();) {
+      if (entry->second.expired()) {
+        entry = table.map.erase(entry);
+      } else {
+        ++entry;
+      }
+    }
+    table.sweep_threshold = std::max<size_t>(256, table.map.size() * 2);
+  }
+  table.map.insert_or_assign(
+      str_, c10::weak_intrusive_ptr<ConstantString>(interned));
+  return interned;
+}
+
 bool operator==(const ivalue::Tuple& lhs, const ivalue::Tuple& rhs) {
   return lhs.size() == rhs.size() &&
       // see [container equality]
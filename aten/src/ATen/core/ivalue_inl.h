@@ -253,6 +253,14 @@ struct TORCH_API ConstantString final : c10::intrusive_ptr_target {
   static c10::intrusive_ptr<ConstantString> create(std::string str_);
   static c10::intrusive_ptr<ConstantString> create(c10::string_view str_);
   static c10::intrusive_ptr<ConstantString> create(const char* str_);
+  // Returns a shared ConstantString for `str_`, allocating one only if no
+  // live interned copy exists. ConstantStrings are immutable, so sharing
+  // is observable only through identity. The interning table holds weak
+  // references and therefore does not extend any string's lifetime. Meant
+  // for strings that recur many times (constant-table entries, pickled
+  // attribute and dict keys), not for arbitrary runtime strings: every
+  // call takes a global lock.
+  static c10::intrusive_ptr<ConstantString> intern(const std::string& str_);
 
   const std::string& string() const {
     return str_;
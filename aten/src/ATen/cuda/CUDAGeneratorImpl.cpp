@@ -150,6 +150,12 @@ uint64_t CUDAGeneratorImpl::seed() {
 /**
  * Gets the current internal state of CUDAGeneratorImpl. The internal
  * state is returned as a CPU byte tensor.
+ *
+ * Note that this neither launches device work nor synchronizes: the Philox
+ * seed and offset live on the host (device kernels receive them by value and
+ * report consumption back through philox_cuda_state's bookkeeping), and the
+ * legacy MTGP state block is filled with a constant. Snapshotting generators
+ * at a checkpoint therefore does not stall the pipeline.
  */
 c10::intrusive_ptr<c10::TensorImpl> CUDAGeneratorImpl::get_state() const {
   // The RNG state comprises the seed, and an offset used for Philox.
@@ -225,7 +231,7 @@ void CUDAGeneratorImpl::set_philox_offset_per_thread(uint64_t offset) {
  */
 uint64_t CUDAGeneratorImpl::philox_offset_per_thread() const {
   at::cuda::assertNotCapturing("Cannot call CUDAGeneratorImpl::philox_offset_per_thread");
-  return philox_offset_per_thread_;
+  return philox_offset_per_thread_.load();
 }
 
 /**
@@ -289,14 +295,59 @@ PhiloxCudaState CUDAGeneratorImpl::philox_cuda_state(uint64_t increment) {
     TORCH_CHECK(!graph_expects_this_gen_,
                 "CUDA generator expects graph capture to be underway, "
                 "but the current stream is not capturing.");
+    // Single lock-free fetch_add; see Note [Batched Philox offset reservation]
+    uint64_t offset = this->philox_offset_per_thread_.fetch_add(increment);
     // see Note [Why enforce RNG offset % 4 == 0?]
-    TORCH_INTERNAL_ASSERT(this->philox_offset_per_thread_ % 4 == 0);
-    uint64_t offset = this->philox_offset_per_thread_;
-    this->philox_offset_per_thread_ += increment;
+    TORCH_INTERNAL_ASSERT(offset % 4 == 0);
     return PhiloxCudaState(this->seed_, offset);
   }
 }
 
+/**
+ * Reserves a bulk range of `increment` Philox offsets in one shot and
+ * returns its base. The caller sub-allocates out of [base, base + increment)
+ * itself; see Note [Batched Philox offset reservation].
+ */
+uint64_t CUDAGeneratorImpl::reserve_philox_offsets(uint64_t increment) {
+  at::cuda::assertNotCapturing("Cannot call CUDAGeneratorImpl::reserve_philox_offsets");
+  // rounds increment up to the nearest multiple of 4
+  increment = ((increment + 3) / 4) * 4;
+  uint64_t offset = this->philox_offset_per_thread_.fetch_add(increment);
+  // see Note [Why enforce RNG offset % 4 == 0?]
+  TORCH_INTERNAL_ASSERT(offset % 4 == 0);
+  return offset;
+}
+
+PhiloxOffsetReservation::PhiloxOffsetReservation(
+    CUDAGeneratorImpl* gen,
+    uint64_t increments_per_refill)
+    : gen_(gen),
+      refill_size_(((increments_per_refill + 3) / 4) * 4),
+      seed_(gen->current_seed()) {
+  TORCH_CHECK(refill_size_ > 0, "increments_per_refill must be positive");
+}
+
+/**
+ * See Note [Batched Philox offset reservation]. Unlike
+ * CUDAGeneratorImpl::philox_cuda_state, this neither locks nor touches the
+ * generator except on refill.
+ */
+PhiloxCudaState PhiloxOffsetReservation::philox_cuda_state(uint64_t increment) {
+  // rounds increment up to the nearest multiple of 4
+  increment = ((increment + 3) / 4) * 4;
+  if (next_ + increment > end_ || end_ == 0) {
+    auto reserve = std::max(refill_size_, increment);
+    next_ = gen_->reserve_philox_offsets(reserve);
+    end_ = next_ + reserve;
+    // Pick up any reseed since the previous refill; offsets handed out from
+    // one refill always pair with the seed in effect when it was taken.
+    seed_ = gen_->current_seed();
+  }
+  uint64_t offset = next_;
+  next_ += increment;
+  return PhiloxCudaState(seed_, offset);
+}
+
 /**
  * Temporarily accommodates call sites that use philox_engine_inputs.
  * Allows incremental refactor of call sites to use philox_cuda_state.
@@ -306,10 +357,9 @@ std::pair<uint64_t, uint64_t> CUDAGeneratorImpl::philox_engine_inputs(uint64_t i
                                "Cannot call CUDAGeneratorImpl::philox_engine_inputs");
   // rounds increment up to the nearest multiple of 4
   increment = ((increment + 3) / 4) * 4;
+  uint64_t offset = this->philox_offset_per_thread_.fetch_add(increment);
   // see Note [Why enforce RNG offset % 4 == 0?]
-  TORCH_INTERNAL_ASSERT(this->philox_offset_per_thread_ % 4 == 0);
-  uint64_t offset = this->philox_offset_per_thread_;
-  this->philox_offset_per_thread_ += increment;
+  TORCH_INTERNAL_ASSERT(offset % 4 == 0);
   return std::make_pair(this->seed_, offset);
 }
 
@@ -104,6 +104,7 @@ struct TORCH_CUDA_CPP_API CUDAGeneratorImpl : public c10::GeneratorImpl {
   void capture_prologue(int64_t* seed_extragraph, int64_t* offset_extragraph);
   uint64_t capture_epilogue();
   PhiloxCudaState philox_cuda_state(uint64_t increment);
+  uint64_t reserve_philox_offsets(uint64_t increment);
 
   bool reset_rnn_state() {
     return !no_reset_rnn_state_.test_and_set();
@@ -118,7 +119,10 @@ struct TORCH_CUDA_CPP_API CUDAGeneratorImpl : public c10::GeneratorImpl {
 private:
   CUDAGeneratorImpl* clone_impl() const override;
   uint64_t seed_ = default_rng_seed_val;
-  uint64_t philox_offset_per_thread_ = 0;
+  // Atomic so that offset reservation (philox_cuda_state and
+  // reserve_philox_offsets outside capture) is a single lock-free fetch_add;
+  // see Note [Batched Philox offset reservation].
+  std::atomic<uint64_t> philox_offset_per_thread_{0};
   int64_t* seed_extragraph_{};
   int64_t* offset_extragraph_{};
   uint32_t offset_intragraph_ = 0;
@@ -126,6 +130,52 @@ private:
   std::atomic_flag no_reset_rnn_state_;
 };
 
+/**
+ * Note [Batched Philox offset reservation]
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Outside graph capture, handing out a Philox range is just a bump of
+ * philox_offset_per_thread_. The counter is atomic, so the bump itself does
+ * not need the generator mutex (the mutex still serializes seed changes and
+ * get_state/set_state against offset consumption; see
+ * Note [Acquire lock when using random generators]). Even so, dropout-heavy
+ * models touch the shared counter dozens of times per step, and under
+ * multi-stream enqueue those fetch_adds all contend on one cache line.
+ *
+ * A PhiloxOffsetReservation amortizes that: it grabs a bulk range from the
+ * generator up front and sub-allocates PhiloxCudaStates out of it with plain
+ * (unsynchronized) arithmetic, refilling from the shared counter only when
+ * the range is exhausted. A reservation is deliberately not thread-safe --
+ * create one per stream (or per enqueuing thread) so the only cross-stream
+ * traffic is the occasional bulk refill.
+ *
+ * Reservations are not graph-capture-safe: reserve_philox_offsets asserts
+ * that no capture is underway, and a reservation must not be carried across
+ * a capture region (use philox_cuda_state there, which has the capture
+ * bookkeeping). Unused tail offsets in a dropped reservation are simply
+ * skipped bitstream; that is harmless, kernels routinely over-increment
+ * already.
+ */
+class TORCH_CUDA_CPP_API PhiloxOffsetReservation {
+ public:
+  // `gen` must outlive the reservation (the default generators always do).
+  // `increments_per_refill` is the bulk range grabbed from the generator on
+  // each refill, in offset units; size it to roughly one step's consumption.
+  PhiloxOffsetReservation(
+      CUDAGeneratorImpl* gen,
+      uint64_t increments_per_refill);
+
+  // Drop-in for CUDAGeneratorImpl::philox_cuda_state, served from the
+  // reserved range without touching the generator. No lock is required.
+  PhiloxCudaState philox_cuda_state(uint64_t increment);
+
+ private:
+  CUDAGeneratorImpl* gen_;
+  uint64_t refill_size_;
+  uint64_t seed_;
+  uint64_t next_ = 0;
+  uint64_t end_ = 0;
+};
+
 namespace cuda {
 namespace detail {
 
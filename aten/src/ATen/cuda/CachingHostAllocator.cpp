@@ -7,13 +7,19 @@
 
 #include <cuda_runtime_api.h>
 #include <stdint.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
 #include <deque>
 #include <memory>
 #include <mutex>
 #include <set>
+#include <sstream>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace at {
 namespace cuda {
@@ -32,6 +38,96 @@ struct Block {
   bool allocated_{false};
   size_t event_count_{0};
   std::unordered_set<at::cuda::CUDAStream> streams_;
+  // When this block was last inserted into the free list; used by the
+  // idle-trim policy. Only meaningful while the block is on the free list.
+  std::chrono::steady_clock::time_point free_since_;
+};
+
+/**
+ * Note [CUDAHostAllocator pool policies]
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * By default the pinned memory pool grows without bound on allocation bursts
+ * and holds every block until empty_cache() is called. On shared hosts this
+ * can starve other processes of physical memory, so the pool can be shaped
+ * through the PYTORCH_CUDA_HOST_ALLOC_CONF environment variable, a
+ * comma-separated list of `option:value` pairs:
+ *
+ *   max_size_mb:<n>          Cap reserved pinned memory at n MiB. When a new
+ *                            block would exceed the cap, cached blocks are
+ *                            freed (largest first) to make room; if that is
+ *                            not enough the allocation throws OutOfMemoryError.
+ *                            0 (default) means unlimited.
+ *   trim_timeout_seconds:<n> Free cached blocks that have sat unused on the
+ *                            free list for more than n seconds. Trimming
+ *                            happens opportunistically on the allocation
+ *                            path. 0 (default) disables trimming.
+ *   prealloc:<mb>x<count>[;<mb>x<count>...]
+ *                            Pre-pin `count` blocks of `mb` MiB per entry when
+ *                            the allocator is first used, so latency-critical
+ *                            paths never pay for cudaHostAlloc. Sizes are
+ *                            rounded up to the allocator's power-of-two size
+ *                            classes.
+ *
+ * e.g. PYTORCH_CUDA_HOST_ALLOC_CONF=max_size_mb:2048,prealloc:16x8;64x2
+ *
+ * Counters in the style of CUDACachingAllocator::getDeviceStats are kept for
+ * all of these policies and exposed via CachingHostAllocator_getStats().
+ */
+struct HostAllocatorConfig {
+  // Cap on reserved bytes; 0 means unlimited.
+  size_t max_size_{0};
+  // Free-list entries idle for longer than this are trimmed; 0 disables.
+  std::chrono::seconds trim_timeout_{0};
+  // (bytes, count) pairs pinned at first use.
+  std::vector<std::pair<size_t, size_t>> prealloc_;
+
+  static const HostAllocatorConfig& instance() {
+    static HostAllocatorConfig config = parse();
+    return config;
+  }
+
+ private:
+  static HostAllocatorConfig parse() {
+    HostAllocatorConfig config;
+    const char* env = std::getenv("PYTORCH_CUDA_HOST_ALLOC_CONF");
+    if (env == nullptr) {
+      return config;
+    }
+    std::istringstream stream(env);
+    std::string option;
+    while (std::getline(stream, option, ',')) {
+      const auto colon = option.find(':');
+      TORCH_CHECK(
+          colon != std::string::npos,
+          "Expected option:value format in PYTORCH_CUDA_HOST_ALLOC_CONF, got ",
+          option);
+      const auto key = option.substr(0, colon);
+      const auto value = option.substr(colon + 1);
+      if (key == "max_size_mb") {
+        config.max_size_ = std::stoull(value) * 1024 * 1024;
+      } else if (key == "trim_timeout_seconds") {
+        config.trim_timeout_ = std::chrono::seconds(std::stoull(value));
+      } else if (key == "prealloc") {
+        std::istringstream entries(value);
+        std::string entry;
+        while (std::getline(entries, entry, ';')) {
+          const auto x = entry.find('x');
+          TORCH_CHECK(
+              x != std::string::npos,
+              "Expected <mb>x<count> format in PYTORCH_CUDA_HOST_ALLOC_CONF "
+              "prealloc entry, got ",
+              entry);
+          config.prealloc_.emplace_back(
+              std::stoull(entry.substr(0, x)) * 1024 * 1024,
+              std::stoull(entry.substr(x + 1)));
+        }
+      } else {
+        TORCH_CHECK(
+            false, "Unrecognized PYTORCH_CUDA_HOST_ALLOC_CONF option: ", key);
+      }
+    }
+    return config;
+  }
 };
 
 // Note: cudaEventCreate when concurrently invoked from multiple threads can be
@@ -143,6 +239,21 @@ struct BlockComparator {
  */
 class CUDAHostAllocator {
  public:
+  CUDAHostAllocator() {
+    // Pre-pin the configured size classes so the first burst of allocations
+    // is served from the free list. See Note [CUDAHostAllocator pool
+    // policies].
+    for (const auto& entry : HostAllocatorConfig::instance().prealloc_) {
+      const auto size = c10::llvm::PowerOf2Ceil(entry.first);
+      for (size_t i = 0; i < entry.second; ++i) {
+        auto* block = allocate_pinned_block(size);
+        block->free_since_ = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> g(free_list_mutex_);
+        free_list_.insert(block);
+      }
+    }
+  }
+
   std::pair<void*, void*> allocate(size_t size) {
     if (size == 0) {
       return {nullptr, nullptr};
@@ -150,6 +261,11 @@ class CUDAHostAllocator {
 
     process_events();
 
+    const auto& config = HostAllocatorConfig::instance();
+    if (config.trim_timeout_.count() != 0) {
+      trim_expired_blocks(config.trim_timeout_);
+    }
+
     // First, try to allocate from the free list
     {
       std::lock_guard<std::mutex> g(free_list_mutex_);
@@ -158,35 +274,56 @@ class CUDAHostAllocator {
         auto block = *it;
         block->allocated_ = true;
         free_list_.erase(it);
+        {
+          std::lock_guard<std::mutex> gs(stats_mutex_);
+          stat_increase(stats_.allocation, 1);
+          stat_increase(stats_.allocated_bytes, block->size_);
+        }
         return {block->ptr_, reinterpret_cast<void*>(block)};
       }
     }
-    // Then, create a new block.
-    // Pinned memory pointers allocated by any device can be directly used by
-    // any other device, regardless of the current device at the time of
-    // allocation, since we assume unified addressing. So we grab any existing
-    // primary context, if available. See pytorch/pytorch#21081.
-    at::OptionalDeviceGuard device_guard;
-    auto primary_ctx_device_index =
-        at::cuda::detail::getDeviceIndexWithPrimaryContext();
-    if (primary_ctx_device_index.has_value()) {
-      device_guard.reset_device(
-          at::Device(at::DeviceType::CUDA, *primary_ctx_device_index));
-    }
 
     // Round up the allocation to the nearest power of two to improve reuse.
-    void* ptr = nullptr;
-    C10_CUDA_CHECK(cudaHostAlloc(
-        &ptr, c10::llvm::PowerOf2Ceil(size), cudaHostAllocDefault));
-    auto block = new Block();
-    block->size_ = c10::llvm::PowerOf2Ceil(size);
-    block->ptr_ = ptr;
-    block->allocated_ = true;
+    const auto rounded_size = c10::llvm::PowerOf2Ceil(size);
 
+    // Enforce the configured cap on reserved pinned memory, freeing cached
+    // blocks to make room before giving up. The check is best-effort with
+    // respect to concurrent allocations, like the rest of this allocator.
+    if (config.max_size_ != 0) {
+      size_t reserved = 0;
+      {
+        std::lock_guard<std::mutex> g(stats_mutex_);
+        reserved = static_cast<size_t>(stats_.reserved_bytes.current);
+      }
+      if (reserved + rounded_size > config.max_size_) {
+        release_cached_blocks(reserved + rounded_size - config.max_size_);
+        {
+          std::lock_guard<std::mutex> g(stats_mutex_);
+          reserved = static_cast<size_t>(stats_.reserved_bytes.current);
+          if (reserved + rounded_size > config.max_size_) {
+            stats_.num_ooms++;
+          }
+        }
+        TORCH_CHECK_WITH(
+            OutOfMemoryError,
+            reserved + rounded_size <= config.max_size_,
+            "CUDA host allocator is at its configured limit of ",
+            config.max_size_,
+            " bytes (",
+            reserved,
+            " bytes reserved, ",
+            rounded_size,
+            " bytes requested). See PYTORCH_CUDA_HOST_ALLOC_CONF.");
+      }
+    }
+
+    // Then, create a new block.
+    auto* block = allocate_pinned_block(rounded_size);
+    block->allocated_ = true;
     {
-      std::lock_guard<std::mutex> g(blocks_mutex_);
-      blocks_.insert(block);
-      ptr_to_block_.insert({block->ptr_, block});
+      std::lock_guard<std::mutex> g(stats_mutex_);
+      stat_increase(stats_.allocation, 1);
+      stat_increase(stats_.allocated_bytes, block->size_);
     }
     return {block->ptr_, reinterpret_cast<void*>(block)};
   }
@@ -219,7 +356,14 @@ class CUDAHostAllocator {
       }
     }
 
+    {
+      std::lock_guard<std::mutex> g(stats_mutex_);
+      stat_decrease(stats_.allocation, 1);
+      stat_decrease(stats_.allocated_bytes, block->size_);
+    }
+
     if (!events) {
+      block->free_since_ = std::chrono::steady_clock::now();
       std::lock_guard<std::mutex> g(free_list_mutex_);
       free_list_.insert(block);
     } else {
@@ -281,11 +425,136 @@ class CUDAHostAllocator {
       blocks_.erase(block);
       ptr_to_block_.erase(block->ptr_);
       AT_CUDA_CHECK(cudaFreeHost(block->ptr_));
+      {
+        std::lock_guard<std::mutex> g(stats_mutex_);
+        stat_decrease(stats_.segment, 1);
+        stat_decrease(stats_.reserved_bytes, block->size_);
+      }
       delete block;
     }
   }
 
+  HostStats get_stats() {
+    std::lock_guard<std::mutex> g(stats_mutex_);
+    HostStats stats = stats_;
+    stats.max_size =
+        static_cast<int64_t>(HostAllocatorConfig::instance().max_size_);
+    return stats;
+  }
+
  private:
+  using Stat = c10::cuda::CUDACachingAllocator::Stat;
+
+  static void stat_increase(Stat& stat, int64_t amount) {
+    stat.current += amount;
+    stat.peak = std::max(stat.current, stat.peak);
+    stat.allocated += amount;
+  }
+
+  static void stat_decrease(Stat& stat, int64_t amount) {
+    stat.current -= amount;
+    stat.freed += amount;
+  }
+
+  // Pins a new block of exactly `size` bytes and registers it in the block
+  // list. The caller is responsible for putting it on the free list or
+  // handing it out.
+  Block* allocate_pinned_block(size_t size) {
+    // Pinned memory pointers allocated by any device can be directly used by
+    // any other device, regardless of the current device at the time of
+    // allocation, since we assume unified addressing. So we grab any existing
+    // primary context, if available. See pytorch/pytorch#21081.
+    at::OptionalDeviceGuard device_guard;
+    auto primary_ctx_device_index =
+        at::cuda::detail::getDeviceIndexWithPrimaryContext();
+    if (primary_ctx_device_index.has_value()) {
+      device_guard.reset_device(
+          at::Device(at::DeviceType::CUDA, *primary_ctx_device_index));
+    }
+
+    void* ptr = nullptr;
+    C10_CUDA_CHECK(cudaHostAlloc(&ptr, size, cudaHostAllocDefault));
+    auto* block = new Block();
+    block->size_ = size;
+    block->ptr_ = ptr;
+
+    {
+      std::lock_guard<std::mutex> g(blocks_mutex_);
+      blocks_.insert(block);
+      ptr_to_block_.insert({block->ptr_, block});
+    }
+    {
+      std::lock_guard<std::mutex> g(stats_mutex_);
+      stat_increase(stats_.segment, 1);
+      stat_increase(stats_.reserved_bytes, block->size_);
+    }
+    return block;
+  }
+
+  // Unpins and deletes `block`, which must already have been removed from
+  // the free list and the block list.
+  void release_block(Block* block) {
+    AT_CUDA_CHECK(cudaFreeHost(block->ptr_));
+    {
+      std::lock_guard<std::mutex> g(stats_mutex_);
+      stat_decrease(stats_.segment, 1);
+      stat_decrease(stats_.reserved_bytes, block->size_);
+    }
+    delete block;
+  }
+
+  // Frees cached blocks that have been idle on the free list for longer than
+  // `timeout`. See Note [CUDAHostAllocator pool policies].
+  void trim_expired_blocks(std::chrono::seconds timeout) {
+    const auto cutoff = std::chrono::steady_clock::now() - timeout;
+    std::vector<Block*> blocks_to_remove;
+    {
+      std::lock(free_list_mutex_, blocks_mutex_);
+      std::lock_guard<std::mutex> gf(free_list_mutex_, std::adopt_lock);
+      std::lock_guard<std::mutex> gb(blocks_mutex_, std::adopt_lock);
+      for (auto it = free_list_.begin(); it != free_list_.end();) {
+        auto* block = *it;
+        if (block->free_since_ < cutoff) {
+          it = free_list_.erase(it);
+          blocks_.erase(block);
+          ptr_to_block_.erase(block->ptr_);
+          blocks_to_remove.push_back(block);
+        } else {
+          ++it;
+        }
+      }
+    }
+    for (auto* block : blocks_to_remove) {
+      release_block(block);
+    }
+  }
+
+  // Frees cached blocks, largest first, until at least `bytes_needed` bytes
+  // of reserved memory have been released or the free list is empty. Used to
+  // stay under the configured cap.
+  void release_cached_blocks(size_t bytes_needed) {
+    size_t released = 0;
+    std::vector<Block*> blocks_to_remove;
+    {
+      std::lock(free_list_mutex_, blocks_mutex_);
+      std::lock_guard<std::mutex> gf(free_list_mutex_, std::adopt_lock);
+      std::lock_guard<std::mutex> gb(blocks_mutex_, std::adopt_lock);
+      auto it = free_list_.end();
+      while (it != free_list_.begin() && released < bytes_needed) {
+        --it;
+        auto* block = *it;
+        it = free_list_.erase(it);
+        blocks_.erase(block);
+        ptr_to_block_.erase(block->ptr_);
+        blocks_to_remove.push_back(block);
+        released += block->size_;
+      }
+    }
+    for (auto* block : blocks_to_remove) {
+      release_block(block);
+    }
+  }
+
   void process_events() {
     while (true) {
       // Avoid calling cudaEventDestroy while holding a mutex, so move
@@ -338,6 +607,7 @@ class CUDAHostAllocator {
       }
 
       if (available) {
+        block->free_since_ = std::chrono::steady_clock::now();
         std::lock_guard<std::mutex> g(free_list_mutex_);
         free_list_.insert(block);
       }
@@ -358,6 +628,9 @@ class CUDAHostAllocator {
 
   alignas(64) std::mutex cuda_events_mutex_;
   std::deque<std::pair<EventPool::Event, Block*>> cuda_events_;
+
+  alignas(64) std::mutex stats_mutex_;
+  HostStats stats_;
 };
 
 } // namespace
@@ -384,6 +657,10 @@ void CachingHostAllocator_emptyCache() {
   getCUDAHostAllocator().empty_cache();
 }
 
+HostStats CachingHostAllocator_getStats() {
+  return getCUDAHostAllocator().get_stats();
+}
+
 struct CUDAHostAllocatorWrapper final : public at::Allocator {
   at::DataPtr allocate(size_t size) const override {
     auto ptr_and_ctx = getCUDAHostAllocator().allocate(size);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <c10/core/Allocator.h>
+#include <c10/cuda/CUDACachingAllocator.h>
 #include <c10/cuda/CUDAStream.h>
 
 namespace at {
@@ -31,6 +32,32 @@ CachingHostAllocator_recordEvent(void* ptr, void* ctx, c10::cuda::CUDAStream str
 // Releases cached pinned memory allocations via cudaHostFree
 TORCH_CUDA_CPP_API void CachingHostAllocator_emptyCache();
 
+// Summary statistics for the caching host allocator, in the same shape as
+// the per-pool entries of CUDACachingAllocator::DeviceStats. Pinned memory is
+// a single host-wide pool, so there is one Stat per quantity rather than a
+// StatArray.
+struct HostStats {
+  using Stat = c10::cuda::CUDACachingAllocator::Stat;
+  // COUNT: allocations requested by client code
+  Stat allocation;
+  // COUNT: number of pinned segments from cudaHostAlloc()
+  Stat segment;
+  // SUM: bytes allocated by client code (after rounding)
+  Stat allocated_bytes;
+  // SUM: bytes reserved by this allocator (both free and used)
+  Stat reserved_bytes;
+  // COUNT: allocations that failed because the configured cap was reached
+  // and trimming the cache could not make room
+  int64_t num_ooms = 0;
+  // SIZE: configured cap on reserved_bytes (0 means unlimited)
+  int64_t max_size = 0;
+};
+
+// Returns a snapshot of the host allocator statistics. See
+// Note [CUDAHostAllocator pool policies] for the policies controlling the
+// pool and how to configure them.
+TORCH_CUDA_CPP_API HostStats CachingHostAllocator_getStats();
+
 inline TORCH_CUDA_CPP_API at::DataPtr HostAlloc(size_t size) {
   return getCachingHostAllocator()->allocate(size);
 }
@@ -55,8 +55,8 @@ Tensor JvpInterpreterPtr::lift(const Tensor& tensor) const {
 static void autogradBasedTransformProcess(
     const c10::OperatorHandle& op,
     torch::jit::Stack* stack,
-    int64_t current_level,
-    TransformType transform_type) {
+    const Interpreter& interpreter) {
+  auto current_level = interpreter.level();
   // if is a grad transform, and the operation is in-place, and the mutated
   // argument is not currently wrapped in a TensorWrapper, then we need to
   // error out otherwise the result is silently incorrect
@@ -69,8 +69,9 @@ static void autogradBasedTransformProcess(
   auto num_args = op.schema().arguments().size();
   foreachTensorInplace(*stack, stack->size() - num_args, stack->size(), maybeTransformGradWrappers);
 
-  auto exclude = keysToExcludeWhenEnteringDynamicLayer(transform_type);
-  setup_dispatch_key_tls(exclude, {});
+  // The keysets were precomputed when this interpreter's layer was pushed.
+  // See NOTE: [Interpreter dispatch plan]
+  setup_dispatch_key_tls(interpreter.excludeDispatchKeys(), interpreter.includeDispatchKeys());
   op.callBoxed(stack);
 }
 
@@ -201,7 +202,7 @@ static void autogradBasedTransformSendToNext(
 void GradInterpreterPtr::processImpl(
     const c10::OperatorHandle& op,
     torch::jit::Stack* stack) {
-  autogradBasedTransformProcess(op, stack, level(), TransformType::Grad);
+  autogradBasedTransformProcess(op, stack, *base_);
 }
 
 void GradInterpreterPtr::sendToNextInterpreterImpl(
@@ -219,7 +220,7 @@ void GradInterpreterPtr::sendToNextInterpreterImpl(
 void JvpInterpreterPtr::processImpl(
     const c10::OperatorHandle& op,
     torch::jit::Stack* stack) {
-  autogradBasedTransformProcess(op, stack, level(), TransformType::Jvp);
+  autogradBasedTransformProcess(op, stack, *base_);
 }
 
 void JvpInterpreterPtr::sendToNextInterpreterImpl(
@@ -12,11 +12,17 @@
 
 #include <ATen/Context.h>
 #include <ATen/MatrixRef.h>
+#include <ATen/Parallel.h>
+#include <ATen/ThreadLocalState.h>
 #include <ATen/core/dispatch/Dispatcher.h>
 #include <c10/util/accumulate.h>
 #include <c10/util/llvmMathExtras.h>
 #include <c10/util/irange.h>
 
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 namespace at {
 namespace functorch {
 
@@ -40,6 +46,23 @@ void setVmapFallbackEnabled(bool enabled) {
   kVmapFallbackEnabled = enabled;
 }
 
+// Per-operator counts of how many times the fallback has run. The map is
+// protected by a mutex because vmapped regions may execute from multiple
+// threads. Exposed via torch._C._functorch._vmap_fallback_usage() so that
+// users can tell which batching rules are worth requesting next.
+static std::mutex fallback_usage_mutex;
+static std::unordered_map<std::string, int64_t> fallback_usage;
+
+std::unordered_map<std::string, int64_t> getVmapFallbackUsage() {
+  std::lock_guard<std::mutex> guard(fallback_usage_mutex);
+  return fallback_usage;
+}
+
+void resetVmapFallbackUsage() {
+  std::lock_guard<std::mutex> guard(fallback_usage_mutex);
+  fallback_usage.clear();
+}
+
 // Given a linear index, return the actual index.
 // Example: Given linear_idx = 3, sizes = [5, 2], we would return [1, 0]
 static at::SmallVector<indexing::TensorIndex,kVmapStaticDimVecSize>
@@ -76,6 +99,10 @@ static bool areAnyArgumentsTensorList(const at::FunctionSchema& schema) {
 static void warnFallback(const c10::FunctionSchema& schema, bool is_inplace) {
   TORCH_CHECK(isVmapFallbackEnabled(),
       schema.operator_name(), " hit the vmap fallback which is currently disabled");
+  {
+    std::lock_guard<std::mutex> guard(fallback_usage_mutex);
+    fallback_usage[toString(schema.operator_name())] += 1;
+  }
   if (!isVmapFallbackWarningEnabled()) {
     return;
   }
@@ -325,7 +352,7 @@ void batchedTensorForLoopFallback(const c10::OperatorHandle& op, torch::jit::Sta
       "The fallback path does not support vmap over dims of size 0.");
 
   // Strategy: For each batch, we are going to push slices (where applicable)
-  // of the arguments onto `stack`, call `op`, and store the result in
+  // of the arguments onto a scratch stack, call `op`, and store the result in
   // `output_shards`.
   //
   // NOTE: [Output shards layout]
@@ -336,7 +363,11 @@ void batchedTensorForLoopFallback(const c10::OperatorHandle& op, torch::jit::Sta
   // more easily in the next step.
   std::vector<Tensor> output_shards(num_batches * num_returns);
 
-  for (int64_t linear_idx = 0; linear_idx < num_batches; ++linear_idx) {
+  // Runs `op` on the slices for a single batch. Each caller supplies its own
+  // scratch stack so that batches may be processed concurrently; the original
+  // `stack` is only read from. Different batches write to disjoint entries of
+  // `output_shards`.
+  auto process_batch = [&](int64_t linear_idx, torch::jit::Stack& local_stack) {
     auto index = computeIndex(linear_idx, batch_sizes);
     auto batched_tensor_inputs_pos_iter = batched_tensor_inputs_position.begin();
     auto input_physical_views_iter = input_physical_views.begin();
@@ -347,30 +378,63 @@ void batchedTensorForLoopFallback(const c10::OperatorHandle& op, torch::jit::Sta
       if (batched_tensor_inputs_pos_iter == batched_tensor_inputs_position.end()
           || (int64_t)arg_idx != *batched_tensor_inputs_pos_iter) {
         // argument isn't a BatchedTensor
-        torch::jit::push(stack, argument);
+        torch::jit::push(&local_stack, argument);
         continue;
       }
       // argument is a BatchedTensor
       TORCH_INTERNAL_ASSERT(input_physical_views_iter != input_physical_views.end());
       const auto& physical_view_for_argument = *input_physical_views_iter;
       c10::impl::ExcludeDispatchKeyGuard guard(DispatchKey::FuncTorchBatched);
-      torch::jit::push(stack, physical_view_for_argument.tensor().index(index));
+      torch::jit::push(&local_stack, physical_view_for_argument.tensor().index(index));
       batched_tensor_inputs_pos_iter++;
       input_physical_views_iter++;
     }
 
-    // std::cout << "[Fallback]: ";
-    // at::dump_tensor((*stack)[stack->size() - 1].toTensor());
     c10::impl::ExcludeDispatchKeyGuard guard(DispatchKey::FuncTorchBatched);
-    op.callBoxed(stack);
+    op.callBoxed(&local_stack);
 
     // Store the result into `output_shards`. See NOTE: [Output shards layout]
     // to learn about the details of how we store the shards.
-    const auto returns = torch::jit::last(stack, num_returns);
+    const auto returns = torch::jit::last(&local_stack, num_returns);
     for (const auto  return_idx : c10::irange(0, returns.size())) {
       output_shards[num_batches * return_idx + linear_idx] = returns[return_idx].toTensor();
     }
-    torch::jit::drop(stack, num_returns);
+    torch::jit::drop(&local_stack, num_returns);
+  };
+
+  // The per-batch calls are independent, so run them with intra-op
+  // parallelism when all the tensors involved live on CPU. at::parallel_for
+  // does not preserve TLS across thread boundaries and the dispatch below
+  // depends on it (the local dispatch key set and the functorch interpreter
+  // stack both live in TLS), so each worker re-installs the caller's
+  // thread-local state. CUDA is excluded because the current stream is also
+  // thread-local and is not captured by ThreadLocalState; workers would
+  // enqueue onto the wrong stream.
+  bool all_tensors_on_cpu = true;
+  for (const auto& ivalue : arguments) {
+    if (ivalue.isTensor()) {
+      const auto& tensor = ivalue.toTensor();
+      if (tensor.defined() && !tensor.is_cpu()) {
+        all_tensors_on_cpu = false;
+        break;
+      }
+    }
+  }
+
+  if (all_tensors_on_cpu) {
+    const auto thread_locals = ThreadLocalState();
+    at::parallel_for(0, num_batches, 1, [&](int64_t begin, int64_t end) {
+      ThreadLocalStateGuard tls_guard(thread_locals);
+      torch::jit::Stack local_stack;
+      for (const auto linear_idx : c10::irange(begin, end)) {
+        process_batch(linear_idx, local_stack);
+      }
+    });
+  } else {
+    torch::jit::Stack local_stack;
+    for (const auto linear_idx : c10::irange(0, num_batches)) {
+      process_batch(linear_idx, local_stack);
+    }
   }
 
   // For each output Tensor, stack the shards of the tensor together to form a return
@@ -9,6 +9,9 @@
 #include <ATen/core/op_registration/op_registration.h>
 #include <torch/library.h>
 
+#include <string>
+#include <unordered_map>
+
 namespace at {
 namespace functorch {
 
@@ -42,6 +45,11 @@ TORCH_API void setVmapFallbackWarningEnabled(bool enabled);
 TORCH_API bool isVmapFallbackEnabled();
 TORCH_API void setVmapFallbackEnabled(bool enabled);
 
+// The fallback counts, per operator, how many times it has run. This tells
+// users which batching rules would be the most valuable to implement next.
+TORCH_API std::unordered_map<std::string, int64_t> getVmapFallbackUsage();
+TORCH_API void resetVmapFallbackUsage();
+
 template <typename A> A vector_to_result(const std::vector<IValue>& buffer) {
   return buffer[0].to<A>();
 }
@@ -15,12 +15,9 @@ static void sanityCheckNotFunctional(const c10::OperatorHandle& op, torch::jit::
 void FunctionalizeInterpreterPtr::processImpl(
     const c10::OperatorHandle& op,
     torch::jit::Stack* stack) {
-  DispatchKeySet exclude = keysToExcludeWhenEnteringDynamicLayer(TransformType::Functionalize);
-
-  // We always want to call the functionalization kernels if functionalize() is on the layer stack.
-  // It's the responsibility of the functionalization kernel to no-op and redispatch
-  // if none of the input tensors are functional.
-  setup_dispatch_key_tls(exclude, DispatchKeySet(DispatchKey::Functionalize));
+  // The keysets were precomputed when this interpreter's layer was pushed.
+  // See NOTE: [Interpreter dispatch plan]
+  setup_dispatch_key_tls(base_->excludeDispatchKeys(), base_->includeDispatchKeys());
   auto functionalization_add_back_views = functionalizeAddBackViews();
   // We have some side-car TLS that we can set to toggle the functionaliation behavior.
   // If set, then we functionalization will only remove mutations, instead of
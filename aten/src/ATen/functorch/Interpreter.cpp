@@ -54,6 +54,22 @@ DispatchKeySet keysToExcludeWhenEnteringDynamicLayer(TransformType key) {
   return exclude;
 }
 
+DispatchKeySet keysToIncludeWhenEnteringDynamicLayer(TransformType key) {
+  if (key == TransformType::Vmap) {
+    return DispatchKeySet(DispatchKey::FuncTorchVmapMode);
+  } else if (key == TransformType::Grad || key == TransformType::Jvp) {
+    return DispatchKeySet();
+  } else if (key == TransformType::Functionalize) {
+    // We always want to call the functionalization kernels if functionalize()
+    // is on the layer stack. It's the responsibility of the functionalization
+    // kernel to no-op and redispatch if none of the input tensors are
+    // functional.
+    return DispatchKeySet(DispatchKey::Functionalize);
+  } else {
+    TORCH_INTERNAL_ASSERT(false, "Unsupported key: ", key);
+  }
+}
+
 void setup_dispatch_key_tls(DispatchKeySet exclude, DispatchKeySet include) {
   auto local_keyset = c10::impl::tls_local_dispatch_key_set();
   local_keyset.excluded_ = local_keyset.excluded_ | exclude;
@@ -118,6 +118,21 @@ typedef c10::variant<
   FunctionalizeInterpreterMeta
 > InterpreterMeta;
 
+DispatchKeySet keysToExcludeWhenEnteringDynamicLayer(TransformType key);
+DispatchKeySet keysToIncludeWhenEnteringDynamicLayer(TransformType key);
+
+// NOTE: [Interpreter dispatch plan]
+//
+// Every op dispatched while a transform is active goes through
+// Interpreter::process, which mutates the local dispatch key set so that
+// only the keys belonging to the transform are enabled. The keysets to
+// exclude/include depend only on the transform type, so instead of
+// recomputing them on every dispatched op we compute them once, when the
+// interpreter is constructed (i.e. when the layer is pushed onto the
+// DynamicLayerStack). The per-op path then just reads the two cached
+// keysets. Pushing/popping a layer replaces the interpreter at the top of
+// the stack, which is what keeps the cached plan in sync with the stack
+// configuration.
 
 struct Interpreter {
   // factory functions
@@ -142,6 +157,11 @@ struct Interpreter {
   void process(const c10::OperatorHandle& op, torch::jit::Stack* stack);
   void sendToNextInterpreter(const c10::OperatorHandle& op, torch::jit::Stack* stack, bool grad_special_case);
 
+  // Cached dispatch plan for this interpreter.
+  // See NOTE: [Interpreter dispatch plan]
+  DispatchKeySet excludeDispatchKeys() const { return keysToExclude_; }
+  DispatchKeySet includeDispatchKeys() const { return keysToInclude_; }
+
   void saveLocalDispatchKeySet(c10::impl::LocalDispatchKeySet keyset) {
     TORCH_INTERNAL_ASSERT(!savedLocalDispatchKeySet_.has_value());
     savedLocalDispatchKeySet_ = std::move(keyset);
@@ -173,7 +193,9 @@ struct Interpreter {
 
  private:
   explicit Interpreter(TransformType type, int64_t level, InterpreterMeta meta):
-    type_(type), level_(level), is_alive_(std::make_shared<bool>(false)), meta_(meta) {}
+    type_(type), level_(level), is_alive_(std::make_shared<bool>(false)), meta_(meta),
+    keysToExclude_(keysToExcludeWhenEnteringDynamicLayer(type)),
+    keysToInclude_(keysToIncludeWhenEnteringDynamicLayer(type)) {}
 
   // fields
   TransformType type_;
@@ -181,6 +203,9 @@ struct Interpreter {
   optional<c10::impl::LocalDispatchKeySet> savedLocalDispatchKeySet_;
   std::shared_ptr<bool> is_alive_;
   InterpreterMeta meta_;
+  // See NOTE: [Interpreter dispatch plan]
+  DispatchKeySet keysToExclude_;
+  DispatchKeySet keysToInclude_;
 };
 
 // Applies the following for-loop:
@@ -199,8 +224,6 @@ void foreachTensorInplaceWithFlag(std::vector<IValue>& args, int64_t begin, int6
 
 std::vector<int64_t> findUnwrappedInputs(std::vector<IValue>& args, int64_t begin, int64_t end);
 
-DispatchKeySet keysToExcludeWhenEnteringDynamicLayer(TransformType key);
-
 void setup_dispatch_key_tls(DispatchKeySet exclude, DispatchKeySet include);
 
 void sanityCheckStack(const c10::OperatorHandle& op, torch::jit::Stack* stack);
@@ -6,8 +6,9 @@ namespace at { namespace functorch {
 void VmapInterpreterPtr::processImpl(
     const c10::OperatorHandle& op,
     torch::jit::Stack* stack) {
-  DispatchKeySet exclude = keysToExcludeWhenEnteringDynamicLayer(TransformType::Vmap);
-  setup_dispatch_key_tls(exclude, DispatchKeySet(DispatchKey::FuncTorchVmapMode));
+  // The keysets were precomputed when this interpreter's layer was pushed.
+  // See NOTE: [Interpreter dispatch plan]
+  setup_dispatch_key_tls(base_->excludeDispatchKeys(), base_->includeDispatchKeys());
   op.callBoxed(stack);
 }
 
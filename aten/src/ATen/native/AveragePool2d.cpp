@@ -1,6 +1,7 @@
 #define TORCH_ASSERT_ONLY_METHOD_OPERATORS
 #include <ATen/core/Tensor.h>
 #include <ATen/ScalarOps.h>
+#include <ATen/TensorMeta.h>
 #include <ATen/native/Pool.h>
 
 #ifndef AT_PER_OPERATOR_HEADERS
@@ -43,6 +44,26 @@ TORCH_PRECOMPUTE_META_FUNC(avg_pool2d)
   TORCH_CHECK(!divisor_override.has_value() || divisor_override.value() != 0,
     "divisor must be not zero");
 
+  // See Note: [frozen meta].  The precompute struct below is derived from the
+  // scalar arguments alone, so a replay only needs to skip shape inference
+  // and validation.
+  static thread_local at::impl::FrozenMetaCache frozen_meta;
+  at::impl::MetaFingerprint fingerprint;
+  if (at::impl::frozen_meta_enabled()) {
+    fingerprint.add(input);
+    fingerprint.add(maybe_get_output());
+    fingerprint.add(kernel_size);
+    fingerprint.add(stride);
+    fingerprint.add(padding);
+    fingerprint.add(static_cast<int64_t>(ceil_mode));
+    fingerprint.add(static_cast<int64_t>(count_include_pad));
+    fingerprint.add(divisor_override.value_or(0));
+    fingerprint.add(static_cast<int64_t>(divisor_override.has_value()));
+    if (frozen_meta.try_replay(*this, fingerprint)) {
+      return TORCH_PRECOMPUTE_STRUCT(avg_pool2d)().set_kH(kH).set_kW(kW).set_dH(dH).set_dW(dW).set_padH(padH).set_padW(padW);
+    }
+  }
+
   const int64_t nbatch = input.ndimension() == 4 ? input.size(-4) : 1;
   const int64_t nInputPlane = input.size(-3);
   const int64_t inputHeight = input.size(-2);
@@ -72,24 +93,20 @@ TORCH_PRECOMPUTE_META_FUNC(avg_pool2d)
       memory_format);
 
   /* resize output */
+  DimVector output_size;
+  TensorOptions output_options;
   if (input.ndimension() == 3) {
-    set_output_raw_strided(
-        0,
-        {nInputPlane,
-         outputHeight,
-         outputWidth},
-        {},
-        input.options());
+    output_size = {nInputPlane, outputHeight, outputWidth};
+    output_options = input.options();
   }
   else {
-    set_output_raw_strided(
-        0,
-        {nbatch,
-         nInputPlane,
-         outputHeight,
-         outputWidth},
-        {},
-        input.options().memory_format(memory_format));
+    output_size = {nbatch, nInputPlane, outputHeight, outputWidth};
+    output_options = input.options().memory_format(memory_format);
+  }
+  set_output_raw_strided(0, output_size, {}, output_options);
+
+  if (at::impl::frozen_meta_enabled()) {
+    frozen_meta.record(std::move(fingerprint), output_size, output_options);
   }
 
   return TORCH_PRECOMPUTE_STRUCT(avg_pool2d)().set_kH(kH).set_kW(kW).set_dH(dH).set_dW(dW).set_padH(padH).set_padW(padW);
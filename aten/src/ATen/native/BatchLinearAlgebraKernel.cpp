@@ -9,6 +9,8 @@
 
 #include <c10/util/irange.h>
 
+#include <cmath>
+
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
@@ -20,6 +22,201 @@
 namespace at { namespace native {
 
 namespace {
+
+/*
+  Fixed-size kernels for batches of tiny matrices.
+
+  For inputs like 100k 6x6 matrices, one LAPACK call per matrix is dominated
+  by per-call overhead (argument checking, dispatch, workspace logic) rather
+  than by the factorization itself. For n <= kMaxSmallLinalgDim the
+  factorizations below are computed directly with compile-time loop bounds,
+  so the compiler can fully unroll and vectorize them, and the batch
+  dimension is spread over threads with at::parallel_for.
+
+  Only real types take this path; complex inputs and single matrices keep
+  using LAPACK. Results match LAPACK's storage conventions (POTRF triangles,
+  GETRF unit-lower/upper factors with 1-based pivots), so downstream
+  routines like lu_solve work unchanged.
+*/
+constexpr int64_t kMaxSmallLinalgDim = 8;
+
+// Lower-triangular Cholesky of the column-major n-by-n matrix `a`. For the
+// upper triangle the indexing is transposed, which runs the same algorithm
+// on A^T and writes out exactly the transposed (upper) factor.
+template <typename scalar_t, int n, bool upper>
+void cholesky_small(scalar_t* a, int64_t lda, int* info) {
+  *info = 0;
+  auto A = [&](int r, int c) -> scalar_t& {
+    return upper ? a[c + r * lda] : a[r + c * lda];
+  };
+  for (int j = 0; j < n; j++) {
+    scalar_t d = A(j, j);
+    for (int k = 0; k < j; k++) {
+      d -= A(j, k) * A(j, k);
+    }
+    // Also catches NaN, matching POTRF's info > 0 for non-positive-definite
+    if (!(d > scalar_t(0))) {
+      *info = j + 1;
+      return;
+    }
+    const scalar_t l_jj = std::sqrt(d);
+    const scalar_t inv_l_jj = scalar_t(1) / l_jj;
+    A(j, j) = l_jj;
+    for (int i = j + 1; i < n; i++) {
+      scalar_t s = A(i, j);
+      for (int k = 0; k < j; k++) {
+        s -= A(i, k) * A(j, k);
+      }
+      A(i, j) = s * inv_l_jj;
+    }
+  }
+}
+
+template <typename scalar_t, bool upper>
+void cholesky_small_dispatch(scalar_t* a, int64_t n, int64_t lda, int* info) {
+  switch (n) {
+    case 1: return cholesky_small<scalar_t, 1, upper>(a, lda, info);
+    case 2: return cholesky_small<scalar_t, 2, upper>(a, lda, info);
+    case 3: return cholesky_small<scalar_t, 3, upper>(a, lda, info);
+    case 4: return cholesky_small<scalar_t, 4, upper>(a, lda, info);
+    case 5: return cholesky_small<scalar_t, 5, upper>(a, lda, info);
+    case 6: return cholesky_small<scalar_t, 6, upper>(a, lda, info);
+    case 7: return cholesky_small<scalar_t, 7, upper>(a, lda, info);
+    case 8: return cholesky_small<scalar_t, 8, upper>(a, lda, info);
+  }
+  TORCH_INTERNAL_ASSERT(false, "cholesky_small_dispatch: unexpected size ", n);
+}
+
+// Returns true if the whole batch was handled by the small-matrix path.
+template <typename scalar_t>
+typename std::enable_if<std::is_floating_point<scalar_t>::value, bool>::type
+cholesky_batched_small(const Tensor& input, const Tensor& info, bool upper) {
+  const auto n = input.size(-2);
+  const auto batch_size = batchCount(input);
+  if (n < 1 || n > kMaxSmallLinalgDim || batch_size <= 1) {
+    return false;
+  }
+  auto* input_data = input.data_ptr<scalar_t>();
+  auto* info_data = info.data_ptr<int>();
+  const auto input_matrix_stride = matrixStride(input);
+  const auto lda = std::max<int64_t>(1, n);
+  const auto grain_size =
+      std::max<int64_t>(1, internal::GRAIN_SIZE / (n * n * n));
+  at::parallel_for(0, batch_size, grain_size, [&](int64_t start, int64_t end) {
+    for (const auto i : c10::irange(start, end)) {
+      scalar_t* a = &input_data[i * input_matrix_stride];
+      if (upper) {
+        cholesky_small_dispatch<scalar_t, true>(a, n, lda, &info_data[i]);
+      } else {
+        cholesky_small_dispatch<scalar_t, false>(a, n, lda, &info_data[i]);
+      }
+    }
+  });
+  return true;
+}
+
+template <typename scalar_t>
+typename std::enable_if<!std::is_floating_point<scalar_t>::value, bool>::type
+cholesky_batched_small(const Tensor& /*input*/, const Tensor& /*info*/, bool /*upper*/) {
+  return false;
+}
+
+// LU factorization with partial pivoting of the column-major n-by-n matrix
+// `a`, following GETF2: unit-lower and upper factors stored in place,
+// 1-based pivots, info records the first zero pivot but the factorization
+// continues (the column below a zero pivot is necessarily all zero).
+template <typename scalar_t, int n>
+void lu_small(scalar_t* a, int64_t lda, int* pivots, int* info) {
+  *info = 0;
+  for (int k = 0; k < n; k++) {
+    int p = k;
+    scalar_t max_abs = std::abs(a[k + k * lda]);
+    for (int i = k + 1; i < n; i++) {
+      const scalar_t v = std::abs(a[i + k * lda]);
+      if (v > max_abs) {
+        max_abs = v;
+        p = i;
+      }
+    }
+    pivots[k] = p + 1;
+    if (a[p + k * lda] == scalar_t(0)) {
+      if (*info == 0) {
+        *info = k + 1;
+      }
+      continue;
+    }
+    if (p != k) {
+      for (int j = 0; j < n; j++) {
+        std::swap(a[k + j * lda], a[p + j * lda]);
+      }
+    }
+    const scalar_t inv_pivot = scalar_t(1) / a[k + k * lda];
+    for (int i = k + 1; i < n; i++) {
+      a[i + k * lda] *= inv_pivot;
+    }
+    for (int j = k + 1; j < n; j++) {
+      const scalar_t a_kj = a[k + j * lda];
+      if (a_kj != scalar_t(0)) {
+        for (int i = k + 1; i < n; i++) {
+          a[i + j * lda] -= a[i + k * lda] * a_kj;
+        }
+      }
+    }
+  }
+}
+
+template <typename scalar_t>
+void lu_small_dispatch(scalar_t* a, int64_t n, int64_t lda, int* pivots, int* info) {
+  switch (n) {
+    case 1: return lu_small<scalar_t, 1>(a, lda, pivots, info);
+    case 2: return lu_small<scalar_t, 2>(a, lda, pivots, info);
+    case 3: return lu_small<scalar_t, 3>(a, lda, pivots, info);
+    case 4: return lu_small<scalar_t, 4>(a, lda, pivots, info);
+    case 5: return lu_small<scalar_t, 5>(a, lda, pivots, info);
+    case 6: return lu_small<scalar_t, 6>(a, lda, pivots, info);
+    case 7: return lu_small<scalar_t, 7>(a, lda, pivots, info);
+    case 8: return lu_small<scalar_t, 8>(a, lda, pivots, info);
+  }
+  TORCH_INTERNAL_ASSERT(false, "lu_small_dispatch: unexpected size ", n);
+}
+
+// Returns true if the whole batch was handled by the small-matrix path.
+template <typename scalar_t>
+typename std::enable_if<std::is_floating_point<scalar_t>::value, bool>::type
+lu_factor_batched_small(const Tensor& input, const Tensor& pivots, const Tensor& infos) {
+  const auto m = input.size(-2);
+  const auto n = input.size(-1);
+  const auto batch_size = batchCount(input);
+  if (m != n || n < 1 || n > kMaxSmallLinalgDim || batch_size <= 1) {
+    return false;
+  }
+  auto* input_data = input.data_ptr<scalar_t>();
+  auto* pivots_data = pivots.data_ptr<int>();
+  auto* infos_data = infos.data_ptr<int>();
+  const auto input_matrix_stride = matrixStride(input);
+  const auto pivots_stride = pivots.size(-1);
+  const auto lda = std::max<int64_t>(1, n);
+  const auto grain_size =
+      std::max<int64_t>(1, internal::GRAIN_SIZE / (n * n * n));
+  at::parallel_for(0, batch_size, grain_size, [&](int64_t start, int64_t end) {
+    for (const auto i : c10::irange(start, end)) {
+      lu_small_dispatch<scalar_t>(
+          &input_data[i * input_matrix_stride],
+          n,
+          lda,
+          &pivots_data[i * pivots_stride],
+          &infos_data[i]);
+    }
+  });
+  return true;
+}
+
+template <typename scalar_t>
+typename std::enable_if<!std::is_floating_point<scalar_t>::value, bool>::type
+lu_factor_batched_small(const Tensor& /*input*/, const Tensor& /*pivots*/, const Tensor& /*infos*/) {
+  return false;
+}
+
 /*
   Computes the Cholesky decomposition of matrices stored in `input`.
   This is an in-place routine and the content of 'input' is overwritten with the result.
@@ -41,6 +238,10 @@ void apply_cholesky(const Tensor& input, const Tensor& info, bool upper) {
       "Calling torch.linalg.cholesky on a CPU tensor requires compiling ",
       "PyTorch with LAPACK. Please use PyTorch built with LAPACK support.");
 #else
+  if (cholesky_batched_small<scalar_t>(input, info, upper)) {
+    return;
+  }
+
   char uplo = upper ? 'U' : 'L';
   auto input_data = input.data_ptr<scalar_t>();
   auto info_data = info.data_ptr<int>();
@@ -905,6 +1106,10 @@ void apply_lu_factor(const Tensor& input, const Tensor& pivots, const Tensor& in
 #else
   TORCH_CHECK(compute_pivots, "linalg.lu_factor: LU without pivoting is not implemented on the CPU");
 
+  if (lu_factor_batched_small<scalar_t>(input, pivots, infos)) {
+    return;
+  }
+
   auto input_data = input.data_ptr<scalar_t>();
   auto pivots_data = pivots.data_ptr<int>();
   auto infos_data = infos.data_ptr<int>();
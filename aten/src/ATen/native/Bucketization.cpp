@@ -5,6 +5,7 @@
 #include <ATen/native/BucketizationUtils.h>
 #include <ATen/native/Resize.h>
 #include <c10/util/irange.h>
+#include <c10/util/llvmMathExtras.h>
 
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
@@ -83,6 +84,68 @@ int64_t cus_upper_bound(int64_t start, int64_t end, const input_t val, const inp
   return start;
 }
 
+// Boundaries repacked into Eytzinger (BFS) order, built once per kernel call
+// and shared by every search. The hot path of a search then walks one cache
+// line per tree level instead of striding across the sorted array, and the
+// walk itself is branchless: every level computes k = 2k + go_right. The
+// go_right predicates mirror cus_lower_bound/cus_upper_bound above (including
+// their nan handling), so results are bit-identical to the binary search.
+template<typename input_t>
+struct EytzingerBoundaries {
+  EytzingerBoundaries(const input_t* bd, int64_t n)
+      : vals_(n + 1), ranks_(n + 1), n_(n),
+        depth_(llvm::Log2_64(static_cast<uint64_t>(n)) + 1) {
+    build(bd, 0, 1);
+  }
+
+  // Searches `count` values at once, advancing all walks in lockstep one tree
+  // level per iteration. The loads from different walks are independent, so
+  // the per-level cache misses overlap instead of serializing, which is where
+  // the batched speedup comes from.
+  template<bool right, int64_t batch>
+  void search_batch(const input_t* vals, int64_t count, int64_t* pos) const {
+    int64_t ks[batch];
+    for (const auto b : c10::irange(count)) {
+      ks[b] = 1;
+    }
+    for (C10_UNUSED const auto level : c10::irange(depth_)) {
+      for (const auto b : c10::irange(count)) {
+        const int64_t k = ks[b];
+        if (k <= n_) {
+          const bool go_right =
+              right ? !(vals_[k] > vals[b]) : !(vals_[k] >= vals[b]);
+          ks[b] = 2 * k + go_right;
+        }
+      }
+    }
+    for (const auto b : c10::irange(count)) {
+      // Undo the right turns taken since the last left turn; what remains is
+      // the node holding the bound, or 0 if every comparison went right.
+      const int64_t k = ks[b] >> (llvm::countTrailingOnes(
+          static_cast<uint64_t>(ks[b])) + 1);
+      pos[b] = k == 0 ? n_ : ranks_[k];
+    }
+  }
+
+ private:
+  // Fills vals_ in BFS order from the sorted array; ranks_ remembers each
+  // node's position in sorted order, which is what searchsorted returns.
+  int64_t build(const input_t* bd, int64_t i, int64_t k) {
+    if (k <= n_) {
+      i = build(bd, i, 2 * k);
+      vals_[k] = bd[i];
+      ranks_[k] = i++;
+      i = build(bd, i, 2 * k + 1);
+    }
+    return i;
+  }
+
+  std::vector<input_t> vals_; // 1-based
+  std::vector<int64_t> ranks_;
+  int64_t n_;
+  int64_t depth_;
+};
+
 template<typename input_t, typename output_t>
 void searchsorted_cpu_contiguous(Tensor& result, const Tensor& input, const Tensor& boundaries, const bool& right, const Tensor& sorter) {
   int64_t numel_in = input.numel();
@@ -97,6 +160,35 @@ void searchsorted_cpu_contiguous(Tensor& result, const Tensor& input, const Tens
   output_t *data_out = result.data_ptr<output_t>();
 
   bool is_1d_boundaries = boundaries.dim() == 1;
+
+  // Every value searches the same boundary array when boundaries is 1d and
+  // there is no sorter; repack it once into Eytzinger order and run batched
+  // branchless searches. Only worth it when there are enough searches to
+  // amortize the O(idim_bd) repack and the array is big enough for the
+  // layout to matter.
+  if (is_1d_boundaries && !data_st && idim_bd >= 16 && numel_in >= idim_bd) {
+    const EytzingerBoundaries<input_t> eytzinger_bd(data_bd, idim_bd);
+    at::parallel_for(0, numel_in, SEARCHSORTED_GRAIN_SIZE, [&](int64_t start, int64_t end) {
+      constexpr int64_t kBatch = 8;
+      std::array<int64_t, kBatch> pos;
+      for (int64_t i = start; i < end; i += kBatch) {
+        const int64_t count = std::min(kBatch, end - i);
+        if (right) {
+          eytzinger_bd.template search_batch<true, kBatch>(
+              data_in + i, count, pos.data());
+        } else {
+          eytzinger_bd.template search_batch<false, kBatch>(
+              data_in + i, count, pos.data());
+        }
+        for (const auto b : c10::irange(count)) {
+          // type conversion might happen here
+          data_out[i + b] = pos[b];
+        }
+      }
+    });
+    return;
+  }
+
   at::parallel_for(0, numel_in, SEARCHSORTED_GRAIN_SIZE, [&](int64_t start, int64_t end) {
     for (const auto i : c10::irange(start, end)) {
       // If boundaries tensor is 1d, we always search the entire boundary tensor
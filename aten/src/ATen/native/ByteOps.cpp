@@ -0,0 +1,96 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/native/ByteOps.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_find_byte_native.h>
+#include <ATen/ops/_split_on_byte_native.h>
+#include <ATen/ops/empty.h>
+#endif
+
+#include <c10/util/irange.h>
+
+#include <cstring>
+
+// Byte-tensor string primitives for tokenizer-style preprocessing.
+//
+// Scripted preprocessing that scans uint8 tensors through chains of
+// aten::eq / aten::nonzero / aten::slice pays full tensor-op overhead per
+// step and materializes a bool mask the size of the input. These ops do the
+// two common scans -- find the next occurrence of a byte, and split a buffer
+// on a separator byte -- in a single pass over the raw bytes.
+
+namespace at {
+namespace native {
+
+DEFINE_DISPATCH(collect_byte_positions_stub);
+
+namespace {
+
+const uint8_t* byte_data(const Tensor& self, const char* name) {
+  TORCH_CHECK(
+      self.scalar_type() == kByte, name, ": expected a uint8 tensor, got ", self.scalar_type());
+  TORCH_CHECK(self.dim() == 1, name, ": expected a 1D tensor, got ", self.dim(), "D");
+  TORCH_CHECK(self.is_contiguous(), name, ": expected a contiguous tensor");
+  return self.data_ptr<uint8_t>();
+}
+
+uint8_t check_byte_value(int64_t value, const char* name) {
+  TORCH_CHECK(
+      value >= 0 && value <= 255, name, ": value must be a byte (0..255), got ", value);
+  return static_cast<uint8_t>(value);
+}
+
+} // namespace
+
+int64_t find_byte_cpu(const Tensor& self, int64_t value, int64_t start) {
+  const uint8_t* data = byte_data(self, "_find_byte");
+  const uint8_t needle = check_byte_value(value, "_find_byte");
+  const int64_t n = self.numel();
+  TORCH_CHECK(
+      start >= 0 && start <= n,
+      "_find_byte: start must be in [0, ", n, "], got ", start);
+  if (start == n) {
+    return -1;
+  }
+  // memchr is vectorized by every libc we target, so the first-hit scan
+  // needs no dispatch stub of its own.
+  const void* hit = std::memchr(data + start, needle, n - start);
+  if (hit == nullptr) {
+    return -1;
+  }
+  return static_cast<const uint8_t*>(hit) - data;
+}
+
+std::tuple<Tensor, Tensor> split_on_byte_cpu(const Tensor& self, int64_t value) {
+  const uint8_t* data = byte_data(self, "_split_on_byte");
+  const uint8_t separator = check_byte_value(value, "_split_on_byte");
+  const int64_t n = self.numel();
+
+  std::vector<int64_t> positions;
+  collect_byte_positions_stub(kCPU, data, n, separator, positions);
+
+  // Splitting on every separator yields one segment more than there are
+  // separators; empty segments (adjacent separators) are kept, matching
+  // bytes.split semantics, and can be filtered by the caller.
+  const int64_t num_segments = static_cast<int64_t>(positions.size()) + 1;
+  Tensor starts = at::empty({num_segments}, self.options().dtype(kLong));
+  Tensor lengths = at::empty({num_segments}, self.options().dtype(kLong));
+  int64_t* starts_data = starts.data_ptr<int64_t>();
+  int64_t* lengths_data = lengths.data_ptr<int64_t>();
+  int64_t segment_start = 0;
+  for (const auto i : c10::irange(positions.size())) {
+    starts_data[i] = segment_start;
+    lengths_data[i] = positions[i] - segment_start;
+    segment_start = positions[i] + 1;
+  }
+  starts_data[num_segments - 1] = segment_start;
+  lengths_data[num_segments - 1] = n - segment_start;
+  return std::make_tuple(std::move(starts), std::move(lengths));
+}
+
+} // namespace native
+} // namespace at
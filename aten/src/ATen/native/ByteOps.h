@@ -0,0 +1,17 @@
+#pragma once
+
+#include <ATen/native/DispatchStub.h>
+#include <cstdint>
+#include <vector>
+
+namespace at {
+namespace native {
+
+// Appends the index of every occurrence of `value` in `data[0..n)` to
+// `positions`.
+using collect_byte_positions_fn =
+    void (*)(const uint8_t* data, int64_t n, uint8_t value, std::vector<int64_t>& positions);
+DECLARE_DISPATCH(collect_byte_positions_fn, collect_byte_positions_stub);
+
+} // namespace native
+} // namespace at
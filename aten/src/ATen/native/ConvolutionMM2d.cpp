@@ -21,6 +21,10 @@
 #include <ATen/ops/thnn_conv2d_native.h>
 #endif
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 namespace at {
 namespace native {
 
@@ -219,6 +223,188 @@ static inline Tensor view_weight_2d(const Tensor& weight_,
   }
 }
 
+// Note [conv2d tiled implicit gemm]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// compute_columns2d materializes the im2col buffer for the whole batch,
+// {batch, C*kh*kw, oh*ow}, even though each element is consumed by exactly
+// one GEMM. For large feature maps this buffer peaks at many GiB. When it
+// would exceed kMaxColumnsBytes, the forward pass instead walks each frame
+// in blocks of output rows: a small per-thread tile of patches is gathered
+// from strided views of the input and fed straight to GEMM, so the working
+// set stays at one tile per thread regardless of batch size. The tiles use
+// compute_columns2d's layout, so the GEMM calls below mirror
+// slow_conv2d_update_output_frame exactly and produce identical results.
+constexpr int64_t kMaxColumnsBytes = int64_t(1) << 28; // 256 MiB
+constexpr int64_t kColumnsTileBytes = int64_t(1) << 19; // 512 KiB per thread
+
+// Gathers patches for output rows [oh0, oh1) of one contiguous-layout frame
+// into a {C*kh*kw, (oh1-oh0)*ow} row-major tile.
+template <typename scalar_t>
+static void gather_patch_tile(
+    scalar_t* columns,
+    const scalar_t* input,
+    int64_t oh0,
+    int64_t oh1,
+    int64_t kernel_height,
+    int64_t kernel_width,
+    int64_t stride_height,
+    int64_t stride_width,
+    int64_t pad_height,
+    int64_t pad_width,
+    int64_t n_input_plane,
+    int64_t input_height,
+    int64_t input_width,
+    int64_t output_width) {
+  const int64_t tile_len = (oh1 - oh0) * output_width;
+  int64_t r = 0;
+  for (const auto c : c10::irange(n_input_plane)) {
+    for (const auto kh : c10::irange(kernel_height)) {
+      for (const auto kw : c10::irange(kernel_width)) {
+        scalar_t* dst_row = columns + r * tile_len;
+        r++;
+        for (const auto oh : c10::irange(oh0, oh1)) {
+          scalar_t* dst = dst_row + (oh - oh0) * output_width;
+          const int64_t ih = oh * stride_height - pad_height + kh;
+          if (ih < 0 || ih >= input_height) {
+            std::fill(dst, dst + output_width, scalar_t(0));
+            continue;
+          }
+          const scalar_t* src = input + (c * input_height + ih) * input_width;
+          if (stride_width == 1) {
+            const int64_t iw0 = kw - pad_width;
+            int64_t begin = std::min(std::max<int64_t>(0, -iw0), output_width);
+            int64_t end = std::max(std::min(output_width, input_width - iw0), begin);
+            std::fill(dst, dst + begin, scalar_t(0));
+            if (end > begin) {
+              std::memcpy(dst + begin, src + iw0 + begin,
+                          (end - begin) * sizeof(scalar_t));
+            }
+            std::fill(dst + end, dst + output_width, scalar_t(0));
+          } else {
+            for (const auto ow : c10::irange(output_width)) {
+              const int64_t iw = ow * stride_width - pad_width + kw;
+              dst[ow] = (iw >= 0 && iw < input_width) ? src[iw] : scalar_t(0);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+// Same for one channels-last frame: a {(oh1-oh0)*ow, kh*kw*C} row-major tile
+// where each row is one [kh][kw][C] patch.
+template <typename scalar_t>
+static void gather_patch_tile_channels_last(
+    scalar_t* columns,
+    const scalar_t* input,
+    int64_t oh0,
+    int64_t oh1,
+    int64_t kernel_height,
+    int64_t kernel_width,
+    int64_t stride_height,
+    int64_t stride_width,
+    int64_t pad_height,
+    int64_t pad_width,
+    int64_t n_input_plane,
+    int64_t input_height,
+    int64_t input_width,
+    int64_t output_width) {
+  const int64_t row_len = kernel_width * n_input_plane;
+  scalar_t* dst = columns;
+  for (const auto oh : c10::irange(oh0, oh1)) {
+    for (const auto ow : c10::irange(output_width)) {
+      const int64_t iw0 = ow * stride_width - pad_width;
+      for (const auto kh : c10::irange(kernel_height)) {
+        scalar_t* dst_k = dst + kh * row_len;
+        const int64_t ih = oh * stride_height - pad_height + kh;
+        if (ih < 0 || ih >= input_height) {
+          std::fill(dst_k, dst_k + row_len, scalar_t(0));
+          continue;
+        }
+        const scalar_t* src = input + (ih * input_width + iw0) * n_input_plane;
+        if (iw0 >= 0 && iw0 + kernel_width <= input_width) {
+          std::memcpy(dst_k, src, row_len * sizeof(scalar_t));
+        } else {
+          for (const auto kw : c10::irange(kernel_width)) {
+            const int64_t iw = iw0 + kw;
+            scalar_t* d = dst_k + kw * n_input_plane;
+            if (iw >= 0 && iw < input_width) {
+              std::memcpy(d, src + kw * n_input_plane,
+                          n_input_plane * sizeof(scalar_t));
+            } else {
+              std::fill(d, d + n_input_plane, scalar_t(0));
+            }
+          }
+        }
+      }
+      dst += kernel_height * row_len;
+    }
+  }
+}
+
+template <typename scalar_t>
+static void slow_conv2d_tiled_output_tile(
+    const scalar_t* input,
+    scalar_t* output,
+    const scalar_t* weight,
+    bool has_bias,
+    scalar_t* columns,
+    int64_t oh0,
+    int64_t oh1,
+    int64_t kernel_height,
+    int64_t kernel_width,
+    int64_t stride_height,
+    int64_t stride_width,
+    int64_t pad_height,
+    int64_t pad_width,
+    int64_t n_input_plane,
+    int64_t input_height,
+    int64_t input_width,
+    int64_t n_output_plane,
+    int64_t output_height,
+    int64_t output_width,
+    bool is_channels_last) {
+  const int64_t tile_len = (oh1 - oh0) * output_width;
+  const int64_t patch_size = n_input_plane * kernel_height * kernel_width;
+  const scalar_t beta = has_bias ? 1 : 0;
+
+  // See the gemm calls in slow_conv2d_update_output_frame for the layout
+  // conventions; the tiles here are the same matrices restricted to output
+  // columns [oh0*ow, oh1*ow).
+  if (is_channels_last) {
+    gather_patch_tile_channels_last(
+        columns, input, oh0, oh1,
+        kernel_height, kernel_width, stride_height, stride_width,
+        pad_height, pad_width, n_input_plane, input_height, input_width,
+        output_width);
+    at::native::cpublas::gemm(
+        TransposeType::Transpose,
+        TransposeType::NoTranspose,
+        n_output_plane, tile_len, patch_size,
+        static_cast<scalar_t>(1),
+        weight, patch_size,
+        columns, patch_size,
+        beta,
+        output + oh0 * output_width * n_output_plane, n_output_plane);
+  } else {
+    gather_patch_tile(
+        columns, input, oh0, oh1,
+        kernel_height, kernel_width, stride_height, stride_width,
+        pad_height, pad_width, n_input_plane, input_height, input_width,
+        output_width);
+    at::native::cpublas::gemm(
+        TransposeType::NoTranspose,
+        TransposeType::NoTranspose,
+        tile_len, n_output_plane, patch_size,
+        static_cast<scalar_t>(1),
+        columns, tile_len,
+        weight, patch_size,
+        beta,
+        output + oh0 * output_width, output_height * output_width);
+  }
+}
+
 template <typename scalar_t>
 static void slow_conv2d_update_output_frame(
     TensorAccessor<scalar_t, 3> input,
@@ -581,13 +767,70 @@ Tensor& slow_conv2d_forward_out_cpu(
   const int64_t output_height = (input_height + 2 * pad_height - kernel_height) / stride_height + 1;
   const int64_t output_width = (input_width + 2 * pad_width - kernel_width) / stride_width + 1;
 
-  Tensor finput = compute_columns2d(input, padding, stride, kernel_size, use_channels_last);
   output.resize_({batch_size, n_output_plane, output_height, output_width}, memory_format);
   if (bias.defined()) {
     output.copy_(bias.reshape({-1, 1, 1}));
   }
   TORCH_CHECK(output.is_contiguous(memory_format), "slow_conv2d output tensor must be contiguous");
 
+  // See Note [conv2d tiled implicit gemm]. The 1x1 unit-stride case is
+  // excluded because compute_columns2d handles it with a free view.
+  const int64_t patch_size = n_input_plane * kernel_height * kernel_width;
+  const bool is_1x1 = kernel_height == 1 && kernel_width == 1 &&
+      stride_height == 1 && stride_width == 1 &&
+      pad_height == 0 && pad_width == 0;
+  const int64_t columns_bytes = batch_size * patch_size *
+      output_height * output_width * input.element_size();
+  if (!is_1x1 && columns_bytes > kMaxColumnsBytes) {
+    AT_DISPATCH_ALL_TYPES_AND(kBFloat16, input.scalar_type(), "slow_conv2d_cpu", [&]{
+      const scalar_t* input_data = input.data_ptr<scalar_t>();
+      scalar_t* output_data = output.data_ptr<scalar_t>();
+      const Tensor weight_contig = weight_2d.contiguous();
+      const scalar_t* weight_data = weight_contig.data_ptr<scalar_t>();
+      const int64_t input_frame_stride = n_input_plane * input_height * input_width;
+      const int64_t output_frame_stride = n_output_plane * output_height * output_width;
+
+      const int64_t row_bytes = patch_size * output_width *
+          static_cast<int64_t>(sizeof(scalar_t));
+      const int64_t rows_per_tile = std::min(output_height,
+          std::max<int64_t>(1, kColumnsTileBytes / std::max<int64_t>(1, row_bytes)));
+      const int64_t num_tiles = (output_height + rows_per_tile - 1) / rows_per_tile;
+
+      at::parallel_for(0, batch_size * num_tiles, 1, [&](int64_t start, int64_t end) {
+        std::vector<scalar_t> columns(rows_per_tile * output_width * patch_size);
+        for (const auto i : c10::irange(start, end)) {
+          const int64_t t = i / num_tiles;
+          const int64_t oh0 = (i % num_tiles) * rows_per_tile;
+          const int64_t oh1 = std::min(output_height, oh0 + rows_per_tile);
+          slow_conv2d_tiled_output_tile(
+              input_data + t * input_frame_stride,
+              output_data + t * output_frame_stride,
+              weight_data,
+              bias.defined(),
+              columns.data(),
+              oh0,
+              oh1,
+              kernel_height,
+              kernel_width,
+              stride_height,
+              stride_width,
+              pad_height,
+              pad_width,
+              n_input_plane,
+              input_height,
+              input_width,
+              n_output_plane,
+              output_height,
+              output_width,
+              use_channels_last);
+        }
+      });
+    });
+    return output;
+  }
+
+  Tensor finput = compute_columns2d(input, padding, stride, kernel_size, use_channels_last);
+
   AT_DISPATCH_ALL_TYPES_AND(kBFloat16, input.scalar_type(), "slow_conv2d_cpu", [&]{
     auto input_a = input.accessor<scalar_t, 4>();
     auto output_a = output.accessor<scalar_t, 4>();
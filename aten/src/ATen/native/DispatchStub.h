@@ -1,8 +1,11 @@
 #pragma once
 
 #include <c10/core/DeviceType.h>
+#include <c10/core/ScalarType.h>
 #include <c10/macros/Export.h>
+#include <c10/macros/Macros.h>
 
+#include <array>
 #include <atomic>
 #include <utility>
 
@@ -187,6 +190,68 @@ private:
   DispatchStubImpl impl;
 };
 
+// Note [Specialized dispatch entries]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The per-ISA pointer a DispatchStub selects still lands in a kernel that
+// usually re-dispatches on every call: an AT_DISPATCH switch over the dtype
+// followed by TensorIterator's per-call loop machinery. For sub-microsecond
+// ops that secondary dispatch is a measurable fraction of the call. A
+// SpecializedDispatchTable lets a kernel additionally register direct entry
+// points for hot (dtype, contiguous) combinations; the operator probes the
+// table first and falls back to the generic stub when no entry matches.
+//
+// In native/MyKernel.h:
+//   DECLARE_SPECIALIZED_DISPATCH_TABLE(fn_type, my_op_specialized);
+//
+// In native/MyKernel.cpp:
+//   DEFINE_SPECIALIZED_DISPATCH_TABLE(my_op_specialized);
+//   ...
+//   if (auto fn = my_op_specialized.get(iter.dtype(), iter.is_contiguous())) {
+//     fn(iter, ...);
+//     return;
+//   }
+//   my_op_stub(iter.device_type(), iter, ...);
+//
+// In native/cpu/MyKernel.cpp:
+//   REGISTER_SPECIALIZED_DISPATCH(
+//       my_op_specialized, ScalarType::Float, /*contiguous=*/true, &kernel);
+template <typename FnPtr_>
+struct SpecializedDispatchTable {
+  using FnPtr = FnPtr_;
+
+  void register_entry(
+      CPUCapability cap,
+      c10::ScalarType dtype,
+      bool contiguous,
+      FnPtr fn) {
+    table_[static_cast<size_t>(cap)][index(dtype, contiguous)] = fn;
+  }
+
+  // Returns the direct entry registered for the highest capability this CPU
+  // supports, or nullptr when the caller should use the generic stub.
+  FnPtr get(c10::ScalarType dtype, bool contiguous) const {
+    const size_t i = index(dtype, contiguous);
+    for (int cap = static_cast<int>(get_cpu_capability()); cap >= 0; --cap) {
+      if (FnPtr fn = table_[cap][i]) {
+        return fn;
+      }
+    }
+    return nullptr;
+  }
+
+ private:
+  static size_t index(c10::ScalarType dtype, bool contiguous) {
+    return 2 * static_cast<size_t>(dtype) + (contiguous ? 1 : 0);
+  }
+
+  static constexpr size_t kNumSlots =
+      2 * static_cast<size_t>(c10::ScalarType::NumOptions);
+  std::array<
+      std::array<FnPtr, kNumSlots>,
+      static_cast<size_t>(CPUCapability::NUM_OPTIONS)>
+      table_{};
+};
+
 namespace {
 template <typename DispatchStub>
 struct RegisterCUDADispatch {
@@ -210,6 +275,18 @@ struct RegisterHIPDispatch {
   }
 };
 
+template <typename Table>
+struct RegisterSpecializedDispatch {
+  RegisterSpecializedDispatch(
+      Table& table,
+      CPUCapability cap,
+      c10::ScalarType dtype,
+      bool contiguous,
+      typename Table::FnPtr fn) {
+    table.register_entry(cap, dtype, contiguous, fn);
+  }
+};
+
 } // anonymous namespace
 // Compiler will complain if you put things like std::tuple<Tensor, Tensor> in
 // the `fn` argument of DECLARE_DISPATCH. Some possible workarounds, e.g.,
@@ -226,6 +303,16 @@ struct RegisterHIPDispatch {
 
 #define DEFINE_DISPATCH(name) struct name name
 
+#define DECLARE_SPECIALIZED_DISPATCH_TABLE(fn, name) \
+  struct name : SpecializedDispatchTable<fn> {       \
+    name() = default;                                \
+    name(const name&) = delete;                      \
+    name& operator=(const name&) = delete;           \
+  };                                                 \
+  extern TORCH_API struct name name
+
+#define DEFINE_SPECIALIZED_DISPATCH_TABLE(name) struct name name
+
 #define REGISTER_ARCH_DISPATCH(name, arch, fn) \
   template <> name::FnPtr TORCH_API DispatchStub<name::FnPtr, struct name>::arch = fn;
 
@@ -290,6 +377,13 @@ struct RegisterHIPDispatch {
 #define REGISTER_DISPATCH(name, fn) REGISTER_ARCH_DISPATCH(name, CPU_CAPABILITY, fn)
 #define REGISTER_NO_AVX512_DISPATCH(name)       \
   REGISTER_AVX512_DISPATCH(name, nullptr)
+// See Note [Specialized dispatch entries]. Like REGISTER_DISPATCH, this
+// registers the entry for the instruction set the file is being compiled
+// for; SpecializedDispatchTable::get picks the best one at runtime.
+#define REGISTER_SPECIALIZED_DISPATCH(name, dtype, contiguous, fn)         \
+  static RegisterSpecializedDispatch<struct name> C10_ANONYMOUS_VARIABLE( \
+      name##_specialized_register)(                                        \
+      name, CPUCapability::CPU_CAPABILITY, dtype, contiguous, fn);
 #endif
 
 
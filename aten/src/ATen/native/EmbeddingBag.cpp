@@ -9,6 +9,7 @@
 #include <ATen/native/CPUBlas.h>
 #include <ATen/native/NonSymbolicBC.h>
 
+#include <c10/util/env.h>
 #include <c10/util/irange.h>
 #include <c10/util/Half.h>
 
@@ -20,6 +21,7 @@
 #endif
 
 #include <algorithm>
+#include <cstdlib>
 #include <cstring>
 #include <tuple>
 #include <utility>
@@ -82,6 +84,38 @@ std::pair<Tensor, Tensor> promoteIndicesAndOffsets(
                                           : offsets.toType(commonType)};
 }
 
+// [Note: coalesced embedding lookup]
+// Repeated indices are very common in recommendation traffic: the hottest
+// ids can appear thousands of times per batch, and accumulating them in
+// arrival order re-reads the same embedding rows from DRAM over and over on
+// out-of-cache tables.  When AT_EMBEDDING_BAG_COALESCE is set, the float sum
+// fast path sorts each bag's indices, folds duplicates into a single lookup
+// with the multiplicity as its weight, and feeds the result to the weighted
+// caffe2/fbgemm kernel, so every distinct row is fetched once per bag.
+// Sorting costs O(bag * log bag) index-only work, so this pays off when bags
+// are long and the table does not fit in cache; it is therefore opt-in.
+// AT_EMBEDDING_BAG_PREFETCH overrides the fbgemm prefetch distance (default
+// 16 rows) for tuning on machines with different memory latencies.
+static bool embedding_bag_coalesce_enabled() {
+  static const bool enabled =
+      c10::utils::check_env("AT_EMBEDDING_BAG_COALESCE") == true;
+  return enabled;
+}
+
+static int embedding_bag_prefetch_distance() {
+  static const int prefetch = []() {
+    const char* env = std::getenv("AT_EMBEDDING_BAG_PREFETCH");
+    if (env != nullptr) {
+      const int value = std::atoi(env);
+      if (value >= 0) {
+        return value;
+      }
+    }
+    return 16;
+  }();
+  return prefetch;
+}
+
 // Determines if we can use a fast implementation for index_select_add, which
 // is only applicable if special conditions are met
 template<typename index_t>
@@ -372,6 +406,82 @@ index_select_add(const Tensor &select_indices,
       offsets_data = offsets_include_last.data();
     }
 
+    if (embedding_bag_coalesce_enabled()) {
+      // See [Note: coalesced embedding lookup].  Each bag is sorted and
+      // deduplicated into thread-local buffers, then handed to the weighted
+      // kernel as a single-bag lookup with multiplicities as weights.
+#ifdef USE_FBGEMM
+      auto kernel_fp32_weighted =
+        fbgemm_kernel_cache ?
+        fbgemm_kernel_cache->getCallback</* has_weight */ true, index_t, float>(ddim) :
+        fbgemm::GenerateEmbeddingSpMDM<float, index_t, index_t>(
+          /* block_size */ddim,
+          /* has_weight */true,
+          /* normalize_by_lengths */false,
+          /* prefetch */embedding_bag_prefetch_distance(),
+          /* is_weight_positional */false,
+          /* use_offsets */true
+        );
+#endif
+      at::parallel_for(
+          0, output_size, 1, [&](index_t start_idx, index_t end_idx) {
+            std::vector<index_t> sorted_indices;
+            std::vector<index_t> unique_indices;
+            std::vector<float> multiplicities;
+            for (const auto bag : c10::irange(start_idx, end_idx)) {
+              sorted_indices.assign(
+                  select_indices_data + offsets_data[bag],
+                  select_indices_data + offsets_data[bag + 1]);
+              std::sort(sorted_indices.begin(), sorted_indices.end());
+              unique_indices.clear();
+              multiplicities.clear();
+              for (const auto idx : sorted_indices) {
+                if (!unique_indices.empty() && unique_indices.back() == idx) {
+                  multiplicities.back() += 1.0f;
+                } else {
+                  unique_indices.push_back(idx);
+                  multiplicities.push_back(1.0f);
+                }
+              }
+              const index_t bag_offsets[2] = {
+                  0, static_cast<index_t>(unique_indices.size())};
+#ifdef USE_FBGEMM
+              bool success = kernel_fp32_weighted(
+                /* output_size */1,
+                /* index_size */bag_offsets[1],
+                /* data_size */src.size(0),
+                /* input */src_data,
+                /* indices */unique_indices.data(),
+                /* offsets_or_lengths */bag_offsets,
+                /* weights */multiplicities.data(),
+                /* output */output_data + bag * ddim);
+              if (!success) {
+                fbgemm_spmdm_report_error_(
+                    1,
+                    bag_offsets[1],
+                    src.size(0),
+                    bag_offsets,
+                    unique_indices.data());
+              }
+#else
+              caffe2::EmbeddingLookupIdx(
+                  /*block_size=*/ddim,
+                  /*output_size=*/1,
+                  /*index_size=*/bag_offsets[1],
+                  /*data_size=*/src.size(0),
+                  /*input=*/src_data,
+                  /*indices=*/unique_indices.data(),
+                  /*offsets=*/bag_offsets,
+                  /*weights=*/multiplicities.data(),
+                  /*scale_bias=*/nullptr,
+                  /*normalize_by_lengths=*/false,
+                  /*out=*/output_data + bag * ddim);
+#endif
+            }
+          });
+      return;
+    }
+
 #ifdef USE_FBGEMM
     auto kernel_fp32_index_t =
       fbgemm_kernel_cache ?
@@ -380,7 +490,7 @@ index_select_add(const Tensor &select_indices,
         /* block_size */ddim,
         /* has_weight */false,
         /* normalize_by_lengths */false,
-        /* prefetch */16,
+        /* prefetch */embedding_bag_prefetch_distance(),
         /* is_weight_positional */false,
         /* use_offsets */true
       );
@@ -33,6 +33,13 @@ Tensor& fill_out(Tensor& self, const Scalar& value) {
     .add_output(self)
     .resize_outputs(false)
     .build();
+  if (iter.device_type() == kCPU) {
+    // See Note [Specialized dispatch entries] in DispatchStub.h.
+    if (auto fn = fill_specialized.get(iter.dtype(), iter.is_contiguous())) {
+      fn(iter, value);
+      return self;
+    }
+  }
   fill_stub(iter.device_type(), iter, value);
   return self;
 }
@@ -81,6 +88,7 @@ Tensor fill(const Tensor& self, const Tensor& value) {
 }
 
 DEFINE_DISPATCH(fill_stub);
+DEFINE_SPECIALIZED_DISPATCH_TABLE(fill_specialized);
 
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ fill_diagonal ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
@@ -16,6 +16,12 @@ namespace native {
 
 DECLARE_DISPATCH(void(*)(TensorIterator&, const c10::Scalar&), fill_stub);
 
+// Direct entries for hot (dtype, contiguous) combinations; see
+// Note [Specialized dispatch entries] in DispatchStub.h.
+DECLARE_SPECIALIZED_DISPATCH_TABLE(
+    void (*)(TensorIterator&, const c10::Scalar&),
+    fill_specialized);
+
 Tensor& fill_out(Tensor& self, const Scalar& value);
 
 }} // namespace at::native
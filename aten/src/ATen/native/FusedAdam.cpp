@@ -0,0 +1,86 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/native/ForeachUtils.h>
+#include <ATen/native/FusedAdam.h>
+#include <c10/util/Exception.h>
+#include <c10/util/irange.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_fused_adam_native.h>
+#endif
+
+namespace at { namespace native {
+
+// CPU counterpart of _fused_adam_kernel_cuda_: one fused pass per parameter
+// that updates param, exp_avg, exp_avg_sq (and max_exp_avg_sq with amsgrad)
+// together, instead of one foreach call per elementwise op, each of which
+// re-reads every tensor from memory. See cuda/fused_adam_utils.cuh for the
+// reference math and [note: Conditional Gradient Store when `optimizer.step`
+// is called by GradScaler] for the grad_scale/found_inf contract.
+void _fused_adam_kernel_cpu_(
+    at::TensorList params,
+    at::TensorList grads,
+    at::TensorList exp_avgs,
+    at::TensorList exp_avg_sqs,
+    at::TensorList max_exp_avg_sqs,
+    at::TensorList state_steps,
+    const double lr,
+    const double beta1,
+    const double beta2,
+    const double weight_decay,
+    const double eps,
+    const bool amsgrad,
+    const bool maximize,
+    const c10::optional<at::Tensor>& grad_scale,
+    const c10::optional<at::Tensor>& found_inf
+) {
+  const float* grad_scale_ptr =
+      grad_scale.has_value() ? grad_scale->data_ptr<float>() : nullptr;
+  if (found_inf.has_value() && found_inf->item<float>() == 1.0f) {
+    return;
+  }
+  const size_t n_tensors = params.size();
+  TORCH_CHECK(grads.size() == n_tensors);
+  TORCH_CHECK(exp_avgs.size() == n_tensors);
+  TORCH_CHECK(exp_avg_sqs.size() == n_tensors);
+  if (amsgrad) {
+    TORCH_CHECK(max_exp_avg_sqs.size() == n_tensors);
+    TORCH_CHECK(
+        check_fast_path_restrictions({params, grads, exp_avgs, exp_avg_sqs, max_exp_avg_sqs}),
+        "params, grads, exp_avgs, exp_avg_sqs, and max_exp_avg_sqs must have same dtype, device, and layout");
+  } else {
+    TORCH_CHECK(
+        check_fast_path_restrictions({params, grads, exp_avgs, exp_avg_sqs}),
+        "params, grads, exp_avgs, and exp_avg_sqs must have same dtype, device, and layout");
+  }
+  TORCH_CHECK(state_steps.size() == n_tensors);
+  Tensor max_exp_avg_sq = Tensor();
+  for (const auto i : c10::irange(n_tensors)) {
+    if (amsgrad) {
+      max_exp_avg_sq = max_exp_avg_sqs[i];
+    }
+    fused_adam_stub(
+        kCPU,
+        params[i],
+        grads[i],
+        exp_avgs[i],
+        exp_avg_sqs[i],
+        max_exp_avg_sq,
+        state_steps[i],
+        lr,
+        beta1,
+        beta2,
+        weight_decay,
+        eps,
+        amsgrad,
+        maximize,
+        grad_scale_ptr);
+  }
+}
+
+DEFINE_DISPATCH(fused_adam_stub);
+
+}} // namespace at::native
@@ -27,12 +27,16 @@
 #else
 #include <ATen/ops/_addmm_activation_native.h>
 #include <ATen/ops/_compute_linear_combination_native.h>
+#include <ATen/ops/_convert_weight_to_int4pack_native.h>
+#include <ATen/ops/_grouped_mm_native.h>
 #include <ATen/ops/_linalg_check_errors.h>
 #include <ATen/ops/_linalg_det.h>
 #include <ATen/ops/_linalg_det_native.h>
 #include <ATen/ops/_linalg_slogdet.h>
 #include <ATen/ops/_linalg_slogdet_native.h>
 #include <ATen/ops/_unsafe_view.h>
+#include <ATen/ops/_weight_int4pack_mm_native.h>
+#include <ATen/ops/_weight_int8pack_mm_native.h>
 #include <ATen/ops/addbmm_native.h>
 #include <ATen/ops/addmm_native.h>
 #include <ATen/ops/addr.h>
@@ -319,6 +323,9 @@ TORCH_META_FUNC(baddbmm)(const Tensor& self, const Tensor& batch1, const Tensor&
 namespace native {
 
 DEFINE_DISPATCH(addr_stub);
+DEFINE_DISPATCH(weight_to_int4pack_stub);
+DEFINE_DISPATCH(int4pack_mm_stub);
+DEFINE_DISPATCH(int8pack_mm_stub);
 
 
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ linalg.det ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -1520,6 +1527,151 @@ TORCH_IMPL_FUNC(mm_out_cpu)(const Tensor & self, const Tensor & mat2, const Tens
   }
 }
 
+// ~~~~~~~~~~~~~~~~~~~~~~~~ WeightOnlyIntMatmul ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Weight-only quantization for memory-bandwidth-bound inference: activations
+// stay floating point, only the weight is stored quantized and dequantized in
+// registers inside the matmul inner loop. Unlike the ops under
+// native/quantized, no quantized activation tensors are involved, so these
+// are plain ATen ops on regular tensors (the same route dynamic quantization
+// takes).
+//
+// Layouts:
+//  - _convert_weight_to_int4pack takes an int32 [N, K] tensor of values in
+//    [0, 15] and packs adjacent pairs along K into one byte (even k in the
+//    high nibble), returning uint8 [N, K / 2].
+//  - _weight_int4pack_mm(A[M, K], packed[N, K / 2], group_size,
+//    scales_and_zeros[K / group_size, N, 2]) dequantizes as
+//    (q - 8) * scale + zero per group and returns A @ W^T as [M, N].
+//  - _weight_int8pack_mm(A[M, K], W[N, K] int8, scales[N]) dequantizes as
+//    q * scale per output row.
+
+Tensor _convert_weight_to_int4pack_cpu(const Tensor& in, int64_t group_size) {
+  TORCH_CHECK(in.dim() == 2,
+      "_convert_weight_to_int4pack: expected weight to be 2D, got ", in.dim(), "D");
+  TORCH_CHECK(in.dtype() == at::kInt,
+      "_convert_weight_to_int4pack: expected weight to be kInt, got ", in.dtype());
+  TORCH_CHECK(in.is_contiguous(),
+      "_convert_weight_to_int4pack: expected weight to be contiguous");
+  const int64_t K = in.size(1);
+  TORCH_CHECK(K % 2 == 0,
+      "_convert_weight_to_int4pack: expected K to be even, got ", K);
+  TORCH_CHECK(group_size > 0 && K % group_size == 0 && group_size % 2 == 0,
+      "_convert_weight_to_int4pack: group_size must be even and divide K, got ",
+      group_size);
+  auto weight_packed = at::empty({in.size(0), K / 2}, in.options().dtype(at::kByte));
+  weight_to_int4pack_stub(kCPU, weight_packed, in);
+  return weight_packed;
+}
+
+Tensor _weight_int4pack_mm_cpu(
+    const Tensor& A,
+    const Tensor& B,
+    int64_t group_size,
+    const Tensor& scales_and_zeros) {
+  const int64_t M = A.size(0);
+  const int64_t K = A.size(1);
+  const int64_t N = B.size(0);
+  TORCH_CHECK(A.dim() == 2 && A.is_contiguous(),
+      "_weight_int4pack_mm: expected A to be a contiguous 2D tensor");
+  TORCH_CHECK(A.dtype() == at::kFloat || A.dtype() == at::kHalf || A.dtype() == at::kBFloat16,
+      "_weight_int4pack_mm: expected A to be float32, float16 or bfloat16, got ", A.dtype());
+  TORCH_CHECK(B.dim() == 2 && B.is_contiguous() && B.dtype() == at::kByte,
+      "_weight_int4pack_mm: expected B to be a contiguous uint8 2D tensor");
+  TORCH_CHECK(B.size(1) * 2 == K,
+      "_weight_int4pack_mm: expected B.size(1) to be K / 2, got ", B.size(1));
+  TORCH_CHECK(group_size > 0 && group_size % 2 == 0 && K % group_size == 0,
+      "_weight_int4pack_mm: group_size must be even and divide K, got ", group_size);
+  TORCH_CHECK(scales_and_zeros.dtype() == at::kFloat && scales_and_zeros.is_contiguous() &&
+      scales_and_zeros.sizes() == c10::IntArrayRef({K / group_size, N, 2}),
+      "_weight_int4pack_mm: expected scales_and_zeros to be a contiguous float32 tensor of shape [",
+      K / group_size, ", ", N, ", 2]");
+  auto C = at::empty({M, N}, A.options());
+  int4pack_mm_stub(kCPU, C, A, B, group_size, scales_and_zeros);
+  return C;
+}
+
+Tensor _weight_int8pack_mm_cpu(
+    const Tensor& A,
+    const Tensor& B,
+    const Tensor& scales) {
+  const int64_t M = A.size(0);
+  const int64_t K = A.size(1);
+  const int64_t N = B.size(0);
+  TORCH_CHECK(A.dim() == 2 && A.is_contiguous(),
+      "_weight_int8pack_mm: expected A to be a contiguous 2D tensor");
+  TORCH_CHECK(A.dtype() == at::kFloat || A.dtype() == at::kHalf || A.dtype() == at::kBFloat16,
+      "_weight_int8pack_mm: expected A to be float32, float16 or bfloat16, got ", A.dtype());
+  TORCH_CHECK(B.dim() == 2 && B.is_contiguous() && B.dtype() == at::kChar,
+      "_weight_int8pack_mm: expected B to be a contiguous int8 2D tensor");
+  TORCH_CHECK(B.size(1) == K,
+      "_weight_int8pack_mm: expected B.size(1) to match A.size(1), got ", B.size(1));
+  TORCH_CHECK(scales.dtype() == at::kFloat && scales.is_contiguous() &&
+      scales.sizes() == c10::IntArrayRef({N}),
+      "_weight_int8pack_mm: expected scales to be a contiguous float32 tensor of shape [", N, "]");
+  auto C = at::empty({M, N}, A.options());
+  int8pack_mm_stub(kCPU, C, A, B, scales);
+  return C;
+}
+
+// Note [grouped_mm]
+// _grouped_mm computes mat1[i] @ mat2[i] for every group i. It differs from
+// bmm in that the groups may have different shapes, which is what
+// mixture-of-experts layers need: each expert sees a different number of
+// tokens, so the per-expert GEMMs cannot be packed into one batched call.
+// Looping over at::mm from Python pays op dispatch per expert; here the CPU
+// kernel resolves dispatch once and drives the BLAS entry point directly for
+// every group. Group-level parallelism is deliberately left to the BLAS
+// backend -- wrapping the loop in parallel_for would nest with the
+// intra-GEMM threading and oversubscribe.
+static void check_grouped_mm_inputs(TensorList mat1, TensorList mat2) {
+  TORCH_CHECK(
+      mat1.size() == mat2.size(),
+      "grouped_mm: expected mat1 and mat2 to contain the same number of tensors, but got ",
+      mat1.size(), " and ", mat2.size());
+  for (const auto i : c10::irange(mat1.size())) {
+    TORCH_CHECK(
+        mat1[i].dim() == 2 && mat2[i].dim() == 2,
+        "grouped_mm: expected 2-D tensors in group ", i, ", but got ",
+        mat1[i].dim(), "-D and ", mat2[i].dim(), "-D tensors");
+    TORCH_CHECK(
+        mat1[i].size(1) == mat2[i].size(0),
+        "grouped_mm: incompatible matrix sizes in group ", i, " (",
+        mat1[i].size(0), "x", mat1[i].size(1), " and ",
+        mat2[i].size(0), "x", mat2[i].size(1), ")");
+    TORCH_CHECK(
+        mat1[i].scalar_type() == mat1[0].scalar_type() &&
+            mat2[i].scalar_type() == mat1[0].scalar_type(),
+        "grouped_mm: expected all tensors to have the same dtype ",
+        mat1[0].scalar_type(), ", but group ", i, " has ",
+        mat1[i].scalar_type(), " and ", mat2[i].scalar_type());
+  }
+}
+
+std::vector<Tensor> _grouped_mm(TensorList mat1, TensorList mat2) {
+  check_grouped_mm_inputs(mat1, mat2);
+  std::vector<Tensor> results;
+  results.reserve(mat1.size());
+  for (const auto i : c10::irange(mat1.size())) {
+    results.push_back(at::mm(mat1[i], mat2[i]));
+  }
+  return results;
+}
+
+std::vector<Tensor> _grouped_mm_cpu(TensorList mat1, TensorList mat2) {
+  check_grouped_mm_inputs(mat1, mat2);
+  std::vector<Tensor> results;
+  results.reserve(mat1.size());
+  at::NoNamesGuard guard;
+  for (const auto i : c10::irange(mat1.size())) {
+    auto result =
+        at::empty({mat1[i].size(0), mat2[i].size(1)}, mat1[i].options());
+    addmm_impl_cpu_(result, result, mat1[i], mat2[i], 0, 1);
+    results.push_back(std::move(result));
+  }
+  return results;
+}
+
 template <typename scalar_t, bool is_bmm>
 inline void baddbmm_cpu_kernel(const Tensor& result, const Tensor& self, const Tensor& mat2, const Scalar& beta_, const Scalar& alpha_) {
   int64_t bs = result.size(0);
@@ -8,6 +8,7 @@ class Scalar;
 }
 
 namespace at {
+class Tensor;
 struct TensorIterator;
 }
 
@@ -15,4 +16,15 @@ namespace at { namespace native {
 
 using addr_fn = void (*)(TensorIterator &, const Scalar& beta, const Scalar& alpha);
 DECLARE_DISPATCH(addr_fn, addr_stub);
+
+// Weight-only quantized matmul kernels; see WeightOnlyIntMatmul in
+// LinearAlgebra.cpp for the argument checks and layouts.
+using weight_to_int4pack_fn = void (*)(const Tensor&, const Tensor&);
+DECLARE_DISPATCH(weight_to_int4pack_fn, weight_to_int4pack_stub);
+using int4pack_mm_fn =
+    void (*)(const Tensor&, const Tensor&, const Tensor&, int64_t, const Tensor&);
+DECLARE_DISPATCH(int4pack_mm_fn, int4pack_mm_stub);
+using int8pack_mm_fn =
+    void (*)(const Tensor&, const Tensor&, const Tensor&, const Tensor&);
+DECLARE_DISPATCH(int8pack_mm_fn, int8pack_mm_stub);
 }} // namespace at::native
@@ -4,9 +4,14 @@
 #include <ATen/core/Tensor.h>
 #include <ATen/Dispatch.h>
 #include <ATen/NumericUtils.h>
+#include <ATen/Parallel.h>
 #include <ATen/TensorOperators.h>
+#include <ATen/cpu/vec/functional.h>
+#include <ATen/cpu/vec/vec.h>
 #include <c10/util/irange.h>
 
+#include <vector>
+
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
@@ -39,11 +44,46 @@ SegmentReductionType get_reduction_enum(const c10::string_view& reduce) {
     return SegmentReductionType::SUM;
   } else if (reduce == "prod") {
     return SegmentReductionType::PROD;
+  } else if (reduce == "softmax") {
+    return SegmentReductionType::SOFTMAX;
   } else {
     TORCH_CHECK(false, "unsupported reduction given! ", reduce);
   }
 }
 
+// Segments vary wildly in length in graph workloads, so parallel tasks are
+// balanced by element count rather than segment count: the grain is chosen
+// so each task covers roughly GRAIN_SIZE data elements however the segments
+// happen to be split.
+int64_t segment_grain_size(int64_t total_elements, int64_t num_tasks) {
+  const int64_t avg =
+      std::max(int64_t{1}, total_elements / std::max(int64_t{1}, num_tasks));
+  return std::max(int64_t{1}, at::internal::GRAIN_SIZE / avg);
+}
+
+// The lengths layout only defines segment boundaries implicitly via a
+// running sum, which forces sequential traversal; materialize per-outer
+// start offsets once so segments can then be visited in any order in
+// parallel. The offsets (CSR) layout already supports random access.
+template <typename T>
+std::vector<int64_t> lengths_to_segment_starts(
+    const T* lengths_data,
+    int64_t outer_offset,
+    int64_t segment_count,
+    int64_t lengths_stride_axis) {
+  std::vector<int64_t> starts(outer_offset * (segment_count + 1));
+  for (const auto outer_idx : c10::irange(outer_offset)) {
+    int64_t running = 0;
+    starts[outer_idx * (segment_count + 1)] = 0;
+    for (const auto dim_idx : c10::irange(segment_count)) {
+      running +=
+          lengths_data[outer_idx * lengths_stride_axis * segment_count + dim_idx];
+      starts[outer_idx * (segment_count + 1) + dim_idx + 1] = running;
+    }
+  }
+  return starts;
+}
+
 template <typename T, bool is_offsets_like=false>
 void _segment_reduce_lengths_cpu_kernel1(
     SegmentReductionType reduction,
@@ -70,21 +110,30 @@ void _segment_reduce_lengths_cpu_kernel1(
       kBFloat16, kHalf, data.scalar_type(), "_segment_reduce_cpu", [&]() {
         auto* output_data = output.data_ptr<scalar_t>();
         const auto* values_data = data.data_ptr<scalar_t>();
-        for (const auto outer_idx : c10::irange(outer_offset)) {
-          int64_t segment_start, segment_length;
-          int64_t segment_end = is_offsets_like ?
-                                lengths_data[outer_idx * lengths_stride_axis * lengths_size_axis] :
-                                0;
-          for (const auto dim_idx : c10::irange(segment_count)) {
-            segment_start = segment_end;
-            auto lengths_idx = outer_idx * lengths_stride_axis * lengths_size_axis + dim_idx;
+        std::vector<int64_t> starts;
+        if (!is_offsets_like) {
+          starts = lengths_to_segment_starts(
+              lengths_data, outer_offset, segment_count, lengths_stride_axis);
+        }
+        const int64_t grain = segment_grain_size(
+            outer_offset * data_size_axis * inner_offset,
+            outer_offset * segment_count);
+        at::parallel_for(0, outer_offset * segment_count, grain,
+            [&](int64_t task_begin, int64_t task_end) {
+          for (const auto flat_idx : c10::irange(task_begin, task_end)) {
+            const int64_t outer_idx = flat_idx / segment_count;
+            const int64_t dim_idx = flat_idx % segment_count;
+            int64_t segment_start, segment_end, segment_length;
             if (is_offsets_like) {
+              auto lengths_idx = outer_idx * lengths_stride_axis * lengths_size_axis + dim_idx;
+              segment_start = lengths_data[lengths_idx];
               segment_end = lengths_data[lengths_idx + 1];
-              segment_length = segment_end - segment_start;
             } else {
-              segment_length = lengths_data[lengths_idx];
-              segment_end += segment_length;
+              auto starts_idx = outer_idx * (segment_count + 1) + dim_idx;
+              segment_start = starts[starts_idx];
+              segment_end = starts[starts_idx + 1];
             }
+            segment_length = segment_end - segment_start;
             for (const auto inner_idx : c10::irange(inner_offset)) {
               // ===== step1: initialize starting value
               scalar_t initial_value;
@@ -140,7 +189,108 @@ void _segment_reduce_lengths_cpu_kernel1(
               output_data[output_index] = initial_value;
             }
           }
+        });
+      });
+}
+
+// Segment softmax: normalizes within each segment instead of collapsing it,
+// so the output has the shape of `data`. When the reduction axis is the
+// innermost dimension each segment is a contiguous run and the max/exp/sum
+// passes are vectorized with at::vec; otherwise a strided scalar path is
+// used. Positions not covered by any segment are left zero-initialized.
+template <typename T, bool is_offsets_like = false>
+void _segment_softmax_cpu_kernel1(
+    const Tensor& data,
+    const T* lengths_data,
+    int64_t axis,
+    Tensor& output,
+    int64_t segment_count,
+    int64_t lengths_stride_axis) {
+  int64_t outer_offset = 1, inner_offset = 1;
+  for (int64_t d = 0; d < axis; d++)
+      outer_offset *= data.size(d);
+  for (int64_t d = axis + 1; d < data.dim(); d++)
+      inner_offset *= data.size(d);
+  int64_t lengths_size_axis = is_offsets_like ? segment_count + 1 : segment_count;
+  auto data_stride_axis = data.stride(axis);
+  auto data_size_axis = data.size(axis);
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kBFloat16, kHalf, data.scalar_type(), "_segment_softmax_cpu", [&]() {
+        using Vec = vec::Vectorized<scalar_t>;
+        auto* output_data = output.data_ptr<scalar_t>();
+        const auto* values_data = data.data_ptr<scalar_t>();
+        std::vector<int64_t> starts;
+        if (!is_offsets_like) {
+          starts = lengths_to_segment_starts(
+              lengths_data, outer_offset, segment_count, lengths_stride_axis);
         }
+        const int64_t grain = segment_grain_size(
+            outer_offset * data_size_axis * inner_offset,
+            outer_offset * segment_count);
+        at::parallel_for(0, outer_offset * segment_count, grain,
+            [&](int64_t task_begin, int64_t task_end) {
+          for (const auto flat_idx : c10::irange(task_begin, task_end)) {
+            const int64_t outer_idx = flat_idx / segment_count;
+            const int64_t dim_idx = flat_idx % segment_count;
+            int64_t segment_start, segment_end;
+            if (is_offsets_like) {
+              auto lengths_idx = outer_idx * lengths_stride_axis * lengths_size_axis + dim_idx;
+              segment_start = lengths_data[lengths_idx];
+              segment_end = lengths_data[lengths_idx + 1];
+            } else {
+              auto starts_idx = outer_idx * (segment_count + 1) + dim_idx;
+              segment_start = starts[starts_idx];
+              segment_end = starts[starts_idx + 1];
+            }
+            const int64_t segment_length = segment_end - segment_start;
+            TORCH_CHECK(segment_length >= 0);
+            if (segment_length == 0) {
+              continue;
+            }
+            const int64_t base = outer_idx * data_stride_axis * data_size_axis;
+            if (inner_offset == 1 && data_stride_axis == 1) {
+              const scalar_t* src = values_data + base + segment_start;
+              scalar_t* dst = output_data + base + segment_start;
+              const scalar_t max_value = vec::reduce_all<scalar_t>(
+                  [](Vec& x, Vec& y) { return vec::maximum(x, y); },
+                  const_cast<scalar_t*>(src),
+                  segment_length);
+              vec::map(
+                  [max_value](Vec x) { return (x - Vec(max_value)).exp(); },
+                  dst,
+                  src,
+                  segment_length);
+              const scalar_t sum = vec::reduce_all<scalar_t>(
+                  [](Vec& x, Vec& y) { return x + y; }, dst, segment_length);
+              const scalar_t inv_sum = static_cast<scalar_t>(1) / sum;
+              vec::map(
+                  [inv_sum](Vec x) { return x * Vec(inv_sum); },
+                  dst,
+                  dst,
+                  segment_length);
+            } else {
+              for (const auto inner_idx : c10::irange(inner_offset)) {
+                scalar_t max_value = -std::numeric_limits<scalar_t>::infinity();
+                for (const auto j : c10::irange(segment_start, segment_end)) {
+                  const auto val = values_data[base + j * data_stride_axis + inner_idx];
+                  max_value = at::_isnan(val) ? val : std::max<scalar_t>(max_value, val);
+                }
+                scalar_t sum = 0;
+                for (const auto j : c10::irange(segment_start, segment_end)) {
+                  int64_t idx = base + j * data_stride_axis + inner_idx;
+                  const scalar_t e = std::exp(static_cast<scalar_t>(
+                      values_data[idx] - max_value));
+                  output_data[idx] = e;
+                  sum += e;
+                }
+                for (const auto j : c10::irange(segment_start, segment_end)) {
+                  int64_t idx = base + j * data_stride_axis + inner_idx;
+                  output_data[idx] = output_data[idx] / sum;
+                }
+              }
+            }
+          }
+        });
       });
 }
 
@@ -157,6 +307,15 @@ Tensor _segment_reduce_lengths_cpu_kernel(
   axis = lengths.dim() - 1;
   int64_t segment_count = lengths.size(axis);
   int64_t lengths_stride_axis = lengths.stride(axis);
+  if (reduction == SegmentReductionType::SOFTMAX) {
+    auto output = at::zeros(data.sizes(), data.options());
+    AT_DISPATCH_INDEX_TYPES(lengths.scalar_type(), "_segment_softmax_cpu_kernel1", [&]() {
+      const auto* lengths_data = lengths.data_ptr<index_t>();
+      _segment_softmax_cpu_kernel1(
+          data, lengths_data, axis, output, segment_count, lengths_stride_axis);
+    });
+    return output;
+  }
   auto output_shape = data.sizes().vec();
   output_shape[axis] = segment_count;
   auto output = at::empty(output_shape, data.options());
@@ -183,6 +342,15 @@ Tensor _segment_reduce_offsets_cpu_kernel(
   axis = offsets.dim() - 1;
   int64_t segment_count = offsets.size(axis) - 1;
   int64_t offsets_stride_axis = offsets.stride(axis);
+  if (reduction == SegmentReductionType::SOFTMAX) {
+    auto output = at::zeros(data.sizes(), data.options());
+    AT_DISPATCH_INDEX_TYPES(offsets.scalar_type(), "_segment_softmax_cpu_kernel1", [&]() {
+      const auto* offsets_data = offsets.data_ptr<index_t>();
+      _segment_softmax_cpu_kernel1<index_t, /*is_offsets_like=*/true>(
+          data, offsets_data, axis, output, segment_count, offsets_stride_axis);
+    });
+    return output;
+  }
   auto output_shape = data.sizes().vec();
   output_shape[axis] = segment_count;
   auto output = at::empty(output_shape, data.options());
@@ -242,27 +410,51 @@ void _segment_reduce_cpu_lengths_backward_kernel1(
           }
         }
 
-        for (const auto outer_idx : c10::irange(outer_offset)) {
-          // int64_t lengths_cum_sum = 0;
-          int64_t segment_start, segment_length;
-          int64_t segment_end = is_offsets_like ?
-                                lengths_data[outer_idx * lengths_stride_axis * lengths_size_axis] :
-                                0;
-          for (const auto dim_idx : c10::irange(segment_count)) {
-            // int64_t segment_length = lengths_data[outer_idx * lengths_stride_axis * segment_count + dim_idx];
-            segment_start = segment_end;
-            auto lengths_idx = outer_idx * lengths_stride_axis * lengths_size_axis + dim_idx;
+        std::vector<int64_t> starts;
+        if (!is_offsets_like) {
+          starts = lengths_to_segment_starts(
+              lengths_data, outer_offset, segment_count, lengths_stride_axis);
+        }
+        const int64_t grain = segment_grain_size(
+            outer_offset * data_size_axis * inner_offset,
+            outer_offset * segment_count);
+        at::parallel_for(0, outer_offset * segment_count, grain,
+            [&](int64_t task_begin, int64_t task_end) {
+          for (const auto flat_idx : c10::irange(task_begin, task_end)) {
+            const int64_t outer_idx = flat_idx / segment_count;
+            const int64_t dim_idx = flat_idx % segment_count;
+            int64_t segment_start, segment_end, segment_length;
             if (is_offsets_like) {
+              auto lengths_idx = outer_idx * lengths_stride_axis * lengths_size_axis + dim_idx;
+              segment_start = lengths_data[lengths_idx];
               segment_end = lengths_data[lengths_idx + 1];
-              segment_length = segment_end - segment_start;
             } else {
-              segment_length = lengths_data[lengths_idx];
-              segment_end += segment_length;
+              auto starts_idx = outer_idx * (segment_count + 1) + dim_idx;
+              segment_start = starts[starts_idx];
+              segment_end = starts[starts_idx + 1];
             }
+            segment_length = segment_end - segment_start;
             if (segment_length == 0) {
               continue;
             }
             for (const auto inner_idx : c10::irange(inner_offset)) {
+              if (reduction == SegmentReductionType::SOFTMAX) {
+                // grad and output are data-shaped here (see softmax forward);
+                // d softmax = out * (grad - sum(grad * out)) per segment.
+                scalar_t dot = 0;
+                for (const auto j : c10::irange(segment_start, segment_end)) {
+                  int64_t data_index = outer_idx * data_stride_axis * data_size_axis
+                                       + j * data_stride_axis + inner_idx;
+                  dot += grad_data[data_index] * output_data[data_index];
+                }
+                for (const auto j : c10::irange(segment_start, segment_end)) {
+                  int64_t data_index = outer_idx * data_stride_axis * data_size_axis
+                                       + j * data_stride_axis + inner_idx;
+                  grad_input_data[data_index] = output_data[data_index] *
+                      (grad_data[data_index] - dot);
+                }
+                continue;
+              }
               int64_t output_index = outer_idx * output_stride_axis * output_size_axis
                                      + dim_idx * output_stride_axis + inner_idx;
               if (reduction == SegmentReductionType::MAX ||
@@ -290,19 +482,24 @@ void _segment_reduce_cpu_lengths_backward_kernel1(
                         grad_input_data[data_index] / counter;
                   }
                 }
-              } else if (reduction == SegmentReductionType::MEAN) {
-                auto grad_val = grad_data[output_index] / segment_length;
-                for (const auto j : c10::irange(segment_start, segment_end)) {
-                  int64_t data_index = outer_idx * data_stride_axis * data_size_axis
-                                       + j * data_stride_axis + inner_idx;
-                  grad_input_data[data_index] = grad_val;
-                }
-              } else if (reduction == SegmentReductionType::SUM) {
-                const auto& grad_val = grad_data[output_index];
-                for (const auto j : c10::irange(segment_start, segment_end)) {
-                  int64_t data_index = outer_idx * data_stride_axis * data_size_axis
-                                       + j * data_stride_axis + inner_idx;
-                  grad_input_data[data_index] = grad_val;
+              } else if (
+                  reduction == SegmentReductionType::MEAN ||
+                  reduction == SegmentReductionType::SUM) {
+                const scalar_t grad_val = reduction == SegmentReductionType::MEAN
+                    ? grad_data[output_index] / segment_length
+                    : grad_data[output_index];
+                if (inner_offset == 1 && data_stride_axis == 1) {
+                  // Contiguous segment: a plain fill, which the compiler
+                  // turns into wide stores.
+                  scalar_t* dst = grad_input_data +
+                      outer_idx * data_stride_axis * data_size_axis + segment_start;
+                  std::fill(dst, dst + segment_length, grad_val);
+                } else {
+                  for (const auto j : c10::irange(segment_start, segment_end)) {
+                    int64_t data_index = outer_idx * data_stride_axis * data_size_axis
+                                         + j * data_stride_axis + inner_idx;
+                    grad_input_data[data_index] = grad_val;
+                  }
                 }
               } else if (reduction == SegmentReductionType::PROD) {
                 const auto& grad_val = grad_data[output_index] * output_data[output_index];
@@ -329,7 +526,7 @@ void _segment_reduce_cpu_lengths_backward_kernel1(
               }
             }
           }
-        }
+        });
       });
 }
 
@@ -423,6 +620,14 @@ Tensor segment_reduce_kernel(
       "segment_reduce(): Either lengths or offsets must be defined.")
 
   auto reduction = get_reduction_enum(reduce);
+  if (reduction == SegmentReductionType::SOFTMAX) {
+    TORCH_CHECK(
+        data.is_cpu(),
+        "segment_reduce(): reduce=\"softmax\" is currently only supported on CPU.");
+    TORCH_CHECK(
+        !initial.has_value(),
+        "segment_reduce(): initial is not supported for reduce=\"softmax\".");
+  }
   const auto data_contig = data.contiguous();
 
   if (offsets_has_value) {
@@ -519,6 +724,9 @@ Tensor _segment_reduce_backward_kernel(
   const auto output_contig = output.contiguous();
   const auto data_contig = data.contiguous();
   auto reduction = get_reduction_enum(reduce);
+  TORCH_CHECK(
+      reduction != SegmentReductionType::SOFTMAX || data.is_cpu(),
+      "segment_reduce(): reduce=\"softmax\" is currently only supported on CPU.");
 
   if (offsets_has_value) {
     const auto& offsets_value = offsets.value();
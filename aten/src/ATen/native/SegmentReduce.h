@@ -9,7 +9,10 @@ class Tensor;
 
 namespace native {
 
-enum SegmentReductionType { MAX, MEAN, MIN, SUM, PROD};
+// SOFTMAX is special-cased: it normalizes within each segment instead of
+// collapsing it, so its output has the shape of `data` rather than one row
+// per segment. It is currently CPU-only.
+enum SegmentReductionType { MAX, MEAN, MIN, SUM, PROD, SOFTMAX };
 
 using segment_reduce_lengths_fn = Tensor (*)(
     SegmentReductionType,
@@ -579,6 +579,8 @@ DEFINE_DISPATCH(log_softmax_kernel);
 DEFINE_DISPATCH(softmax_backward_kernel);
 DEFINE_DISPATCH(log_softmax_backward_kernel);
 
+DEFINE_DISPATCH(masked_softmax_lastdim_kernel);
+
 Tensor softmax(const Tensor& self, Dimname dim, optional<ScalarType> dtype) {
   return at::softmax(self, dimname_to_position(self, dim), dtype);
 }
@@ -637,6 +639,17 @@ Tensor masked_softmax_cpu(const Tensor& input_, const Tensor& mask_, const c10::
     input = input.view(1);
   }
 
+  // Fast path: softmax over the last dim of a contiguous float input goes
+  // through the fused vectorized kernel, which applies the mask in-register
+  // instead of the scalar per-element loop below.
+  if (input.scalar_type() == ScalarType::Float && dim == input.dim() - 1 &&
+      input.numel() > 0 && input.size(dim) > 0 && output.is_contiguous() &&
+      mask_type.has_value()) {
+    masked_softmax_lastdim_kernel(
+        kCPU, output, input, mask, mask_type.value());
+    return output;
+  }
+
   AT_DISPATCH_FLOATING_TYPES_AND(
       at::ScalarType::BFloat16, input.scalar_type(), "masked_softmax", [&] {
         host_softmax<
@@ -84,7 +84,9 @@
 #include <ATen/ops/_gather_sparse_backward_native.h>
 #include <ATen/ops/_index_put_impl.h>
 #include <ATen/ops/_index_put_impl_native.h>
+#include <ATen/ops/_index_select_cast_scale_native.h>
 #include <ATen/ops/_sparse_coo_tensor_unsafe.h>
+#include <ATen/ops/add.h>
 #include <ATen/ops/arange.h>
 #include <ATen/ops/argwhere_native.h>
 #include <ATen/ops/as_strided.h>
@@ -1320,6 +1322,84 @@ Tensor index_select_quantized_cpu_(const Tensor & self, int64_t dim, const Tenso
   return at::native::index_select_out_cpu_(self, dim, index, result);
 }
 
+// Note [index_select_cast_scale]
+// Serving paths that keep embedding tables in fp16 or int8 gather rows with
+// index_select and then cast and apply per-row (de)quantization scales in
+// separate passes, re-reading the gathered rows from memory each time.
+// _index_select_cast_scale fuses the three: each selected row is read once,
+// converted to float and multiplied by its scale on the way to the output.
+// `self` is the (num_rows, row_size) table, `index` selects rows, and
+// `scale` is a float vector of length num_rows indexed by the *table* row
+// (not the output position), matching how per-row quantization scales are
+// stored alongside the table.
+static void check_index_select_cast_scale_inputs(
+    const Tensor& self,
+    const Tensor& index,
+    const Tensor& scale) {
+  TORCH_CHECK(
+      self.dim() == 2,
+      "index_select_cast_scale(): Expected a 2-D table, got ", self.dim(), "-D");
+  TORCH_CHECK_INDEX(
+      index.dim() <= 1,
+      "index_select_cast_scale(): Index is supposed to be a vector");
+  TORCH_CHECK(
+      index.scalar_type() == ScalarType::Long || index.scalar_type() == ScalarType::Int,
+      "index_select_cast_scale(): Expected dtype int32 or int64 for index");
+  TORCH_CHECK(
+      scale.dim() == 1 && scale.size(0) == self.size(0),
+      "index_select_cast_scale(): Expected scale to be a vector of length ",
+      self.size(0), ", got sizes ", scale.sizes());
+  TORCH_CHECK(
+      scale.scalar_type() == ScalarType::Float,
+      "index_select_cast_scale(): Expected float scale, got ", scale.scalar_type());
+}
+
+Tensor index_select_cast_scale_cpu(
+    const Tensor& self,
+    const Tensor& index,
+    const Tensor& scale) {
+  check_index_select_cast_scale_inputs(self, index, scale);
+  auto self_contig = self.contiguous();
+  auto index_contig = index.contiguous();
+  auto scale_contig = scale.contiguous();
+
+  const int64_t num_rows = self.size(0);
+  const int64_t row_size = self.size(1);
+  const int64_t num_indices = index.numel();
+
+  Tensor result = at::empty(
+      {num_indices, row_size}, self.options().dtype(ScalarType::Float));
+  float* out_data = result.data_ptr<float>();
+  const float* scale_data = scale_contig.data_ptr<float>();
+
+  AT_DISPATCH_INDEX_TYPES(
+      index_contig.scalar_type(), "index_select_cast_scale_cpu", [&] {
+    const index_t* index_data = index_contig.data_ptr<index_t>();
+    AT_DISPATCH_ALL_TYPES_AND2(ScalarType::Half, ScalarType::BFloat16,
+        self.scalar_type(), "index_select_cast_scale_cpu", [&] {
+      const scalar_t* src_data = self_contig.data_ptr<scalar_t>();
+      const int64_t grain_size =
+          at::internal::GRAIN_SIZE / std::max(row_size, int64_t{1});
+      at::parallel_for(0, num_indices, grain_size,
+          [&](int64_t begin, int64_t end) {
+        for (const auto i : c10::irange(begin, end)) {
+          const int64_t row = index_data[i];
+          TORCH_CHECK_INDEX(
+              row >= 0 && row < num_rows,
+              "index_select_cast_scale(): index out of range in self");
+          const scalar_t* src = src_data + row * row_size;
+          float* dst = out_data + i * row_size;
+          const float row_scale = scale_data[row];
+          for (const auto j : c10::irange(row_size)) {
+            dst[j] = static_cast<float>(src[j]) * row_scale;
+          }
+        }
+      });
+    });
+  });
+  return result;
+}
+
 Tensor index_select_backward(const Tensor& grad, at::IntArrayRef self_sizes, int64_t dim, const Tensor& index) {
     return at::native::index_select_backward_symint(grad, c10::fromIntArrayRefSlow(self_sizes), dim, index);
 }
@@ -1801,7 +1881,57 @@ static Tensor & masked_select_out_impl_cpu(Tensor & result, const Tensor & self,
   std::tie(_mask, _self) = expand_outplace(mask, self);
 
   auto shape = _self->sizes();
-  int64_t numel = _mask->sum().item().toLong();
+
+  // When the mask broadcasts against self along leading dimensions only, the
+  // expanded mask is an outer tiling of a smaller block: the leading
+  // (broadcasted) dimensions all have stride zero while the trailing
+  // dimensions carry the mask's own data (e.g. a [1, 1, S, S] attention mask
+  // applied to [B, H, S, S] scores). In that case both the element count and
+  // the prefix sum needed by the parallel kernel can be derived from a single
+  // scan of the block instead of a scan of the full broadcast domain.
+  const auto mask_sizes = _mask->sizes();
+  const auto mask_strides = _mask->strides();
+  const auto mask_dim = _mask->dim();
+  int64_t leading_broadcast_dims = 0;
+  while (leading_broadcast_dims < mask_dim &&
+         mask_strides[leading_broadcast_dims] == 0) {
+    leading_broadcast_dims++;
+  }
+  int64_t repeats = 1;
+  for (const auto d : c10::irange(leading_broadcast_dims)) {
+    repeats *= mask_sizes[d];
+  }
+  int64_t block_numel = 1;
+  bool repeated_mask = leading_broadcast_dims > 0 && repeats > 1;
+  for (const auto d : c10::irange(leading_broadcast_dims, mask_dim)) {
+    if (mask_strides[d] == 0 && mask_sizes[d] > 1) {
+      // Broadcasting along an interior dimension as well; the repetition is
+      // not a simple outer tiling, so use the generic path.
+      repeated_mask = false;
+      break;
+    }
+    block_numel *= mask_sizes[d];
+  }
+  repeated_mask = repeated_mask && block_numel > 0;
+
+  Tensor block_prefix;
+  int64_t block_count = 0;
+  int64_t numel = 0;
+  if (repeated_mask) {
+    auto block_sizes = mask_sizes.slice(leading_broadcast_dims);
+    auto block_strides = mask_strides.slice(leading_broadcast_dims);
+    auto mask_block = _mask->as_strided(block_sizes, block_strides);
+    auto block_long =
+        at::empty(block_sizes, self.options().dtype(at::kLong)).copy_(mask_block);
+    block_prefix = at::empty({block_numel}, self.options().dtype(at::kLong));
+    auto block_long_data = block_long.data_ptr<int64_t>();
+    std::partial_sum(
+        block_long_data, block_long_data + block_numel, block_prefix.data_ptr<int64_t>());
+    block_count = block_prefix.data_ptr<int64_t>()[block_numel - 1];
+    numel = repeats * block_count;
+  } else {
+    numel = _mask->sum().item().toLong();
+  }
   at::native::resize_output(result, {numel});
   if (numel == 0) {
     return result;
@@ -1835,14 +1965,27 @@ static Tensor & masked_select_out_impl_cpu(Tensor & result, const Tensor & self,
 
   // Use a prefix sum to record the output locations of the masked elements,
   // so as to parallel with TensorIterator.
-  auto mask_long = at::empty(shape, self.options().dtype(at::kLong)).copy_(*_mask);
   auto mask_prefix_sum = at::empty(shape, self.options().dtype(at::kLong));
-  auto mask_long_data = mask_long.data_ptr<int64_t>();
-  auto mask_prefix_sum_data = mask_prefix_sum.data_ptr<int64_t>();
-  // TODO: Here can only use std::partial_sum for C++14,
-  // use std::exclusive_scan when PyTorch upgrades to C++17, which have better peformance.
-  // std::exclusive_scan(mask_long_data, mask_long_data + mask_long.numel(), mask_prefix_sum_data, 0);
-  std::partial_sum(mask_long_data, mask_long_data + mask_long.numel(), mask_prefix_sum_data);
+  if (repeated_mask) {
+    // The inclusive prefix sum of an outer-tiled mask at (r, i) is
+    // r * block_count + block_prefix[i], so rebuild it from the block scan
+    // with a broadcast add instead of materializing the broadcast mask and
+    // scanning the whole domain serially. mask_prefix_sum was just allocated
+    // contiguously, so the two-dimensional view is valid.
+    auto prefix_2d = mask_prefix_sum.view({repeats, block_numel});
+    auto offsets = at::arange(repeats, mask_prefix_sum.options())
+                       .mul_(block_count)
+                       .view({repeats, 1});
+    at::add_out(prefix_2d, offsets, block_prefix.view({1, block_numel}));
+  } else {
+    auto mask_long = at::empty(shape, self.options().dtype(at::kLong)).copy_(*_mask);
+    auto mask_long_data = mask_long.data_ptr<int64_t>();
+    auto mask_prefix_sum_data = mask_prefix_sum.data_ptr<int64_t>();
+    // TODO: Here can only use std::partial_sum for C++14,
+    // use std::exclusive_scan when PyTorch upgrades to C++17, which have better peformance.
+    // std::exclusive_scan(mask_long_data, mask_long_data + mask_long.numel(), mask_prefix_sum_data, 0);
+    std::partial_sum(mask_long_data, mask_long_data + mask_long.numel(), mask_prefix_sum_data);
+  }
 
   auto iter = TensorIteratorConfig()
     .set_check_mem_overlap(false)  // result is intenionally zero-strided above
@@ -1319,12 +1319,24 @@ Tensor coo_to_sparse_csr(const Tensor& self) {
       "Only tensors with two sparse dimensions can be converted to the SparseCsr layout, got self with ",
       self.sparse_dim(), " sparse dimensions.");
   auto coalesced_self = self.coalesce();
-  auto row_indices = coalesced_self.indices()[0];
-  bool out_int32 = (row_indices.scalar_type() == at::kInt);
-  auto crow_indices = at::_convert_indices_from_coo_to_csr(
-      row_indices, self.size(0), out_int32);
+  // When `self` was already coalesced, `coalesced_self` shares its impl, so
+  // the row pointers computed here survive across repeated conversions of the
+  // same tensor (e.g. an adjacency matrix multiplied every step). The cache is
+  // invalidated by SparseTensorImpl whenever its indices or shape change.
+  auto* self_impl = at::sparse::get_sparse_impl(coalesced_self);
+  auto crow_indices = self_impl->cached_crow_indices();
+  if (!crow_indices.defined()) {
+    auto row_indices = coalesced_self.indices()[0];
+    bool out_int32 = (row_indices.scalar_type() == at::kInt);
+    crow_indices = at::_convert_indices_from_coo_to_csr(
+        row_indices, self.size(0), out_int32);
+    self_impl->set_cached_crow_indices(crow_indices);
+  }
+  // Hand out a copy of the row pointers: the returned CSR tensor is
+  // writable, and an in-place write through it must not corrupt the cache
+  // that later conversions of `self` will read.
   return at::native::_sparse_csr_tensor_unsafe(
-      crow_indices,
+      crow_indices.clone(),
       coalesced_self.indices()[1].contiguous(),
       coalesced_self.values(),
       coalesced_self.sizes(),
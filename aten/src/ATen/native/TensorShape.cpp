@@ -348,6 +348,7 @@ TORCH_PRECOMPUTE_META_FUNC(cat)(const ITensorListRef& tensors, int64_t dim) {
 namespace native {
 
 DEFINE_DISPATCH(cat_serial_stub);
+DEFINE_DISPATCH(cat_contig_stub);
 DEFINE_DISPATCH(stack_serial_stub);
 
 Tensor _reshape_from_tensor(const Tensor& self, const Tensor& shape_tensor) {
@@ -571,6 +572,16 @@ TORCH_IMPL_FUNC(cat_out_cpu)
     return;
   }
 
+  // Contiguous same-dtype cat is a batch of independent segment memcpys; the
+  // segment kernel parallelizes across them and avoids building a
+  // TensorIterator per input, which dominates when many small tensors are
+  // concatenated.
+  if (all_contiguous && all_same_dtype &&
+      memory_format == MemoryFormat::Contiguous && result.is_contiguous()) {
+    cat_contig_stub(kCPU, result, materialized, dim);
+    return;
+  }
+
   int64_t offset = 0;
   if (all_same_sizes_and_stride && result.is_contiguous(memory_format) &&
       all_same_dtype) {
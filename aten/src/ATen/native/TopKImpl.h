@@ -1,6 +1,7 @@
 #pragma once
 #include <ATen/core/TensorAccessor.h>
 #include <ATen/NumericUtils.h>
+#include <ATen/cpu/vec/vec.h>
 
 namespace at {
 namespace native {
@@ -11,6 +12,100 @@ inline namespace CPU_CAPABILITY {
 inline namespace DEFAULT {
 #endif
 
+// Comparators matching the partial_sort lambdas below; nan sorts as the
+// largest value for numpy compatibility. Shared with the chunk merge in
+// topk_kernel.
+template <typename accscalar_t>
+inline bool topk_greater(
+    const std::pair<accscalar_t, int64_t>& x,
+    const std::pair<accscalar_t, int64_t>& y) {
+  return (_isnan<accscalar_t>(x.first) && !_isnan<accscalar_t>(y.first)) ||
+      (x.first > y.first);
+}
+
+template <typename accscalar_t>
+inline bool topk_less(
+    const std::pair<accscalar_t, int64_t>& x,
+    const std::pair<accscalar_t, int64_t>& y) {
+  return (!_isnan<accscalar_t>(x.first) && _isnan<accscalar_t>(y.first)) ||
+      (x.first < y.first);
+}
+
+// Small-k scan over a contiguous slice. Keeps the current top-k in a sorted
+// candidate buffer and only touches it when an element beats the running
+// threshold (the k-th best seen so far). The threshold test runs a vector at
+// a time where zero_mask() is cheap (float/double); for k << n almost every
+// block fails it and is skipped with no scalar work. `index_offset` is added
+// to the stored indices so chunked callers can scan sub-ranges.
+// `queue` must hold k elements and is left sorted.
+template <typename scalar_t, bool largest>
+void topk_threshold_scan(
+    const scalar_t* data,
+    const int64_t n,
+    const int64_t k,
+    const int64_t index_offset,
+    std::pair<scalar_t, int64_t>* queue) {
+  using elem_t = std::pair<scalar_t, int64_t>;
+  const auto comp = [](const elem_t& x, const elem_t& y) -> bool {
+    return largest ? topk_greater<scalar_t>(x, y) : topk_less<scalar_t>(x, y);
+  };
+  for (const auto j : c10::irange(k)) {
+    queue[j] = elem_t(data[j], index_offset + j);
+  }
+  std::sort(queue, queue + k, comp);
+  scalar_t thresh = queue[k - 1].first;
+
+  const auto insert = [&](scalar_t v, int64_t idx) {
+    elem_t e(v, idx);
+    int64_t pos = k - 1;
+    while (pos > 0 && comp(e, queue[pos - 1])) {
+      queue[pos] = queue[pos - 1];
+      pos--;
+    }
+    queue[pos] = e;
+    thresh = queue[k - 1].first;
+  };
+  // comp(e, queue[k - 1]) spelled out on a raw value, so the vectorized
+  // filter below can reuse the cheap half of the test.
+  const auto is_candidate = [&](scalar_t v) -> bool {
+    if (largest) {
+      return v > thresh || (_isnan<scalar_t>(v) && !_isnan<scalar_t>(thresh));
+    } else {
+      return v < thresh || (!_isnan<scalar_t>(v) && _isnan<scalar_t>(thresh));
+    }
+  };
+
+  int64_t j = k;
+  if constexpr (
+      std::is_same<scalar_t, float>::value ||
+      std::is_same<scalar_t, double>::value) {
+    using Vec = vec::Vectorized<scalar_t>;
+    constexpr int64_t kVecSize = Vec::size();
+    for (; j + kVecSize <= n; j += kVecSize) {
+      const Vec v = Vec::loadu(data + j);
+      // Superset of is_candidate: lanes passing here are re-checked in
+      // scalar code, so a nan threshold only costs false positives.
+      const Vec pass = largest ? (v > Vec(thresh)) : (v < Vec(thresh));
+      const Vec maybe = pass | v.isnan();
+      if (maybe.zero_mask() == (1 << kVecSize) - 1) {
+        continue;
+      }
+      for (const auto lane : c10::irange(kVecSize)) {
+        const scalar_t val = data[j + lane];
+        if (is_candidate(val)) {
+          insert(val, index_offset + j + lane);
+        }
+      }
+    }
+  }
+  for (; j < n; j++) {
+    const scalar_t val = data[j];
+    if (is_candidate(val)) {
+      insert(val, index_offset + j);
+    }
+  }
+}
+
 // Core topk loop, shared between CPU and QuantizedCPU
 template <typename scalar_t, typename accscalar_t>
 void topk_impl_loop(
@@ -39,6 +134,28 @@ void topk_impl_loop(
     auto n = dim_size;
     auto use_partial_sort = k * 64 <= n;
 
+    // Small k over a contiguous slice: scan with a running threshold instead
+    // of materializing all n (value, index) pairs and partial_sort-ing them.
+    // Restricted to scalar_t == accscalar_t so the slice can be read in place.
+    if constexpr (std::is_same<scalar_t, accscalar_t>::value) {
+      if (use_partial_sort && k <= 256 && tmp_values_stride == 1) {
+        const scalar_t* slice =
+            reinterpret_cast<const scalar_t*>(data[2] + i * strides[2]);
+        if (largest) {
+          topk_threshold_scan<scalar_t, /*largest=*/true>(
+              slice, n, k, /*index_offset=*/0, queue.data());
+        } else {
+          topk_threshold_scan<scalar_t, /*largest=*/false>(
+              slice, n, k, /*index_offset=*/0, queue.data());
+        }
+        for (const auto j : c10::irange(k)) {
+          mode_values[j] = queue[j].first;
+          mode_indices[j] = queue[j].second;
+        }
+        continue;
+      }
+    }
+
     for (const auto j : c10::irange(n)) {
       queue[j].first = tmp_values[j];
       queue[j].second = j;
@@ -3,6 +3,8 @@
 
 #include <ATen/core/Tensor.h>
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <c10/util/flat_hash_map.h>
 #include <c10/util/irange.h>
 #include <c10/util/Load.h>
 
@@ -89,12 +91,147 @@ Tensor unique_elements(const bool* begin, const bool* end,
   return output;
 }
 
+// Hash-based unique for non-bool types. The input is split into chunks that
+// are deduplicated in parallel with per-chunk flat_hash_maps assigning dense
+// local ids, then a serial merge phase builds the global id space plus a
+// local->global relabel table per chunk. With return_inverse the local id is
+// parked in the inverse tensor during the first pass and relabeled in place
+// at the end, so the input is hashed exactly once no matter which outputs
+// are requested.
+template <typename scalar_t>
+std::tuple<Tensor, Tensor, Tensor> unique_cpu_hash_template(
+    const Tensor& self,
+    const bool sorted,
+    const bool return_inverse,
+    const bool return_counts) {
+  const Tensor& input = self.contiguous();
+  const scalar_t* input_data = input.data_ptr<scalar_t>();
+  const int64_t numel = input.numel();
+  Tensor inverse_indices = at::empty({0}, self.options().dtype(kLong));
+  Tensor counts = at::empty({0}, self.options().dtype(kLong));
+
+  int64_t* inverse_data = nullptr;
+  if (return_inverse) {
+    inverse_indices.resize_(input.sizes());
+    inverse_data = inverse_indices.data_ptr<int64_t>();
+  }
+
+  const int64_t num_chunks = std::max<int64_t>(
+      1,
+      std::min<int64_t>(
+          static_cast<int64_t>(at::get_num_threads()),
+          numel / at::internal::GRAIN_SIZE));
+  std::vector<ska::flat_hash_map<scalar_t, int64_t>> chunk_maps(num_chunks);
+  std::vector<std::vector<int64_t>> chunk_counts(num_chunks);
+
+  at::parallel_for(0, num_chunks, 1, [&](int64_t chunks_begin, int64_t chunks_end) {
+    for (const auto c : c10::irange(chunks_begin, chunks_end)) {
+      auto& map = chunk_maps[c];
+      auto& local_counts = chunk_counts[c];
+      const int64_t begin = numel * c / num_chunks;
+      const int64_t end = numel * (c + 1) / num_chunks;
+      for (const auto i : c10::irange(begin, end)) {
+        const auto val = c10::load(&input_data[i]);
+        const auto res = map.emplace(val, static_cast<int64_t>(map.size()));
+        if (return_counts) {
+          if (res.second) {
+            local_counts.push_back(0);
+          }
+          local_counts[res.first->second]++;
+        }
+        if (return_inverse) {
+          inverse_data[i] = res.first->second;
+        }
+      }
+    }
+  });
+
+  ska::flat_hash_map<scalar_t, int64_t> global_map;
+  std::vector<scalar_t> unique_vals;
+  std::vector<int64_t> global_counts;
+  std::vector<std::vector<int64_t>> relabel(num_chunks);
+  for (const auto c : c10::irange(num_chunks)) {
+    relabel[c].resize(chunk_maps[c].size());
+    for (const auto& kv : chunk_maps[c]) {
+      const auto res = global_map.emplace(
+          kv.first, static_cast<int64_t>(unique_vals.size()));
+      if (res.second) {
+        unique_vals.push_back(kv.first);
+        if (return_counts) {
+          global_counts.push_back(0);
+        }
+      }
+      relabel[c][kv.second] = res.first->second;
+      if (return_counts) {
+        global_counts[res.first->second] += chunk_counts[c][kv.second];
+      }
+    }
+    chunk_maps[c] = {};
+  }
+
+  const int64_t num_unique = static_cast<int64_t>(unique_vals.size());
+  if (sorted && num_unique > 0) {
+    std::vector<int64_t> order(num_unique);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int64_t a, int64_t b) {
+      return unique_vals[a] < unique_vals[b];
+    });
+    std::vector<scalar_t> sorted_vals(num_unique);
+    std::vector<int64_t> new_of_old(num_unique);
+    std::vector<int64_t> sorted_counts(return_counts ? num_unique : 0);
+    for (const auto j : c10::irange(num_unique)) {
+      sorted_vals[j] = unique_vals[order[j]];
+      new_of_old[order[j]] = j;
+      if (return_counts) {
+        sorted_counts[j] = global_counts[order[j]];
+      }
+    }
+    unique_vals = std::move(sorted_vals);
+    if (return_counts) {
+      global_counts = std::move(sorted_counts);
+    }
+    for (auto& table : relabel) {
+      for (auto& id : table) {
+        id = new_of_old[id];
+      }
+    }
+  }
+
+  Tensor output = at::empty({num_unique}, input.options());
+  std::copy(
+      unique_vals.begin(), unique_vals.end(), output.data_ptr<scalar_t>());
+  if (return_inverse) {
+    at::parallel_for(0, num_chunks, 1, [&](int64_t chunks_begin, int64_t chunks_end) {
+      for (const auto c : c10::irange(chunks_begin, chunks_end)) {
+        const auto& table = relabel[c];
+        const int64_t begin = numel * c / num_chunks;
+        const int64_t end = numel * (c + 1) / num_chunks;
+        for (const auto i : c10::irange(begin, end)) {
+          inverse_data[i] = table[inverse_data[i]];
+        }
+      }
+    });
+  }
+  if (return_counts) {
+    counts.resize_({num_unique});
+    std::copy(
+        global_counts.begin(), global_counts.end(), counts.data_ptr<int64_t>());
+  }
+  return std::make_tuple(output, inverse_indices, counts);
+}
+
 template <typename scalar_t>
 std::tuple<Tensor, Tensor, Tensor> unique_cpu_template(
     const Tensor& self,
     const bool sorted,
     const bool return_inverse,
     const bool return_counts) {
+  // bool keeps the dedicated two-value path below; see the bool overload of
+  // unique_elements for why it cannot go through a hash table.
+  if constexpr (!std::is_same<scalar_t, bool>::value) {
+    return unique_cpu_hash_template<scalar_t>(
+        self, sorted, return_inverse, return_counts);
+  }
   const Tensor& input = self.contiguous();
   const scalar_t* input_data = input.data_ptr<scalar_t>();
   int64_t numel = input.numel();
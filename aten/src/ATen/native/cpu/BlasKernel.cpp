@@ -1,5 +1,7 @@
 #define TORCH_ASSERT_NO_OPERATORS
 #include <ATen/Dispatch.h>
+#include <ATen/cpu/vec/functional.h>
+#include <ATen/cpu/vec/vec.h>
 #include <ATen/native/CPUBlas.h>
 #include <c10/util/irange.h>
 #include <c10/util/Unroll.h>
@@ -111,6 +113,63 @@ void gemm_transa_(
   }
 }
 
+// Vectorized bf16 dot product with fp32 accumulation.  This TU is compiled
+// once per CPU_CAPABILITY, so on AVX-512 builds the convert+FMA below runs on
+// full 16-lane float vectors; without vector support it degrades to the
+// scalar convert loop that used to be the only bf16 path.
+float bf16_dot_with_fp32_arith(
+    const c10::BFloat16* a,
+    const c10::BFloat16* b,
+    int64_t len) {
+  using bVec = vec::Vectorized<c10::BFloat16>;
+  using fVec = vec::Vectorized<float>;
+  fVec sum0{0.f};
+  fVec sum1{0.f};
+  int64_t i = 0;
+  for (; i + bVec::size() <= len; i += bVec::size()) {
+    bVec a_vec = bVec::loadu(a + i);
+    bVec b_vec = bVec::loadu(b + i);
+    fVec a0, a1, b0, b1;
+    std::tie(a0, a1) = vec::convert_bfloat16_float(a_vec);
+    std::tie(b0, b1) = vec::convert_bfloat16_float(b_vec);
+    sum0 = vec::fmadd(a0, b0, sum0);
+    sum1 = vec::fmadd(a1, b1, sum1);
+  }
+  float sum = vec::vec_reduce_all<float>(
+      [](fVec& x, fVec& y) { return x + y; }, sum0 + sum1);
+  for (; i < len; ++i) {
+    sum += static_cast<float>(a[i]) * static_cast<float>(b[i]);
+  }
+  return sum;
+}
+
+// bf16 a.T @ b: both dot operands are contiguous, which is also the layout
+// addmv/gemv lowers to, so this covers the bf16 matmul shapes that matter
+// when MKL is not handling them.
+void gemm_transa_(
+    int64_t m, int64_t n, int64_t k,
+    float alpha,
+    const c10::BFloat16 *a, int64_t lda,
+    const c10::BFloat16 *b, int64_t ldb,
+    float beta,
+    c10::BFloat16 *c, int64_t ldc) {
+  // c = alpha * (a.T @ b) + beta * c
+  const c10::BFloat16* a_ = a;
+  for (const auto i : c10::irange(m)) {
+    const c10::BFloat16* b_ = b;
+    for (const auto j : c10::irange(n)) {
+      const auto dot = bf16_dot_with_fp32_arith(a_, b_, k);
+      b_ += ldb;
+      if (beta == 0.f) {
+        c[j * ldc + i] = alpha * dot;
+      } else {
+        c[j * ldc + i] = beta * c[j * ldc + i] + alpha * dot;
+      }
+    }
+    a_ += lda;
+  }
+}
+
 template <typename scalar_t, typename opmath_t>
 void gemm_transb_(
     int64_t m, int64_t n, int64_t k,
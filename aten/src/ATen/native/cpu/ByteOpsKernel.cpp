@@ -0,0 +1,56 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/native/ByteOps.h>
+
+#include <ATen/cpu/vec/vec.h>
+#include <ATen/native/DispatchStub.h>
+#include <c10/util/llvmMathExtras.h>
+
+#include <cstring>
+
+namespace at {
+namespace native {
+
+namespace {
+
+// Collects the index of every byte equal to `value`. The vector loop
+// compares a full register of bytes at a time and stores the resulting
+// 0x00/0xFF mask to a small buffer, which is then scanned eight bytes at a
+// time: a whole word of zeros (the common case for sparse separators like
+// whitespace) is skipped with one compare, and hits are extracted with a
+// count-trailing-zeros per match rather than a per-byte branch.
+void collect_byte_positions_kernel(
+    const uint8_t* data,
+    int64_t n,
+    uint8_t value,
+    std::vector<int64_t>& positions) {
+  using Vec = vec::Vectorized<uint8_t>;
+  constexpr int64_t kWidth = Vec::size();
+  const Vec needle(value);
+  alignas(64) uint8_t mask[kWidth];
+
+  int64_t i = 0;
+  for (; i + kWidth <= n; i += kWidth) {
+    (Vec::loadu(data + i) == needle).store(mask);
+    for (int64_t word = 0; word < kWidth; word += 8) {
+      uint64_t bits = 0;
+      std::memcpy(&bits, mask + word, sizeof(bits));
+      while (bits != 0) {
+        const int64_t byte = c10::llvm::countTrailingZeros(bits) >> 3;
+        positions.push_back(i + word + byte);
+        bits &= ~(uint64_t(0xFF) << (byte << 3));
+      }
+    }
+  }
+  for (; i < n; ++i) {
+    if (data[i] == value) {
+      positions.push_back(i);
+    }
+  }
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(collect_byte_positions_stub, &collect_byte_positions_kernel);
+
+} // namespace native
+} // namespace at
@@ -2,11 +2,14 @@
 #include <ATen/core/Tensor.h>
 
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <ATen/native/cpu/CatKernel.h>
 #include <ATen/cpu/vec/functional.h>
 #include <ATen/cpu/vec/vec.h>
 #include <c10/util/irange.h>
 
+#include <cstring>
+
 namespace at { namespace native {
 
 namespace {
@@ -61,8 +64,54 @@ void cat_serial_kernel(const Tensor& result, const MaterializedITensorListRef& t
   });
 }
 
+// Dtype-agnostic segmented cat: with contiguous same-dtype inputs and a
+// contiguous result, the output is a sequence of outer * ninputs independent
+// contiguous segments, so the copies can be handed to memcpy and split across
+// threads without any per-element iteration machinery.
+void cat_contig_kernel(const Tensor& result, const MaterializedITensorListRef& tensors, int64_t dim) {
+  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
+      dim >= 0 && dim < result.dim(), "dim out of range in cat_contig_kernel");
+  const int64_t elem_size = static_cast<int64_t>(result.element_size());
+  const int64_t inner = result.strides()[dim];
+  const int64_t outer = result.numel() / (result.sizes()[dim] * inner);
+  const int64_t ninputs = static_cast<int64_t>(tensors.size());
+
+  std::vector<char*> input_data(ninputs, nullptr);
+  std::vector<int64_t> input_bytes(ninputs, 0);
+  // Segment start of input j within one outer row, in bytes.
+  std::vector<int64_t> segment_offset(ninputs + 1, 0);
+  for (const auto j : c10::irange(ninputs)) {
+    const Tensor& tensor = tensors[j];
+    if (tensor.numel() > 0) {
+      input_data[j] = static_cast<char*>(tensor.data_ptr());
+      input_bytes[j] = tensor.sizes()[dim] * inner * elem_size;
+    }
+    segment_offset[j + 1] = segment_offset[j] + input_bytes[j];
+  }
+  const int64_t row_bytes = segment_offset[ninputs];
+  char* result_data = static_cast<char*>(result.data_ptr());
+
+  const int64_t avg_segment_bytes = std::max<int64_t>(1, row_bytes / ninputs);
+  const int64_t grain_size = std::max<int64_t>(
+      1, internal::GRAIN_SIZE * elem_size / avg_segment_bytes);
+  at::parallel_for(0, outer * ninputs, grain_size, [&](int64_t begin, int64_t end) {
+    for (const auto s : c10::irange(begin, end)) {
+      const int64_t i = s / ninputs;
+      const int64_t j = s % ninputs;
+      if (input_bytes[j] == 0) {
+        continue;
+      }
+      std::memcpy(
+          result_data + i * row_bytes + segment_offset[j],
+          input_data[j] + i * input_bytes[j],
+          input_bytes[j]);
+    }
+  });
+}
+
 } // anonymous namespace
 
 REGISTER_DISPATCH(cat_serial_stub, &cat_serial_kernel);
+REGISTER_DISPATCH(cat_contig_stub, &cat_contig_kernel);
 
 }} // at::native
@@ -9,4 +9,10 @@ namespace at { namespace native {
 using cat_serial_fn = void(*)(const Tensor &, const MaterializedITensorListRef&, int64_t);
 DECLARE_DISPATCH(cat_serial_fn, cat_serial_stub);
 
+// Segment-based cat for contiguous same-dtype inputs into a contiguous
+// result: every (outer index, input) pair is one independent memcpy,
+// parallelized across segments. Works for any dtype.
+using cat_contig_fn = void(*)(const Tensor &, const MaterializedITensorListRef&, int64_t);
+DECLARE_DISPATCH(cat_contig_fn, cat_contig_stub);
+
 }}  // namespace at::native
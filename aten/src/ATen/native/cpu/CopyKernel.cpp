@@ -7,6 +7,13 @@
 #include <ATen/native/cpu/zmath.h>
 #include <ATen/TensorIteratorInternal.h>
 #include <ATen/Parallel.h>
+#include <ATen/core/PhiloxRNGEngine.h>
+#include <c10/util/env.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <random>
 
 namespace at {
 namespace native {
@@ -204,6 +211,145 @@ void neg_conj_kernel(TensorIteratorBase &iter) {
   });
 }
 
+// [Note: stochastic bf16 rounding]
+// bf16 master-weight training wants fp32 -> bf16 conversions that round
+// stochastically instead of to-nearest-even, so that small updates are not
+// systematically lost.  When AT_COPY_BF16_STOCHASTIC_ROUNDING is set, the
+// contiguous fp32 -> bf16 copy rounds each value down or up with probability
+// proportional to the truncated fraction: add a uniform 16-bit value from a
+// Philox stream to the fp32 bits and truncate.  NaNs keep the default
+// conversion.  AT_COPY_BF16_STOCHASTIC_ROUNDING_SEED pins the Philox seed
+// for reproducibility; otherwise it is drawn once per process.  Each loop
+// chunk gets its own Philox subsequence so parallel chunks do not share a
+// stream.
+
+bool bf16_stochastic_rounding_enabled() {
+  static const bool enabled =
+      c10::utils::check_env("AT_COPY_BF16_STOCHASTIC_ROUNDING") == true;
+  return enabled;
+}
+
+uint64_t bf16_stochastic_rounding_seed() {
+  static const uint64_t seed = []() -> uint64_t {
+    const char* env = std::getenv("AT_COPY_BF16_STOCHASTIC_ROUNDING_SEED");
+    if (env != nullptr) {
+      return static_cast<uint64_t>(std::strtoull(env, nullptr, 10));
+    }
+    return std::random_device{}();
+  }();
+  return seed;
+}
+
+void bf16_stochastic_rounding_copy_kernel(TensorIteratorBase& iter) {
+  const uint64_t seed = bf16_stochastic_rounding_seed();
+  std::atomic<uint64_t> subsequence{0};
+  auto loop = [seed, &subsequence](char** data, const int64_t* strides, int64_t size) {
+    const float* src = reinterpret_cast<const float*>(data[1]);
+    BFloat16* dst = reinterpret_cast<BFloat16*>(data[0]);
+    at::Philox4_32 engine(seed, subsequence.fetch_add(1, std::memory_order_relaxed), 0);
+    uint32_t rand_bits = 0;
+    for (int64_t i = 0; i < size; i++) {
+      uint32_t bits;
+      std::memcpy(&bits, src + i, sizeof(bits));
+      if ((bits & 0x7FFFFFFFu) > 0x7F800000u) {
+        // NaN: no rounding to do, and adding to the payload could carry
+        // into the exponent.
+        dst[i] = BFloat16(src[i]);
+        continue;
+      }
+      if ((i & 1) == 0) {
+        rand_bits = engine();
+      }
+      const uint32_t noise = (i & 1) ? (rand_bits >> 16) : (rand_bits & 0xFFFFu);
+      dst[i] = BFloat16(static_cast<uint16_t>((bits + noise) >> 16),
+                        BFloat16::from_bits());
+    }
+  };
+  iter.for_each(loop);
+}
+
+// [Note: cache-blocked transposed copy]
+// A copy produced by `.contiguous()` after a transpose/permute shows up here
+// as a 2-D TensorIterator where the output is contiguous along dim 0 and the
+// input along dim 1.  The generic loop walks such an iterator in the memory
+// order of one operand and strides through the other a full row at a time,
+// which thrashes the cache on large matrices.  Walk it in square tiles
+// instead so the working set of both operands stays L1-resident.  The copy
+// is bitwise, so only the element size matters, not the dtype.
+
+constexpr int64_t kTransposedCopyBlock = 64;
+
+struct alignas(16) TransposedCopyUnit16 {
+  uint64_t lo;
+  uint64_t hi;
+};
+
+bool try_transposed_copy(TensorIteratorBase& iter) {
+  if (iter.ndim() != 2) {
+    return false;
+  }
+  const int64_t esize = iter.element_size(0);
+  const auto strides_out = iter.strides(0);
+  const auto strides_in = iter.strides(1);
+  const int64_t size0 = iter.shape()[0];
+  const int64_t size1 = iter.shape()[1];
+  if (strides_out[0] != esize || strides_in[1] != esize ||
+      strides_in[0] == esize || size0 < kTransposedCopyBlock ||
+      size1 < kTransposedCopyBlock) {
+    return false;
+  }
+  if (esize != 1 && esize != 2 && esize != 4 && esize != 8 && esize != 16) {
+    return false;
+  }
+  char* out_base = reinterpret_cast<char*>(iter.data_ptr(0));
+  const char* in_base = reinterpret_cast<const char*>(iter.data_ptr(1));
+  const int64_t out_stride1 = strides_out[1];
+  const int64_t in_stride0 = strides_in[0];
+
+  auto copy_tiles = [&](auto unit, int64_t block_begin, int64_t block_end) {
+    using unit_t = decltype(unit);
+    for (const auto b : c10::irange(block_begin, block_end)) {
+      const int64_t j0 = b * kTransposedCopyBlock;
+      const int64_t j1 = std::min(j0 + kTransposedCopyBlock, size1);
+      for (int64_t i0 = 0; i0 < size0; i0 += kTransposedCopyBlock) {
+        const int64_t i1 = std::min(i0 + kTransposedCopyBlock, size0);
+        for (const auto j : c10::irange(j0, j1)) {
+          char* dst = out_base + j * out_stride1;
+          const char* src = in_base + j * esize;
+          for (const auto i : c10::irange(i0, i1)) {
+            *reinterpret_cast<unit_t*>(dst + i * esize) =
+                *reinterpret_cast<const unit_t*>(src + i * in_stride0);
+          }
+        }
+      }
+    }
+  };
+
+  const int64_t num_blocks = divup(size1, kTransposedCopyBlock);
+  const int64_t grain_size = std::max(
+      at::internal::GRAIN_SIZE / (kTransposedCopyBlock * size0), (int64_t)1);
+  parallel_for(0, num_blocks, grain_size, [&](int64_t begin, int64_t end) {
+    switch (esize) {
+      case 1:
+        copy_tiles(uint8_t{}, begin, end);
+        break;
+      case 2:
+        copy_tiles(uint16_t{}, begin, end);
+        break;
+      case 4:
+        copy_tiles(uint32_t{}, begin, end);
+        break;
+      case 8:
+        copy_tiles(uint64_t{}, begin, end);
+        break;
+      default:
+        copy_tiles(TransposedCopyUnit16{}, begin, end);
+        break;
+    }
+  });
+  return true;
+}
+
 void copy_same_dtype(TensorIteratorBase &iter, bool requires_conj, bool requires_neg) {
   if (requires_neg) {
     // This case should never actually happen since currently there's no way to get a complex tensor
@@ -216,7 +362,7 @@ void copy_same_dtype(TensorIteratorBase &iter, bool requires_conj, bool requires
   } else {
     if (requires_conj) {
       conj_kernel(iter);
-    } else {
+    } else if (!try_transposed_copy(iter)) {
       direct_copy_kernel(iter);
     }
   }
@@ -232,6 +378,10 @@ void copy_kernel(TensorIterator& iter, bool /*non_blocking*/) {
   auto strides_in = iter.strides(1);
   if (dtype == iter.dtype(1)) {
     copy_same_dtype(iter, requires_conj, requires_neg);
+  } else if (!requires_conj && !requires_neg && bf16_stochastic_rounding_enabled() &&
+    iter.dtype(0) == kBFloat16 && iter.dtype(1) == kFloat &&
+    sizeof(BFloat16) == strides_out[0] && sizeof(float) == strides_in[0]) {
+    bf16_stochastic_rounding_copy_kernel(iter);
   } else if (!requires_conj && ((iter.dtype(1) == kBFloat16 && iter.dtype(0) == kFloat &&
      sizeof(float) == strides_out[0] && (sizeof(BFloat16) == strides_in[0] || strides_in[0] == 0)) ||
     (iter.dtype(1) == kFloat && iter.dtype(0) == kBFloat16 &&
@@ -250,6 +400,18 @@ void copy_kernel(TensorIterator& iter, bool /*non_blocking*/) {
             auto dst = reinterpret_cast<dest_t*>(data[0]);
             at::vec::convert(src, dst, size);
           });
+        } else if (sizeof(dest_t) == strides_out[0] && strides_in[0] == 0) {
+          // Broadcasting copy into a contiguous output: convert the source
+          // element once per inner loop and fill, instead of re-running the
+          // conversion per element in cpu_kernel.
+          iter.for_each([](char **data, const int64_t *strides, int64_t size) {
+            const auto value =
+                c10::convert<dest_t>(*reinterpret_cast<const scalar_t*>(data[1]));
+            auto dst = reinterpret_cast<dest_t*>(data[0]);
+            for (int64_t i = 0; i < size; i++) {
+              dst[i] = value;
+            }
+          });
         } else {
           cpu_kernel(iter, [](scalar_t x) -> dest_t {
             return c10::convert<dest_t>(x);
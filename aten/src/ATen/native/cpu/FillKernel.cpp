@@ -36,6 +36,26 @@ void fill_non_native_type<c10::complex<at::Half>>(TensorIterator& iter, const Sc
       [val]() { return Vectorized<int32_t>(val); });
 }
 
+// Direct entry for a (dtype, contiguous) combination: no dtype switch and
+// no TensorIterator loop machinery, just a vector fill over the flat output.
+// See Note [Specialized dispatch entries] in DispatchStub.h.
+template <typename scalar_t>
+void fill_contiguous_kernel(TensorIterator& iter, const Scalar& value_scalar) {
+  using Vec = Vectorized<scalar_t>;
+  const scalar_t value = value_scalar.to<scalar_t>();
+  scalar_t* out = static_cast<scalar_t*>(iter.data_ptr(0));
+  at::parallel_for(0, iter.numel(), at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    const Vec vec(value);
+    int64_t i = begin;
+    for (; i + Vec::size() <= end; i += Vec::size()) {
+      vec.store(out + i);
+    }
+    for (; i < end; ++i) {
+      out[i] = value;
+    }
+  });
+}
+
 void fill_kernel(TensorIterator& iter, const Scalar& value_scalar) {
   if (iter.dtype() == ScalarType::Half) {
     fill_non_native_type<at::Half>(iter, value_scalar);
@@ -57,6 +77,8 @@ void fill_kernel(TensorIterator& iter, const Scalar& value_scalar) {
 } // namespace
 
 REGISTER_DISPATCH(fill_stub, &fill_kernel);
+REGISTER_SPECIALIZED_DISPATCH(fill_specialized, ScalarType::Float, /*contiguous=*/true, &fill_contiguous_kernel<float>);
+REGISTER_SPECIALIZED_DISPATCH(fill_specialized, ScalarType::Long, /*contiguous=*/true, &fill_contiguous_kernel<int64_t>);
 
 } // namespace native
 } // namespace at
@@ -0,0 +1,216 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/native/transformers/attention.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/cpu/vec/functional.h>
+#include <ATen/cpu/vec/vec.h>
+#include <ATen/native/CPUBlas.h>
+#include <c10/util/irange.h>
+
+namespace at { namespace native {
+namespace {
+
+// Tiled attention, following the flash attention recurrence: the key/value
+// sequence is visited in blocks, and for every query row we carry a running
+// max and running sum so that softmax normalization can be applied at the
+// end without ever holding more than one qSplit x kvSplit score tile. The
+// QK^T and (softmax tile)V products go through cpublas so each tile still
+// runs on the blocked GEMM kernels; only the softmax bookkeeping is done
+// here, vectorized over the tile rows.
+constexpr int64_t kQuerySplitSize = 32;
+constexpr int64_t kKeyValueSplitSize = 512;
+
+template <typename scalar_t>
+void flash_attention_impl(
+    const Tensor& output,
+    const Tensor& query,
+    const Tensor& key,
+    const Tensor& value,
+    bool is_causal) {
+  using Vec = vec::Vectorized<scalar_t>;
+
+  const int64_t batch = query.size(0);
+  const int64_t num_head = query.size(1);
+  const int64_t q_len = query.size(2);
+  const int64_t kv_len = key.size(2);
+  const int64_t head_size = query.size(3);
+
+  const scalar_t* q_data = query.data_ptr<scalar_t>();
+  const scalar_t* k_data = key.data_ptr<scalar_t>();
+  const scalar_t* v_data = value.data_ptr<scalar_t>();
+  scalar_t* out_data = output.data_ptr<scalar_t>();
+
+  // Rows of the last dim are contiguous (the op guarantees it); everything
+  // else is strided so narrowed KV-cache views can be read in place.
+  const int64_t q_stride_b = query.stride(0);
+  const int64_t q_stride_h = query.stride(1);
+  const int64_t q_stride_s = query.stride(2);
+  const int64_t k_stride_b = key.stride(0);
+  const int64_t k_stride_h = key.stride(1);
+  const int64_t k_stride_s = key.stride(2);
+  const int64_t v_stride_b = value.stride(0);
+  const int64_t v_stride_h = value.stride(1);
+  const int64_t v_stride_s = value.stride(2);
+
+  const auto scale =
+      static_cast<scalar_t>(1.0 / std::sqrt(static_cast<double>(head_size)));
+
+  const int64_t num_q_blocks = divup(q_len, kQuerySplitSize);
+
+  at::parallel_for(
+      0, batch * num_head * num_q_blocks, 1, [&](int64_t begin, int64_t end) {
+        // One score tile plus per-row softmax state per task; this is the
+        // entire working set, independent of the sequence length.
+        std::vector<scalar_t> qk(kQuerySplitSize * kKeyValueSplitSize);
+        std::vector<scalar_t> row_max(kQuerySplitSize);
+        std::vector<scalar_t> row_sum(kQuerySplitSize);
+
+        for (const auto task : c10::irange(begin, end)) {
+          const int64_t qb = task % num_q_blocks;
+          const int64_t bh = task / num_q_blocks;
+          const int64_t b = bh / num_head;
+          const int64_t h = bh % num_head;
+
+          const int64_t q_start = qb * kQuerySplitSize;
+          const int64_t q_block = std::min(kQuerySplitSize, q_len - q_start);
+
+          const scalar_t* q_block_data =
+              q_data + b * q_stride_b + h * q_stride_h + q_start * q_stride_s;
+          // The output is always freshly allocated contiguous.
+          scalar_t* out_block_data =
+              out_data + (bh * q_len + q_start) * head_size;
+
+          std::fill_n(
+              row_max.begin(),
+              q_block,
+              -std::numeric_limits<scalar_t>::infinity());
+          std::fill_n(row_sum.begin(), q_block, static_cast<scalar_t>(0));
+
+          // Causal rows only attend to keys at or before their own index, so
+          // later key blocks can be skipped outright.
+          const int64_t kv_limit = is_causal
+              ? std::min(kv_len, q_start + q_block)
+              : kv_len;
+
+          for (int64_t kv_start = 0; kv_start < kv_limit;
+               kv_start += kKeyValueSplitSize) {
+            const int64_t kv_block =
+                std::min(kKeyValueSplitSize, kv_limit - kv_start);
+            const scalar_t* k_block_data =
+                k_data + b * k_stride_b + h * k_stride_h + kv_start * k_stride_s;
+            const scalar_t* v_block_data =
+                v_data + b * v_stride_b + h * v_stride_h + kv_start * v_stride_s;
+
+            // qk[i][j] = scale * q[i] . k[j], row-major q_block x kv_block.
+            cpublas::gemm(
+                TransposeType::Transpose,
+                TransposeType::NoTranspose,
+                kv_block,
+                q_block,
+                head_size,
+                scale,
+                k_block_data,
+                k_stride_s,
+                q_block_data,
+                q_stride_s,
+                static_cast<scalar_t>(0),
+                qk.data(),
+                kv_block);
+
+            if (is_causal && kv_start + kv_block > q_start) {
+              // Tile overlaps the diagonal: mask out keys beyond each row.
+              for (const auto i : c10::irange(q_block)) {
+                scalar_t* row = qk.data() + i * kv_block;
+                const int64_t first_masked =
+                    std::max(int64_t{0}, q_start + i - kv_start + 1);
+                for (int64_t j = first_masked; j < kv_block; j++) {
+                  row[j] = -std::numeric_limits<scalar_t>::infinity();
+                }
+              }
+            }
+
+            const bool first = kv_start == 0;
+            for (const auto i : c10::irange(q_block)) {
+              scalar_t* row = qk.data() + i * kv_block;
+              const scalar_t tile_max = vec::reduce_all<scalar_t>(
+                  [](Vec& x, Vec& y) { return vec::maximum(x, y); },
+                  row,
+                  kv_block);
+              const scalar_t new_max = std::max(row_max[i], tile_max);
+              vec::map(
+                  [new_max](Vec x) { return (x - Vec(new_max)).exp(); },
+                  row,
+                  row,
+                  kv_block);
+              const scalar_t tile_sum = vec::reduce_all<scalar_t>(
+                  [](Vec& x, Vec& y) { return x + y; }, row, kv_block);
+              if (first) {
+                row_sum[i] = tile_sum;
+              } else {
+                // Rescale what has accumulated so far to the new max.
+                const scalar_t correction = std::exp(row_max[i] - new_max);
+                row_sum[i] = row_sum[i] * correction + tile_sum;
+                scalar_t* out_row = out_block_data + i * head_size;
+                vec::map(
+                    [correction](Vec x) { return x * Vec(correction); },
+                    out_row,
+                    out_row,
+                    head_size);
+              }
+              row_max[i] = new_max;
+            }
+
+            // out += exp(qk - max) @ v; the first tile overwrites since the
+            // output buffer starts uninitialized.
+            cpublas::gemm(
+                TransposeType::NoTranspose,
+                TransposeType::NoTranspose,
+                head_size,
+                q_block,
+                kv_block,
+                static_cast<scalar_t>(1),
+                v_block_data,
+                v_stride_s,
+                qk.data(),
+                kv_block,
+                static_cast<scalar_t>(first ? 0 : 1),
+                out_block_data,
+                head_size);
+          }
+
+          for (const auto i : c10::irange(q_block)) {
+            const scalar_t inv_sum = static_cast<scalar_t>(1) / row_sum[i];
+            scalar_t* out_row = out_block_data + i * head_size;
+            vec::map(
+                [inv_sum](Vec x) { return x * Vec(inv_sum); },
+                out_row,
+                out_row,
+                head_size);
+          }
+        }
+      });
+}
+
+void flash_attention_kernel_impl(
+    const Tensor& output,
+    const Tensor& query,
+    const Tensor& key,
+    const Tensor& value,
+    bool is_causal) {
+  AT_DISPATCH_FLOATING_TYPES(
+      query.scalar_type(), "flash_attention_kernel", [&] {
+        flash_attention_impl<scalar_t>(output, query, key, value, is_causal);
+      });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(flash_attention_kernel, &flash_attention_kernel_impl);
+
+}} // namespace at::native
@@ -0,0 +1,272 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec/functional.h>
+#include <ATen/cpu/vec/vec.h>
+#include <ATen/native/FusedAdam.h>
+#include <c10/util/irange.h>
+
+#include <cmath>
+
+namespace at { namespace native {
+
+namespace {
+
+// The update math mirrors adam_math in cuda/fused_adam_utils.cuh. Gradients
+// are written back only when grad_scale_ptr != nullptr; see
+// [note: Conditional Gradient Store when `optimizer.step` is called by
+// GradScaler] there.
+template <typename scalar_t>
+void adam_math(
+    scalar_t* param_ptr,
+    scalar_t* grad_ptr,
+    scalar_t* exp_avg_ptr,
+    scalar_t* exp_avg_sq_ptr,
+    scalar_t* max_exp_avg_sq_ptr,
+    int64_t size,
+    const double lr,
+    const double beta1,
+    const double beta2,
+    const double weight_decay,
+    const double eps,
+    const bool amsgrad,
+    const bool maximize,
+    const float* grad_scale_ptr,
+    const double step) {
+  using Vec = at::vec::Vectorized<scalar_t>;
+  const scalar_t bias_correction1 = 1 - std::pow(beta1, step);
+  const scalar_t bias_correction2 = 1 - std::pow(beta2, step);
+  const scalar_t step_size = lr / bias_correction1;
+  const scalar_t bias_correction2_sqrt = std::sqrt(bias_correction2);
+
+  int64_t d = 0;
+  for (; d + Vec::size() <= size; d += Vec::size()) {
+    Vec param = Vec::loadu(param_ptr + d);
+    Vec grad = Vec::loadu(grad_ptr + d);
+    if (grad_scale_ptr) {
+      grad = grad / Vec(scalar_t(*grad_scale_ptr));
+      grad.store(grad_ptr + d);
+    }
+    if (maximize) {
+      grad = grad.neg();
+    }
+    if (weight_decay != 0) {
+      grad = grad + param * Vec(scalar_t(weight_decay));
+    }
+    Vec exp_avg = Vec::loadu(exp_avg_ptr + d) * Vec(scalar_t(beta1)) +
+        grad * Vec(scalar_t(1 - beta1));
+    Vec exp_avg_sq = Vec::loadu(exp_avg_sq_ptr + d) * Vec(scalar_t(beta2)) +
+        grad * grad * Vec(scalar_t(1 - beta2));
+    Vec denom;
+    if (amsgrad) {
+      Vec max_exp_avg_sq =
+          at::vec::maximum(Vec::loadu(max_exp_avg_sq_ptr + d), exp_avg_sq);
+      max_exp_avg_sq.store(max_exp_avg_sq_ptr + d);
+      denom = max_exp_avg_sq.sqrt() / Vec(bias_correction2_sqrt) + Vec(scalar_t(eps));
+    } else {
+      denom = exp_avg_sq.sqrt() / Vec(bias_correction2_sqrt) + Vec(scalar_t(eps));
+    }
+    param = param - Vec(step_size) * exp_avg / denom;
+    param.store(param_ptr + d);
+    exp_avg.store(exp_avg_ptr + d);
+    exp_avg_sq.store(exp_avg_sq_ptr + d);
+  }
+  for (; d < size; d++) {
+    scalar_t param = param_ptr[d];
+    scalar_t grad = grad_ptr[d];
+    if (grad_scale_ptr) {
+      grad = grad / scalar_t(*grad_scale_ptr);
+      grad_ptr[d] = grad;
+    }
+    if (maximize) {
+      grad = -grad;
+    }
+    if (weight_decay != 0) {
+      grad += param * scalar_t(weight_decay);
+    }
+    scalar_t exp_avg =
+        exp_avg_ptr[d] * scalar_t(beta1) + grad * scalar_t(1 - beta1);
+    scalar_t exp_avg_sq =
+        exp_avg_sq_ptr[d] * scalar_t(beta2) + grad * grad * scalar_t(1 - beta2);
+    scalar_t denom;
+    if (amsgrad) {
+      scalar_t max_exp_avg_sq = std::max(max_exp_avg_sq_ptr[d], exp_avg_sq);
+      max_exp_avg_sq_ptr[d] = max_exp_avg_sq;
+      denom = std::sqrt(max_exp_avg_sq) / bias_correction2_sqrt + scalar_t(eps);
+    } else {
+      denom = std::sqrt(exp_avg_sq) / bias_correction2_sqrt + scalar_t(eps);
+    }
+    param_ptr[d] = param - step_size * exp_avg / denom;
+    exp_avg_ptr[d] = exp_avg;
+    exp_avg_sq_ptr[d] = exp_avg_sq;
+  }
+}
+
+// BFloat16 parameters are updated with float math, so a separate fp32 master
+// copy of the weights is unnecessary: the rounding behavior matches keeping
+// master weights and casting down once per step.
+template <>
+void adam_math<BFloat16>(
+    BFloat16* param_ptr,
+    BFloat16* grad_ptr,
+    BFloat16* exp_avg_ptr,
+    BFloat16* exp_avg_sq_ptr,
+    BFloat16* max_exp_avg_sq_ptr,
+    int64_t size,
+    const double lr,
+    const double beta1,
+    const double beta2,
+    const double weight_decay,
+    const double eps,
+    const bool amsgrad,
+    const bool maximize,
+    const float* grad_scale_ptr,
+    const double step) {
+  using bVec = at::vec::Vectorized<BFloat16>;
+  using fVec = at::vec::Vectorized<float>;
+  const float bias_correction1 = 1 - std::pow(beta1, step);
+  const float bias_correction2 = 1 - std::pow(beta2, step);
+  const float step_size = lr / bias_correction1;
+  const float bias_correction2_sqrt = std::sqrt(bias_correction2);
+
+  // Updates one half of a bf16 vector in float precision.
+  auto update = [&](fVec param, fVec grad, fVec exp_avg, fVec exp_avg_sq,
+                    fVec max_exp_avg_sq) {
+    if (maximize) {
+      grad = grad.neg();
+    }
+    if (weight_decay != 0) {
+      grad = grad + param * fVec(float(weight_decay));
+    }
+    exp_avg = exp_avg * fVec(beta1) + grad * fVec(float(1 - beta1));
+    exp_avg_sq = exp_avg_sq * fVec(beta2) + grad * grad * fVec(float(1 - beta2));
+    fVec denom;
+    if (amsgrad) {
+      max_exp_avg_sq = at::vec::maximum(max_exp_avg_sq, exp_avg_sq);
+      denom = max_exp_avg_sq.sqrt() / fVec(bias_correction2_sqrt) + fVec(float(eps));
+    } else {
+      denom = exp_avg_sq.sqrt() / fVec(bias_correction2_sqrt) + fVec(float(eps));
+    }
+    param = param - fVec(step_size) * exp_avg / denom;
+    return std::make_tuple(param, exp_avg, exp_avg_sq, max_exp_avg_sq);
+  };
+
+  int64_t d = 0;
+  for (; d + bVec::size() <= size; d += bVec::size()) {
+    fVec param0, param1, grad0, grad1, exp_avg0, exp_avg1;
+    fVec exp_avg_sq0, exp_avg_sq1;
+    fVec max0(0.f), max1(0.f);
+    std::tie(param0, param1) =
+        at::vec::convert_bfloat16_float(bVec::loadu(param_ptr + d));
+    std::tie(grad0, grad1) =
+        at::vec::convert_bfloat16_float(bVec::loadu(grad_ptr + d));
+    if (grad_scale_ptr) {
+      grad0 = grad0 / fVec(*grad_scale_ptr);
+      grad1 = grad1 / fVec(*grad_scale_ptr);
+      at::vec::convert_float_bfloat16(grad0, grad1).store(grad_ptr + d);
+    }
+    std::tie(exp_avg0, exp_avg1) =
+        at::vec::convert_bfloat16_float(bVec::loadu(exp_avg_ptr + d));
+    std::tie(exp_avg_sq0, exp_avg_sq1) =
+        at::vec::convert_bfloat16_float(bVec::loadu(exp_avg_sq_ptr + d));
+    if (amsgrad) {
+      std::tie(max0, max1) =
+          at::vec::convert_bfloat16_float(bVec::loadu(max_exp_avg_sq_ptr + d));
+    }
+    std::tie(param0, exp_avg0, exp_avg_sq0, max0) =
+        update(param0, grad0, exp_avg0, exp_avg_sq0, max0);
+    std::tie(param1, exp_avg1, exp_avg_sq1, max1) =
+        update(param1, grad1, exp_avg1, exp_avg_sq1, max1);
+    at::vec::convert_float_bfloat16(param0, param1).store(param_ptr + d);
+    at::vec::convert_float_bfloat16(exp_avg0, exp_avg1).store(exp_avg_ptr + d);
+    at::vec::convert_float_bfloat16(exp_avg_sq0, exp_avg_sq1)
+        .store(exp_avg_sq_ptr + d);
+    if (amsgrad) {
+      at::vec::convert_float_bfloat16(max0, max1).store(max_exp_avg_sq_ptr + d);
+    }
+  }
+  for (; d < size; d++) {
+    float param = float(param_ptr[d]);
+    float grad = float(grad_ptr[d]);
+    if (grad_scale_ptr) {
+      grad = grad / *grad_scale_ptr;
+      grad_ptr[d] = grad;
+    }
+    if (maximize) {
+      grad = -grad;
+    }
+    if (weight_decay != 0) {
+      grad += param * float(weight_decay);
+    }
+    float exp_avg = float(exp_avg_ptr[d]) * beta1 + grad * float(1 - beta1);
+    float exp_avg_sq =
+        float(exp_avg_sq_ptr[d]) * beta2 + grad * grad * float(1 - beta2);
+    float denom;
+    if (amsgrad) {
+      float max_exp_avg_sq = std::max(float(max_exp_avg_sq_ptr[d]), exp_avg_sq);
+      max_exp_avg_sq_ptr[d] = max_exp_avg_sq;
+      denom = std::sqrt(max_exp_avg_sq) / bias_correction2_sqrt + float(eps);
+    } else {
+      denom = std::sqrt(exp_avg_sq) / bias_correction2_sqrt + float(eps);
+    }
+    param_ptr[d] = param - step_size * exp_avg / denom;
+    exp_avg_ptr[d] = exp_avg;
+    exp_avg_sq_ptr[d] = exp_avg_sq;
+  }
+}
+
+void fused_adam_kernel(
+    const at::Tensor& param,
+    const at::Tensor& grad,
+    const at::Tensor& exp_avg,
+    const at::Tensor& exp_avg_sq,
+    const at::Tensor& max_exp_avg_sq,
+    const at::Tensor& state_step,
+    const double lr,
+    const double beta1,
+    const double beta2,
+    const double weight_decay,
+    const double eps,
+    const bool amsgrad,
+    const bool maximize,
+    const float* grad_scale_ptr) {
+  const double step = state_step.item<double>();
+  AT_DISPATCH_FLOATING_TYPES_AND(ScalarType::BFloat16,
+      param.scalar_type(), "fused_adam_kernel", [&] {
+    scalar_t* param_ptr = param.data_ptr<scalar_t>();
+    scalar_t* grad_ptr = grad.data_ptr<scalar_t>();
+    scalar_t* exp_avg_ptr = exp_avg.data_ptr<scalar_t>();
+    scalar_t* exp_avg_sq_ptr = exp_avg_sq.data_ptr<scalar_t>();
+    scalar_t* max_exp_avg_sq_ptr =
+        amsgrad ? max_exp_avg_sq.data_ptr<scalar_t>() : nullptr;
+    // The caller checked that all tensors are non-overlapping and dense with
+    // matching strides, so flat loops over the storage visit corresponding
+    // elements.
+    at::parallel_for(0, param.numel(), internal::GRAIN_SIZE,
+        [&](int64_t begin, int64_t end) {
+      adam_math(
+          param_ptr + begin,
+          grad_ptr + begin,
+          exp_avg_ptr + begin,
+          exp_avg_sq_ptr + begin,
+          amsgrad ? max_exp_avg_sq_ptr + begin : nullptr,
+          end - begin,
+          lr,
+          beta1,
+          beta2,
+          weight_decay,
+          eps,
+          amsgrad,
+          maximize,
+          grad_scale_ptr,
+          step);
+    });
+  });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(fused_adam_stub, &fused_adam_kernel);
+
+}} // namespace at::native
@@ -132,6 +132,67 @@ void histogramdd_cpu_contiguous(Tensor& hist, const TensorList& bin_edges,
     Tensor thread_histograms = at::zeros(thread_hist_sizes, hist.dtype());
     TORCH_INTERNAL_ASSERT(thread_histograms.is_contiguous());
 
+    /* Fast path for the common 1-D case (torch.histc, torch.histogram).
+     * The generic loop below pays for a TensorAccessor index and a stride
+     * lookup per element, which dominates the runtime of the simple 1-D bin
+     * update.  Here the inner loop works on raw pointers, and the grain is
+     * sized in elements so large inputs still fan out across all threads.
+     * The merge of the per-thread bins stays with the vectorized sum_out.
+     */
+    if (D == 1 && input.is_contiguous() &&
+            (!weight.has_value() || weight.value().is_contiguous())) {
+        const input_t* in_data = input.data_ptr<input_t>();
+        const input_t* wt_data =
+                weight.has_value() ? weight.value().data_ptr<input_t>() : nullptr;
+        const input_t* edges = bin_seq[0];
+        const int64_t n_edges = num_bin_edges[0];
+        const int64_t n_bins = n_edges - 1;
+        const input_t left = leftmost_edge[0];
+        const input_t right = rightmost_edge[0];
+        input_t* thread_hist_data = thread_histograms.data_ptr<input_t>();
+
+        at::parallel_for(0, N, at::internal::GRAIN_SIZE, [&](int64_t start, int64_t end) {
+            input_t* hist_local_data = thread_hist_data + n_bins * at::get_thread_num();
+
+            for (const auto i : c10::irange(start, end)) {
+                const input_t elt = in_data[i];
+
+                // Skips elements which fall outside the specified bins and NaN elements
+                if (!(elt >= left && elt <= right)) {
+                    continue;
+                }
+
+                int64_t pos = -1;
+
+                if (algorithm == BINARY_SEARCH) {
+                    pos = std::upper_bound(edges, edges + n_edges, elt) - edges - 1;
+                } else if (algorithm == LINEAR_INTERPOLATION
+                        || algorithm == LINEAR_INTERPOLATION_WITH_LOCAL_SEARCH) {
+                    pos = static_cast<int64_t>((elt - left) * n_bins / (right - left));
+
+                    if (algorithm == LINEAR_INTERPOLATION_WITH_LOCAL_SEARCH) {
+                        int64_t pos_min = std::max(static_cast<int64_t>(0), pos - 1);
+                        int64_t pos_max = std::min(pos + 2, n_edges);
+                        pos = std::upper_bound(edges + pos_min, edges + pos_max, elt)
+                                - edges - 1;
+                    }
+                } else {
+                    TORCH_INTERNAL_ASSERT(false);
+                }
+
+                // Unlike other bins, the rightmost bin includes its right boundary
+                if (pos == n_bins) {
+                    pos -= 1;
+                }
+
+                hist_local_data[pos] += wt_data ? wt_data[i] : static_cast<input_t>(1);
+            }
+        });
+
+        at::sum_out(hist, thread_histograms, /*dim=*/{0});
+        return;
+    }
+
     at::parallel_for(0, N, GRAIN_SIZE, [&](int64_t start, int64_t end) {
         const auto tid = at::get_thread_num();
         auto hist_strides = thread_histograms.strides();
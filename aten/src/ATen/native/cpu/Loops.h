@@ -335,6 +335,34 @@ void cpu_kernel_multiple_outputs(TensorIteratorBase& iter, func_t&& op, int64_t
   iter.cast_outputs();
 }
 
+// When the whole iteration is contiguous and too small to parallelize, the
+// 2-D strided loop machinery (stride gathering, contiguity re-checks, and
+// the parallel_for entry) costs more than the arithmetic itself.  In that
+// case the data pointers can be handed straight to vectorized_loop: the
+// tensor count is a compile-time constant from the lambda's arity, and
+// contiguity has already been established once for the entire iteration.
+template <typename func_t, typename vec_func_t>
+static inline bool try_small_contiguous_kernel_vec(
+    TensorIteratorBase& iter, func_t&& op, vec_func_t&& vop, int64_t grain_size) {
+  using traits = function_traits<func_t>;
+  constexpr int ntensors = traits::arity + 1;
+
+  const int64_t numel = iter.numel();
+  if (numel > grain_size || !iter.is_contiguous()) {
+    return false;
+  }
+  if (numel == 0) {
+    return true;
+  }
+  std::array<char*, ntensors> data;
+  for (const auto arg : c10::irange(ntensors)) {
+    data[arg] = reinterpret_cast<char*>(iter.data_ptr(arg));
+  }
+  vectorized_loop(data.data(), numel, 0,
+      std::forward<func_t>(op), std::forward<vec_func_t>(vop));
+  return true;
+}
+
 template <bool check_dynamic_cast=true, typename func_t, typename vec_func_t>
 void cpu_kernel_vec(TensorIteratorBase& iter, func_t&& op, vec_func_t&& vop, int64_t grain_size = at::internal::GRAIN_SIZE) {
   using traits = function_traits<func_t>;
@@ -347,6 +375,11 @@ void cpu_kernel_vec(TensorIteratorBase& iter, func_t&& op, vec_func_t&& vop, int
     TORCH_INTERNAL_ASSERT(!needs_dynamic_casting<func_t>::check(iter));
   });
 
+  if (try_small_contiguous_kernel_vec(iter, op, vop, grain_size)) {
+    iter.cast_outputs();
+    return;
+  }
+
   iter.for_each(make_vectorized_loop2d(op, vop), grain_size);
   iter.cast_outputs();
 }
@@ -6,6 +6,7 @@
 #include <c10/core/Scalar.h>
 #include <c10/util/irange.h>
 
+#include <array>
 #include <sstream>
 
 namespace at { namespace native { inline namespace CPU_CAPABILITY {
@@ -210,17 +211,33 @@ void binary_kernel_reduce(TensorIteratorBase& iter, ops_t ops, init_t init) {
   );
   const int num_outputs = iter.noutputs();
   iter.foreach_reduced_elt([&ops, &init, num_outputs](TensorIteratorBase &sub_iter) {
-    auto reduction_body = [&ops, &sub_iter, num_outputs](acc_t acc, int64_t begin, int64_t end) -> acc_t {
+    auto reduction_body = [&ops, &init, &sub_iter, num_outputs](acc_t acc, int64_t begin, int64_t end) -> acc_t {
       int ntensors = sub_iter.ntensors();
-      sub_iter.serial_for_each([&acc, &ops, num_outputs, ntensors, begin](char** data, const int64_t* strides, int64_t size) {
+      // Four independent accumulators hide the latency of the serial
+      // acc = reduce(acc, x) dependence chain, mirroring the four vector
+      // accumulators in vectorized_reduction above. Partitioning the range
+      // round-robin between them is valid by the same contract that lets
+      // combine() merge per-thread partials.
+      std::array<acc_t, 4> accs{{acc, init, init, init}};
+      sub_iter.serial_for_each([&accs, &ops, num_outputs, ntensors, begin](char** data, const int64_t* strides, int64_t size) {
         AT_ASSERT(ntensors - num_outputs == 1);
         char *in = data[ntensors - 1];
         int64_t stride = strides[ntensors - 1];
-        for (const auto i : c10::irange(size)) {
-          acc = ops.reduce(acc, c10::load<data_t>(in), begin + i);
+        int64_t i = 0;
+        for (; i + 4 <= size; i += 4) {
+          accs[0] = ops.reduce(accs[0], c10::load<data_t>(in), begin + i);
+          accs[1] = ops.reduce(accs[1], c10::load<data_t>(in + stride), begin + i + 1);
+          accs[2] = ops.reduce(accs[2], c10::load<data_t>(in + 2 * stride), begin + i + 2);
+          accs[3] = ops.reduce(accs[3], c10::load<data_t>(in + 3 * stride), begin + i + 3);
+          in += 4 * stride;
+        }
+        for (; i < size; ++i) {
+          accs[0] = ops.reduce(accs[0], c10::load<data_t>(in), begin + i);
           in += stride;
         }
       }, {begin, end});
+      acc = ops.combine(
+          ops.combine(accs[0], accs[1]), ops.combine(accs[2], accs[3]));
       return ops.translate_idx(acc, sub_iter.view_offsets()[0]);
     };
     acc_t total_acc = init;
@@ -242,9 +259,16 @@ void binary_kernel_reduce(TensorIteratorBase& iter, ops_t ops, init_t init) {
           acc = reduction_body(acc, begin, end);
         }
       );
-      for (const auto i : c10::irange(max_threads)) {
-        total_acc = ops.combine(total_acc, buffer[i]);
+      // Combine the per-thread partials as a pairwise tree rather than a
+      // serial chain: log2(threads) combine depth, and neighboring threads
+      // (which the thread pool pins near each other, so typically the same
+      // NUMA node) are merged first.
+      for (int64_t step = 1; step < max_threads; step *= 2) {
+        for (int64_t i = 0; i + step < max_threads; i += 2 * step) {
+          buffer[i] = ops.combine(buffer[i], buffer[i + step]);
+        }
       }
+      total_acc = ops.combine(total_acc, buffer[0]);
     }
     set_results<r_traits>(ops.project(total_acc), sub_iter, num_outputs);
   });
@@ -1196,6 +1196,112 @@ static void softmax_lastdim_kernel_impl(
       [&] { vec_host_softmax_lastdim<scalar_t, false>::apply(result, self); });
 }
 
+inline void _vec_masked_softmax_lastdim(
+    float* output_data_base,
+    const float* input_data_base,
+    const bool* mask_data_base,
+    int64_t outer_size,
+    int64_t dim_size,
+    int64_t mask_div,
+    int64_t mask_mod) {
+  using Vec = vec::Vectorized<float>;
+  int64_t grain_size = std::max(internal::GRAIN_SIZE / (16 * dim_size), (int64_t)1);
+  parallel_for(
+      0, outer_size, grain_size,
+      [&](int64_t begin, int64_t end) {
+        // Additive form of the current mask row: 0 for live elements, -inf
+        // for masked ones.  Attention masks (mask_type 0/1) are shared by
+        // many consecutive rows, so the bool -> float conversion is done
+        // once per distinct row and the hot loops stay pure float SIMD.
+        std::vector<float> mask_bias(dim_size);
+        int64_t cached_mask_row = -1;
+        for (const auto i : c10::irange(begin, end)) {
+          int64_t mask_row = (i / mask_div) % mask_mod;
+          if (mask_row != cached_mask_row) {
+            const bool* mask_row_ptr = mask_data_base + mask_row * dim_size;
+            for (const auto d : c10::irange(dim_size)) {
+              mask_bias[d] = mask_row_ptr[d]
+                  ? -std::numeric_limits<float>::infinity()
+                  : 0.0f;
+            }
+            cached_mask_row = mask_row;
+          }
+          const float* input_data = input_data_base + i * dim_size;
+          float* output_data = output_data_base + i * dim_size;
+          const float* bias = mask_bias.data();
+
+          // Max of input + bias, kept in registers.
+          int64_t d = 0;
+          Vec max_vec = Vec(-std::numeric_limits<float>::infinity());
+          for (; d + Vec::size() <= dim_size; d += Vec::size()) {
+            max_vec = vec::maximum(
+                max_vec, Vec::loadu(input_data + d) + Vec::loadu(bias + d));
+          }
+          float max_input = vec::vec_reduce_all<float>(
+              [](Vec& x, Vec& y) { return vec::maximum(x, y); }, max_vec);
+          for (; d < dim_size; d++) {
+            max_input = std::max(max_input, input_data[d] + bias[d]);
+          }
+
+          // Exponentials and their running sum.  Masked elements come out
+          // as exp(-inf) == 0; a fully masked row makes the whole row NaN,
+          // matching host_softmax.
+          Vec sum_vec = Vec(0.0f);
+          for (d = 0; d + Vec::size() <= dim_size; d += Vec::size()) {
+            Vec z = ((Vec::loadu(input_data + d) + Vec::loadu(bias + d)) -
+                     Vec(max_input))
+                        .exp();
+            z.store(output_data + d);
+            sum_vec += z;
+          }
+          float tmp_sum = vec::vec_reduce_all<float>(
+              [](Vec& x, Vec& y) { return x + y; }, sum_vec);
+          for (; d < dim_size; d++) {
+            float z = std::exp(input_data[d] + bias[d] - max_input);
+            output_data[d] = z;
+            tmp_sum += z;
+          }
+
+          Vec inv_sum_vec = Vec(1.0f / tmp_sum);
+          for (d = 0; d + Vec::size() <= dim_size; d += Vec::size()) {
+            (Vec::loadu(output_data + d) * inv_sum_vec).store(output_data + d);
+          }
+          for (; d < dim_size; d++) {
+            output_data[d] *= 1.0f / tmp_sum;
+          }
+        }
+      });
+}
+
+static void masked_softmax_lastdim_kernel_impl(
+    const Tensor& result,
+    const Tensor& self,
+    const Tensor& mask,
+    int64_t mask_type) {
+  TORCH_INTERNAL_ASSERT(self.scalar_type() == ScalarType::Float);
+  int64_t dim_size = self.size(self.dim() - 1);
+  int64_t outer_size = self.numel() / dim_size;
+  // Map a row of the input onto the mask row it shares (see host_softmax):
+  // mask_type 2 is elementwise, mask_type 0 is an (L, L) attention mask
+  // broadcast over B x H, mask_type 1 is a (B, L) padding mask broadcast
+  // over H x L.
+  int64_t mask_div = 1;
+  int64_t mask_mod = outer_size;
+  if (mask_type == 0) {
+    mask_mod = self.size(2);
+  } else if (mask_type == 1) {
+    mask_div = self.size(1) * self.size(2);
+  }
+  _vec_masked_softmax_lastdim(
+      result.data_ptr<float>(),
+      self.data_ptr<float>(),
+      mask.data_ptr<bool>(),
+      outer_size,
+      dim_size,
+      mask_div,
+      mask_mod);
+}
+
 static void softmax_kernel_impl(const Tensor& result, const Tensor& self, int64_t dim) {
   AT_DISPATCH_FLOATING_TYPES_AND(at::ScalarType::BFloat16, self.scalar_type(),
     "softmax_kernel_impl",
@@ -1274,6 +1380,9 @@ static void log_softmax_backward_kernel_impl(
 } // anonymous namespace
 
 REGISTER_DISPATCH(softmax_lastdim_kernel, &softmax_lastdim_kernel_impl);
+REGISTER_DISPATCH(
+    masked_softmax_lastdim_kernel,
+    &masked_softmax_lastdim_kernel_impl);
 REGISTER_DISPATCH(log_softmax_lastdim_kernel, &log_softmax_lastdim_kernel_impl);
 REGISTER_DISPATCH(
     softmax_backward_lastdim_kernel,
@@ -24,5 +24,13 @@ DECLARE_DISPATCH(forward_fn_with_dim, softmax_kernel);
 DECLARE_DISPATCH(forward_fn_with_dim, log_softmax_kernel);
 DECLARE_DISPATCH(backward_fn_with_dim, softmax_backward_kernel);
 DECLARE_DISPATCH(backward_fn_with_dim, log_softmax_backward_kernel);
+
+using masked_softmax_fn = void (*)(
+    const Tensor& /* output */,
+    const Tensor& /* input */,
+    const Tensor& /* mask */,
+    int64_t /* mask_type */);
+
+DECLARE_DISPATCH(masked_softmax_fn, masked_softmax_lastdim_kernel);
 }
 }
@@ -11,6 +11,14 @@
 #include <c10/core/WrapDimMinimal.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
 namespace at { namespace native {
 
 namespace {
@@ -83,6 +91,196 @@ struct KeyValueCompDesc {
   }
 };
 
+// [Note: parallel radix sort]
+// For large 1-D contiguous inputs the per-slice comparator sort pegs a single
+// core.  Instead, partition the input into 256 buckets keyed on the highest
+// byte in which the values actually differ (a stable parallel counting sort:
+// per-chunk histograms, a serial offset scan, then a parallel scatter), and
+// finish each bucket independently in parallel with the same comparators as
+// the slice path.  Keys are bijectively mapped to uint64 so that unsigned
+// byte order matches the comparator order: signed ints get their sign bit
+// flipped, floats use the usual IEEE flip with NaNs forced to the maximal
+// key so they group at the end (or the front, for descending).  -0.0 maps to
+// the +0.0 key so that stable sorts keep the input order of signed zeros.
+// A heavily skewed distribution can still put most elements in one bucket;
+// that degenerates to the serial comparator sort, never worse than before.
+
+constexpr int64_t kMinRadixSortSize = 1 << 16;
+constexpr int64_t kRadixSortBuckets = 256;
+
+template <typename scalar_t>
+inline uint64_t radix_sort_key(scalar_t value) {
+  static_assert(std::is_integral<scalar_t>::value, "expected an integral type");
+  using unsigned_t = typename std::make_unsigned<scalar_t>::type;
+  uint64_t key = static_cast<unsigned_t>(value);
+  if (std::is_signed<scalar_t>::value) {
+    key ^= static_cast<uint64_t>(1) << (8 * sizeof(scalar_t) - 1);
+  }
+  return key;
+}
+
+inline uint64_t radix_sort_key(float value) {
+  if (_isnan(value)) {
+    return std::numeric_limits<uint32_t>::max();
+  }
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  if (bits == UINT32_C(0x80000000)) {
+    bits = 0; // -0.0 sorts as +0.0
+  }
+  return (bits & UINT32_C(0x80000000)) ? ~bits : (bits | UINT32_C(0x80000000));
+}
+
+inline uint64_t radix_sort_key(double value) {
+  if (_isnan(value)) {
+    return std::numeric_limits<uint64_t>::max();
+  }
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  if (bits == UINT64_C(0x8000000000000000)) {
+    bits = 0; // -0.0 sorts as +0.0
+  }
+  return (bits & UINT64_C(0x8000000000000000)) ? ~bits
+                                               : (bits | UINT64_C(0x8000000000000000));
+}
+
+template <typename scalar_t>
+void radix_sort_kernel_1d(
+    scalar_t* values,
+    int64_t* indices,
+    int64_t n,
+    bool descending,
+    bool stable) {
+  const int64_t num_chunks = std::max<int64_t>(
+      int64_t{1}, std::min<int64_t>(at::get_num_threads(), n / kMinRadixSortSize));
+  const int64_t chunk_size = divup(n, num_chunks);
+
+  // Pass 1: key range, to pick the highest byte in which keys differ.
+  std::vector<uint64_t> chunk_min(num_chunks, std::numeric_limits<uint64_t>::max());
+  std::vector<uint64_t> chunk_max(num_chunks, 0);
+  at::parallel_for(0, num_chunks, 1, [&](int64_t cbegin, int64_t cend) {
+    for (const auto c : c10::irange(cbegin, cend)) {
+      uint64_t kmin = std::numeric_limits<uint64_t>::max();
+      uint64_t kmax = 0;
+      const int64_t end = std::min(n, (c + 1) * chunk_size);
+      for (const auto i : c10::irange(c * chunk_size, end)) {
+        const uint64_t key = radix_sort_key(values[i]);
+        kmin = std::min(kmin, key);
+        kmax = std::max(kmax, key);
+      }
+      chunk_min[c] = kmin;
+      chunk_max[c] = kmax;
+    }
+  });
+  const uint64_t kmin = *std::min_element(chunk_min.begin(), chunk_min.end());
+  const uint64_t kmax = *std::max_element(chunk_max.begin(), chunk_max.end());
+
+  if (kmin == kmax) {
+    // The key map is injective (up to the NaN/-0.0 classes, whose members the
+    // comparators consider equal), so the input is already sorted.
+    at::parallel_for(0, n, internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+      for (const auto i : c10::irange(begin, end)) {
+        indices[i] = i;
+      }
+    });
+    return;
+  }
+
+  int shift = 0;
+  while (((kmin ^ kmax) >> shift) >= kRadixSortBuckets) {
+    shift++;
+  }
+  auto bucket_of = [shift](uint64_t key) -> int64_t {
+    return (key >> shift) & (kRadixSortBuckets - 1);
+  };
+
+  // Pass 2: per-chunk bucket histograms.
+  std::vector<int64_t> chunk_counts(num_chunks * kRadixSortBuckets, 0);
+  at::parallel_for(0, num_chunks, 1, [&](int64_t cbegin, int64_t cend) {
+    for (const auto c : c10::irange(cbegin, cend)) {
+      int64_t* counts = chunk_counts.data() + c * kRadixSortBuckets;
+      const int64_t end = std::min(n, (c + 1) * chunk_size);
+      for (const auto i : c10::irange(c * chunk_size, end)) {
+        counts[bucket_of(radix_sort_key(values[i]))]++;
+      }
+    }
+  });
+
+  // Serial scan over 256 * num_chunks counters.  Visiting chunks in order
+  // within each bucket is what makes the scatter stable; visiting buckets in
+  // reverse handles descending without touching the keys.
+  std::vector<int64_t> chunk_offsets(num_chunks * kRadixSortBuckets);
+  std::array<int64_t, kRadixSortBuckets> bucket_begin{};
+  std::array<int64_t, kRadixSortBuckets> bucket_end{};
+  int64_t running = 0;
+  for (const auto i : c10::irange(kRadixSortBuckets)) {
+    const int64_t b = descending ? kRadixSortBuckets - 1 - i : i;
+    bucket_begin[b] = running;
+    for (const auto c : c10::irange(num_chunks)) {
+      chunk_offsets[c * kRadixSortBuckets + b] = running;
+      running += chunk_counts[c * kRadixSortBuckets + b];
+    }
+    bucket_end[b] = running;
+  }
+
+  // Pass 3: scatter values and their original positions into bucket order.
+  std::unique_ptr<scalar_t[]> values_tmp(new scalar_t[n]);
+  std::unique_ptr<int64_t[]> indices_tmp(new int64_t[n]);
+  at::parallel_for(0, num_chunks, 1, [&](int64_t cbegin, int64_t cend) {
+    for (const auto c : c10::irange(cbegin, cend)) {
+      int64_t* offsets = chunk_offsets.data() + c * kRadixSortBuckets;
+      const int64_t end = std::min(n, (c + 1) * chunk_size);
+      for (const auto i : c10::irange(c * chunk_size, end)) {
+        const int64_t pos = offsets[bucket_of(radix_sort_key(values[i]))]++;
+        values_tmp[pos] = values[i];
+        indices_tmp[pos] = i;
+      }
+    }
+  });
+
+  // Pass 4: finish each bucket with the comparator sort and copy it back.
+  at::parallel_for(0, kRadixSortBuckets, 1, [&](int64_t bbegin, int64_t bend) {
+    for (const auto b : c10::irange(bbegin, bend)) {
+      const int64_t begin = bucket_begin[b];
+      const int64_t size = bucket_end[b] - begin;
+      if (size == 0) {
+        continue;
+      }
+      auto values_accessor = StridedRandomAccessor<scalar_t>(
+        values_tmp.get() + begin, 1);
+      auto indices_accessor = StridedRandomAccessor<int64_t>(
+        indices_tmp.get() + begin, 1);
+      auto composite_accessor = CompositeRandomAccessorCPU<
+        decltype(values_accessor), decltype(indices_accessor)
+      >(values_accessor, indices_accessor);
+
+      if (descending) {
+        if (stable) {
+          std::stable_sort(composite_accessor, composite_accessor + size,
+            KeyValueCompDesc<scalar_t>());
+        }
+        else {
+          std::sort(composite_accessor, composite_accessor + size,
+            KeyValueCompDesc<scalar_t>());
+        }
+      }
+      else {
+        if (stable) {
+          std::stable_sort(composite_accessor, composite_accessor + size,
+            KeyValueCompAsc<scalar_t>());
+        }
+        else {
+          std::sort(composite_accessor, composite_accessor + size,
+            KeyValueCompAsc<scalar_t>());
+        }
+      }
+
+      std::memcpy(values + begin, values_tmp.get() + begin, size * sizeof(scalar_t));
+      std::memcpy(indices + begin, indices_tmp.get() + begin, size * sizeof(int64_t));
+    }
+  });
+}
+
 static void sort_kernel(
     const TensorBase& self,
     const TensorBase& values,
@@ -91,6 +289,23 @@ static void sort_kernel(
     bool descending,
     bool stable) {
   dim = maybe_wrap_dim(dim, values.dim());
+
+  const auto dtype = values.scalar_type();
+  if (values.dim() == 1 && values.numel() >= kMinRadixSortSize &&
+      values.stride(0) == 1 && indices.stride(0) == 1 &&
+      (c10::isIntegralType(dtype, /*includeBool=*/false) ||
+       dtype == ScalarType::Float || dtype == ScalarType::Double)) {
+    AT_DISPATCH_ALL_TYPES(dtype, "sort_cpu_radix", [&] {
+      radix_sort_kernel_1d<scalar_t>(
+        values.data_ptr<scalar_t>(),
+        indices.data_ptr<int64_t>(),
+        values.numel(),
+        descending,
+        stable);
+    });
+    return;
+  }
+
   _fill_indices(indices, dim);
   _dim_apply(
     values, indices, dim,
@@ -141,6 +356,65 @@ static void topk_kernel(
     bool largest,
     bool sorted) {
   auto sizes = self.sizes();
+  const int64_t dim_size = sizes[dim];
+  const int64_t num_slices = dim_size > 0 ? self.numel() / dim_size : 0;
+
+  // A single big contiguous slice (retrieval-style 1-D topk) gets no
+  // parallelism from the TensorIterator path below, which only splits work
+  // across slices. Chunk the slice across threads with a per-thread local
+  // topk and merge the candidates at the end. Mirrors the threshold-scan
+  // constraints in topk_impl_loop: small k, contiguous, no accscalar
+  // widening (i.e. no BFloat16).
+  if (num_slices == 1 && k > 0 && k <= 256 && k * 64 <= dim_size &&
+      dim_size >= 2 * internal::GRAIN_SIZE && self.is_contiguous() &&
+      values.is_contiguous() && indices.is_contiguous() &&
+      self.scalar_type() != ScalarType::BFloat16) {
+    AT_DISPATCH_ALL_TYPES(self.scalar_type(), "topk_cpu_1d", [&] {
+      using elem_t = std::pair<scalar_t, int64_t>;
+      const scalar_t* in = self.data_ptr<scalar_t>();
+      const int64_t num_chunks = std::max<int64_t>(
+          1,
+          std::min<int64_t>(
+              {static_cast<int64_t>(at::get_num_threads()),
+               dim_size / internal::GRAIN_SIZE,
+               dim_size / k}));
+      std::vector<elem_t> candidates(num_chunks * k);
+      at::parallel_for(0, num_chunks, 1, [&](int64_t begin, int64_t end) {
+        for (const auto c : c10::irange(begin, end)) {
+          const int64_t chunk_begin = dim_size * c / num_chunks;
+          const int64_t chunk_end = dim_size * (c + 1) / num_chunks;
+          if (largest) {
+            topk_threshold_scan<scalar_t, /*largest=*/true>(
+                in + chunk_begin, chunk_end - chunk_begin, k,
+                chunk_begin, candidates.data() + c * k);
+          } else {
+            topk_threshold_scan<scalar_t, /*largest=*/false>(
+                in + chunk_begin, chunk_end - chunk_begin, k,
+                chunk_begin, candidates.data() + c * k);
+          }
+        }
+      });
+      if (num_chunks > 1) {
+        if (largest) {
+          std::partial_sort(
+              candidates.begin(), candidates.begin() + k, candidates.end(),
+              topk_greater<scalar_t>);
+        } else {
+          std::partial_sort(
+              candidates.begin(), candidates.begin() + k, candidates.end(),
+              topk_less<scalar_t>);
+        }
+      }
+      scalar_t* out_values = values.data_ptr<scalar_t>();
+      int64_t* out_indices = indices.data_ptr<int64_t>();
+      for (const auto j : c10::irange(k)) {
+        out_values[j] = candidates[j].first;
+        out_indices[j] = candidates[j].second;
+      }
+    });
+    return;
+  }
+
   auto iter = TensorIteratorConfig()
     .check_all_same_dtype(false)
     .resize_outputs(false)
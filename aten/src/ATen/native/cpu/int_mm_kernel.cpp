@@ -0,0 +1,178 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec/functional.h>
+#include <ATen/cpu/vec/vec.h>
+#include <ATen/native/LinearAlgebra.h>
+#include <c10/util/irange.h>
+
+namespace at { namespace native {
+
+namespace {
+
+void weight_to_int4pack_kernel(const Tensor& weight_packed, const Tensor& weight) {
+  const int32_t* w = weight.data_ptr<int32_t>();
+  uint8_t* wp = weight_packed.data_ptr<uint8_t>();
+  const int64_t N = weight.size(0);
+  const int64_t K = weight.size(1);
+  const int64_t K2 = K / 2;
+
+  at::parallel_for(0, N, 1, [&](int64_t begin, int64_t end) {
+    for (const auto n : c10::irange(begin, end)) {
+      const int32_t* w_row = w + n * K;
+      uint8_t* wp_row = wp + n * K2;
+      for (const auto k2 : c10::irange(K2)) {
+        // even k goes in the high nibble
+        wp_row[k2] = static_cast<uint8_t>(
+            ((w_row[2 * k2] & 0xF) << 4) | (w_row[2 * k2 + 1] & 0xF));
+      }
+    }
+  });
+}
+
+// A [M, K] x dequant(B)^T [K, N] -> C [M, N] with B packed as uint8 [N, K / 2]
+// and per-group affine parameters scales_and_zeros [K / group_size, N, 2].
+//
+// The dequantized weight is w = (q - 8) * scale + zero. Rewriting the group
+// dot product as
+//   sum_k a_k * w_k = scale * (sum_k a_k * q_k - 8 * sum_k a_k)
+//                     + zero * sum_k a_k
+// lets the inner loop accumulate the raw nibble products; the activation sums
+// per (row, group) are precomputed once and the affine correction is applied
+// per group, so no per-element dequantization happens in the hot loop.
+template <typename scalar_t>
+void int4pack_mm_kernel_impl(
+    const Tensor& C,
+    const Tensor& A,
+    const Tensor& B,
+    int64_t group_size,
+    const Tensor& scales_and_zeros) {
+  const scalar_t* a = A.data_ptr<scalar_t>();
+  const uint8_t* b = B.data_ptr<uint8_t>();
+  const float* sz = scales_and_zeros.data_ptr<float>();
+  scalar_t* c = C.data_ptr<scalar_t>();
+
+  const int64_t M = A.size(0);
+  const int64_t K = A.size(1);
+  const int64_t N = B.size(0);
+  const int64_t G = K / group_size;
+
+  // a_sums[m * G + g] = sum of A[m, g * group_size : (g + 1) * group_size]
+  std::vector<float> a_sums(M * G);
+  at::parallel_for(0, M, 1, [&](int64_t begin, int64_t end) {
+    for (const auto m : c10::irange(begin, end)) {
+      const scalar_t* a_row = a + m * K;
+      for (const auto g : c10::irange(G)) {
+        float sum = 0;
+        for (const auto i : c10::irange(group_size)) {
+          sum += static_cast<float>(a_row[g * group_size + i]);
+        }
+        a_sums[m * G + g] = sum;
+      }
+    }
+  });
+
+  const int64_t grain_size = std::max(int64_t{1}, internal::GRAIN_SIZE / K);
+  at::parallel_for(0, N, grain_size, [&](int64_t begin, int64_t end) {
+    for (const auto n : c10::irange(begin, end)) {
+      const uint8_t* b_row = b + n * (K / 2);
+      for (const auto m : c10::irange(M)) {
+        const scalar_t* a_row = a + m * K;
+        float acc = 0;
+        for (const auto g : c10::irange(G)) {
+          const float scale = sz[(g * N + n) * 2];
+          const float zero = sz[(g * N + n) * 2 + 1];
+          float dot = 0;
+          const int64_t k0 = g * group_size;
+          for (int64_t k = k0; k < k0 + group_size; k += 2) {
+            const uint8_t packed = b_row[k / 2];
+            dot += static_cast<float>(a_row[k]) * static_cast<float>(packed >> 4);
+            dot += static_cast<float>(a_row[k + 1]) * static_cast<float>(packed & 0xF);
+          }
+          const float a_sum = a_sums[m * G + g];
+          acc += scale * (dot - 8.f * a_sum) + zero * a_sum;
+        }
+        c[m * N + n] = static_cast<scalar_t>(acc);
+      }
+    }
+  });
+}
+
+void int4pack_mm_kernel(
+    const Tensor& C,
+    const Tensor& A,
+    const Tensor& B,
+    int64_t group_size,
+    const Tensor& scales_and_zeros) {
+  AT_DISPATCH_FLOATING_TYPES_AND2(kHalf, kBFloat16, A.scalar_type(), "int4pack_mm_cpu", [&] {
+    int4pack_mm_kernel_impl<scalar_t>(C, A, B, group_size, scales_and_zeros);
+  });
+}
+
+// A [M, K] x dequant(B)^T [K, N] -> C [M, N] with B as int8 [N, K] and one
+// scale per output row.
+template <typename scalar_t>
+void int8pack_mm_kernel_impl(
+    const Tensor& C,
+    const Tensor& A,
+    const Tensor& B,
+    const Tensor& scales) {
+  const scalar_t* a = A.data_ptr<scalar_t>();
+  const int8_t* b = B.data_ptr<int8_t>();
+  const float* s = scales.data_ptr<float>();
+  scalar_t* c = C.data_ptr<scalar_t>();
+
+  const int64_t M = A.size(0);
+  const int64_t K = A.size(1);
+  const int64_t N = B.size(0);
+
+  const int64_t grain_size = std::max(int64_t{1}, internal::GRAIN_SIZE / K);
+  at::parallel_for(0, N, grain_size, [&](int64_t begin, int64_t end) {
+    for (const auto n : c10::irange(begin, end)) {
+      const int8_t* b_row = b + n * K;
+      for (const auto m : c10::irange(M)) {
+        const scalar_t* a_row = a + m * K;
+        float acc = 0;
+        int64_t k = 0;
+        if constexpr (std::is_same<scalar_t, float>::value) {
+          using Vec = vec::Vectorized<float>;
+          constexpr int64_t kVecSize = Vec::size();
+          Vec acc_vec(0.f);
+          float buf[kVecSize];
+          for (; k + kVecSize <= K; k += kVecSize) {
+            for (const auto i : c10::irange(kVecSize)) {
+              buf[i] = static_cast<float>(b_row[k + i]);
+            }
+            acc_vec = vec::fmadd(Vec::loadu(a_row + k), Vec::loadu(buf), acc_vec);
+          }
+          acc = vec::vec_reduce_all(
+              [](Vec& x, Vec& y) { return x + y; }, acc_vec);
+        }
+        for (; k < K; ++k) {
+          acc += static_cast<float>(a_row[k]) * static_cast<float>(b_row[k]);
+        }
+        c[m * N + n] = static_cast<scalar_t>(acc * s[n]);
+      }
+    }
+  });
+}
+
+void int8pack_mm_kernel(
+    const Tensor& C,
+    const Tensor& A,
+    const Tensor& B,
+    const Tensor& scales) {
+  AT_DISPATCH_FLOATING_TYPES_AND2(kHalf, kBFloat16, A.scalar_type(), "int8pack_mm_cpu", [&] {
+    int8pack_mm_kernel_impl<scalar_t>(C, A, B, scales);
+  });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(weight_to_int4pack_stub, &weight_to_int4pack_kernel);
+REGISTER_DISPATCH(int4pack_mm_stub, &int4pack_mm_kernel);
+REGISTER_DISPATCH(int8pack_mm_stub, &int8pack_mm_kernel);
+
+}} // namespace at::native
@@ -1,8 +1,10 @@
 #define TORCH_ASSERT_ONLY_METHOD_OPERATORS
 #include <ATen/native/layer_norm.h>
 
+#include <algorithm>
 #include <cmath>
 #include <tuple>
+#include <type_traits>
 
 #include <ATen/core/Tensor.h>
 #include <ATen/Dispatch.h>
@@ -259,69 +261,118 @@ void LayerNormBackwardKernelImplInternal(
     for (const auto i : c10::irange(start, end)) {
       const T* dY_ptr = dY_data + i * N;
       const T* X_ptr = X_data + i * N;
-      if (!dgamma_null) {
+      T_ACC ds = T_ACC(0);
+      T_ACC db = T_ACC(0);
+      if constexpr (std::is_same<T, T_ACC>::value) {
+        // Single fused sweep over the row: the dgamma/dbeta partials and the
+        // ds/db reductions for dX all reuse the same dY/X vectors, so each
+        // row is read once instead of once per quantity.
         const T_ACC a = rstd_data[i];
         const T_ACC b = -a * mean_data[i];
-        // Scalar math:
-        // for (const auto j : c10::irange(N)) {
-        //   dgamma_data[j] += dY_ptr[j] * (a * X_ptr[j] + b);
-        // }
-        vec::map3<T>(
-            [a, b](Vec dgamma, Vec dy, Vec x) {
-              return dgamma + dy * (Vec(a) * x + Vec(b));
-            },
-            dgamma_buffer_ptr,
-            dgamma_buffer_ptr,
-            dY_ptr,
-            X_ptr,
-            N);
-      }
-      if (!dbeta_null) {
-        // Scalar math:
-        // for (const auto j : c10::irange(N)) {
-        //   dbeta_data[j] += dY_ptr[j];
-        // }
-        vec::map2<T>(
-            [](Vec dbeta, Vec dy) { return dbeta + dy; },
-            dbeta_buffer_ptr,
-            dbeta_buffer_ptr,
-            dY_ptr,
-            N);
-      }
-      if (!dX_null) {
-        T* dX_ptr = dX_data + i * N;
-        T_ACC ds = T_ACC(0);
-        T_ACC db = T_ACC(0);
-        // Scalar math:
-        // for (const auto j : c10::irange(N)) {
-        //   const T gamma_v = gamma_null ? T(1) : gamma_data[j];
-        //   ds += dY_ptr[j] * X_ptr[j] * gamma_v;
-        //   db += dY_ptr[j] * gamma_v;
-        // }
-        if (gamma_null) {
-          ds = vec::map2_reduce_all<T>(
-              [](Vec x, Vec y) { return x * y; },
-              [](Vec x, Vec y) { return x + y; },
-              dY_ptr,
-              X_ptr,
-              N);
-          db = vec::reduce_all<T>(
-              [](Vec& x, Vec& y) { return x + y; }, dY_ptr, N);
-        } else {
-          ds = vec::map3_reduce_all<T>(
-              [](Vec x, Vec y, Vec z) { return x * y * z; },
-              [](Vec x, Vec y) { return x + y; },
+        Vec ds_vec(T_ACC(0));
+        Vec db_vec(T_ACC(0));
+        int64_t j = 0;
+        for (; j + Vec::size() <= N; j += Vec::size()) {
+          const Vec dy = Vec::loadu(dY_ptr + j);
+          const Vec x = Vec::loadu(X_ptr + j);
+          if (!dgamma_null) {
+            Vec dg = Vec::loadu(dgamma_buffer_ptr + j);
+            dg = vec::fmadd(dy, vec::fmadd(Vec(a), x, Vec(b)), dg);
+            dg.store(dgamma_buffer_ptr + j);
+          }
+          if (!dbeta_null) {
+            (Vec::loadu(dbeta_buffer_ptr + j) + dy).store(dbeta_buffer_ptr + j);
+          }
+          if (!dX_null) {
+            const Vec dyg = gamma_null ? dy : dy * Vec::loadu(gamma_data + j);
+            ds_vec = vec::fmadd(dyg, x, ds_vec);
+            db_vec = db_vec + dyg;
+          }
+        }
+        for (; j < N; j++) {
+          const T_ACC dy = dY_ptr[j];
+          const T_ACC x = X_ptr[j];
+          if (!dgamma_null) {
+            dgamma_buffer_ptr[j] += dy * (a * x + b);
+          }
+          if (!dbeta_null) {
+            dbeta_buffer_ptr[j] += dy;
+          }
+          if (!dX_null) {
+            const T_ACC dyg = gamma_null ? dy : dy * gamma_data[j];
+            ds += dyg * x;
+            db += dyg;
+          }
+        }
+        ds += vec::vec_reduce_all<T_ACC>(
+            [](Vec& x, Vec& y) { return x + y; }, ds_vec);
+        db += vec::vec_reduce_all<T_ACC>(
+            [](Vec& x, Vec& y) { return x + y; }, db_vec);
+      } else {
+        if (!dgamma_null) {
+          const T_ACC a = rstd_data[i];
+          const T_ACC b = -a * mean_data[i];
+          // Scalar math:
+          // for (const auto j : c10::irange(N)) {
+          //   dgamma_data[j] += dY_ptr[j] * (a * X_ptr[j] + b);
+          // }
+          vec::map3<T>(
+              [a, b](Vec dgamma, Vec dy, Vec x) {
+                return dgamma + dy * (Vec(a) * x + Vec(b));
+              },
+              dgamma_buffer_ptr,
+              dgamma_buffer_ptr,
               dY_ptr,
               X_ptr,
-              gamma_data,
               N);
-          db = vec::map2_reduce_all<T>(
-              [](Vec x, Vec y) { return x * y; },
-              [](Vec x, Vec y) { return x + y; },
+        }
+        if (!dbeta_null) {
+          // Scalar math:
+          // for (const auto j : c10::irange(N)) {
+          //   dbeta_data[j] += dY_ptr[j];
+          // }
+          vec::map2<T>(
+              [](Vec dbeta, Vec dy) { return dbeta + dy; },
+              dbeta_buffer_ptr,
+              dbeta_buffer_ptr,
               dY_ptr,
-              gamma_data,
               N);
         }
+        if (!dX_null) {
+          // Scalar math:
+          // for (const auto j : c10::irange(N)) {
+          //   const T gamma_v = gamma_null ? T(1) : gamma_data[j];
+          //   ds += dY_ptr[j] * X_ptr[j] * gamma_v;
+          //   db += dY_ptr[j] * gamma_v;
+          // }
+          if (gamma_null) {
+            ds = vec::map2_reduce_all<T>(
+                [](Vec x, Vec y) { return x * y; },
+                [](Vec x, Vec y) { return x + y; },
+                dY_ptr,
+                X_ptr,
+                N);
+            db = vec::reduce_all<T>(
+                [](Vec& x, Vec& y) { return x + y; }, dY_ptr, N);
+          } else {
+            ds = vec::map3_reduce_all<T>(
+                [](Vec x, Vec y, Vec z) { return x * y * z; },
+                [](Vec x, Vec y) { return x + y; },
+                dY_ptr,
+                X_ptr,
+                gamma_data,
+                N);
+            db = vec::map2_reduce_all<T>(
+                [](Vec x, Vec y) { return x * y; },
+                [](Vec x, Vec y) { return x + y; },
+                dY_ptr,
+                gamma_data,
+                N);
+          }
+        }
+      }
+      if (!dX_null) {
+        T* dX_ptr = dX_data + i * N;
         const T_ACC a = rstd_data[i];
         const T_ACC b = (db * mean_data[i] - ds) * a * a * a * scale;
         const T_ACC c = -b * mean_data[i] - db * a * scale;
@@ -356,6 +407,34 @@ void LayerNormBackwardKernelImplInternal(
 
   // Second path of dgamma/dbeta
   if (buffer_data != nullptr) {
+    if constexpr (std::is_same<T, T_ACC>::value) {
+      // Reduce the per-thread rows a vector-wide column block at a time, so
+      // every row of the buffer is traversed contiguously instead of the
+      // strided one-column-at-a-time walk.  A block touches num_threads
+      // cache lines, which stays L1-resident.
+      constexpr int64_t kColBlock = Vec::size();
+      const int64_t num_blocks = (N + kColBlock - 1) / kColBlock;
+      parallel_for(0, num_blocks, 1, [&](int64_t bbegin, int64_t bend) {
+        for (const auto block : c10::irange(bbegin, bend)) {
+          const int64_t j = block * kColBlock;
+          const int64_t cols = std::min(kColBlock, N - j);
+          Vec dgamma_vec(T_ACC(0));
+          Vec dbeta_vec(T_ACC(0));
+          for (const auto i : c10::irange(num_threads)) {
+            dgamma_vec = dgamma_vec + Vec::loadu(buffer_data + i * N + j, cols);
+            dbeta_vec = dbeta_vec +
+                Vec::loadu(buffer_data + num_threads * N + i * N + j, cols);
+          }
+          if (!dgamma_null) {
+            dgamma_vec.store(dgamma_data + j, cols);
+          }
+          if (!dbeta_null) {
+            dbeta_vec.store(dbeta_data + j, cols);
+          }
+        }
+      });
+      return;
+    }
     parallel_for(0, N, 1, [&](int64_t start, int64_t end) {
       for (const auto j : c10::irange(start, end)) {
         T_ACC dgamma_v = T_ACC(0);
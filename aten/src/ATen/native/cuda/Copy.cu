@@ -19,6 +19,10 @@
 #include <c10/cuda/CUDACachingAllocator.h>
 #include <c10/cuda/CUDAStream.h>
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+
 namespace at {
 namespace native {
 
@@ -145,6 +149,60 @@ void copy_device_to_device(TensorIterator& iter,
   AT_CUDA_CHECK(cudaGetLastError());
 }
 
+// [Note: staged pageable H2D copies]
+// cudaMemcpyAsync with a pageable source is not actually asynchronous: the
+// driver stages the transfer through its own bounce buffer and blocks the
+// calling thread (and serializes the stream) until the whole copy drains,
+// which is hundreds of milliseconds for GB-sized batches. For large
+// non_blocking copies from pageable memory we instead chunk the transfer
+// through a small ring of pinned buffers from the caching host allocator:
+// the host memcpy into the pinned buffer for chunk i+1 overlaps the DMA of
+// chunk i, and the call returns with the tail chunks still in flight. The
+// ring is bounded by waiting on the event of the DMA that last used a slot
+// before overwriting it, so at most kPageableStagingBuffers chunks of
+// pinned memory are in flight at once.
+constexpr int64_t kPageableStagingChunkBytes = 4 * 1024 * 1024;
+constexpr int kPageableStagingBuffers = 4;
+// Below this size the driver's own staging path is cheap enough that the
+// extra host memcpy does not pay off.
+constexpr int64_t kPageableStagingMinBytes = 2 * kPageableStagingChunkBytes;
+
+static void staged_pageable_h2d_copy(
+    char* dst,
+    const char* src,
+    int64_t nbytes,
+    CUDAStream stream) {
+  std::array<at::DataPtr, kPageableStagingBuffers> staging;
+  std::array<CUDAEvent, kPageableStagingBuffers> events;
+  auto* allocator = at::cuda::getCachingHostAllocator();
+
+  int64_t issued = 0;
+  for (int64_t offset = 0; offset < nbytes;
+       offset += kPageableStagingChunkBytes, ++issued) {
+    const auto slot = issued % kPageableStagingBuffers;
+    const int64_t chunk =
+        std::min(kPageableStagingChunkBytes, nbytes - offset);
+    if (issued < kPageableStagingBuffers) {
+      staging[slot] = allocator->allocate(kPageableStagingChunkBytes);
+    } else {
+      events[slot].synchronize();
+    }
+    std::memcpy(staging[slot].get(), src + offset, chunk);
+    AT_CUDA_CHECK(cudaMemcpyAsync(
+        dst + offset, staging[slot].get(), chunk, cudaMemcpyHostToDevice, stream));
+    events[slot].record(stream);
+  }
+
+  // The staging buffers return to the caching host allocator when this scope
+  // ends; record the stream so they are not handed out again until the tail
+  // copies complete.
+  for (auto& ptr : staging) {
+    if (ptr) {
+      CachingHostAllocator_recordEvent(ptr.get(), ptr.get_context(), stream);
+    }
+  }
+}
+
 static bool copy_requires_temporaries(TensorIterator& iter, bool p2p_enabled) {
   Device dst_device = iter.device(0);
   Device src_device = iter.device(1);
@@ -249,26 +307,32 @@ static void copy_kernel_cuda(TensorIterator& iter, bool non_blocking) {
   CUDAStream stream = getCurrentCUDAStream();
 
   if (non_blocking) {
-    AT_CUDA_CHECK(cudaMemcpyAsync(dst, src, nbytes, kind, stream));
-    // we use both the storage context and the tensor data pointer as the key
-    // for the caching host allocator. This allows us to better attribute the
-    // events to the original tensor allocation correctly. The cases we seek to
-    // handle are:
-
-    // 1: a user can pass a pinned memory tensor with an alternative
-    // context, for example if allocating memory directly from the pinned memory
-    // allocator and constructing a tensor with torch::from_blob.
-
-    // 2: a user can pass a tensor with a different base pointer to the original
-    // allocation (via slicing).
     const auto& dst_tensor = iter.tensor(0);
     const auto& src_tensor = iter.tensor(1);
     const auto& host_tensor = (dst_device == kCPU ? dst_tensor : src_tensor);
-    auto* ptr = (dst_device == kCPU ? dst : src);
-    auto* ctx = host_tensor.storage().data_ptr().get_context();
-    // TODO: warn on the return value.
-    CachingHostAllocator_recordEvent(ptr, ctx, stream);
-
+    if (kind == cudaMemcpyHostToDevice &&
+        nbytes >= kPageableStagingMinBytes && !host_tensor.is_pinned()) {
+      // See [Note: staged pageable H2D copies]
+      staged_pageable_h2d_copy(
+          static_cast<char*>(dst), static_cast<const char*>(src), nbytes, stream);
+    } else {
+      AT_CUDA_CHECK(cudaMemcpyAsync(dst, src, nbytes, kind, stream));
+      // we use both the storage context and the tensor data pointer as the key
+      // for the caching host allocator. This allows us to better attribute the
+      // events to the original tensor allocation correctly. The cases we seek to
+      // handle are:
+
+      // 1: a user can pass a pinned memory tensor with an alternative
+      // context, for example if allocating memory directly from the pinned memory
+      // allocator and constructing a tensor with torch::from_blob.
+
+      // 2: a user can pass a tensor with a different base pointer to the original
+      // allocation (via slicing).
+      auto* ptr = (dst_device == kCPU ? dst : src);
+      auto* ctx = host_tensor.storage().data_ptr().get_context();
+      // TODO: warn on the return value.
+      CachingHostAllocator_recordEvent(ptr, ctx, stream);
+    }
   } else {
     at::cuda::memcpy_and_sync(dst, src, nbytes, kind, stream);
   }
@@ -9,6 +9,7 @@
 #include <cufft.h>
 #include <cufftXt.h>
 
+#include <cstdlib>
 #include <limits>
 #include <list>
 #include <sstream>
@@ -409,11 +410,35 @@ static_assert(0 <= CUFFT_MAX_PLAN_NUM && CUFFT_MAX_PLAN_NUM <= std::numeric_limi
 static_assert(CUFFT_DEFAULT_CACHE_SIZE >= 0 && CUFFT_DEFAULT_CACHE_SIZE <= CUFFT_MAX_PLAN_NUM,
               "CUFFT_DEFAULT_CACHE_SIZE not in [0, CUFFT_MAX_PLAN_NUM] range");
 
+// Upper bound on the summed workspace sizes of all plans cached on one
+// device, used as a proxy for the device memory the cached plans pin.
+// cufft plans for large transforms can hold on to sizeable internal buffers,
+// so a pure entry-count limit lets the cache grow unbounded in bytes. Set
+// PYTORCH_CUFFT_PLAN_CACHE_MAX_WORKSPACE_BYTES to bound it; unset or
+// negative means unlimited (the default, matching the historic behavior).
+inline int64_t cufft_plan_cache_max_workspace_bytes() {
+  static const int64_t value = []() -> int64_t {
+    const char* env = std::getenv("PYTORCH_CUFFT_PLAN_CACHE_MAX_WORKSPACE_BYTES");
+    if (env == nullptr) {
+      return std::numeric_limits<int64_t>::max();
+    }
+    const auto parsed = std::strtoll(env, nullptr, 10);
+    if (parsed < 0) {
+      return std::numeric_limits<int64_t>::max();
+    }
+    return parsed;
+  }();
+  return value;
+}
+
 // This cache assumes that the mapping from key to value never changes.
 // This is **NOT** thread-safe. Please use a mutex when using it **AND** the
-// value returned from try_emplace_value.
-// The contract of using this cache is that try_emplace_value should only be
+// value returned from lookup.
+// The contract of using this cache is that lookup should only be
 // used when the max_size is positive.
+//
+// Eviction is LRU and is triggered both by the entry-count limit (max_size)
+// and by the workspace-byte budget above, whichever is hit first.
 class CuFFTParamsLRUCache {
 public:
   using kv_t = typename std::pair<CuFFTParams, CuFFTConfig>;
@@ -433,12 +458,14 @@ public:
   CuFFTParamsLRUCache(CuFFTParamsLRUCache&& other) noexcept :
     _usage_list(std::move(other._usage_list)),
     _cache_map(std::move(other._cache_map)),
-    _max_size(other._max_size) {}
+    _max_size(other._max_size),
+    _total_ws_bytes(other._total_ws_bytes) {}
 
   CuFFTParamsLRUCache& operator=(CuFFTParamsLRUCache&& other) noexcept {
     _usage_list = std::move(other._usage_list);
     _cache_map = std::move(other._cache_map);
     _max_size = other._max_size;
+    _total_ws_bytes = other._total_ws_bytes;
     return *this;
   }
 
@@ -459,10 +486,7 @@ public:
     // Miss
     // remove if needed
     if (_usage_list.size() >= _max_size) {
-      auto last = _usage_list.end();
-      last--;
-      _cache_map.erase(last->first);
-      _usage_list.pop_back();
+      _evict_lru();
     }
 
     // construct new plan at list front, then insert into _cache_map
@@ -473,24 +497,28 @@ public:
     _cache_map.emplace(std::piecewise_construct,
                 std::forward_as_tuple(kv_it->first),
                 std::forward_as_tuple(kv_it));
+
+    // Evict cold plans until we are back under the workspace-byte budget.
+    // Never evict the plan we just built; a single over-budget plan is
+    // cached so repeated calls with the same params still hit.
+    _total_ws_bytes += kv_it->second.workspace_size();
+    while (_total_ws_bytes > cufft_plan_cache_max_workspace_bytes() &&
+           _usage_list.size() > 1) {
+      _evict_lru();
+    }
     return kv_it->second;
   }
 
   void clear() {
     _cache_map.clear();
     _usage_list.clear();
+    _total_ws_bytes = 0;
   }
 
   void resize(int64_t new_size) {
     _set_max_size(new_size);
-    auto cur_size = _usage_list.size();
-    if (cur_size > _max_size) {
-      auto delete_it = _usage_list.end();
-      for (size_t i = 0; i < cur_size - _max_size; i++) {
-        delete_it--;
-        _cache_map.erase(delete_it->first);
-      }
-      _usage_list.erase(delete_it, _usage_list.end());
+    while (_usage_list.size() > _max_size) {
+      _evict_lru();
     }
   }
 
@@ -498,6 +526,12 @@ public:
 
   size_t max_size() const noexcept { return _max_size; }
 
+  // Synchronizes cache access and plan execution. Plans themselves are
+  // stream agnostic: callers bind the current stream with cufftSetStream
+  // right before execution, so a single cached plan is shared across all
+  // streams on the device. The mutex must be held from lookup until the
+  // transform has been enqueued because cufftSetStream and cufftSetWorkArea
+  // mutate the plan.
   std::mutex mutex;
 
 private:
@@ -513,9 +547,19 @@ private:
     _max_size = static_cast<size_t>(new_size);
   }
 
+  // Drop the least-recently-used plan.
+  void _evict_lru() {
+    auto last = _usage_list.end();
+    last--;
+    _total_ws_bytes -= static_cast<int64_t>(last->second.workspace_size());
+    _cache_map.erase(last->first);
+    _usage_list.pop_back();
+  }
+
   std::list<kv_t> _usage_list;
   map_t _cache_map;
   size_t _max_size;
+  int64_t _total_ws_bytes = 0;
 };
 
 // Since ATen is separated into CPU build and CUDA build, we need a way to call
@@ -3,6 +3,8 @@
 #include <ATen/native/cuda/MultiTensorApply.cuh>
 #include <ATen/OpMathType.h>
 
+#include <utility>
+
 namespace at { namespace native {
 
 namespace {
@@ -433,5 +435,84 @@ struct PointwiseOpListFunctor {
         }
 };
 
+template<typename Op, typename T, typename opmath_t, size_t... I>
+__device__ __forceinline__ T invoke_with_r_args(
+    Op op,
+    T r_args[][kILP],
+    int ii,
+    std::index_sequence<I...>) {
+        return static_cast<T>(op(static_cast<opmath_t>(r_args[I][ii])...));
+}
+
+// Applies an arbitrary elementwise functor (same shape as the functors passed
+// to gpu_kernel: opmath_t(opmath_t...) with depth - 1 arguments) across a list
+// of tensor groups in a single launch, using the block_to_tensor/block_to_chunk
+// descriptor table from MultiTensorApply.cuh. This is the generic counterpart
+// of the fixed Unary/Binary/Pointwise functors above: ops that aren't worth a
+// bespoke functor can still batch thousands of small tensors into one kernel
+// instead of one launch per tensor.
+template<typename T, int depth>
+struct GenericElementwiseFunctor {
+    using opmath_t = at::opmath_type<T>;
+    static constexpr int kArity = depth - 1;
+    template<typename Op> __device__ __forceinline__ void operator() (
+        int chunk_size,
+        TensorListMetadata<depth>& tl,
+        Op op) {
+            int tensor_loc = tl.block_to_tensor[blockIdx.x];
+            int chunk_idx = tl.block_to_chunk[blockIdx.x];
+            int n = tl.numel_for_tensor[tensor_loc];
+
+            T* args[depth];
+            bool all_aligned = init_args<depth>(args, tl, chunk_idx, chunk_size, tensor_loc);
+            n -= chunk_idx * chunk_size;
+            T r_args[kArity][kILP];
+
+            // to make things simple, we put aligned case in a different code path
+            if(n % kILP == 0 && chunk_size % kILP == 0 && all_aligned) {
+                for(int i_start = threadIdx.x; i_start * kILP < n && i_start * kILP < chunk_size; i_start += blockDim.x) {
+                    // load
+#pragma unroll
+                    for(int r_index = 0; r_index < kArity; r_index++) {
+                        load_store(r_args[r_index], args[r_index], 0, i_start);
+                    }
+#pragma unroll
+                    for(int ii = 0; ii < kILP; ii++) {
+                        r_args[0][ii] = invoke_with_r_args<Op, T, opmath_t>(
+                            op, r_args, ii, std::make_index_sequence<kArity>{});
+                    }
+                    // store
+                    load_store(args[depth - 1], r_args[0], i_start, 0);
+                }
+            }
+            else {
+                for(int i_start = 0; i_start < n && i_start < chunk_size; i_start += blockDim.x * kILP) {
+                    load_args<kArity>(r_args, args, i_start, chunk_size, n);
+#pragma unroll
+                    for(int ii = 0; ii < kILP; ii++) {
+                        r_args[0][ii] = invoke_with_r_args<Op, T, opmath_t>(
+                            op, r_args, ii, std::make_index_sequence<kArity>{});
+                    }
+                    store_args(args[depth - 1], r_args[0], i_start, chunk_size, n);
+                }
+            }
+        }
+};
+
+// Host-side entry point for GenericElementwiseFunctor. tensor_lists holds
+// depth - 1 input lists followed by the output list, all of dtype T; callers
+// are responsible for the same preconditions the foreach fast routes check
+// (see can_use_fast_route in ForeachUtils.h: matching sizes, contiguous,
+// same device, no type promotion).
+template<typename T, int depth, typename Op>
+void multi_tensor_elementwise_apply(
+    std::vector<std::vector<at::Tensor>>& tensor_lists,
+    Op op) {
+        multi_tensor_apply<depth>(
+            tensor_lists,
+            GenericElementwiseFunctor<T, depth>(),
+            op);
+}
+
 } // namespace
 }} // namespace at::native
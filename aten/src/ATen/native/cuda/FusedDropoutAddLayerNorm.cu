@@ -0,0 +1,300 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/native/layer_norm.h>
+
+#include <thrust/tuple.h>
+
+#include <ATen/core/Tensor.h>
+#include <ATen/AccumulateType.h>
+#include <ATen/Dispatch.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/Utils.h>
+#include <ATen/cuda/CUDAGeneratorImpl.h>
+#include <ATen/cuda/CUDAGraphsUtils.cuh>
+#include <ATen/native/SharedReduceOps.h>
+#include <ATen/native/cuda/block_reduce.cuh>
+#include <c10/cuda/CUDAMathCompat.h>
+#include <curand_kernel.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_fused_dropout_add_layer_norm_native.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/empty_like.h>
+#include <ATen/ops/empty_like_native.h>
+#include <ATen/ops/native_layer_norm.h>
+#include <ATen/ops/ones_like.h>
+#include <ATen/ops/zeros_like.h>
+#endif
+
+namespace at {
+namespace native {
+
+namespace {
+
+constexpr int kCUDANumThreads = 256;
+// philox generates 128 bits of randomness at a time; consuming all four
+// values of each curand_uniform4 call keeps the counter offset exact.
+constexpr int kRandUnroll = 4;
+
+// Fuses dropout(input) + residual followed by LayerNorm over the sum,
+// one block per row. The dropout-add result H has to be materialized
+// anyway (the backward needs it as the LayerNorm input), so the fusion
+// saves the separate mask apply and add passes and the extra read of the
+// un-normalized activation by the standalone moments kernel: H is written
+// once and re-read while still L2-resident for the normalization.
+template <typename T, typename T_ACC, typename mask_t>
+__global__ void FusedDropoutAddLayerNormCUDAKernel(
+    int64_t N,
+    T_ACC keep_p,
+    T_ACC scale,
+    T_ACC eps,
+    const T* X,
+    const T* R,
+    const T* gamma,
+    const T* beta,
+    PhiloxCudaState philox_args,
+    T* H,
+    mask_t* mask,
+    T_ACC* mean,
+    T_ACC* rstd,
+    T* Y) {
+  using WelfordType = WelfordData<T_ACC, int64_t, T_ACC>;
+  using WelfordOp =
+      WelfordOps<T_ACC, T_ACC, int64_t, T_ACC, thrust::pair<T_ACC, T_ACC>>;
+
+  __shared__
+      typename std::aligned_storage<sizeof(WelfordType), alignof(WelfordType)>::
+          type val_shared[C10_WARP_SIZE];
+  WelfordType* val_shared_ptr = reinterpret_cast<WelfordType*>(val_shared);
+  __shared__ T_ACC s_mean;
+  __shared__ T_ACC s_rstd;
+
+  const int64_t i = blockIdx.x;
+
+  auto seeds = at::cuda::philox::unpack(philox_args);
+  curandStatePhilox4_32_10_t state;
+  curand_init(
+      std::get<0>(seeds),
+      blockIdx.x * blockDim.x + threadIdx.x,
+      std::get<1>(seeds),
+      &state);
+
+  WelfordOp welford_op = {/*correction=*/0, /*take_sqrt=*/false};
+  WelfordType val(0, 0, 0, 0);
+
+  for (int64_t j = threadIdx.x * kRandUnroll; j < N;
+       j += static_cast<int64_t>(blockDim.x) * kRandUnroll) {
+    const float4 rand = curand_uniform4(&state);
+#pragma unroll
+    for (int ii = 0; ii < kRandUnroll; ++ii) {
+      const int64_t col = j + ii;
+      if (col < N) {
+        const int64_t index = i * N + col;
+        const mask_t keep = static_cast<mask_t>((&rand.x)[ii] < keep_p);
+        const T_ACC h = static_cast<T_ACC>(X[index]) * keep * scale +
+            static_cast<T_ACC>(R[index]);
+        H[index] = static_cast<T>(h);
+        mask[index] = keep;
+        val = welford_op.reduce(val, h, index);
+      }
+    }
+  }
+
+  val = cuda_utils::BlockReduce(
+      val,
+      welford_op,
+      /*identity_element=*/WelfordType(0, 0, 0, 0),
+      val_shared_ptr);
+
+  if (threadIdx.x == 0) {
+    T_ACC m1;
+    T_ACC m2;
+    thrust::tie(m2, m1) = welford_op.project(val);
+    mean[i] = m1;
+    rstd[i] = c10::cuda::compat::rsqrt(m2 + eps);
+    s_mean = m1;
+    s_rstd = rstd[i];
+  }
+  __syncthreads();
+
+  for (int64_t j = threadIdx.x; j < N; j += blockDim.x) {
+    const int64_t index = i * N + j;
+    const T_ACC gamma_v =
+        gamma == nullptr ? T_ACC(1) : static_cast<T_ACC>(gamma[j]);
+    const T_ACC beta_v =
+        beta == nullptr ? T_ACC(0) : static_cast<T_ACC>(beta[j]);
+    Y[index] =
+        (static_cast<T_ACC>(H[index]) - s_mean) * s_rstd * gamma_v + beta_v;
+  }
+}
+
+// Shared by the no-dropout short-cuts: normalizes an already computed
+// dropout-add result H with at::native_layer_norm and packages the outputs
+// in the fused op's return convention.
+std::tuple<Tensor, Tensor, Tensor, Tensor, Tensor> layer_norm_on_dropout_add(
+    Tensor H,
+    Tensor mask,
+    IntArrayRef normalized_shape,
+    const c10::optional<Tensor>& weight_opt,
+    const c10::optional<Tensor>& bias_opt,
+    double eps) {
+  auto ln = at::native_layer_norm(H, normalized_shape, weight_opt, bias_opt, eps);
+  return std::make_tuple(
+      std::move(std::get<0>(ln)),
+      std::move(H),
+      std::move(mask),
+      std::move(std::get<1>(ln)),
+      std::move(std::get<2>(ln)));
+}
+
+} // namespace
+
+std::tuple<Tensor, Tensor, Tensor, Tensor, Tensor>
+fused_dropout_add_layer_norm_cuda(
+    const Tensor& input,
+    const Tensor& residual,
+    IntArrayRef normalized_shape,
+    const c10::optional<Tensor>& weight_opt /* optional */,
+    const c10::optional<Tensor>& bias_opt /* optional */,
+    double p,
+    double eps,
+    bool train,
+    c10::optional<Generator> generator) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> weight_maybe_owned =
+      at::borrow_from_optional_tensor(weight_opt);
+  const Tensor& weight = *weight_maybe_owned;
+  c10::MaybeOwned<Tensor> bias_maybe_owned =
+      at::borrow_from_optional_tensor(bias_opt);
+  const Tensor& bias = *bias_maybe_owned;
+
+  TORCH_CHECK(
+      p >= 0 && p <= 1,
+      "dropout probability has to be between 0 and 1, but got ",
+      p);
+  TORCH_CHECK(
+      input.sizes() == residual.sizes(),
+      "fused_dropout_add_layer_norm: expected input and residual to have "
+      "the same shape, but got ",
+      input.sizes(),
+      " and ",
+      residual.sizes());
+
+  auto M_N = _check_layer_norm_inputs(input, normalized_shape, weight, bias);
+  auto M = M_N.first;
+  auto N = M_N.second;
+  auto X = input.expect_contiguous();
+  auto R = residual.expect_contiguous();
+  auto gamma = weight.expect_contiguous();
+  auto beta = bias.expect_contiguous();
+
+  // Short-cuts mirroring native_dropout_cuda: in eval mode (or with p == 0)
+  // dropout is the identity; with p == 1 everything is dropped.
+  if (!train || p == 0) {
+    return layer_norm_on_dropout_add(
+        X->add(*R),
+        at::ones_like(
+            *X, X->options().dtype(c10::CppTypeToScalarType<bool>::value)),
+        normalized_shape,
+        weight_opt,
+        bias_opt,
+        eps);
+  }
+  if (p == 1) {
+    return layer_norm_on_dropout_add(
+        R->clone(),
+        at::zeros_like(
+            *X, X->options().dtype(c10::CppTypeToScalarType<bool>::value)),
+        normalized_shape,
+        weight_opt,
+        bias_opt,
+        eps);
+  }
+
+  Tensor Y = at::native::empty_like(
+      *X,
+      c10::nullopt /* dtype */,
+      c10::nullopt /* layout */,
+      c10::nullopt /* device */,
+      c10::nullopt /* pin_memory */,
+      LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  Tensor H = at::native::empty_like(
+      *X,
+      c10::nullopt /* dtype */,
+      c10::nullopt /* layout */,
+      c10::nullopt /* device */,
+      c10::nullopt /* pin_memory */,
+      LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  Tensor mask = at::empty_like(
+      *X, X->options().dtype(c10::CppTypeToScalarType<bool>::value));
+  auto acc_type = at::toAccumulateType(input.scalar_type(), /*is_cuda=*/true);
+  Tensor mean = at::empty({M}, X->options().dtype(acc_type));
+  Tensor rstd = at::empty({M}, X->options().dtype(acc_type));
+
+  if (M > 0) {
+    auto gen = get_generator_or_default<CUDAGeneratorImpl>(
+        generator, cuda::detail::getDefaultCUDAGenerator());
+    // Each thread draws ceil(N / (block * kRandUnroll)) float4s.
+    int64_t counter_offset =
+        ((N - 1) / (kCUDANumThreads * kRandUnroll) + 1) * kRandUnroll;
+    PhiloxCudaState rng_engine_inputs;
+    {
+      // See Note [Acquire lock when using random generators]
+      std::lock_guard<std::mutex> lock(gen->mutex_);
+      rng_engine_inputs = gen->philox_cuda_state(counter_offset);
+    }
+
+    cudaStream_t cuda_stream = at::cuda::getCurrentCUDAStream();
+    AT_DISPATCH_FLOATING_TYPES_AND2(
+        at::ScalarType::Half,
+        at::ScalarType::BFloat16,
+        input.scalar_type(),
+        "fused_dropout_add_layer_norm_cuda",
+        [&] {
+          using T_ACC = acc_type<scalar_t, true>;
+          FusedDropoutAddLayerNormCUDAKernel<scalar_t, T_ACC, bool>
+              <<<M, kCUDANumThreads, 0, cuda_stream>>>(
+                  N,
+                  static_cast<T_ACC>(1. - p),
+                  static_cast<T_ACC>(1. / (1. - p)),
+                  static_cast<T_ACC>(eps),
+                  X->data_ptr<scalar_t>(),
+                  R->data_ptr<scalar_t>(),
+                  gamma->defined() ? gamma->data_ptr<scalar_t>() : nullptr,
+                  beta->defined() ? beta->data_ptr<scalar_t>() : nullptr,
+                  rng_engine_inputs,
+                  H.data_ptr<scalar_t>(),
+                  mask.data_ptr<bool>(),
+                  mean.data_ptr<T_ACC>(),
+                  rstd.data_ptr<T_ACC>(),
+                  Y.data_ptr<scalar_t>());
+          C10_CUDA_KERNEL_LAUNCH_CHECK();
+        });
+  }
+
+  const auto input_shape = input.sizes();
+  const size_t axis = input.dim() - normalized_shape.size();
+
+  std::vector<int64_t> stat_shape;
+  for (size_t idx = 0; idx < axis; ++idx) {
+    stat_shape.push_back(input_shape[idx]);
+  }
+  for (size_t idx = axis; idx < input.dim(); ++idx) {
+    stat_shape.push_back(1);
+  }
+
+  mean = mean.view(stat_shape);
+  rstd = rstd.view(stat_shape);
+
+  return std::make_tuple(
+      std::move(Y),
+      std::move(H),
+      std::move(mask),
+      std::move(mean),
+      std::move(rstd));
+}
+
+} // namespace native
+} // namespace at
@@ -0,0 +1,115 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/Dispatch.h>
+#include <ATen/ceil_div.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <c10/cuda/CUDAException.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_index_select_cast_scale_native.h>
+#include <ATen/ops/empty.h>
+#endif
+
+// CUDA side of _index_select_cast_scale; see
+// Note [index_select_cast_scale] in TensorAdvancedIndexing.cpp. One pass:
+// each output element reads its table element, converts to float and
+// multiplies by the per-row scale, so the gathered rows are never written
+// in the table dtype first.
+
+namespace at {
+namespace native {
+
+namespace {
+
+template <typename scalar_t, typename index_t>
+__global__ void index_select_cast_scale_kernel(
+    float* out,
+    const scalar_t* table,
+    const index_t* indices,
+    const float* scale,
+    int64_t num_indices,
+    int64_t num_rows,
+    int64_t row_size) {
+  const int64_t total = num_indices * row_size;
+  const int64_t stride = static_cast<int64_t>(blockDim.x) * gridDim.x;
+  for (int64_t i = static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+       i < total;
+       i += stride) {
+    const int64_t out_row = i / row_size;
+    const int64_t col = i - out_row * row_size;
+    const index_t src_row = indices[out_row];
+    CUDA_KERNEL_ASSERT(src_row >= 0 && src_row < num_rows);
+    out[i] = static_cast<float>(table[src_row * row_size + col]) *
+        scale[src_row];
+  }
+}
+
+} // namespace
+
+Tensor index_select_cast_scale_cuda(
+    const Tensor& self,
+    const Tensor& index,
+    const Tensor& scale) {
+  TORCH_CHECK(
+      self.dim() == 2,
+      "index_select_cast_scale(): Expected a 2-D table, got ", self.dim(), "-D");
+  TORCH_CHECK_INDEX(
+      index.dim() <= 1,
+      "index_select_cast_scale(): Index is supposed to be a vector");
+  TORCH_CHECK(
+      index.scalar_type() == ScalarType::Long || index.scalar_type() == ScalarType::Int,
+      "index_select_cast_scale(): Expected dtype int32 or int64 for index");
+  TORCH_CHECK(
+      scale.dim() == 1 && scale.size(0) == self.size(0),
+      "index_select_cast_scale(): Expected scale to be a vector of length ",
+      self.size(0), ", got sizes ", scale.sizes());
+  TORCH_CHECK(
+      scale.scalar_type() == ScalarType::Float,
+      "index_select_cast_scale(): Expected float scale, got ", scale.scalar_type());
+
+  auto self_contig = self.contiguous();
+  auto index_contig = index.contiguous();
+  auto scale_contig = scale.contiguous();
+
+  const int64_t num_rows = self.size(0);
+  const int64_t row_size = self.size(1);
+  const int64_t num_indices = index.numel();
+
+  Tensor result = at::empty(
+      {num_indices, row_size}, self.options().dtype(ScalarType::Float));
+  const int64_t total = num_indices * row_size;
+  if (total == 0) {
+    return result;
+  }
+
+  const int64_t threads = 256;
+  const int64_t blocks = std::min(
+      at::ceil_div(total, threads),
+      static_cast<int64_t>(at::cuda::getCurrentDeviceProperties()
+                               ->maxGridSize[0]));
+  auto stream = at::cuda::getCurrentCUDAStream();
+
+  AT_DISPATCH_INDEX_TYPES(
+      index_contig.scalar_type(), "index_select_cast_scale_cuda", [&] {
+    AT_DISPATCH_ALL_TYPES_AND2(ScalarType::Half, ScalarType::BFloat16,
+        self.scalar_type(), "index_select_cast_scale_cuda", [&] {
+      index_select_cast_scale_kernel<scalar_t, index_t>
+          <<<blocks, threads, 0, stream>>>(
+              result.data_ptr<float>(),
+              self_contig.data_ptr<scalar_t>(),
+              index_contig.data_ptr<index_t>(),
+              scale_contig.data_ptr<float>(),
+              num_indices,
+              num_rows,
+              row_size);
+      C10_CUDA_KERNEL_LAUNCH_CHECK();
+    });
+  });
+  return result;
+}
+
+} // namespace native
+} // namespace at
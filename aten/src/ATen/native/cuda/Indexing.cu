@@ -3,6 +3,7 @@
 #include <ATen/native/IndexingUtils.h>
 #include <ATen/native/quantized/IndexKernel.h>
 #include <ATen/native/cuda/KernelUtils.cuh>
+#include <ATen/native/cuda/EmbeddingBackwardKernel.cuh>
 
 #include <ATen/core/Tensor.h>
 #include <ATen/ceil_div.h>
@@ -390,6 +391,37 @@ void index_put_with_sort_kernel(Tensor & self, const c10::List<c10::optional<Ten
           linearIndex.numel()*sliceSize*nElemBefore == expandedValue.numel(),
           "number of flattened indices did not match number of elements in the value tensor: ",
           linearIndex.numel()*sliceSize*nElemBefore, " vs ", expandedValue.numel());
+
+      // [Note: segment-reduce path for accumulating index_put]
+      // indexing_backward_kernel walks each run of duplicate indices serially
+      // within one warp, so a skewed (e.g. Zipfian) index distribution with a
+      // few very hot rows degenerates to a serial read-modify-write per
+      // duplicate. For large accumulating puts we instead reuse the embedding
+      // backward machinery: it splits each sorted segment into fixed-size
+      // partial segments summed in parallel, then combines the partials per
+      // destination row in a fixed order, so the result stays deterministic.
+      // It scatters the sums into a zeroed [num_rows, sliceSize] buffer that
+      // we add into self afterwards; that extra table-sized traffic only pays
+      // off when there is at least a duplicate per row on average, hence the
+      // num_indices >= num_rows condition.
+      constexpr int64_t kMinIndicesForSegmentReduce = 16384;
+      const int64_t num_rows = src_.numel() / (sliceSize * std::max<int64_t>(1, nElemBefore));
+      if (accumulate && nElemBefore == 1 &&
+          num_indices >= kMinIndicesForSegmentReduce &&
+          num_indices >= num_rows &&
+          at::isFloatingType(src_.scalar_type())) {
+        auto value2d = expandedValue.view({num_indices, sliceSize});
+        auto summed = embedding_backward_cuda_kernel(
+            value2d, orig_indices, sorted_indices, Tensor(), num_rows);
+        src_.view({num_rows, sliceSize}).add_(summed);
+        if (permuted) {
+          self.copy_(src_.permute(inversePerm));
+        } else if (!self_contiguous) {
+          self.copy_(self_);
+        }
+        return;
+      }
+
       const int UNROLL = 4;
       const int indices_per_block = 4;
       const int warp_size = at::cuda::warp_size();
@@ -781,6 +781,21 @@ struct ReduceOp {
     }
   }
 
+  // Note [Deterministic split reductions]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // When the input is split across thread-blocks (config.ctas_per_output > 1),
+  // every block writes its partial to a per-output staging slot indexed by
+  // blockIdx.y and the last block to arrive combines all slots. The only
+  // atomic involved is the semaphore arrival counter in
+  // mark_block_finished(), which decides *which* block performs the final
+  // combine but not the combine order: each thread of the final block walks
+  // the staging slots in increasing slot index and the cross-thread tree
+  // reductions (block_y_reduce / block_x_reduce) pair lanes in a fixed
+  // pattern. The result is therefore bitwise reproducible run to run for a
+  // given shape and device, and split reductions do not need to be disabled
+  // under torch.use_deterministic_algorithms. (The combine order does depend
+  // on the launch configuration, so results may still differ across shapes,
+  // devices, or releases.)
   template <int output_vec_size>
   C10_DEVICE at::detail::Array<arg_t, output_vec_size> global_reduce(at::detail::Array<arg_t, output_vec_size> value, at::detail::Array<arg_t, output_vec_size> *acc, char* shared_memory) const {
     using arg_vec_t = at::detail::Array<arg_t, output_vec_size>;
@@ -433,6 +433,40 @@ void scan_innermost_dim(const TensorBase& self, const TensorBase& result,
   C10_CUDA_KERNEL_LAUNCH_CHECK();
 }
 
+/* cub::DeviceScan is a single-pass decoupled-lookback scan that runs at
+ * memcpy-like bandwidth, but it only handles a single row.
+ * tensor_kernel_scan_innermost_dim walks each row with a 16-lane slice of a
+ * block, which is the right shape when there are enough rows to fill the
+ * device, but leaves most SMs idle when a few very long rows are scanned
+ * (e.g. top-p sampling's cumsum over the vocabulary). For that shape, scan
+ * the rows one after another with cub: each launch saturates the device on
+ * its own, which more than pays for the extra launches. Returns false when
+ * the shape is better served by the batched block-scan kernel.
+ */
+template <typename scalar_t, class BinaryFunction>
+bool scan_innermost_dim_rowwise_cub(const TensorBase& self, const TensorBase& result,
+                                    BinaryFunction binary_op) {
+  constexpr int64_t min_row_size = 65536;
+  const int64_t row_size = self.size(self.dim() - 1);
+  const int64_t num_rows = self.numel() / row_size;
+  if (row_size < min_row_size) {
+    return false;
+  }
+  // With >= one block of 32 rows per SM the batched kernel fills the device.
+  const int64_t num_sm =
+      at::cuda::getCurrentDeviceProperties()->multiProcessorCount;
+  if (ceil_div(num_rows, int64_t{32}) >= num_sm) {
+    return false;
+  }
+  const scalar_t* src = self.data_ptr<scalar_t>();
+  scalar_t* tgt = result.data_ptr<scalar_t>();
+  for (int64_t row = 0; row < num_rows; ++row) {
+    cuda::cub::inclusive_scan(
+        src + row * row_size, tgt + row * row_size, binary_op, row_size);
+  }
+  return true;
+}
+
 template<typename scalar_t, typename BinaryFunction>
 void scan_dim(const TensorBase& self, const TensorBase& result,
      int64_t dim, scalar_t init, BinaryFunction binary_op) {
@@ -443,7 +477,9 @@ void scan_dim(const TensorBase& self, const TensorBase& result,
   if (self.numel() == self.size(dim)) {
     cuda::cub::inclusive_scan(self_->data_ptr<scalar_t>(), result.data_ptr<scalar_t>(), binary_op, self.numel());
   } else if (dim == ndim - 1) {
-    scan_innermost_dim<scalar_t>(*self_, result, init, binary_op);
+    if (!scan_innermost_dim_rowwise_cub<scalar_t>(*self_, result, binary_op)) {
+      scan_innermost_dim<scalar_t>(*self_, result, init, binary_op);
+    }
   } else {
     scan_outer_dim<scalar_t>(*self_, result, dim, init, binary_op);
   }
@@ -19,6 +19,7 @@
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
 #else
+#include <ATen/ops/empty.h>
 #include <ATen/ops/_masked_softmax_native.h>
 #include <ATen/ops/_log_softmax_native.h>
 #include <ATen/ops/_log_softmax_backward_data_native.h>
@@ -663,6 +664,164 @@ cunn_SoftMaxForward(outscalar_t *output, scalar_t *input, int classes)
   }
 }
 
+// [Note: split softmax for long rows]
+// cunn_SoftMaxForward assigns one block per row, so when outer_size is small
+// (e.g. attention over a handful of very long sequences) all but outer_size
+// SMs sit idle no matter how large dim_size is. The kernels below recover the
+// lost parallelism by splitting each row into fixed-size chunks handled by
+// independent blocks. Rather than a cooperative launch (which would tie the
+// grid size to cudaLaunchCooperativeKernel's occupancy limits), the per-chunk
+// (max, sum_exp) pairs go through a small scratch buffer and a per-row combine
+// kernel: sum_exp terms computed against a chunk-local max rescale exactly as
+// sum_c * exp(max_c - max_row). The single-kernel path already reads the input
+// twice, so the extra launches only add the (tiny) scratch traffic.
+
+template <int ILP, typename scalar_t, typename accscalar_t>
+__global__ void
+cunn_SoftMaxForwardPartial(accscalar_t *partial_max, accscalar_t *partial_sum,
+                           scalar_t *input, int classes, int chunk_size, int chunks_per_row)
+{
+  extern __shared__ unsigned char smem[];
+  auto sdata = reinterpret_cast<accscalar_t*>(smem);
+
+  int64_t begin = static_cast<int64_t>(blockIdx.y) * chunk_size;
+  input += static_cast<int64_t>(blockIdx.x) * classes + begin;
+  int size = ::min(static_cast<int64_t>(chunk_size), classes - begin);
+
+  const int shift = ((uint64_t)input) % ALIGN_BYTES / sizeof(scalar_t);
+
+  accscalar_t threadMax = ilpReduce<MaxFloat, ILP, scalar_t, accscalar_t>(
+      shift, input, size, MaxFloat<scalar_t, accscalar_t>(), -at::numeric_limits<accscalar_t>::max());
+  accscalar_t max_k = blockReduce<Max, accscalar_t>(
+      sdata, threadMax, Max<accscalar_t>(), -at::numeric_limits<accscalar_t>::max());
+
+  accscalar_t threadExp = ilpReduce<SumExpFloat, ILP, scalar_t, accscalar_t>(
+      shift, input, size, SumExpFloat<scalar_t, accscalar_t>(max_k), static_cast<accscalar_t>(0));
+  accscalar_t sum_k = blockReduce<Add, accscalar_t>(
+      sdata, threadExp, Add<accscalar_t>(), static_cast<accscalar_t>(0));
+
+  if (threadIdx.x == 0) {
+    partial_max[static_cast<int64_t>(blockIdx.x) * chunks_per_row + blockIdx.y] = max_k;
+    partial_sum[static_cast<int64_t>(blockIdx.x) * chunks_per_row + blockIdx.y] = sum_k;
+  }
+}
+
+template <typename accscalar_t>
+__global__ void
+cunn_SoftMaxCombinePartials(accscalar_t *row_max, accscalar_t *row_sum,
+                            const accscalar_t *partial_max, const accscalar_t *partial_sum,
+                            int chunks_per_row)
+{
+  extern __shared__ unsigned char smem[];
+  auto sdata = reinterpret_cast<accscalar_t*>(smem);
+
+  partial_max += static_cast<int64_t>(blockIdx.x) * chunks_per_row;
+  partial_sum += static_cast<int64_t>(blockIdx.x) * chunks_per_row;
+
+  accscalar_t threadMax = -at::numeric_limits<accscalar_t>::max();
+  for (int i = threadIdx.x; i < chunks_per_row; i += blockDim.x) {
+    threadMax = ::max(threadMax, partial_max[i]);
+  }
+  accscalar_t max_k = blockReduce<Max, accscalar_t>(
+      sdata, threadMax, Max<accscalar_t>(), -at::numeric_limits<accscalar_t>::max());
+
+  // rescale each chunk's sum of exp(v - max_chunk) to the row max
+  accscalar_t threadSum = 0;
+  for (int i = threadIdx.x; i < chunks_per_row; i += blockDim.x) {
+    threadSum += partial_sum[i] * std::exp(partial_max[i] - max_k);
+  }
+  accscalar_t sumAll = blockReduce<Add, accscalar_t>(
+      sdata, threadSum, Add<accscalar_t>(), static_cast<accscalar_t>(0));
+
+  if (threadIdx.x == 0) {
+    row_max[blockIdx.x] = max_k;
+    row_sum[blockIdx.x] = sumAll;
+  }
+}
+
+template <int ILP, typename scalar_t, typename accscalar_t, typename outscalar_t, template <typename, typename, typename> class Epilogue>
+__global__ void
+cunn_SoftMaxApplyEpilogue(outscalar_t *output, scalar_t *input,
+                          const accscalar_t *row_max, const accscalar_t *row_sum,
+                          int classes, int chunk_size)
+{
+  int64_t begin = static_cast<int64_t>(blockIdx.y) * chunk_size;
+  input += static_cast<int64_t>(blockIdx.x) * classes + begin;
+  output += static_cast<int64_t>(blockIdx.x) * classes + begin;
+  int size = ::min(static_cast<int64_t>(chunk_size), classes - begin);
+
+  Epilogue<scalar_t, accscalar_t, outscalar_t> epilogue(row_max[blockIdx.x], row_sum[blockIdx.x]);
+
+  const int shift = ((uint64_t)input) % ALIGN_BYTES / sizeof(scalar_t);
+  const int output_shift = ((uint64_t)output) % ALIGN_BYTES / sizeof(outscalar_t);
+
+  if (shift == output_shift) {
+    WriteFpropResultsVectorized<ILP, scalar_t, accscalar_t, outscalar_t, Epilogue>(size, shift, input, output, epilogue);
+  } else {
+    WriteFpropResults<ILP, scalar_t, accscalar_t, outscalar_t, Epilogue>(size, input, output, epilogue);
+  }
+}
+
+// Multi-block-per-row forward softmax; see [Note: split softmax for long rows].
+// Returns false (without launching anything) when the regular one-block-per-row
+// kernel already fills the device, leaving the caller on the existing path.
+template <int ILP, typename scalar_t, typename accscalar_t, typename outscalar_t, template <typename, typename, typename> class Epilogue>
+bool try_split_softmax_forward(outscalar_t *output, scalar_t *input,
+                               int64_t dim_size, int64_t outer_size,
+                               const TensorOptions& options, cudaStream_t stream) {
+  // Small enough chunks to spread rows out, large enough that the partial
+  // reductions stay bandwidth bound.
+  constexpr int64_t min_chunk_size = 32768;
+  const int64_t num_sm = at::cuda::getCurrentDeviceProperties()->multiProcessorCount;
+  if (outer_size >= num_sm || dim_size < 2 * min_chunk_size) {
+    return false;
+  }
+  int64_t chunks_per_row = std::min(
+      (dim_size + min_chunk_size - 1) / min_chunk_size,
+      (4 * num_sm + outer_size - 1) / outer_size);
+  // Round the chunk size up to a multiple of 1024 elements so every chunk
+  // starts at the same 16-byte shift as its row and the vectorized writers
+  // stay engaged.
+  int64_t chunk_size = (dim_size + chunks_per_row - 1) / chunks_per_row;
+  chunk_size = (chunk_size + 1023) / 1024 * 1024;
+  chunks_per_row = (dim_size + chunk_size - 1) / chunk_size;
+  if (chunks_per_row <= 1) {
+    return false;
+  }
+
+  // Layout: [partial_max | partial_sum | row_max | row_sum]
+  auto scratch = at::empty(
+      {2 * outer_size * chunks_per_row + 2 * outer_size},
+      options.dtype(c10::CppTypeToScalarType<accscalar_t>::value));
+  accscalar_t* partial_max = scratch.data_ptr<accscalar_t>();
+  accscalar_t* partial_sum = partial_max + outer_size * chunks_per_row;
+  accscalar_t* row_max = partial_sum + outer_size * chunks_per_row;
+  accscalar_t* row_sum = row_max + outer_size;
+
+  dim3 grid(outer_size, chunks_per_row);
+  dim3 block = SoftMax_getBlockSize(ILP, chunk_size);
+  cunn_SoftMaxForwardPartial<ILP, scalar_t, accscalar_t>
+    <<<grid, block, block.x * sizeof(accscalar_t), stream>>>(
+      partial_max, partial_sum, input, dim_size, chunk_size, chunks_per_row);
+  C10_CUDA_KERNEL_LAUNCH_CHECK();
+
+  // blockReduce wants a power-of-two block of at least one full warp
+  int64_t combine_threads = at::cuda::warp_size();
+  while (combine_threads < chunks_per_row && combine_threads < max_threads) {
+    combine_threads *= 2;
+  }
+  cunn_SoftMaxCombinePartials<accscalar_t>
+    <<<outer_size, combine_threads, combine_threads * sizeof(accscalar_t), stream>>>(
+      row_max, row_sum, partial_max, partial_sum, chunks_per_row);
+  C10_CUDA_KERNEL_LAUNCH_CHECK();
+
+  cunn_SoftMaxApplyEpilogue<ILP, scalar_t, accscalar_t, outscalar_t, Epilogue>
+    <<<grid, block, 0, stream>>>(
+      output, input, row_max, row_sum, dim_size, chunk_size);
+  C10_CUDA_KERNEL_LAUNCH_CHECK();
+  return true;
+}
+
 template <int ILP, typename scalar_t, typename accscalar_t, typename outscalar_t, template<typename, typename, typename> class Epilogue>
 __global__ void
 cunn_SoftMaxBackward(scalar_t *gradInput, outscalar_t *output, outscalar_t *gradOutput, int classes)
@@ -736,11 +895,15 @@ Tensor host_softmax(const Tensor & input_, const int64_t dim_, const bool half_t
             }
           } else {
             constexpr int ILP = sizeof(float4) / sizeof(scalar_t);
-            dim3 block = SoftMax_getBlockSize(ILP, dim_size);
-            cunn_SoftMaxForward<ILP, scalar_t, accscalar_t, scalar_t, Epilogue>
-              <<<grid, block, block.x * sizeof(accscalar_t), stream>>>(
-                output.data_ptr<scalar_t>(), input.data_ptr<scalar_t>(), dim_size);
-            C10_CUDA_KERNEL_LAUNCH_CHECK();
+            if (!try_split_softmax_forward<ILP, scalar_t, accscalar_t, scalar_t, Epilogue>(
+                    output.data_ptr<scalar_t>(), input.data_ptr<scalar_t>(),
+                    dim_size, outer_size, input.options(), stream)) {
+              dim3 block = SoftMax_getBlockSize(ILP, dim_size);
+              cunn_SoftMaxForward<ILP, scalar_t, accscalar_t, scalar_t, Epilogue>
+                <<<grid, block, block.x * sizeof(accscalar_t), stream>>>(
+                  output.data_ptr<scalar_t>(), input.data_ptr<scalar_t>(), dim_size);
+              C10_CUDA_KERNEL_LAUNCH_CHECK();
+            }
           }
         } else {
           if (dim_size <= 1024 && dim_size*sizeof(scalar_t) <= 4096) {
@@ -757,11 +920,15 @@ Tensor host_softmax(const Tensor & input_, const int64_t dim_, const bool half_t
             }
           } else {
             constexpr int ILP = sizeof(float4) / sizeof(accscalar_t);
-            dim3 block = SoftMax_getBlockSize(ILP, dim_size);
-            cunn_SoftMaxForward<ILP, scalar_t, accscalar_t, accscalar_t, Epilogue>
-              <<<grid, block, block.x * sizeof(accscalar_t), stream>>>(
-                output.data_ptr<accscalar_t>(), input.data_ptr<scalar_t>(), dim_size);
-            C10_CUDA_KERNEL_LAUNCH_CHECK();
+            if (!try_split_softmax_forward<ILP, scalar_t, accscalar_t, accscalar_t, Epilogue>(
+                    output.data_ptr<accscalar_t>(), input.data_ptr<scalar_t>(),
+                    dim_size, outer_size, input.options(), stream)) {
+              dim3 block = SoftMax_getBlockSize(ILP, dim_size);
+              cunn_SoftMaxForward<ILP, scalar_t, accscalar_t, accscalar_t, Epilogue>
+                <<<grid, block, block.x * sizeof(accscalar_t), stream>>>(
+                  output.data_ptr<accscalar_t>(), input.data_ptr<scalar_t>(), dim_size);
+              C10_CUDA_KERNEL_LAUNCH_CHECK();
+            }
           }
         }
       });
@@ -259,6 +259,26 @@ static const Tensor& _exec_fft(Tensor& out, const Tensor& self, IntArrayRef out_
   // Create the transform plan (either from cache or locally)
   const auto value_type = c10::toRealValueType(input.scalar_type());
   auto fft_type = GetCuFFTTransformType(input.is_complex(), out.is_complex());
+
+  // If cuFFT cannot embed the input strides, the plan would have us clone the
+  // input into a contiguous buffer anyway (see CuFFTConfig::should_clone_input).
+  // Do the clone *before* building the cache key, so that every un-embeddable
+  // layout of a given signal size maps onto the single contiguous-input plan
+  // instead of thrashing the cache with one entry per stride pattern.
+  // Skipped on ROCm where every input is cloned at execution time regardless.
+#if !defined(USE_ROCM)
+  {
+    const bool onesided_input = fft_type == CuFFTTransformType::C2R;
+    bool must_clone =
+        as_cufft_embed(input.strides(), signal_size, onesided_input).must_clone;
+    // Half transforms additionally require a unit base stride (see CuFFTConfig)
+    must_clone |= value_type == ScalarType::Half && input.strides().back() != 1;
+    if (must_clone) {
+      input = input.clone(MemoryFormat::Contiguous);
+    }
+  }
+#endif
+
   CuFFTParams Params(input.strides(), out.strides(), signal_size, fft_type, value_type);
   CuFFTParamsLRUCache& plan_cache = cufft_get_plan_cache(input.device().index());
   std::unique_lock<std::mutex> guard(plan_cache.mutex, std::defer_lock);
@@ -32,6 +32,8 @@
   #define W_OK    2
   #define F_OK    0
 #else
+  #include <fcntl.h> // open
+  #include <sys/mman.h> // mmap
   #include <sys/types.h>
   #include <sys/stat.h> // mkdir
   #include <unistd.h>
@@ -1507,6 +1509,36 @@ NvrtcFunction jit_pwise_function(
     ss << "_" << hash_code;
     file_path = ss.str();
 
+#ifndef _WIN32
+    // Memory-maps the cached cubin and hands the mapping straight to
+    // cuModuleLoadData, which copies the image during the call. This avoids
+    // the intermediate heap buffer, and processes cold-starting on the same
+    // host share the page cache for hot kernels instead of each reading the
+    // file separately.
+    const int fd = open(file_path.c_str(), O_RDONLY);
+    if (fd != -1) {
+      // NOTE: a failed open does not warn because the file might not exist
+      struct stat file_stat{};
+      bool loaded = false;
+      if (fstat(fd, &file_stat) == 0 && file_stat.st_size > 0) {
+        void* mapped =
+            mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped != MAP_FAILED) {
+          AT_CUDA_DRIVER_CHECK(nvrtc.cuModuleLoadData(&(compiled_kernel_.module), mapped));
+          AT_CUDA_DRIVER_CHECK(
+            nvrtc.cuModuleGetFunction(&(compiled_kernel_.function), compiled_kernel_.module, name.c_str()));
+          munmap(mapped, file_stat.st_size);
+          loaded = true;
+        }
+      }
+      close(fd);
+      if (loaded) {
+        return compiled_kernel_;
+      }
+      // An empty or unmappable file (e.g. a torn write from an older build)
+      // falls through to recompilation, which then rewrites the cache entry.
+    }
+#else
     std::ifstream readin{file_path, std::ios::in | std::ifstream::binary};
     if (readin.fail()) {
       // NOTE: this does not warn because the file might not exist
@@ -1514,7 +1546,6 @@ NvrtcFunction jit_pwise_function(
       //   an informative warning
       readin.close();
     } else {
-      // TODO: try passing the "mapped" file directly to cuModuleLoadCall instead of using an intermediate buffer
       std::vector<char> buffer(std::istreambuf_iterator<char>(readin), {});
       AT_CUDA_DRIVER_CHECK(nvrtc.cuModuleLoadData(&(compiled_kernel_.module), buffer.data()));
       AT_CUDA_DRIVER_CHECK(
@@ -1522,6 +1553,7 @@ NvrtcFunction jit_pwise_function(
       readin.close();
       return compiled_kernel_;
     }
+#endif
   }
 
   // Just-in-time compiles the program
@@ -17,6 +17,7 @@
 #include <limits>
 #include <vector>
 #include <ATen/Config.h>
+#include <ATen/cuda/CUDAContext.h>
 #include <ATen/cuda/CUDAGraphsUtils.cuh>
 #include <ATen/cuda/Exceptions.h>
 #include <ATen/native/cudnn/ConvShared.h>
@@ -28,6 +29,11 @@
 #include <ATen/TensorUtils.h>
 #include <c10/util/irange.h>
 
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <functional>
 #include <iterator>
 #include <sstream>
@@ -104,13 +110,68 @@ std::ostream& operator<<(std::ostream & out, const ConvolutionArgs& args) {
 //
 // ---------------------------------------------------------------------
 
+// Note [Persistent cudnn benchmark cache]
+// With benchmark=true every process re-runs cudnnFind for each convolution
+// configuration it encounters, which can cost minutes of warmup after every
+// restart of an otherwise unchanged job. Setting the environment variable
+// TORCH_CUDNN_BENCHMARK_CACHE_DIR mirrors each algorithm cache to a binary
+// file in that directory: the file is loaded on first use and rewritten
+// (atomically, via rename to survive concurrent writers) whenever a new
+// result is inserted. Both ConvolutionParams and the cudnn perf structs are
+// PODs, so records are stored as raw bytes; a header recording the struct
+// sizes, the cudnn version and the visible devices is checked on load, and
+// the file is ignored wholesale on any mismatch. A stale-but-valid entry is
+// harmless: entries only record which algorithm to try first, and failures
+// fall through to a fresh cudnnFind as usual.
+
+constexpr uint64_t kBenchmarkCacheFileMagic = 0x37764e4e44556364ULL;
+constexpr uint32_t kBenchmarkCacheFormatVersion = 1;
+
+struct BenchmarkCacheDeviceSignature {
+  int32_t major;
+  int32_t minor;
+  char name[256];
+};
+
+struct BenchmarkCacheFileHeader {
+  uint64_t magic;
+  uint32_t format_version;
+  uint32_t params_size;
+  uint32_t result_size;
+  uint32_t num_devices;
+  uint64_t cudnn_version;
+};
+
+std::vector<BenchmarkCacheDeviceSignature> benchmark_cache_device_signatures() {
+  std::vector<BenchmarkCacheDeviceSignature> signatures(c10::cuda::device_count());
+  for (const auto i : c10::irange(signatures.size())) {
+    auto* prop = at::cuda::getDeviceProperties(i);
+    auto& sig = signatures[i];
+    std::memset(&sig, 0, sizeof(sig));
+    sig.major = prop->major;
+    sig.minor = prop->minor;
+    std::strncpy(sig.name, prop->name, sizeof(sig.name) - 1);
+  }
+  return signatures;
+}
+
+const char* benchmark_cache_dir() {
+  static const char* dir = std::getenv("TORCH_CUDNN_BENCHMARK_CACHE_DIR");
+  return dir;
+}
+
 // TODO: Use something less heavy duty than a big honking mutex
 template <typename T>
 struct BenchmarkCache {
   std::mutex mutex;
   std::unordered_map<ConvolutionParams, T, ParamsHash<ConvolutionParams>, ParamsEqual<ConvolutionParams>> map;
+  const char* file_tag;
+  std::once_flag load_once;
+
+  explicit BenchmarkCache(const char* tag) : file_tag(tag) {}
 
   bool find(const ConvolutionParams& params, T* results) {
+    std::call_once(load_once, [&] { loadFromDisk(); });
     std::lock_guard<std::mutex> guard(mutex);
     auto it = map.find(params);
     if (it == map.end()) {
@@ -121,14 +182,126 @@ struct BenchmarkCache {
   }
 
   void insert(const ConvolutionParams& params, const T& results) {
+    std::call_once(load_once, [&] { loadFromDisk(); });
     std::lock_guard<std::mutex> guard(mutex);
     map[params] = results;
+    saveToDisk();
+  }
+
+ private:
+  std::string filePath() const {
+    return std::string(benchmark_cache_dir()) + "/cudnn_v7_" + file_tag + ".bin";
+  }
+
+  // See Note [Persistent cudnn benchmark cache]. Never throws: a missing or
+  // invalid file just means starting with an empty cache.
+  void loadFromDisk() noexcept {
+    if (benchmark_cache_dir() == nullptr) {
+      return;
+    }
+    try {
+      std::ifstream file(filePath(), std::ios::binary);
+      if (!file) {
+        return;
+      }
+      BenchmarkCacheFileHeader header{};
+      file.read(reinterpret_cast<char*>(&header), sizeof(header));
+      const auto signatures = benchmark_cache_device_signatures();
+      if (!file || header.magic != kBenchmarkCacheFileMagic ||
+          header.format_version != kBenchmarkCacheFormatVersion ||
+          header.params_size != sizeof(ConvolutionParams) ||
+          header.result_size != sizeof(T) ||
+          header.num_devices != signatures.size() ||
+          header.cudnn_version != static_cast<uint64_t>(cudnnGetVersion())) {
+        return;
+      }
+      std::vector<BenchmarkCacheDeviceSignature> file_signatures(header.num_devices);
+      file.read(
+          reinterpret_cast<char*>(file_signatures.data()),
+          sizeof(BenchmarkCacheDeviceSignature) * file_signatures.size());
+      if (!file ||
+          std::memcmp(
+              file_signatures.data(),
+              signatures.data(),
+              sizeof(BenchmarkCacheDeviceSignature) * signatures.size()) != 0) {
+        return;
+      }
+      uint64_t count = 0;
+      file.read(reinterpret_cast<char*>(&count), sizeof(count));
+      std::lock_guard<std::mutex> guard(mutex);
+      for (C10_UNUSED const auto i : c10::irange(count)) {
+        ConvolutionParams params;
+        T result;
+        file.read(reinterpret_cast<char*>(&params), sizeof(params));
+        file.read(reinterpret_cast<char*>(&result), sizeof(result));
+        if (!file) {
+          break;
+        }
+        map.emplace(params, result);
+      }
+    } catch (const std::exception& e) {
+      TORCH_WARN_ONCE(
+          "Failed to load cudnn benchmark cache from ",
+          filePath(), ": ", e.what());
+    }
+  }
+
+  // Called with `mutex` held. Writes to a temp file and renames it over the
+  // destination so readers never observe a partial file.
+  void saveToDisk() noexcept {
+    if (benchmark_cache_dir() == nullptr) {
+      return;
+    }
+    try {
+      const auto path = filePath();
+      const auto tmp_path = path + ".tmp." +
+          std::to_string(
+              std::chrono::steady_clock::now().time_since_epoch().count());
+      {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+          return;
+        }
+        const auto signatures = benchmark_cache_device_signatures();
+        BenchmarkCacheFileHeader header{};
+        header.magic = kBenchmarkCacheFileMagic;
+        header.format_version = kBenchmarkCacheFormatVersion;
+        header.params_size = sizeof(ConvolutionParams);
+        header.result_size = sizeof(T);
+        header.num_devices = static_cast<uint32_t>(signatures.size());
+        header.cudnn_version = static_cast<uint64_t>(cudnnGetVersion());
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(
+            reinterpret_cast<const char*>(signatures.data()),
+            sizeof(BenchmarkCacheDeviceSignature) * signatures.size());
+        const uint64_t count = map.size();
+        file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        for (const auto& entry : map) {
+          file.write(reinterpret_cast<const char*>(&entry.first), sizeof(entry.first));
+          file.write(reinterpret_cast<const char*>(&entry.second), sizeof(entry.second));
+        }
+        if (!file) {
+          return;
+        }
+      }
+      if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        // Windows rename does not replace an existing destination.
+        std::remove(path.c_str());
+        if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+          std::remove(tmp_path.c_str());
+        }
+      }
+    } catch (const std::exception& e) {
+      TORCH_WARN_ONCE(
+          "Failed to save cudnn benchmark cache to ",
+          filePath(), ": ", e.what());
+    }
   }
 };
 
-BenchmarkCache<cudnnConvolutionFwdAlgoPerf_t> fwd_algos;
-BenchmarkCache<cudnnConvolutionBwdDataAlgoPerf_t> bwd_data_algos;
-BenchmarkCache<cudnnConvolutionBwdFilterAlgoPerf_t> bwd_filter_algos;
+BenchmarkCache<cudnnConvolutionFwdAlgoPerf_t> fwd_algos("fwd");
+BenchmarkCache<cudnnConvolutionBwdDataAlgoPerf_t> bwd_data_algos("bwd_data");
+BenchmarkCache<cudnnConvolutionBwdFilterAlgoPerf_t> bwd_filter_algos("bwd_filter");
 
 // TODO: Stop manually allocating CUDA memory; allocate an ATen byte
 // tensor instead.
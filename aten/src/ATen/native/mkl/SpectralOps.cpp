@@ -335,6 +335,13 @@ Tensor _fft_c2c_mkl(const Tensor& self, IntArrayRef dim, int64_t normalization,
 #include <ATen/mkl/Exceptions.h>
 #include <ATen/mkl/Descriptors.h>
 #include <ATen/mkl/Limits.h>
+#include <ATen/native/utils/ParamsHash.h>
+
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 
 namespace at { namespace native {
@@ -422,6 +429,87 @@ static DftiDescriptor _plan_mkl_fft(
   return descriptor;
 }
 
+// DftiCommitDescriptor is expensive: it selects and builds the actual FFT
+// kernels, which can dwarf the transform itself for short signals. Committed
+// descriptors are therefore cached and reused across calls, LRU-evicted.
+// The key covers everything _plan_mkl_fft bakes into a descriptor.
+// Transforms with more than kMaxMklFftSignalNdim signal dimensions are rare
+// and bypass the cache, planning per call as before.
+constexpr int64_t kMaxMklFftSignalNdim = 5;
+constexpr size_t kMklFftCacheMaxSize = 64;
+
+struct MklFftParams {
+  int64_t signal_ndim_;
+  // These include the additional batch dimension as well.
+  int64_t sizes_[kMaxMklFftSignalNdim + 1];
+  int64_t input_strides_[kMaxMklFftSignalNdim + 1];
+  int64_t output_strides_[kMaxMklFftSignalNdim + 1];
+  bool complex_input_;
+  bool complex_output_;
+  bool forward_;
+  int64_t normalization_;
+  ScalarType value_type_;
+};
+
+static_assert(std::is_trivial<MklFftParams>::value, "");
+
+static std::shared_ptr<DftiDescriptor> _get_mkl_fft_plan(
+    IntArrayRef in_strides, IntArrayRef out_strides, IntArrayRef sizes,
+    bool complex_input, bool complex_output,
+    int64_t normalization, bool forward, ScalarType dtype) {
+  const int64_t signal_ndim = sizes.size() - 1;
+  if (signal_ndim > kMaxMklFftSignalNdim) {
+    return std::make_shared<DftiDescriptor>(_plan_mkl_fft(
+        in_strides, out_strides, sizes, complex_input, complex_output,
+        normalization, forward, dtype));
+  }
+
+  MklFftParams params;
+  // Padding bits must be zeroed for hashing
+  memset(&params, 0, sizeof(params));
+  params.signal_ndim_ = signal_ndim;
+  std::copy(sizes.cbegin(), sizes.cend(), params.sizes_);
+  std::copy(in_strides.cbegin(), in_strides.cend(), params.input_strides_);
+  std::copy(out_strides.cbegin(), out_strides.cend(), params.output_strides_);
+  params.complex_input_ = complex_input;
+  params.complex_output_ = complex_output;
+  params.forward_ = forward;
+  params.normalization_ = normalization;
+  params.value_type_ = dtype;
+
+  using kv_t = std::pair<MklFftParams, std::shared_ptr<DftiDescriptor>>;
+  static std::list<kv_t> usage_list;
+  static std::unordered_map<MklFftParams, std::list<kv_t>::iterator,
+                            ParamsHash<MklFftParams>,
+                            ParamsEqual<MklFftParams>> cache_map;
+  static std::mutex cache_mutex;
+
+  // The mutex only guards the cache itself. MKL's compute functions are
+  // thread-safe on a committed descriptor (it is never modified after
+  // commit), and callers keep the descriptor alive through the shared_ptr
+  // even if a concurrent miss evicts their entry.
+  std::lock_guard<std::mutex> guard(cache_mutex);
+  auto it = cache_map.find(params);
+  if (it != cache_map.end()) {
+    usage_list.splice(usage_list.begin(), usage_list, it->second);
+    return it->second->second;
+  }
+
+  if (usage_list.size() >= kMklFftCacheMaxSize) {
+    auto last = std::prev(usage_list.end());
+    cache_map.erase(last->first);
+    usage_list.pop_back();
+  }
+
+  usage_list.emplace_front(
+      params,
+      std::make_shared<DftiDescriptor>(_plan_mkl_fft(
+          in_strides, out_strides, sizes, complex_input, complex_output,
+          normalization, forward, dtype)));
+  cache_map.emplace(usage_list.front().first, usage_list.begin());
+  return usage_list.front().second;
+}
+
 // Execute a general fft operation (can be c2c, onesided r2c or onesided c2r)
 static Tensor& _exec_fft(Tensor& out, const Tensor& self, IntArrayRef out_sizes,
                          IntArrayRef dim, int64_t normalization, bool forward) {
@@ -474,15 +562,15 @@ static Tensor& _exec_fft(Tensor& out, const Tensor& self, IntArrayRef out_sizes,
   const auto value_type = c10::toRealValueType(input.scalar_type());
   out.resize_(batched_out_sizes, MemoryFormat::Contiguous);
 
-  auto descriptor = _plan_mkl_fft(
+  auto descriptor = _get_mkl_fft_plan(
       input.strides(), out.strides(), signal_size, input.is_complex(),
       out.is_complex(), normalization, forward, value_type);
 
   // run the FFT
   if (forward) {
-    MKL_DFTI_CHECK(DftiComputeForward(descriptor.get(), input.data_ptr(), out.data_ptr()));
+    MKL_DFTI_CHECK(DftiComputeForward(descriptor->get(), input.data_ptr(), out.data_ptr()));
   } else {
-    MKL_DFTI_CHECK(DftiComputeBackward(descriptor.get(), input.data_ptr(), out.data_ptr()));
+    MKL_DFTI_CHECK(DftiComputeBackward(descriptor->get(), input.data_ptr(), out.data_ptr()));
   }
 
   // Inplace reshaping to original batch shape and inverting the dimension permutation
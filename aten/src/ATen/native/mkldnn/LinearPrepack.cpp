@@ -0,0 +1,172 @@
+#include <vector>
+
+#include <ATen/native/mkldnn/Common.h>
+#include <ATen/native/mkldnn/LinearPrepack.h>
+#include <ATen/native/mkldnn/MKLDNNCommon.h>
+#include <ATen/native/mkldnn/OpContext.h>
+#include <c10/util/accumulate.h>
+
+#if AT_MKLDNN_ENABLED()
+
+namespace at {
+namespace native {
+namespace mkldnn {
+namespace internal {
+namespace linear {
+
+c10::intrusive_ptr<mkldnn::LinearOpContext> createLinearPrePackOpContext(
+    Tensor weight,
+    c10::optional<Tensor> bias,
+    std::vector<int64_t> input_size,
+    std::string attr) {
+  auto it = fusion_attr_map.find(attr);
+  TORCH_CHECK(it != fusion_attr_map.end(), "Fusion behavior undefined.");
+  ideep::attr_t op_attr = it->second;
+
+  return mkldnn::MkldnnLinearOpContext::create_context(
+      std::move(weight),
+      std::move(bias),
+      std::move(input_size),
+      std::move(attr),
+      op_attr);
+}
+
+ContextLinear create(
+    const Tensor& weight,
+    const c10::optional<Tensor>& bias,
+    const IntArrayRef input_size,
+    const ideep::attr_t& attr) {
+  c10::impl::ExcludeDispatchKeyGuard edkg(c10::autograd_dispatch_keyset);
+  auto w = itensor_view_from_dense(weight);
+
+  // The inner product works on a 2d source; collapse any leading batch
+  // dimensions the same way run() does, so the blocked weight layout we
+  // pick here is the one the forward primitive actually wants.
+  int64_t flattened_batch =
+      c10::multiply_integers(input_size.begin(), input_size.end() - 1);
+  ideep::dims src_dims = {flattened_batch, input_size.back()};
+  ideep::tensor::desc expected_weight_desc =
+      ideep::inner_product_forward::expected_weights_desc(
+          w.get_dims(),
+          src_dims,
+          /*dtype*/ w.get_data_type(),
+          /*x_dtype*/ w.get_data_type());
+
+  ideep::tensor packed_weight;
+  packed_weight.init(expected_weight_desc);
+  packed_weight.feed_from(w);
+
+  return ContextLinear{
+      std::move(packed_weight),
+      bias.has_value() ? c10::make_optional(*bias) : c10::nullopt,
+      attr};
+}
+
+void mkldnn_linear_out(
+    const Tensor& input,
+    ideep::tensor& mkldnn_output,
+    const ideep::tensor& mkldnn_weight,
+    const c10::optional<Tensor>& bias_opt,
+    const ideep::attr_t& attr = ideep::attr_t()) {
+  c10::MaybeOwned<Tensor> bias_maybe_owned =
+      at::borrow_from_optional_tensor(bias_opt);
+  const Tensor& bias = *bias_maybe_owned;
+
+  c10::impl::ExcludeDispatchKeyGuard edkg(c10::autograd_dispatch_keyset);
+  const ideep::tensor mkldnn_input = itensor_view_from_dense(input);
+
+  if (bias.defined()) {
+    const ideep::tensor mkldnn_bias = itensor_from_tensor(bias);
+    ideep::inner_product_forward::compute(
+        mkldnn_input,
+        mkldnn_weight,
+        mkldnn_bias,
+        mkldnn_output,
+        ideep::scale_t(),
+        ideep::scale_t(),
+        ideep::scale_t(),
+        attr);
+  } else {
+    ideep::inner_product_forward::compute(
+        mkldnn_input,
+        mkldnn_weight,
+        mkldnn_output,
+        ideep::scale_t(),
+        ideep::scale_t(),
+        ideep::scale_t(),
+        attr);
+  }
+}
+
+Tensor run(ContextLinear& context, const Tensor& input) {
+  const ideep::tensor& mkldnn_weight = context.weight_packed_;
+
+  auto input_contig = input.contiguous();
+  auto input_size = input_contig.sizes();
+  const int64_t dim = input_contig.dim();
+  auto input_reshaped = dim == 2
+      ? input_contig
+      : input_contig.reshape({-1, input_contig.size(dim - 1)});
+
+  std::vector<int64_t> output_size(input_size.begin(), input_size.end() - 1);
+  output_size.push_back(mkldnn_weight.get_dims()[0]);
+  auto output = at::empty(output_size, input_contig.options());
+  if (dim != 2) {
+    output = output.reshape(
+        {input_reshaped.size(0), mkldnn_weight.get_dims()[0]});
+  }
+
+  c10::impl::ExcludeDispatchKeyGuard edkg(c10::autograd_dispatch_keyset);
+  ideep::tensor mkldnn_output = itensor_from_tensor(output);
+
+  mkldnn_linear_out(
+      input_reshaped,
+      mkldnn_output,
+      mkldnn_weight,
+      context.at_bias_,
+      context.attr_);
+
+  if (dim != 2) {
+    output = output.reshape(output_size);
+  }
+  return output;
+}
+
+void run(ContextLinear& context, const Tensor& input, void* output) {
+  const ideep::tensor& mkldnn_weight = context.weight_packed_;
+
+  auto input_contig = input.contiguous();
+  const int64_t dim = input_contig.dim();
+  auto input_reshaped = dim == 2
+      ? input_contig
+      : input_contig.reshape({-1, input_contig.size(dim - 1)});
+
+  // The raw output buffer is row-major contiguous, so computing into its
+  // flattened 2d view is a plain reinterpretation of the same memory.
+  std::vector<int64_t> output_size = {
+      input_reshaped.size(0), mkldnn_weight.get_dims()[0]};
+  ideep::tensor::desc o_desc = {
+      output_size, get_mkldnn_dtype(input_contig.scalar_type()), ideep::tag::ab};
+  ideep::tensor mkldnn_output = {o_desc, output};
+
+  mkldnn_linear_out(
+      input_reshaped,
+      mkldnn_output,
+      mkldnn_weight,
+      context.at_bias_,
+      context.attr_);
+}
+
+Tensor linear_run(
+    const Tensor& input,
+    const c10::intrusive_ptr<mkldnn::LinearOpContext>& op_context) {
+  return op_context->run(input);
+}
+
+} // namespace linear
+} // namespace internal
+} // namespace mkldnn
+} // namespace native
+} // namespace at
+
+#endif // AT_MKLDNN_ENABLED()
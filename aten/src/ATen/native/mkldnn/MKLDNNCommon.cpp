@@ -121,6 +121,18 @@ int set_verbose(int level) {
     return ideep::utils::set_verbose(level);
 }
 
+// See Note [MKLDNN primitive cache] in MKLDNNCommon.h
+int set_primitive_cache_capacity(int capacity) {
+  TORCH_CHECK(capacity >= 0,
+      "mkldnn primitive cache capacity must be non-negative, got ", capacity);
+  dnnl::set_primitive_cache_capacity(capacity);
+  return dnnl::get_primitive_cache_capacity();
+}
+
+int get_primitive_cache_capacity() {
+  return dnnl::get_primitive_cache_capacity();
+}
+
 }}
 
 #endif // AT_MKLDNN_ENABLED()
@@ -27,6 +27,26 @@ TORCH_API ideep::tensor itensor_from_tensor(const Tensor& tensor);
 // Set MKLDNN verbose level
 TORCH_API int set_verbose(int level);
 
+// Note [MKLDNN primitive cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// oneDNN keeps compiled (JIT-ed) primitives in a single process-wide LRU
+// cache that is shared across all threads, so serving with many intra-op or
+// inter-op threads does not duplicate the JIT blobs. The thread-local stores
+// kept by ideep on top of it (see clear_computation_cache() in
+// IDeepRegistration.cpp) only hold lightweight descriptor parameters.
+//
+// The capacity of the shared cache defaults to 1024 primitives and bounds
+// both the compile-once latency savings and the resident JIT code size.
+// These helpers expose it so deployments can trade memory for hit rate
+// (set it higher for models with many distinct shapes, or to 0 to disable
+// caching altogether when profiling cold-start behavior).
+
+// Set capacity of the shared oneDNN primitive cache; returns the new value.
+TORCH_API int set_primitive_cache_capacity(int capacity);
+
+// Get capacity of the shared oneDNN primitive cache.
+TORCH_API int get_primitive_cache_capacity();
+
 }}
 
 #endif // AT_MKLDNN_ENABLED
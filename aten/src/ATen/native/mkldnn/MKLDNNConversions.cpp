@@ -15,6 +15,7 @@
 #include <ATen/ops/empty_native.h>
 #include <ATen/ops/mkldnn_reorder_conv2d_weight_native.h>
 #include <ATen/ops/mkldnn_reorder_conv3d_weight_native.h>
+#include <ATen/ops/mkldnn_reorder_linear_weight_native.h>
 #include <ATen/ops/to_mkldnn_native.h>
 #endif
 
@@ -168,6 +169,39 @@ Tensor mkldnn_reorder_conv3d_weight(
   return new_with_itensor_mkldnn(std::move(result), optTypeMetaToScalarType(self.options().dtype_opt()), self.options().device_opt());
 }
 
+// Reorders a 2-d mkldnn weight into the blocked layout the inner product
+// primitive expects, so mkldnn_linear consumes it directly instead of
+// repacking a plain-layout weight on every call. If `batch_size` is given
+// the layout is chosen for that batch; otherwise oneDNN picks its
+// batch-agnostic default (and still reorders at run time in the rare case
+// the actual batch wants a different blocking).
+Tensor mkldnn_reorder_linear_weight(
+    const Tensor& self,
+    c10::optional<int64_t> batch_size) {
+  if (self.scalar_type() == ScalarType::BFloat16) {
+    TORCH_CHECK(mkldnn_bf16_device_check(),
+        "mkldnn_reorder_linear_weight: bf16 path needs the cpu support avx512bw, avx512vl and avx512dq");
+  }
+  TORCH_CHECK(self.dim() == 2,
+      "mkldnn_reorder_linear_weight: expected a 2-d weight, got ", self.dim(), "-d");
+
+  auto w = itensor_from_mkldnn(self);
+  ideep::dims src_dims = ideep::dims();
+  if (batch_size.has_value()) {
+    src_dims = {batch_size.value(), self.size(1)};
+  }
+  auto desc = ideep::inner_product_forward::expected_weights_desc(
+      w.get_dims(),
+      src_dims,
+      /*dtype*/ w.get_data_type(),
+      /*x_dtype*/ w.get_data_type());
+  ideep::tensor result;
+  result.init(desc);
+  result.feed_from(w);
+
+  return new_with_itensor_mkldnn(std::move(result), optTypeMetaToScalarType(self.options().dtype_opt()), self.options().device_opt());
+}
+
 #else
 
 Tensor mkldnn_to_dense(const Tensor& mkldnn_tensor, c10::optional<ScalarType> dtype) {
@@ -197,6 +231,12 @@ Tensor mkldnn_reorder_conv3d_weight(
   TORCH_CHECK(false, "mkldnn_reorder_conv3d_weight: MKL-DNN build is disabled");
 }
 
+Tensor mkldnn_reorder_linear_weight(
+    const Tensor& self,
+    c10::optional<int64_t> batch_size) {
+  TORCH_CHECK(false, "mkldnn_reorder_linear_weight: MKL-DNN build is disabled");
+}
+
 #endif // AT_MKLDNN_ENABLED()
 
 #if AT_MKL_ENABLED() && AT_MKLDNN_ENABLED()
@@ -5,6 +5,7 @@
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
 #include <ATen/NestedTensorImpl.h>
+#include <ATen/Parallel.h>
 #include <ATen/ScalarOps.h>
 #include <ATen/TensorIndexing.h>
 #include <ATen/TensorOperators.h>
@@ -13,7 +14,11 @@
 #include <ATen/native/layer_norm.h>
 #include <ATen/native/nested/NestedTensorUtils.h>
 
+#include <algorithm>
+#include <cmath>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 namespace at {
 namespace native {
@@ -628,6 +633,67 @@ Tensor softmax_nested(
       & sizemat = input_ptr->get_nested_size_tensor();
   Tensor output_buffer = buffer.new_empty(buffer.sizes());
   Tensor output = wrap_buffer(output_buffer, sizemat.clone());
+  // Fast path for the common CPU inference case: a contiguous buffer and
+  // softmax along the last (ragged) dimension. The packed buffer is then a
+  // sequence of contiguous rows of varying length, so the reduction runs
+  // directly over it - one parallel pass, no per-subtensor dispatch, and
+  // only real tokens are touched.
+  if (input.device().is_cpu() && nested_tensor_impl_is_contiguous(input_ptr) &&
+      positive_dim == input_ptr->dim() - 1 && !half_to_float &&
+      (buffer.scalar_type() == kFloat || buffer.scalar_type() == kDouble)) {
+    const auto sizes_accessor =
+        sizemat.accessor<int64_t, 2>();
+    const int64_t ndims_per_tensor = sizemat.size(1);
+    // (offset, length) of every softmax row in the packed buffer.
+    std::vector<std::pair<int64_t, int64_t>> rows;
+    int64_t offset = 0;
+    for (int64_t i = 0; i < ntensors; i++) {
+      int64_t outer = 1;
+      for (int64_t j = 0; j < ndims_per_tensor - 1; j++) {
+        outer *= sizes_accessor[i][j];
+      }
+      const int64_t row_length = sizes_accessor[i][ndims_per_tensor - 1];
+      for (int64_t r = 0; r < outer; r++) {
+        rows.emplace_back(offset, row_length);
+        offset += row_length;
+      }
+    }
+    const int64_t avg_row_length =
+        rows.empty() ? 1 : std::max<int64_t>(1, offset / rows.size());
+    AT_DISPATCH_FLOATING_TYPES(
+        buffer.scalar_type(), "softmax_nested", [&]() {
+          const scalar_t* in_ptr = buffer.data_ptr<scalar_t>();
+          scalar_t* out_ptr = output_buffer.data_ptr<scalar_t>();
+          at::parallel_for(
+              0,
+              rows.size(),
+              std::max<int64_t>(1, at::internal::GRAIN_SIZE / avg_row_length),
+              [&](int64_t begin, int64_t end) {
+                for (int64_t r = begin; r < end; r++) {
+                  const scalar_t* in_row = in_ptr + rows[r].first;
+                  scalar_t* out_row = out_ptr + rows[r].first;
+                  const int64_t length = rows[r].second;
+                  if (length == 0) {
+                    continue;
+                  }
+                  scalar_t max_value = in_row[0];
+                  for (int64_t j = 1; j < length; j++) {
+                    max_value = std::max(max_value, in_row[j]);
+                  }
+                  scalar_t sum = 0;
+                  for (int64_t j = 0; j < length; j++) {
+                    out_row[j] = std::exp(in_row[j] - max_value);
+                    sum += out_row[j];
+                  }
+                  const scalar_t inv_sum = scalar_t(1) / sum;
+                  for (int64_t j = 0; j < length; j++) {
+                    out_row[j] *= inv_sum;
+                  }
+                }
+              });
+        });
+    return output;
+  }
   // call tensor softmax
   // TODO: for cpu, maybe use `parallel_for` if benchmarks show necessity
   //       to do that, have to merge `aten/src/ATen/native/cpu/SoftMaxKernel.cpp/softmax_kernel`
@@ -5,15 +5,19 @@
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
 #include <ATen/NestedTensorImpl.h>
+#include <ATen/Parallel.h>
 #include <ATen/ScalarOps.h>
 #include <ATen/TensorIndexing.h>
 #include <ATen/TensorOperators.h>
 #include <ATen/TensorUtils.h>
 #include <ATen/core/Tensor.h>
+#include <ATen/native/CPUBlas.h>
 #include <ATen/native/layer_norm.h>
 #include <ATen/native/nested/NestedTensorUtils.h>
 
+#include <algorithm>
 #include <tuple>
+#include <vector>
 
 namespace at {
 namespace native {
@@ -64,6 +68,69 @@ Tensor bmm_nested(const Tensor& self, const Tensor& mat2) {
   }
   Tensor out_buffer = self_buffer.new_empty(out_numel);
   Tensor output = wrap_buffer(out_buffer, out_sizemat);
+
+  // Fast path on CPU for row-major operands: call cpublas::gemm straight on
+  // the packed buffers, parallelized over the (variable-size) matrix pairs.
+  // This skips per-pair dispatch and the padded-batch alternative, computing
+  // only real tokens.
+  if (self.device().is_cpu() &&
+      (self_buffer.scalar_type() == kFloat ||
+       self_buffer.scalar_type() == kDouble)) {
+    bool all_row_major = true;
+    for (int64_t i = 0; i < ntensors; i++) {
+      all_row_major = all_row_major &&
+          self_strides[i][0] == self_sizes[i][1] && self_strides[i][1] == 1 &&
+          mat2_strides[i][0] == mat2_sizes[i][1] && mat2_strides[i][1] == 1;
+    }
+    if (all_row_major) {
+      std::vector<int64_t> out_offsets(ntensors);
+      int64_t out_offset = 0;
+      for (int64_t i = 0; i < ntensors; i++) {
+        out_offsets[i] = out_offset;
+        out_offset += self_sizes[i][0] * mat2_sizes[i][1];
+      }
+      AT_DISPATCH_FLOATING_TYPES(
+          self_buffer.scalar_type(), "bmm_nested", [&]() {
+            const scalar_t* self_ptr = self_buffer.data_ptr<scalar_t>();
+            const scalar_t* mat2_ptr = mat2_buffer.data_ptr<scalar_t>();
+            scalar_t* out_ptr = out_buffer.data_ptr<scalar_t>();
+            at::parallel_for(0, ntensors, 1, [&](int64_t begin, int64_t end) {
+              for (int64_t i = begin; i < end; i++) {
+                const int64_t m = self_sizes[i][0];
+                const int64_t k = self_sizes[i][1];
+                const int64_t n = mat2_sizes[i][1];
+                if (m == 0 || n == 0) {
+                  continue;
+                }
+                if (k == 0) {
+                  std::fill(
+                      out_ptr + out_offsets[i],
+                      out_ptr + out_offsets[i] + m * n,
+                      scalar_t(0));
+                  continue;
+                }
+                // Row-major C = A @ B computed as column-major C^T = B^T A^T.
+                at::native::cpublas::gemm(
+                    TransposeType::NoTranspose,
+                    TransposeType::NoTranspose,
+                    n,
+                    m,
+                    k,
+                    scalar_t(1),
+                    mat2_ptr + mat2_offsets[i],
+                    n,
+                    self_ptr + self_offsets[i],
+                    k,
+                    scalar_t(0),
+                    out_ptr + out_offsets[i],
+                    n);
+              }
+            });
+          });
+      return output;
+    }
+  }
+
   // call tensor mm
   // TODO: `padding nested tensor -> bmm -> remove padding` may be more efficient
   //       until we have specialized nested tensor bmm kernel
@@ -219,9 +219,14 @@ inline void HandleWeightsSaturation(int64_t N, float* weight) {
 // Util function for quantizing bias.
 inline at::Tensor QuantizeBias(
     bool is_per_channel,
-    const at::Tensor& bias,
+    const at::Tensor& bias_in,
     const at::Tensor& weight_contig,
     double input_scale) {
+  // Reduced-precision (bf16/fp16) biases are upconverted before
+  // requantization; the quantize kernels only consume fp32.
+  const at::Tensor bias = bias_in.scalar_type() == at::kFloat
+      ? bias_in
+      : bias_in.to(at::kFloat);
   at::Tensor qbias;
   if (is_per_channel) {
     auto bias_quant_scales =
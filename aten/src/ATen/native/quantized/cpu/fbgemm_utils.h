@@ -6,6 +6,8 @@
 #include <c10/core/QScheme.h>
 #include <c10/util/irange.h>
 
+#include <mutex>
+
 #ifdef USE_FBGEMM
 #include <fbgemm/Fbgemm.h>
 #include <fbgemm/FbgemmFP16.h>
@@ -40,6 +42,13 @@ struct TORCH_API PackedLinearWeight : public LinearPackedParamsBase {
   std::vector<float> w_scale;
   std::vector<int32_t> w_zp;
   c10::QScheme q_scheme;
+  // Cached dynamic-activation range, filled in by apply_dynamic when
+  // TORCH_QLINEAR_DYNAMIC_RANGE_CACHE is set. See
+  // Note [Dynamic quantization range cache] in qlinear_dynamic.cpp.
+  std::mutex input_range_mutex_;
+  int input_range_observations_{0};
+  float cached_input_min_{0};
+  float cached_input_max_{0};
 
   at::Tensor apply(
       at::Tensor input,
@@ -624,7 +624,7 @@ static void leaky_qrelu_out_kernel(Tensor& out, const Tensor& qx,
   float negval = negval_.to<float>();
 
   AT_DISPATCH_QINT_TYPES(out.scalar_type(), "leaky_qrelu", [&] {
-    using Vec = Vectorized<float>;  // Naive implementation uses dequant/quant loop.
+    using Vec = vec::Vectorized<float>;  // Naive implementation uses dequant/quant loop.
     using qVec = Vectorized<scalar_t>;
     Vec zero_vec = Vec(0.0f);
     Vec one_vec = Vec(1.0f);
@@ -1054,7 +1054,7 @@ void qthreshold_kernel(
       c10::nullopt);
 
     // vectorized
-    using Vec = Vectorized<float>;
+    using Vec = vec::Vectorized<float>;
     using qVec = Vectorized<scalar_t>;
     // defines the iterator
     auto iter = TensorIterator::unary_op(qy, qx);
@@ -1227,7 +1227,7 @@ void qelu_kernel(
     auto iter = TensorIterator::unary_op(qy, qx);
 
     // vectorized
-    using Vec = Vectorized<float>;
+    using Vec = vec::Vectorized<float>;
     using qVec = Vectorized<scalar_t>;
 
     Vec zero_vec = Vec(0.0f);
@@ -3614,8 +3614,49 @@ void dequantize_tensor_per_tensor_affine_cpu(
 }
 #endif // USE_FBGEMM
 
+// Quantizes a contiguous run of values whose quantization parameters vary
+// per element: a channels-last row, or a 1-d per-channel tensor such as a
+// requantized conv/linear bias. The affine math (multiply, round, add) runs
+// through Vectorized<float>; only the final narrowing cast stays scalar,
+// mirroring the numerics of quantize_val (round to nearest even, then clamp
+// in integer domain).
+template <typename T>
+void quantize_per_channel_row(
+    const float* in,
+    T* out,
+    int64_t count,
+    const float* inv_scales,
+    const float* zero_points_float,
+    const double* scales_data,
+    const int64_t* zero_points_data) {
+  using Vec = vec::Vectorized<float>;
+  constexpr int64_t qmin = std::numeric_limits<typename T::underlying>::min();
+  constexpr int64_t qmax = std::numeric_limits<typename T::underlying>::max();
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+  alignas(64) float tmp[Vec::size()];
+  int64_t c = 0;
+  for (; c + Vec::size() <= count; c += Vec::size()) {
+    auto v = (Vec::loadu(in + c) * Vec::loadu(inv_scales + c)).round() +
+        Vec::loadu(zero_points_float + c);
+    v.store(tmp);
+    for (const auto j : c10::irange(Vec::size())) {
+      auto qvalue = static_cast<int64_t>(tmp[j]);
+      qvalue = std::max<int64_t>(qvalue, qmin);
+      qvalue = std::min<int64_t>(qvalue, qmax);
+      out[c + j] = T(static_cast<typename T::underlying>(qvalue));
+    }
+  }
+  for (; c < count; ++c) {
+    out[c] = at::native::quantize_val<T>(
+        scales_data[c], zero_points_data[c], in[c]);
+  }
+}
+
 // TODO: add fbgemm for per channel
-// Generic template defaults to naive quantize implementation
+// Generic template: vectorized via Vectorized<float> for layouts where the
+// quantization parameters vary along the contiguous dimension (channels-last
+// activations, 1-d per-channel tensors) and via quantize_vec for contiguous
+// per-channel slices.
 template <typename T>
 void quantize_tensor_per_channel_impl(
     const Tensor& rtensor,
@@ -3623,7 +3664,6 @@ void quantize_tensor_per_channel_impl(
     const Tensor& scales,
     const Tensor& zero_points,
     int64_t axis) {
-  // TODO: channels last kernel can be made faster.
   // For contiguous tensors, e.g. NCHW, arbitrary axis can be used.
   // For channels_last/3d however axis == 0 or 1.
   // Since current implemntation on channels_last format does not
@@ -3637,30 +3677,55 @@ void quantize_tensor_per_channel_impl(
   auto zero_points_data = zero_points.data_ptr<int64_t>();
   const float* in = rtensor.data_ptr<float>();
   auto out = qtensor.data_ptr<T>();
-  if (axis == 1 &&
-      (rtensor.is_contiguous(MemoryFormat::ChannelsLast) ||
-       rtensor.is_contiguous(MemoryFormat::ChannelsLast3d))) {
+  if ((axis == 1 &&
+       (rtensor.is_contiguous(MemoryFormat::ChannelsLast) ||
+        rtensor.is_contiguous(MemoryFormat::ChannelsLast3d))) ||
+      elements_per_channel == 1) {
     // This code handles per channel quant when axis = 1 and
-    // channels_last contig.
+    // channels_last contig, and 1-d per-channel tensors (e.g. biases being
+    // requantized to qint32 before a per-channel quantized conv/linear).
+    // In both cases the qparams vary along the contiguous dimension, so the
+    // tensor decomposes into rows of `channels` values quantized elementwise.
     // If axis = 0 and channels_last contig, implementation for channels
     // first (NCHW) works.
-    for (const auto b : c10::irange(batches)) {
-      for (const auto e : c10::irange(elements_per_channel)) {
-        for (const auto c : c10::irange(channels)) {
-          auto i = b * channels * elements_per_channel + e * channels + c;
-          out[i] = at::native::quantize_val<T>(
-              scales_data[c], zero_points_data[c], in[i]);
-        }
-      }
+    std::vector<float> inv_scales(channels);
+    std::vector<float> zero_points_float(channels);
+    for (const auto c : c10::irange(channels)) {
+      inv_scales[c] = 1.0f / static_cast<float>(scales_data[c]);
+      zero_points_float[c] = static_cast<float>(zero_points_data[c]);
+    }
+    for (const auto r : c10::irange(batches * elements_per_channel)) {
+      auto i = r * channels;
+      quantize_per_channel_row<T>(
+          in + i,
+          out + i,
+          channels,
+          inv_scales.data(),
+          zero_points_float.data(),
+          scales_data,
+          zero_points_data);
     }
   } else {
     for (const auto b : c10::irange(batches)) {
       for (const auto c : c10::irange(channels)) {
-        for (const auto e : c10::irange(elements_per_channel)) {
-          auto i = b * channels * elements_per_channel +
-              c * elements_per_channel + e;
-          out[i] = at::native::quantize_val<T>(
-              scales_data[c], zero_points_data[c], in[i]);
+        auto i = b * channels * elements_per_channel +
+            c * elements_per_channel;
+        if constexpr (std::is_same<T, c10::qint32>::value) {
+          // quantize_vec is 8-bit only; qint32 per-channel slices stay on
+          // the scalar path.
+          for (const auto e : c10::irange(elements_per_channel)) {
+            out[i + e] = at::native::quantize_val<T>(
+                scales_data[c], zero_points_data[c], in[i + e]);
+          }
+        } else {
+          // Fixed qparams within the slice: reuse the vectorized per-tensor
+          // kernel channel by channel.
+          at::native::quantize_vec<T>(
+              scales_data[c],
+              zero_points_data[c],
+              in + i,
+              out + i,
+              elements_per_channel);
         }
       }
     }
@@ -3908,8 +3973,42 @@ void dequantize_per_channel_affine_kernel(
   const auto* qd = qtensor.data_ptr<Q>();
   float* rd = rtensor.data_ptr<float>();
   const auto elem_per_byte = 8 / bit_width;
-  if (axis == 1 && (rtensor.is_contiguous(MemoryFormat::ChannelsLast) ||
-      rtensor.is_contiguous(MemoryFormat::ChannelsLast3d))) {
+  if (axis == 1 && bit_width == 8 &&
+      (rtensor.is_contiguous(MemoryFormat::ChannelsLast) ||
+       rtensor.is_contiguous(MemoryFormat::ChannelsLast3d))) {
+    // The qparams vary along the contiguous dimension, so load them as float
+    // vectors and run the affine math through Vectorized<float>; only the
+    // widening int8 -> float conversion stays scalar.
+    using Vec = vec::Vectorized<float>;
+    std::vector<float> scales_float(channel);
+    std::vector<float> zero_points_float(channel);
+    for (const auto c : c10::irange(channel)) {
+      scales_float[c] = static_cast<float>(scales_data[c]);
+      zero_points_float[c] = static_cast<float>(zero_points_data[c]);
+    }
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    alignas(64) float tmp[Vec::size()];
+    for (const auto r : c10::irange(batches * elements_per_channel)) {
+      const auto* qrow = qd + r * channel;
+      float* rrow = rd + r * channel;
+      int64_t c = 0;
+      for (; c + Vec::size() <= channel; c += Vec::size()) {
+        for (const auto j : c10::irange(Vec::size())) {
+          tmp[j] = static_cast<float>(qrow[c + j].val_);
+        }
+        auto v = (Vec::loadu(tmp) - Vec::loadu(zero_points_float.data() + c)) *
+            Vec::loadu(scales_float.data() + c);
+        v.store(rrow + c);
+      }
+      for (; c < channel; ++c) {
+        rrow[c] = (static_cast<float>(qrow[c].val_) - zero_points_float[c]) *
+            scales_float[c];
+      }
+    }
+  } else if (
+      axis == 1 &&
+      (rtensor.is_contiguous(MemoryFormat::ChannelsLast) ||
+       rtensor.is_contiguous(MemoryFormat::ChannelsLast3d))) {
     for (const auto b : c10::irange(batches)) {
       for (const auto e : c10::irange(elements_per_channel)) {
         for (const auto c : c10::irange(channel)) {
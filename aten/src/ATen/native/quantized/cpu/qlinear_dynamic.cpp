@@ -14,18 +14,76 @@
 #include <ATen/Functions.h>
 #else
 #include <ATen/ops/_empty_affine_quantized.h>
-#include <ATen/ops/aminmax.h>
 #include <ATen/ops/empty.h>
 #include <ATen/ops/quantize_per_tensor.h>
 #endif
 
+#include <c10/util/env.h>
 #include <c10/util/irange.h>
 
 #include <algorithm>
+#include <limits>
 #include <string>
+#include <utility>
 
 int register_linear_params();
 
+#if defined(USE_FBGEMM) || defined(USE_PYTORCH_QNNPACK) || AT_MKLDNN_ENABLED()
+namespace {
+
+// Computes the min/max of the activation tensor for dynamic quantization in
+// one pass. fbgemm::FindMinMax is vectorized but single threaded; for the
+// large activation matrices of dynamic-quantized RNNs the observation pass
+// is a significant fraction of the whole linear, so split the scan into
+// slabs with a parallel reduction, running the vectorized kernel per slab.
+void find_minmax_parallel(
+    const at::Tensor& input_contig,
+    float* x_min,
+    float* x_max) {
+  const int64_t numel = input_contig.numel();
+  if (numel == 0) {
+    // On empty input, no output data will be generated, so use arbitrary
+    // qparams.
+    *x_min = 0;
+    *x_max = 0;
+    return;
+  }
+  const float* data = input_contig.data_ptr<float>();
+  const auto result = at::parallel_reduce(
+      0,
+      numel,
+      at::internal::GRAIN_SIZE,
+      std::pair<float, float>(
+          std::numeric_limits<float>::infinity(),
+          -std::numeric_limits<float>::infinity()),
+      [data](int64_t begin, int64_t end, std::pair<float, float> acc) {
+        // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+        float slab_min, slab_max;
+#ifdef USE_FBGEMM
+        fbgemm::FindMinMax(data + begin, &slab_min, &slab_max, end - begin);
+#else
+        slab_min = data[begin];
+        slab_max = data[begin];
+        for (int64_t i = begin + 1; i < end; i++) {
+          slab_min = std::min(slab_min, data[i]);
+          slab_max = std::max(slab_max, data[i]);
+        }
+#endif
+        return std::pair<float, float>(
+            std::min(acc.first, slab_min), std::max(acc.second, slab_max));
+      },
+      [](std::pair<float, float> a, std::pair<float, float> b) {
+        return std::pair<float, float>(
+            std::min(a.first, b.first), std::max(a.second, b.second));
+      });
+  *x_min = result.first;
+  *x_max = result.second;
+}
+
+} // namespace
+#endif // defined(USE_FBGEMM) || defined(USE_PYTORCH_QNNPACK) ||
+       // AT_MKLDNN_ENABLED()
+
 #ifdef USE_FBGEMM
 template <bool ReluFused>
 at::Tensor PackedLinearWeight::apply_dynamic_impl(
@@ -63,13 +121,44 @@ at::Tensor PackedLinearWeight::apply_dynamic_impl(
           std::to_string(K));
 
   // Calculate statistics for quantization of the input Tensor
+  //
+  // Note [Dynamic quantization range cache]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // When the activations feeding a dynamic linear come from a bounded op
+  // (sigmoid, tanh, ...), their range converges after a few calls and the
+  // per-call observation pass is pure overhead. With
+  // TORCH_QLINEAR_DYNAMIC_RANGE_CACHE=1 the packed weight remembers the
+  // union of the ranges observed during the first few calls and reuses it
+  // afterwards, skipping the scan. Out-of-range values would then saturate,
+  // so this is opt-in and only sound for bounded activations.
+  static const bool use_range_cache =
+      c10::utils::check_env("TORCH_QLINEAR_DYNAMIC_RANGE_CACHE") == true;
+  constexpr int kRangeCacheWarmupRuns = 16;
   // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
   float x_min, x_max;
-  fbgemm::FindMinMax(
-      /*m=*/input_ptr,
-      /*min=*/&x_min,
-      /*max=*/&x_max,
-      /*len=*/input.numel());
+  bool have_range = false;
+  if (use_range_cache) {
+    std::lock_guard<std::mutex> lock(input_range_mutex_);
+    if (input_range_observations_ >= kRangeCacheWarmupRuns) {
+      x_min = cached_input_min_;
+      x_max = cached_input_max_;
+      have_range = true;
+    }
+  }
+  if (!have_range) {
+    find_minmax_parallel(input_contig, &x_min, &x_max);
+    if (use_range_cache) {
+      std::lock_guard<std::mutex> lock(input_range_mutex_);
+      if (input_range_observations_ == 0) {
+        cached_input_min_ = x_min;
+        cached_input_max_ = x_max;
+      } else {
+        cached_input_min_ = std::min(cached_input_min_, x_min);
+        cached_input_max_ = std::max(cached_input_max_, x_max);
+      }
+      input_range_observations_++;
+    }
+  }
 
   // Input tensor is quantized as 8-bit unsigned values
   static constexpr int precision = 8;
@@ -269,20 +358,11 @@ at::Tensor PackedLinearWeightsQnnp::apply_dynamic_impl(
   const float* bias_ptr = bias_contig.data_ptr<float>();
 
   // Calculate statistics for quantization of input Tensor
-  // TODO: optimized kernel
   // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
   float x_min;
   // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
   float x_max;
-  if (input.numel() > 0) {
-    x_min = input_contig.min().item<float>();
-    x_max = input_contig.max().item<float>();
-  } else {
-    // On empty input, no output data will be generated,
-    // so use arbitrary qparams.
-    x_min = 0;
-    x_max = 0;
-  }
+  find_minmax_parallel(input_contig, &x_min, &x_max);
 
   auto q_params = quant_utils::ChooseQuantizationParams(
       /*min=*/x_min,
@@ -511,21 +591,7 @@ at::Tensor PackedLinearWeightsOnednn::apply_dynamic_impl(
   x.init(input_desc, input_contig.data_ptr());
   // Find quantization parameters
   float x_max = 0, x_min = 0;
-#ifdef USE_FBGEMM
-  // Use FBGEMM's FindMinMax if available since it's faster
-  fbgemm::FindMinMax(
-      /*m=*/input_contig.data_ptr<float>(),
-      /*min=*/&x_min,
-      /*max=*/&x_max,
-      /*len=*/input.numel());
-#else
-  if (input_contig.numel() > 0) {
-    Tensor t_min, t_max;
-    std::tie(t_min, t_max) = at::aminmax(input_contig);
-    x_max = t_max.item<float>();
-    x_min = t_min.item<float>();
-  }
-#endif
+  find_minmax_parallel(input_contig, &x_min, &x_max);
   const int precision = 8;
   auto q_params = quant_utils::ChooseQuantizationParams(
       /*min=*/x_min,
@@ -115,6 +115,7 @@
 #endif
 
 #include <algorithm>
+#include <vector>
 
 namespace at {
 namespace meta {
@@ -462,24 +463,165 @@ void addmm_out_sparse_csr_native_cpu(
         int64_t r_stride0 = r.stride(0);
         int64_t r_stride1 = r.stride(1);
 
+        // Partitioning by rows load-imbalances badly on power-law matrices,
+        // where a single row can hold a large fraction of the nonzeros.
+        // Instead, split the nonzeros evenly across chunks (merge-based SpMM):
+        // each chunk handles a contiguous nnz range, writing fully-owned rows
+        // directly into the result. A chunk boundary can fall inside a row, so
+        // the (at most two) partial rows per chunk are accumulated into
+        // per-chunk scratch buffers and merged sequentially afterwards.
+        const int64_t nnz = values.numel();
+        const int64_t num_chunks = std::max<int64_t>(
+            1,
+            std::min<int64_t>(
+                at::get_num_threads(),
+                (nnz * dim_k + internal::GRAIN_SIZE - 1) /
+                    internal::GRAIN_SIZE));
+        // Two scratch rows per chunk: one for a partial first row, one for a
+        // partial last row.
+        std::vector<scalar_t> partial_values(num_chunks * 2 * dim_k, 0);
+        std::vector<int64_t> partial_rows(num_chunks * 2, -1);
+
+        // Index of the row containing nonzero `i`, i.e. the largest `h` with
+        // csr[h] <= i.
+        auto row_of_nnz = [&](int64_t i) -> int64_t {
+          int64_t lo = 0;
+          int64_t hi = dim_i;
+          while (lo + 1 < hi) {
+            const int64_t mid = (lo + hi) / 2;
+            if (static_cast<int64_t>(csr_accessor[mid]) <= i) {
+              lo = mid;
+            } else {
+              hi = mid;
+            }
+          }
+          return lo;
+        };
+
+        at::parallel_for(
+            0, num_chunks, 1, [&](int64_t chunk_start, int64_t chunk_end) {
+              for (int64_t chunk = chunk_start; chunk < chunk_end; ++chunk) {
+                const int64_t s = nnz * chunk / num_chunks;
+                const int64_t e = nnz * (chunk + 1) / num_chunks;
+                if (s == e) {
+                  continue;
+                }
+                const int64_t row_s = row_of_nnz(s);
+                const int64_t row_e = row_of_nnz(e - 1);
+                for (int64_t h = row_s; h <= row_e; ++h) {
+                  const int64_t row_begin = csr_accessor[h];
+                  const int64_t row_end = csr_accessor[h + 1];
+                  const int64_t i_start = std::max(row_begin, s);
+                  const int64_t i_end = std::min(row_end, e);
+                  if (i_start >= i_end) {
+                    continue;
+                  }
+                  const bool whole_row =
+                      i_start == row_begin && i_end == row_end;
+                  scalar_t* out_ptr = nullptr;
+                  int64_t out_stride = 0;
+                  if (whole_row) {
+                    out_ptr = r_ptr + h * r_stride0;
+                    out_stride = r_stride1;
+                  } else {
+                    const int64_t slot = chunk * 2 + (h == row_s ? 0 : 1);
+                    partial_rows[slot] = h;
+                    out_ptr = partial_values.data() + slot * dim_k;
+                    out_stride = 1;
+                  }
+                  for (int64_t i = i_start; i < i_end; i++) {
+                    scalar_t val = values_accessor[i];
+                    index_t col = col_indices_accessor[i];
+                    at::native::cpublas::axpy<scalar_t>(
+                        dim_k,
+                        cast_alpha * val,
+                        dense_ptr + col * dense_stride0,
+                        dense_stride1,
+                        out_ptr,
+                        out_stride);
+                  }
+                }
+              }
+            });
+
+        // Merge the partial rows. Several chunks may contribute to the same
+        // row, so this runs sequentially.
+        for (int64_t slot = 0; slot < num_chunks * 2; ++slot) {
+          const int64_t h = partial_rows[slot];
+          if (h < 0) {
+            continue;
+          }
+          const scalar_t* buf = partial_values.data() + slot * dim_k;
+          for (int64_t k = 0; k < dim_k; ++k) {
+            r_ptr[h * r_stride0 + k * r_stride1] += buf[k];
+          }
+        }
+      });
+}
+
+template <typename scalar_t>
+void addmm_out_sparse_bsr_native_cpu(
+    const Tensor& sparse,
+    const Tensor& dense,
+    const Tensor& r,
+    Scalar alpha,
+    Scalar beta) {
+  auto dim_k = dense.size(1);
+
+  auto crow = sparse.crow_indices();
+  auto col_indices = sparse.col_indices();
+  auto values = sparse.values();
+
+  // values has shape (nnz_blocks, row_block_size, col_block_size); each block
+  // updates a row_block_size tall stripe of the result.
+  const int64_t row_block = values.size(1);
+  const int64_t col_block = values.size(2);
+  const int64_t n_block_rows = sparse.size(0) / row_block;
+
+  scalar_t cast_alpha = alpha.to<scalar_t>();
+  r.mul_(beta);
+  AT_DISPATCH_INDEX_TYPES(
+      col_indices.scalar_type(), "bsr_mm_crow_indices", [&]() {
+        auto crow_accessor = crow.accessor<index_t, 1>();
+        auto col_indices_accessor = col_indices.accessor<index_t, 1>();
+
+        auto values_accessor = values.accessor<scalar_t, 3>();
+        scalar_t* dense_ptr = dense.data_ptr<scalar_t>();
+        scalar_t* r_ptr = r.data_ptr<scalar_t>();
+
+        int64_t dense_stride0 = dense.stride(0);
+        int64_t dense_stride1 = dense.stride(1);
+        int64_t r_stride0 = r.stride(0);
+        int64_t r_stride1 = r.stride(1);
+
         at::parallel_for(
             0,
-            dim_i,
-            internal::GRAIN_SIZE,
-            [&](int64_t irow_start, int64_t irow_end) {
-              for (index_t h = irow_start; h < irow_end; ++h) {
-                index_t i_start = csr_accessor[h];
-                index_t i_end = csr_accessor[h + 1];
-                for (index_t i = i_start; i < i_end; i++) {
-                  scalar_t val = values_accessor[i];
-                  index_t col = col_indices_accessor[i];
-                  at::native::cpublas::axpy<scalar_t>(
-                      dim_k,
-                      cast_alpha * val,
-                      dense_ptr + col * dense_stride0,
-                      dense_stride1,
-                      r_ptr + h * r_stride0,
-                      r_stride1);
+            n_block_rows,
+            std::max<int64_t>(
+                1, internal::GRAIN_SIZE / (row_block * col_block * dim_k + 1)),
+            [&](int64_t brow_start, int64_t brow_end) {
+              for (int64_t brow = brow_start; brow < brow_end; ++brow) {
+                const index_t b_start = crow_accessor[brow];
+                const index_t b_end = crow_accessor[brow + 1];
+                for (index_t b = b_start; b < b_end; b++) {
+                  const index_t bcol = col_indices_accessor[b];
+                  const auto block = values_accessor[b];
+                  // The inner axpy runs along the dense columns, which is the
+                  // long, vectorizable dimension; each (br, bc) pair of the
+                  // block scales one dense row into one result row.
+                  for (int64_t br = 0; br < row_block; ++br) {
+                    scalar_t* r_row_ptr =
+                        r_ptr + (brow * row_block + br) * r_stride0;
+                    for (int64_t bc = 0; bc < col_block; ++bc) {
+                      at::native::cpublas::axpy<scalar_t>(
+                          dim_k,
+                          cast_alpha * block[br][bc],
+                          dense_ptr + (bcol * col_block + bc) * dense_stride0,
+                          dense_stride1,
+                          r_row_ptr,
+                          r_stride1);
+                    }
+                  }
                 }
               }
             });
@@ -608,6 +750,17 @@ Tensor& addmm_out_sparse_compressed_cpu(
         return result;
       }
     }
+  } else if (mat1.layout() == kSparseBsr) {
+    if (mat2.layout() == kStrided) {
+      if (result.layout() == kStrided) {
+        AT_DISPATCH_FLOATING_AND_COMPLEX_TYPES(
+            result.scalar_type(), "addmm_sparse_dense", [&] {
+              addmm_out_sparse_bsr_native_cpu<scalar_t>(
+                  mat1, mat2, result, alpha, beta);
+            });
+        return result;
+      }
+    }
   } else if (mat1.layout() == kSparseCsc) {
     if (mat2.layout() == kStrided) {
       if (result.layout() == kStrided) {
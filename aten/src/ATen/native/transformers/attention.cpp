@@ -28,6 +28,8 @@ namespace native {
 DEFINE_DISPATCH(_fused_sdp_choice_stub);
 REGISTER_NO_CPU_DISPATCH(_fused_sdp_choice_stub);
 
+DEFINE_DISPATCH(flash_attention_kernel);
+
 namespace {
 
 Tensor gemm_nt(const Tensor& self, const Tensor& other) {
@@ -656,11 +658,86 @@ std::tuple<Tensor, Tensor, Tensor, Tensor> native_decoder_only_multi_head_attent
   return std::make_tuple(std::move(proj), std::move(qkt), std::move(k), std::move(v));
 }
 
+// In-place append for preallocated KV caches. Autoregressive decode that
+// grows its cache with at::cat reallocates and copies the whole cache every
+// token; with a preallocated cache this writes only the new entries, and the
+// attention call reads cache.narrow(-2, 0, valid_len + n) -- a view, which
+// the CPU flash kernel consumes without a contiguity copy.
+Tensor& _kv_cache_append_(
+    Tensor& cache,
+    const Tensor& new_values,
+    int64_t valid_len) {
+  TORCH_CHECK(
+      cache.dim() == new_values.dim() && cache.dim() >= 2,
+      "_kv_cache_append_: expected cache and new_values to have the same "
+      "number of dims (>= 2), got ", cache.dim(), " and ", new_values.dim());
+  for (int64_t d = 0; d < cache.dim(); d++) {
+    if (d == cache.dim() - 2) {
+      continue;
+    }
+    TORCH_CHECK(
+        cache.size(d) == new_values.size(d),
+        "_kv_cache_append_: cache and new_values must match in every dim "
+        "except the sequence dim, but differ in dim ", d, " (",
+        cache.size(d), " vs ", new_values.size(d), ")");
+  }
+  const int64_t new_len = new_values.size(-2);
+  TORCH_CHECK(
+      valid_len >= 0 && valid_len + new_len <= cache.size(-2),
+      "_kv_cache_append_: cache capacity ", cache.size(-2),
+      " cannot hold ", new_len, " new entries at offset ", valid_len);
+  cache.narrow(-2, valid_len, new_len).copy_(new_values);
+  return cache;
+}
+
 int64_t _fused_sdp_choice_cpp(const Tensor& query_, const Tensor& key, const Tensor& value,
         const c10::optional<Tensor>& attn_mask_, double dropout_p, bool need_attn_weights, bool is_causal){
+  if (query_.device().type() == DeviceType::CPU &&
+      sdp::use_flash_attention_cpp(
+          query_, key, value, attn_mask_.has_value(), dropout_p,
+          need_attn_weights, is_causal)) {
+    return static_cast<int64_t>(sdp::SDPBackend::flash_attention);
+  }
   return static_cast<int64_t>(sdp::SDPBackend::math);
 }
 
+// Forward-only tiled attention for CPU; see Note in attention.h and
+// native/cpu/FlashAttentionKernel.cpp. _fused_sdp_choice_cpp only routes
+// here for dense 4-D float/double inputs with no mask, no dropout and no
+// autograd, so the checks below are for direct callers of the op.
+std::tuple<Tensor, Tensor, Tensor> _scaled_dot_product_flash_attention_cpu(
+    const Tensor& query,
+    const Tensor& key,
+    const Tensor& value,
+    double dropout_p,
+    bool return_softmax,
+    bool is_causal) {
+  TORCH_CHECK(
+      dropout_p == 0.0,
+      "_scaled_dot_product_flash_attention: CPU kernel does not support dropout");
+  TORCH_CHECK(
+      !return_softmax,
+      "_scaled_dot_product_flash_attention: CPU kernel cannot return the softmax");
+  TORCH_CHECK(
+      sdp::use_flash_attention_cpp(
+          query, key, value, /*has_attn_mask=*/false, dropout_p,
+          /*need_attn_weights=*/false, is_causal),
+      "_scaled_dot_product_flash_attention: unsupported inputs for the CPU kernel; "
+      "use _scaled_dot_product_attention_math instead");
+  // The kernel handles any strides as long as rows of the last dim are
+  // contiguous, so narrowed KV-cache views (see _kv_cache_append_) are
+  // consumed in place instead of being copied back to contiguous.
+  auto ensure_row_contiguous = [](const Tensor& t) {
+    return (t.stride(3) == 1 && t.stride(2) >= t.size(3)) ? t : t.contiguous();
+  };
+  auto q = ensure_row_contiguous(query);
+  auto k = ensure_row_contiguous(key);
+  auto v = ensure_row_contiguous(value);
+  auto output = at::empty(q.sizes(), q.options());
+  flash_attention_kernel(kCPU, output, q, k, v, is_causal);
+  return std::make_tuple(std::move(output), Tensor(), Tensor());
+}
+
 // Computes scaled dot product attention on query, key and value tensors, using
 // an optional attention mask if passed, and applying dropout if a probability
 // greater than 0.0 is specified.
@@ -706,6 +783,11 @@ std::tuple<Tensor, Tensor> _scaled_dot_product_attention(
   if (query_.device().type() == DeviceType::CUDA){
     choice_int = _fused_sdp_choice_stub(query_.device().type(),
       query_, key, value, attn_mask_, dropout_p, need_attn_weights, is_causal);
+  } else if (query_.device().type() == DeviceType::CPU) {
+    // The CPU choice is not stubbed (see REGISTER_NO_CPU_DISPATCH above);
+    // call it directly so dense CPU inputs can reach the tiled kernel.
+    choice_int = _fused_sdp_choice_cpp(
+        query_, key, value, attn_mask_, dropout_p, need_attn_weights, is_causal);
   }
   sdp::SDPBackend backend = static_cast<sdp::SDPBackend>(choice_int);
   switch (backend) {
@@ -12,6 +12,21 @@ using fused_sdp_choice_fn = int64_t (*)(const Tensor& query_, const Tensor& key,
 
 DECLARE_DISPATCH(fused_sdp_choice_fn, _fused_sdp_choice_stub);
 
+// Tiled CPU attention: out = softmax(q @ k^T / sqrt(E)) @ v computed block
+// by block over the key dimension with running max/sum rescaling, so the
+// L x S score matrix is never materialized. Inputs are (N, H, L, E) /
+// (N, H, S, E) with contiguous rows of E; the other dims may be strided so
+// narrowed KV-cache views can be read in place. The output is contiguous.
+// See native/cpu/FlashAttentionKernel.cpp.
+using flash_attention_fn = void (*)(
+    const Tensor& output,
+    const Tensor& query,
+    const Tensor& key,
+    const Tensor& value,
+    bool is_causal);
+
+DECLARE_DISPATCH(flash_attention_fn, flash_attention_kernel);
+
 TORCH_API Tensor bmm_nt(const Tensor& a, const Tensor& b);
 TORCH_API Tensor masked_softmax(
     Tensor& attn_scores,
@@ -1,4 +1,9 @@
 #pragma once
+
+#include <ATen/core/Tensor.h>
+#include <ATen/core/grad_mode.h>
+#include <c10/core/ScalarType.h>
+
 namespace sdp {
 enum class SDPBackend {
   error = -1,
@@ -6,4 +11,51 @@ enum class SDPBackend {
   flash_attention = 1,
   efficient_attention = 2
 };
-} // namespace sdp
\ No newline at end of file
+
+// Whether the tiled CPU flash attention kernel
+// (native/cpu/FlashAttentionKernel.cpp) can serve this call. The kernel is
+// forward-only and handles dense 4-D float/double inputs with no mask and no
+// dropout; everything else falls back to the math decomposition.
+inline bool use_flash_attention_cpp(
+    const at::Tensor& query,
+    const at::Tensor& key,
+    const at::Tensor& value,
+    bool has_attn_mask,
+    double dropout,
+    bool need_attn_weights,
+    bool /*is_causal*/) {
+  if (has_attn_mask || dropout != 0.0 || need_attn_weights) {
+    return false;
+  }
+  if (query.is_nested() || key.is_nested() || value.is_nested()) {
+    return false;
+  }
+  // No CPU backward kernel exists; training goes through math.
+  if (at::GradMode::is_enabled() &&
+      (query.requires_grad() || key.requires_grad() || value.requires_grad())) {
+    return false;
+  }
+  const auto dtype = query.scalar_type();
+  if (dtype != at::kFloat && dtype != at::kDouble) {
+    return false;
+  }
+  if (key.scalar_type() != dtype || value.scalar_type() != dtype) {
+    return false;
+  }
+  // Expect (N, H, L, E) / (N, H, S, E) / (N, H, S, E) with one head size.
+  if (query.dim() != 4 || key.dim() != 4 || value.dim() != 4) {
+    return false;
+  }
+  if (query.size(0) != key.size(0) || query.size(0) != value.size(0) ||
+      query.size(1) != key.size(1) || query.size(1) != value.size(1) ||
+      key.size(2) != value.size(2) || query.size(3) != key.size(3) ||
+      query.size(3) != value.size(3)) {
+    return false;
+  }
+  if (query.numel() == 0 || key.numel() == 0) {
+    return false;
+  }
+  return true;
+}
+
+} // namespace sdp
@@ -2,6 +2,7 @@
 #include <ATen/native/vulkan/ops/Copy.h>
 #include <ATen/vulkan/Context.h>
 
+#include <cstdlib>
 #include <sstream>
 
 namespace at {
@@ -100,7 +101,22 @@ bool available() {
 Context* context() {
   static const std::unique_ptr<Context> context([]() -> Context* {
     try {
-      const uint32_t submit_frequency = 16u;
+      // Number of recorded dispatches after which the shared command buffer
+      // is submitted to the GPU queue. Submitting less frequently amortizes
+      // vkQueueSubmit overhead over more ops but delays the point at which
+      // the GPU starts working; ops that read back results pass a fence and
+      // submit immediately regardless. Deployments whose latency is
+      // dominated by per-submission overhead (small models on mobile GPUs)
+      // can raise this threshold.
+      uint32_t submit_frequency = 16u;
+      const char* submit_frequency_str =
+          std::getenv("PYTORCH_VULKAN_SUBMIT_FREQUENCY");
+      if (submit_frequency_str) {
+        const int parsed_frequency = std::atoi(submit_frequency_str);
+        if (parsed_frequency > 0) {
+          submit_frequency = static_cast<uint32_t>(parsed_frequency);
+        }
+      }
 
       const CommandPoolConfig cmd_config{
           32u, // cmdPoolInitialSize
@@ -153,7 +153,6 @@ DescriptorSetPile::DescriptorSetPile(
       pool_{descriptor_pool},
       descriptors_{},
       in_use_(0u) {
-  descriptors_.resize(pile_size_);
   allocate_new_batch();
 }
 
@@ -162,7 +161,6 @@ VkDescriptorSet DescriptorSetPile::get_descriptor_set() {
   allocate_new_batch();
 
   const VkDescriptorSet handle = descriptors_[in_use_];
-  descriptors_[in_use_] = VK_NULL_HANDLE;
 
   in_use_++;
   return handle;
@@ -170,13 +168,17 @@ VkDescriptorSet DescriptorSetPile::get_descriptor_set() {
 
 void DescriptorSetPile::allocate_new_batch() {
   // No-ops if there are still descriptor sets availble
-  if (in_use_ < descriptors_.size() &&
-      descriptors_[in_use_] != VK_NULL_HANDLE) {
+  if (in_use_ < descriptors_.size()) {
     return;
   }
 
-  std::vector<VkDescriptorSetLayout> layouts(descriptors_.size());
-  fill(layouts.begin(), layouts.end(), set_layout_);
+  // The pile grows monotonically; previously allocated batches stay in
+  // descriptors_ so that reset() can recycle them instead of allocating new
+  // sets from the pool.
+  const size_t prev_size = descriptors_.size();
+  descriptors_.resize(prev_size + pile_size_);
+
+  std::vector<VkDescriptorSetLayout> layouts(pile_size_, set_layout_);
 
   const VkDescriptorSetAllocateInfo allocate_info{
       VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO, // sType
@@ -186,9 +188,11 @@ void DescriptorSetPile::allocate_new_batch() {
       layouts.data(), // pSetLayouts
   };
 
-  VK_CHECK(
-      vkAllocateDescriptorSets(device_, &allocate_info, descriptors_.data()));
+  VK_CHECK(vkAllocateDescriptorSets(
+      device_, &allocate_info, descriptors_.data() + prev_size));
+}
 
+void DescriptorSetPile::reset() {
   in_use_ = 0u;
 }
 
@@ -262,8 +266,14 @@ DescriptorSet DescriptorPool::get_descriptor_set(
 }
 
 void DescriptorPool::flush() {
-  VK_CHECK(vkResetDescriptorPool(device_, pool_, 0u));
-  piles_.clear();
+  // Called once the GPU is idle; instead of resetting the underlying pool
+  // (which would force every descriptor set to be reallocated next cycle),
+  // recycle the sets allocated so far. Their resource bindings are
+  // overwritten via vkUpdateDescriptorSets the next time they are handed
+  // out.
+  for (auto& pile : piles_) {
+    pile.second.reset();
+  }
 }
 
 } // namespace api
@@ -81,6 +81,11 @@ class DescriptorSetPile final {
  public:
   VkDescriptorSet get_descriptor_set();
 
+  // Makes every descriptor set allocated so far available for reuse. May only
+  // be called once none of the handed out sets are pending execution on the
+  // GPU.
+  void reset();
+
  private:
   void allocate_new_batch();
 };
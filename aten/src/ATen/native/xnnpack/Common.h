@@ -44,6 +44,13 @@ struct ContextConv2D final {
   std::array<int64_t, 2> dilation_;
   bool transposed_;
   int64_t groups_;
+  // Key of the last operator setup (see the pointer caching note in
+  // Convolution.cpp). When the input/output pointers and the input
+  // dimensions of the current call match the previous one, the operator
+  // already holds the right state and xnn_setup_*() can be skipped.
+  const float* cached_input_ptr_{nullptr};
+  const float* cached_output_ptr_{nullptr};
+  std::array<int64_t, 3> cached_input_size_{{0, 0, 0}};
 
   ContextConv2D() = delete;
 
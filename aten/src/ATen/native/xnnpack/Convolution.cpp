@@ -167,6 +167,75 @@ const Tensor reorder_weights_for_transpose_conv(const Tensor& weight_nhwc,
   return reordered;
 }
 
+/*
+ * Binds the operator to the current input/output buffers, skipping the
+ * xnn_setup_*() call when nothing changed since the previous invocation.
+ *
+ * Pointer Caching:
+ * XNNPack has integrated offsets with its indirection buffer, so the buffer
+ * does not need to be recalculated inside setup when only the activation
+ * tensor pointer changes, as long as the tensor dimensions are the same. The
+ * setup call itself is not free, however: it revalidates its parameters and
+ * recomputes derived state on every invocation. Fixed-shape models hit the
+ * same input/output pointers call after call in steady state (the mobile
+ * allocator hands the same blocks back), in which case the operator already
+ * holds the right state and setup can be skipped outright. Any mismatch
+ * falls through to a full setup.
+ */
+void setup_conv2d(
+    ContextConv2D& context,
+    const Tensor& padded_input_nhwc,
+    Tensor& output) {
+  const int64_t batch = padded_input_nhwc.size(Layout::Activation4D::batch);
+  const int64_t input_height =
+      padded_input_nhwc.size(Layout::Activation4D::height);
+  const int64_t input_width =
+      padded_input_nhwc.size(Layout::Activation4D::width);
+  const float* input_ptr = padded_input_nhwc.data_ptr<float>();
+  float* output_ptr = output.data_ptr<float>();
+
+  if (input_ptr == context.cached_input_ptr_ &&
+      output_ptr == context.cached_output_ptr_ &&
+      batch == context.cached_input_size_[0] &&
+      input_height == context.cached_input_size_[1] &&
+      input_width == context.cached_input_size_[2]) {
+    return;
+  }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  xnn_status setup_status;
+  if (context.transposed_) {
+    setup_status = xnn_setup_deconvolution2d_nhwc_f32(
+      context.op.get(),             // operator
+      batch,                        // batch_size
+      input_height,                 // input_height
+      input_width,                  // input_width
+      context.output_padding_[0],   // adjustment_height
+      context.output_padding_[1],   // adjustment_width
+      input_ptr,                    // input
+      output_ptr,                   // output
+      caffe2::pthreadpool_());      // threadpool
+  } else {
+    setup_status = xnn_setup_convolution2d_nhwc_f32(
+      context.op.get(),             // operator
+      batch,                        // batch_size
+      input_height,                 // input_height
+      input_width,                  // input_width
+      input_ptr,                    // input
+      output_ptr,                   // output
+      caffe2::pthreadpool_());      // threadpool
+  }
+
+  TORCH_CHECK(
+      xnn_status_success == setup_status,
+      (context.transposed_ ? "xnn_setup_deconvolution2d_nhwc_f32 failed!"
+                            : "xnn_setup_convolution2d_nhwc_f32 failed!"));
+
+  context.cached_input_ptr_ = input_ptr;
+  context.cached_output_ptr_ = output_ptr;
+  context.cached_input_size_ = {batch, input_height, input_width};
+}
+
 } // namespace
 
 ContextConv2D create(
@@ -322,47 +391,7 @@ Tensor run(
       padded_input_nhwc.opt_names());
   }
 
-  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-  xnn_status setup_status;
-
-  /*
-   * Input Pointer Caching:
-   * Previously, we cached the input/output pointers and dimension parameters
-   * so that if the same pointers and parameters are used, this setup could be
-   * skipped.
-   * However, XNNPack has integrated offsets with its indirection buffer, so the
-   * buffer does not need to be recalculated even if activation tensor pointer
-   * changes as long as tensor dimensions are the same. Thus, the aforementioned
-   * manual caching is not needed here.
-   */
-
-  if (context.transposed_) {
-    setup_status = xnn_setup_deconvolution2d_nhwc_f32(
-      context.op.get(),                                      // operator
-      padded_input_nhwc.size(Layout::Activation4D::batch),   // batch_size
-      padded_input_nhwc.size(Layout::Activation4D::height),  // input_height
-      padded_input_nhwc.size(Layout::Activation4D::width),   // input_width
-      context.output_padding_[0],                            // adjustment_height
-      context.output_padding_[1],                            // adjustment_width
-      padded_input_nhwc.data_ptr<float>(),                   // input
-      output.data_ptr<float>(),                              // output
-      caffe2::pthreadpool_());                               // threadpool
-
-  } else {
-    setup_status = xnn_setup_convolution2d_nhwc_f32(
-      context.op.get(),                                      // operator
-      padded_input_nhwc.size(Layout::Activation4D::batch),   // batch_size
-      padded_input_nhwc.size(Layout::Activation4D::height),  // input_height
-      padded_input_nhwc.size(Layout::Activation4D::width),   // input_width
-      padded_input_nhwc.data_ptr<float>(),                   // input
-      output.data_ptr<float>(),                              // output
-      caffe2::pthreadpool_());
-  }
-
-  TORCH_CHECK(
-      xnn_status_success == setup_status,
-      (context.transposed_ ? "xnn_setup_deconvolution2d_nhwc_f32 failed!"
-                            : "xnn_setup_convolution2d_nhwc_f32 failed!"));
+  setup_conv2d(context, padded_input_nhwc, output);
 
   const xnn_status run_status = xnn_run_operator(
       context.op.get(),         // operator
@@ -375,6 +404,52 @@ Tensor run(
   return output.contiguous(input.suggest_memory_format());
 }
 
+void prewarm(ContextConv2D& context, const Tensor& input) {
+  using namespace internal;
+
+  const Tensor padded_input_nhwc = mobile::allocate_padded_contiguous_if_needed(
+      input, MemoryFormat::ChannelsLast);
+
+  TORCH_CHECK(
+      usable(padded_input_nhwc),
+      "XNNPACK Convolution not usable! "
+      "Reason: The provided input tensor is either invalid or unsupported by XNNPACK.");
+
+  Tensor output;
+  if (context.transposed_) {
+    output = mobile::empty_with_tail_padding(
+      conv_input_size(padded_input_nhwc.sizes(),
+        context.weight_size_,
+        context.padding_,
+        context.output_padding_,
+        context.stride_,
+        context.dilation_,
+        context.groups_),
+      padded_input_nhwc.options().dtype(),
+      MemoryFormat::ChannelsLast,
+      padded_input_nhwc.opt_names());
+  } else {
+    output = mobile::empty_with_tail_padding(
+      conv_output_size(
+          padded_input_nhwc.sizes(),
+          context.weight_size_,
+          context.padding_,
+          context.stride_,
+          context.dilation_),
+      padded_input_nhwc.options().dtype(),
+      MemoryFormat::ChannelsLast,
+      padded_input_nhwc.opt_names());
+  }
+
+  // Runs operator setup without executing the convolution, so XNNPACK
+  // computes its dimension-keyed internal state (e.g. the indirection
+  // buffer) for the given input shape ahead of the first inference. The
+  // scratch buffers die with this call, so the pointer cache left behind
+  // will not match the first real run, which performs a (now cheap) setup
+  // against the real buffers.
+  setup_conv2d(context, padded_input_nhwc, output);
+}
+
 c10::intrusive_ptr<xnnpack::Conv2dOpContext>
     createConv2dClampPrePackOpContext(
         Tensor weight,
@@ -425,6 +500,12 @@ Tensor conv2d_clamp_run(
   return op_context->run(input);
 }
 
+void conv2d_clamp_prewarm(
+    const Tensor& input,
+    const c10::intrusive_ptr<xnnpack::Conv2dOpContext>& op_context) {
+  op_context->prewarm(input);
+}
+
 // Op is registered to have Any argument as we plan to reuse it for prepacked conv2d of other backends
 IValue
 unpack_prepacked_sizes_conv2d(const IValue& ivalue) {
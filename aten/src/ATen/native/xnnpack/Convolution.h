@@ -39,6 +39,13 @@ Tensor conv2d_clamp_run(
     const Tensor& input,
     const c10::intrusive_ptr<xnnpack::Conv2dOpContext>& op_context);
 
+// Runs operator setup for the shape of the given example input without
+// executing the convolution, so that the first real inference does not pay
+// the cold-start setup cost.
+void conv2d_clamp_prewarm(
+    const Tensor& input,
+    const c10::intrusive_ptr<xnnpack::Conv2dOpContext>& op_context);
+
 IValue
 unpack_prepacked_sizes_conv2d(const IValue& ivalue);
 
@@ -60,6 +67,8 @@ ContextConv2D create(
 
 Tensor run(ContextConv2D& context, const Tensor& input);
 
+void prewarm(ContextConv2D& context, const Tensor& input);
+
 } // namespace convolution2d
 } // namespace internal
 } // namespace xnnpack
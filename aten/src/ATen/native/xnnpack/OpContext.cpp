@@ -144,6 +144,11 @@ Tensor XNNPackTransposeConv2dOpContext::run(const Tensor& input) {
   return xnnpack::internal::convolution2d::run(op_context_, input);
 }
 
+void XNNPackConv2dOpContext::prewarm(const Tensor& input) {
+  std::lock_guard<std::mutex> lock(xnnp_mutex_);
+  xnnpack::internal::convolution2d::prewarm(op_context_, input);
+}
+
 void XNNPackConv2dOpContext::free_orig_weight_and_bias() {
   orig_weight_and_bias_freed_ = true;
   orig_weight_.reset();
@@ -111,6 +111,7 @@ class Conv2dOpContext : public torch::jit::CustomClassHolder {
   }
 
   virtual Tensor run(const Tensor& input) = 0;
+  virtual void prewarm(const Tensor& input) = 0;
   virtual void free_orig_weight_and_bias() = 0;
 };
 
@@ -181,6 +182,7 @@ class XNNPackConv2dOpContext final : public Conv2dOpContext {
   }
 
   Tensor run(const Tensor& input) override;
+  void prewarm(const Tensor& input) override;
   void free_orig_weight_and_bias() override;
 
   static c10::intrusive_ptr<Conv2dOpContext> create_context(
@@ -109,7 +109,7 @@ class GlobalCallbackManager {
   using snapshot_t = std::pair<size_t, RecordFunctionCallbacks>;
 
   //                                                                Locking?
-  size_t version() const; //                                     No
+  static size_t version(); //                                       No
   snapshot_t getSnapshot() const; //                                Yes
   CallbackHandle addCallback(RecordFunctionCallback cb); //         Yes
   void setCallbackEnabled(CallbackHandle handle, bool enabled); //  Yes
@@ -117,11 +117,18 @@ class GlobalCallbackManager {
   void clearCallbacks(); //                                         Yes
 
  private:
-  std::atomic<size_t> version_{NoVersion + 1};
   RecordFunctionCallbacks global_callbacks_; // Source of truth.
   mutable std::mutex update_mutex_;
 };
 
+// The version counter lives outside of the singleton so that the common case
+// check in `LocalCallbackManager::rebuildActiveCallbacksIfNeeded` is a single
+// relaxed atomic load; routing it through `GlobalCallbackManager::get()` would
+// add the guard variable acquire of the function local static to every op even
+// when profiling is off. It is only written while holding `update_mutex_`.
+std::atomic<size_t> global_callback_version_{
+    GlobalCallbackManager::NoVersion + 1};
+
 class CacheEntry {
  public:
   CacheEntry() = default;
@@ -211,18 +218,20 @@ GlobalCallbackManager& GlobalCallbackManager::get() {
   return manager;
 }
 
-size_t GlobalCallbackManager::version() const {
-  return version_.load(std::memory_order_relaxed);
+size_t GlobalCallbackManager::version() {
+  return global_callback_version_.load(std::memory_order_relaxed);
 }
 
 std::pair<size_t, RecordFunctionCallbacks> GlobalCallbackManager::getSnapshot() const {
   std::lock_guard<std::mutex> guard(update_mutex_);
-  return {version_.load(std::memory_order_seq_cst), global_callbacks_};
+  return {
+      global_callback_version_.load(std::memory_order_seq_cst),
+      global_callbacks_};
 }
 
 CallbackHandle GlobalCallbackManager::addCallback(RecordFunctionCallback cb) {
   std::lock_guard<std::mutex> guard(update_mutex_);
-  ++version_;
+  ++global_callback_version_;
   auto handle = next_unique_callback_handle();
   global_callbacks_.emplace_back(std::move(cb), handle);
   return handle;
@@ -235,7 +244,7 @@ void GlobalCallbackManager::setCallbackEnabled(
   auto it = findCallback(global_callbacks_, handle);
   if (it != global_callbacks_.end()) {
     if (it->enabled_ != enabled) {
-      ++version_;
+      ++global_callback_version_;
       it->enabled_ = enabled;
     }
   } else {
@@ -246,7 +255,7 @@ void GlobalCallbackManager::setCallbackEnabled(
 void GlobalCallbackManager::removeCallback(CallbackHandle handle) {
   std::lock_guard<std::mutex> guard(update_mutex_);
   if (extractCallback(global_callbacks_, handle).has_value()) {
-    ++version_;
+    ++global_callback_version_;
   } else {
     LOG(WARNING) << "Requested callback is not found";
   }
@@ -254,7 +263,7 @@ void GlobalCallbackManager::removeCallback(CallbackHandle handle) {
 
 void GlobalCallbackManager::clearCallbacks() {
   std::lock_guard<std::mutex> guard(update_mutex_);
-  ++version_;
+  ++global_callback_version_;
   global_callbacks_.clear();
 }
 
@@ -278,6 +287,13 @@ void CacheEntry::update(const std::vector<RecordFunctionCallback>& callbacks) {
 }
 
 void CacheEntry::getActiveCallbacksImpl() {
+  // If no callbacks are registered for this scope (the common case when
+  // profiling is off) there is no sampling state to advance; skip the
+  // countdown bookkeeping so the disabled path does not write to the cache.
+  if (C10_LIKELY(callbacks_.empty())) {
+    return;
+  }
+
   // We rebuild the active set when `sampling_countdown_` reaches zero, so if it
   // reaches zero at the start of this function something has gone wrong.
   TORCH_INTERNAL_ASSERT(sampling_countdown_ > 0, sampling_countdown_);
@@ -383,7 +399,7 @@ const RecordFunctionTLS& LocalCallbackManager::getTLS() const {
 }
 
 void LocalCallbackManager::rebuildActiveCallbacksIfNeeded() {
-  const auto global_version = GlobalCallbackManager::get().version();
+  const auto global_version = GlobalCallbackManager::version();
   if (C10_UNLIKELY(global_version != global_version_)) {
     rebuild_all(GlobalCallbackManager::get().getSnapshot());
   }
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+
+// The CPU batched Cholesky and LU kernels take an inlined small-matrix path
+// for real matrices with n <= 8 when the batch holds more than one matrix;
+// single matrices and larger n stay on LAPACK.  Verify the fast path by
+// reconstruction and against the per-matrix (LAPACK) results.
+
+namespace {
+
+at::Tensor make_spd_batch(int64_t batch, int64_t n, at::ScalarType dtype) {
+  auto a = at::randn({batch, n, n}, dtype);
+  return at::matmul(a, a.transpose(-2, -1)) +
+      at::eye(n, dtype).mul(n) * 0.5;
+}
+
+TEST(BatchLinalgSmallTest, CholeskyMatchesPerMatrixPath) {
+  for (auto dtype : {at::kFloat, at::kDouble}) {
+    // n = 9 exceeds the small-matrix gate and stays on LAPACK.
+    for (int64_t n = 1; n <= 9; ++n) {
+      for (int64_t batch : {2, 5, 64}) {
+        auto a = make_spd_batch(batch, n, dtype);
+        auto l = at::linalg_cholesky(a);
+
+        // Reconstruction: L L^T == A.
+        double tol = dtype == at::kFloat ? 1e-3 : 1e-9;
+        ASSERT_TRUE(at::allclose(
+            at::matmul(l, l.transpose(-2, -1)), a, tol, tol));
+
+        // Batch-of-one keeps the LAPACK path; both must agree.
+        for (int64_t b = 0; b < std::min<int64_t>(batch, 3); ++b) {
+          auto l_ref = at::linalg_cholesky(a[b].unsqueeze(0)).squeeze(0);
+          ASSERT_TRUE(at::allclose(l[b], l_ref, tol, tol));
+        }
+      }
+    }
+  }
+}
+
+TEST(BatchLinalgSmallTest, CholeskyReportsNonPositiveDefinite) {
+  auto a = make_spd_batch(4, 6, at::kDouble);
+  // Make one batch entry indefinite.
+  a[2] = at::zeros({6, 6}, at::kDouble);
+  a[2].diagonal() = -1.0;
+  auto [l, info] = at::linalg_cholesky_ex(a);
+  ASSERT_EQ(info[0].item<int32_t>(), 0);
+  ASSERT_EQ(info[1].item<int32_t>(), 0);
+  ASSERT_NE(info[2].item<int32_t>(), 0);
+  ASSERT_EQ(info[3].item<int32_t>(), 0);
+}
+
+TEST(BatchLinalgSmallTest, LuFactorMatchesPerMatrixPath) {
+  for (auto dtype : {at::kFloat, at::kDouble}) {
+    for (int64_t n = 1; n <= 9; ++n) {
+      for (int64_t batch : {2, 5, 64}) {
+        auto a = at::randn({batch, n, n}, dtype);
+        auto [lu, pivots] = at::linalg_lu_factor(a);
+
+        // Reconstruction through the pivots: P L U == A.
+        auto [p, l, u] = at::lu_unpack(lu, pivots);
+        double tol = dtype == at::kFloat ? 1e-3 : 1e-9;
+        ASSERT_TRUE(at::allclose(
+            at::matmul(p, at::matmul(l, u)), a, tol, tol));
+
+        // Partial pivoting matches GETF2, so the per-matrix LAPACK result
+        // must produce the same pivot sequence.
+        for (int64_t b = 0; b < std::min<int64_t>(batch, 3); ++b) {
+          auto [lu_ref, pivots_ref] =
+              at::linalg_lu_factor(a[b].unsqueeze(0));
+          ASSERT_TRUE(at::equal(pivots[b], pivots_ref.squeeze(0)));
+          ASSERT_TRUE(at::allclose(lu[b], lu_ref.squeeze(0), tol, tol));
+        }
+      }
+    }
+  }
+}
+
+TEST(BatchLinalgSmallTest, LuFactorReportsFirstZeroPivot) {
+  // A singular matrix in the batch must report the 1-based column of the
+  // first zero pivot, like GETF2.
+  auto a = at::randn({3, 4, 4}, at::kDouble);
+  a[1] = at::zeros({4, 4}, at::kDouble);
+  a[1][0][0] = 1.0;  // rank 1: pivot 2 is the first to vanish
+  auto [lu, pivots, info] = at::linalg_lu_factor_ex(a);
+  ASSERT_EQ(info[0].item<int32_t>(), 0);
+  ASSERT_EQ(info[1].item<int32_t>(), 2);
+  ASSERT_EQ(info[2].item<int32_t>(), 0);
+}
+
+} // namespace
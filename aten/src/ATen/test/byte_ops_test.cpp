@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+
+#include <cstring>
+#include <vector>
+
+// _find_byte and _split_on_byte against scalar references, with separator
+// placements chosen to hit the vector-register and word-scan remainders in
+// the split kernel.
+
+namespace {
+
+at::Tensor bytes_from(const std::vector<uint8_t>& v) {
+  auto t = at::empty({static_cast<int64_t>(v.size())}, at::kByte);
+  std::memcpy(t.data_ptr<uint8_t>(), v.data(), v.size());
+  return t;
+}
+
+void check_split(const at::Tensor& input, int64_t sep) {
+  auto [starts, lengths] = at::_split_on_byte(input, sep);
+
+  // Reference: bytes.split keeps empty segments; one segment more than
+  // there are separators.
+  std::vector<int64_t> ref_starts, ref_lengths;
+  const uint8_t* data = input.data_ptr<uint8_t>();
+  int64_t begin = 0;
+  for (int64_t i = 0; i < input.numel(); ++i) {
+    if (data[i] == sep) {
+      ref_starts.push_back(begin);
+      ref_lengths.push_back(i - begin);
+      begin = i + 1;
+    }
+  }
+  ref_starts.push_back(begin);
+  ref_lengths.push_back(input.numel() - begin);
+
+  ASSERT_EQ(starts.numel(), static_cast<int64_t>(ref_starts.size()));
+  for (size_t i = 0; i < ref_starts.size(); ++i) {
+    ASSERT_EQ(starts[i].item<int64_t>(), ref_starts[i]);
+    ASSERT_EQ(lengths[i].item<int64_t>(), ref_lengths[i]);
+  }
+}
+
+TEST(ByteOpsTest, FindByte) {
+  auto t = bytes_from({5, 0, 7, 0, 9});
+  ASSERT_EQ(at::_find_byte(t, 5), 0);
+  ASSERT_EQ(at::_find_byte(t, 9), 4);
+  ASSERT_EQ(at::_find_byte(t, 0), 1);
+  ASSERT_EQ(at::_find_byte(t, 0, /*start=*/2), 3);
+  ASSERT_EQ(at::_find_byte(t, 0, /*start=*/4), -1);
+  ASSERT_EQ(at::_find_byte(t, 42), -1);
+  // start == numel is an allowed empty scan.
+  ASSERT_EQ(at::_find_byte(t, 5, /*start=*/5), -1);
+  ASSERT_EQ(at::_find_byte(at::empty({0}, at::kByte), 1), -1);
+}
+
+TEST(ByteOpsTest, FindByteLargeBuffer) {
+  // Hits at positions that land in the head, the vectorized body, and the
+  // scalar tail of the scan.
+  const int64_t n = 100003;
+  auto t = at::full({n}, 1, at::kByte);
+  for (int64_t pos : {int64_t(0), int64_t(63), int64_t(64), n - 1}) {
+    auto u = t.clone();
+    u[pos] = 200;
+    ASSERT_EQ(at::_find_byte(u, 200), pos);
+    ASSERT_EQ(at::_find_byte(u, 200, pos + 1), -1);
+  }
+}
+
+TEST(ByteOpsTest, SplitOnByte) {
+  // Leading, trailing, and adjacent separators produce empty segments.
+  check_split(bytes_from({32, 65, 32, 32, 66, 67, 32}), 32);
+  // No separator: one segment spanning the input.
+  check_split(bytes_from({1, 2, 3}), 9);
+  // All separators: n + 1 empty segments.
+  check_split(bytes_from({7, 7, 7, 7}), 7);
+  // Empty input: a single empty segment.
+  check_split(at::empty({0}, at::kByte), 0);
+}
+
+TEST(ByteOpsTest, SplitOnByteLargeBuffer) {
+  // Random separators over a buffer long enough to exercise the full-width
+  // register compares, the eight-byte word scan, and both remainders.
+  const int64_t n = 100003;
+  auto t = at::randint(0, 8, {n}, at::kByte);
+  check_split(t, 0);
+  // Dense hits within single words.
+  check_split(at::zeros({1000}, at::kByte), 0);
+}
+
+TEST(ByteOpsTest, RejectsInvalidInputs) {
+  auto t = at::zeros({8}, at::kByte);
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(at::_find_byte(t, 256), c10::Error);
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(at::_find_byte(t, -1), c10::Error);
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(at::_find_byte(t, 0, /*start=*/9), c10::Error);
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(at::_find_byte(at::zeros({8}, at::kFloat), 0), c10::Error);
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(at::_split_on_byte(at::zeros({2, 4}, at::kByte), 0), c10::Error);
+}
+
+} // namespace
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+
+// The CPU flash-attention kernel tiles queries in 32-row blocks and keys in
+// 512-wide blocks with an online softmax; the math decomposition of SDPA is
+// the reference.  Sequence lengths are chosen to land on and off both block
+// boundaries so the tail handling and the causal diagonal tiles are covered.
+
+namespace {
+
+void check_flash_attention(
+    int64_t batch,
+    int64_t num_heads,
+    int64_t q_len,
+    int64_t kv_len,
+    int64_t head_dim,
+    bool is_causal,
+    at::ScalarType dtype) {
+  auto query = at::randn({batch, num_heads, q_len, head_dim}, dtype);
+  auto key = at::randn({batch, num_heads, kv_len, head_dim}, dtype);
+  auto value = at::randn({batch, num_heads, kv_len, head_dim}, dtype);
+
+  auto out = std::get<0>(at::_scaled_dot_product_flash_attention(
+      query, key, value, /*dropout_p=*/0.0, /*return_softmax=*/false,
+      is_causal));
+  auto ref = std::get<0>(at::_scaled_dot_product_attention_math(
+      query, key, value, /*attn_mask=*/{}, /*dropout_p=*/0.0,
+      /*need_attn_weights=*/false, is_causal));
+
+  double atol = dtype == at::kFloat ? 1e-5 : 1e-10;
+  ASSERT_TRUE(at::allclose(out, ref, 1e-4, atol));
+}
+
+TEST(CpuFlashAttentionTest, MatchesMathReference) {
+  // On and off the 32-row query tile and 512-wide key block boundaries.
+  for (int64_t q_len : {1, 32, 33, 100}) {
+    for (int64_t kv_len : {17, 512, 513, 1000}) {
+      check_flash_attention(2, 3, q_len, kv_len, 16, false, at::kFloat);
+    }
+  }
+}
+
+TEST(CpuFlashAttentionTest, CausalMatchesMathReference) {
+  // Causal masking is applied inside the diagonal tiles; exercise tiles that
+  // are fully below, crossing, and fully above the diagonal.
+  for (int64_t len : {7, 32, 65, 600}) {
+    check_flash_attention(2, 2, len, len, 32, true, at::kFloat);
+  }
+}
+
+TEST(CpuFlashAttentionTest, DoubleMatchesMathReference) {
+  check_flash_attention(1, 2, 67, 640, 24, false, at::kDouble);
+  check_flash_attention(1, 2, 67, 67, 24, true, at::kDouble);
+}
+
+TEST(CpuFlashAttentionTest, RejectsDropoutAndSoftmaxReturn) {
+  auto t = at::randn({1, 1, 8, 8});
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(
+      at::_scaled_dot_product_flash_attention(
+          t, t, t, /*dropout_p=*/0.5, /*return_softmax=*/false, false),
+      c10::Error);
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(
+      at::_scaled_dot_product_flash_attention(
+          t, t, t, /*dropout_p=*/0.0, /*return_softmax=*/true, false),
+      c10::Error);
+}
+
+} // namespace
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+
+#include <cmath>
+
+// Checks the fused CPU Adam kernel against the textbook update evaluated in
+// double with plain tensor ops (the same math the foreach composition and
+// cuda/fused_adam_utils.cuh implement).
+
+namespace {
+
+struct AdamRef {
+  at::Tensor param;
+  at::Tensor exp_avg;
+  at::Tensor exp_avg_sq;
+  at::Tensor max_exp_avg_sq;
+};
+
+AdamRef reference_adam_step(
+    const at::Tensor& param,
+    const at::Tensor& grad,
+    const at::Tensor& exp_avg,
+    const at::Tensor& exp_avg_sq,
+    const at::Tensor& max_exp_avg_sq,
+    double step,
+    double lr,
+    double beta1,
+    double beta2,
+    double weight_decay,
+    double eps,
+    bool amsgrad,
+    bool maximize) {
+  auto p = param.to(at::kDouble);
+  auto g = grad.to(at::kDouble);
+  if (maximize) {
+    g = -g;
+  }
+  if (weight_decay != 0) {
+    g = g + p * weight_decay;
+  }
+  auto m = exp_avg.to(at::kDouble) * beta1 + g * (1 - beta1);
+  auto v = exp_avg_sq.to(at::kDouble) * beta2 + g * g * (1 - beta2);
+  const double bias_correction1 = 1 - std::pow(beta1, step);
+  const double bias_correction2 = 1 - std::pow(beta2, step);
+  at::Tensor vmax;
+  at::Tensor denom;
+  if (amsgrad) {
+    vmax = at::maximum(max_exp_avg_sq.to(at::kDouble), v);
+    denom = vmax.sqrt() / std::sqrt(bias_correction2) + eps;
+  } else {
+    denom = v.sqrt() / std::sqrt(bias_correction2) + eps;
+  }
+  p = p - (lr / bias_correction1) * m / denom;
+  return {p, m, v, vmax};
+}
+
+void check_fused_adam(
+    int64_t numel,
+    double step,
+    bool amsgrad,
+    bool maximize,
+    double weight_decay) {
+  const double lr = 1e-3, beta1 = 0.9, beta2 = 0.999, eps = 1e-8;
+
+  auto param = at::randn({numel});
+  auto grad = at::randn({numel});
+  auto exp_avg = at::rand({numel});
+  auto exp_avg_sq = at::rand({numel});
+  auto max_exp_avg_sq = at::rand({numel});
+  auto state_step = at::tensor(step, at::kFloat);
+
+  auto ref = reference_adam_step(
+      param, grad, exp_avg, exp_avg_sq, max_exp_avg_sq, step, lr, beta1,
+      beta2, weight_decay, eps, amsgrad, maximize);
+
+  at::_fused_adam_(
+      {param}, {grad}, {exp_avg}, {exp_avg_sq},
+      amsgrad ? at::TensorList({max_exp_avg_sq}) : at::TensorList(),
+      {state_step}, lr, beta1, beta2, weight_decay, eps, amsgrad, maximize,
+      /*grad_scale=*/{}, /*found_inf=*/{});
+
+  ASSERT_TRUE(at::allclose(param, ref.param.to(at::kFloat), 1e-4, 1e-6));
+  ASSERT_TRUE(at::allclose(exp_avg, ref.exp_avg.to(at::kFloat), 1e-4, 1e-6));
+  ASSERT_TRUE(
+      at::allclose(exp_avg_sq, ref.exp_avg_sq.to(at::kFloat), 1e-4, 1e-6));
+  if (amsgrad) {
+    ASSERT_TRUE(at::allclose(
+        max_exp_avg_sq, ref.max_exp_avg_sq.to(at::kFloat), 1e-4, 1e-6));
+  }
+}
+
+TEST(FusedAdamTest, MatchesReferenceMath) {
+  // Sizes straddle the vector width and the parallelization grain.
+  for (int64_t numel : {1, 33, 100000}) {
+    for (bool amsgrad : {false, true}) {
+      for (bool maximize : {false, true}) {
+        check_fused_adam(numel, /*step=*/1, amsgrad, maximize, 0.0);
+        check_fused_adam(numel, /*step=*/5, amsgrad, maximize, 0.01);
+      }
+    }
+  }
+}
+
+TEST(FusedAdamTest, GradScaleUnscalesAndStoresGradient) {
+  auto param = at::randn({64});
+  auto grad = at::randn({64});
+  auto unscaled_grad = grad / 8.0f;
+  auto exp_avg = at::zeros({64});
+  auto exp_avg_sq = at::zeros({64});
+  auto state_step = at::tensor(1.0f, at::kFloat);
+  auto grad_scale = at::tensor(8.0f, at::kFloat);
+
+  auto ref = reference_adam_step(
+      param, unscaled_grad, exp_avg, exp_avg_sq, at::Tensor(), 1, 1e-3, 0.9,
+      0.999, 0.0, 1e-8, false, false);
+
+  at::_fused_adam_(
+      {param}, {grad}, {exp_avg}, {exp_avg_sq}, {}, {state_step}, 1e-3, 0.9,
+      0.999, 0.0, 1e-8, /*amsgrad=*/false, /*maximize=*/false, grad_scale,
+      /*found_inf=*/{});
+
+  ASSERT_TRUE(at::allclose(param, ref.param.to(at::kFloat), 1e-4, 1e-6));
+  // The unscaled gradient is written back for GradScaler's inf checks.
+  ASSERT_TRUE(at::allclose(grad, unscaled_grad, 1e-6, 1e-8));
+}
+
+TEST(FusedAdamTest, FoundInfSkipsStep) {
+  auto param = at::randn({16});
+  auto param_before = param.clone();
+  auto grad = at::randn({16});
+  auto exp_avg = at::zeros({16});
+  auto exp_avg_sq = at::zeros({16});
+  auto state_step = at::tensor(1.0f, at::kFloat);
+  auto found_inf = at::tensor(1.0f, at::kFloat);
+
+  at::_fused_adam_(
+      {param}, {grad}, {exp_avg}, {exp_avg_sq}, {}, {state_step}, 1e-3, 0.9,
+      0.999, 0.0, 1e-8, /*amsgrad=*/false, /*maximize=*/false,
+      /*grad_scale=*/{}, found_inf);
+
+  ASSERT_TRUE(at::equal(param, param_before));
+  ASSERT_TRUE(at::equal(exp_avg, at::zeros({16})));
+}
+
+} // namespace
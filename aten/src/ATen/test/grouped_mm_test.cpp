@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+
+// _grouped_mm runs one batched pass over groups of independently shaped
+// matrix products; the reference is simply at::mm per group.
+
+namespace {
+
+void check_grouped_mm(
+    const std::vector<at::Tensor>& mat1,
+    const std::vector<at::Tensor>& mat2) {
+  auto out = at::_grouped_mm(mat1, mat2);
+  ASSERT_EQ(out.size(), mat1.size());
+  for (size_t i = 0; i < mat1.size(); ++i) {
+    auto ref = at::mm(mat1[i], mat2[i]);
+    ASSERT_TRUE(at::allclose(out[i], ref, 1e-5, 1e-7));
+  }
+}
+
+TEST(GroupedMmTest, MatchesPerGroupMm) {
+  // Heterogeneous shapes, including single-row/column and empty inner dims.
+  std::vector<at::Tensor> mat1, mat2;
+  const std::vector<std::array<int64_t, 3>> shapes = {
+      {4, 5, 6}, {1, 3, 2}, {7, 1, 7}, {2, 0, 3}, {16, 16, 16}};
+  for (const auto& s : shapes) {
+    mat1.push_back(at::randn({s[0], s[1]}));
+    mat2.push_back(at::randn({s[1], s[2]}));
+  }
+  check_grouped_mm(mat1, mat2);
+}
+
+TEST(GroupedMmTest, MatchesPerGroupMmDouble) {
+  std::vector<at::Tensor> mat1, mat2;
+  for (int64_t n : {3, 8, 13}) {
+    mat1.push_back(at::randn({n, n + 1}, at::kDouble));
+    mat2.push_back(at::randn({n + 1, n + 2}, at::kDouble));
+  }
+  check_grouped_mm(mat1, mat2);
+}
+
+TEST(GroupedMmTest, SingleGroup) {
+  check_grouped_mm({at::randn({5, 4})}, {at::randn({4, 3})});
+}
+
+TEST(GroupedMmTest, RejectsInvalidInputs) {
+  auto a = at::randn({4, 5});
+  auto b = at::randn({5, 6});
+  // Mismatched group counts.
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(at::_grouped_mm({a, a}, {b}), c10::Error);
+  // Mismatched inner dimension.
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(at::_grouped_mm({a}, {at::randn({4, 6})}), c10::Error);
+  // Non-2-D operand.
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(at::_grouped_mm({at::randn({4})}, {b}), c10::Error);
+}
+
+} // namespace
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+
+// Correctness of the int4/int8 packed weight matmuls against explicitly
+// dequantized weights fed to at::mm.
+
+namespace {
+
+// Dequantized [N, K] weight for q in [0, 15] with per-(group, column)
+// affine parameters: w = (q - 8) * scale + zero.
+at::Tensor dequant_int4(
+    const at::Tensor& q,
+    const at::Tensor& scales_and_zeros,
+    int64_t group_size) {
+  auto scales = scales_and_zeros.select(2, 0)
+                    .repeat_interleave(group_size, 0)
+                    .t();  // [N, K]
+  auto zeros = scales_and_zeros.select(2, 1)
+                   .repeat_interleave(group_size, 0)
+                   .t();
+  return (q.to(at::kFloat) - 8.0f) * scales + zeros;
+}
+
+TEST(IntMmTest, Int4PackLayout) {
+  const int64_t N = 3, K = 8;
+  auto q = at::randint(0, 16, {N, K}, at::kInt);
+  auto packed = at::_convert_weight_to_int4pack(q, /*group_size=*/4);
+  ASSERT_EQ(packed.scalar_type(), at::kByte);
+  ASSERT_EQ(packed.sizes(), (at::IntArrayRef{N, K / 2}));
+  for (int64_t n = 0; n < N; ++n) {
+    for (int64_t j = 0; j < K / 2; ++j) {
+      // Even k occupies the high nibble.
+      uint8_t expected = static_cast<uint8_t>(
+          (q[n][2 * j].item<int32_t>() << 4) | q[n][2 * j + 1].item<int32_t>());
+      ASSERT_EQ(packed[n][j].item<uint8_t>(), expected);
+    }
+  }
+}
+
+TEST(IntMmTest, Int4MmMatchesDequantizedMm) {
+  for (int64_t M : {1, 7}) {
+    for (int64_t N : {4, 13}) {
+      for (int64_t K : {32, 64}) {
+        for (int64_t group_size : {int64_t(32), K}) {
+          auto a = at::randn({M, K});
+          auto q = at::randint(0, 16, {N, K}, at::kInt);
+          auto packed = at::_convert_weight_to_int4pack(q, group_size);
+          auto scales_and_zeros =
+              at::rand({K / group_size, N, 2}) * 0.1 + 0.01;
+
+          auto out = at::_weight_int4pack_mm(
+              a, packed, group_size, scales_and_zeros);
+          auto ref =
+              at::mm(a, dequant_int4(q, scales_and_zeros, group_size).t());
+          ASSERT_TRUE(at::allclose(out, ref, 1e-4, 1e-5));
+        }
+      }
+    }
+  }
+}
+
+TEST(IntMmTest, Int4MmReducedPrecisionInputs) {
+  const int64_t M = 5, N = 8, K = 64, group_size = 32;
+  auto a = at::randn({M, K});
+  auto q = at::randint(0, 16, {N, K}, at::kInt);
+  auto packed = at::_convert_weight_to_int4pack(q, group_size);
+  auto scales_and_zeros = at::rand({K / group_size, N, 2}) * 0.1 + 0.01;
+  auto ref = at::mm(a, dequant_int4(q, scales_and_zeros, group_size).t());
+
+  for (auto dtype : {at::kHalf, at::kBFloat16}) {
+    auto out = at::_weight_int4pack_mm(
+        a.to(dtype), packed, group_size, scales_and_zeros);
+    ASSERT_EQ(out.scalar_type(), dtype);
+    ASSERT_TRUE(at::allclose(out.to(at::kFloat), ref, 5e-2, 5e-2));
+  }
+}
+
+TEST(IntMmTest, Int8MmMatchesDequantizedMm) {
+  for (int64_t M : {1, 6}) {
+    for (int64_t N : {3, 16}) {
+      for (int64_t K : {1, 33, 128}) {
+        auto a = at::randn({M, K});
+        auto b = at::randint(-128, 128, {N, K}, at::kChar);
+        auto scales = at::rand({N}) * 0.05 + 0.01;
+
+        auto out = at::_weight_int8pack_mm(a, b, scales);
+        auto ref = at::mm(a, (b.to(at::kFloat) * scales.unsqueeze(1)).t());
+        ASSERT_TRUE(at::allclose(out, ref, 1e-4, 1e-5));
+      }
+    }
+  }
+}
+
+TEST(IntMmTest, RejectsInvalidInputs) {
+  auto q = at::randint(0, 16, {4, 32}, at::kInt);
+  // Odd group size.
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(at::_convert_weight_to_int4pack(q, 3), c10::Error);
+  // group_size must divide K.
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(at::_convert_weight_to_int4pack(q, 12), c10::Error);
+  // Wrong weight dtype.
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(
+      at::_convert_weight_to_int4pack(q.to(at::kLong), 16), c10::Error);
+
+  auto a = at::randn({2, 32});
+  auto packed = at::_convert_weight_to_int4pack(q, 16);
+  // Mis-shaped scales_and_zeros.
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(
+      at::_weight_int4pack_mm(a, packed, 16, at::rand({2, 4})), c10::Error);
+}
+
+} // namespace
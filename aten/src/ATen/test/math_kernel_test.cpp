@@ -77,6 +77,53 @@ TEST(MathKernelTest, NativeLayerNorm) {
   }
 }
 
+// Checks the fused single-sweep CPU layer_norm backward against the textbook
+// formulas evaluated in double with plain tensor ops.  Row lengths are chosen
+// to leave vector-width remainders, and the float results are compared to an
+// independent reference rather than to another run of the same kernel.
+TEST(MathKernelTest, NativeLayerNormBackward) {
+  double eps = 1e-05;
+  for (bool undef_weight: {true, false}) {
+    for (int64_t N: {3, 8, 33, 1000}) {
+      const int64_t M = 17;
+      const auto input = rand({M, N});
+      const auto grad_out = rand({M, N});
+      std::vector<int64_t> normalized_shape = {N};
+      Tensor undef;
+      const auto weight = rand(normalized_shape);
+      const auto bias = rand(normalized_shape);
+
+      auto fwd = at::native_layer_norm(
+          input, normalized_shape, undef_weight ? undef : weight,
+          undef_weight ? undef : bias, eps);
+      const auto& mean = std::get<1>(fwd);
+      const auto& rstd = std::get<2>(fwd);
+
+      auto grads = at::native_layer_norm_backward(
+          grad_out, input, normalized_shape, mean, rstd,
+          undef_weight ? undef : weight, undef_weight ? undef : bias,
+          {true, true, true});
+
+      auto x = input.to(kDouble);
+      auto dy = grad_out.to(kDouble);
+      auto x_hat = (x - mean.to(kDouble)) * rstd.to(kDouble);
+      auto dy_w = undef_weight ? dy : dy * weight.to(kDouble);
+      auto ref_dx = (dy_w - dy_w.mean(-1, /*keepdim=*/true) -
+          x_hat * (dy_w * x_hat).mean(-1, /*keepdim=*/true)) *
+          rstd.to(kDouble);
+      auto ref_dgamma = (dy * x_hat).sum(0);
+      auto ref_dbeta = dy.sum(0);
+
+      ASSERT_ALLCLOSE_TOLERANCES(
+          std::get<0>(grads), ref_dx.to(kFloat), 1e-3, 1e-5);
+      ASSERT_ALLCLOSE_TOLERANCES(
+          std::get<1>(grads), ref_dgamma.to(kFloat), 1e-3, 1e-5);
+      ASSERT_ALLCLOSE_TOLERANCES(
+          std::get<2>(grads), ref_dbeta.to(kFloat), 1e-3, 1e-5);
+    }
+  }
+}
+
 TEST(MathKernelTest, Addr) {
   const auto vec1 = arange(1., 4.);
   const auto vec2 = arange(1., 3.);
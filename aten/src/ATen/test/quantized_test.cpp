@@ -211,6 +211,65 @@ TEST(TestQTensor, QuantizePerChannel4dChannelsLast) {
   }
 }
 
+// The per-channel quantize/dequantize kernels take vectorized fast paths for
+// channels-last and NCHW-contiguous layouts; compare both against the
+// per-tensor kernel applied channel by channel, which shares none of the
+// per-channel indexing.  Channel counts are chosen to leave vector-width
+// remainders.
+TEST(TestQTensor, QuantizePerChannelMatchesPerTensorPerChannel) {
+  for (auto memory_format :
+       {at::MemoryFormat::Contiguous, at::MemoryFormat::ChannelsLast}) {
+    for (auto dtype : {kQUInt8, kQInt8, kQInt32}) {
+      for (int C : {1, 7, 8, 19, 64}) {
+        Tensor tensor = rand(
+            {2, C, 5, 3},
+            at::device(at::kCPU).dtype(kFloat).memory_format(memory_format));
+        tensor = tensor * 20 - 10;
+        auto scales = (rand({C}) * 0.1 + 0.01).toType(kDouble);
+        auto zero_points = dtype == kQInt32
+            ? zeros({C}).toType(kLong)
+            : randint(10, {C}).toType(kLong);
+
+        Tensor q = at::native::quantize_per_channel(
+            tensor, scales, zero_points, /*axis=*/1, dtype);
+        Tensor dq = q.dequantize();
+
+        for (const auto c : c10::irange(C)) {
+          Tensor q_ref = at::quantize_per_tensor(
+              tensor.select(1, c).contiguous(),
+              scales[c].item<double>(),
+              zero_points[c].item<int64_t>(),
+              dtype);
+          ASSERT_TRUE(at::equal(
+              q.int_repr().select(1, c).contiguous(), q_ref.int_repr()));
+          ASSERT_TRUE(at::equal(
+              dq.select(1, c).contiguous(), q_ref.dequantize()));
+        }
+      }
+    }
+  }
+}
+
+TEST(TestQTensor, QuantizePerChannel1dBias) {
+  // 1-D per-channel quantization (the bias case) has its own kernel path.
+  const int C = 37;
+  Tensor bias = rand({C}) * 4 - 2;
+  auto scales = (rand({C}) * 0.1 + 0.01).toType(kDouble);
+  auto zero_points = zeros({C}).toType(kLong);
+
+  Tensor q = at::native::quantize_per_channel(
+      bias, scales, zero_points, /*axis=*/0, kQInt32);
+  auto* q_data = q.data_ptr<qint32>();
+  auto* bias_data = bias.data_ptr<float>();
+  for (const auto c : c10::irange(C)) {
+    ASSERT_EQ(
+        q_data[c].val_,
+        native::quantize_val<qint32>(
+            scales[c].item<double>(), 0, bias_data[c])
+            .val_);
+  }
+}
+
 TEST(TestQTensor, FromBlobQuantizedPerTensor) {
   const float scale = 0.1;
   const int64_t zero_point = 10;
@@ -5,6 +5,35 @@
 
 using namespace at;
 
+// The CPU reduction kernel accumulates into four interleaved lanes per
+// thread and joins the per-thread partials with a pairwise tree, so lengths
+// around the lane count, the vector width, and the parallel grain all take
+// different code paths.  Every path must agree with a double accumulation,
+// bit-tolerantly for float, at every thread count.
+TEST(ReduceOpsTest, CpuReductionLengthAndThreadSweep) {
+  const int prev_num_threads = at::get_num_threads();
+  for (int num_threads : {1, 3, 4, 7}) {
+    at::set_num_threads(num_threads);
+    for (int64_t n :
+         {1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 1000, 32768, 32769,
+          100003}) {
+      auto t = at::rand({n}) + 0.5;
+      ASSERT_NEAR(
+          t.sum().item<double>(), t.to(kDouble).sum().item<double>(),
+          n * 1e-5);
+      ASSERT_NEAR(
+          t.mean().item<double>(), t.to(kDouble).mean().item<double>(), 1e-5);
+      // Order-independent reductions must be exact.
+      ASSERT_EQ(t.max().item<float>(), t.to(kDouble).max().item<double>());
+      ASSERT_EQ(t.min().item<float>(), t.to(kDouble).min().item<double>());
+
+      auto l = at::randint(-1000, 1000, {n}, kLong);
+      ASSERT_EQ(l.sum().item<int64_t>(), l.to(kDouble).sum().item<double>());
+    }
+  }
+  at::set_num_threads(prev_num_threads);
+}
+
 TEST(ReduceOpsTest, MaxValuesAndMinValues) {
   const int W = 10;
   const int H = 10;
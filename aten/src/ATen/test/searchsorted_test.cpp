@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+
+#include <algorithm>
+#include <vector>
+
+// The CPU searchsorted kernel walks an Eytzinger (BFS) layout of the
+// boundaries when they are 1-D, unsorted-sorter-free, at least 16 wide, and
+// there are at least as many query values as boundaries.  Compare it against
+// the binary-search path (reached by querying in chunks smaller than the
+// boundary count) and against std::lower_bound/upper_bound directly.
+
+namespace {
+
+void check_searchsorted(
+    const at::Tensor& boundaries,
+    const at::Tensor& values,
+    bool right) {
+  auto out = at::searchsorted(boundaries, values, /*out_int32=*/false, right);
+
+  // Chunks below the gate keep the plain binary-search path.
+  const int64_t chunk = std::max<int64_t>(boundaries.numel() / 2 - 1, 1);
+  std::vector<at::Tensor> pieces;
+  for (int64_t begin = 0; begin < values.numel(); begin += chunk) {
+    int64_t len = std::min(chunk, values.numel() - begin);
+    pieces.push_back(at::searchsorted(
+        boundaries, values.slice(0, begin, begin + len), false, right));
+  }
+  ASSERT_TRUE(at::equal(out, at::cat(pieces)));
+}
+
+TEST(SearchsortedTest, EytzingerPathMatchesBinarySearch) {
+  // Boundary widths straddle the >= 16 gate and include non-power-of-two
+  // sizes where the Eytzinger tree is incomplete.
+  for (int64_t num_boundaries : {15, 16, 17, 100, 1024, 4097}) {
+    auto boundaries =
+        std::get<0>(at::sort(at::randn({num_boundaries}, at::kDouble)));
+    // More queries than boundaries, engaging the fast path; half the values
+    // are exact boundary hits so ties exercise the left/right semantics.
+    auto values = at::cat(
+        {at::randn({num_boundaries}, at::kDouble),
+         boundaries.index_select(
+             0,
+             at::randint(0, num_boundaries, {num_boundaries}, at::kLong))});
+    for (bool right : {false, true}) {
+      check_searchsorted(boundaries, values, right);
+    }
+  }
+}
+
+TEST(SearchsortedTest, MatchesStdLowerUpperBound) {
+  const int64_t n = 256;
+  auto boundaries = std::get<0>(at::sort(at::randint(0, 64, {n}, at::kLong)));
+  auto values = at::randint(-2, 66, {4 * n}, at::kLong);
+  auto left = at::searchsorted(boundaries, values, false, /*right=*/false);
+  auto right = at::searchsorted(boundaries, values, false, /*right=*/true);
+
+  auto* bd = boundaries.data_ptr<int64_t>();
+  auto* v = values.data_ptr<int64_t>();
+  auto* l = left.data_ptr<int64_t>();
+  auto* r = right.data_ptr<int64_t>();
+  for (int64_t i = 0; i < values.numel(); ++i) {
+    ASSERT_EQ(l[i], std::lower_bound(bd, bd + n, v[i]) - bd);
+    ASSERT_EQ(r[i], std::upper_bound(bd, bd + n, v[i]) - bd);
+  }
+}
+
+TEST(SearchsortedTest, MultiDimBoundariesKeepBinarySearchPath) {
+  // 2-D boundaries fail the 1-D gate; per-row results must match querying
+  // each row separately.
+  auto boundaries = std::get<0>(at::sort(at::randn({3, 64}), -1));
+  auto values = at::randn({3, 128});
+  auto out = at::searchsorted(boundaries, values, false, false);
+  for (int64_t row = 0; row < 3; ++row) {
+    ASSERT_TRUE(at::equal(
+        out[row], at::searchsorted(boundaries[row], values[row], false, false)));
+  }
+}
+
+} // namespace
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+
+#include <cstring>
+
+// Covers the segment_reduce softmax mode and the parallelized CPU reductions
+// against references assembled from per-segment slices with plain ops.
+
+namespace {
+
+at::Tensor make_offsets(const at::Tensor& lengths) {
+  auto offsets = at::zeros({lengths.numel() + 1}, at::kLong);
+  offsets.slice(0, 1) = at::cumsum(lengths, 0);
+  return offsets;
+}
+
+TEST(SegmentReduceTest, SoftmaxMatchesPerSegmentSoftmax) {
+  auto lengths = at::tensor({3, 0, 2, 4, 1}, at::kLong);
+  const int64_t n = lengths.sum().item<int64_t>();
+  auto data = at::randn({n});
+
+  auto out = at::segment_reduce(
+      data, "softmax", lengths, /*indices=*/{}, /*offsets=*/{}, /*axis=*/0,
+      /*unsafe=*/false, /*initial=*/c10::nullopt);
+  ASSERT_EQ(out.sizes(), data.sizes());
+
+  auto ref = at::zeros_like(data);
+  int64_t begin = 0;
+  for (int64_t i = 0; i < lengths.numel(); ++i) {
+    int64_t len = lengths[i].item<int64_t>();
+    if (len > 0) {
+      ref.slice(0, begin, begin + len) =
+          at::softmax(data.slice(0, begin, begin + len), 0);
+    }
+    begin += len;
+  }
+  ASSERT_TRUE(at::allclose(out, ref, 1e-5, 1e-7));
+
+  // The offsets variant selects the same segments.
+  auto out_offsets = at::segment_reduce(
+      data, "softmax", /*lengths=*/{}, /*indices=*/{}, make_offsets(lengths),
+      /*axis=*/0, /*unsafe=*/false, /*initial=*/c10::nullopt);
+  ASSERT_TRUE(at::allclose(out_offsets, ref, 1e-5, 1e-7));
+}
+
+TEST(SegmentReduceTest, SoftmaxRejectsInitial) {
+  auto data = at::randn({5});
+  auto lengths = at::tensor({2, 3}, at::kLong);
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(
+      at::segment_reduce(
+          data, "softmax", lengths, /*indices=*/{}, /*offsets=*/{},
+          /*axis=*/0, /*unsafe=*/false, /*initial=*/1.0),
+      c10::Error);
+}
+
+TEST(SegmentReduceTest, ParallelReductionsMatchSliceReference) {
+  // Large enough that the CPU kernel parallelizes across segments and
+  // within the long segments; includes an empty segment.
+  auto lengths = at::tensor({40000, 1, 0, 25000, 7}, at::kLong);
+  const int64_t n = lengths.sum().item<int64_t>();
+  auto data = at::randn({n});
+
+  for (const char* reduce : {"sum", "max", "min", "mean"}) {
+    auto out = at::segment_reduce(
+        data, reduce, lengths, /*indices=*/{}, /*offsets=*/{}, /*axis=*/0,
+        /*unsafe=*/false, /*initial=*/c10::nullopt);
+    ASSERT_EQ(out.numel(), lengths.numel());
+
+    int64_t begin = 0;
+    for (int64_t i = 0; i < lengths.numel(); ++i) {
+      int64_t len = lengths[i].item<int64_t>();
+      if (len > 0) {
+        auto segment = data.slice(0, begin, begin + len);
+        at::Tensor ref;
+        if (strcmp(reduce, "sum") == 0) {
+          ref = segment.sum();
+        } else if (strcmp(reduce, "max") == 0) {
+          ref = segment.max();
+        } else if (strcmp(reduce, "min") == 0) {
+          ref = segment.min();
+        } else {
+          ref = segment.mean();
+        }
+        ASSERT_TRUE(at::allclose(out[i], ref, 1e-4, 1e-6))
+            << "reduce=" << reduce << " segment=" << i;
+      }
+      begin += len;
+    }
+  }
+}
+
+} // namespace
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+
+// The CPU sort kernel takes a parallel radix-partition fast path for
+// contiguous 1-D int/float/double tensors of at least 2^16 elements.  These
+// tests compare it against the comparator path, which still handles every
+// other layout: sorting the same data viewed as a 1xN matrix along dim 1
+// stays on the comparator path, so the two results must agree exactly.
+
+namespace {
+
+constexpr int64_t kRadixSortThreshold = 1 << 16;
+
+void check_against_comparator_path(
+    const at::Tensor& input,
+    bool descending,
+    bool stable) {
+  ASSERT_EQ(input.dim(), 1);
+  auto [fast_values, fast_indices] =
+      at::sort(input, stable, /*dim=*/0, descending);
+  auto [ref_values, ref_indices] =
+      at::sort(input.unsqueeze(0), stable, /*dim=*/1, descending);
+  ASSERT_TRUE(at::equal(fast_values, ref_values.squeeze(0)));
+  if (stable) {
+    // Stable sorts are fully determined by the input, so the permutations
+    // must match even across duplicate values.
+    ASSERT_TRUE(at::equal(fast_indices, ref_indices.squeeze(0)));
+  } else {
+    // Unstable sorts may order duplicates differently; the gathered values
+    // must still reproduce the input.
+    ASSERT_TRUE(at::equal(input.gather(0, fast_indices), fast_values));
+  }
+}
+
+TEST(SortTest, RadixPathMatchesComparatorPathFloat) {
+  // Straddle the size gate: one below stays on the comparator path anyway,
+  // one above exercises the radix partition including its remainder chunk.
+  for (int64_t n : {kRadixSortThreshold - 1, kRadixSortThreshold + 123}) {
+    // Few distinct values produce long runs of duplicates in every bucket.
+    auto input = at::randint(0, 100, {n}, at::kFloat);
+    for (bool descending : {false, true}) {
+      for (bool stable : {false, true}) {
+        check_against_comparator_path(input, descending, stable);
+      }
+    }
+  }
+}
+
+TEST(SortTest, RadixPathMatchesComparatorPathInt) {
+  const int64_t n = kRadixSortThreshold + 7;
+  // Negative values cross the sign-bit flip in the key mapping.
+  auto input = at::randint(-1000000, 1000000, {n}, at::kLong);
+  for (bool descending : {false, true}) {
+    check_against_comparator_path(input, descending, /*stable=*/true);
+  }
+  check_against_comparator_path(input.to(at::kInt), false, /*stable=*/true);
+}
+
+TEST(SortTest, RadixPathNanPlacement) {
+  const int64_t n = kRadixSortThreshold + 11;
+  auto input = at::randn({n}, at::kDouble);
+  input.index_put_(
+      {at::randint(0, n, {n / 100}, at::kLong)},
+      at::scalar_tensor(std::numeric_limits<double>::quiet_NaN(), at::kDouble));
+  // NaNs sort last ascending and first descending, same as the comparators.
+  for (bool descending : {false, true}) {
+    check_against_comparator_path(input, descending, /*stable=*/true);
+  }
+}
+
+TEST(SortTest, RadixPathSignedZerosAreStable) {
+  const int64_t n = kRadixSortThreshold + 2;
+  auto input = at::randint(-4, 5, {n}, at::kFloat);
+  // Mix -0.0 into the existing zeros; a stable sort must keep the input
+  // order of signed zeros, which requires -0.0 and +0.0 to share one key.
+  input.masked_fill_(at::rand({n}) < 0.25, -0.0f);
+  for (bool descending : {false, true}) {
+    check_against_comparator_path(input, descending, /*stable=*/true);
+  }
+}
+
+TEST(SortTest, RadixPathAllEqualShortCircuit) {
+  const int64_t n = kRadixSortThreshold;
+  auto input = at::full({n}, 42, at::kLong);
+  auto [values, indices] = at::sort(input, /*stable=*/true, 0, false);
+  ASSERT_TRUE(at::equal(values, input));
+  ASSERT_TRUE(at::equal(indices, at::arange(n, at::kLong)));
+}
+
+TEST(SortTest, StridedInputKeepsComparatorPath) {
+  // A stride-2 view fails the contiguity gate; the result must still agree
+  // with sorting a contiguous copy of the same elements.
+  const int64_t n = kRadixSortThreshold + 10;
+  auto base = at::randint(0, 1000, {2 * n}, at::kFloat);
+  auto strided = base.slice(0, 0, 2 * n, 2);
+  ASSERT_FALSE(strided.is_contiguous());
+  auto [a_values, a_indices] =
+      at::sort(strided.contiguous(), /*stable=*/true, 0, false);
+  auto [b_values, b_indices] = at::sort(strided, /*stable=*/true, 0, false);
+  ASSERT_TRUE(at::equal(a_values, b_values));
+  ASSERT_TRUE(at::equal(a_indices, b_indices));
+}
+
+} // namespace
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+
+#include <limits>
+
+// The CPU topk kernel has a threshold-scan fast path gated on
+// k <= 256 && k * 64 <= n, plus a parallel variant for single-slice (1-D)
+// inputs.  Compare against a full sort on k values straddling both gates,
+// with duplicate-heavy inputs where the selected index set is ambiguous.
+
+namespace {
+
+void check_topk(const at::Tensor& input, int64_t k, bool largest) {
+  auto [values, indices] =
+      at::topk(input, k, /*dim=*/-1, largest, /*sorted=*/true);
+  auto ref_values = std::get<0>(at::sort(input, /*dim=*/-1, largest))
+                        .narrow(-1, 0, k);
+  // Values must equal the sorted prefix exactly; with duplicates the index
+  // choice is unspecified, but gathering must reproduce the values.
+  ASSERT_TRUE(at::equal(values, ref_values));
+  ASSERT_TRUE(at::equal(input.gather(-1, indices), values));
+}
+
+TEST(TopkTest, FastPathMatchesSortFloat) {
+  const int64_t n = 16384;
+  // Duplicate-heavy so bucket thresholds land on ties.
+  auto input = at::randint(0, 64, {n}, at::kFloat);
+  // k = 256 is the last value inside both gates (256 * 64 == n);
+  // k = 257 falls back to the partial-sort path.
+  for (int64_t k : {1, 2, 255, 256, 257, 1000, n}) {
+    for (bool largest : {true, false}) {
+      check_topk(input, k, largest);
+    }
+  }
+}
+
+TEST(TopkTest, FastPathMatchesSortInt) {
+  const int64_t n = 65536;
+  auto input = at::randint(-1000, 1000, {n}, at::kLong);
+  for (int64_t k : {1, 128, 256}) {
+    for (bool largest : {true, false}) {
+      check_topk(input, k, largest);
+    }
+  }
+}
+
+TEST(TopkTest, MultiSlicePathMatchesSort) {
+  // num_slices > 1 stays on the per-slice scalar path; it must agree with
+  // the single-slice parallel path on identical rows.
+  const int64_t n = 8192;
+  auto row = at::randint(0, 100, {n}, at::kFloat);
+  auto input = row.unsqueeze(0).expand({4, n}).contiguous();
+  const int64_t k = 64;
+  auto [multi_values, multi_indices] = at::topk(input, k, -1, true, true);
+  auto [single_values, single_indices] = at::topk(row, k, -1, true, true);
+  for (int64_t b = 0; b < 4; ++b) {
+    ASSERT_TRUE(at::equal(multi_values[b], single_values));
+  }
+}
+
+TEST(TopkTest, HotValuesAndExtremes) {
+  // A few hot values plus infinities stress the threshold scan's tie and
+  // boundary handling.
+  const int64_t n = 32768;
+  auto input = at::full({n}, 1.0f);
+  input.index_put_({at::arange(0, n, 100, at::kLong)}, 2.0f);
+  input[7] = std::numeric_limits<float>::infinity();
+  input[11] = -std::numeric_limits<float>::infinity();
+  for (int64_t k : {1, 16, 256}) {
+    for (bool largest : {true, false}) {
+      check_topk(input, k, largest);
+    }
+  }
+}
+
+} // namespace
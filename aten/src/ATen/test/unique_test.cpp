@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+
+// The CPU unique kernel builds per-chunk hash maps in parallel for large
+// inputs and merges them; small inputs stay sequential.  Validate the
+// parallel path on inputs spanning many chunks by checking the invariants
+// (sorted output, inverse reconstructs the input, counts match) against
+// references computed with plain tensor ops.
+
+namespace {
+
+void check_unique(const at::Tensor& input) {
+  auto [values, inverse, counts] = at::_unique2(
+      input, /*sorted=*/true, /*return_inverse=*/true,
+      /*return_counts=*/true);
+
+  // Sorted and duplicate-free.
+  ASSERT_TRUE(at::equal(values, std::get<0>(at::sort(values))));
+  if (values.numel() > 1) {
+    ASSERT_TRUE(
+        (values.slice(0, 1) != values.slice(0, 0, values.numel() - 1))
+            .all()
+            .item<bool>());
+  }
+
+  // The inverse maps every element back to itself.
+  ASSERT_TRUE(at::equal(values.index_select(0, inverse), input));
+
+  // Counts per value match a direct comparison and sum to numel.
+  ASSERT_EQ(counts.sum().item<int64_t>(), input.numel());
+  for (int64_t i = 0; i < values.numel(); ++i) {
+    ASSERT_EQ(
+        counts[i].item<int64_t>(),
+        (input == values[i]).sum().item<int64_t>());
+  }
+
+  // The sequential path (one chunk) must find the same values and counts.
+  if (input.numel() > 64) {
+    auto [small_values, small_inverse, small_counts] = at::_unique2(
+        input.slice(0, 0, 64), true, true, true);
+    ASSERT_TRUE(at::equal(
+        small_values.index_select(0, small_inverse), input.slice(0, 0, 64)));
+  }
+}
+
+TEST(UniqueTest, ParallelPathInvariantsInt) {
+  // Spans many parallel chunks with few distinct values, so every chunk map
+  // sees every value and the merge dedups heavily.
+  auto input = at::randint(0, 50, {200000}, at::kLong);
+  // A value confined to the final chunk must survive the merge.
+  input[199999] = 12345;
+  check_unique(input);
+}
+
+TEST(UniqueTest, ParallelPathInvariantsFloat) {
+  auto input = at::randint(-100, 100, {150000}, at::kFloat);
+  check_unique(input);
+  // Signed zeros compare equal and must collapse to one entry.
+  input.masked_fill_(at::rand({150000}) < 0.1, -0.0f);
+  auto values = std::get<0>(
+      at::_unique2(input, true, false, false));
+  ASSERT_EQ((values == 0.0f).sum().item<int64_t>(), 1);
+}
+
+TEST(UniqueTest, SmallAndEdgeCases) {
+  check_unique(at::randint(0, 5, {33}, at::kLong));
+  check_unique(at::tensor({7}, at::kLong));
+  check_unique(at::full({100000}, 3, at::kLong));
+
+  auto empty = at::empty({0}, at::kLong);
+  auto [values, inverse, counts] = at::_unique2(empty, true, true, true);
+  ASSERT_EQ(values.numel(), 0);
+  ASSERT_EQ(counts.numel(), 0);
+}
+
+TEST(UniqueTest, BoolKeepsSequentialPath) {
+  auto input = at::randint(0, 2, {100000}, at::kLong).to(at::kBool);
+  auto [values, inverse, counts] = at::_unique2(input, true, true, true);
+  ASSERT_LE(values.numel(), 2);
+  ASSERT_TRUE(at::equal(values.index_select(0, inverse), input));
+  ASSERT_EQ(counts.sum().item<int64_t>(), 100000);
+}
+
+} // namespace
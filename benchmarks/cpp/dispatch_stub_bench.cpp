@@ -0,0 +1,176 @@
+// Microbenchmark harness for the DispatchStub CPU kernels in
+// aten/src/ATen/native/cpu/.
+//
+// Each entry registers one kernel with a shape sweep (1-D contiguous float
+// tensors, numel swept in powers of two) and a per-element byte count, and the
+// harness reports bytes/sec (via google-benchmark's byte counter) plus
+// bytes/cycle and instructions/iteration measured with perf_event_open
+// through the profiler's linux_perf wrapper. On kernels where the hardware
+// counters are unavailable (e.g. perf_event_paranoid or a container seccomp
+// policy) the perf-derived counters are simply omitted.
+//
+// Kernels are exercised through their dispatching ATen op so the benchmark
+// measures exactly what eager mode runs (stub lookup included; its cost is in
+// the noise at these sizes).
+//
+// To compare against a stored baseline, run with
+//   dispatch_stub_bench --benchmark_out=baseline.json
+// on the reference build, and diff a candidate's JSON with google-benchmark's
+// tools/compare.py.
+
+#include <ATen/ATen.h>
+#include <benchmark/benchmark.h>
+#include <c10/core/InferenceMode.h>
+#include <torch/csrc/profiler/events.h>
+#include <torch/csrc/profiler/perf.h>
+
+#include <c10/util/irange.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace {
+
+using torch::profiler::impl::linux_perf::PerfProfiler;
+
+// Counts cycles and instructions around the timed loop. Configuration can
+// fail on locked-down machines, in which case counting is disabled and the
+// benchmark still reports wall-time numbers.
+class PerfCounters {
+ public:
+  PerfCounters() {
+    std::vector<std::string> events(
+        torch::profiler::ProfilerPerfEvents.begin(),
+        torch::profiler::ProfilerPerfEvents.end());
+    try {
+      profiler_.Configure(events);
+      available_ = true;
+    } catch (const std::exception&) {
+      available_ = false;
+    }
+  }
+
+  void enable() {
+    if (available_) {
+      profiler_.Enable();
+    }
+  }
+
+  // Returns {cycles, instructions} since enable(), or zeros if unavailable.
+  torch::profiler::perf_counters_t disable() {
+    torch::profiler::perf_counters_t counters(
+        torch::profiler::ProfilerPerfEvents.size(), 0);
+    if (available_) {
+      profiler_.Disable(counters);
+    }
+    return counters;
+  }
+
+  bool available() const {
+    return available_;
+  }
+
+ private:
+  PerfProfiler profiler_;
+  bool available_{false};
+};
+
+// One registered stub benchmark: `op` runs the kernel once on preallocated
+// tensors; `bytes_per_element` is the traffic the kernel moves per output
+// element (reads + writes), used for the bytes/sec and bytes/cycle rates.
+struct StubBenchmark {
+  std::string name;
+  int64_t num_inputs;
+  int64_t bytes_per_element;
+  std::function<void(const std::vector<at::Tensor>&, at::Tensor&)> op;
+};
+
+void run_stub_benchmark(benchmark::State& state, const StubBenchmark& reg) {
+  c10::InferenceMode guard;
+  const int64_t numel = state.range(0);
+
+  std::vector<at::Tensor> inputs;
+  for (const auto i : c10::irange(reg.num_inputs)) {
+    (void)i;
+    inputs.push_back(at::rand({numel}));
+  }
+  at::Tensor out = at::empty({numel});
+
+  // Warm up once outside the counted region so lazy dispatch-stub resolution
+  // and first-touch page faults are not attributed to the kernel.
+  reg.op(inputs, out);
+
+  PerfCounters counters;
+  counters.enable();
+  for (auto _ : state) {
+    reg.op(inputs, out);
+    benchmark::DoNotOptimize(out);
+  }
+  auto perf = counters.disable();
+
+  const int64_t total_bytes =
+      state.iterations() * numel * reg.bytes_per_element;
+  state.SetBytesProcessed(total_bytes);
+  if (counters.available() && perf[0] > 0) {
+    state.counters["bytes_per_cycle"] =
+        static_cast<double>(total_bytes) / static_cast<double>(perf[0]);
+    state.counters["instructions_per_iter"] = benchmark::Counter(
+        static_cast<double>(perf[1]), benchmark::Counter::kAvgIterations);
+  }
+}
+
+void register_stub_benchmark(StubBenchmark reg) {
+  auto* bench = benchmark::RegisterBenchmark(
+      reg.name.c_str(),
+      [reg = std::move(reg)](benchmark::State& state) {
+        run_stub_benchmark(state, reg);
+      });
+  bench->RangeMultiplier(8)->Range(1 << 12, 1 << 24)->UseRealTime();
+}
+
+// Shape sweeps register at static-init time, so adding a kernel is one entry
+// here. `bytes_per_element` assumes float32 in/out.
+C10_UNUSED const bool registered = [] {
+  register_stub_benchmark(
+      {"add_stub", 2, 12, [](const std::vector<at::Tensor>& in, at::Tensor& out) {
+         at::add_out(out, in[0], in[1]);
+       }});
+  register_stub_benchmark(
+      {"mul_stub", 2, 12, [](const std::vector<at::Tensor>& in, at::Tensor& out) {
+         at::mul_out(out, in[0], in[1]);
+       }});
+  register_stub_benchmark(
+      {"exp_stub", 1, 8, [](const std::vector<at::Tensor>& in, at::Tensor& out) {
+         at::exp_out(out, in[0]);
+       }});
+  register_stub_benchmark(
+      {"sigmoid_stub", 1, 8, [](const std::vector<at::Tensor>& in, at::Tensor& out) {
+         at::sigmoid_out(out, in[0]);
+       }});
+  register_stub_benchmark(
+      {"clamp_stub", 1, 8, [](const std::vector<at::Tensor>& in, at::Tensor& out) {
+         at::clamp_out(out, in[0], 0.25, 0.75);
+       }});
+  register_stub_benchmark(
+      {"copy_stub", 1, 8, [](const std::vector<at::Tensor>& in, at::Tensor& out) {
+         out.copy_(in[0]);
+       }});
+  register_stub_benchmark(
+      {"fill_stub", 0, 4, [](const std::vector<at::Tensor>&, at::Tensor& out) {
+         out.fill_(1.0);
+       }});
+  register_stub_benchmark(
+      {"sum_stub", 1, 4, [](const std::vector<at::Tensor>& in, at::Tensor& out) {
+         at::sum_out(out, in[0], std::vector<int64_t>{0});
+       }});
+  register_stub_benchmark(
+      {"softmax_kernel", 1, 8, [](const std::vector<at::Tensor>& in, at::Tensor& out) {
+         at::_softmax_out(out, in[0].view({-1, 512}), 1, false);
+       }});
+  return true;
+}();
+
+} // namespace
+
+BENCHMARK_MAIN();
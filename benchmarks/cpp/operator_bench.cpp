@@ -0,0 +1,255 @@
+// Cross-backend operator benchmark harness.
+//
+// Each operator is declared exactly once, together with a shape sweep, and the
+// harness enumerates it across every backend available in the build: CPU
+// always, CUDA when at::hasCUDA(), and the quantized CPU kernels for operators
+// that have them. That keeps the benchmarked configurations identical across
+// backends by construction, instead of relying on parallel per-backend lists
+// staying in sync.
+//
+// Each (op, backend, shape) combination is registered twice:
+//   * a hot-cache variant that times back-to-back calls the way
+//     google-benchmark normally does (CUDA variants synchronize inside the
+//     timed region, so they measure launch + kernel, not just launch), and
+//   * a `_cold` variant for the CPU backends that streams through an
+//     LLC-sized buffer between calls and reports manual per-call timings, so
+//     operators whose cost is dominated by memory traffic are measured
+//     against DRAM rather than a warmed cache.
+//
+// Output is google-benchmark's; run with --benchmark_format=json (or
+// --benchmark_out=results.json) for machine-readable results, and diff
+// candidate/baseline JSON with google-benchmark's tools/compare.py.
+
+#include <ATen/ATen.h>
+#include <ATen/detail/CUDAHooksInterface.h>
+#include <benchmark/benchmark.h>
+#include <c10/core/InferenceMode.h>
+#include <c10/util/irange.h>
+
+#include <chrono>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+enum class Backend {
+  CPU,
+  CUDA,
+  QuantizedCPU,
+};
+
+const char* backend_name(Backend backend) {
+  switch (backend) {
+    case Backend::CPU:
+      return "cpu";
+    case Backend::CUDA:
+      return "cuda";
+    case Backend::QuantizedCPU:
+      return "qcpu";
+  }
+  return "unknown";
+}
+
+// One operator declaration. `op` is the functional form run on every backend;
+// inputs are built per-backend so the lambda never needs to know where it is
+// running. `supports_quantized` is set only for operators with a native
+// quantized CPU kernel (running the others on quantized tensors would just
+// benchmark dequantize/requantize).
+struct OpBenchmark {
+  std::string name;
+  int64_t num_inputs;
+  bool supports_quantized;
+  std::function<at::Tensor(const std::vector<at::Tensor>&)> op;
+};
+
+std::vector<at::Tensor> make_inputs(
+    const OpBenchmark& reg,
+    Backend backend,
+    const std::vector<int64_t>& shape) {
+  std::vector<at::Tensor> inputs;
+  for (const auto i : c10::irange(reg.num_inputs)) {
+    (void)i;
+    switch (backend) {
+      case Backend::CPU:
+        inputs.push_back(at::randn(shape));
+        break;
+      case Backend::CUDA:
+        inputs.push_back(at::randn(shape, at::device(at::kCUDA)));
+        break;
+      case Backend::QuantizedCPU:
+        inputs.push_back(at::quantize_per_tensor(
+            at::rand(shape), /*scale=*/0.05, /*zero_point=*/64, at::kQUInt8));
+        break;
+    }
+  }
+  return inputs;
+}
+
+void synchronize(Backend backend) {
+  if (backend == Backend::CUDA) {
+    at::detail::getCUDAHooks().deviceSynchronize(0);
+  }
+}
+
+// Streams through a buffer comfortably larger than any current LLC so the
+// next operator call starts from DRAM.
+void flush_cache() {
+  constexpr int64_t kFlushBytes = 256 * 1024 * 1024;
+  static std::vector<char> buffer(kFlushBytes, 1);
+  int64_t sum = 0;
+  for (int64_t i = 0; i < kFlushBytes; i += 64) {
+    sum += buffer[i];
+  }
+  benchmark::DoNotOptimize(sum);
+}
+
+void run_hot(
+    benchmark::State& state,
+    const OpBenchmark& reg,
+    Backend backend,
+    const std::vector<int64_t>& shape) {
+  c10::InferenceMode guard;
+  auto inputs = make_inputs(reg, backend, shape);
+  // Warm-up covers lazy dispatch resolution and, on CUDA, context creation.
+  auto out = reg.op(inputs);
+  synchronize(backend);
+  for (auto _ : state) {
+    out = reg.op(inputs);
+    synchronize(backend);
+    benchmark::DoNotOptimize(out);
+  }
+  int64_t bytes = out.nbytes();
+  for (auto const& input : inputs) {
+    bytes += input.nbytes();
+  }
+  state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+void run_cold(
+    benchmark::State& state,
+    const OpBenchmark& reg,
+    Backend backend,
+    const std::vector<int64_t>& shape) {
+  c10::InferenceMode guard;
+  auto inputs = make_inputs(reg, backend, shape);
+  auto out = reg.op(inputs);
+  for (auto _ : state) {
+    flush_cache();
+    auto start = std::chrono::high_resolution_clock::now();
+    out = reg.op(inputs);
+    auto end = std::chrono::high_resolution_clock::now();
+    benchmark::DoNotOptimize(out);
+    state.SetIterationTime(
+        std::chrono::duration_cast<std::chrono::duration<double>>(end - start)
+            .count());
+  }
+  int64_t bytes = out.nbytes();
+  for (auto const& input : inputs) {
+    bytes += input.nbytes();
+  }
+  state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+std::string benchmark_name(
+    const OpBenchmark& reg,
+    Backend backend,
+    const std::vector<int64_t>& shape,
+    const char* suffix) {
+  std::ostringstream os;
+  os << reg.name << "_" << backend_name(backend) << "_";
+  bool first = true;
+  for (auto const& dim : shape) {
+    if (!first) {
+      os << "x";
+    }
+    first = false;
+    os << dim;
+  }
+  os << suffix;
+  return os.str();
+}
+
+void register_op_benchmark(
+    const OpBenchmark& reg,
+    const std::vector<std::vector<int64_t>>& shapes) {
+  std::vector<Backend> backends = {Backend::CPU};
+  if (at::hasCUDA()) {
+    backends.push_back(Backend::CUDA);
+  }
+  if (reg.supports_quantized) {
+    backends.push_back(Backend::QuantizedCPU);
+  }
+  for (auto backend : backends) {
+    for (auto const& shape : shapes) {
+      benchmark::RegisterBenchmark(
+          benchmark_name(reg, backend, shape, "").c_str(),
+          [reg, backend, shape](benchmark::State& state) {
+            run_hot(state, reg, backend, shape);
+          });
+      if (backend != Backend::CUDA) {
+        benchmark::RegisterBenchmark(
+            benchmark_name(reg, backend, shape, "_cold").c_str(),
+            [reg, backend, shape](benchmark::State& state) {
+              run_cold(state, reg, backend, shape);
+            })
+            ->UseManualTime();
+      }
+    }
+  }
+}
+
+const std::vector<std::vector<int64_t>> PointwiseShapes = {
+    {64},
+    {4096},
+    {1 << 20},
+    {128, 128},
+    {1024, 1024},
+};
+
+const std::vector<std::vector<int64_t>> MatmulShapes = {
+    {64, 64},
+    {256, 256},
+    {1024, 1024},
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+  register_op_benchmark(
+      {"add", 2, /*supports_quantized=*/false,
+       [](const std::vector<at::Tensor>& in) { return at::add(in[0], in[1]); }},
+      PointwiseShapes);
+  register_op_benchmark(
+      {"mul", 2, /*supports_quantized=*/false,
+       [](const std::vector<at::Tensor>& in) { return at::mul(in[0], in[1]); }},
+      PointwiseShapes);
+  register_op_benchmark(
+      {"relu", 1, /*supports_quantized=*/true,
+       [](const std::vector<at::Tensor>& in) { return at::relu(in[0]); }},
+      PointwiseShapes);
+  register_op_benchmark(
+      {"sigmoid", 1, /*supports_quantized=*/true,
+       [](const std::vector<at::Tensor>& in) { return at::sigmoid(in[0]); }},
+      PointwiseShapes);
+  register_op_benchmark(
+      {"sum", 1, /*supports_quantized=*/false,
+       [](const std::vector<at::Tensor>& in) { return at::sum(in[0]); }},
+      PointwiseShapes);
+  register_op_benchmark(
+      {"softmax", 1, /*supports_quantized=*/false,
+       [](const std::vector<at::Tensor>& in) {
+         return at::softmax(in[0].view({-1, 512}), 1);
+       }},
+      {{1 << 20}});
+  register_op_benchmark(
+      {"matmul", 2, /*supports_quantized=*/false,
+       [](const std::vector<at::Tensor>& in) {
+         return at::matmul(in[0], in[1]);
+       }},
+      MatmulShapes);
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -190,6 +190,38 @@ def run_once_functorch(model: Callable, inp: InputsType, task: str, v: VType, ma
         atol = 1e-2 if task == "vhp" else 5e-3
         torch.testing.assert_close(res, expected, rtol=1e-5, atol=atol, msg=f"Consistency fail for task '{task}'")
 
+def run_dispatch_overhead(args: Any) -> None:
+    # Measures the per-op dispatch overhead of (nested) functorch transforms
+    # against plain autograd. The workload is a chain of cheap pointwise ops
+    # on small tensors so that dispatch, not compute, dominates; useful as a
+    # regression metric for the DynamicLayer per-op path.
+    num_ops = 100
+
+    def chain(x):
+        for _ in range(num_ops):
+            x = x * 1.0001
+        return x.sum()
+
+    def measure(fn, *fn_args) -> float:
+        fn(*fn_args)  # warmup
+        start = time.time()
+        for _ in range(args.num_iters):
+            fn(*fn_args)
+        return (time.time() - start) / (args.num_iters * num_ops)
+
+    x = torch.randn(64, requires_grad=True)
+    baseline = measure(lambda t: torch.autograd.grad(chain(t), t), x)
+    results = {"autograd grad": baseline}
+
+    if has_functorch:
+        results["functorch grad"] = measure(ft.grad(chain), torch.randn(64))
+        results["functorch grad(vmap)"] = measure(
+            ft.grad(lambda t: ft.vmap(chain)(t).sum()), torch.randn(8, 64))
+
+    for name, per_op in results.items():
+        print("Per-op time for {}: {:.3f}us ({:.2f}x autograd grad)".format(
+            name, per_op * 1e6, per_op / baseline))
+
 def run_model(model_getter: GetterType, args: Any, task: str, run_once_fn: Callable = run_once) -> List[float]:
     if args.gpu == -1:
         device = torch.device("cpu")
@@ -231,6 +263,9 @@ def main():
     parser.add_argument("--num-threads", type=int, default=10,
                         help="Number of concurrent threads to use when running on cpu")
     parser.add_argument("--seed", type=int, default=0, help="The random seed to use.")
+    parser.add_argument("--dispatch-overhead", action="store_true",
+                        help="Only run the per-op dispatch overhead microbenchmark "
+                             "(tracks functorch transform overhead vs plain autograd)")
     args = parser.parse_args()
 
     results: TimingResultType = defaultdict(defaultdict)
@@ -243,6 +278,10 @@ def main():
     if args.gpu == -2:
         args.gpu = 0 if torch.cuda.is_available() else -1
 
+    if args.dispatch_overhead:
+        run_dispatch_overhead(args)
+        return
+
     for name, model_getter, recommended_tasks, unsupported_tasks in MODELS:
         if args.model_filter and name not in args.model_filter:
             continue
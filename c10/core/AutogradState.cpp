@@ -1,15 +1,30 @@
 #include <c10/core/AutogradState.h>
+#include <c10/core/InferenceMode.h>
 
 namespace c10 {
 
 namespace {
 // By default, grad mode and mulithreading are enabled, inference mode is
-// disabled,
-thread_local AutogradState autograd_state_tls = AutogradState(
-    /* grad_mode */ true,
-    /* inference_mode */ false,
-    /* fw_grad_mode */ true,
-    /* multithreading_enabled */ true);
+// disabled. In the no-autograd tier every thread instead starts out in the
+// inference mode state, with its dispatch TLS shaped (and the tier
+// invariant asserted) once here. See Note [No-autograd tier]
+AutogradState make_default_autograd_state() {
+  if (!no_autograd_tier_enabled()) {
+    return AutogradState(
+        /* grad_mode */ true,
+        /* inference_mode */ false,
+        /* fw_grad_mode */ true,
+        /* multithreading_enabled */ true);
+  }
+  no_autograd_tier_init_tls();
+  return AutogradState(
+      /* grad_mode */ false,
+      /* inference_mode */ true,
+      /* fw_grad_mode */ false,
+      /* multithreading_enabled */ false);
+}
+
+thread_local AutogradState autograd_state_tls = make_default_autograd_state();
 } // namespace
 
 AutogradState& AutogradState::get_tls_state() {
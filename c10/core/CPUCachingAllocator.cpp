@@ -0,0 +1,305 @@
+#include <c10/core/CPUCachingAllocator.h>
+
+#include <c10/core/CPUAllocator.h>
+#include <c10/core/alignment.h>
+#include <c10/core/impl/alloc_cpu.h>
+#include <c10/util/SmallVector.h>
+#include <c10/util/env.h>
+#include <c10/util/llvmMathExtras.h>
+#include <c10/util/numa.h>
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+
+namespace c10 {
+
+namespace {
+
+// Size classes are powers of two from 64B up to 64MB. Blocks above the top
+// class are rare, expensive to hold onto, and usually long-lived, so they
+// bypass the cache entirely.
+constexpr size_t kMinSizeClassLog2 = 6;
+constexpr size_t kMaxSizeClassLog2 = 26;
+constexpr size_t kNumSizeClasses = kMaxSizeClassLog2 - kMinSizeClassLog2 + 1;
+// How many blocks a thread keeps per size class before spilling half of them
+// to the shared depot, and the refill batch size on a magazine miss.
+constexpr size_t kMagazineCapacity = 8;
+
+// Every block carries its rounded size in a gAlignment-sized header so the
+// free path can find its size class without a shared ptr->size map; the
+// pointer handed out stays gAlignment-aligned.
+constexpr size_t kHeaderBytes = gAlignment;
+
+size_t size_class_of(size_t nbytes) {
+  const auto log2 = c10::llvm::Log2_64_Ceil(nbytes | (1ull << kMinSizeClassLog2));
+  return log2 - kMinSizeClassLog2;
+}
+
+size_t size_class_bytes(size_t size_class) {
+  return 1ull << (size_class + kMinSizeClassLog2);
+}
+
+std::atomic<uint64_t> allocations_{0};
+std::atomic<uint64_t> hits_{0};
+std::atomic<uint64_t> cached_bytes_{0};
+std::atomic<uint64_t> evicted_bytes_{0};
+
+uint64_t max_cached_bytes() {
+  static const uint64_t value = [] {
+    constexpr uint64_t kDefaultMaxCachedBytes = 1ull << 30;
+    const char* env = std::getenv("TORCH_CPU_CACHING_ALLOCATOR_MAX_BYTES");
+    if (env == nullptr) {
+      return kDefaultMaxCachedBytes;
+    }
+    char* end = nullptr;
+    const uint64_t parsed = std::strtoull(env, &end, 10);
+    return (end == env) ? kDefaultMaxCachedBytes : parsed;
+  }();
+  return value;
+}
+
+void* write_header(void* base, size_t rounded_bytes) {
+  *static_cast<size_t*>(base) = rounded_bytes;
+  return static_cast<uint8_t*>(base) + kHeaderBytes;
+}
+
+void* base_of(void* ptr) {
+  return static_cast<uint8_t*>(ptr) - kHeaderBytes;
+}
+
+size_t rounded_size_of(void* ptr) {
+  return *static_cast<size_t*>(base_of(ptr));
+}
+
+// One depot per NUMA node. alloc_cpu NUMA-moves fresh pages to the
+// allocating thread's node, and threads spill/refill against their current
+// node, so recycled blocks stay approximately node-local.
+struct Depot {
+  std::mutex mutex;
+  std::array<c10::SmallVector<void*, 16>, kNumSizeClasses> blocks;
+};
+
+struct Depots {
+  explicit Depots(size_t num_nodes) : per_node(num_nodes) {}
+  std::vector<Depot> per_node;
+
+  Depot& local() {
+    const auto node = GetCurrentNUMANode();
+    return per_node[(node < 0 || static_cast<size_t>(node) >= per_node.size())
+                        ? 0
+                        : node];
+  }
+};
+
+Depots& depots() {
+  // Leaky singleton: thread magazines flush here from thread_local
+  // destructors, which may run during process teardown.
+  static Depots* depots =
+      new Depots(std::max(GetNumNUMANodes(), 1));
+  return *depots;
+}
+
+void os_free(void* ptr) {
+  c10::free_cpu(base_of(ptr));
+}
+
+// Frees a block to the OS, attributing it to the eviction counter.
+void evict(void* ptr, size_t rounded_bytes) {
+  os_free(ptr);
+  evicted_bytes_.fetch_add(rounded_bytes, std::memory_order_relaxed);
+}
+
+struct ThreadMagazines {
+  std::array<c10::SmallVector<void*, kMagazineCapacity>, kNumSizeClasses>
+      classes;
+
+  ~ThreadMagazines() {
+    for (size_t size_class = 0; size_class < kNumSizeClasses; ++size_class) {
+      auto& mag = classes[size_class];
+      if (mag.empty()) {
+        continue;
+      }
+      auto& depot = depots().local();
+      std::lock_guard<std::mutex> guard(depot.mutex);
+      for (void* ptr : mag) {
+        depot.blocks[size_class].push_back(ptr);
+      }
+      mag.clear();
+    }
+  }
+
+  void* pop(size_t size_class) {
+    auto& mag = classes[size_class];
+    if (!mag.empty()) {
+      return mag.pop_back_val();
+    }
+    // Refill a batch from the local depot so a run of allocations pays for
+    // one lock acquisition.
+    auto& depot = depots().local();
+    std::lock_guard<std::mutex> guard(depot.mutex);
+    auto& blocks = depot.blocks[size_class];
+    if (blocks.empty()) {
+      return nullptr;
+    }
+    const size_t batch = std::min(blocks.size(), kMagazineCapacity / 2);
+    for (size_t i = 1; i < batch; ++i) {
+      mag.push_back(blocks.pop_back_val());
+    }
+    return blocks.pop_back_val();
+  }
+
+  void push(size_t size_class, void* ptr) {
+    auto& mag = classes[size_class];
+    mag.push_back(ptr);
+    if (mag.size() < kMagazineCapacity) {
+      return;
+    }
+    // Spill half to the local depot; evict instead if the cache is full.
+    const size_t spill = kMagazineCapacity / 2;
+    const size_t spill_bytes = spill * size_class_bytes(size_class);
+    if (cached_bytes_.load(std::memory_order_relaxed) + spill_bytes >
+        max_cached_bytes()) {
+      for (size_t i = 0; i < spill; ++i) {
+        void* victim = mag.pop_back_val();
+        cached_bytes_.fetch_sub(
+            size_class_bytes(size_class), std::memory_order_relaxed);
+        evict(victim, size_class_bytes(size_class));
+      }
+      return;
+    }
+    auto& depot = depots().local();
+    std::lock_guard<std::mutex> guard(depot.mutex);
+    for (size_t i = 0; i < spill; ++i) {
+      depot.blocks[size_class].push_back(mag.pop_back_val());
+    }
+  }
+};
+
+ThreadMagazines& thread_magazines() {
+  static thread_local ThreadMagazines magazines;
+  return magazines;
+}
+
+void empty_cache() {
+  // Thread magazines are private and can't be drained from here; they hold
+  // at most kMagazineCapacity blocks per class per thread and spill on the
+  // next free anyway.
+  auto& all = depots();
+  for (auto& depot : all.per_node) {
+    std::lock_guard<std::mutex> guard(depot.mutex);
+    for (size_t size_class = 0; size_class < kNumSizeClasses; ++size_class) {
+      for (void* ptr : depot.blocks[size_class]) {
+        cached_bytes_.fetch_sub(
+            size_class_bytes(size_class), std::memory_order_relaxed);
+        evict(ptr, size_class_bytes(size_class));
+      }
+      depot.blocks[size_class].clear();
+    }
+  }
+}
+
+void* caching_alloc(size_t nbytes) {
+  allocations_.fetch_add(1, std::memory_order_relaxed);
+  if (nbytes > size_class_bytes(kNumSizeClasses - 1)) {
+    // Too large to cache: headered pass-through to alloc_cpu.
+    return write_header(c10::alloc_cpu(nbytes + kHeaderBytes), nbytes);
+  }
+  const size_t size_class = size_class_of(nbytes);
+  const size_t rounded = size_class_bytes(size_class);
+  if (void* cached = thread_magazines().pop(size_class)) {
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    cached_bytes_.fetch_sub(rounded, std::memory_order_relaxed);
+    return cached;
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  void* base;
+  try {
+    base = c10::alloc_cpu(rounded + kHeaderBytes);
+  } catch (c10::Error&) {
+    // Give the cached blocks back to the OS and retry before reporting OOM.
+    empty_cache();
+    base = c10::alloc_cpu(rounded + kHeaderBytes);
+  }
+  return write_header(base, rounded);
+}
+
+void caching_free(void* ptr) {
+  const size_t rounded = rounded_size_of(ptr);
+  if (rounded > size_class_bytes(kNumSizeClasses - 1)) {
+    os_free(ptr);
+    return;
+  }
+  if (cached_bytes_.load(std::memory_order_relaxed) + rounded >
+      max_cached_bytes()) {
+    evict(ptr, rounded);
+    return;
+  }
+  cached_bytes_.fetch_add(rounded, std::memory_order_relaxed);
+  thread_magazines().push(size_class_of(rounded), ptr);
+}
+
+struct CachingCPUAllocator final : at::Allocator {
+  at::DataPtr allocate(size_t nbytes) const override {
+    if (nbytes == 0) {
+      return {nullptr, nullptr, &ReportAndDelete, at::Device(DeviceType::CPU)};
+    }
+    void* data = nullptr;
+    try {
+      data = caching_alloc(nbytes);
+    } catch (c10::Error& e) {
+      profiledCPUMemoryReporter().OutOfMemory(nbytes);
+      throw e;
+    }
+    profiledCPUMemoryReporter().New(data, nbytes);
+    return {data, data, &ReportAndDelete, at::Device(DeviceType::CPU)};
+  }
+
+  static void ReportAndDelete(void* ptr) {
+    if (!ptr) {
+      return;
+    }
+    profiledCPUMemoryReporter().Delete(ptr);
+    caching_free(ptr);
+  }
+
+  at::DeleterFnPtr raw_deleter() const override {
+    return &ReportAndDelete;
+  }
+};
+
+CachingCPUAllocator g_caching_cpu_allocator;
+
+C10_UNUSED const bool env_install_registered = [] {
+  auto env = c10::utils::check_env("TORCH_CPU_CACHING_ALLOCATOR");
+  if (env.has_value() && env.value()) {
+    EnableCachingCPUAllocator();
+  }
+  return true;
+}();
+
+} // namespace
+
+at::Allocator* GetCachingCPUAllocator() {
+  return &g_caching_cpu_allocator;
+}
+
+void EnableCachingCPUAllocator(uint8_t priority) {
+  SetCPUAllocator(&g_caching_cpu_allocator, priority);
+}
+
+CachingCPUAllocatorStats GetCachingCPUAllocatorStats() {
+  CachingCPUAllocatorStats stats;
+  stats.allocations = allocations_.load(std::memory_order_relaxed);
+  stats.hits = hits_.load(std::memory_order_relaxed);
+  stats.cached_bytes = cached_bytes_.load(std::memory_order_relaxed);
+  stats.evicted_bytes = evicted_bytes_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void EmptyCachingCPUAllocatorCache() {
+  empty_cache();
+}
+
+} // namespace c10
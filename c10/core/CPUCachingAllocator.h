@@ -0,0 +1,48 @@
+#pragma once
+
+#include <c10/core/Allocator.h>
+#include <c10/macros/Macros.h>
+
+#include <cstdint>
+
+namespace c10 {
+
+// A caching CPU allocator for server workloads, the counterpart to the
+// mobile free-list allocator in c10/mobile/CPUCachingAllocator.h.
+//
+// Freed blocks are kept in power-of-two size classes instead of being
+// returned to the system allocator, so tensor churn across many threads does
+// not serialize on glibc malloc's arenas. Each thread fronts the cache with a
+// small per-size-class magazine, making the steady-state allocate/free cycle
+// lock-free; magazine overflow and refill go through depots partitioned by
+// the thread's current NUMA node, which keeps recycled blocks on the node
+// alloc_cpu originally placed them on. The total number of cached bytes is
+// bounded (TORCH_CPU_CACHING_ALLOCATOR_MAX_BYTES, default 1GB); blocks that
+// would exceed the bound, and blocks too large to be worth caching, go
+// straight back to the OS. If an allocation fails, the cache is flushed and
+// the allocation retried before the failure propagates.
+//
+// The allocator is opt-in: set TORCH_CPU_CACHING_ALLOCATOR=1 to install it as
+// the process-wide CPU allocator at startup, or call
+// EnableCachingCPUAllocator() (which goes through the usual SetCPUAllocator
+// priority mechanism). Tensors allocated before the switch are freed by their
+// own deleter, so enabling it mid-process is safe.
+
+struct C10_API CachingCPUAllocatorStats {
+  // allocate() calls, and how many of them were served from the cache.
+  uint64_t allocations = 0;
+  uint64_t hits = 0;
+  // Bytes currently sitting in magazines/depots awaiting reuse.
+  uint64_t cached_bytes = 0;
+  // Bytes returned to the OS because of the cache-size bound.
+  uint64_t evicted_bytes = 0;
+};
+
+C10_API at::Allocator* GetCachingCPUAllocator();
+C10_API void EnableCachingCPUAllocator(uint8_t priority = 1);
+C10_API CachingCPUAllocatorStats GetCachingCPUAllocatorStats();
+// Returns every cached block to the OS, e.g. ahead of a large one-off
+// allocation or when handing memory back to a co-tenant process.
+C10_API void EmptyCachingCPUAllocatorCache();
+
+} // namespace c10
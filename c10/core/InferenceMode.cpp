@@ -1,4 +1,7 @@
 #include <c10/core/InferenceMode.h>
+#include <c10/util/Exception.h>
+#include <cstdlib>
+#include <cstring>
 #include <stdexcept>
 
 namespace c10 {
@@ -10,4 +13,31 @@ namespace c10 {
 bool InferenceMode::is_enabled() {
   return AutogradState::get_tls_state().get_inference_mode();
 }
+
+bool no_autograd_tier_enabled() {
+  static const bool enabled = []() {
+    const char* env = std::getenv("TORCH_NO_AUTOGRAD");
+    return env != nullptr && std::strcmp(env, "1") == 0;
+  }();
+  return enabled;
+}
+
+void no_autograd_tier_init_tls() {
+  // Same TLS shape as the InferenceMode constructor produces.
+  // See Note [Expected TLS state in InferenceMode]
+  const auto prev_keyset = c10::impl::tls_local_dispatch_key_set();
+  c10::impl::PODLocalDispatchKeySet cur_keyset;
+  cur_keyset.set_included(
+      prev_keyset.included_.remove(DispatchKey::ADInplaceOrView));
+  cur_keyset.set_excluded(prev_keyset.excluded_ | autograd_dispatch_keyset);
+  c10::impl::_force_tls_local_dispatch_key_set(cur_keyset);
+
+  // The per-thread assertion that the dispatch key computation can never
+  // select an autograd or view-tracking kernel on this thread.
+  // See Note [No-autograd tier]
+  const auto keyset = c10::impl::tls_local_dispatch_key_set();
+  TORCH_INTERNAL_ASSERT(
+      keyset.excluded_.isSupersetOf(autograd_dispatch_keyset) &&
+      !keyset.included_.has(DispatchKey::ADInplaceOrView));
+}
 } // namespace c10
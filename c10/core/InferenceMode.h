@@ -82,4 +82,28 @@ struct TORCH_API InferenceMode {
   AutogradState prev_mode;
   c10::impl::LocalDispatchKeySet prev_keyset;
 };
+
+// Note [No-autograd tier]
+// ~~~~~~~~~~~~~~~~~~~~~~~
+// Even inside c10::InferenceMode, processes that never differentiate still
+// pay for autograd plumbing on threads that run work outside an
+// InferenceMode guard: tensors created there allocate a VersionCounter and
+// carry autograd dispatch keys, and inplace/view ops hop through the
+// ADInplaceOrView kernels. With TORCH_NO_AUTOGRAD=1 every thread *starts*
+// in the InferenceMode TLS state described in
+// Note [Expected TLS state in InferenceMode]: the autograd keys are in the
+// thread's excluded set, ADInplaceOrView is not in its included set, and
+// AutogradState defaults to inference mode. The dispatch key computation
+// therefore provably never selects an autograd or view-tracking kernel,
+// which is asserted once per thread when its TLS is initialized rather
+// than checked per op, and TensorImpl construction takes the existing
+// inference paths (no version counter, no autograd keys) with no new
+// branches. The tier only changes the default TLS: entering an
+// InferenceMode(false) guard or set_tls_state still behaves as usual.
+TORCH_API bool no_autograd_tier_enabled();
+
+// Puts the calling thread's dispatch TLS into the InferenceMode shape and
+// asserts the tier invariant. Called once per thread, from the
+// AutogradState TLS initializer. See Note [No-autograd tier]
+TORCH_API void no_autograd_tier_init_tls();
 } // namespace c10
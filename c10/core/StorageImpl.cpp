@@ -1 +1,14 @@
 #include <c10/core/StorageImpl.h>
+#include <c10/core/impl/Freelist.h>
+
+namespace c10 {
+
+void* StorageImpl::operator new(std::size_t size) {
+  return impl::SizedFreelist<sizeof(StorageImpl)>::allocate(size);
+}
+
+void StorageImpl::operator delete(void* ptr, std::size_t size) {
+  impl::SizedFreelist<sizeof(StorageImpl)>::deallocate(ptr, size);
+}
+
+} // namespace c10
@@ -67,6 +67,12 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
             allocator,
             resizable) {}
 
+  // See [Note: TensorImpl/StorageImpl freelist].  Exact-size allocations are
+  // recycled through a per-thread freelist when C10_IMPL_FREELIST=1;
+  // subclasses fall through to the global operator new.
+  static void* operator new(std::size_t size);
+  static void operator delete(void* ptr, std::size_t size);
+
   StorageImpl& operator=(StorageImpl&& other) = default;
   StorageImpl& operator=(const StorageImpl&) = delete;
   StorageImpl() = delete;
@@ -4,6 +4,7 @@
 #include <c10/core/InferenceMode.h>
 #include <c10/core/SymIntArrayRef.h>
 #include <c10/core/WrapDimMinimal.h>
+#include <c10/core/impl/Freelist.h>
 #include <c10/core/impl/LocalDispatchKeySet.h>
 #include <c10/core/impl/PyInterpreter.h>
 #include <c10/core/impl/TorchDispatchModeTLS.h>
@@ -76,6 +77,14 @@ TensorImpl::~TensorImpl() {
   destroy_pyobj_if_needed();
 }
 
+void* TensorImpl::operator new(std::size_t size) {
+  return impl::SizedFreelist<sizeof(TensorImpl)>::allocate(size);
+}
+
+void TensorImpl::operator delete(void* ptr, std::size_t size) {
+  impl::SizedFreelist<sizeof(TensorImpl)>::deallocate(ptr, size);
+}
+
 TensorImpl::TensorImpl(
     Storage&& storage,
     DispatchKeySet key_set,
@@ -609,6 +609,12 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
    */
   void release_resources() override;
 
+  // See [Note: TensorImpl/StorageImpl freelist].  Exact-size allocations are
+  // recycled through a per-thread freelist when C10_IMPL_FREELIST=1;
+  // subclasses fall through to the global operator new.
+  static void* operator new(std::size_t size);
+  static void operator delete(void* ptr, std::size_t size);
+
  private:
   void destroy_pyobj_if_needed();
 
@@ -2424,6 +2430,44 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
     return is_non_overlapping_and_dense_default();
   }
 
+  // Bits returned by memory_format_bits(), mirroring the cached contiguity
+  // flags refreshed by refresh_contiguous().
+  static constexpr uint8_t CONTIGUOUS_BIT = 1 << 0;
+  static constexpr uint8_t CHANNELS_LAST_STRIDES_BIT = 1 << 1;
+  static constexpr uint8_t CHANNELS_LAST_CONTIGUOUS_BIT = 1 << 2;
+  static constexpr uint8_t CHANNELS_LAST_3D_STRIDES_BIT = 1 << 3;
+  static constexpr uint8_t CHANNELS_LAST_3D_CONTIGUOUS_BIT = 1 << 4;
+  static constexpr uint8_t NON_OVERLAPPING_AND_DENSE_BIT = 1 << 5;
+
+  // Consolidated view of the cached contiguity/memory-format flags, composed
+  // branch-free from the bitfield.  Kernels that repeatedly query format for
+  // many small tensors (e.g. channels-last CNN inner loops calling
+  // suggest_memory_format per tensor) can fetch this once and test several
+  // properties with plain masks.  Tensors with a custom sizes/strides policy
+  // (subclasses, nested tensors) fall back to the virtual accessors.
+  uint8_t memory_format_bits() const {
+    if (C10_UNLIKELY(matches_policy(SizesStridesPolicy::CustomStrides))) {
+      return static_cast<uint8_t>(
+          (static_cast<uint8_t>(is_contiguous()) << 0) |
+          (static_cast<uint8_t>(is_strides_like_custom(
+               at::MemoryFormat::ChannelsLast)) << 1) |
+          (static_cast<uint8_t>(is_contiguous_custom(
+               at::MemoryFormat::ChannelsLast)) << 2) |
+          (static_cast<uint8_t>(is_strides_like_custom(
+               at::MemoryFormat::ChannelsLast3d)) << 3) |
+          (static_cast<uint8_t>(is_contiguous_custom(
+               at::MemoryFormat::ChannelsLast3d)) << 4) |
+          (static_cast<uint8_t>(is_non_overlapping_and_dense_custom()) << 5));
+    }
+    return static_cast<uint8_t>(
+        (static_cast<uint8_t>(is_contiguous_) << 0) |
+        (static_cast<uint8_t>(is_channels_last_) << 1) |
+        (static_cast<uint8_t>(is_channels_last_contiguous_) << 2) |
+        (static_cast<uint8_t>(is_channels_last_3d_) << 3) |
+        (static_cast<uint8_t>(is_channels_last_3d_contiguous_) << 4) |
+        (static_cast<uint8_t>(is_non_overlapping_and_dense_) << 5));
+  }
+
   bool has_symbolic_sizes_strides() const {
     return has_symbolic_sizes_strides_;
   }
@@ -3205,7 +3249,14 @@ class C10_TensorImpl_Size_Check_Dummy_Class : private TensorImpl {
 #if UINTPTR_MAX == 0xFFFFFFFF
   // This is a 32-bit system
   static constexpr bool check_sizes() {
-    constexpr size_t tsize = 20 * sizeof(int64_t);
+    // The expected sizes below assume the default inline rank of 5 in
+    // SizesAndStrides; a build-time override grows sizes_and_strides_ (and
+    // therefore TensorImpl) by two eightbytes per extra dimension.
+    constexpr size_t extra_dims =
+        C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE > 5
+        ? C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE - 5
+        : 0;
+    constexpr size_t tsize = (20 + 2 * extra_dims) * sizeof(int64_t);
 
     // clang-format off
     are_equal<sizeof(storage_),            4,  FieldNameEnum::storage_>();
@@ -3214,7 +3265,7 @@ class C10_TensorImpl_Size_Check_Dummy_Class : private TensorImpl {
     are_equal<sizeof(version_counter_),    4,  FieldNameEnum::version_counter_>();
     are_equal<sizeof(pyobj_interpreter_),  4,  FieldNameEnum::pyobj_interpreter_>();
     are_equal<sizeof(pyobj_),              4,  FieldNameEnum::pyobj_>();
-    is_le<sizeof(sizes_and_strides_),     88, FieldNameEnum::sizes_and_strides_>();
+    is_le<sizeof(sizes_and_strides_), 88 + 16 * extra_dims, FieldNameEnum::sizes_and_strides_>();
     are_equal<sizeof(storage_offset_),     8,  FieldNameEnum::storage_offset_>();
     are_equal<sizeof(numel_),              8,  FieldNameEnum::numel_>();
     are_equal<sizeof(data_type_),          2,  FieldNameEnum::data_type_>();
@@ -3228,7 +3279,13 @@ class C10_TensorImpl_Size_Check_Dummy_Class : private TensorImpl {
 #else
   // This is a 64-bit system
   static constexpr bool check_sizes() {
-    constexpr size_t tsize = 26 * sizeof(int64_t);
+    // See the 32-bit branch: expected sizes assume the default inline rank
+    // of 5 in SizesAndStrides.
+    constexpr size_t extra_dims =
+        C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE > 5
+        ? C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE - 5
+        : 0;
+    constexpr size_t tsize = (26 + 2 * extra_dims) * sizeof(int64_t);
 
     // clang-format off
     are_equal<sizeof(storage_),            8,  FieldNameEnum::storage_>();
@@ -3240,7 +3297,7 @@ class C10_TensorImpl_Size_Check_Dummy_Class : private TensorImpl {
     are_equal<sizeof(version_counter_),    8,  FieldNameEnum::version_counter_>();
     are_equal<sizeof(pyobj_interpreter_),  8,  FieldNameEnum::pyobj_interpreter_>();
     are_equal<sizeof(pyobj_),              8,  FieldNameEnum::pyobj_>();
-    are_equal<sizeof(sizes_and_strides_), 88,  FieldNameEnum::sizes_and_strides_>();
+    are_equal<sizeof(sizes_and_strides_), 88 + 16 * extra_dims, FieldNameEnum::sizes_and_strides_>();
     are_equal<sizeof(storage_offset_),     8,  FieldNameEnum::storage_offset_>();
     are_equal<sizeof(numel_),              8,  FieldNameEnum::numel_>();
     are_equal<sizeof(data_type_),          2,  FieldNameEnum::data_type_>();
@@ -14,4 +14,12 @@ constexpr size_t gAlignment = 16;
 constexpr size_t gAlignment = 64;
 #endif
 
+// Fallback CPU page size, used by the transparent-huge-page allocation path
+// in alloc_cpu when sysconf is unavailable.
+constexpr size_t gPagesize = 4096;
+// The default transparent-huge-page size on Linux is 2MB; only request THP
+// backing for buffers at least that large so partially-used huge pages don't
+// bloat small allocations.
+constexpr size_t gAlloc_threshold_thp = static_cast<size_t>(2) * 1024 * 1024;
+
 } // namespace c10
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <c10/util/env.h>
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace c10 {
+namespace impl {
+
+// [Note: TensorImpl/StorageImpl freelist]
+// Materializing a tensor costs two metadata heap allocations (one TensorImpl,
+// one StorageImpl) on top of the data allocation.  Workloads with heavy
+// intermediate-tensor churn spend a measurable fraction of their time in
+// malloc for these fixed-size blocks.  When C10_IMPL_FREELIST=1, the
+// class-level operator new/delete of TensorImpl and StorageImpl recycle
+// exact-size blocks through a small per-thread freelist instead of going to
+// the allocator.
+//
+// Only allocations whose size matches the base class exactly are recycled;
+// subclasses (sparse impls, backend-specific impls) fall through to the
+// global operator new.  Freelist entries are ordinary blocks obtained from
+// ::operator new, so cross-thread deallocation is safe: a block released on
+// a different thread simply lands in that thread's freelist (or goes back to
+// the allocator when the freelist is full).
+inline bool freelist_enabled() {
+  static bool enabled = utils::check_env("C10_IMPL_FREELIST") == true;
+  return enabled;
+}
+
+template <std::size_t kBlockSize>
+class SizedFreelist final {
+ public:
+  static void* allocate(std::size_t size) {
+    if (size == kBlockSize && freelist_enabled()) {
+      auto& blocks = freelist().blocks;
+      if (!blocks.empty()) {
+        void* ptr = blocks.back();
+        blocks.pop_back();
+        return ptr;
+      }
+    }
+    return ::operator new(size);
+  }
+
+  static void deallocate(void* ptr, std::size_t size) {
+    if (size == kBlockSize && freelist_enabled()) {
+      auto& blocks = freelist().blocks;
+      if (blocks.size() < kMaxBlocks) {
+        blocks.push_back(ptr);
+        return;
+      }
+    }
+    ::operator delete(ptr);
+  }
+
+ private:
+  static constexpr std::size_t kMaxBlocks = 256;
+
+  struct Cache {
+    std::vector<void*> blocks;
+    ~Cache() {
+      for (void* ptr : blocks) {
+        ::operator delete(ptr);
+      }
+    }
+  };
+
+  static Cache& freelist() {
+    static thread_local Cache cache;
+    return cache;
+  }
+};
+
+} // namespace impl
+} // namespace c10
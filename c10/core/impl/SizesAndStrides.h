@@ -7,7 +7,16 @@
 #include <c10/util/ArrayRef.h>
 #include <c10/util/SmallVector.h>
 
+// Number of dimensions whose sizes and strides are stored inline in
+// TensorImpl; higher-rank tensors keep their metadata out of line and pay a
+// heap allocation on every reshape/restride.  The default of 5 covers the
+// overwhelming majority of models, but workloads dominated by 6-D/7-D
+// tensors (video models, attention patterns built with unfold) can raise it
+// at build time, e.g. -DC10_SIZES_AND_STRIDES_MAX_INLINE_SIZE=8, trading
+// sizeof(TensorImpl) for allocation-free metadata updates at higher ranks.
+#ifndef C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE
 #define C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE 5
+#endif
 
 namespace c10 {
 namespace impl {
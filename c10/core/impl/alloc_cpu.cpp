@@ -3,9 +3,17 @@
 #include <c10/core/alignment.h>
 #include <c10/util/Flags.h>
 #include <c10/util/Logging.h>
+#include <c10/util/env.h>
 #include <c10/util/irange.h>
 #include <c10/util/numa.h>
 
+#include <atomic>
+
+#if defined(__linux__) && !defined(__ANDROID__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 // TODO: rename flags to C10
 C10_DEFINE_bool(
     caffe2_cpu_allocator_do_zero_fill,
@@ -41,6 +49,37 @@ void memset_junk(void* data, size_t num) {
   }
 }
 
+std::atomic<uint64_t> allocated_bytes_{0};
+std::atomic<uint64_t> hugepage_bytes_{0};
+std::atomic<uint64_t> hugepage_allocations_{0};
+std::atomic<uint64_t> madvise_failures_{0};
+
+#if defined(__linux__) && !defined(__ANDROID__)
+bool is_thp_alloc_enabled() {
+  static bool value = [] {
+    auto env = c10::utils::check_env("THP_MEM_ALLOC_ENABLE");
+    return env.has_value() ? env.value() : false;
+  }();
+  return value;
+}
+
+bool is_thp_alloc(size_t nbytes) {
+  // Enable huge-page backing only for large buffers: the kernel rounds the
+  // advised region up to whole 2MB pages, so small allocations would bloat.
+  return is_thp_alloc_enabled() && (nbytes >= gAlloc_threshold_thp);
+}
+
+size_t compute_alignment(size_t nbytes) {
+  static const size_t pagesize = [] {
+    const auto ret = sysconf(_SC_PAGESIZE);
+    return ret > 0 ? static_cast<size_t>(ret) : gPagesize;
+  }();
+  // MADV_HUGEPAGE requires a page-aligned region; for everything else the
+  // usual SIMD alignment suffices.
+  return is_thp_alloc(nbytes) ? pagesize : gAlignment;
+}
+#endif
+
 } // namespace
 
 void* alloc_cpu(size_t nbytes) {
@@ -70,8 +109,12 @@ void* alloc_cpu(size_t nbytes) {
       "DefaultCPUAllocator: not enough memory: you tried to allocate ",
       nbytes,
       " bytes.");
+#else
+#if defined(__linux__)
+  int err = posix_memalign(&data, compute_alignment(nbytes), nbytes);
 #else
   int err = posix_memalign(&data, gAlignment, nbytes);
+#endif
   CAFFE_ENFORCE(
       err == 0,
       "DefaultCPUAllocator: can't allocate memory: you tried to allocate ",
@@ -81,7 +124,23 @@ void* alloc_cpu(size_t nbytes) {
       " (",
       strerror(err),
       ")");
+#if defined(__linux__)
+  if (is_thp_alloc(nbytes)) {
+    // Ask the kernel to back this region with transparent huge pages. This
+    // is advisory: it can fail (e.g. THP disabled system-wide via
+    // transparent_hugepage/enabled=never), in which case the allocation is
+    // still usable, just 4KB-paged.
+    const int ret = madvise(data, nbytes, MADV_HUGEPAGE);
+    if (ret != 0) {
+      madvise_failures_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      hugepage_bytes_.fetch_add(nbytes, std::memory_order_relaxed);
+      hugepage_allocations_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+#endif
 #endif
+  allocated_bytes_.fetch_add(nbytes, std::memory_order_relaxed);
 
   // move data to a thread's NUMA node
   NUMAMove(data, nbytes, GetCurrentNUMANode());
@@ -98,6 +157,16 @@ void* alloc_cpu(size_t nbytes) {
   return data;
 }
 
+CPUHugePagesStats cpu_huge_pages_stats() {
+  CPUHugePagesStats stats;
+  stats.allocated_bytes = allocated_bytes_.load(std::memory_order_relaxed);
+  stats.hugepage_bytes = hugepage_bytes_.load(std::memory_order_relaxed);
+  stats.hugepage_allocations =
+      hugepage_allocations_.load(std::memory_order_relaxed);
+  stats.madvise_failures = madvise_failures_.load(std::memory_order_relaxed);
+  return stats;
+}
+
 void free_cpu(void* data) {
 #ifdef _MSC_VER
   _aligned_free(data);
@@ -4,9 +4,25 @@
 
 #include <cstddef>
 
+#include <cstdint>
+
 namespace c10 {
 
 C10_API void* alloc_cpu(size_t nbytes);
 C10_API void free_cpu(void* data);
 
+// Running totals for the transparent-huge-page allocation path in alloc_cpu
+// (Linux only; enabled with THP_MEM_ALLOC_ENABLE=1). hugepage_bytes over
+// allocated_bytes gives the fraction of CPU allocations eligible for huge
+// pages; madvise_failures counts allocations where the MADV_HUGEPAGE advise
+// was rejected by the kernel (e.g. THP disabled system-wide).
+struct C10_API CPUHugePagesStats {
+  uint64_t allocated_bytes = 0;
+  uint64_t hugepage_bytes = 0;
+  uint64_t hugepage_allocations = 0;
+  uint64_t madvise_failures = 0;
+};
+
+C10_API CPUHugePagesStats cpu_huge_pages_stats();
+
 } // namespace c10
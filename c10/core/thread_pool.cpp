@@ -1,5 +1,10 @@
 #include <c10/core/thread_pool.h>
 
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 namespace c10 {
 
 ThreadPool::ThreadPool(
@@ -56,7 +61,7 @@ bool ThreadPool::inThreadPool() const {
   return false;
 }
 
-void ThreadPool::run(std::function<void()> func) {
+void ThreadPool::run(c10::SmallFunction<void()> func) {
   if (threads_.size() == 0) {
     throw std::runtime_error("No threads to run a task");
   }
@@ -69,6 +74,81 @@ void ThreadPool::run(std::function<void()> func) {
   condition_.notify_one();
 }
 
+bool ThreadPool::setThreadAffinity(const std::vector<size_t>& core_ids) {
+#ifdef __linux__
+  if (core_ids.empty()) {
+    return false;
+  }
+  for (std::size_t i = 0; i < threads_.size(); ++i) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(core_ids[i % core_ids.size()], &cpu_set);
+    const auto rc = pthread_setaffinity_np(
+        threads_[i].native_handle(), sizeof(cpu_set_t), &cpu_set);
+    if (rc != 0) {
+      LOG(WARNING) << "Failed to set affinity of thread pool worker " << i
+                   << " to core " << core_ids[i % core_ids.size()]
+                   << ": error " << rc;
+      return false;
+    }
+  }
+  return true;
+#else
+  (void)core_ids;
+  return false;
+#endif
+}
+
+size_t ThreadPool::queueSize() const {
+  std::unique_lock<std::mutex> lock(mutex_);
+  return tasks_.size();
+}
+
+bool ThreadPool::tryRunTaskInline() {
+  c10::optional<task_element_t> task;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (tasks_.empty()) {
+      return false;
+    }
+    task.emplace(std::move(tasks_.front()));
+    tasks_.pop();
+  }
+
+  try {
+    if (task->run_with_id) {
+      // Pass an id outside the worker range so tasks that key on it do not
+      // collide with a pool thread.
+      task->with_id(total_);
+    } else {
+      task->no_id();
+    }
+  } catch (const std::exception& e) {
+    LOG(ERROR) << "Exception in thread pool task: " << e.what();
+  } catch (...) {
+    LOG(ERROR) << "Exception in thread pool task: unknown";
+  }
+
+  // Destruct the task before taking the lock; user-provided functions can
+  // run arbitrary code on destruction, including reentrant calls into the
+  // pool.
+  task.reset();
+
+  tasks_completed_.fetch_add(1, std::memory_order_relaxed);
+
+  {
+    // The inline run may have drained the last queued task while every
+    // worker was idle; update the completion state that main_loop would
+    // otherwise maintain so waitWorkComplete() cannot hang.
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (tasks_.empty() && available_ == total_) {
+      complete_ = true;
+      completed_.notify_one();
+    }
+  }
+  return true;
+}
+
 void ThreadPool::waitWorkComplete() {
   std::unique_lock<std::mutex> lock(mutex_);
   while (!complete_) {
@@ -116,12 +196,14 @@ void ThreadPool::main_loop(std::size_t index) {
       }
 
       // Destruct tasks before taking the lock.  As tasks
-      // are user provided std::function, they can run
+      // are user provided callables, they can run
       // arbitrary code during destruction, including code
       // that can reentrantly call into ThreadPool (which would
       // cause a deadlock if we were holding the lock).
     }
 
+    tasks_completed_.fetch_add(1, std::memory_order_relaxed);
+
     // Update status of empty, maybe
     // Need to recover the lock first
     lock.lock();
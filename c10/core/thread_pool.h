@@ -1,13 +1,17 @@
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <mutex>
 #include <queue>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include <c10/util/Optional.h>
+#include <c10/util/SmallFunction.h>
 #include <c10/util/intrusive_ptr.h>
 #include <c10/util/numa.h>
 #include <c10/util/thread_name.h>
@@ -22,7 +26,10 @@ namespace c10 {
 // TODO: move this to C10 and make it C10_API
 class C10_API TaskThreadPoolBase {
  public:
-  virtual void run(std::function<void()> func) = 0;
+  // Tasks are c10::SmallFunction so that typical closures are stored in the
+  // queue without a heap allocation; lambdas and std::functions convert
+  // implicitly at every call site.
+  virtual void run(c10::SmallFunction<void()> func) = 0;
 
   virtual size_t size() const = 0;
 
@@ -51,12 +58,12 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
  protected:
   struct task_element_t {
     bool run_with_id;
-    const std::function<void()> no_id;
-    const std::function<void(std::size_t)> with_id;
+    c10::SmallFunction<void()> no_id;
+    c10::SmallFunction<void(std::size_t)> with_id;
 
-    explicit task_element_t(std::function<void()> f)
+    explicit task_element_t(c10::SmallFunction<void()> f)
         : run_with_id(false), no_id(std::move(f)), with_id(nullptr) {}
-    explicit task_element_t(std::function<void(std::size_t)> f)
+    explicit task_element_t(c10::SmallFunction<void(std::size_t)> f)
         : run_with_id(true), no_id(nullptr), with_id(std::move(f)) {}
   };
 
@@ -70,6 +77,7 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
   std::size_t available_;
   std::size_t total_;
   int numa_node_id_;
+  std::atomic<uint64_t> tasks_completed_{0};
 
  public:
   ThreadPool() = delete;
@@ -87,7 +95,7 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
 
   bool inThreadPool() const override;
 
-  void run(std::function<void()> func) override;
+  void run(c10::SmallFunction<void()> func) override;
 
   template <typename Task>
   void runTaskWithID(Task task) {
@@ -95,7 +103,7 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
 
     // Set task and signal condition variable so that a worker thread will
     // wake up and use the task.
-    tasks_.emplace(static_cast<std::function<void(std::size_t)>>(task));
+    tasks_.emplace(c10::SmallFunction<void(std::size_t)>(std::move(task)));
     complete_ = false;
     condition_.notify_one();
   }
@@ -103,6 +111,25 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
   /// @brief Wait for queue to be empty
   void waitWorkComplete();
 
+  /// Pins each worker thread to a core from `core_ids`, assigned round-robin
+  /// when there are more workers than cores. Returns true on success; false
+  /// when `core_ids` is empty or the platform does not support thread
+  /// affinity.
+  bool setThreadAffinity(const std::vector<size_t>& core_ids);
+
+  /// The number of tasks this pool has finished running since construction.
+  uint64_t numTasksCompleted() const {
+    return tasks_completed_.load(std::memory_order_relaxed);
+  }
+
+  /// The number of tasks currently waiting for a worker.
+  size_t queueSize() const;
+
+  /// Runs one pending task on the calling thread, if any is queued. Returns
+  /// true if a task was run. This lets a thread that is blocked on work
+  /// submitted to the pool help drain the queue instead of sleeping.
+  bool tryRunTaskInline();
+
  private:
   // @brief Entry point for pool threads.
   void main_loop(std::size_t index);
@@ -4,15 +4,21 @@
 #include <c10/cuda/CUDAException.h>
 #include <c10/cuda/CUDAFunctions.h>
 #include <c10/cuda/CUDAGuard.h>
+#include <c10/util/Optional.h>
 #include <c10/util/UniqueVoidPtr.h>
 #include <c10/util/flat_hash_map.h>
 #include <c10/util/irange.h>
 #include <c10/util/llvmMathExtras.h>
 
+#if !defined(USE_ROCM) && defined(PYTORCH_C10_DRIVER_API_SUPPORTED)
+#include <c10/cuda/driver_api.h>
+#endif
+
 #include <cuda_runtime_api.h>
 #include <algorithm>
 #include <bitset>
 #include <deque>
+#include <functional>
 #include <iterator>
 #include <map>
 #include <memory>
@@ -159,6 +165,7 @@ void update_stat_array(
 
 struct Block;
 struct PrivatePool;
+struct ExpandableSegment;
 typedef bool (*Comparison)(const Block*, const Block*);
 
 struct BlockPool {
@@ -166,8 +173,15 @@ struct BlockPool {
       Comparison comparator,
       bool small,
       PrivatePool* private_pool = nullptr)
-      : blocks(comparator), is_small(small), owner_PrivatePool(private_pool) {}
+      : blocks(comparator),
+        unmapped(comparator),
+        is_small(small),
+        owner_PrivatePool(private_pool) {}
   std::set<Block*, Comparison> blocks;
+  // address ranges reserved but not backed by physical memory yet; only
+  // populated when expandable_segments is enabled. See Note [Expandable
+  // segments].
+  std::set<Block*, Comparison> unmapped;
   const bool is_small;
   PrivatePool* owner_PrivatePool;
 };
@@ -193,6 +207,14 @@ struct Block {
                 // garbage collection
   std::unique_ptr<HistoryChain> history;
   HistoryChain* history_last;
+  ExpandableSegment* expandable_segment_{nullptr}; // owning segment, if this
+                                                   // block's memory came from
+                                                   // an expandable segment
+  bool mapped{true}; // is the virtual address range this Block references
+                     // backed by physical pages. Always true when
+                     // expandable_segment_ is null. When false
+                     // This Block will be aligned to the segment size
+                     // of its expandable_segment_.
 
   Block(
       int device,
@@ -229,8 +251,242 @@ struct Block {
   bool is_split() const {
     return (prev != nullptr) || (next != nullptr);
   }
+  // inserts this block between before and after in its segment's doubly
+  // linked list of blocks
+  void splice(Block* before, Block* after) {
+    if (before) {
+      TORCH_INTERNAL_ASSERT(before->next == after);
+      before->next = this;
+    }
+    prev = before;
+    if (after) {
+      TORCH_INTERNAL_ASSERT(after->prev == before);
+      after->prev = this;
+    }
+    next = after;
+  }
+};
+
+/*
+Note [Expandable segments]
+~~~~~~~~~~~~~~~~~~~~~~~~~~
+When expandable_segments is requested via PYTORCH_CUDA_ALLOC_CONF, instead of
+asking cudaMalloc for a fixed-size segment every time the cache misses, the
+allocator creates one segment per (pool, stream) that can grow in place. It
+reserves a large range of virtual addresses up front (cuMemAddressReserve,
+which consumes no memory) and maps physical pages into that range on demand
+(cuMemCreate + cuMemMap), one segment_size_-granularity page at a time.
+
+Why: with ordinary segments, a workload whose tensor sizes vary from
+iteration to iteration (e.g. changing batch or sequence lengths) slowly
+shreds memory into segments whose leftover tails are each too small to serve
+the next request, and a cudaMalloc'd segment can never be extended -- the
+next allocation after it owns the following addresses. The allocator then
+OOMs with plenty of total memory free. A segment that grows in place turns
+those leftover tails into one tail that keeps extending, so the steady-state
+memory use approaches the high-water mark of live bytes rather than the sum
+of per-size high-water marks.
+
+Bookkeeping stays in the existing Block machinery: the unmapped remainder of
+a segment is represented as a Block with mapped == false living in
+BlockPool::unmapped. Mapping a prefix of such a block splits it and moves
+the now-backed prefix into BlockPool::blocks, where the ordinary split/merge
+code takes over (try_merge_blocks refuses to merge across a mapped/unmapped
+boundary). empty_cache() unmaps any fully-free mapped range and returns the
+physical pages to the driver while keeping the address reservation.
+
+Limitations: requires the driver virtual memory management API (Linux,
+CUDA >= 11), so it is opt-in; private pools for CUDA graphs keep using
+cudaMalloc because capture bakes in the results of cudaMalloc's
+synchronization behavior, and we have not qualified cuMemMap there.
+*/
+
+struct SegmentRange {
+  char* ptr;
+  size_t size;
+  SegmentRange(void* p, size_t s) : ptr(static_cast<char*>(p)), size(s) {}
+};
+
+#if !defined(USE_ROCM) && defined(PYTORCH_C10_DRIVER_API_SUPPORTED)
+
+struct ExpandableSegment {
+  ExpandableSegment(int device, cudaStream_t stream, size_t size)
+      : device_(device),
+        stream_(stream),
+        // 2MB for small pool, 20MB for large pool
+        segment_size_(size) {
+    cudaDeviceProp prop{};
+    C10_CUDA_CHECK(cudaGetDeviceProperties(&prop, device_));
+    // we reserve enough address space for 1 1/8 the total memory on the GPU.
+    // Address space is cheap: the slack means a segment can keep growing even
+    // when holes earlier in it are still mapped.
+    max_handles_ = numSegments(prop.totalGlobalMem + prop.totalGlobalMem / 8);
+    C10_CUDA_DRIVER_CHECK(DriverAPI::get()->cuMemAddressReserve_(
+        &ptr_, segment_size_ * max_handles_, 0ULL, 0, 0ULL));
+  }
+  // begin must be aligned to segment_size_.
+  // returns the actual range mapped, which may be
+  // greater than requested if size is not aligned to segment_size_.
+  // return size of 0 indicates OOM
+  SegmentRange map(SegmentRange range) {
+    auto begin = segmentLeft(range.ptr);
+    auto end = segmentRight(range.ptr + range.size);
+    TORCH_INTERNAL_ASSERT(ptr() + begin * segment_size_ == range.ptr);
+    if (begin == end) {
+      return rangeFromHandles(begin, end);
+    }
+    while (end > handles_.size()) {
+      handles_.emplace_back(c10::nullopt);
+    }
+    for (auto i : c10::irange(begin, end)) {
+      TORCH_INTERNAL_ASSERT(!handles_.at(i));
+      CUmemGenericAllocationHandle handle = 0;
+      CUmemAllocationProp prop = {};
+      prop.type = CU_MEM_ALLOCATION_TYPE_PINNED;
+      prop.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+      prop.location.id = device_;
+      auto status =
+          DriverAPI::get()->cuMemCreate_(&handle, segment_size_, &prop, 0);
+      if (status == CUDA_ERROR_OUT_OF_MEMORY) {
+        for (auto j : c10::irange(begin, i)) {
+          auto h = handles_.at(j).value();
+          handles_.at(j) = c10::nullopt;
+          C10_CUDA_DRIVER_CHECK(DriverAPI::get()->cuMemRelease_(h));
+        }
+        trimHandles();
+        return rangeFromHandles(begin, begin);
+      }
+      C10_CUDA_DRIVER_CHECK(status);
+      handles_.at(i) = handle;
+    }
+    for (auto i : c10::irange(begin, end)) {
+      C10_CUDA_DRIVER_CHECK(DriverAPI::get()->cuMemMap_(
+          ptr_ + i * segment_size_,
+          segment_size_,
+          0,
+          handles_.at(i).value(),
+          0ULL));
+    }
+
+    CUmemAccessDesc desc;
+    desc.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+    desc.location.id = device_;
+    desc.flags = CU_MEM_ACCESS_FLAGS_PROT_READWRITE;
+    C10_CUDA_DRIVER_CHECK(DriverAPI::get()->cuMemSetAccess_(
+        ptr_ + begin * segment_size_,
+        (end - begin) * segment_size_,
+        &desc,
+        1));
+    return rangeFromHandles(begin, end);
+  }
+
+  // unmaps all the completely empty segment_size_ segments between
+  // [begin, begin + size), returns the offset where the range begins, and the
+  // actual size unmapped (multiple of segment_size_)
+  SegmentRange unmap(SegmentRange range) {
+    auto begin = segmentRight(range.ptr);
+    auto end = segmentLeft(range.ptr + range.size);
+    if (begin >= end) {
+      return SegmentRange{range.ptr, 0};
+    }
+    unmapHandles(begin, end);
+    return rangeFromHandles(begin, end);
+  }
+
+  char* ptr() const {
+    return (char*)ptr_;
+  }
+  size_t size() const {
+    return max_handles_ * segment_size_;
+  }
+
+  ~ExpandableSegment() {
+    forEachAllocatedRange(
+        [&](size_t begin, size_t end) { unmapHandles(begin, end); });
+    C10_CUDA_DRIVER_CHECK(DriverAPI::get()->cuMemAddressFree_(
+        ptr_, segment_size_ * max_handles_));
+  }
+
+ private:
+  void unmapHandles(size_t begin, size_t end) {
+    // note: unlike cudaFree, MemUnmap and MemRelease do
+    // not synchronize in all cases, so we have to wait for the
+    // stream to finish before this memory is truly free.
+
+    // cannot call c10::cuda::stream_synchronize because
+    // it might grab the GIL which can lead to a deadlock
+    // Locking order must be GIL -> Allocator Lock
+    C10_CUDA_CHECK(cudaStreamSynchronize(stream_));
+    for (auto i : c10::irange(begin, end)) {
+      CUmemGenericAllocationHandle h = handles_.at(i).value();
+      handles_.at(i) = c10::nullopt;
+      C10_CUDA_DRIVER_CHECK(DriverAPI::get()->cuMemUnmap_(
+          ptr_ + segment_size_ * i, segment_size_));
+      C10_CUDA_DRIVER_CHECK(DriverAPI::get()->cuMemRelease_(h));
+    }
+    trimHandles();
+  }
+  void trimHandles() {
+    while (!handles_.empty() && !handles_.back()) {
+      handles_.pop_back();
+    }
+  }
+  void forEachAllocatedRange(std::function<void(size_t, size_t)> fn) {
+    size_t start = 0;
+    for (auto i : c10::irange(handles_.size())) {
+      if (handles_.at(i) && (i == 0 || !handles_.at(i - 1))) {
+        start = i;
+      }
+      if (handles_.at(i) && (i + 1 == handles_.size() || !handles_.at(i + 1))) {
+        fn(start, i + 1);
+      }
+    }
+  }
+  size_t numSegments(size_t size) {
+    return (size + segment_size_ - 1) / segment_size_;
+  }
+  size_t segmentLeft(char* p) {
+    auto size = p - ptr();
+    return size / segment_size_;
+  }
+  size_t segmentRight(char* p) {
+    auto size = p - ptr();
+    return numSegments(size);
+  }
+  SegmentRange rangeFromHandles(size_t begin, size_t end) {
+    return SegmentRange(
+        ptr() + segment_size_ * begin, segment_size_ * (end - begin));
+  }
+  int device_;
+  cudaStream_t stream_;
+  CUdeviceptr ptr_{};
+  size_t segment_size_;
+  size_t max_handles_;
+  std::vector<c10::optional<CUmemGenericAllocationHandle>> handles_;
 };
 
+#else
+
+struct ExpandableSegment {
+  ExpandableSegment(int, cudaStream_t, size_t) {
+    TORCH_INTERNAL_ASSERT(false, "expandable segment not supported");
+  }
+  SegmentRange map(SegmentRange) {
+    return SegmentRange(nullptr, 0);
+  }
+  SegmentRange unmap(SegmentRange) {
+    return SegmentRange(nullptr, 0);
+  }
+  char* ptr() const {
+    return nullptr;
+  }
+  size_t size() const {
+    return 0;
+  }
+};
+
+#endif
+
 static bool BlockComparator(const Block* a, const Block* b) {
   if (a->stream != b->stream) {
     return (uintptr_t)a->stream < (uintptr_t)b->stream;
@@ -339,6 +595,24 @@ class EventPool {
   std::vector<PerDevicePool> pools_;
 };
 
+// Note [User memory pools]
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+// The PrivatePool machinery below was built for CUDA graphs, but nothing in
+// it is capture-specific: a PrivatePool is just a pair of BlockPools whose
+// segments are never merged with the global cache. User memory pools reuse it
+// to give each inference session (tenant) an isolated arena, so one session's
+// allocation burst can't evict or fragment another's working set:
+//  - createUserPool registers (or attaches to) a PrivatePool for a
+//    MempoolId_t and optionally caps how many bytes of segments it may
+//    cudaMalloc (memory_limit).
+//  - beginAllocateToPool/endAllocateToPool set a thread-local pool id;
+//    get_pool routes allocations made by that thread into the private pool,
+//    the same way captures are routed via capture_to_pool_map.
+//  - releaseUserPool mirrors notifyCaptureDestroy: the pool's segments are
+//    cudaFreed lazily once its use count is zero and its blocks are unused.
+// Lifetime of blocks that outlive the guard is handled by the existing
+// owner_PrivatePool back-pointer on Block, exactly as for graph pools.
+
 // CUDA graphs helper
 struct PrivatePool {
   PrivatePool()
@@ -349,12 +623,18 @@ struct PrivatePool {
   PrivatePool(const PrivatePool&) = delete;
   PrivatePool(PrivatePool&&) = delete;
   PrivatePool& operator=(const PrivatePool&) = delete;
-  // Number of live graphs using this pool
+  // Number of live graphs (or user pool handles) using this pool
   int use_count;
   // Number of unfreed cudaMallocs made for this pool. When use_count and
   // cudaMalloc_count drop to zero, we can delete this PrivatePool from
   // graph_pools.
   int cudaMalloc_count;
+  // See Note [User memory pools]. Bytes of live segments cudaMalloc'ed for
+  // this pool, and the cap on them (0 means uncapped).
+  size_t cudaMalloc_bytes{0};
+  size_t memory_limit{0};
+  // Bytes currently owned by live allocations from this pool.
+  size_t allocated_bytes{0};
   // Instead of maintaining private BlockPools here, I could stuff all blocks
   // (private or no) into the top-level large_blocks and small_blocks, and
   // distinguish private blocks by adding a "pool id" check above the stream
@@ -370,6 +650,10 @@ struct MempoolIdHash {
   }
 };
 
+// See Note [User memory pools]. Thread-local so concurrent server threads can
+// route to different pools; {0, 0} means "use the global pools".
+thread_local MempoolId_t active_user_pool = {0, 0};
+
 cudaError_t cudaMallocMaybeCapturing(void** p, size_t size) {
 #if defined(CUDA_VERSION) && CUDA_VERSION >= 11000
   if (at::cuda::currentStreamCaptureStatusMayInitCtx() ==
@@ -404,6 +688,10 @@ class CachingAllocatorConfig {
     return instance().m_garbage_collection_threshold;
   }
 
+  static bool expandable_segments() {
+    return instance().m_expandable_segments;
+  }
+
   // This is used to round-up allocation size to nearest power of 2 divisions.
   // More description below in function roundup_power2_next_division
   // As ane example, if we want 4 divisions between 2's power, this can be done
@@ -443,7 +731,8 @@ class CachingAllocatorConfig {
  private:
   CachingAllocatorConfig()
       : m_max_split_size(std::numeric_limits<size_t>::max()),
-        m_garbage_collection_threshold(0) {
+        m_garbage_collection_threshold(0),
+        m_expandable_segments(false) {
     m_roundup_power2_divisions.assign(Native::kRoundUpPowerOfTwoIntervals, 0);
   }
 
@@ -467,6 +756,7 @@ class CachingAllocatorConfig {
   std::atomic<size_t> m_max_split_size;
   std::vector<size_t> m_roundup_power2_divisions;
   std::atomic<double> m_garbage_collection_threshold;
+  std::atomic<bool> m_expandable_segments;
 };
 
 void CachingAllocatorConfig::lexArgs(
@@ -686,6 +976,23 @@ void CachingAllocatorConfig::parseArgs(const char* env) {
       used_native_specific_option = true;
     } else if (config[i].compare("backend") == 0) {
       i = parseAllocatorConfig(config, i, used_cudaMallocAsync);
+    } else if (config[i].compare("expandable_segments") == 0) {
+      used_native_specific_option = true;
+      consumeToken(config, ++i, ':');
+      ++i;
+      TORCH_CHECK(
+          i < config.size() &&
+              (config[i].compare("True") == 0 ||
+               config[i].compare("False") == 0),
+          "Expected a single True/False argument for expandable_segments");
+#if !defined(USE_ROCM) && defined(PYTORCH_C10_DRIVER_API_SUPPORTED)
+      m_expandable_segments = (config[i].compare("True") == 0);
+#else
+      if (config[i].compare("True") == 0) {
+        TORCH_WARN("expandable_segments not supported on this platform");
+      }
+      m_expandable_segments = false;
+#endif
     } else {
       TORCH_CHECK(false, "Unrecognized CachingAllocator option: ", config[i]);
     }
@@ -728,12 +1035,22 @@ class DeviceCachingAllocator {
   int captures_underway = 0;
   // See free() for this thing's purpose
   std::vector<Block*> needs_events_deferred_until_no_capture;
-  // outstanding cuda events
+  // Blocks whose cross-stream uses still need an end-of-life event. Events
+  // are not recorded at free() time; blocks accumulate here per stream and
+  // one shared event per stream covers the whole batch when the lists are
+  // drained (see record_deferred_frees). This caps the number of live events
+  // at one per stream per drain instead of one per freed block.
+  ska::flat_hash_map<cuda::CUDAStream, std::vector<Block*>> deferred_frees;
+  // outstanding cuda events, each covering a batch of deferred frees
   ska::flat_hash_map<
       cuda::CUDAStream,
-      std::deque<std::pair<EventPool::Event, Block*>>>
+      std::deque<std::pair<EventPool::Event, std::vector<Block*>>>>
       cuda_events;
 
+  // segments that can grow in place, owned by this allocator.
+  // See Note [Expandable segments].
+  std::vector<ExpandableSegment*> expandable_segments_;
+
   // record used memory.
   size_t total_allocated_memory = 0;
 
@@ -770,6 +1087,13 @@ class DeviceCachingAllocator {
   // XXX - maybe we should generalize and have multiple events
   std::vector<OutOfMemoryObserver> oom_observers_;
 
+  // Streaming consumers of trace events; see AllocatorTraceTracker.
+  std::vector<AllocatorTraceTracker> trace_trackers_;
+
+  // Client-allocated bytes per allocating stream; mirrors
+  // stats.allocated_bytes. See StreamStats.
+  ska::flat_hash_map<cudaStream_t, Stat> stream_allocated_bytes_;
+
  public:
   DeviceCachingAllocator()
       : large_blocks(BlockComparator, /*is_small=*/false),
@@ -797,6 +1121,21 @@ class DeviceCachingAllocator {
     oom_observers_.emplace_back(std::move(observer));
   }
 
+  void attachAllocatorTraceTracker(AllocatorTraceTracker tracker) {
+    std::unique_lock<std::recursive_mutex> lock(mutex);
+    trace_trackers_.emplace_back(std::move(tracker));
+  }
+
+  std::vector<StreamStats> getStreamStats() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    std::vector<StreamStats> result;
+    result.reserve(stream_allocated_bytes_.size());
+    for (const auto& entry : stream_allocated_bytes_) {
+      result.emplace_back(StreamStats{entry.first, entry.second});
+    }
+    return result;
+  }
+
   // All public methods (except the above) acquire the allocator mutex.
   // Thus, do not call a public method from another public method.
 
@@ -853,7 +1192,7 @@ class DeviceCachingAllocator {
           // Free all non-split cached blocks and retry alloc.
           || (C10_LIKELY(captures_underway == 0) && release_cached_blocks() &&
               alloc_block(params, true));
-      if (record_history && block_found) {
+      if (block_found) {
         record_trace(
             TraceEntry::SEGMENT_ALLOC,
             int64_t(params.block->ptr),
@@ -877,14 +1216,12 @@ class DeviceCachingAllocator {
         allowed_info = format_size(allowed_memory_maximum) + " allowed; ";
       }
 
-      if (record_history) {
-        record_trace(
-            TraceEntry::OOM,
-            device_free,
-            params.size(),
-            params.stream(),
-            std::move(context));
-      }
+      record_trace(
+          TraceEntry::OOM,
+          device_free,
+          params.size(),
+          params.stream(),
+          std::move(context));
       stats.num_ooms += 1;
 
       c10::reportOutOfMemoryToProfiler(
@@ -955,6 +1292,7 @@ class DeviceCachingAllocator {
       remaining = block;
 
       block = new Block(device, stream, size, &pool, block->ptr);
+      block->expandable_segment_ = remaining->expandable_segment_;
       block->prev = remaining->prev;
       if (block->prev) {
         block->prev->next = block;
@@ -1001,23 +1339,29 @@ class DeviceCachingAllocator {
       if (!block->history_last) {
         block->history_last = block->history.get();
       }
-      record_trace(
-          TraceEntry::ALLOC,
-          int64_t(block->ptr),
-          orig_size,
-          block->stream,
-          block->history->h.context);
     }
+    record_trace(
+        TraceEntry::ALLOC,
+        int64_t(block->ptr),
+        orig_size,
+        block->stream,
+        block->history ? block->history->h.context : std::move(context));
 
     bool inserted = active_blocks.insert(block).second;
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(inserted);
 
+    if (block->pool->owner_PrivatePool) {
+      // See Note [User memory pools]
+      block->pool->owner_PrivatePool->allocated_bytes += block->size;
+    }
+
     for_each_selected_stat_type(params.stat_types, [&](size_t stat_type) {
       update_stat(stats.allocation[stat_type], 1);
       update_stat(stats.allocated_bytes[stat_type], block->size);
       update_stat(stats.active[stat_type], 1);
       update_stat(stats.active_bytes[stat_type], block->size);
     });
+    update_stat(stream_allocated_bytes_[block->stream], block->size);
     if (block->size >= CachingAllocatorConfig::max_split_size())
       update_stat(stats.oversize_allocations, 1);
 
@@ -1041,6 +1385,11 @@ class DeviceCachingAllocator {
     auto orig_block_ptr = block->ptr;
     auto orig_block_size = block->size;
 
+    if (block->pool->owner_PrivatePool) {
+      // See Note [User memory pools]
+      block->pool->owner_PrivatePool->allocated_bytes -= block->size;
+    }
+
     StatTypes stat_types = {false};
     stat_types[static_cast<size_t>(StatType::AGGREGATE)] = true;
     stat_types[static_cast<size_t>(get_stat_type_for_pool(*(block->pool)))] =
@@ -1049,14 +1398,13 @@ class DeviceCachingAllocator {
       update_stat(stats.allocation[stat_type], -1);
       update_stat(stats.allocated_bytes[stat_type], -block->size);
     });
-    if (block->history) {
-      record_trace(
-          TraceEntry::FREE_REQUESTED,
-          int64_t(block->ptr),
-          block->history->h.real_size,
-          block->stream,
-          block->history->h.context);
-    }
+    update_stat(stream_allocated_bytes_[block->stream], -block->size);
+    record_trace(
+        TraceEntry::FREE_REQUESTED,
+        int64_t(block->ptr),
+        block->history ? block->history->h.real_size : block->size,
+        block->stream,
+        block->history ? block->history->h.context : nullptr);
     if (block->size >= CachingAllocatorConfig::max_split_size())
       update_stat(stats.oversize_allocations, -1);
 
@@ -1168,6 +1516,9 @@ class DeviceCachingAllocator {
     stats.num_ooms = 0;
     reset_accumulated_stat(stats.oversize_allocations);
     reset_accumulated_stat(stats.oversize_segments);
+    for (auto& entry : stream_allocated_bytes_) {
+      reset_accumulated_stat(entry.second);
+    }
   }
 
   /** Resets the historical peak stats for the device **/
@@ -1187,6 +1538,9 @@ class DeviceCachingAllocator {
     }
     reset_peak_stat(stats.oversize_allocations);
     reset_peak_stat(stats.oversize_segments);
+    for (auto& entry : stream_allocated_bytes_) {
+      reset_peak_stat(entry.second);
+    }
   }
 
   /** Dump a complete snapshot of the memory held by the allocator. Potentially
@@ -1339,8 +1693,45 @@ class DeviceCachingAllocator {
 
   // Called by CUDAGraph::reset
   void notifyCaptureDestroy(MempoolId_t mempool_id) {
+    releasePool(mempool_id);
+  }
+
+  // See Note [User memory pools]
+  void createUserPool(MempoolId_t mempool_id, size_t memory_limit) {
     std::lock_guard<std::recursive_mutex> lock(mutex);
-    // The instantiated cudaGraphExec_t has been destroyed. We can't blindly
+    auto it = graph_pools.find(mempool_id);
+    if (it == graph_pools.end()) {
+      it = graph_pools.emplace(mempool_id, std::make_unique<PrivatePool>())
+               .first;
+    } else {
+      TORCH_INTERNAL_ASSERT(it->second->use_count > 0);
+      it->second->use_count++;
+    }
+    it->second->memory_limit = memory_limit;
+  }
+
+  // See Note [User memory pools]
+  UserPoolStats getUserPoolStats(MempoolId_t mempool_id) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto it = graph_pools.find(mempool_id);
+    TORCH_CHECK(
+        it != graph_pools.end(),
+        "No user memory pool with id (",
+        mempool_id.first,
+        ", ",
+        mempool_id.second,
+        ") exists on this device.");
+    UserPoolStats result;
+    result.reserved_bytes = static_cast<int64_t>(it->second->cudaMalloc_bytes);
+    result.allocated_bytes = static_cast<int64_t>(it->second->allocated_bytes);
+    return result;
+  }
+
+  // Called by CUDAGraph::reset and by user pool release.
+  void releasePool(MempoolId_t mempool_id) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    // The pool's last user (instantiated cudaGraphExec_t or user pool handle)
+    // is gone. We can't blindly
     // delete and cudaFree the mempool its capture used, because
     //  1. other graph(s) might share the same pool
     //  2. the user might still hold references to output tensors allocated
@@ -1390,14 +1781,12 @@ class DeviceCachingAllocator {
     TORCH_INTERNAL_ASSERT(
         !block->allocated && block->event_count == 0 &&
         block->stream_uses.empty());
-    if (block->history) {
-      record_trace(
-          TraceEntry::FREE_COMPLETED,
-          int64_t(block->ptr),
-          block->history->h.real_size,
-          block->stream,
-          block->history->h.context);
-    }
+    record_trace(
+        TraceEntry::FREE_COMPLETED,
+        int64_t(block->ptr),
+        block->history ? block->history->h.real_size : block->size,
+        block->stream,
+        block->history ? block->history->h.context : nullptr);
     size_t original_block_size = block->size;
 
     auto& pool = *block->pool;
@@ -1443,7 +1832,7 @@ class DeviceCachingAllocator {
    * or 0 on failure. */
   size_t try_merge_blocks(Block* dst, Block* src, BlockPool& pool) {
     if (!src || src->allocated || src->event_count > 0 ||
-        !src->stream_uses.empty()) {
+        !src->stream_uses.empty() || dst->mapped != src->mapped) {
       return 0;
     }
 
@@ -1480,7 +1869,8 @@ class DeviceCachingAllocator {
     }
     const size_t subsumed_size = src->size;
     dst->size += subsumed_size;
-    auto erased = pool.blocks.erase(src);
+    auto erased =
+        src->mapped ? pool.blocks.erase(src) : pool.unmapped.erase(src);
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(erased == 1);
     delete src;
 
@@ -1514,6 +1904,23 @@ class DeviceCachingAllocator {
       }
     }
 #endif
+    // See Note [User memory pools]
+    if (C10_UNLIKELY(
+            active_user_pool.first != 0 || active_user_pool.second != 0)) {
+      auto it = graph_pools.find(active_user_pool);
+      TORCH_CHECK(
+          it != graph_pools.end(),
+          "Allocation was routed to user memory pool (",
+          active_user_pool.first,
+          ", ",
+          active_user_pool.second,
+          "), but no such pool has been created on this device.");
+      if (size <= kSmallSize) {
+        return it->second->small_blocks;
+      } else {
+        return it->second->large_blocks;
+      }
+    }
     if (size <= kSmallSize) {
       return small_blocks;
     } else {
@@ -1527,7 +1934,7 @@ class DeviceCachingAllocator {
 
   bool should_split(const Block* block, size_t size) {
     size_t remaining = block->size - size;
-    if (block->pool->is_small) {
+    if (block->pool->is_small || CachingAllocatorConfig::expandable_segments()) {
       return remaining >= kMinBlockSize;
     } else {
       return (size < CachingAllocatorConfig::max_split_size()) &&
@@ -1602,7 +2009,7 @@ class DeviceCachingAllocator {
     double total_age = 0.0;
     int freeable_block_count = 0;
     for (auto& b : large_blocks.blocks) {
-      if (!b->is_split()) {
+      if (!b->is_split() && !b->expandable_segment_) {
         total_age += b->gc_count;
         ++freeable_block_count;
       }
@@ -1627,7 +2034,8 @@ class DeviceCachingAllocator {
       while (it != large_blocks.blocks.end()) {
         Block* block = *it;
         ++it;
-        if (!block->is_split() && block->gc_count >= age_threshold) {
+        if (!block->is_split() && !block->expandable_segment_ &&
+            block->gc_count >= age_threshold) {
           block_freed = true;
           gc_reclaimed += block->size;
           total_age -= block->gc_count; // Decrement the age
@@ -1638,6 +2046,138 @@ class DeviceCachingAllocator {
     }
   }
 
+  // Finds a contiguous run of free + unmapped blocks with at least size bytes
+  // of address space for the stream, creating a new expandable segment if no
+  // existing one has room. See Note [Expandable segments].
+  Block* find_expandable_block(
+      int device,
+      cudaStream_t stream,
+      BlockPool* pool,
+      size_t size) {
+    Block key(device, stream, 0);
+
+    auto allocatable = [](Block* b) {
+      return b && !b->allocated && b->event_count == 0 &&
+          b->stream_uses.empty();
+    };
+    auto has_available_address_space = [&](Block* b) {
+      size_t bytes = 0;
+      while (bytes < size && allocatable(b)) {
+        bytes += b->size;
+        b = b->next;
+      }
+      return bytes >= size;
+    };
+    for (auto it = pool->unmapped.lower_bound(&key);
+         it != pool->unmapped.end() && (*it)->stream == stream;
+         ++it) {
+      Block* c = *it;
+      // we found the lowest address of an unmapped segment
+      // but there might be a free segment we can also use
+      // right before it
+      if (allocatable(c->prev)) {
+        c = c->prev;
+      }
+      if (has_available_address_space(c)) {
+        return c;
+      }
+    }
+    auto segment_size = pool->is_small ? kSmallBuffer : kLargeBuffer;
+    expandable_segments_.emplace_back(
+        new ExpandableSegment(device, stream, segment_size));
+
+    ExpandableSegment* es = expandable_segments_.back();
+    Block* candidate = new Block(device, stream, es->size(), pool, es->ptr());
+    candidate->mapped = false;
+    candidate->expandable_segment_ = es;
+    pool->unmapped.insert(candidate);
+
+    StatTypes stat_types = {false};
+    stat_types[static_cast<size_t>(StatType::AGGREGATE)] = true;
+    stat_types[static_cast<size_t>(get_stat_type_for_pool(*pool))] = true;
+    for_each_selected_stat_type(stat_types, [&](size_t stat_type) {
+      update_stat(stats.segment[stat_type], 1);
+    });
+    return candidate;
+  }
+
+  bool map_block(Block* to_map, size_t size) {
+    TORCH_INTERNAL_ASSERT(!to_map->mapped && size <= to_map->size);
+    auto mapped_range =
+        to_map->expandable_segment_->map(SegmentRange{to_map->ptr, size});
+    // failed to map the memory
+    if (mapped_range.size == 0) {
+      return false;
+    }
+    TORCH_INTERNAL_ASSERT(
+        mapped_range.ptr == to_map->ptr && mapped_range.size >= size);
+
+    BlockPool& pool = *to_map->pool;
+    pool.unmapped.erase(to_map);
+    to_map->mapped = true;
+
+    if (mapped_range.size < to_map->size) {
+      // to_map -> remaining -> to_map->next(?)
+      Block* remaining = new Block(
+          to_map->device,
+          to_map->stream,
+          to_map->size - mapped_range.size,
+          &pool,
+          static_cast<char*>(to_map->ptr) + mapped_range.size);
+      remaining->mapped = false;
+      remaining->expandable_segment_ = to_map->expandable_segment_;
+      remaining->splice(to_map, to_map->next);
+      pool.unmapped.insert(remaining);
+      to_map->size = mapped_range.size;
+    }
+
+    try_merge_blocks(to_map, to_map->prev, pool);
+    try_merge_blocks(to_map, to_map->next, pool);
+
+    pool.blocks.insert(to_map);
+
+    // update statistics
+    total_allocated_memory += mapped_range.size;
+    StatTypes stat_types = {false};
+    stat_types[static_cast<size_t>(StatType::AGGREGATE)] = true;
+    stat_types[static_cast<size_t>(get_stat_type_for_pool(pool))] = true;
+    for_each_selected_stat_type(stat_types, [&](size_t stat_type) {
+      update_stat(stats.reserved_bytes[stat_type], mapped_range.size);
+    });
+    return true;
+  }
+
+  Block* try_allocate_expandable_block(
+      int device,
+      cudaStream_t stream,
+      BlockPool* pool,
+      size_t size) {
+    Block* candidate = find_expandable_block(device, stream, pool, size);
+    // Candidate is now a list free/unmapped blocks with at least size room:
+    // unmapped -> null
+    // unmapped -> free -> *
+    // free -> unmapped -> *
+
+    if (!candidate->mapped &&
+        !map_block(candidate, std::min(candidate->size, size))) {
+      return nullptr;
+    }
+    TORCH_INTERNAL_ASSERT(candidate->mapped);
+
+    while (candidate->size < size) {
+      // invariant: free -> unmapped -> *
+      // map_block will map some of unmapped and merge with free
+      auto remaining = size - candidate->size;
+      auto new_candidate = candidate->next;
+      if (!map_block(new_candidate, std::min(remaining, new_candidate->size))) {
+        return nullptr;
+      }
+      candidate = new_candidate;
+    }
+    pool->blocks.erase(candidate);
+    return candidate;
+  }
+
   bool alloc_block(AllocParams& p, bool isRetry) {
     // Defensively checks for preexisting CUDA error state.
     C10_CUDA_CHECK(cudaGetLastError());
@@ -1653,6 +2193,30 @@ class DeviceCachingAllocator {
         total_allocated_memory + size > allowed_memory_maximum) {
       p.err = cudaErrorMemoryAllocation;
       return false;
+    } else if (
+        p.pool->owner_PrivatePool &&
+        p.pool->owner_PrivatePool->memory_limit != 0 &&
+        p.pool->owner_PrivatePool->cudaMalloc_bytes + size >
+            p.pool->owner_PrivatePool->memory_limit) {
+      // The user pool this allocation is routed to has its own cap; see Note
+      // [User memory pools].
+      p.err = cudaErrorMemoryAllocation;
+      return false;
+    } else if (
+        CachingAllocatorConfig::expandable_segments() &&
+        !p.pool->owner_PrivatePool && C10_LIKELY(captures_underway == 0)) {
+      // Private pools for CUDA graphs keep using cudaMalloc; see Note
+      // [Expandable segments].
+      p.block = try_allocate_expandable_block(
+          p.device(), p.stream(), p.pool, p.size());
+      if (p.block == nullptr) {
+        p.err = cudaErrorMemoryAllocation;
+        return false;
+      }
+      // statistics for the mapped memory are updated as part of map_block;
+      // oversize_segments is left alone because expandable segments are
+      // always splittable
+      return true;
     } else {
       p.err = cudaMallocMaybeCapturing(&ptr, size);
       if (p.err != cudaSuccess) {
@@ -1676,8 +2240,9 @@ class DeviceCachingAllocator {
     }
 
     if (p.pool->owner_PrivatePool) {
-      // The block is for a CUDA graph's PrivatePool.
+      // The block is for a CUDA graph's (or user) PrivatePool.
       p.pool->owner_PrivatePool->cudaMalloc_count++;
+      p.pool->owner_PrivatePool->cudaMalloc_bytes += size;
     }
 
     total_allocated_memory += size;
@@ -1724,7 +2289,7 @@ class DeviceCachingAllocator {
             // stream
       while ((totalReleased < key.size) &&
              ((*it)->size >= CachingAllocatorConfig::max_split_size()) &&
-             ((*it)->stream == p.stream())) {
+             ((*it)->stream == p.stream()) && !(*it)->expandable_segment_) {
         auto cur = it;
         totalReleased += (*it)->size;
         if (it != pool.blocks.begin()) {
@@ -1737,6 +2302,10 @@ class DeviceCachingAllocator {
       }
       if (totalReleased < key.size)
         return false;
+    } else if ((*it)->expandable_segment_) {
+      // expandable segments give memory back to the system in empty_cache()
+      // by unmapping, not cudaFree; there is no oversize segment to release
+      return false;
     } else {
       release_block(*it);
     }
@@ -1771,14 +2340,16 @@ class DeviceCachingAllocator {
   }
 
   void release_block(Block* block) {
+    TORCH_INTERNAL_ASSERT(!block->expandable_segment_);
     C10_CUDA_CHECK(cudaFree((void*)block->ptr));
     total_allocated_memory -= block->size;
 
     auto* pool = block->pool;
     if (pool->owner_PrivatePool) {
-      // The cudaFreed block belonged to a CUDA graph's PrivatePool.
+      // The cudaFreed block belonged to a CUDA graph's (or user) PrivatePool.
       TORCH_INTERNAL_ASSERT(pool->owner_PrivatePool->cudaMalloc_count > 0);
       pool->owner_PrivatePool->cudaMalloc_count--;
+      pool->owner_PrivatePool->cudaMalloc_bytes -= block->size;
     }
 
     StatTypes stat_types = {false};
@@ -1790,28 +2361,119 @@ class DeviceCachingAllocator {
     });
     if (block->size >= CachingAllocatorConfig::max_split_size())
       update_stat(stats.oversize_segments, -1);
-    if (block->history) {
-      record_trace(
-          TraceEntry::SEGMENT_FREE,
-          int64_t(block->ptr),
-          block->size,
+    record_trace(
+        TraceEntry::SEGMENT_FREE,
+        int64_t(block->ptr),
+        block->size,
+        block->stream,
+        block->history ? block->history->h.context : nullptr);
+    pool->blocks.erase(block);
+    delete block;
+  }
+
+  void unmap_block(Block* block) {
+    auto unmapped = block->expandable_segment_->unmap(
+        SegmentRange{block->ptr, block->size});
+    if (unmapped.size == 0) {
+      return;
+    }
+    block->pool->blocks.erase(block);
+
+    ptrdiff_t before_size = unmapped.ptr - static_cast<char*>(block->ptr);
+    if (before_size > 0) {
+      // prev? -> before_free -> block
+      Block* before_free = new Block(
+          block->device, block->stream, before_size, block->pool, block->ptr);
+      before_free->expandable_segment_ = block->expandable_segment_;
+      before_free->splice(block->prev, block);
+      block->pool->blocks.insert(before_free);
+    }
+
+    auto after_size = block->size - (before_size + unmapped.size);
+    if (after_size > 0) {
+      // block -> after_free -> next?
+      Block* after_free = new Block(
+          block->device,
           block->stream,
-          block->history->h.context);
+          after_size,
+          block->pool,
+          unmapped.ptr + unmapped.size);
+      after_free->expandable_segment_ = block->expandable_segment_;
+      after_free->splice(block, block->next);
+      block->pool->blocks.insert(after_free);
     }
-    pool->blocks.erase(block);
+
+    block->ptr = unmapped.ptr;
+    block->size = unmapped.size;
+    block->mapped = false;
+
+    try_merge_blocks(block, block->prev, *block->pool);
+    try_merge_blocks(block, block->next, *block->pool);
+    block->pool->unmapped.insert(block);
+
+    // update statistics
+    total_allocated_memory -= unmapped.size;
+    StatTypes stat_types = {false};
+    stat_types[static_cast<size_t>(StatType::AGGREGATE)] = true;
+    stat_types[static_cast<size_t>(get_stat_type_for_pool(*block->pool))] =
+        true;
+    for_each_selected_stat_type(stat_types, [&](size_t stat_type) {
+      update_stat(stats.reserved_bytes[stat_type], -unmapped.size);
+    });
+    record_trace(
+        TraceEntry::SEGMENT_FREE,
+        int64_t(block->ptr),
+        unmapped.size,
+        block->stream,
+        block->history ? block->history->h.context : nullptr);
+  }
+
+  void release_expandable_segment(Block* block) {
+    TORCH_INTERNAL_ASSERT(
+        block->size == block->expandable_segment_->size(),
+        "block disagrees with segment");
+    TORCH_INTERNAL_ASSERT(!block->mapped);
+    auto it = std::find(
+        expandable_segments_.begin(),
+        expandable_segments_.end(),
+        block->expandable_segment_);
+    TORCH_INTERNAL_ASSERT(it != expandable_segments_.end());
+    expandable_segments_.erase(it);
+    block->pool->unmapped.erase(block);
+
+    StatTypes stat_types = {false};
+    stat_types[static_cast<size_t>(StatType::AGGREGATE)] = true;
+    stat_types[static_cast<size_t>(get_stat_type_for_pool(*block->pool))] =
+        true;
+    for_each_selected_stat_type(stat_types, [&](size_t stat_type) {
+      update_stat(stats.segment[stat_type], -1);
+    });
+
+    delete block->expandable_segment_;
     delete block;
   }
 
   void release_blocks(BlockPool& pool) {
     // Frees all non-split blocks
+    std::vector<Block*> to_unmap;
     auto it = pool.blocks.begin();
     while (it != pool.blocks.end()) {
       Block* block = *it;
       ++it;
-      if (!block->prev && !block->next) {
+      if (block->expandable_segment_) {
+        // unmapping will mutate the free pool, so just gather what needs to
+        // be freed and do it afterwards
+        to_unmap.push_back(block);
+      } else if (!block->prev && !block->next) {
         release_block(block);
       }
     }
+    for (Block* block : to_unmap) {
+      unmap_block(block);
+      if (!block->prev && !block->next) {
+        release_expandable_segment(block);
+      }
+    }
   }
 
   EventPool::Event create_event_internal(int idx) {
@@ -1827,17 +2489,19 @@ class DeviceCachingAllocator {
     // make sure capture-deferred end of life events get processed too.
     TORCH_INTERNAL_ASSERT(captures_underway == 0);
     insert_events_deferred_until_no_capture();
+    record_deferred_frees();
 
     for (auto& st : cuda_events) {
       for (auto& e : st.second) {
         EventPool::Event event = std::move(e.first);
-        Block* block = e.second;
 
         C10_CUDA_CHECK(cudaEventSynchronize(*event));
 
-        block->event_count--;
-        if (block->event_count == 0) {
-          free_block(block);
+        for (Block* block : e.second) {
+          block->event_count--;
+          if (block->event_count == 0) {
+            free_block(block);
+          }
         }
       }
     }
@@ -1845,22 +2509,41 @@ class DeviceCachingAllocator {
     cuda_events.clear();
   }
 
+  // Queues a block whose stream uses ended for a shared end-of-life event.
+  // No CUDA calls happen here; record_deferred_frees records the events in
+  // batch the next time the event queues are drained. Deferring the record
+  // is safe because all uses of the block were enqueued before free() was
+  // called, so any later-recorded event on the stream still orders after
+  // them; it only delays reuse of the block until the next drain.
   void insert_events(Block* block) {
-    int prev_device;
-    C10_CUDA_CHECK(cudaGetDevice(&prev_device));
-
     stream_set streams(std::move(block->stream_uses));
     AT_ASSERT(block->stream_uses.empty());
     for (auto& stream : streams) {
+      block->event_count++;
+      deferred_frees[stream].push_back(block);
+    }
+  }
+
+  // Records one event per stream covering every block deferred since the
+  // last drain, and moves the batches onto the outstanding event queues.
+  void record_deferred_frees() {
+    if (C10_LIKELY(deferred_frees.empty())) {
+      return;
+    }
+    int prev_device;
+    C10_CUDA_CHECK(cudaGetDevice(&prev_device));
+
+    for (auto& df : deferred_frees) {
+      const auto& stream = df.first;
       C10_CUDA_CHECK(cudaSetDevice(stream.device_index()));
 
       EventPool::Event event =
           create_event_internal(static_cast<int>(stream.device_index()));
       C10_CUDA_CHECK(cudaEventRecord(*event, stream.stream()));
 
-      block->event_count++;
-      cuda_events[stream].emplace_back(std::move(event), block);
+      cuda_events[stream].emplace_back(std::move(event), std::move(df.second));
     }
+    deferred_frees.clear();
 
     C10_CUDA_CHECK(cudaSetDevice(prev_device));
   }
@@ -1877,6 +2560,7 @@ class DeviceCachingAllocator {
 
   void process_events() {
     insert_events_deferred_until_no_capture();
+    record_deferred_frees();
 
     // Process outstanding cudaEvents. Events that are completed are
     // removed from the queue, and the 'event_count' for the
@@ -1886,26 +2570,49 @@ class DeviceCachingAllocator {
 
     // Iterate over different streams.
     for (auto it = cuda_events.begin(); it != cuda_events.end();) {
-      // Iterate over this stream's (event, block) pairs.
-      while (!it->second.empty()) {
-        auto& e = it->second.front();
-        EventPool::Event event = std::move(e.first);
-        Block* block = e.second;
-
-        cudaError_t err = C10_CUDA_ERROR_HANDLED(cudaEventQuery(*event));
+      // Events on a single stream are recorded (and therefore complete) in
+      // FIFO order, so if the newest event has completed, every older event
+      // on the stream has too, and the whole queue can be retired with a
+      // single cudaEventQuery instead of one query per event. This matters
+      // for multi-stream workloads that record thousands of events between
+      // allocations.
+      bool all_ready = false;
+      if (!it->second.empty()) {
+        cudaError_t err =
+            C10_CUDA_ERROR_HANDLED(cudaEventQuery(*it->second.back().first));
         if (err == cudaErrorNotReady) {
           // ignore and clear the error if not ready
           cudaGetLastError();
-          // Return the ownership of the Event (unique ptr)
-          e.first = std::move(event);
-          break;
         } else if (err != cudaSuccess) {
           C10_CUDA_CHECK(err);
+        } else {
+          all_ready = true;
         }
+      }
 
-        block->event_count--;
-        if (block->event_count == 0) {
-          free_block(block);
+      // Iterate over this stream's (event, blocks) batches.
+      while (!it->second.empty()) {
+        auto& e = it->second.front();
+        EventPool::Event event = std::move(e.first);
+
+        if (!all_ready) {
+          cudaError_t err = C10_CUDA_ERROR_HANDLED(cudaEventQuery(*event));
+          if (err == cudaErrorNotReady) {
+            // ignore and clear the error if not ready
+            cudaGetLastError();
+            // Return the ownership of the Event (unique ptr)
+            e.first = std::move(event);
+            break;
+          } else if (err != cudaSuccess) {
+            C10_CUDA_CHECK(err);
+          }
+        }
+
+        for (Block* block : e.second) {
+          block->event_count--;
+          if (block->event_count == 0) {
+            free_block(block);
+          }
         }
         it->second.pop_front();
       }
@@ -1934,12 +2641,26 @@ class DeviceCachingAllocator {
       size_t size,
       cudaStream_t stream,
       std::shared_ptr<Context> context) {
+    if (!record_history && trace_trackers_.empty()) {
+      return;
+    }
+
     auto te = TraceEntry(
         action,
         addr,
         size,
         stream,
         alloc_trace_record_context_ ? std::move(context) : nullptr);
+
+    // Callers hold the allocator lock, so a tracker attached before this
+    // event sees a consistent stream of events.
+    for (const auto& cb : trace_trackers_) {
+      cb(te);
+    }
+
+    if (!record_history) {
+      return;
+    }
     if (alloc_trace->size() < alloc_trace_max_entries_) {
       alloc_trace->emplace_back(te);
     } else {
@@ -2084,6 +2805,20 @@ class NativeCachingAllocator : public CUDAAllocator {
     device_allocator[device]->attachOutOfMemoryObserver(std::move(observer));
   }
 
+  void attachAllocatorTraceTracker(AllocatorTraceTracker tracker) override {
+    // Attach to all devices: unlike history recording, a streaming consumer
+    // wants the whole process, and per-device filtering is trivial on the
+    // receiving side via TraceEntry::stream_.
+    for (auto& allocator : device_allocator) {
+      allocator->attachAllocatorTraceTracker(tracker);
+    }
+  }
+
+  std::vector<StreamStats> getStreamStats(int device) override {
+    assertValidDevice(device);
+    return device_allocator[device]->getStreamStats();
+  }
+
   void emptyCache() override {
     for (auto& da : device_allocator)
       da->emptyCache();
@@ -2208,6 +2943,34 @@ class NativeCachingAllocator : public CUDAAllocator {
     device_allocator[device]->notifyCaptureDestroy(std::move(mempool_id));
   }
 
+  // See Note [User memory pools]
+  void createUserPool(int device, MempoolId_t mempool_id, size_t memory_limit)
+      override {
+    assertValidDevice(device);
+    device_allocator[device]->createUserPool(
+        std::move(mempool_id), memory_limit);
+  }
+
+  void releaseUserPool(int device, MempoolId_t mempool_id) override {
+    assertValidDevice(device);
+    device_allocator[device]->releasePool(std::move(mempool_id));
+  }
+
+  MempoolId_t beginAllocateToPool(MempoolId_t mempool_id) override {
+    MempoolId_t previous = active_user_pool;
+    active_user_pool = std::move(mempool_id);
+    return previous;
+  }
+
+  void endAllocateToPool(MempoolId_t previous) override {
+    active_user_pool = std::move(previous);
+  }
+
+  UserPoolStats getUserPoolStats(int device, MempoolId_t mempool_id) override {
+    assertValidDevice(device);
+    return device_allocator[device]->getUserPoolStats(std::move(mempool_id));
+  }
+
   void* raw_alloc(size_t nbytes) override {
     if (nbytes == 0) {
       return nullptr;
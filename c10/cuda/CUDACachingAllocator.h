@@ -166,6 +166,15 @@ struct SnapshotInfo {
   std::vector<std::vector<TraceEntry>> device_traces;
 };
 
+// Live usage of client-allocated bytes on one stream. `allocated_bytes`
+// mirrors DeviceStats::allocated_bytes, sharded by allocating stream, so a
+// dashboard can watch each stream's current use and high watermark without
+// taking a full snapshot().
+struct StreamStats {
+  cudaStream_t stream = 0;
+  Stat allocated_bytes;
+};
+
 C10_CUDA_API void setAllocatorSettings(const std::string& env);
 
 // Size pretty-printer
@@ -177,6 +186,23 @@ using OutOfMemoryObserver = std::function<void(
     int64_t device_total,
     int64_t device_free)>;
 
+// Called synchronously for every alloc/free/segment trace event, whether or
+// not recordHistory() is active, so events can be streamed out of process
+// instead of dumped post-hoc. The callback runs while the allocator lock is
+// held: it must be cheap and must not allocate or free CUDA memory. When no
+// tracker is attached (and history recording is off) the cost at each event
+// site is a single empty-vector check under the already-held lock.
+using AllocatorTraceTracker = std::function<void(const TraceEntry&)>;
+
+// Per-pool counters for user memory pools; see Note [User memory pools] in
+// CUDACachingAllocator.cpp.
+struct UserPoolStats {
+  // Bytes of live segments cudaMalloc'ed for the pool.
+  int64_t reserved_bytes = 0;
+  // Bytes currently owned by live allocations from the pool.
+  int64_t allocated_bytes = 0;
+};
+
 class CUDAAllocator : public Allocator {
  public:
   virtual void* raw_alloc(size_t nbytes) = 0;
@@ -200,6 +226,18 @@ class CUDAAllocator : public Allocator {
   virtual void notifyCaptureAboutToEnd(int device, CaptureId_t graph_id) = 0;
   virtual void notifyCaptureEnded(int device, CaptureId_t graph_id) = 0;
   virtual void notifyCaptureDestroy(int device, MempoolId_t mempool_id) = 0;
+  // User memory pools; see Note [User memory pools] in
+  // CUDACachingAllocator.cpp.
+  virtual void createUserPool(
+      int device,
+      MempoolId_t mempool_id,
+      size_t memory_limit) = 0;
+  virtual void releaseUserPool(int device, MempoolId_t mempool_id) = 0;
+  // Returns the pool the calling thread was routing to before, so guards can
+  // nest.
+  virtual MempoolId_t beginAllocateToPool(MempoolId_t mempool_id) = 0;
+  virtual void endAllocateToPool(MempoolId_t mempool_id) = 0;
+  virtual UserPoolStats getUserPoolStats(int device, MempoolId_t mempool_id) = 0;
   virtual std::shared_ptr<void> getIpcDevPtr(std::string handle) = 0;
   virtual void recordHistory(
       bool enabled,
@@ -207,6 +245,8 @@ class CUDAAllocator : public Allocator {
       size_t alloc_trace_max_entries,
       bool alloc_trace_record_context) = 0;
   virtual void attachOutOfMemoryObserver(OutOfMemoryObserver observer) = 0;
+  virtual void attachAllocatorTraceTracker(AllocatorTraceTracker tracker) = 0;
+  virtual std::vector<StreamStats> getStreamStats(int device) = 0;
   virtual bool needsPoolSpecificPeerAccess() = 0;
   virtual std::string name() = 0;
 };
@@ -303,6 +343,14 @@ inline void attachOutOfMemoryObserver(OutOfMemoryObserver observer) {
   return get()->attachOutOfMemoryObserver(observer);
 }
 
+inline void attachAllocatorTraceTracker(AllocatorTraceTracker tracker) {
+  return get()->attachAllocatorTraceTracker(std::move(tracker));
+}
+
+inline std::vector<StreamStats> getStreamStats(int device) {
+  return get()->getStreamStats(device);
+}
+
 inline void notifyCaptureEnded(int device, CaptureId_t graph_id) {
   return get()->notifyCaptureEnded(device, graph_id);
 }
@@ -310,6 +358,30 @@ inline void notifyCaptureEnded(int device, CaptureId_t graph_id) {
 inline void notifyCaptureDestroy(int device, MempoolId_t mempool_id) {
   return get()->notifyCaptureDestroy(device, mempool_id);
 }
+
+// User memory pools; see Note [User memory pools] in CUDACachingAllocator.cpp.
+inline void createUserPool(
+    int device,
+    MempoolId_t mempool_id,
+    size_t memory_limit) {
+  return get()->createUserPool(device, mempool_id, memory_limit);
+}
+
+inline void releaseUserPool(int device, MempoolId_t mempool_id) {
+  return get()->releaseUserPool(device, mempool_id);
+}
+
+inline MempoolId_t beginAllocateToPool(MempoolId_t mempool_id) {
+  return get()->beginAllocateToPool(mempool_id);
+}
+
+inline void endAllocateToPool(MempoolId_t mempool_id) {
+  return get()->endAllocateToPool(mempool_id);
+}
+
+inline UserPoolStats getUserPoolStats(int device, MempoolId_t mempool_id) {
+  return get()->getUserPoolStats(device, mempool_id);
+}
 // Not part of CUDA_ALLOCATOR_BACKEND_INTERFACE
 inline std::shared_ptr<void> getIpcDevPtr(std::string handle) {
   return get()->getIpcDevPtr(handle);
@@ -6,6 +6,7 @@
 #include <c10/util/flat_hash_map.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
 #include <unordered_set>
 #include <vector>
 
@@ -103,6 +104,11 @@ std::vector<void*> ungraphed_ptrs_defer_free_until_no_capture;
 std::vector<size_t> pytorch_used_bytes;
 std::vector<size_t> pytorch_memory_limits;
 
+// The driver reports byte totals for the pool but has no notion of
+// allocation counts, so we track those host-side to keep getDeviceStats'
+// num_alloc/num_free-style fields populated for memory dashboards.
+std::vector<Stat> pytorch_allocation_counts;
+
 // Graph-specific helpers
 
 /**
@@ -269,6 +275,9 @@ inline void free_impl(PtrInfo::iterator& it) {
   }
 
   pytorch_used_bytes[creation_stream.device] -= it->second.size;
+  auto& counts = pytorch_allocation_counts[creation_stream.device];
+  counts.current -= 1;
+  counts.freed += 1;
 
   ptr_info.erase(it);
 }
@@ -385,6 +394,10 @@ void mallocAsync(void** devPtr, int device, size_t size, cudaStream_t stream) {
   inserted.first->second.creation_stream = {stream, device};
 
   pytorch_used_bytes[device] += size;
+  auto& counts = pytorch_allocation_counts[device];
+  counts.current += 1;
+  counts.peak = std::max(counts.current, counts.peak);
+  counts.allocated += 1;
 }
 
 } // anonymous namespace
@@ -425,6 +438,7 @@ struct CudaMallocAsyncAllocator : public CUDAAllocator {
       dummy_unifying_free_streams.resize(dev_count);
       pytorch_used_bytes.resize(dev_count);
       pytorch_memory_limits.resize(dev_count);
+      pytorch_allocation_counts.resize(dev_count);
       return true;
     }(dev_count);
     (void)called;
@@ -621,6 +635,20 @@ struct CudaMallocAsyncAllocator : public CUDAAllocator {
         "If you need it, please file an issue describing your use case.");
   }
 
+  void attachAllocatorTraceTracker(AllocatorTraceTracker tracker) override {
+    TORCH_CHECK(
+        false,
+        "cudaMallocAsync does not yet support attachAllocatorTraceTracker. "
+        "If you need it, please file an issue describing your use case.");
+  }
+
+  std::vector<StreamStats> getStreamStats(int device) override {
+    TORCH_CHECK(
+        false,
+        "cudaMallocAsync does not yet support getStreamStats. "
+        "If you need it, please file an issue describing your use case.");
+  }
+
   // Collects stats for device.
   // If device hasn't been used yet, returns 0s without creating a context.
   DeviceStats getDeviceStats(int device) override {
@@ -684,18 +712,37 @@ struct CudaMallocAsyncAllocator : public CUDAAllocator {
     stats.reserved_bytes[static_cast<size_t>(StatType::AGGREGATE)].peak =
         reserved_mem_peak;
 
+    // Allocation counts are tracked host-side; the driver only reports bytes.
+    stats.allocation[static_cast<size_t>(StatType::AGGREGATE)] =
+        pytorch_allocation_counts[device];
+    stats.active[static_cast<size_t>(StatType::AGGREGATE)] =
+        pytorch_allocation_counts[device];
+
     return stats;
   }
 
   void resetAccumulatedStats(int device) override {
     assertValidDevice(device);
+    std::lock_guard<std::mutex> lk(general_mutex);
+    // The driver's byte counters have no accumulated (allocated/freed)
+    // component; only the host-side allocation counts can be reset here.
+    pytorch_allocation_counts[device].allocated = 0;
+    pytorch_allocation_counts[device].freed = 0;
     TORCH_WARN_ONCE(
-        "For backend:cudaMallocAsync, resetAccumulatedStats has no effect.");
+        "For backend:cudaMallocAsync, resetAccumulatedStats resets only "
+        "allocation counts; byte stats come from the driver and accumulate "
+        "nothing.");
   }
 
   void resetPeakStats(int device) override {
     assertValidDevice(device);
 
+    {
+      std::lock_guard<std::mutex> lk(general_mutex);
+      pytorch_allocation_counts[device].peak =
+          pytorch_allocation_counts[device].current;
+    }
+
     CUDAGuard g(device);
     cudaMemPool_t mempool;
     C10_CUDA_CHECK(cudaDeviceGetDefaultMemPool(&mempool, device));
@@ -712,14 +759,36 @@ struct CudaMallocAsyncAllocator : public CUDAAllocator {
   }
 
   SnapshotInfo snapshot() override {
-    TORCH_CHECK(
-        false,
-        "Calling snapshot with backend:cudaMallocAsync is not meaningful. "
-        "(For backend:native, snapshot returns a detailed summary of all "
-        "blocks tracked by the allocator, but the cudaMallocAsync backend "
-        "does not track individual blocks.)");
-    // Alternative: TORCH_WARN
-    return {};
+    // The driver owns the pool's segments, so unlike backend:native we can't
+    // report reserved-but-unused regions or per-segment block layouts. What we
+    // can report is every outstanding allocation, each as its own fully
+    // allocated single-block "segment". That keeps torch.cuda.memory_snapshot
+    // (and dashboards built on it) working, just without free-block detail.
+    std::lock_guard<std::mutex> lk(general_mutex);
+
+    // Matches kSmallSize in CUDACachingAllocator.cpp: the native allocator
+    // serves allocations of up to 1 MiB from its small pool.
+    constexpr size_t kSmallSize = 1048576;
+
+    SnapshotInfo result;
+    result.segments.reserve(ptr_info.size());
+    for (const auto& it : ptr_info) {
+      SegmentInfo& segment_info = result.segments.emplace_back();
+      segment_info.device = it.second.creation_stream.device;
+      segment_info.address = reinterpret_cast<int64_t>(it.first);
+      segment_info.total_size = it.second.size;
+      segment_info.allocated_size = it.second.size;
+      segment_info.active_size = it.second.size;
+      segment_info.stream = it.second.creation_stream.stream;
+      segment_info.is_large = (it.second.size > kSmallSize);
+
+      BlockInfo& block_info = segment_info.blocks.emplace_back();
+      block_info.size = it.second.size;
+      block_info.allocated = true;
+      block_info.active = true;
+    }
+    result.device_traces.resize(device_count);
+    return result;
   }
 
   // CUDAGraph interactions
@@ -801,6 +870,42 @@ struct CudaMallocAsyncAllocator : public CUDAAllocator {
     //    but stale ptrs will not permanently leak into ptr_info.
   }
 
+  void createUserPool(int device, MempoolId_t mempool_id, size_t memory_limit)
+      override {
+    TORCH_CHECK(
+        false,
+        "cudaMallocAsync does not yet support user memory pools. "
+        "If you need them, please file an issue describing your use case.");
+  }
+
+  void releaseUserPool(int device, MempoolId_t mempool_id) override {
+    TORCH_CHECK(
+        false,
+        "cudaMallocAsync does not yet support user memory pools. "
+        "If you need them, please file an issue describing your use case.");
+  }
+
+  MempoolId_t beginAllocateToPool(MempoolId_t mempool_id) override {
+    TORCH_CHECK(
+        false,
+        "cudaMallocAsync does not yet support user memory pools. "
+        "If you need them, please file an issue describing your use case.");
+  }
+
+  void endAllocateToPool(MempoolId_t mempool_id) override {
+    TORCH_CHECK(
+        false,
+        "cudaMallocAsync does not yet support user memory pools. "
+        "If you need them, please file an issue describing your use case.");
+  }
+
+  UserPoolStats getUserPoolStats(int device, MempoolId_t mempool_id) override {
+    TORCH_CHECK(
+        false,
+        "cudaMallocAsync does not yet support user memory pools. "
+        "If you need them, please file an issue describing your use case.");
+  }
+
   void* raw_alloc(size_t nbytes) override {
     if (nbytes == 0) {
       return nullptr;
@@ -0,0 +1,38 @@
+#if defined(PYTORCH_C10_DRIVER_API_SUPPORTED)
+#include <c10/cuda/driver_api.h>
+#include <c10/util/Exception.h>
+#include <dlfcn.h>
+
+namespace c10 {
+namespace cuda {
+
+namespace {
+
+DriverAPI create_driver_api() {
+  // libcuda must already be loaded by the CUDA runtime at this point, so
+  // RTLD_NOLOAD only bumps its refcount; it never pulls the driver in on a
+  // machine that doesn't have one.
+  void* handle = dlopen("libcuda.so.1", RTLD_LAZY | RTLD_NOLOAD);
+  TORCH_INTERNAL_ASSERT(handle, "Can't open libcuda.so.1: ", dlerror());
+  DriverAPI r{};
+
+#define LOOKUP_LIBCUDA_ENTRY(name)                     \
+  r.name##_ = ((decltype(&name))dlsym(handle, #name)); \
+  TORCH_INTERNAL_ASSERT(r.name##_, "Can't find ", #name, ": ", dlerror())
+  C10_LIBCUDA_DRIVER_API(LOOKUP_LIBCUDA_ENTRY)
+#undef LOOKUP_LIBCUDA_ENTRY
+
+  return r;
+}
+
+} // namespace
+
+DriverAPI* DriverAPI::get() {
+  static DriverAPI singleton = create_driver_api();
+  return &singleton;
+}
+
+} // namespace cuda
+} // namespace c10
+
+#endif
@@ -0,0 +1,112 @@
+#include <c10/util/SmallFunction.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace {
+
+TEST(SmallFunctionTest, DefaultConstructedIsEmpty) {
+  c10::SmallFunction<void()> fn;
+  EXPECT_FALSE(static_cast<bool>(fn));
+  EXPECT_TRUE(fn == nullptr);
+  EXPECT_TRUE(nullptr == fn);
+  EXPECT_FALSE(fn != nullptr);
+
+  c10::SmallFunction<void()> from_null(nullptr);
+  EXPECT_FALSE(static_cast<bool>(from_null));
+}
+
+TEST(SmallFunctionTest, InvokesLambda) {
+  int calls = 0;
+  c10::SmallFunction<void()> fn([&calls]() { ++calls; });
+  EXPECT_TRUE(static_cast<bool>(fn));
+  fn();
+  fn();
+  EXPECT_EQ(calls, 2);
+}
+
+TEST(SmallFunctionTest, ForwardsArgumentsAndReturnValue) {
+  c10::SmallFunction<int(int, int)> add([](int a, int b) { return a + b; });
+  EXPECT_EQ(add(2, 3), 5);
+
+  // Move-only arguments must be forwarded, not copied.
+  c10::SmallFunction<int(std::unique_ptr<int>)> deref(
+      [](std::unique_ptr<int> p) { return *p; });
+  EXPECT_EQ(deref(std::make_unique<int>(42)), 42);
+}
+
+TEST(SmallFunctionTest, OwnsMoveOnlyCapture) {
+  // std::function cannot hold this closure at all; SmallFunction is
+  // move-only so it can.
+  auto p = std::make_unique<int>(7);
+  c10::SmallFunction<int(int)> fn(
+      [p = std::move(p)](int offset) { return *p + offset; });
+  EXPECT_EQ(fn(1), 8);
+  EXPECT_EQ(fn(3), 10);
+}
+
+TEST(SmallFunctionTest, MoveTransfersTarget) {
+  int calls = 0;
+  c10::SmallFunction<void()> a([&calls]() { ++calls; });
+  c10::SmallFunction<void()> b(std::move(a));
+  EXPECT_FALSE(static_cast<bool>(a));
+  EXPECT_TRUE(static_cast<bool>(b));
+  b();
+  EXPECT_EQ(calls, 1);
+
+  c10::SmallFunction<void()> c;
+  c = std::move(b);
+  EXPECT_FALSE(static_cast<bool>(b));
+  c();
+  EXPECT_EQ(calls, 2);
+}
+
+TEST(SmallFunctionTest, MoveAssignmentDestroysPreviousTarget) {
+  auto counter = std::make_shared<int>(0);
+  c10::SmallFunction<void()> fn([counter]() {});
+  EXPECT_EQ(counter.use_count(), 2);
+
+  fn = c10::SmallFunction<void()>([]() {});
+  EXPECT_EQ(counter.use_count(), 1);
+
+  fn = nullptr;
+  EXPECT_FALSE(static_cast<bool>(fn));
+}
+
+TEST(SmallFunctionTest, HeapFallbackForLargeCapture) {
+  // A 128-byte capture exceeds the 64-byte inline buffer, so this closure
+  // exercises the heap-allocated path, including its move and destroy.
+  std::array<int, 32> payload;
+  for (size_t i = 0; i < payload.size(); ++i) {
+    payload[i] = static_cast<int>(i);
+  }
+  c10::SmallFunction<int(size_t)> fn(
+      [payload](size_t i) { return payload[i]; });
+  EXPECT_EQ(fn(0), 0);
+  EXPECT_EQ(fn(31), 31);
+
+  c10::SmallFunction<int(size_t)> moved(std::move(fn));
+  EXPECT_FALSE(static_cast<bool>(fn));
+  EXPECT_EQ(moved(16), 16);
+}
+
+TEST(SmallFunctionTest, ConstructsFromStdFunction) {
+  std::function<int()> std_fn = []() { return 11; };
+  c10::SmallFunction<int()> fn(std::move(std_fn));
+  EXPECT_EQ(fn(), 11);
+}
+
+TEST(SmallFunctionTest, SelfMoveAssignmentIsNoop) {
+  int calls = 0;
+  c10::SmallFunction<void()> fn([&calls]() { ++calls; });
+  auto& ref = fn;
+  fn = std::move(ref);
+  EXPECT_TRUE(static_cast<bool>(fn));
+  fn();
+  EXPECT_EQ(calls, 1);
+}
+
+} // namespace
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <c10/macros/Macros.h>
+#include <c10/util/C++17.h>
+#include <c10/util/Exception.h>
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace c10 {
+
+/// A move-only, type-erasing owner of a callable, built for hot paths where
+/// std::function's small-buffer limit (typically 16 bytes) forces a heap
+/// allocation per capture. SmallFunction stores callables of up to 64 bytes
+/// inline; only callables that are larger, over-aligned, or lack a noexcept
+/// move constructor fall back to the heap. Dispatch is a single indirect
+/// call through a stored function pointer -- there is no empty-target check
+/// that can throw (invoking an empty SmallFunction is a debug assert, not a
+/// std::bad_function_call).
+///
+/// Unlike std::function, SmallFunction is move-only, so it can own
+/// non-copyable captures (e.g. a std::promise) and its move is always
+/// noexcept. Use c10::function_ref instead when the callable is not used
+/// after the callee returns; use SmallFunction when it must be stored, e.g.
+/// in a task queue.
+template <typename Fn>
+class SmallFunction;
+
+template <typename Ret, typename... Params>
+class SmallFunction<Ret(Params...)> {
+  static constexpr size_t kInlineSize = 64;
+
+  enum class Op { Move, Destroy };
+
+  // `storage` holds either the callable itself (inline case) or a pointer to
+  // a heap-allocated callable. Which one is baked into the manager/invoker
+  // function pointers, so no runtime flag is needed.
+  template <typename Callable>
+  static constexpr bool stored_inline() {
+    return sizeof(Callable) <= kInlineSize &&
+        alignof(Callable) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible<Callable>::value;
+  }
+
+  template <typename Callable, bool Inline>
+  struct Manager;
+
+  template <typename Callable>
+  struct Manager<Callable, true> {
+    static void create(void* storage, Callable&& callable) {
+      ::new (storage) Callable(std::move(callable));
+    }
+    static Ret invoke(void* storage, Params&&... params) {
+      return (*static_cast<Callable*>(storage))(
+          std::forward<Params>(params)...);
+    }
+    static void manage(Op op, void* self, void* other) noexcept {
+      if (op == Op::Move) {
+        ::new (self) Callable(std::move(*static_cast<Callable*>(other)));
+        static_cast<Callable*>(other)->~Callable();
+      } else {
+        static_cast<Callable*>(self)->~Callable();
+      }
+    }
+  };
+
+  template <typename Callable>
+  struct Manager<Callable, false> {
+    static Callable*& ptr(void* storage) {
+      return *static_cast<Callable**>(storage);
+    }
+    static void create(void* storage, Callable&& callable) {
+      ptr(storage) = new Callable(std::move(callable));
+    }
+    static Ret invoke(void* storage, Params&&... params) {
+      return (*ptr(storage))(std::forward<Params>(params)...);
+    }
+    static void manage(Op op, void* self, void* other) noexcept {
+      if (op == Op::Move) {
+        ptr(self) = ptr(other);
+      } else {
+        delete ptr(self);
+      }
+    }
+  };
+
+ public:
+  SmallFunction() = default;
+  /* implicit */ SmallFunction(std::nullptr_t) {}
+
+  template <
+      typename Callable,
+      typename std::enable_if<
+          !std::is_same<
+              typename std::decay<Callable>::type,
+              SmallFunction>::value,
+          int>::type = 0,
+      typename std::enable_if<
+          std::is_void<Ret>::value ||
+              std::is_convertible<
+                  c10::invoke_result_t<
+                      typename std::decay<Callable>::type,
+                      Params...>,
+                  Ret>::value,
+          int>::type = 0>
+  /* implicit */ SmallFunction(Callable&& callable) {
+    using C = typename std::decay<Callable>::type;
+    using M = Manager<C, stored_inline<C>()>;
+    M::create(&storage_, C(std::forward<Callable>(callable)));
+    invoke_ = &M::invoke;
+    manage_ = &M::manage;
+  }
+
+  SmallFunction(SmallFunction&& other) noexcept {
+    *this = std::move(other);
+  }
+
+  SmallFunction& operator=(SmallFunction&& other) noexcept {
+    if (this == &other) {
+      return *this;
+    }
+    reset();
+    if (other.manage_) {
+      other.manage_(Op::Move, &storage_, &other.storage_);
+      invoke_ = other.invoke_;
+      manage_ = other.manage_;
+      other.invoke_ = nullptr;
+      other.manage_ = nullptr;
+    }
+    return *this;
+  }
+
+  SmallFunction& operator=(std::nullptr_t) {
+    reset();
+    return *this;
+  }
+
+  SmallFunction(const SmallFunction&) = delete;
+  SmallFunction& operator=(const SmallFunction&) = delete;
+
+  ~SmallFunction() {
+    reset();
+  }
+
+  Ret operator()(Params... params) const {
+    TORCH_INTERNAL_ASSERT_DEBUG_ONLY(invoke_ != nullptr);
+    return invoke_(&storage_, std::forward<Params>(params)...);
+  }
+
+  explicit operator bool() const {
+    return invoke_ != nullptr;
+  }
+
+ private:
+  void reset() {
+    if (manage_) {
+      manage_(Op::Destroy, &storage_, nullptr);
+      invoke_ = nullptr;
+      manage_ = nullptr;
+    }
+  }
+
+  Ret (*invoke_)(void*, Params&&...) = nullptr;
+  void (*manage_)(Op, void*, void*) noexcept = nullptr;
+  mutable typename std::aligned_storage<kInlineSize, alignof(std::max_align_t)>::
+      type storage_;
+};
+
+template <typename Fn>
+bool operator==(const SmallFunction<Fn>& fn, std::nullptr_t) {
+  return !fn;
+}
+
+template <typename Fn>
+bool operator==(std::nullptr_t, const SmallFunction<Fn>& fn) {
+  return !fn;
+}
+
+template <typename Fn>
+bool operator!=(const SmallFunction<Fn>& fn, std::nullptr_t) {
+  return static_cast<bool>(fn);
+}
+
+template <typename Fn>
+bool operator!=(std::nullptr_t, const SmallFunction<Fn>& fn) {
+  return static_cast<bool>(fn);
+}
+
+} // namespace c10
@@ -190,10 +190,24 @@ TTarget* assign_ptr_(TTarget* rhs) {
   }
 }
 
-// Increment needs to be acquire-release to make use_count() and
-// unique() reliable.
+// Note [Relaxed refcount increment]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The increment can be relaxed: a thread may only copy an intrusive_ptr it
+// already owns, so incrementing never publishes data to another thread. The
+// synchronizes-with edge that matters is between the final decrement and the
+// destructor, which atomic_refcount_decrement's acquire-release provides;
+// use_count()/unique() stay reliable because they read with acquire and all
+// modifications of refcount_ share a single coherence order regardless of the
+// ordering used to write them. This mirrors what libstdc++ and boost do for
+// shared_ptr, and on weakly-ordered architectures it drops a fence from every
+// incref. (A fully non-atomic "thread-confined" mode would not be sound here:
+// TensorImpls and StorageImpls routinely outlive any single-threaded region --
+// e.g. weights shared between Static Runtime instances running on different
+// threads -- so no thread-local flag can prove a given refcount is private.
+// Code that wants to avoid refcount traffic entirely should borrow instead:
+// see ExclusivelyOwned, MaybeOwned, and unsafe_adapt_non_heap_allocated.)
 inline size_t atomic_refcount_increment(std::atomic<size_t>& refcount) {
-  return refcount.fetch_add(1, std::memory_order_acq_rel) + 1;
+  return refcount.fetch_add(1, std::memory_order_relaxed) + 1;
 }
 
 // weak_use_count() is only used for testing, so we don't need it to
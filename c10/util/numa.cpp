@@ -103,6 +103,24 @@ int GetCurrentNUMANode() {
   return n;
 }
 
+std::vector<int> GetNUMANodeCPUs(int numa_node_id) {
+  std::vector<int> cpus;
+  if (!IsNUMAEnabled() || numa_node_id < 0 ||
+      numa_node_id > numa_max_node()) {
+    return cpus;
+  }
+  auto* mask = numa_allocate_cpumask();
+  if (numa_node_to_cpus(numa_node_id, mask) == 0) {
+    for (unsigned int cpu = 0; cpu < mask->size; ++cpu) {
+      if (numa_bitmask_isbitset(mask, cpu)) {
+        cpus.push_back(static_cast<int>(cpu));
+      }
+    }
+  }
+  numa_bitmask_free(mask);
+  return cpus;
+}
+
 #else // C10_ENABLE_NUMA
 
 bool IsNUMAEnabled() {
@@ -125,6 +143,10 @@ int GetCurrentNUMANode() {
   return -1;
 }
 
+std::vector<int> GetNUMANodeCPUs(int numa_node_id) {
+  return {};
+}
+
 #endif // C10_NUMA_ENABLED
 
 } // namespace c10
@@ -3,6 +3,8 @@
 #include <c10/util/Logging.h>
 #include <c10/util/Optional.h>
 
+#include <vector>
+
 C10_DECLARE_bool(caffe2_cpu_numa_enabled);
 
 namespace c10 {
@@ -37,4 +39,10 @@ C10_API void NUMAMove(void* ptr, size_t size, int numa_node_id);
  */
 C10_API int GetCurrentNUMANode();
 
+/**
+ * Get the ids of the CPUs belonging to a given NUMA node. Returns an empty
+ * vector when NUMA is not enabled or the node id is out of range.
+ */
+C10_API std::vector<int> GetNUMANodeCPUs(int numa_node_id);
+
 } // namespace c10
@@ -1,12 +1,170 @@
 #include "miniz.h"
-#include <iostream>
 
 #include "caffe2/serialize/crc_alt.h"
 
+#if (defined(__x86_64__) || defined(_M_X64)) && !defined(_MSC_VER)
+#define CRC32_CAN_USE_PCLMUL 1
+#include <immintrin.h>
+#include <wmmintrin.h>
+#endif
+
+namespace {
+
+// See Note [Checksum elision] in inline_container.cc
+thread_local bool crc32_elided = false;
+
+#ifdef CRC32_CAN_USE_PCLMUL
+
+// CRC-32 by 64-byte folding with PCLMULQDQ, after "Fast CRC Computation
+// for Generic Polynomials Using PCLMULQDQ Instruction" (Intel, 2009).
+// Requires len >= 64 and len % 16 == 0; the caller runs the table-based
+// implementation on the remainder. `crc` is pre-complemented and the
+// return value is too.
+__attribute__((target("pclmul,sse4.1"))) uint32_t crc32_pclmul(
+    const uint8_t* buf,
+    size_t len,
+    uint32_t crc) {
+  __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+  x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x00));
+  x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x10));
+  x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x20));
+  x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x30));
+
+  x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+
+  // {k1, k2}: k1 in the low lane (imm 0x00 selects it), k2 in the high
+  // lane (imm 0x11), matching zlib's crc32_simd.c constant arrays.
+  x0 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+
+  buf += 64;
+  len -= 64;
+
+  while (len >= 64) {
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+    x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+    x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+    x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+    y5 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x00));
+    y6 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x10));
+    y7 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x20));
+    y8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x30));
+
+    x1 = _mm_xor_si128(x1, x5);
+    x2 = _mm_xor_si128(x2, x6);
+    x3 = _mm_xor_si128(x3, x7);
+    x4 = _mm_xor_si128(x4, x8);
+
+    x1 = _mm_xor_si128(x1, y5);
+    x2 = _mm_xor_si128(x2, y6);
+    x3 = _mm_xor_si128(x3, y7);
+    x4 = _mm_xor_si128(x4, y8);
+
+    buf += 64;
+    len -= 64;
+  }
+
+  // fold the four accumulators into one
+  // {k3, k4}
+  x0 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+
+  x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+  x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+  x1 = _mm_xor_si128(x1, x2);
+  x1 = _mm_xor_si128(x1, x5);
+
+  x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+  x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+  x1 = _mm_xor_si128(x1, x3);
+  x1 = _mm_xor_si128(x1, x5);
+
+  x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+  x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+  x1 = _mm_xor_si128(x1, x4);
+  x1 = _mm_xor_si128(x1, x5);
+
+  while (len >= 16) {
+    y5 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf));
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(x1, y5);
+    x1 = _mm_xor_si128(x1, x5);
+    buf += 16;
+    len -= 16;
+  }
+
+  // fold 128 bits down to 64
+  x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+  x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+  x1 = _mm_srli_si128(x1, 8);
+  x1 = _mm_xor_si128(x1, x2);
+
+  // k5
+  x0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124);
+
+  x2 = _mm_srli_si128(x1, 4);
+  x1 = _mm_and_si128(x1, x3);
+  x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+
+  // Barrett reduction to 32 bits: {P', mu} with P' low (imm 0x00) and mu
+  // high (imm 0x10)
+  x0 = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+
+  x2 = _mm_and_si128(x1, x3);
+  x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+  x2 = _mm_and_si128(x2, x3);
+  x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+
+  return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+bool pclmul_supported() {
+  static const bool supported =
+      __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+  return supported;
+}
+
+#endif // CRC32_CAN_USE_PCLMUL
+
+} // namespace
+
+namespace caffe2 {
+namespace serialize {
+namespace detail {
+
+bool setCrc32Elided(bool elided) {
+  bool prev = crc32_elided;
+  crc32_elided = elided;
+  return prev;
+}
+
+} // namespace detail
+} // namespace serialize
+} // namespace caffe2
+
 extern "C" {
 // See: miniz.h
 #if defined(USE_EXTERNAL_MZCRC)
 mz_ulong mz_crc32(mz_ulong crc, const mz_uint8* ptr, size_t buf_len) {
+  if (crc32_elided) {
+    return 0;
+  }
+#ifdef CRC32_CAN_USE_PCLMUL
+  if (buf_len >= 64 && pclmul_supported()) {
+    size_t chunk = buf_len & ~static_cast<size_t>(15);
+    crc = ~crc32_pclmul(ptr, chunk, ~static_cast<uint32_t>(crc));
+    ptr += chunk;
+    buf_len -= chunk;
+  }
+#endif
   auto z = crc32_fast(ptr, buf_len, crc);
   return z;
 };
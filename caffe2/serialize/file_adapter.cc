@@ -5,6 +5,10 @@
 #include <string>
 #include "caffe2/core/common.h"
 
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
 namespace caffe2 {
 namespace serialize {
 
@@ -62,6 +66,7 @@ size_t FileAdapter::read(uint64_t pos, void* buf, size_t n, const char* what)
   // user requested to read beyond the end of the file, we clamp to just the
   // end of the file.
   n = std::min(static_cast<size_t>(size_ - pos), n);
+#if defined(_WIN32)
 #if defined(_MSC_VER)
   const int fseek_ret = _fseeki64(file_.fp_, pos, SEEK_SET);
 #else
@@ -74,6 +79,41 @@ size_t FileAdapter::read(uint64_t pos, void* buf, size_t n, const char* what)
     ", context: ",
     what);
   return fread(buf, 1, n, file_.fp_);
+#else
+  // Positioned reads leave no shared file-offset state behind, which is
+  // what makes concurrent reads safe (see isThreadSafe); they also save a
+  // seek syscall per read.
+  const int fd = fileno(file_.fp_);
+  size_t total_read = 0;
+  auto* dst = static_cast<char*>(buf);
+  while (total_read < n) {
+    const ssize_t read_ret = pread(
+        fd, dst + total_read, n - total_read, static_cast<off_t>(pos + total_read));
+    if (read_ret == 0) {
+      break;
+    }
+    if (read_ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      AT_ERROR(
+          "pread failed because of errno ",
+          errno,
+          ", context: ",
+          what);
+    }
+    total_read += static_cast<size_t>(read_ret);
+  }
+  return total_read;
+#endif
+}
+
+bool FileAdapter::isThreadSafe() const {
+#if defined(_WIN32)
+  return false;
+#else
+  return true;
+#endif
 }
 
 FileAdapter::~FileAdapter() = default;
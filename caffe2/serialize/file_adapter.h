@@ -17,6 +17,7 @@ class TORCH_API FileAdapter final : public ReadAdapterInterface {
   size_t size() const override;
   size_t read(uint64_t pos, void* buf, size_t n, const char* what = "")
       const override;
+  bool isThreadSafe() const override;
   ~FileAdapter() override;
 
  private:
@@ -22,6 +22,10 @@ class MemoryReadAdapter final : public caffe2::serialize::ReadAdapterInterface {
     return n;
   }
 
+  bool isThreadSafe() const override {
+    return true;
+  }
+
  private:
   const void* data_;
   off_t size_;
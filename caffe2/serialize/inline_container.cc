@@ -4,11 +4,18 @@
 #include <istream>
 #include <ostream>
 #include <fstream>
+#include <sstream>
 #include <algorithm>
 #include <sys/stat.h>
 #include <sys/types.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 
+#include <ATen/MapAllocator.h>
 #include <c10/core/Allocator.h>
 #include <c10/core/CPUAllocator.h>
 #include <c10/core/Backend.h>
@@ -131,6 +138,19 @@ void PyTorchStreamReader::init() {
   archive_name_ = buf.substr(0, pos);
   archive_name_plus_slash_ = archive_name_ + "/";
 
+  // Archives written with setChecksumsEnabled(false) carry a marker
+  // record and zero CRCs; detect it before the first extraction, since
+  // the version read below would otherwise fail its CRC check. See
+  // Note [Checksum elision].
+  std::string elided_marker =
+      archive_name_plus_slash_ + detail::kChecksumsElidedRecordName;
+  mz_zip_reader_locate_file(ar_.get(), elided_marker.c_str(), nullptr, 0);
+  if (mz_zip_get_last_error(ar_.get()) == MZ_ZIP_NO_ERROR) {
+    crc_checks_disabled_ = true;
+  } else {
+    mz_zip_clear_last_error(ar_.get());
+  }
+
   // version check
   at::DataPtr version_ptr;
   // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
@@ -192,6 +212,7 @@ size_t getPadding(
     size_t cursor,
     size_t filename_size,
     size_t size,
+    uint64_t alignment,
     std::string& padding_buf) {
   size_t start = cursor + MZ_ZIP_LOCAL_DIR_HEADER_SIZE + filename_size +
       sizeof(mz_uint16) * 2;
@@ -204,8 +225,8 @@ size_t getPadding(
       start += sizeof(mz_uint64);
     }
   }
-  size_t mod = start % kFieldAlignment;
-  size_t next_offset = (mod == 0) ? start : (start + kFieldAlignment - mod);
+  size_t mod = start % alignment;
+  size_t next_offset = (mod == 0) ? start : (start + alignment - mod);
   size_t padding_size = next_offset - start;
   size_t padding_size_plus_fbxx = padding_size + 4;
   if (padding_buf.size() < padding_size_plus_fbxx) {
@@ -221,6 +242,9 @@ size_t getPadding(
 }
 
 bool PyTorchStreamReader::hasRecord(const std::string& name) {
+  if (delta_records_.count(name) != 0) {
+    return true;
+  }
   std::lock_guard<std::mutex> guard(reader_lock_);
   std::string ss = archive_name_plus_slash_ + name;
   mz_zip_reader_locate_file(ar_.get(), ss.c_str(), nullptr, 0);
@@ -258,6 +282,10 @@ std::vector<std::string> PyTorchStreamReader::getAllRecords() {
     // NOLINTNEXTLINE(modernize-use-emplace)
     out.push_back(buf + archive_name_plus_slash_.size());
   }
+  // records resolved from the base archive; see Note [Delta checkpoints]
+  for (const auto& entry : delta_records_) {
+    out.push_back(entry.first);
+  }
   return out;
 }
 
@@ -273,15 +301,92 @@ size_t PyTorchStreamReader::getRecordID(const std::string& name) {
   return result;
 }
 
+bool PyTorchStreamReader::tryEnableRecordMmap(const std::string& file_name) {
+  std::lock_guard<std::mutex> guard(reader_lock_);
+  if (mmap_region_) {
+    return true;
+  }
+  size_t mapped_size = 0;
+  at::DataPtr region;
+  try {
+    // flags == 0 opens the file read-only and maps it MAP_PRIVATE, so any
+    // in-place mutation of a tensor backed by the mapping dirties private
+    // copies of the affected pages only.
+    region = at::MapAllocator::makeDataPtr(
+        file_name, /*flags=*/0, /*size=*/0, &mapped_size);
+  } catch (const c10::Error&) {
+    return false;
+  }
+  if (!region || mapped_size < in_->size()) {
+    return false;
+  }
+  mmap_region_ = std::make_shared<at::DataPtr>(std::move(region));
+  return true;
+}
+
 // return dataptr, size
 std::tuple<at::DataPtr, size_t> PyTorchStreamReader::getRecord(const std::string& name) {
-  std::lock_guard<std::mutex> guard(reader_lock_);
+  auto delta_it = delta_records_.find(name);
+  if (delta_it != delta_records_.end()) {
+    // resolve against the base archive; see Note [Delta checkpoints]
+    uint32_t base_crc32 = 0;
+    uint64_t base_size = 0;
+    std::tie(base_crc32, base_size) = delta_base_->getRecordChecksum(name);
+    TORCH_CHECK(
+        base_crc32 == delta_it->second.first &&
+            base_size == delta_it->second.second,
+        "base archive record '",
+        name,
+        "' does not match the content hash recorded in the delta manifest; ",
+        "was the base checkpoint modified or the wrong base supplied?");
+    return delta_base_->getRecord(name);
+  }
+  std::unique_lock<std::mutex> guard(reader_lock_);
   size_t key = getRecordID(name);
   mz_zip_archive_file_stat stat;
   mz_zip_reader_file_stat(ar_.get(), key, &stat);
   valid("retrieving file meta-data for ", name.c_str());
+  if (mmap_region_ && stat.m_method == 0) {
+    // Stored (uncompressed) record with an active mapping: hand out a
+    // pointer into the copy-on-write region. The DataPtr shares ownership
+    // of the mapping so it stays valid after this reader is destroyed.
+    size_t offset = getRecordOffsetUnlocked(stat.m_local_header_ofs);
+    valid("reading file header for ", name.c_str());
+    void* src = static_cast<uint8_t*>(mmap_region_->get()) + offset;
+    at::DataPtr retval(
+        src,
+        new std::shared_ptr<at::DataPtr>(mmap_region_),
+        [](void* ctx) {
+          delete static_cast<std::shared_ptr<at::DataPtr>*>(ctx);
+        },
+        c10::DeviceType::CPU);
+    return std::make_tuple(std::move(retval), stat.m_uncomp_size);
+  }
+  if (stat.m_method == 0 && in_->isThreadSafe()) {
+    // Stored (uncompressed) record: the bytes can be copied straight out of
+    // the underlying file without going through miniz, so drop the archive
+    // lock for the bulk read. With a thread-safe adapter this lets record
+    // reads issued from different threads overlap (see Note [Pipelined
+    // storage reads] in torch/csrc/jit/serialization/import_read.cpp).
+    size_t offset = getRecordOffsetUnlocked(stat.m_local_header_ofs);
+    valid("reading file header for ", name.c_str());
+    size_t size = stat.m_uncomp_size;
+    guard.unlock();
+    at::DataPtr retval = c10::GetCPUAllocator()->allocate(size);
+    size_t read_bytes = in_->read(offset, retval.get(), size, "reading record");
+    if (read_bytes != size) {
+      CAFFE_THROW("short read of record ", name, ": file may be corrupt");
+    }
+    return std::make_tuple(std::move(retval), size);
+  }
   at::DataPtr retval = c10::GetCPUAllocator()->allocate(stat.m_uncomp_size);
   mz_zip_reader_extract_to_mem(ar_.get(), key, retval.get(), stat.m_uncomp_size, 0);
+  if (crc_checks_disabled_ &&
+      mz_zip_get_last_error(ar_.get()) == MZ_ZIP_CRC_CHECK_FAILED) {
+    // the CRC comparison is the last step of extraction, so the output
+    // buffer is already fully written; see Note [Checksum elision]
+    mz_zip_clear_last_error(ar_.get());
+  }
   valid("reading file ", name.c_str());
 
   return std::make_tuple(std::move(retval), stat.m_uncomp_size);
@@ -291,21 +396,151 @@ static int64_t read_le_16(uint8_t* buf) {
   return buf[0] + (buf[1] << 8);
 }
 
-size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
-  std::lock_guard<std::mutex> guard(reader_lock_);
-  mz_zip_archive_file_stat stat;
-  mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
-  valid("retrieving file meta-data for ", name.c_str());
+size_t PyTorchStreamReader::getRecordOffsetUnlocked(uint64_t local_header_ofs) {
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
   uint8_t local_header[MZ_ZIP_LOCAL_DIR_HEADER_SIZE];
   in_->read(
-      stat.m_local_header_ofs,
+      local_header_ofs,
       local_header,
       MZ_ZIP_LOCAL_DIR_HEADER_SIZE,
       "reading file header");
   size_t filename_len = read_le_16(local_header + MZ_ZIP_LDH_FILENAME_LEN_OFS);
   size_t extra_len = read_le_16(local_header + MZ_ZIP_LDH_EXTRA_LEN_OFS);
-  return stat.m_local_header_ofs + MZ_ZIP_LOCAL_DIR_HEADER_SIZE + filename_len + extra_len;
+  return local_header_ofs + MZ_ZIP_LOCAL_DIR_HEADER_SIZE + filename_len + extra_len;
+}
+
+size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
+  std::lock_guard<std::mutex> guard(reader_lock_);
+  mz_zip_archive_file_stat stat;
+  mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
+  valid("retrieving file meta-data for ", name.c_str());
+  return getRecordOffsetUnlocked(stat.m_local_header_ofs);
+}
+
+void PyTorchStreamReader::prefetch(const std::vector<std::string>& names) {
+  std::vector<std::pair<size_t, size_t>> ranges; // (offset, size) on disk
+  std::vector<std::string> base_names;
+  {
+    std::lock_guard<std::mutex> guard(reader_lock_);
+    ranges.reserve(names.size());
+    for (const auto& name : names) {
+      if (delta_records_.count(name) != 0) {
+        // resolved from the base archive; see Note [Delta checkpoints]
+        base_names.push_back(name);
+        continue;
+      }
+      mz_zip_archive_file_stat stat;
+      mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
+      valid("retrieving file meta-data for ", name.c_str());
+      ranges.emplace_back(
+          getRecordOffsetUnlocked(stat.m_local_header_ofs),
+          static_cast<size_t>(stat.m_comp_size));
+    }
+    // sequential file order regardless of the order keys were given in
+    std::sort(ranges.begin(), ranges.end());
+#ifndef _WIN32
+    if (mmap_region_) {
+      const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+      char* base = static_cast<char*>(mmap_region_->get());
+      for (const auto& range : ranges) {
+        size_t start = range.first - (range.first % page_size);
+        madvise(
+            base + start, range.second + (range.first - start), MADV_WILLNEED);
+      }
+      ranges.clear();
+    }
+#endif
+    if (!ranges.empty()) {
+      // no mapping: warm the OS page cache with batched sequential reads
+      std::vector<char> scratch(1 << 20);
+      for (const auto& range : ranges) {
+        size_t pos = range.first;
+        size_t remaining = range.second;
+        while (remaining > 0) {
+          size_t chunk = std::min(remaining, scratch.size());
+          read(pos, scratch.data(), chunk);
+          pos += chunk;
+          remaining -= chunk;
+        }
+      }
+    }
+  }
+  if (!base_names.empty()) {
+    delta_base_->prefetch(base_names);
+  }
+}
+
+// Note [Delta checkpoints]
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+// Periodic checkpoints rewrite every storage even though most bytes
+// (embedding tables, frozen layers) have not changed since the previous
+// one. In delta mode the writer compares each record's content hash
+// against the record of the same name in a base archive; on a match it
+// skips the payload and records a reference instead. The references are
+// serialized as the ".delta_manifest" record, one line per record:
+//   <crc32> <size> <name>
+// The content hash is the crc32/uncompressed-size pair that the zip
+// central directory already stores for every entry, so hashing the base
+// archive is free. At load time PyTorchStreamReader::setDeltaBase parses
+// the manifest and transparently serves referenced records from the base
+// archive (after re-checking the hash, so a modified or mismatched base
+// fails loudly rather than yielding stale tensors). Bases can chain: a
+// delta archive may itself serve as the base of a newer delta.
+
+std::tuple<uint32_t, uint64_t> PyTorchStreamReader::getRecordChecksum(
+    const std::string& name) {
+  auto delta_it = delta_records_.find(name);
+  if (delta_it != delta_records_.end()) {
+    return std::make_tuple(delta_it->second.first, delta_it->second.second);
+  }
+  std::lock_guard<std::mutex> guard(reader_lock_);
+  mz_zip_archive_file_stat stat;
+  mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
+  valid("retrieving file meta-data for ", name.c_str());
+  return std::make_tuple(
+      static_cast<uint32_t>(stat.m_crc32),
+      static_cast<uint64_t>(stat.m_uncomp_size));
+}
+
+bool PyTorchStreamReader::isDeltaArchive() {
+  return hasRecord(detail::kDeltaManifestRecordName);
+}
+
+void PyTorchStreamReader::setDeltaBase(
+    std::shared_ptr<PyTorchStreamReader> base) {
+  TORCH_CHECK(base != nullptr, "delta base archive must not be null");
+  TORCH_CHECK(
+      base.get() != this, "an archive cannot be its own delta base");
+  delta_base_ = std::move(base);
+  if (!hasRecord(detail::kDeltaManifestRecordName)) {
+    // not a delta archive; the base is simply never consulted
+    return;
+  }
+  at::DataPtr manifest_data;
+  size_t manifest_size = 0;
+  std::tie(manifest_data, manifest_size) =
+      getRecord(detail::kDeltaManifestRecordName);
+  std::istringstream manifest(std::string(
+      static_cast<const char*>(manifest_data.get()), manifest_size));
+  std::string line;
+  while (std::getline(manifest, line)) {
+    if (line.empty()) {
+      continue;
+    }
+    std::istringstream entry(line);
+    uint32_t crc32 = 0;
+    uint64_t size = 0;
+    std::string name;
+    entry >> crc32 >> size;
+    entry.get(); // the separating space; names may themselves contain spaces
+    std::getline(entry, name);
+    TORCH_CHECK(
+        !entry.fail() && !name.empty(),
+        "malformed delta manifest line: '",
+        line,
+        "'");
+    delta_records_.emplace(std::move(name), std::make_pair(crc32, size));
+  }
 }
 
 
@@ -353,6 +588,7 @@ void PyTorchStreamWriter::setup(const string& file_name) {
     CAFFE_THROW("invalid file name: ", file_name);
   }
   if (!writer_func_) {
+    file_name_ = file_name;
     file_stream_.open(
         file_name,
         std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
@@ -382,6 +618,322 @@ void PyTorchStreamWriter::setMinVersion(const uint64_t version) {
   version_ = std::max(version, version_);
 }
 
+void PyTorchStreamWriter::setRecordAlignment(uint64_t alignment) {
+  // The padding size is stored in two bytes of the zip extra field, which
+  // caps the alignment at 64K (see getPadding).
+  TORCH_CHECK(
+      alignment >= detail::kFieldAlignment && alignment <= (1 << 16) &&
+          (alignment & (alignment - 1)) == 0,
+      "record alignment must be a power of two between ",
+      detail::kFieldAlignment,
+      " and 65536, got ",
+      alignment);
+  alignment_ = alignment;
+}
+
+// Note [Checksum elision]
+// ~~~~~~~~~~~~~~~~~~~~~~~
+// Computing the CRC-32 of every record can dominate the write path for
+// large stored (uncompressed) records, even with the vectorized
+// implementation in crc.cc. Callers whose storage layer already
+// integrity-checks checkpoints can opt out via setChecksumsEnabled(false).
+// miniz offers no way to skip the CRC for stored entries (the
+// MZ_ZIP_FLAG_COMPRESSED_DATA escape hatch forces the entry's method to
+// MZ_DEFLATED, which would defeat the stored-record fast paths in
+// getRecord), so elision instead flips a thread-local switch that makes
+// this build's mz_crc32 return zero without reading its input (see
+// crc.cc, wired up via USE_EXTERNAL_MZCRC). Records then carry a zero
+// CRC; a marker record (detail::kChecksumsElidedRecordName) written at
+// finalization tells readers to tolerate CRC mismatches on extraction.
+// The cost is that corruption of the file itself is no longer detected
+// at load time.
+void PyTorchStreamWriter::setChecksumsEnabled(bool enabled) {
+  AT_ASSERT(!finalized_);
+  checksums_enabled_ = enabled;
+}
+
+namespace {
+// Scoped toggle for the mz_crc32 elision switch; see Note [Checksum
+// elision]. Restores the previous value so nested writers on the same
+// thread keep their own setting.
+struct Crc32ElisionGuard {
+  explicit Crc32ElisionGuard(bool elide)
+      : prev_(detail::setCrc32Elided(elide)) {}
+  ~Crc32ElisionGuard() {
+    detail::setCrc32Elided(prev_);
+  }
+  Crc32ElisionGuard(const Crc32ElisionGuard&) = delete;
+  Crc32ElisionGuard& operator=(const Crc32ElisionGuard&) = delete;
+
+ private:
+  bool prev_;
+};
+} // namespace
+
+void PyTorchStreamWriter::setDeltaBase(
+    std::shared_ptr<PyTorchStreamReader> base) {
+  AT_ASSERT(!finalized_);
+  TORCH_CHECK(base != nullptr, "delta base archive must not be null");
+  delta_base_ = std::move(base);
+}
+
+bool PyTorchStreamWriter::tryWriteDeltaReference(
+    const std::string& name,
+    const void* data,
+    size_t size) {
+  if (!delta_base_) {
+    return false;
+  }
+  // the version record and the manifest itself are read before a reader
+  // can resolve references, so they must always be written out in full
+  if (name == "version" || name == ".data/version" ||
+      name == detail::kDeltaManifestRecordName) {
+    return false;
+  }
+  if (!delta_base_->hasRecord(name)) {
+    return false;
+  }
+  uint32_t base_crc32 = 0;
+  uint64_t base_size = 0;
+  std::tie(base_crc32, base_size) = delta_base_->getRecordChecksum(name);
+  if (base_size != size) {
+    return false;
+  }
+  uint32_t crc32 = (uint32_t)mz_crc32(
+      MZ_CRC32_INIT, static_cast<const unsigned char*>(data), size);
+  if (base_crc32 != crc32) {
+    return false;
+  }
+  // See Note [Delta checkpoints]
+  delta_manifest_.push_back({name, crc32, size});
+  files_written_.insert(name);
+  return true;
+}
+
+// Note [Pipelined checkpoint writes]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// writeRecord compresses and writes on the calling thread, so saving a
+// large sharded checkpoint serializes pickling, deflate and disk I/O.
+// The async pipeline splits these stages: writeRecordAsync stages an
+// owned payload, a pool of compression workers deflates staged records
+// out of order, and a single committer thread appends finished records
+// to the archive in staging order (the zip writer itself is serial, so
+// committing is the one stage that cannot be parallelized). Stored
+// (uncompressed) records skip the compression stage. Precompressed
+// payloads are appended with MZ_ZIP_FLAG_COMPRESSED_DATA so the
+// committer only does I/O. Durability is batched: writeEndOfFile issues
+// a single fsync after the central directory is written rather than
+// syncing per record. Background errors are latched and rethrown from
+// the next writeRecordAsync or from writeEndOfFile.
+struct PyTorchStreamWriter::StagedRecord {
+  std::string name;
+  std::string data;
+  bool compress = false;
+  // Filled in by a compression worker; `ready` flips under async_mutex_
+  // once the record can be appended.
+  std::string compressed;
+  mz_uint32 uncomp_crc32 = 0;
+  bool ready = false;
+};
+
+void PyTorchStreamWriter::enableAsyncWrites(size_t num_compression_threads) {
+  AT_ASSERT(!finalized_);
+  TORCH_CHECK(!async_enabled_, "async writes are already enabled");
+  TORCH_CHECK(
+      num_compression_threads > 0,
+      "need at least one compression thread, got ",
+      num_compression_threads);
+  async_enabled_ = true;
+  async_shutdown_ = false;
+  compression_threads_.reserve(num_compression_threads);
+  for (size_t i = 0; i < num_compression_threads; ++i) {
+    compression_threads_.emplace_back([this] { compressionThreadBody(); });
+  }
+  commit_thread_ = std::thread([this] { commitThreadBody(); });
+}
+
+void PyTorchStreamWriter::writeRecordAsync(
+    const std::string& name,
+    std::string data,
+    bool compress) {
+  if (!async_enabled_) {
+    writeRecord(name, data.data(), data.size(), compress);
+    return;
+  }
+  AT_ASSERT(!finalized_);
+  TORCH_INTERNAL_ASSERT(
+      files_written_.count(name) == 0, "Tried to serialize file twice: ", name);
+  if (tryWriteDeltaReference(name, data.data(), data.size())) {
+    return;
+  }
+  files_written_.insert(name);
+  auto record = std::make_shared<StagedRecord>();
+  record->name = name;
+  record->data = std::move(data);
+  record->compress = compress;
+  // stored entries skip the compression stage
+  record->ready = !compress;
+  std::lock_guard<std::mutex> guard(async_mutex_);
+  if (async_error_) {
+    std::rethrow_exception(async_error_);
+  }
+  commit_queue_.push_back(record);
+  ++records_in_flight_;
+  if (compress) {
+    compress_queue_.push_back(std::move(record));
+    compress_cv_.notify_one();
+  } else {
+    commit_cv_.notify_one();
+  }
+}
+
+void PyTorchStreamWriter::compressionThreadBody() {
+  std::unique_lock<std::mutex> lock(async_mutex_);
+  while (true) {
+    compress_cv_.wait(lock, [this] {
+      return async_shutdown_ || !compress_queue_.empty();
+    });
+    if (compress_queue_.empty()) {
+      return;
+    }
+    auto record = compress_queue_.front();
+    compress_queue_.pop_front();
+    lock.unlock();
+    try {
+      // See Note [Checksum elision]
+      if (checksums_enabled_) {
+        record->uncomp_crc32 = (mz_uint32)mz_crc32(
+            MZ_CRC32_INIT,
+            reinterpret_cast<const unsigned char*>(record->data.data()),
+            record->data.size());
+      }
+      size_t comp_size = 0;
+      // Raw deflate (negative window bits), matching what miniz itself
+      // emits for zip entries.
+      void* comp_buf = tdefl_compress_mem_to_heap(
+          record->data.data(),
+          record->data.size(),
+          &comp_size,
+          tdefl_create_comp_flags_from_zip_params(
+              MZ_BEST_COMPRESSION,
+              -MZ_DEFAULT_WINDOW_BITS,
+              MZ_DEFAULT_STRATEGY));
+      if (comp_buf == nullptr) {
+        CAFFE_THROW("compressing record ", record->name, " failed");
+      }
+      record->compressed.assign(static_cast<const char*>(comp_buf), comp_size);
+      mz_free(comp_buf);
+      lock.lock();
+    } catch (...) {
+      lock.lock();
+      if (!async_error_) {
+        async_error_ = std::current_exception();
+      }
+    }
+    record->ready = true;
+    commit_cv_.notify_one();
+  }
+}
+
+void PyTorchStreamWriter::commitThreadBody() {
+  std::unique_lock<std::mutex> lock(async_mutex_);
+  while (true) {
+    commit_cv_.wait(lock, [this] {
+      return (!commit_queue_.empty() && commit_queue_.front()->ready) ||
+          (async_shutdown_ && commit_queue_.empty());
+    });
+    if (commit_queue_.empty()) {
+      return;
+    }
+    auto record = commit_queue_.front();
+    commit_queue_.pop_front();
+    // once an error is latched the remaining records are discarded
+    const bool discard = async_error_ != nullptr;
+    lock.unlock();
+    if (!discard) {
+      try {
+        appendStagedRecord(*record);
+      } catch (...) {
+        lock.lock();
+        if (!async_error_) {
+          async_error_ = std::current_exception();
+        }
+        lock.unlock();
+      }
+    }
+    lock.lock();
+    --records_in_flight_;
+    drain_cv_.notify_all();
+  }
+}
+
+void PyTorchStreamWriter::appendStagedRecord(const StagedRecord& record) {
+  // stored records go through miniz's own CRC computation below; see
+  // Note [Checksum elision]
+  Crc32ElisionGuard crc_guard(!checksums_enabled_);
+  std::string full_name = archive_name_plus_slash_ + record.name;
+  const bool precompressed = record.compress;
+  const std::string& payload = precompressed ? record.compressed : record.data;
+  size_t padding_size = detail::getPadding(
+      ar_->m_archive_size,
+      full_name.size(),
+      payload.size(),
+      alignment_,
+      padding_);
+  uint32_t flags = precompressed
+      ? (MZ_BEST_COMPRESSION | MZ_ZIP_FLAG_COMPRESSED_DATA)
+      : 0;
+  mz_zip_writer_add_mem_ex_v2(
+      ar_.get(),
+      full_name.c_str(),
+      payload.data(),
+      payload.size(),
+      nullptr,
+      0,
+      flags,
+      precompressed ? record.data.size() : 0,
+      precompressed ? record.uncomp_crc32 : 0,
+      nullptr,
+      padding_.c_str(),
+      padding_size,
+      nullptr,
+      0);
+  valid("writing file ", record.name.c_str());
+}
+
+void PyTorchStreamWriter::drainAsyncWrites() {
+  if (!async_enabled_) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(async_mutex_);
+  drain_cv_.wait(lock, [this] { return records_in_flight_ == 0; });
+  if (async_error_) {
+    auto error = async_error_;
+    async_error_ = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+void PyTorchStreamWriter::stopAsyncWrites() {
+  if (!async_enabled_) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> guard(async_mutex_);
+    async_shutdown_ = true;
+  }
+  compress_cv_.notify_all();
+  commit_cv_.notify_all();
+  for (auto& thread : compression_threads_) {
+    thread.join();
+  }
+  compression_threads_.clear();
+  if (commit_thread_.joinable()) {
+    commit_thread_.join();
+  }
+  async_enabled_ = false;
+}
+
 void PyTorchStreamWriter::writeRecord(
     const std::string& name,
     const void* data,
@@ -391,9 +943,15 @@ void PyTorchStreamWriter::writeRecord(
   AT_ASSERT(!archive_name_plus_slash_.empty());
   TORCH_INTERNAL_ASSERT(
       files_written_.count(name) == 0, "Tried to serialize file twice: ", name);
+  if (tryWriteDeltaReference(name, data, size)) {
+    return;
+  }
+  // See Note [Checksum elision]
+  Crc32ElisionGuard crc_guard(!checksums_enabled_);
   std::string full_name = archive_name_plus_slash_ + name;
   size_t padding_size =
-      detail::getPadding(ar_->m_archive_size, full_name.size(), size, padding_);
+      detail::getPadding(
+          ar_->m_archive_size, full_name.size(), size, alignment_, padding_);
   uint32_t flags = compress ? MZ_BEST_COMPRESSION : 0;
   mz_zip_writer_add_mem_ex_v2(
       ar_.get(),
@@ -414,6 +972,45 @@ void PyTorchStreamWriter::writeRecord(
   files_written_.insert(name);
 }
 
+void PyTorchStreamWriter::writeRecord(
+    const std::string& name,
+    const std::function<size_t(uint64_t pos, void* buf, size_t n)>& read_func,
+    size_t size,
+    bool compress) {
+  AT_ASSERT(!finalized_);
+  AT_ASSERT(!archive_name_plus_slash_.empty());
+  TORCH_INTERNAL_ASSERT(
+      files_written_.count(name) == 0, "Tried to serialize file twice: ", name);
+  // See Note [Checksum elision]
+  Crc32ElisionGuard crc_guard(!checksums_enabled_);
+  std::string full_name = archive_name_plus_slash_ + name;
+  size_t padding_size = detail::getPadding(
+      ar_->m_archive_size, full_name.size(), size, alignment_, padding_);
+  uint32_t flags = compress ? MZ_BEST_COMPRESSION : 0;
+  mz_file_read_func read_trampoline =
+      [](void* pOpaque, mz_uint64 file_ofs, void* pBuf, size_t n) -> size_t {
+    auto& fn = *static_cast<
+        const std::function<size_t(uint64_t, void*, size_t)>*>(pOpaque);
+    return fn(file_ofs, pBuf, n);
+  };
+  mz_zip_writer_add_read_buf_callback(
+      ar_.get(),
+      full_name.c_str(),
+      read_trampoline,
+      const_cast<void*>(static_cast<const void*>(&read_func)),
+      size,
+      nullptr,
+      nullptr,
+      0,
+      flags,
+      padding_.c_str(),
+      padding_size,
+      nullptr,
+      0);
+  valid("writing file ", name.c_str());
+  files_written_.insert(name);
+}
+
 void PyTorchStreamWriter::writeEndOfFile() {
   // Ensurers that finalized is set to true even
   // exception is raised during the method call.
@@ -430,6 +1027,31 @@ void PyTorchStreamWriter::writeEndOfFile() {
      bool& var_;
   } f(finalized_);
 
+  // See Note [Pipelined checkpoint writes]
+  const bool sync_on_commit = async_enabled_;
+  drainAsyncWrites();
+  stopAsyncWrites();
+
+  // See Note [Delta checkpoints]
+  if (!delta_manifest_.empty()) {
+    std::ostringstream manifest;
+    for (const auto& entry : delta_manifest_) {
+      manifest << entry.crc32 << ' ' << entry.size << ' ' << entry.name
+               << '\n';
+    }
+    std::string manifest_str = manifest.str();
+    writeRecord(
+        detail::kDeltaManifestRecordName,
+        manifest_str.data(),
+        manifest_str.size());
+    delta_manifest_.clear();
+  }
+
+  // See Note [Checksum elision]
+  if (!checksums_enabled_) {
+    writeRecord(detail::kChecksumsElidedRecordName, "1\n", 2);
+  }
+
   auto allRecords = getAllWrittenRecords();
   // If no ".data/version" or "version" record in the output model, rewrites version info
   if(allRecords.find(".data/version") == allRecords.end() && allRecords.find("version") == allRecords.end()) {
@@ -451,6 +1073,19 @@ void PyTorchStreamWriter::writeEndOfFile() {
   if (file_stream_.is_open()) {
     file_stream_.close();
   }
+#ifndef _WIN32
+  // Single batched fsync at commit time instead of per-record syncs.
+  // See Note [Pipelined checkpoint writes]
+  if (sync_on_commit && !file_name_.empty()) {
+    int fd = open(file_name_.c_str(), O_WRONLY);
+    if (fd != -1) {
+      fsync(fd);
+      close(fd);
+    }
+  }
+#else
+  (void)sync_on_commit;
+#endif
 }
 
 void PyTorchStreamWriter::valid(const char* what, const char* info) {
@@ -470,6 +1105,7 @@ void PyTorchStreamWriter::valid(const char* what, const char* info) {
 
 // NOLINTNEXTLINE(bugprone-exception-escape)
 PyTorchStreamWriter::~PyTorchStreamWriter() {
+  stopAsyncWrites();
   if (!finalized_) {
     writeEndOfFile();
   }
@@ -1,13 +1,19 @@
 #pragma once
 
 #include <cerrno>
+#include <condition_variable>
 #include <cstdio>
 #include <cstring>
+#include <deque>
 #include <fstream>
+#include <functional>
 #include <istream>
 #include <mutex>
 #include <ostream>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <c10/core/Allocator.h>
 #include <c10/core/Backend.h>
@@ -102,9 +108,42 @@ class TORCH_API PyTorchStreamReader final {
   // return dataptr, size
   std::tuple<at::DataPtr, size_t> getRecord(const std::string& name);
   size_t getRecordOffset(const std::string& name);
+
+  // Hints that the named records are about to be read: their byte ranges
+  // are sorted by file offset and brought into the page cache with
+  // batched sequential reads (madvise(MADV_WILLNEED) when the archive is
+  // mapped via tryEnableRecordMmap). Together with mmap-backed loading
+  // this lets a caller materialize a small subset of a large archive
+  // without touching the rest.
+  void prefetch(const std::vector<std::string>& names);
   bool hasRecord(const std::string& name);
   std::vector<std::string> getAllRecords();
 
+  // Backs uncompressed records by a copy-on-write memory mapping of the
+  // archive file instead of heap copies. Records are written uncompressed
+  // and 64-byte aligned precisely so that this is possible (see the layout
+  // comment at the top of this file). `file_name` must name the file this
+  // reader was constructed from. Processes that map the same model this
+  // way share its clean weight pages. Returns false if the file cannot be
+  // mapped; compressed records always fall back to copies.
+  bool tryEnableRecordMmap(const std::string& file_name);
+
+  // See Note [Delta checkpoints] in inline_container.cc. Resolves records
+  // that this archive stores only as references (see
+  // PyTorchStreamWriter::setDeltaBase) against `base`, verifying that the
+  // base record still matches the content hash recorded in the delta
+  // manifest. Call before the first getRecord.
+  void setDeltaBase(std::shared_ptr<PyTorchStreamReader> base);
+
+  // whether this archive contains a delta manifest and therefore needs
+  // setDeltaBase to resolve all of its records
+  bool isDeltaArchive();
+
+  // crc32 and uncompressed size of a record, as stored in the zip central
+  // directory; serves as the per-record content hash for delta
+  // checkpoints.
+  std::tuple<uint32_t, uint64_t> getRecordChecksum(const std::string& name);
+
   ~PyTorchStreamReader();
   uint64_t version() const {
     return version_;
@@ -115,6 +154,7 @@ class TORCH_API PyTorchStreamReader final {
   size_t read(uint64_t pos, char* buf, size_t n);
   void valid(const char* what, const char* info = "");
   size_t getRecordID(const std::string& name);
+  size_t getRecordOffsetUnlocked(uint64_t local_header_ofs);
 
   friend size_t
   istream_read_func(void* pOpaque, uint64_t file_ofs, void* pBuf, size_t n);
@@ -123,9 +163,54 @@ class TORCH_API PyTorchStreamReader final {
   std::string archive_name_plus_slash_;
   std::shared_ptr<ReadAdapterInterface> in_;
   int64_t version_;
+  // set when the archive carries the checksums-elided marker record;
+  // CRC mismatches on extraction are then ignored
+  bool crc_checks_disabled_ = false;
   std::mutex reader_lock_;
+  // Copy-on-write mapping of the whole archive, shared with the DataPtrs
+  // handed out by getRecord for uncompressed records; null unless
+  // tryEnableRecordMmap succeeded.
+  std::shared_ptr<at::DataPtr> mmap_region_;
+  // See Note [Delta checkpoints]: records listed in the delta manifest,
+  // resolved against delta_base_. Maps record name to the (crc32, size)
+  // content hash the base record must still match.
+  std::shared_ptr<PyTorchStreamReader> delta_base_;
+  std::unordered_map<std::string, std::pair<uint32_t, uint64_t>>
+      delta_records_;
 };
 
+namespace detail {
+// Writer-specific constants
+constexpr uint64_t kFieldAlignment = 64;
+// Alignment that makes every uncompressed record start on its own page on
+// the common 4K-page platforms, so readers can hand out page-granular
+// copy-on-write mappings of individual records (see tryEnableRecordMmap).
+constexpr uint64_t kPageAlignment = 4096;
+
+// Name of the record holding the delta manifest.
+// See Note [Delta checkpoints]
+constexpr const char* kDeltaManifestRecordName = ".delta_manifest";
+
+// Marker record written by setChecksumsEnabled(false); its presence
+// tells readers to skip CRC-32 validation for the whole archive.
+constexpr const char* kChecksumsElidedRecordName = ".checksums_elided";
+
+// Thread-local switch that makes mz_crc32 (implemented in crc.cc) return
+// zero without touching its input. Toggled by the writer around record
+// appends when checksums are elided; returns the previous value.
+// See Note [Checksum elision] in inline_container.cc.
+bool setCrc32Elided(bool elided);
+
+// Returns a record to be appended to the local user extra data entry in order
+// to make data beginning aligned at an `alignment` bytes boundary.
+size_t getPadding(
+    size_t cursor,
+    size_t filename_size,
+    size_t size,
+    uint64_t alignment,
+    std::string& padding_buf);
+} // namespace detail
+
 class TORCH_API PyTorchStreamWriter final {
  public:
   explicit PyTorchStreamWriter(std::string archive_name);
@@ -134,11 +219,67 @@ class TORCH_API PyTorchStreamWriter final {
 
   void setMinVersion(const uint64_t version);
 
+  // Sets the alignment of subsequently written records. The default is
+  // detail::kFieldAlignment (64 bytes); pass detail::kPageAlignment to
+  // page-align records so that mmap-based loading never shares a dirty
+  // page between two tensors. Must be a power of two. Readers recover the
+  // record offset from the zip local headers, so archives written with any
+  // alignment stay loadable everywhere.
+  void setRecordAlignment(uint64_t alignment);
+
+  // When `enabled` is false, skips CRC-32 computation for subsequently
+  // written records, for callers whose storage layer already
+  // integrity-checks checkpoints; CRC time can dominate the write path
+  // for large stored records. Such archives carry a marker record that
+  // makes readers skip CRC validation, so silent corruption of the file
+  // itself is no longer detected at load time.
+  void setChecksumsEnabled(bool enabled);
+
+  // See Note [Delta checkpoints] in inline_container.cc. Enables delta
+  // mode against `base`: a record whose bytes hash to the same
+  // crc32/size as the record of the same name in the base archive is not
+  // rewritten; a reference is recorded in the delta manifest instead and
+  // resolved at load time via PyTorchStreamReader::setDeltaBase.
+  void setDeltaBase(std::shared_ptr<PyTorchStreamReader> base);
+
   void writeRecord(
       const std::string& name,
       const void* data,
       size_t size,
       bool compress = false);
+
+  // Streams a record whose payload is produced on demand: `read_func`
+  // copies up to `n` bytes of the range starting at `pos` into `buf` and
+  // returns the number of bytes copied. The payload never has to exist
+  // in memory at once, at the cost of the entry carrying a zip data
+  // descriptor (the CRC is only known after the last chunk).
+  // See Note [Streaming tensor serialization] in
+  // torch/csrc/jit/serialization/pickler.cpp for the main user.
+  void writeRecord(
+      const std::string& name,
+      const std::function<size_t(uint64_t pos, void* buf, size_t n)>&
+          read_func,
+      size_t size,
+      bool compress = false);
+
+  // See Note [Pipelined checkpoint writes] in inline_container.cc.
+  // Spawns `num_compression_threads` compression workers plus a committer
+  // thread that appends finished records to the archive in staging order,
+  // so serialization on the calling thread overlaps with compression and
+  // disk I/O. Must be called before the first writeRecordAsync.
+  void enableAsyncWrites(size_t num_compression_threads);
+
+  // Stages a record for the background pipeline, taking ownership of the
+  // payload. Without enableAsyncWrites this degenerates to a synchronous
+  // writeRecord. Errors raised on the background threads are rethrown
+  // from a later writeRecordAsync or from writeEndOfFile. Do not
+  // interleave with synchronous writeRecord calls while records are in
+  // flight.
+  void writeRecordAsync(
+      const std::string& name,
+      std::string data,
+      bool compress = false);
+
   void writeEndOfFile();
 
   const std::unordered_set<std::string>& getAllWrittenRecords();
@@ -154,14 +295,30 @@ class TORCH_API PyTorchStreamWriter final {
   ~PyTorchStreamWriter();
 
  private:
+  struct StagedRecord;
+  struct DeltaEntry {
+    std::string name;
+    uint32_t crc32;
+    uint64_t size;
+  };
   void setup(const std::string& file_name);
   void valid(const char* what, const char* info = "");
+  bool tryWriteDeltaReference(
+      const std::string& name,
+      const void* data,
+      size_t size);
+  void appendStagedRecord(const StagedRecord& record);
+  void compressionThreadBody();
+  void commitThreadBody();
+  void drainAsyncWrites();
+  void stopAsyncWrites();
   size_t current_pos_ = 0;
   std::unordered_set<std::string> files_written_;
   std::unique_ptr<mz_zip_archive> ar_;
   std::string archive_name_;
   std::string archive_name_plus_slash_;
   std::string padding_;
+  uint64_t alignment_ = detail::kFieldAlignment;
   std::ofstream file_stream_;
   std::function<size_t(const void*, size_t)> writer_func_;
   // This number will be updated when the model has operators
@@ -169,6 +326,27 @@ class TORCH_API PyTorchStreamWriter final {
   uint64_t version_ = kMinProducedFileFormatVersion;
   bool finalized_ = false;
   bool err_seen_ = false;
+  bool checksums_enabled_ = true;
+
+  // See Note [Pipelined checkpoint writes]
+  bool async_enabled_ = false;
+  bool async_shutdown_ = false;
+  size_t records_in_flight_ = 0;
+  std::exception_ptr async_error_;
+  std::mutex async_mutex_;
+  std::condition_variable compress_cv_;
+  std::condition_variable commit_cv_;
+  std::condition_variable drain_cv_;
+  std::deque<std::shared_ptr<StagedRecord>> compress_queue_;
+  std::deque<std::shared_ptr<StagedRecord>> commit_queue_;
+  std::vector<std::thread> compression_threads_;
+  std::thread commit_thread_;
+  std::string file_name_;
+
+  // See Note [Delta checkpoints]
+  std::shared_ptr<PyTorchStreamReader> delta_base_;
+  std::vector<DeltaEntry> delta_manifest_;
+
   friend size_t ostream_write_func(
       void* pOpaque,
       uint64_t file_ofs,
@@ -176,18 +354,5 @@ class TORCH_API PyTorchStreamWriter final {
       size_t n);
 };
 
-namespace detail {
-// Writer-specific constants
-constexpr uint64_t kFieldAlignment = 64;
-
-// Returns a record to be appended to the local user extra data entry in order
-// to make data beginning aligned at kFieldAlignment bytes boundary.
-size_t getPadding(
-    size_t cursor,
-    size_t filename_size,
-    size_t size,
-    std::string& padding_buf);
-} // namespace detail
-
 } // namespace serialize
 } // namespace caffe2
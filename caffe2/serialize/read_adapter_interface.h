@@ -16,6 +16,14 @@ class TORCH_API ReadAdapterInterface {
   virtual size_t size() const = 0;
   virtual size_t read(uint64_t pos, void* buf, size_t n, const char* what = "")
       const = 0;
+  // Whether concurrent calls to read() from multiple threads are safe.
+  // Adapters whose reads are positioned and keep no mutable state should
+  // override this to return true; PyTorchStreamReader uses it to let
+  // record reads from different threads overlap instead of serializing
+  // them behind its lock.
+  virtual bool isThreadSafe() const {
+    return false;
+  }
   virtual ~ReadAdapterInterface();
 };
 
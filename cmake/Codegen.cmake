@@ -89,7 +89,7 @@ if(INTERN_BUILD_ATEN_OPS)
   endif()
 
   if(SELECTED_OP_LIST)
-    if(TRACING_BASED)
+    if(TRACING_BASED OR USE_SELECTIVE_BUILD)
       message(STATUS "Running tracing-based selective build given operator list: ${SELECTED_OP_LIST}")
       list(APPEND CUSTOM_BUILD_FLAGS
         --op_selection_yaml_path ${SELECTED_OP_LIST})
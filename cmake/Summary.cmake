@@ -193,6 +193,7 @@ function(caffe2_print_configuration_summary)
   endif()
   if(NOT "${SELECTED_OP_LIST}" STREQUAL "")
     message(STATUS "  SELECTED_OP_LIST    : ${SELECTED_OP_LIST}")
+    message(STATUS "  USE_SELECTIVE_BUILD : ${USE_SELECTIVE_BUILD}")
   endif()
   message(STATUS "  Public Dependencies  : ${Caffe2_PUBLIC_DEPENDENCY_LIBS}")
   message(STATUS "  Private Dependencies : ${Caffe2_DEPENDENCY_LIBS}")
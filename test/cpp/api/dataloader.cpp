@@ -938,6 +938,132 @@ TEST(DataTest, CanSaveAndLoadDistributedRandomSampler) {
   }
 }
 
+namespace {
+std::vector<size_t> drain_sampler(
+    samplers::StreamingRandomSampler& sampler,
+    size_t batch_size = 3) {
+  std::vector<size_t> res;
+  torch::optional<std::vector<size_t>> idx;
+  while ((idx = sampler.next(batch_size)).has_value()) {
+    res.insert(std::end(res), std::begin(*idx), std::end(*idx));
+  }
+  return res;
+}
+} // namespace
+
+TEST(DataTest, StreamingRandomSamplerProducesPermutation) {
+  // The Feistel network walks a padded power-of-two domain, so sizes that
+  // are not powers of two exercise the cycle-walking rejection; every index
+  // must still appear exactly once.
+  for (size_t sample_count : {1, 2, 10, 97, 1000, 1024}) {
+    samplers::StreamingRandomSampler sampler(sample_count);
+    auto res = drain_sampler(sampler);
+    ASSERT_EQ(res.size(), sample_count);
+    std::sort(res.begin(), res.end());
+    for (const auto i : c10::irange(res.size())) {
+      ASSERT_EQ(res[i], i);
+    }
+  }
+}
+
+TEST(DataTest, StreamingRandomSamplerIsDeterministic) {
+  const size_t sample_count = 100;
+  samplers::StreamingRandomSampler a(sample_count, 1, 0, true, /*seed=*/7);
+  samplers::StreamingRandomSampler b(sample_count, 1, 0, true, /*seed=*/7);
+  auto res_a = drain_sampler(a);
+  ASSERT_EQ(res_a, drain_sampler(b));
+
+  // A different epoch or seed re-keys the permutation.
+  b.set_epoch(1);
+  b.reset();
+  ASSERT_NE(res_a, drain_sampler(b));
+
+  samplers::StreamingRandomSampler c(sample_count, 1, 0, true, /*seed=*/8);
+  ASSERT_NE(res_a, drain_sampler(c));
+
+  // reset() with the same epoch replays the same permutation.
+  a.reset();
+  ASSERT_EQ(res_a, drain_sampler(a));
+}
+
+TEST(DataTest, StreamingRandomSamplerMultiReplicaProduceCorrectSamples) {
+  size_t sample_count = 10;
+  size_t num_replicas = 3;
+
+  auto test_function = [&](bool allow_duplicates,
+                           size_t local_sample_count,
+                           size_t expected_size,
+                           size_t batch_size) {
+    std::vector<size_t> res;
+    for (const auto i : c10::irange(num_replicas)) {
+      samplers::StreamingRandomSampler sampler(
+          sample_count, num_replicas, i, allow_duplicates);
+      torch::optional<std::vector<size_t>> idx;
+      size_t replica_total = 0;
+      while ((idx = sampler.next(batch_size)).has_value()) {
+        res.insert(std::end(res), std::begin(*idx), std::end(*idx));
+        replica_total += idx->size();
+      }
+      ASSERT_EQ(replica_total, local_sample_count);
+    }
+    // Together the replicas cover every index; without duplicates nothing
+    // appears twice.
+    std::sort(res.begin(), res.end());
+    ASSERT_EQ(res.size(), expected_size);
+    if (!allow_duplicates) {
+      ASSERT_TRUE(std::adjacent_find(res.begin(), res.end()) == res.end());
+    }
+    for (const auto index : res) {
+      ASSERT_LT(index, sample_count);
+    }
+  };
+
+  for (size_t batch_size = 1; batch_size <= 3; ++batch_size) {
+    size_t local_sample_count =
+        static_cast<size_t>(std::ceil(sample_count * 1.0 / num_replicas));
+    test_function(
+        true, local_sample_count, local_sample_count * num_replicas,
+        batch_size);
+
+    local_sample_count =
+        static_cast<size_t>(std::floor(sample_count * 1.0 / num_replicas));
+    test_function(
+        false, local_sample_count, local_sample_count * num_replicas,
+        batch_size);
+  }
+}
+
+TEST(DataTest, CanSaveAndLoadStreamingRandomSampler) {
+  {
+    samplers::StreamingRandomSampler a(10);
+    ASSERT_EQ(a.index(), 0);
+    std::stringstream stream;
+    torch::save(a, stream);
+
+    samplers::StreamingRandomSampler b(10);
+    torch::load(b, stream);
+    ASSERT_EQ(b.index(), 0);
+  }
+  {
+    // A reloaded sampler resumes the interrupted permutation exactly.
+    samplers::StreamingRandomSampler a(10, 1, 0, true, /*seed=*/5);
+    auto full = drain_sampler(a, 10);
+    a.reset();
+    a.next(3);
+    a.next(4);
+    ASSERT_EQ(a.index(), 7);
+    std::stringstream stream;
+    torch::save(a, stream);
+
+    samplers::StreamingRandomSampler b(10, 1, 0, true, /*seed=*/5);
+    torch::load(b, stream);
+    ASSERT_EQ(b.index(), 7);
+    auto tail = drain_sampler(b, 10);
+    ASSERT_EQ(tail.size(), 3);
+    ASSERT_TRUE(std::equal(tail.begin(), tail.end(), full.begin() + 7));
+  }
+}
+
 TEST(DataTest, DistributedSequentialSamplerSingleReplicaProduceCorrectSamples) {
   size_t sample_count = 10;
   size_t batch_size = 3;
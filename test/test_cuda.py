@@ -709,6 +709,42 @@ class TestCuda(TestCase):
             self.assertEqual(a, b)
             self.assertEqual(torch.cuda.initial_seed(), 2)
 
+    def test_cat_batched_vectorized(self):
+        # The batched cat kernel takes a 128-bit vectorized path when every
+        # chunk and data pointer is 16-byte aligned, processes 128 inputs per
+        # launch, and falls back to the element-wise copy otherwise; all
+        # variants must match the CPU result.
+        # Aligned chunks (multiples of 4 floats), spanning multiple launches.
+        xs = [torch.randn(4, 8, device='cuda') for _ in range(300)]
+        self.assertEqual(torch.cat(xs, 0).cpu(),
+                         torch.cat([x.cpu() for x in xs], 0))
+
+        # Odd chunk sizes break the alignment precondition.
+        ys = [torch.randn(3, 5, device='cuda') for _ in range(150)]
+        self.assertEqual(torch.cat(ys, 1).cpu(),
+                         torch.cat([y.cpu() for y in ys], 1))
+
+        # Mixed sizes along the cat dimension, some aligned and some not.
+        sizes = [1, 3, 4, 7, 16, 64]
+        zs = [torch.randn(s, 12, device='cuda') for s in sizes * 30]
+        self.assertEqual(torch.cat(zs, 0).cpu(),
+                         torch.cat([z.cpu() for z in zs], 0))
+
+        # Half-precision shifts the byte alignment of the same shapes.
+        hs = [torch.randn(4, 10, device='cuda', dtype=torch.half)
+              for _ in range(140)]
+        self.assertEqual(torch.cat(hs, 0).cpu(),
+                         torch.cat([h.cpu() for h in hs], 0))
+
+        # Channels-last inputs exercise the dimension permutation, which
+        # must hold across input batches (more than 128 inputs).
+        cl = [torch.randn(2, 8, 4, 4, device='cuda')
+              .contiguous(memory_format=torch.channels_last)
+              for _ in range(130)]
+        out = torch.cat(cl, 1)
+        self.assertTrue(out.is_contiguous(memory_format=torch.channels_last))
+        self.assertEqual(out.cpu(), torch.cat([c.cpu() for c in cl], 1))
+
     @unittest.skipIf(not TEST_MULTIGPU, "only one GPU detected")
     def test_cat_autogpu(self):
         x = torch.randn(4, 4).cuda(1)
@@ -716,6 +752,28 @@ class TestCuda(TestCase):
         z = torch.cat([x, y], 0)
         self.assertEqual(z.get_device(), x.get_device())
 
+    def test_softmax_long_rows_small_batch(self):
+        # Softmax over a few very long rows takes a multi-block split path
+        # (engaged when the batch is below the SM count and the row length is
+        # at least 64K); compare it against a float64 CPU reference, with row
+        # lengths on both sides of the threshold and ones that are not
+        # multiples of the chunk rounding.
+        for rows in (1, 3):
+            for cols in (65535, 65536, 200001):
+                for dtype in (torch.float, torch.half):
+                    x = torch.randn(rows, cols, device='cuda', dtype=dtype)
+                    ref = x.cpu().double().softmax(dim=1)
+                    tol = 1e-3 if dtype == torch.half else 1e-5
+                    self.assertEqual(x.softmax(dim=1).cpu().double(), ref,
+                                     atol=tol, rtol=tol)
+                    self.assertEqual(x.log_softmax(dim=1).cpu().double(),
+                                     ref.log(), atol=tol, rtol=tol)
+        # A large batch must keep the one-block-per-row path and agree too.
+        x = torch.randn(512, 65536, device='cuda')
+        self.assertEqual(x.softmax(dim=1)[:2].cpu().double(),
+                         x[:2].cpu().double().softmax(dim=1),
+                         atol=1e-5, rtol=1e-5)
+
     @unittest.skipIf(torch.cuda.device_count() >= 10, "Loading a cuda:9 tensor")
     def test_load_nonexistent_device(self):
         # Setup: create a serialized file object with a 'cuda:9' restore location
@@ -906,6 +964,54 @@ class TestCuda(TestCase):
         default_stream.synchronize()
         self.assertTrue(default_stream.query())
 
+    def test_fork_join(self):
+        # Branches run on side streams but must produce exactly what
+        # sequential execution produces, in branch order, and their results
+        # must be safe to consume on the current stream afterwards.
+        x = torch.randn(256, 256, device='cuda')
+        y = torch.randn(256, 256, device='cuda')
+
+        branches = [
+            lambda: x.mm(x),
+            lambda: y.mm(y),
+            lambda: x + y,
+        ]
+        expected = [b() for b in branches]
+        results = torch.cuda.fork_join(branches)
+        self.assertEqual(len(results), len(branches))
+        for res, exp in zip(results, expected):
+            self.assertEqual(res, exp)
+
+        # Work queued before the fork must be visible to every branch, and
+        # the join must order the branches before later work.
+        a = torch.zeros(1000, 1000, device='cuda')
+        a += 1
+        totals = torch.cuda.fork_join([lambda: a.sum(), lambda: (a * 2).sum()])
+        self.assertEqual((totals[0] + totals[1]).item(), 3 * a.numel())
+
+        # A single branch runs inline on the current stream.
+        single = torch.cuda.fork_join([lambda: x * 3])
+        self.assertEqual(single[0], x * 3)
+
+        # Non-tensor and nested-container results pass through untouched.
+        mixed = torch.cuda.fork_join([lambda: 7, lambda: [x + 1, None]])
+        self.assertEqual(mixed[0], 7)
+        self.assertEqual(mixed[1][0], x + 1)
+        self.assertIsNone(mixed[1][1])
+
+    def test_fork_join_exception(self):
+        x = torch.randn(8, device='cuda')
+
+        def boom():
+            raise RuntimeError("branch failed")
+
+        with self.assertRaisesRegex(RuntimeError, "branch failed"):
+            torch.cuda.fork_join([lambda: x + 1, boom])
+        # The pool and current stream stay usable after a failed branch.
+        res = torch.cuda.fork_join([lambda: x + 1, lambda: x + 2])
+        self.assertEqual(res[0], x + 1)
+        self.assertEqual(res[1], x + 2)
+
     @unittest.skipIf(not TEST_MULTIGPU, "detected only one GPU")
     def test_stream_event_device(self):
         d0 = torch.device('cuda:0')
@@ -9,6 +9,7 @@ import sys
 import zipfile
 import warnings
 import gzip
+import collections
 import copy
 import pickle
 import shutil
@@ -35,6 +36,9 @@ if TEST_DILL:
 else:
     HAS_DILL_AT_LEAST_0_3_1 = False
 
+# Defined at module level so it is picklable (used by the async_save tests).
+Point = collections.namedtuple('Point', ['x', 'y'])
+
 can_retrieve_source = True
 with warnings.catch_warnings(record=True) as warns:
     with tempfile.NamedTemporaryFile() as checkpoint:
@@ -899,6 +903,36 @@ class TestSerialization(TestCase, SerializationMixin):
 
         test(io.BytesIO())
 
+    def test_async_save_namedtuple(self):
+        # Snapshotting must rebuild namedtuples with positional field
+        # arguments; type(obj)(generator) works for plain tuples only.
+        data = {'point': Point(torch.ones(3), (torch.zeros(2), 1))}
+
+        snapshot = torch.serialization._snapshot_for_async_save(data, {})
+        self.assertIs(type(snapshot['point']), Point)
+        self.assertEqual(snapshot['point'].x, torch.ones(3))
+
+        with BytesIOContext() as f:
+            handle = torch.serialization.async_save(data, f)
+            handle.wait()
+            f.seek(0)
+            result = torch.load(f)
+
+        self.assertIs(type(result['point']), Point)
+        self.assertEqual(result['point'].x, torch.ones(3))
+        self.assertEqual(result['point'].y[0], torch.zeros(2))
+
+    def test_async_save_return_types(self):
+        # torch.return_types.* are structseqs; the snapshot must keep the
+        # type and clone the tensor fields.
+        sorted_ = torch.sort(torch.randn(5))
+        snapshot = torch.serialization._snapshot_for_async_save(sorted_, {})
+        self.assertIs(type(snapshot), type(sorted_))
+        self.assertEqual(snapshot.values, sorted_.values)
+        self.assertEqual(snapshot.indices, sorted_.indices)
+        self.assertNotEqual(
+            snapshot.values.data_ptr(), sorted_.values.data_ptr())
+
     def test_serialization_zipfile_actually_jit(self):
         with tempfile.NamedTemporaryFile() as f:
             torch.jit.save(torch.jit.script(torch.nn.Linear(3, 4)), f)
@@ -27,8 +27,14 @@
 
 #include <ATen/MapAllocator.h>
 #include <torch/csrc/utils/python_numbers.h>
+#include <algorithm>
 #include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 static PyObject* THPStorage_sharedDecref(PyObject* _self, PyObject* noargs) {
   HANDLE_TH_ERRORS
@@ -173,6 +179,255 @@ static PyObject* THPStorage_newSharedFilename(
   END_HANDLE_TH_ERRORS
 }
 
+// Note [Shared-memory arena transport]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Sharing one storage per DataLoader batch pays the full
+// shm_open/ftruncate/mmap dance on the producer for every tensor sent,
+// and a matching mmap on the consumer. The arena transport instead keeps
+// a small ring of persistently mapped shm segments per producer process.
+// Each segment starts with one cache line holding a cross-process
+// reference count; a segment whose count has dropped to zero is handed
+// out again with no syscalls at all. The count starts at two - one
+// reference for the producer's storage and one for the in-flight control
+// message - and each side decrements it when its storage is freed, so a
+// segment is only recycled once the consumer is done reading from it.
+// Consumers keep every segment they have adopted mapped (the ring bounds
+// how many exist per producer), so receiving a batch is a hash lookup
+// plus a pointer offset: one control message, no new mappings. When the
+// ring is exhausted - a consumer fell behind, or a control message was
+// dropped before it was rebuilt - _share_arena_cpu_ returns None and the
+// caller falls back to the one-segment-per-storage paths above.
+
+namespace {
+
+// keeps payloads cache-line aligned past the refcount header
+constexpr size_t kArenaHeaderBytes = 64;
+constexpr size_t kArenaDefaultSegments = 16;
+constexpr size_t kArenaMinSegmentBytes = static_cast<size_t>(1) << 20;
+
+struct ArenaSlotRef {
+  std::string manager_handle;
+  std::string object_handle;
+  size_t capacity;
+  size_t nbytes;
+  std::atomic<int64_t>* refcount;
+  // keeps the segment mapping alive for the lifetime of the storage
+  std::shared_ptr<at::DataPtr> segment;
+};
+
+void arenaSlotDelete(void* ctx) {
+  auto* ref = static_cast<ArenaSlotRef*>(ctx);
+  ref->refcount->fetch_sub(1, std::memory_order_acq_rel);
+  delete ref;
+}
+
+struct ArenaSegment {
+  std::string manager_handle;
+  std::string object_handle;
+  size_t capacity;
+  std::shared_ptr<at::DataPtr> map;
+
+  std::atomic<int64_t>* refcount() const {
+    return static_cast<std::atomic<int64_t>*>(map->get());
+  }
+
+  at::DataPtr makeSlot(size_t nbytes, ArenaSlotRef** out_ref) const {
+    auto* ref = new ArenaSlotRef{
+        manager_handle, object_handle, capacity, nbytes, refcount(), map};
+    if (out_ref != nullptr) {
+      *out_ref = ref;
+    }
+    return at::DataPtr(
+        static_cast<char*>(map->get()) + kArenaHeaderBytes,
+        ref,
+        &arenaSlotDelete,
+        at::DeviceType::CPU);
+  }
+};
+
+// Producer-side ring of reusable segments.
+class ShmArena {
+ public:
+  static ShmArena& get() {
+    static ShmArena arena;
+    return arena;
+  }
+
+  // Returns a DataPtr for `nbytes` inside an idle segment (creating one
+  // if the ring is not full yet), or an empty DataPtr when every segment
+  // is still referenced.
+  at::DataPtr allocate(size_t nbytes, ArenaSlotRef** out_ref) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    ArenaSegment* segment = nullptr;
+    for (auto& candidate : ring_) {
+      if (candidate.capacity >= nbytes &&
+          candidate.refcount()->load(std::memory_order_acquire) == 0) {
+        segment = &candidate;
+        break;
+      }
+    }
+    if (segment == nullptr) {
+      if (ring_.size() >= max_segments_) {
+        // evict an idle but undersized segment to make room
+        auto it = std::find_if(
+            ring_.begin(), ring_.end(), [](const ArenaSegment& candidate) {
+              return candidate.refcount()->load(
+                         std::memory_order_acquire) == 0;
+            });
+        if (it == ring_.end()) {
+          return at::DataPtr();
+        }
+        ring_.erase(it);
+      }
+      ring_.push_back(createSegment(nbytes));
+      segment = &ring_.back();
+    }
+    // producer storage + in-flight control message
+    segment->refcount()->store(2, std::memory_order_release);
+    return segment->makeSlot(nbytes, out_ref);
+  }
+
+ private:
+  ShmArena() : max_segments_(kArenaDefaultSegments) {
+    if (const char* env = std::getenv("TORCH_SHM_ARENA_SEGMENTS")) {
+      max_segments_ = std::max<size_t>(1, std::strtoul(env, nullptr, 10));
+    }
+  }
+
+  static ArenaSegment createSegment(size_t nbytes) {
+    size_t capacity = std::max(nbytes, kArenaMinSegmentBytes);
+    int flags = at::ALLOCATOR_MAPPED_SHAREDMEM | at::ALLOCATOR_MAPPED_EXCLUSIVE;
+    std::string handle = at::NewProcessWideShmHandle();
+    auto map = std::make_shared<at::DataPtr>(THManagedMapAllocator::makeDataPtr(
+        "", handle.c_str(), flags, capacity + kArenaHeaderBytes));
+    new (map->get()) std::atomic<int64_t>(0);
+    auto* ctx = THManagedMapAllocator::fromDataPtr(*map);
+    AT_ASSERT(ctx);
+    return ArenaSegment{ctx->manager_handle(), handle, capacity, std::move(map)};
+  }
+
+  std::mutex mutex_;
+  size_t max_segments_;
+  std::vector<ArenaSegment> ring_;
+};
+
+// Consumer-side cache of adopted segments, keyed by the object handle so
+// that every batch from the same segment reuses one mapping.
+at::DataPtr adoptArenaSlot(
+    const char* manager_handle,
+    const char* object_handle,
+    size_t capacity,
+    size_t nbytes) {
+  static std::mutex cache_mutex;
+  static std::unordered_map<std::string, ArenaSegment> cache;
+  std::lock_guard<std::mutex> guard(cache_mutex);
+  auto it = cache.find(object_handle);
+  if (it == cache.end()) {
+    int flags = at::ALLOCATOR_MAPPED_SHAREDMEM | at::ALLOCATOR_MAPPED_NOCREATE;
+    auto map = std::make_shared<at::DataPtr>(THManagedMapAllocator::makeDataPtr(
+        manager_handle, object_handle, flags, capacity + kArenaHeaderBytes));
+    it = cache
+             .emplace(
+                 object_handle,
+                 ArenaSegment{
+                     manager_handle, object_handle, capacity, std::move(map)})
+             .first;
+  }
+  return it->second.makeSlot(nbytes, nullptr);
+}
+
+} // namespace
+
+static PyObject* THPStorage_shareArena(PyObject* _self, PyObject* noargs) {
+  HANDLE_TH_ERRORS
+  TORCH_CHECK(
+      reinterpret_cast<THPStorage*>(_self)->cdata->device_type() == at::kCPU,
+      "_share_arena_: only available on CPU");
+  auto self = (THPStorage*)_self;
+  c10::StorageImpl* storage = self->cdata;
+  ArenaSlotRef* ref = nullptr;
+  if (storage->data_ptr().get_deleter() == &arenaSlotDelete) {
+    // already arena-backed: the new control message carries its own
+    // reference
+    ref = static_cast<ArenaSlotRef*>(storage->data_ptr().get_context());
+    ref->refcount->fetch_add(1, std::memory_order_acq_rel);
+  } else {
+    at::DataPtr slot = ShmArena::get().allocate(storage->nbytes(), &ref);
+    if (!slot) {
+      // ring exhausted; the caller falls back to per-storage sharing
+      Py_RETURN_NONE;
+    }
+    at::Storage new_storage(c10::make_intrusive<at::StorageImpl>(
+        c10::StorageImpl::use_byte_size_t(),
+        storage->nbytes(),
+        std::move(slot),
+        /*allocator=*/nullptr,
+        /*resizable=*/false));
+    at::Storage _self_aten = torch::createStorage(_self);
+    {
+      // Copying into shared memory can be slow, so release the GIL
+      pybind11::gil_scoped_release no_gil;
+      storage_copy(new_storage, _self_aten);
+    }
+    std::swap(*storage, *new_storage.unsafeGetStorageImpl());
+  }
+
+  THPObjectPtr manager_handle(
+      PyBytes_FromString(ref->manager_handle.c_str()));
+  if (!manager_handle)
+    return nullptr;
+  THPObjectPtr object_handle(PyBytes_FromString(ref->object_handle.c_str()));
+  if (!object_handle)
+    return nullptr;
+  THPObjectPtr capacity(THPUtils_packUInt64(ref->capacity));
+  if (!capacity)
+    return nullptr;
+  THPObjectPtr size(THPUtils_packUInt64(storage->nbytes()));
+  if (!size)
+    return nullptr;
+
+  THPObjectPtr tuple(PyTuple_New(4));
+  if (!tuple)
+    return nullptr;
+  PyTuple_SET_ITEM(tuple.get(), 0, manager_handle.release());
+  PyTuple_SET_ITEM(tuple.get(), 1, object_handle.release());
+  PyTuple_SET_ITEM(tuple.get(), 2, capacity.release());
+  PyTuple_SET_ITEM(tuple.get(), 3, size.release());
+  return tuple.release();
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject* THPStorage_newSharedArena(PyObject* _unused, PyObject* args) {
+  HANDLE_TH_ERRORS
+  THPUtils_assert(PyTuple_GET_SIZE(args) == 4, "tuple of 4 items expected");
+  PyObject* _manager_handle = PyTuple_GET_ITEM(args, 0);
+  PyObject* _object_handle = PyTuple_GET_ITEM(args, 1);
+  PyObject* _capacity = PyTuple_GET_ITEM(args, 2);
+  PyObject* _size = PyTuple_GET_ITEM(args, 3);
+  if (!PyBytes_Check(_manager_handle) || !PyBytes_Check(_object_handle) ||
+      !THPUtils_checkLong(_capacity) || !THPUtils_checkLong(_size)) {
+    THPUtils_invalidArguments(
+        args,
+        nullptr,
+        "_new_shared in arena mode",
+        1,
+        "manager handle (bytes), object handle (bytes), segment capacity "
+        "(int) and storage size (int)");
+    return nullptr;
+  }
+  const char* manager_handle = PyBytes_AS_STRING(_manager_handle);
+  const char* object_handle = PyBytes_AS_STRING(_object_handle);
+  size_t capacity = THPUtils_unpackUInt64(_capacity);
+  size_t size = THPUtils_unpackUInt64(_size);
+  return THPStorage_New(c10::make_intrusive<at::StorageImpl>(
+      c10::StorageImpl::use_byte_size_t(),
+      size,
+      adoptArenaSlot(manager_handle, object_handle, capacity, size),
+      /*allocator=*/nullptr,
+      /*resizable=*/false));
+  END_HANDLE_TH_ERRORS
+}
+
 static c10::intrusive_ptr<c10::StorageImpl> THPStorage_newFdStorage(
     ptrdiff_t size) {
   int flags = at::ALLOCATOR_MAPPED_SHAREDMEM | at::ALLOCATOR_MAPPED_EXCLUSIVE |
@@ -629,7 +884,8 @@ PyObject* THPStorage_isShared(PyObject* _self, PyObject* noargs) {
     Py_RETURN_TRUE;
   }
   if (at::MapAllocator::fromDataPtr(self->cdata->data_ptr()) ||
-      THManagedMapAllocator::fromDataPtr(self->cdata->data_ptr())) {
+      THManagedMapAllocator::fromDataPtr(self->cdata->data_ptr()) ||
+      self->cdata->data_ptr().get_deleter() == &arenaSlotDelete) {
     Py_RETURN_TRUE;
   } else {
     Py_RETURN_FALSE;
@@ -669,6 +925,11 @@ static PyMethodDef THPStorage_sharingMethods[] = {
      THPStorage_pyNewFilenameStorage,
      METH_VARARGS | METH_STATIC,
      nullptr},
+    {"_share_arena_cpu_", THPStorage_shareArena, METH_NOARGS, nullptr},
+    {"_new_shared_arena_cpu",
+     THPStorage_newSharedArena,
+     METH_VARARGS | METH_STATIC,
+     nullptr},
     {"_weak_ref", THPStorage_weakRef, METH_NOARGS, nullptr},
     {"_free_weak_ref", THPStorage_freeWeakRef, METH_O | METH_STATIC, nullptr},
     {"_expired", THPStorage_expired, METH_O | METH_STATIC, nullptr},
@@ -2,6 +2,7 @@
 
 #include <torch/data/dataloader_options.h>
 #include <torch/data/detail/data_shuttle.h>
+#include <torch/data/detail/pin_memory.h>
 #include <torch/data/detail/sequencers.h>
 #include <torch/data/iterator.h>
 #include <torch/data/samplers/random.h>
@@ -39,7 +40,11 @@ class DataLoaderBase {
       // NOLINTNEXTLINE(performance-move-const-arg)
       : options_(std::move(options)),
         main_thread_dataset_(std::move(main_thread_dataset)),
-        sequencer_(new_sequencer()) {}
+        sequencer_(new_sequencer()) {
+    if (options_.pin_memory && options_.workers > 0) {
+      pin_thread_ = std::thread([this] { this->pin_thread(); });
+    }
+  }
 
   // NOLINTNEXTLINE(bugprone-exception-escape)
   virtual ~DataLoaderBase() {
@@ -92,6 +97,12 @@ class DataLoaderBase {
     for (auto& worker : workers_) {
       worker.join();
     }
+    if (pin_thread_.joinable()) {
+      // A default-constructed `Result` (neither batch nor exception) tells
+      // the pinning thread to shut down.
+      unpinned_results_.push(Result());
+      pin_thread_.join();
+    }
     joined_ = true;
   }
 
@@ -193,10 +204,44 @@ class DataLoaderBase {
       }
       try {
         auto batch = dataset.get_batch(std::move(*job.batch_request));
-        shuttle_.push_result({std::move(batch), job.sequence_number});
+        push_result_from_worker({std::move(batch), job.sequence_number});
       } catch (...) {
-        shuttle_.push_result({std::current_exception(), job.sequence_number});
+        push_result_from_worker(
+            {std::current_exception(), job.sequence_number});
+      }
+    }
+  }
+
+  /// Routes a finished `Result` either directly to the `DataShuttle`, or
+  /// through the pinning stage when the `pin_memory` option is enabled.
+  void push_result_from_worker(Result result) {
+    if (pin_thread_.joinable()) {
+      unpinned_results_.push(std::move(result));
+    } else {
+      shuttle_.push_result(std::move(result));
+    }
+  }
+
+  /// The function the pinning thread runs when `pin_memory` is enabled. It
+  /// moves every worker result into pinned memory before forwarding it to the
+  /// main thread, so the consumer can issue asynchronous host-to-device
+  /// copies that overlap with the collation of further batches. Pinned
+  /// buffers come from the caching host allocator and are recycled across
+  /// batches.
+  void pin_thread() {
+    while (true) {
+      auto result = unpinned_results_.pop();
+      if (!result.batch && !result.exception) {
+        break;
+      }
+      if (result.batch) {
+        try {
+          detail::pin_batch(*result.batch);
+        } catch (...) {
+          result = Result(std::current_exception(), result.sequence_number);
+        }
       }
+      shuttle_.push_result(std::move(result));
     }
   }
 
@@ -247,6 +292,16 @@ class DataLoaderBase {
   // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
   detail::DataShuttle<Job, Result> shuttle_;
 
+  /// Queue of results awaiting the pinning stage; only used when the
+  /// `pin_memory` option is enabled.
+  // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+  detail::Queue<Result> unpinned_results_;
+
+  /// The dedicated pinning thread, running the `pin_thread()` method. Only
+  /// started when the `pin_memory` option is enabled.
+  // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+  std::thread pin_thread_;
+
   /// The `Sequencer`, which handles optional ordering of batches.
   // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
   std::unique_ptr<detail::sequencers::Sequencer<Result>> sequencer_;
@@ -5,8 +5,12 @@
 #include <torch/csrc/utils/memory.h>
 #include <torch/data/datasets/stateful.h>
 #include <torch/data/samplers.h>
+#include <list>
+#include <mutex>
 #include <queue>
 #include <thread>
+#include <type_traits>
+#include <unordered_map>
 
 #include <torch/serialize.h>
 
@@ -247,6 +251,91 @@ class BatchDataBuffer {
   // the program to hang. This boolean is used to break this waiting condition.
   bool stop_ = false;
 };
+
+/// A bounded, thread-safe cache of decoded chunks keyed by chunk index, with
+/// least-recently-used eviction. Chunks are moved out of the preloaders when
+/// they are split into batches, so cached entries are stored by value and
+/// handed out as copies; the cache only pays off when decoding a chunk costs
+/// more than copying it, which is the case for compressed chunk formats.
+template <typename ChunkType>
+class ChunkCache {
+ public:
+  explicit ChunkCache(size_t capacity) : capacity_(capacity) {}
+
+  /// Returns a copy of the cached chunk at `chunk_index`, or an empty
+  /// optional on a miss. A hit refreshes the chunk's eviction order.
+  optional<ChunkType> lookup(size_t chunk_index) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(chunk_index);
+    if (it == entries_.end()) {
+      return nullopt;
+    }
+    order_.splice(order_.begin(), order_, it->second.order_iterator);
+    return it->second.chunk;
+  }
+
+  /// Inserts a copy of `chunk` under `chunk_index`, evicting the least
+  /// recently used entries if the cache is full.
+  void insert(size_t chunk_index, const ChunkType& chunk) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entries_.count(chunk_index) > 0) {
+      return;
+    }
+    while (entries_.size() >= capacity_) {
+      entries_.erase(order_.back());
+      order_.pop_back();
+    }
+    order_.push_front(chunk_index);
+    entries_.emplace(chunk_index, Entry{chunk, order_.begin()});
+  }
+
+ private:
+  struct Entry {
+    ChunkType chunk;
+    std::list<size_t>::iterator order_iterator;
+  };
+
+  const size_t capacity_;
+  std::mutex mutex_;
+  /// Chunk indices in most-recently-used-first order.
+  std::list<size_t> order_;
+  std::unordered_map<size_t, Entry> entries_;
+};
+
+/// Overloads that turn cache operations into no-ops for chunk types that
+/// cannot be copied, so that move-only chunk types keep compiling as long as
+/// the cache stays disabled.
+template <typename ChunkType>
+typename std::enable_if<
+    std::is_copy_constructible<ChunkType>::value,
+    optional<ChunkType>>::type
+cache_lookup(ChunkCache<ChunkType>& cache, size_t chunk_index) {
+  return cache.lookup(chunk_index);
+}
+
+template <typename ChunkType>
+typename std::enable_if<
+    !std::is_copy_constructible<ChunkType>::value,
+    optional<ChunkType>>::type
+cache_lookup(ChunkCache<ChunkType>& /* cache */, size_t /* chunk_index */) {
+  return nullopt;
+}
+
+template <typename ChunkType>
+typename std::enable_if<std::is_copy_constructible<ChunkType>::value>::type
+cache_insert(
+    ChunkCache<ChunkType>& cache,
+    size_t chunk_index,
+    const ChunkType& chunk) {
+  cache.insert(chunk_index, chunk);
+}
+
+template <typename ChunkType>
+typename std::enable_if<!std::is_copy_constructible<ChunkType>::value>::type
+cache_insert(
+    ChunkCache<ChunkType>& /* cache */,
+    size_t /* chunk_index */,
+    const ChunkType& /* chunk */) {}
 } // namespace detail
 
 /// Options to configure a `ChunkDataset`.
@@ -256,11 +345,13 @@ struct ChunkDatasetOptions {
       size_t preloader_count,
       size_t batch_size,
       size_t cache_size = 2048,
-      size_t cross_chunk_shuffle_count = 1)
+      size_t cross_chunk_shuffle_count = 1,
+      size_t chunk_cache_count = 0)
       : preloader_count_(preloader_count),
         batch_size_(batch_size),
         cache_size_(cache_size),
-        cross_chunk_shuffle_count_(cross_chunk_shuffle_count) {
+        cross_chunk_shuffle_count_(cross_chunk_shuffle_count),
+        chunk_cache_count_(chunk_cache_count) {
     TORCH_CHECK(
         preloader_count_ > 0,
         "Preloader count is 0. At least one preloader needs to be specified.");
@@ -298,6 +389,14 @@ struct ChunkDatasetOptions {
   // penalty when this value is greater than 1, as we need to do extra merge
   // between multiple chunks before performing example sampling.
   TORCH_ARG(size_t, cross_chunk_shuffle_count) = 1;
+
+  // The number of decoded chunks to keep in a least-recently-used cache
+  // shared by the preloader threads. When greater than 0, preloaders consult
+  // the cache before asking the chunk reader, so chunks revisited across
+  // epochs skip their decode (and disk read) entirely. Defaults to 0, which
+  // disables the cache. Only worthwhile when decoding a chunk is more
+  // expensive than copying it; requires the chunk type to be copyable.
+  TORCH_ARG(size_t, chunk_cache_count) = 0;
 };
 
 /// A stateful dataset that support hierarchical sampling and prefetching of
@@ -340,7 +439,12 @@ class ChunkDataset final
         preprocessing_policy_(preprocessing_policy),
         quit_worker_(false),
         running_preloaders_(0),
-        load_checkpoint_(false) {}
+        load_checkpoint_(false) {
+    if (options_.chunk_cache_count() > 0) {
+      chunk_cache_ = torch::make_unique<detail::ChunkCache<UnwrappedBatchType>>(
+          options_.chunk_cache_count());
+    }
+  }
 
   ~ChunkDataset() override {
     // stop batch buffer first.
@@ -444,9 +548,9 @@ class ChunkDataset final
             break;
           }
         }
-        UnwrappedBatchType data = chunk_reader_.read_chunk(chunk_idx[0]);
+        UnwrappedBatchType data = load_chunk(chunk_idx[0]);
         for (const auto i : c10::irange(1, chunk_idx.size())) {
-          auto chunk_data = chunk_reader_.read_chunk(chunk_idx[i]);
+          auto chunk_data = load_chunk(chunk_idx[i]);
           std::move(
               chunk_data.begin(), chunk_data.end(), std::back_inserter(data));
         }
@@ -468,6 +572,21 @@ class ChunkDataset final
     }
   }
 
+  /// Loads a single chunk, serving it from the decoded-chunk cache when the
+  /// `chunk_cache_count` option is enabled and the chunk is present.
+  UnwrappedBatchType load_chunk(size_t chunk_index) {
+    if (chunk_cache_) {
+      if (auto cached = detail::cache_lookup(*chunk_cache_, chunk_index)) {
+        return std::move(*cached);
+      }
+    }
+    UnwrappedBatchType chunk = chunk_reader_.read_chunk(chunk_index);
+    if (chunk_cache_) {
+      detail::cache_insert(*chunk_cache_, chunk_index, chunk);
+    }
+    return chunk;
+  }
+
   /// Block the current thread until the workers finish execution and exit.
   void free_workers() {
     if (!quit_worker_.load()) {
@@ -498,6 +617,10 @@ class ChunkDataset final
   // worker thread pool
   std::vector<std::thread> preload_threads_;
 
+  // bounded least-recently-used cache of decoded chunks, shared by the
+  // preloader threads. Null unless the `chunk_cache_count` option is set.
+  std::unique_ptr<detail::ChunkCache<UnwrappedBatchType>> chunk_cache_;
+
   /// The options the Dataset was configured with.
   const ChunkDatasetOptions options_;
 
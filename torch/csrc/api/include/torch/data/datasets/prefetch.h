@@ -0,0 +1,252 @@
+#pragma once
+
+#include <torch/arg.h>
+#include <torch/data/datasets/stateful.h>
+#include <torch/types.h>
+
+#include <c10/util/Exception.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace torch {
+namespace data {
+namespace datasets {
+
+/// Options to configure a `PrefetchDataset`.
+template <typename BatchRequest = size_t>
+struct PrefetchOptions {
+  PrefetchOptions() = delete;
+  explicit PrefetchOptions(BatchRequest batch_request)
+      : batch_request_(std::move(batch_request)) {}
+
+  /// The batch request the prefetch worker issues to the source dataset.
+  /// Since batches are produced ahead of consumption, the request passed to
+  /// `get_batch()` at consumption time is ignored.
+  TORCH_ARG(BatchRequest, batch_request);
+
+  /// The maximum number of produced-but-unconsumed batches. Once this many
+  /// are in flight the worker blocks (or drops, see `drop_oldest`), so the
+  /// buffer never grows without bound.
+  TORCH_ARG(size_t, in_flight) = 2;
+
+  /// An optional limit on how long `get_batch()` waits for the worker. When
+  /// the wait times out an exception is raised, mirroring the `DataLoader`
+  /// queue's timeout behavior.
+  TORCH_ARG(optional<std::chrono::milliseconds>, timeout) = nullopt;
+
+  /// When true, a full buffer makes the worker discard the oldest unconsumed
+  /// batch instead of blocking, so a slow consumer always sees the freshest
+  /// data the source produced -- the usual choice for online training on a
+  /// live feed. When false (the default) the worker blocks, applying
+  /// backpressure to the source.
+  TORCH_ARG(bool, drop_oldest) = false;
+};
+
+/// A dataset wrapper that produces batches from a `StatefulDataset` on a
+/// background thread, keeping a bounded number of batches in flight so that
+/// jittery batch arrival at the source (e.g. a message queue) is hidden from
+/// the trainer.
+///
+/// The worker is (re)started by `reset()`, which the `DataLoader` calls at
+/// the beginning of every epoch, and runs until the source signals the end
+/// of its epoch by returning an empty optional. Exceptions thrown by the
+/// source are rethrown from `get_batch()`.
+///
+/// Note that checkpointing mid-epoch has an inherent skew: `save()`
+/// serializes the source's state as of the last batch the worker produced,
+/// so up to `in_flight` produced-but-unconsumed batches are not reflected in
+/// the checkpoint.
+template <typename SourceDataset>
+class PrefetchDataset : public StatefulDataset<
+                            PrefetchDataset<SourceDataset>,
+                            typename SourceDataset::BatchType::value_type,
+                            typename SourceDataset::BatchRequestType> {
+ public:
+  using UnderlyingBatchType = typename SourceDataset::BatchType::value_type;
+  using BatchRequestType = typename SourceDataset::BatchRequestType;
+
+  PrefetchDataset(
+      SourceDataset dataset,
+      PrefetchOptions<BatchRequestType> options)
+      : dataset_(std::move(dataset)), options_(std::move(options)) {
+    TORCH_CHECK(
+        options_.in_flight() > 0,
+        "in_flight is 0. At least one batch needs to be in flight.");
+  }
+
+  /// Only valid while no worker is running, i.e. before the first call to
+  /// `reset()`, which is when the `DataLoader` takes ownership.
+  PrefetchDataset(PrefetchDataset&& other)
+      : dataset_(std::move(other.dataset_)),
+        options_(std::move(other.options_)) {
+    AT_ASSERT(!other.worker_.joinable());
+  }
+  PrefetchDataset(const PrefetchDataset&) = delete;
+  PrefetchDataset& operator=(PrefetchDataset&&) = delete;
+  PrefetchDataset& operator=(const PrefetchDataset&) = delete;
+
+  ~PrefetchDataset() override {
+    stop_worker();
+  }
+
+  /// Stops any running worker, resets the source dataset and starts a fresh
+  /// worker for the new epoch.
+  void reset() override {
+    stop_worker();
+    dataset_.reset();
+    buffer_.clear();
+    exception_ = nullptr;
+    stop_requested_ = false;
+    source_exhausted_ = false;
+    dropped_ = 0;
+    worker_ = std::thread([this] { this->worker_loop(); });
+  }
+
+  /// Returns the next prefetched batch, blocking (up to the configured
+  /// `timeout`) until the worker has one ready, or an empty optional once
+  /// the source's epoch has ended and the buffer is drained.
+  optional<UnderlyingBatchType> get_batch(BatchRequestType /*request*/)
+      override {
+    TORCH_CHECK(
+        worker_.joinable(),
+        "PrefetchDataset::reset() must be called before get_batch()");
+    std::unique_lock<std::mutex> lock(mutex_);
+    const auto ready = [this] {
+      return !buffer_.empty() || source_exhausted_ || exception_ != nullptr;
+    };
+    if (options_.timeout()) {
+      if (!ready_cv_.wait_for(lock, *options_.timeout(), ready)) {
+        // clang-format off
+        AT_ERROR(
+            "Timeout in PrefetchDataset while waiting for next batch"
+            " (timeout was ", options_.timeout()->count(), " ms)");
+        // clang-format on
+      }
+    } else {
+      ready_cv_.wait(lock, ready);
+    }
+    if (exception_ != nullptr) {
+      std::rethrow_exception(exception_);
+    }
+    if (buffer_.empty()) {
+      return nullopt;
+    }
+    auto batch = std::move(buffer_.front());
+    buffer_.pop_front();
+    lock.unlock();
+    space_cv_.notify_one();
+    return batch;
+  }
+
+  /// The number of batches discarded so far this epoch under the
+  /// `drop_oldest` policy.
+  size_t dropped_batches() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return dropped_;
+  }
+
+  /// Serializes the source dataset's state, as of the last batch the worker
+  /// produced (see the class comment about checkpoint skew).
+  void save(serialize::OutputArchive& archive) const override {
+    std::lock_guard<std::mutex> lock(source_mutex_);
+    dataset_.save(archive);
+  }
+
+  /// Deserializes the source dataset's state. Call `reset()` afterwards to
+  /// start producing from the restored position.
+  void load(serialize::InputArchive& archive) override {
+    stop_worker();
+    dataset_.load(archive);
+  }
+
+ private:
+  void worker_loop() {
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        space_cv_.wait(lock, [this] {
+          return stop_requested_ || options_.drop_oldest() ||
+              buffer_.size() < options_.in_flight();
+        });
+        if (stop_requested_) {
+          return;
+        }
+      }
+      optional<UnderlyingBatchType> batch;
+      try {
+        std::lock_guard<std::mutex> source_lock(source_mutex_);
+        batch = dataset_.get_batch(options_.batch_request());
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        exception_ = std::current_exception();
+        ready_cv_.notify_all();
+        return;
+      }
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stop_requested_) {
+        return;
+      }
+      if (!batch) {
+        source_exhausted_ = true;
+        ready_cv_.notify_all();
+        return;
+      }
+      if (buffer_.size() >= options_.in_flight()) {
+        buffer_.pop_front();
+        ++dropped_;
+      }
+      buffer_.push_back(std::move(*batch));
+      ready_cv_.notify_one();
+    }
+  }
+
+  void stop_worker() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_requested_ = true;
+    }
+    space_cv_.notify_all();
+    if (worker_.joinable()) {
+      worker_.join();
+    }
+  }
+
+  SourceDataset dataset_;
+  PrefetchOptions<BatchRequestType> options_;
+
+  /// Held by the worker only while calling into the source, so `save()` can
+  /// serialize a consistent state without stopping production.
+  mutable std::mutex source_mutex_;
+
+  /// Guards all state below.
+  mutable std::mutex mutex_;
+  std::condition_variable ready_cv_;
+  std::condition_variable space_cv_;
+  std::deque<UnderlyingBatchType> buffer_;
+  std::exception_ptr exception_;
+  std::thread worker_;
+  bool stop_requested_ = false;
+  bool source_exhausted_ = false;
+  size_t dropped_ = 0;
+};
+
+/// Creates a `PrefetchDataset` that prefetches batches from `dataset` on a
+/// background thread.
+template <typename SourceDataset>
+PrefetchDataset<SourceDataset> prefetch(
+    SourceDataset dataset,
+    PrefetchOptions<typename SourceDataset::BatchRequestType> options) {
+  return PrefetchDataset<SourceDataset>(
+      std::move(dataset), std::move(options));
+}
+
+} // namespace datasets
+} // namespace data
+} // namespace torch
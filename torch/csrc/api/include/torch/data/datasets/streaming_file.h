@@ -0,0 +1,186 @@
+#pragma once
+
+#include <c10/util/Exception.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace torch {
+namespace data {
+namespace datasets {
+
+/// A sequential file reader for chunk data that keeps its reads out of the OS
+/// page cache, so that streaming a large dataset does not evict memory the
+/// rest of the process (e.g. model weights) depends on.
+///
+/// On Linux the file is opened with `O_DIRECT` when the filesystem supports
+/// it, reading through an internal block-aligned staging buffer. Where
+/// `O_DIRECT` is unavailable, it falls back to buffered reads followed by
+/// `posix_fadvise(POSIX_FADV_DONTNEED)` to promptly drop the consumed pages,
+/// with `POSIX_FADV_SEQUENTIAL` requesting aggressive readahead. On Windows
+/// it degrades to plain buffered reads.
+///
+/// Intended as a building block for `ChunkDataReader` implementations that
+/// stream chunks from disk.
+class StreamingFileReader {
+ public:
+  explicit StreamingFileReader(const std::string& path) {
+#ifdef _WIN32
+    stream_.open(path, std::ios::binary);
+    TORCH_CHECK(stream_.is_open(), "Failed to open file ", path);
+    stream_.seekg(0, std::ios::end);
+    file_size_ = static_cast<size_t>(stream_.tellg());
+    stream_.seekg(0, std::ios::beg);
+#else
+#ifdef O_DIRECT
+    fd_ = ::open(path.c_str(), O_RDONLY | O_DIRECT);
+#else
+    fd_ = -1;
+#endif
+    if (fd_ == -1) {
+      // Not all filesystems support O_DIRECT; fall back to advising the
+      // kernel to drop pages behind us instead.
+      fd_ = ::open(path.c_str(), O_RDONLY);
+      direct_ = false;
+    }
+    TORCH_CHECK(fd_ != -1, "Failed to open file ", path);
+    struct stat file_stat {};
+    TORCH_CHECK(
+        ::fstat(fd_, &file_stat) == 0, "Failed to stat file ", path);
+    file_size_ = static_cast<size_t>(file_stat.st_size);
+#ifdef POSIX_FADV_SEQUENTIAL
+    if (!direct_) {
+      ::posix_fadvise(fd_, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+#endif
+    void* staging = nullptr;
+    TORCH_CHECK(
+        ::posix_memalign(&staging, kAlignment, kStagingBytes) == 0,
+        "Failed to allocate staging buffer for file ",
+        path);
+    staging_ = static_cast<char*>(staging);
+#endif
+  }
+
+  StreamingFileReader(const StreamingFileReader&) = delete;
+  StreamingFileReader& operator=(const StreamingFileReader&) = delete;
+
+  ~StreamingFileReader() {
+#ifdef _WIN32
+    stream_.close();
+#else
+    if (staging_ != nullptr) {
+      std::free(staging_);
+    }
+    if (fd_ != -1) {
+      ::close(fd_);
+    }
+#endif
+  }
+
+  /// Reads up to `size` bytes at the current offset into `buffer`, advancing
+  /// the offset. Returns the number of bytes read, which is only less than
+  /// `size` at end of file.
+  size_t read(char* buffer, size_t size) {
+#ifdef _WIN32
+    stream_.read(buffer, static_cast<std::streamsize>(size));
+    const auto count = static_cast<size_t>(stream_.gcount());
+    offset_ += count;
+    return count;
+#else
+    size_t total = 0;
+    while (total < size && offset_ < file_size_) {
+      if (offset_ < staging_start_ ||
+          offset_ >= staging_start_ + staging_length_) {
+        if (!refill_staging()) {
+          break;
+        }
+      }
+      const size_t staging_offset = offset_ - staging_start_;
+      const size_t available = staging_length_ - staging_offset;
+      const size_t count = std::min(size - total, available);
+      std::memcpy(buffer + total, staging_ + staging_offset, count);
+      offset_ += count;
+      total += count;
+    }
+    return total;
+#endif
+  }
+
+  /// Moves the read offset to `offset`. Sequential access past the new
+  /// offset remains cheap; the staging buffer is reused when it still covers
+  /// the requested position.
+  void seek(size_t offset) {
+    offset_ = offset;
+#ifdef _WIN32
+    stream_.clear();
+    stream_.seekg(static_cast<std::streamoff>(offset));
+#endif
+  }
+
+  /// Returns the current read offset.
+  size_t offset() const noexcept {
+    return offset_;
+  }
+
+  /// Returns the total size of the file in bytes.
+  size_t size() const noexcept {
+    return file_size_;
+  }
+
+ private:
+#ifndef _WIN32
+  /// Refills the staging buffer with the block-aligned region covering the
+  /// current offset. Returns false at end of file or on a failed read.
+  bool refill_staging() {
+    const size_t aligned_offset = offset_ & ~(kAlignment - 1);
+    const ssize_t count =
+        ::pread(fd_, staging_, kStagingBytes, static_cast<off_t>(aligned_offset));
+    TORCH_CHECK(count >= 0, "Failed to read from file descriptor ", fd_);
+    if (count == 0) {
+      return false;
+    }
+#ifdef POSIX_FADV_DONTNEED
+    if (!direct_) {
+      // Drop the pages we just consumed so streaming the dataset does not
+      // push warmer memory out of the page cache.
+      ::posix_fadvise(
+          fd_, static_cast<off_t>(aligned_offset), count, POSIX_FADV_DONTNEED);
+    }
+#endif
+    staging_start_ = aligned_offset;
+    staging_length_ = static_cast<size_t>(count);
+    return true;
+  }
+
+  /// Alignment required by O_DIRECT for buffers, offsets, and lengths.
+  static constexpr size_t kAlignment = 4096;
+  /// Size of the staging buffer; one disk request per refill.
+  static constexpr size_t kStagingBytes = 1 << 20;
+
+  int fd_ = -1;
+  bool direct_ = true;
+  char* staging_ = nullptr;
+  size_t staging_start_ = 0;
+  size_t staging_length_ = 0;
+#else
+  std::ifstream stream_;
+#endif
+  size_t offset_ = 0;
+  size_t file_size_ = 0;
+};
+
+} // namespace datasets
+} // namespace data
+} // namespace torch
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <torch/data/example.h>
+#include <torch/types.h>
+
+#include <vector>
+
+namespace torch {
+namespace data {
+namespace detail {
+
+/// Helpers that copy the tensors of a batch into pinned (page-locked) memory
+/// so that subsequent host-to-device copies can run asynchronously. Pinned
+/// buffers come from the caching host allocator, so steady-state epochs
+/// recycle the same page-locked slots instead of registering fresh pages for
+/// every batch. Overloads exist for the batch shapes produced by the bundled
+/// datasets and transforms; the fallback leaves unknown types untouched.
+
+template <typename T>
+void pin_batch(T& /* batch */) {}
+
+inline void pin_batch(Tensor& tensor) {
+  if (tensor.defined() && tensor.device().is_cpu()) {
+    tensor = tensor.pin_memory();
+  }
+}
+
+template <typename Data, typename Target>
+void pin_batch(Example<Data, Target>& example) {
+  pin_batch(example.data);
+  pin_batch(example.target);
+}
+
+template <typename Data>
+void pin_batch(Example<Data, example::NoTarget>& example) {
+  pin_batch(example.data);
+}
+
+template <typename T>
+void pin_batch(std::vector<T>& batch) {
+  for (auto& example : batch) {
+    pin_batch(example);
+  }
+}
+
+} // namespace detail
+} // namespace data
+} // namespace torch
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <torch/csrc/Export.h>
+#include <torch/data/samplers/distributed.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace torch {
+namespace serialize {
+class OutputArchive;
+class InputArchive;
+} // namespace serialize
+} // namespace torch
+
+namespace torch {
+namespace data {
+namespace samplers {
+
+/// A `Sampler` that produces a pseudo-random permutation of `[0, size)`
+/// without materializing it.
+///
+/// `RandomSampler` and `DistributedRandomSampler` hold the full shuffled index
+/// array in memory, which costs O(dataset size) per sampler instance. For very
+/// large datasets consumed by many reader processes this duplicates gigabytes
+/// of indices. `StreamingRandomSampler` instead evaluates a bijective function
+/// (a small Feistel network over the index domain, with cycle-walking to
+/// discard values outside `[0, sample count)`) at each position, so its memory
+/// use is O(1) regardless of dataset size.
+///
+/// The permutation is a pure function of `(seed, epoch, size)`. Reader
+/// processes therefore need no shared index state to agree on the shuffle
+/// order: constructing the sampler with the same seed and calling
+/// `set_epoch()` with the same value on every process yields the same
+/// permutation everywhere, and each replica walks its own contiguous slice of
+/// it, exactly as `DistributedRandomSampler` does.
+class TORCH_API StreamingRandomSampler : public DistributedSampler<> {
+ public:
+  StreamingRandomSampler(
+      size_t size,
+      size_t num_replicas = 1,
+      size_t rank = 0,
+      bool allow_duplicates = true,
+      uint64_t seed = 0);
+
+  /// Resets the sampler to the beginning of this replica's slice, re-keying
+  /// the permutation from the current epoch.
+  void reset(optional<size_t> new_size = nullopt) override;
+
+  /// Returns the next batch of indices.
+  optional<std::vector<size_t>> next(size_t batch_size) override;
+
+  /// Serializes the `StreamingRandomSampler` to the `archive`.
+  void save(serialize::OutputArchive& archive) const override;
+
+  /// Deserializes the `StreamingRandomSampler` from the `archive`.
+  void load(serialize::InputArchive& archive) override;
+
+  /// Returns the current index of the `StreamingRandomSampler`.
+  size_t index() const noexcept;
+
+ private:
+  /// Derives the round keys for the current `(seed, epoch)` pair and the
+  /// Feistel half-width for the current sample count.
+  void rekey();
+
+  /// Maps a position in `[0, sample count)` to the index at that position of
+  /// the permutation.
+  size_t permute(size_t position) const;
+
+  /// One pass of the Feistel network over the padded power-of-two domain.
+  uint64_t feistel(uint64_t value) const;
+
+  uint64_t seed_;
+  size_t sample_count_;
+  size_t begin_index_;
+  size_t end_index_;
+  size_t sample_index_;
+  uint32_t half_bits_;
+  // NOLINTNEXTLINE(*-avoid-c-arrays)
+  uint64_t round_keys_[4];
+};
+
+} // namespace samplers
+} // namespace data
+} // namespace torch
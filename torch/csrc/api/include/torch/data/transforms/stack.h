@@ -4,6 +4,9 @@
 #include <torch/data/transforms/collate.h>
 #include <torch/types.h>
 
+#include <c10/util/irange.h>
+
+#include <cstddef>
 #include <utility>
 #include <vector>
 
@@ -44,6 +47,103 @@ struct Stack<TensorExample>
     return torch::stack(data);
   }
 };
+
+namespace detail {
+/// Allocates a batch buffer with room for `batch_size` samples shaped like
+/// `sample`, sharing the sample's dtype and device.
+inline Tensor allocate_stack_buffer(const Tensor& sample, size_t batch_size) {
+  std::vector<int64_t> sizes;
+  sizes.reserve(sample.dim() + 1);
+  sizes.push_back(static_cast<int64_t>(batch_size));
+  sizes.insert(sizes.end(), sample.sizes().begin(), sample.sizes().end());
+  return torch::empty(sizes, sample.options());
+}
+
+/// Returns true if `buffer` can hold a batch of `batch_size` samples shaped
+/// like `sample` without reallocating.
+inline bool stack_buffer_fits(
+    const Tensor& buffer,
+    const Tensor& sample,
+    size_t batch_size) {
+  return buffer.defined() &&
+      buffer.size(0) >= static_cast<int64_t>(batch_size) &&
+      buffer.sizes().slice(1) == sample.sizes() &&
+      buffer.scalar_type() == sample.scalar_type();
+}
+} // namespace detail
+
+template <typename T = Example<>>
+struct RecyclingStack;
+
+/// Like `Stack`, but copies samples into a ring of recycled, preallocated
+/// batch buffers instead of letting `torch::stack` allocate a fresh batch
+/// tensor every iteration. The returned batch aliases one of the ring's
+/// buffers and will be overwritten `ring_size` batches later, so `ring_size`
+/// must exceed the number of batches the consumer keeps alive at any one
+/// time. Note that the `DataLoader` copies the dataset (and with it this
+/// transform) into every worker thread, so each worker recycles its own ring
+/// and no synchronization is needed.
+template <>
+struct RecyclingStack<Example<>> : public Collation<Example<>> {
+  explicit RecyclingStack(size_t ring_size = 2) : buffers_(ring_size) {}
+
+  Example<> apply_batch(std::vector<Example<>> examples) override {
+    AT_ASSERT(!examples.empty());
+    const auto batch_size = static_cast<int64_t>(examples.size());
+    auto& buffer = buffers_[next_buffer_++ % buffers_.size()];
+    if (!detail::stack_buffer_fits(
+            buffer.data, examples.front().data, examples.size()) ||
+        !detail::stack_buffer_fits(
+            buffer.target, examples.front().target, examples.size())) {
+      buffer.data =
+          detail::allocate_stack_buffer(examples.front().data, examples.size());
+      buffer.target = detail::allocate_stack_buffer(
+          examples.front().target, examples.size());
+    }
+    for (const auto i : c10::irange(examples.size())) {
+      buffer.data.select(0, i).copy_(examples[i].data);
+      buffer.target.select(0, i).copy_(examples[i].target);
+    }
+    return {
+        buffer.data.narrow(0, 0, batch_size),
+        buffer.target.narrow(0, 0, batch_size)};
+  }
+
+ private:
+  struct Buffer {
+    Tensor data;
+    Tensor target;
+  };
+  std::vector<Buffer> buffers_;
+  size_t next_buffer_ = 0;
+};
+
+/// A `RecyclingStack` for `Example<Tensor, NoTarget>` types that recycles a
+/// ring of preallocated buffers for the data tensors.
+template <>
+struct RecyclingStack<TensorExample>
+    : public Collation<Example<Tensor, example::NoTarget>> {
+  explicit RecyclingStack(size_t ring_size = 2) : buffers_(ring_size) {}
+
+  TensorExample apply_batch(std::vector<TensorExample> examples) override {
+    AT_ASSERT(!examples.empty());
+    const auto batch_size = static_cast<int64_t>(examples.size());
+    auto& buffer = buffers_[next_buffer_++ % buffers_.size()];
+    if (!detail::stack_buffer_fits(
+            buffer, examples.front().data, examples.size())) {
+      buffer =
+          detail::allocate_stack_buffer(examples.front().data, examples.size());
+    }
+    for (const auto i : c10::irange(examples.size())) {
+      buffer.select(0, i).copy_(examples[i].data);
+    }
+    return buffer.narrow(0, 0, batch_size);
+  }
+
+ private:
+  std::vector<Tensor> buffers_;
+  size_t next_buffer_ = 0;
+};
 } // namespace transforms
 } // namespace data
 } // namespace torch
@@ -25,6 +25,12 @@ struct TORCH_API AdamOptions : public OptimizerCloneableOptions<AdamOptions> {
   TORCH_ARG(double, eps) = 1e-8;
   TORCH_ARG(double, weight_decay) = 0;
   TORCH_ARG(bool, amsgrad) = false;
+  /// When true, the step groups parameters by device and dtype and updates
+  /// each group through the fused `_foreach_` kernels, replacing the
+  /// per-parameter kernel launches with a handful of fused ones. This is a
+  /// runtime knob that does not change the update math; it is not serialized
+  /// and does not participate in options equality.
+  TORCH_ARG(bool, foreach) = false;
 
  public:
   void serialize(torch::serialize::InputArchive& archive) override;
@@ -88,6 +94,11 @@ class TORCH_API Adam : public Optimizer {
   void load(serialize::InputArchive& archive) override;
 
  private:
+  // Steps one param group through the fused `_foreach_` kernels. Used when
+  // `AdamOptions::foreach` is set; semantically identical to the per-parameter
+  // loop in `step`.
+  void _step_foreach_group(OptimizerParamGroup& group);
+
   template <typename Self, typename Archive>
   static void serialize(Self& self, Archive& archive) {
     _TORCH_OPTIM_SERIALIZE_WITH_TEMPLATE_ARG(Adam);
@@ -0,0 +1,147 @@
+#include <torch/data/samplers/streaming_random.h>
+#include <torch/serialize/archive.h>
+#include <torch/types.h>
+
+#include <c10/util/llvmMathExtras.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace torch {
+namespace data {
+namespace samplers {
+
+namespace {
+
+// Finalizer from the splitmix64 generator; mixes all input bits into all
+// output bits. Used both to derive round keys and as the Feistel round
+// function.
+uint64_t mix64(uint64_t x) {
+  x += 0x9e3779b97f4a7c15ULL;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+constexpr size_t kNumRounds = 4;
+
+} // namespace
+
+StreamingRandomSampler::StreamingRandomSampler(
+    size_t size,
+    size_t num_replicas,
+    size_t rank,
+    bool allow_duplicates,
+    uint64_t seed)
+    : DistributedSampler(size, num_replicas, rank, allow_duplicates),
+      seed_(seed),
+      sample_count_(0),
+      begin_index_(0),
+      end_index_(0),
+      sample_index_(0),
+      half_bits_(1),
+      round_keys_{} {
+  // key the permutation for epoch 0.
+  // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.VirtualCall)
+  reset(size_);
+}
+
+optional<std::vector<size_t>> StreamingRandomSampler::next(size_t batch_size) {
+  if (sample_index_ == end_index_) {
+    return nullopt;
+  }
+
+  size_t end = sample_index_ + batch_size;
+  if (end > end_index_) {
+    end = end_index_;
+  }
+
+  std::vector<size_t> res;
+  res.reserve(end - sample_index_);
+  for (; sample_index_ < end; ++sample_index_) {
+    res.push_back(permute(sample_index_));
+  }
+  return res;
+}
+
+void StreamingRandomSampler::reset(optional<size_t> new_size) {
+  size_ = new_size.value_or(size_);
+
+  size_t num_local_samples = local_sample_count();
+  sample_count_ = num_replicas_ == 1 ? size_ : num_local_samples * num_replicas_;
+  begin_index_ = rank_ * num_local_samples;
+  end_index_ = begin_index_ + num_local_samples;
+  sample_index_ = begin_index_;
+
+  rekey();
+}
+
+void StreamingRandomSampler::rekey() {
+  // The Feistel network operates on a balanced split of 2 * half_bits_ bits,
+  // the smallest even-width domain covering sample_count_. Cycle-walking in
+  // permute() maps the padded domain back onto [0, sample_count_).
+  const uint64_t bits = llvm::Log2_64_Ceil(std::max<size_t>(sample_count_, 2));
+  half_bits_ = static_cast<uint32_t>((bits + 1) / 2);
+  uint64_t state = seed_;
+  for (auto& round_key : round_keys_) {
+    state = mix64(state ^ mix64(static_cast<uint64_t>(epoch_)));
+    round_key = state;
+  }
+}
+
+uint64_t StreamingRandomSampler::feistel(uint64_t value) const {
+  const uint64_t half_mask = (uint64_t(1) << half_bits_) - 1;
+  uint64_t left = value >> half_bits_;
+  uint64_t right = value & half_mask;
+  for (const auto& round_key : round_keys_) {
+    const uint64_t next = left ^ (mix64(right ^ round_key) & half_mask);
+    left = right;
+    right = next;
+  }
+  return (left << half_bits_) | right;
+}
+
+size_t StreamingRandomSampler::permute(size_t position) const {
+  // Cycle-walk: the network permutes the padded power-of-two domain, so
+  // re-encrypting any out-of-range value must eventually land in range, in at
+  // most (padded domain / sample_count_) ~ 4 expected steps.
+  uint64_t value = position;
+  do {
+    value = feistel(value);
+  } while (value >= sample_count_);
+  // Wrap duplicated padding samples exactly like DistributedRandomSampler.
+  return static_cast<size_t>(value) % size_;
+}
+
+void StreamingRandomSampler::save(serialize::OutputArchive& archive) const {
+  archive.write(
+      "sample_index_",
+      torch::tensor(static_cast<int64_t>(sample_index_)),
+      /*is_buffer=*/true);
+  archive.write(
+      "epoch_",
+      torch::tensor(static_cast<int64_t>(epoch_)),
+      /*is_buffer=*/true);
+}
+
+void StreamingRandomSampler::load(serialize::InputArchive& archive) {
+  auto tensor = torch::empty(1, torch::kInt64);
+  archive.read("epoch_", tensor, /*is_buffer=*/true);
+  epoch_ = tensor.item<int64_t>();
+  // call reset() after loading epoch_ to re-key the permutation.
+  reset(size_);
+
+  tensor = torch::empty(1, torch::kInt64);
+  archive.read("sample_index_", tensor, /*is_buffer=*/true);
+  sample_index_ = tensor.item<int64_t>();
+}
+
+size_t StreamingRandomSampler::index() const noexcept {
+  return sample_index_;
+}
+
+} // namespace samplers
+} // namespace data
+} // namespace torch
@@ -78,6 +78,10 @@ Tensor Adam::step(LossClosure closure) {
     loss = closure();
   }
   for (auto& group : param_groups_) {
+    if (static_cast<AdamOptions&>(group.options()).foreach()) {
+      _step_foreach_group(group);
+      continue;
+    }
     for (auto& p : group.params()) {
       if (!p.grad().defined()) {
         continue;
@@ -144,6 +148,117 @@ Tensor Adam::step(LossClosure closure) {
   return loss;
 }
 
+void Adam::_step_foreach_group(OptimizerParamGroup& group) {
+  auto& options = static_cast<AdamOptions&>(group.options());
+  auto beta1 = std::get<0>(options.betas());
+  auto beta2 = std::get<1>(options.betas());
+
+  // Parameters are re-grouped by (device, dtype) on every step rather than at
+  // construction time, since gradients may appear or disappear between steps
+  // and params can migrate devices; the grouping cost is negligible next to
+  // the kernels it saves.
+  struct Bucket {
+    std::vector<Tensor> params;
+    std::vector<Tensor> grads;
+    std::vector<Tensor> exp_avgs;
+    std::vector<Tensor> exp_avg_sqs;
+    std::vector<Tensor> max_exp_avg_sqs;
+    std::vector<double> bias_correction1;
+    std::vector<double> bias_correction2_sqrt;
+  };
+  std::vector<std::pair<std::pair<at::Device, at::ScalarType>, Bucket>>
+      buckets;
+
+  for (auto& p : group.params()) {
+    if (!p.grad().defined()) {
+      continue;
+    }
+    const auto& grad = p.grad();
+    TORCH_CHECK(!grad.is_sparse(), "Adam does not support sparse gradients" /*, please consider SparseAdam instead*/);
+    auto param_state =
+        state_.find(c10::guts::to_string(p.unsafeGetTensorImpl()));
+
+    // State initialization
+    if (param_state == state_.end()) {
+      auto state = std::make_unique<AdamParamState>();
+      state->step(0);
+      // Exponential moving average of gradient values
+      state->exp_avg(torch::zeros_like(p, MemoryFormat::Preserve));
+      // Exponential moving average of squared gradient values
+      state->exp_avg_sq(torch::zeros_like(p, MemoryFormat::Preserve));
+      if (options.amsgrad()) {
+        // Maintains max of all exp. moving avg. of sq. grad. values
+        state->max_exp_avg_sq(torch::zeros_like(p, MemoryFormat::Preserve));
+      }
+      state_[c10::guts::to_string(p.unsafeGetTensorImpl())] = std::move(state);
+    }
+
+    auto& state = static_cast<AdamParamState&>(
+        *state_[c10::guts::to_string(p.unsafeGetTensorImpl())]);
+    state.step(state.step() + 1);
+
+    const auto key = std::make_pair(p.device(), p.scalar_type());
+    Bucket* bucket = nullptr;
+    for (auto& entry : buckets) {
+      if (entry.first == key) {
+        bucket = &entry.second;
+        break;
+      }
+    }
+    if (bucket == nullptr) {
+      buckets.emplace_back(key, Bucket());
+      bucket = &buckets.back().second;
+    }
+    bucket->params.push_back(p);
+    bucket->grads.push_back(grad);
+    bucket->exp_avgs.push_back(state.exp_avg());
+    bucket->exp_avg_sqs.push_back(state.exp_avg_sq());
+    if (options.amsgrad()) {
+      bucket->max_exp_avg_sqs.push_back(state.max_exp_avg_sq());
+    }
+    bucket->bias_correction1.push_back(1 - std::pow(beta1, state.step()));
+    bucket->bias_correction2_sqrt.push_back(
+        std::sqrt(1 - std::pow(beta2, state.step())));
+  }
+
+  for (auto& entry : buckets) {
+    auto& bucket = entry.second;
+
+    auto grads = bucket.grads;
+    if (options.weight_decay() != 0) {
+      grads = at::_foreach_add(grads, bucket.params, options.weight_decay());
+    }
+
+    // Decay the first and second moment running average coefficient
+    at::_foreach_mul_(bucket.exp_avgs, beta1);
+    at::_foreach_add_(bucket.exp_avgs, grads, 1 - beta1);
+    at::_foreach_mul_(bucket.exp_avg_sqs, beta2);
+    at::_foreach_addcmul_(bucket.exp_avg_sqs, grads, grads, 1 - beta2);
+
+    std::vector<Tensor> denom;
+    if (options.amsgrad()) {
+      // Maintains the maximum of all 2nd moment running avg. till now
+      at::_foreach_maximum_(bucket.max_exp_avg_sqs, bucket.exp_avg_sqs);
+      // Use the max. for normalizing running avg. of gradient
+      denom = at::_foreach_sqrt(bucket.max_exp_avg_sqs);
+    } else {
+      denom = at::_foreach_sqrt(bucket.exp_avg_sqs);
+    }
+    std::vector<Scalar> bias_correction2_sqrt(
+        bucket.bias_correction2_sqrt.begin(),
+        bucket.bias_correction2_sqrt.end());
+    at::_foreach_div_(denom, bias_correction2_sqrt);
+    at::_foreach_add_(denom, options.eps());
+
+    std::vector<Scalar> step_sizes;
+    step_sizes.reserve(bucket.bias_correction1.size());
+    for (const auto bias_correction1 : bucket.bias_correction1) {
+      step_sizes.emplace_back(-options.lr() / bias_correction1);
+    }
+    at::_foreach_addcdiv_(bucket.params, bucket.exp_avgs, denom, step_sizes);
+  }
+}
+
 void Adam::save(serialize::OutputArchive& archive) const {
   serialize(*this, archive);
 }
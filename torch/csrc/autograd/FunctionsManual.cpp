@@ -4723,6 +4723,46 @@ std::tuple<Tensor, Tensor, Tensor> layer_norm_double_backward(
   return std::tuple<Tensor, Tensor, Tensor>{gI, gG, ggO};
 }
 
+std::tuple<Tensor, Tensor, Tensor, Tensor> fused_dropout_add_layer_norm_backward(
+    const Tensor& grad_out,
+    const Tensor& dropout_add,
+    c10::SymIntArrayRef normalized_shape,
+    const c10::optional<Tensor>& weight,
+    const c10::optional<Tensor>& bias,
+    const Tensor& mask,
+    const Tensor& mean,
+    const Tensor& rstd,
+    double p,
+    bool train,
+    std::array<bool, 4> grad_input_mask) {
+  // dropout_add is the LayerNorm input, so its gradient comes straight from
+  // native_layer_norm_backward. It doubles as the residual gradient, and the
+  // input gradient only needs the dropout mask applied on top.
+  const bool any_residual_grad = grad_input_mask[0] || grad_input_mask[1];
+  auto ln_grads = at::native_layer_norm_backward_symint(
+      grad_out,
+      dropout_add,
+      normalized_shape,
+      mean,
+      rstd,
+      weight,
+      bias,
+      {any_residual_grad, grad_input_mask[2], grad_input_mask[3]});
+  Tensor d_residual = std::get<0>(ln_grads);
+  Tensor d_input;
+  if (grad_input_mask[0] && d_residual.defined()) {
+    d_input = train
+        ? at::native_dropout_backward(
+              d_residual, mask, p == 1 ? 0.0 : 1.0 / (1.0 - p))
+        : d_residual;
+  }
+  return std::make_tuple(
+      std::move(d_input),
+      grad_input_mask[1] ? std::move(d_residual) : Tensor(),
+      std::move(std::get<1>(ln_grads)),
+      std::move(std::get<2>(ln_grads)));
+}
+
 std::tuple<Tensor, Tensor, Tensor>
 infinitely_differentiable_native_group_norm_backward(
     const Tensor& dY,
@@ -767,6 +767,18 @@ std::tuple<Tensor, Tensor, Tensor> layer_norm_double_backward(
     const Tensor& save_invstd,
     c10::SymIntArrayRef normalized_shape,
     std::array<bool, 3> output_mask);
+std::tuple<Tensor, Tensor, Tensor, Tensor> fused_dropout_add_layer_norm_backward(
+    const Tensor& grad_out,
+    const Tensor& dropout_add,
+    c10::SymIntArrayRef normalized_shape,
+    const c10::optional<Tensor>& weight,
+    const c10::optional<Tensor>& bias,
+    const Tensor& mask,
+    const Tensor& mean,
+    const Tensor& rstd,
+    double p,
+    bool train,
+    std::array<bool, 4> grad_input_mask);
 
 std::tuple<Tensor, Tensor> householder_product_backward(
     const Tensor& grad,
@@ -3,8 +3,10 @@
 #include <torch/csrc/autograd/anomaly_mode.h>
 #include <torch/csrc/autograd/autograd.h>
 #include <torch/csrc/autograd/function.h>
+#include <torch/csrc/autograd/functions/accumulate_grad.h>
 #include <torch/csrc/autograd/functions/basic_ops.h>
 #include <torch/csrc/autograd/grad_mode.h>
+#include <torch/csrc/autograd/saved_variable_offload_hooks.h>
 #include <torch/csrc/autograd/variable.h>
 #include <torch/csrc/utils/memory.h>
 
@@ -24,6 +26,7 @@
 #include <c10/core/Event.h>
 #include <c10/core/Stream.h>
 #include <c10/core/StreamGuard.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
 #include <c10/util/Exception.h>
 #include <c10/util/Optional.h>
 #include <c10/util/ThreadLocal.h>
@@ -33,6 +36,7 @@
 #include <chrono>
 #include <condition_variable>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -74,6 +78,93 @@ inline bool should_run_in_cpu_ready_queue(c10::DeviceType device) {
     return false;
   }
 }
+
+// Number of CPU workers (including the calling thread) a graph task should
+// use for its CPU nodes, as configured via TORCH_AUTOGRAD_CPU_WORKERS.
+// Values below 2 keep the classic single-threaded CPU execution.
+// See Note [CPU work stealing]
+size_t num_cpu_work_stealing_workers() {
+  static size_t num_workers = []() -> size_t {
+    const auto* env = getenv("TORCH_AUTOGRAD_CPU_WORKERS");
+    if (!env) {
+      return 0;
+    }
+    int val = std::atoi(env);
+    if (val < 2) {
+      return 0;
+    }
+    auto max_workers = std::thread::hardware_concurrency();
+    if (max_workers != 0 && static_cast<unsigned int>(val) > max_workers) {
+      val = static_cast<int>(max_workers);
+    }
+    return static_cast<size_t>(val);
+  }();
+  return num_workers;
+}
+
+// Whether repeated backwards may reuse the cached dependency topology of
+// the previous backward over the same graph, as configured via
+// TORCH_AUTOGRAD_CACHE_GRAPH_TASK. See Note [Cached graph task topology]
+bool graph_topology_cache_enabled() {
+  static bool enabled = []() {
+    const auto* env = getenv("TORCH_AUTOGRAD_CACHE_GRAPH_TASK");
+    return env != nullptr && strcmp(env, "1") == 0;
+  }();
+  return enabled;
+}
+
+// Whether ready tasks are ordered by how much memory they are expected to
+// release, as configured via TORCH_AUTOGRAD_MEMORY_PRIORITY.
+// See Note [Memory-aware backward scheduling]
+bool memory_priority_enabled() {
+  static bool enabled = []() {
+    const auto* env = getenv("TORCH_AUTOGRAD_MEMORY_PRIORITY");
+    return env != nullptr && strcmp(env, "1") == 0;
+  }();
+  return enabled;
+}
+
+// Bytes running `fn` is expected to release: the accumulated gradient
+// inputs it consumes minus the gradients it produces for its next
+// functions, both read off InputMetadata.
+// See Note [Memory-aware backward scheduling]
+int64_t node_memory_release_score(Node* fn) {
+  int64_t score = 0;
+  for (const auto i : c10::irange(fn->num_inputs())) {
+    score += static_cast<int64_t>(fn->input_metadata(i).nbytes_hint());
+  }
+  for (const auto& edge : fn->next_edges()) {
+    if (edge.function && edge.input_nr < edge.function->num_inputs()) {
+      score -= static_cast<int64_t>(
+          edge.function->input_metadata(edge.input_nr).nbytes_hint());
+    }
+  }
+  return score;
+}
+
+// Number of pool streams per device that independent branches of a backward
+// graph are spread over, as configured via TORCH_AUTOGRAD_STREAM_POOL.
+// Values below 2 keep the classic behavior of running every node on its
+// forward stream. See Note [Stream-parallel backwards]
+size_t num_backward_pool_streams() {
+  static size_t num_streams = []() -> size_t {
+    const auto* env = getenv("TORCH_AUTOGRAD_STREAM_POOL");
+    if (!env) {
+      return 0;
+    }
+    int val = std::atoi(env);
+    if (val < 2) {
+      return 0;
+    }
+    // The global pool holds 32 streams per device; more assignments than
+    // that would just alias pool streams.
+    if (val > 32) {
+      val = 32;
+    }
+    return static_cast<size_t>(val);
+  }();
+  return num_streams;
+}
 } // namespace
 
 // Threads spawned by the engine are assigned a 'worker_device' specifying
@@ -210,6 +301,9 @@ CheckpointValidGuard::~CheckpointValidGuard() {
 }
 
 auto ReadyQueue::push(NodeTask item, bool incrementOutstandingTasks) -> void {
+  if (memory_priority_enabled() && item.fn_) {
+    item.mem_release_score_ = node_memory_release_score(item.fn_.get());
+  }
   {
     // Lock mutex for writing to heap_
     std::lock_guard<std::mutex> lock(mutex_);
@@ -253,6 +347,77 @@ bool ReadyQueue::empty() const {
   return heap_.empty();
 }
 
+CpuWorkStealingPool::CpuWorkStealingPool(size_t num_workers) {
+  TORCH_INTERNAL_ASSERT(num_workers > 1);
+  workers_.reserve(num_workers);
+  for (const auto i : c10::irange(num_workers)) {
+    (void)i;
+    workers_.emplace_back(std::make_unique<Worker>());
+  }
+}
+
+void CpuWorkStealingPool::push(NodeTask item) {
+  {
+    std::shared_ptr<GraphTask> graph_task = item.base_.lock();
+    TORCH_INTERNAL_ASSERT(graph_task, "GraphTask is no longer valid!");
+    ++graph_task->outstanding_tasks_;
+  }
+  auto& worker = *workers_[next_worker_.fetch_add(1) % workers_.size()];
+  {
+    std::lock_guard<std::mutex> lock(worker.mutex_);
+    worker.deque_.push_back(std::move(item));
+  }
+  {
+    // pending_ is bumped with sleep_mutex_ held so that a worker which just
+    // found all deques empty cannot fall asleep between re-checking the
+    // predicate and blocking, missing this notification.
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    pending_.fetch_add(1);
+  }
+  not_empty_.notify_one();
+}
+
+c10::optional<NodeTask> CpuWorkStealingPool::pop(size_t worker_id) {
+  while (true) {
+    if (pending_.load() > 0) {
+      // Scan our own deque first (from the front), then the siblings'
+      // (from the back) in index order starting after worker_id.
+      for (const auto i : c10::irange(workers_.size())) {
+        auto& worker = *workers_[(worker_id + i) % workers_.size()];
+        std::lock_guard<std::mutex> lock(worker.mutex_);
+        if (worker.deque_.empty()) {
+          continue;
+        }
+        c10::optional<NodeTask> task;
+        if (i == 0) {
+          task.emplace(std::move(worker.deque_.front()));
+          worker.deque_.pop_front();
+        } else {
+          task.emplace(std::move(worker.deque_.back()));
+          worker.deque_.pop_back();
+        }
+        pending_.fetch_sub(1);
+        return task;
+      }
+      // Another worker raced us to the task(s); fall through and sleep.
+    }
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    not_empty_.wait(
+        lock, [this] { return pending_.load() > 0 || shutdown_.load(); });
+    if (shutdown_.load()) {
+      return c10::nullopt;
+    }
+  }
+}
+
+void CpuWorkStealingPool::shutdown() {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    shutdown_.store(true);
+  }
+  not_empty_.notify_all();
+}
+
 Engine::Engine()
     : max_recursion_depth_(MAX_DEPTH), non_reentrant_device_thread_count_(0) {}
 
@@ -387,6 +552,10 @@ int get_current_graph_task_id() {
   return current_graph_task ? current_graph_task->id_ : -1;
 }
 
+std::shared_ptr<GraphTask> get_current_graph_task() {
+  return current_graph_task;
+}
+
 bool get_current_graph_task_keep_graph() {
   return current_graph_task ? current_graph_task->keep_graph_ : true;
 }
@@ -567,7 +736,12 @@ auto Engine::thread_main(const std::shared_ptr<GraphTask>& graph_task) -> void {
       // before it gets to the task, but it's a no-op anyway.
       //
       // NB: This is not necessary if the current thread is the owning thread.
-      if (worker_device != base_owner) {
+      if (local_graph_task->cpu_work_stealing_pool_) {
+        // The CPU workers of this graph task (including the owning thread)
+        // sleep on the work stealing pool instead of a ReadyQueue, so wake
+        // them through the pool. See Note [CPU work stealing]
+        local_graph_task->cpu_work_stealing_pool_->shutdown();
+      } else if (worker_device != base_owner) {
         // Synchronize outstanding_tasks_ with queue mutex
         std::atomic_thread_fence(std::memory_order_release);
         ready_queue_by_index(local_graph_task->cpu_ready_queue_, base_owner)
@@ -577,6 +751,70 @@ auto Engine::thread_main(const std::shared_ptr<GraphTask>& graph_task) -> void {
   }
 }
 
+// Worker loop for the per-GraphTask CPU work stealing pool; mirrors the
+// execution loop of thread_main, but draws tasks from the pool's deques
+// instead of a single shared ReadyQueue and exits once the pool is shut
+// down on completion of the graph task. Only ever runs tasks of the one
+// (non-reentrant) graph task that owns the pool.
+// See Note [CPU work stealing]
+void Engine::work_stealing_main(
+    const std::shared_ptr<GraphTask>& graph_task,
+    size_t worker_id) {
+  auto& pool = graph_task->cpu_work_stealing_pool_;
+  TORCH_INTERNAL_ASSERT(pool);
+  // evaluate_function takes a mutable reference to the graph task
+  std::shared_ptr<GraphTask> local_graph_task = graph_task;
+  while (!graph_task->future_result_->completed()) {
+    {
+      // Scope the NodeTask so its inputs_ (references to grad tensors) are
+      // released before we decrement outstanding_tasks_, like thread_main.
+      c10::optional<NodeTask> task = pool->pop(worker_id);
+      if (!task.has_value()) {
+        // The pool has been shut down: the graph task completed (possibly
+        // detected on a device thread).
+        break;
+      }
+      if (task->fn_ && !graph_task->has_error_.load()) {
+        // Set the ThreadLocalState before calling the function.
+        // NB: The ThreadLocalStateGuard doesn't set the grad_mode because
+        // GraphTask always saves ThreadLocalState without grad_mode.
+        at::ThreadLocalStateGuard tls_guard(graph_task->thread_locals_);
+        c10::WarningUtils::WarningHandlerGuard warnings_guard(
+            &graph_task->warning_handler_);
+
+        try {
+          GraphTaskGuard guard(graph_task);
+          NodeGuard ndguard(task->fn_);
+          {
+            RECORD_FUNCTION(
+                c10::str(
+                    "autograd::engine::evaluate_function: ",
+                    task->fn_.get()->name()),
+                c10::ArrayRef<const c10::IValue>());
+            evaluate_function(
+                local_graph_task,
+                task->fn_.get(),
+                task->inputs_,
+                graph_task->cpu_ready_queue_);
+          }
+        } catch (std::exception& e) {
+          thread_on_exception(graph_task, task->fn_, e);
+        }
+      }
+    }
+
+    // Decrement the outstanding tasks.
+    --graph_task->outstanding_tasks_;
+
+    // Check if we've completed execution.
+    if (graph_task->completed()) {
+      graph_task->mark_as_completed_and_run_post_processing();
+      // Wake the sibling workers so everyone can exit.
+      pool->shutdown();
+    }
+  }
+}
+
 // Reentrant call will re-use the graph_task's owner thread ready_queue for
 // queueing tasks (NOTE: this is not true in the async_mode of the engine).
 // While we can create separate ready queue for each new reentrant
@@ -712,6 +950,20 @@ void GraphTask::exec_post_processing() {
     // always saves ThreadLocalState without grad_mode.
     at::ThreadLocalStateGuard tls_guard(this->thread_locals_);
 
+    // Reduce deferred gradient contributions before user callbacks (e.g.
+    // optimizer steps) observe the grads. Runs on the caller's current
+    // streams, which are synced with leaf_streams above.
+    // See Note [Deferred gradient accumulation] in
+    // functions/accumulate_grad.h
+    {
+      std::unique_lock<std::mutex> deferred_lock(deferred_accumulators_lock_);
+      auto deferred_accumulators = std::move(deferred_accumulators_);
+      deferred_lock.unlock();
+      if (!deferred_accumulators.empty()) {
+        AccumulateGrad::flush_deferred_grads(deferred_accumulators);
+      }
+    }
+
     // WARNING: Don't use a range-for loop here because more callbacks may be
     // added in between callback calls, so iterators may become invalidated.
     // NOLINTNEXTLINE(modernize-loop-convert)
@@ -928,8 +1180,10 @@ void Engine::evaluate_function(
   // The InputBuffer::adds that supplied incoming grads took pains to
   // ensure they're safe to consume in the context of the present
   // func's stream (if applicable). So we guard onto that stream
-  // before working with the grads in any capacity.
-  const auto opt_parent_stream = (*func).stream(c10::DeviceType::CUDA);
+  // before working with the grads in any capacity. stream_for resolves to
+  // the node's pool assignment, if it has one.
+  // See Note [Stream-parallel backwards]
+  const auto opt_parent_stream = graph_task->stream_for(func);
   c10::OptionalStreamGuard parent_stream_guard{opt_parent_stream};
 
   // If exec_info_ is not empty, we have to instrument the execution
@@ -1026,14 +1280,22 @@ void Engine::evaluate_function(
       InputBuffer input_buffer(next.function->num_inputs());
 
       // Accumulates into buffer
-      const auto opt_next_stream = next.function->stream(c10::DeviceType::CUDA);
+      const auto opt_next_stream = graph_task->stream_for(next.function.get());
       input_buffer.add(
           next.input_nr, std::move(output), opt_parent_stream, opt_next_stream);
 
       if (is_ready) {
-        auto queue = ready_queue(cpu_ready_queue, input_buffer.device());
-        queue->push(
-            NodeTask(graph_task, next.function, std::move(input_buffer)));
+        // CPU tasks of a graph task with a work stealing pool go to the pool
+        // instead of its cpu_ready_queue_. See Note [CPU work stealing]
+        if (graph_task->cpu_work_stealing_pool_ &&
+            should_run_in_cpu_ready_queue(input_buffer.device().type())) {
+          graph_task->cpu_work_stealing_pool_->push(
+              NodeTask(graph_task, next.function, std::move(input_buffer)));
+        } else {
+          auto queue = ready_queue(cpu_ready_queue, input_buffer.device());
+          queue->push(
+              NodeTask(graph_task, next.function, std::move(input_buffer)));
+        }
       } else {
         not_ready.emplace(next.function.get(), std::move(input_buffer));
       }
@@ -1042,13 +1304,20 @@ void Engine::evaluate_function(
       auto& input_buffer = not_ready_it->second;
 
       // Accumulates into buffer
-      const auto opt_next_stream = next.function->stream(c10::DeviceType::CUDA);
+      const auto opt_next_stream = graph_task->stream_for(next.function.get());
       input_buffer.add(
           next.input_nr, std::move(output), opt_parent_stream, opt_next_stream);
       if (is_ready) {
-        auto queue = ready_queue(cpu_ready_queue, input_buffer.device());
-        queue->push(
-            NodeTask(graph_task, next.function, std::move(input_buffer)));
+        // See Note [CPU work stealing]
+        if (graph_task->cpu_work_stealing_pool_ &&
+            should_run_in_cpu_ready_queue(input_buffer.device().type())) {
+          graph_task->cpu_work_stealing_pool_->push(
+              NodeTask(graph_task, next.function, std::move(input_buffer)));
+        } else {
+          auto queue = ready_queue(cpu_ready_queue, input_buffer.device());
+          queue->push(
+              NodeTask(graph_task, next.function, std::move(input_buffer)));
+        }
         not_ready.erase(not_ready_it);
       }
     }
@@ -1068,6 +1337,28 @@ inline static uint64_t compute_min_topological_nr(const edge_list& outputs) {
   return min_topo_nr;
 }
 
+// Note [Stream-parallel backwards]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Per Note [Streaming backwards], every node runs on the stream that ran it
+// in forward. When the whole forward used one stream per device, backward
+// serializes on that stream too, even where the graph has independent
+// branches (e.g. the two towers of a two-tower model) that could overlap.
+// With TORCH_AUTOGRAD_STREAM_POOL=<n> (n >= 2), compute_dependencies colors
+// the graph while it walks it anyway: a node's sole successor inherits its
+// color, while each additional successor discovered at a fan-out starts a
+// fresh color, round-robin over n. Each colored node that recorded a CUDA
+// stream in forward is then assigned the pool stream of its color on that
+// device, and GraphTask::stream_for resolves to the assignment instead of
+// the forward stream everywhere the engine picks an execution or
+// accumulation stream. The event-based edges come for free: InputBuffer::add
+// already syncs the producer's stream with the consumer's whenever they
+// differ, and nodes that join branches see their inputs synced onto their
+// own assigned stream the same way. Leaf streams are recorded from the
+// assignments, so the usual exec_post_processing sync covers pool streams
+// as well.
+//
+// The assignments are written once here, before the root is enqueued, and
+// are read-only during execution, so stream_for needs no synchronization.
 auto Engine::compute_dependencies(
     Node* root,
     GraphTask& task,
@@ -1077,6 +1368,12 @@ auto Engine::compute_dependencies(
   bool might_use_cuda = at::globalContext().hasCUDA();
   bool will_use_cuda = false;
 
+  const size_t num_pool_streams = might_use_cuda ? num_backward_pool_streams() : 0;
+  // Branch colors propagate through CPU nodes too, so they are tracked for
+  // every node; only nodes with a forward CUDA stream get an assignment.
+  std::unordered_map<Node*, size_t> colors;
+  size_t next_color = 0;
+
   // Queue contains all nodes that will start propagating gradients.
   // We no longer have to expand functions that don't require grad.
   auto& dependencies = task.dependencies_;
@@ -1089,16 +1386,57 @@ auto Engine::compute_dependencies(
     if (might_use_cuda && !will_use_cuda) {
       will_use_cuda = fn->stream(c10::DeviceType::CUDA).has_value();
     }
+    bool fn_has_color = false;
+    size_t fn_color = 0;
+    if (num_pool_streams > 0) {
+      auto it = colors.find(fn);
+      if (it != colors.end()) {
+        fn_has_color = true;
+        fn_color = it->second;
+      }
+    }
+    bool first_new_successor = true;
     for (const auto& edge : fn->next_edges()) {
       if (auto next_ptr = edge.function.get()) {
         dependencies[next_ptr] += 1;
         const bool was_inserted = task.nodes_in_graph_.insert(next_ptr).second;
-        if (was_inserted)
+        if (was_inserted) {
           queue.push_back(next_ptr);
+          if (num_pool_streams > 0) {
+            // See Note [Stream-parallel backwards]
+            size_t color;
+            if (first_new_successor && fn_has_color) {
+              color = fn_color;
+            } else {
+              color = next_color++ % num_pool_streams;
+            }
+            first_new_successor = false;
+            colors.emplace(next_ptr, color);
+          }
+        }
       }
     }
   }
 
+  if (num_pool_streams > 0 && will_use_cuda) {
+    const c10::impl::VirtualGuardImpl guard_impl{c10::DeviceType::CUDA};
+    // Pool streams acquired so far, per device, indexed by color.
+    std::unordered_map<c10::DeviceIndex, std::vector<c10::Stream>> pool_streams;
+    for (const auto& entry : colors) {
+      const auto opt_stream = entry.first->stream(c10::DeviceType::CUDA);
+      if (!opt_stream) {
+        continue;
+      }
+      auto& device_streams = pool_streams[opt_stream->device_index()];
+      while (device_streams.size() <= entry.second) {
+        device_streams.push_back(guard_impl.getStreamFromGlobalPool(
+            c10::Device(c10::DeviceType::CUDA, opt_stream->device_index())));
+      }
+      task.stream_assignments_.emplace(
+          entry.first, device_streams[entry.second]);
+    }
+  }
+
   if (will_use_cuda) {
     // Collects current streams for devices where this process has a context,
     // so GraphTask::exec_post_processing can sync them with leaf_streams.
@@ -1106,6 +1444,114 @@ auto Engine::compute_dependencies(
   }
 }
 
+c10::optional<c10::Stream> GraphTask::stream_for(Node* fn) const {
+  const auto opt_stream = fn->stream(c10::DeviceType::CUDA);
+  // See Note [Stream-parallel backwards]
+  if (opt_stream && !stream_assignments_.empty()) {
+    auto it = stream_assignments_.find(fn);
+    if (it != stream_assignments_.end()) {
+      return it->second;
+    }
+  }
+  return opt_stream;
+}
+
+// Note [Cached graph task topology]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// compute_dependencies walks the whole graph on every Engine::execute call.
+// When the same retained graph is backpropagated repeatedly (backward with
+// retain_graph=True in a loop), that traversal recomputes identical
+// dependency counts each time, which costs on the order of a millisecond on
+// graphs with tens of thousands of nodes. With
+// TORCH_AUTOGRAD_CACHE_GRAPH_TASK=1 the engine keeps a pristine copy of the
+// dependencies_ and nodes_in_graph_ of the most recent backward, together
+// with a fingerprint of the roots and outputs it was computed for, and
+// copies it into the next graph task instead of re-traversing when the
+// fingerprint matches.
+//
+// The fingerprint holds the root nodes weakly and requires every one of
+// them to still lock to the same object: if all roots are alive, the whole
+// reachable graph is alive (roots own their next edges transitively) and
+// its structure is immutable after construction, so pointer identity of
+// roots plus the exact (function, input_nr) output list is sufficient
+// validation. A node pointer can only be recycled for a new node after the
+// old graph died, which the weak_ptrs detect. Freshly built graphs get new
+// nodes every iteration and therefore never produce false hits; they simply
+// refresh the cache each step.
+//
+// exec_info_ is intentionally not cached: its Capture entries carry
+// per-call grad capture hooks behind unique_ptrs, so init_to_execute still
+// runs when `inputs` was given. Caller current streams are re-stashed on
+// every hit since they belong to the calling thread, not the graph.
+bool Engine::try_reuse_cached_graph_topology(
+    const edge_list& root_edges,
+    const edge_list& outputs,
+    bool accumulate_grad,
+    uint64_t min_topo_nr,
+    GraphTask& task) {
+  if (!graph_topology_cache_enabled()) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(cached_graph_topology_mutex_);
+  auto* cached = cached_graph_topology_.get();
+  if (!cached || cached->accumulate_grad != accumulate_grad ||
+      cached->min_topo_nr != min_topo_nr ||
+      cached->root_edges.size() != root_edges.size() ||
+      cached->output_edges.size() != outputs.size()) {
+    return false;
+  }
+  for (const auto i : c10::irange(root_edges.size())) {
+    if (cached->root_edges[i].second != root_edges[i].input_nr ||
+        cached->root_edges[i].first.lock() != root_edges[i].function) {
+      return false;
+    }
+  }
+  for (const auto i : c10::irange(outputs.size())) {
+    if (cached->output_edges[i] !=
+        std::make_pair(outputs[i].function.get(), outputs[i].input_nr)) {
+      return false;
+    }
+  }
+  task.dependencies_ = cached->dependencies;
+  task.nodes_in_graph_ = cached->nodes_in_graph;
+  task.stream_assignments_ = cached->stream_assignments;
+  if (cached->will_use_cuda) {
+    // Streams belong to the caller of this backward, not to the graph, so
+    // they are collected fresh on every reuse.
+    task.stash_current_streams();
+  }
+  return true;
+}
+
+void Engine::cache_graph_topology(
+    const edge_list& root_edges,
+    const edge_list& outputs,
+    bool accumulate_grad,
+    uint64_t min_topo_nr,
+    const GraphTask& task) {
+  if (!graph_topology_cache_enabled()) {
+    return;
+  }
+  auto cached = std::make_unique<CachedGraphTopology>();
+  cached->root_edges.reserve(root_edges.size());
+  for (const auto& edge : root_edges) {
+    cached->root_edges.emplace_back(edge.function, edge.input_nr);
+  }
+  cached->output_edges.reserve(outputs.size());
+  for (const auto& edge : outputs) {
+    cached->output_edges.emplace_back(edge.function.get(), edge.input_nr);
+  }
+  cached->accumulate_grad = accumulate_grad;
+  cached->min_topo_nr = min_topo_nr;
+  cached->dependencies = task.dependencies_;
+  cached->nodes_in_graph = task.nodes_in_graph_;
+  cached->stream_assignments = task.stream_assignments_;
+  // compute_dependencies only stashes streams when it saw a CUDA node
+  cached->will_use_cuda = !task.caller_current_streams_.empty();
+  std::lock_guard<std::mutex> lock(cached_graph_topology_mutex_);
+  cached_graph_topology_ = std::move(cached);
+}
+
 auto Engine::execute(
     const edge_list& root_edges,
     const variable_list& inputs,
@@ -1154,6 +1600,17 @@ auto Engine::execute(
       /* cpu_ready_queue */ local_ready_queue,
       /* graph_roots */ std::move(temp_roots));
 
+  // Opt the graph task into the CPU work stealing pool if requested. Only
+  // non-reentrant backwards with multithreading enabled qualify; everything
+  // else keeps the classic single cpu_ready_queue_.
+  // See Note [CPU work stealing]
+  const auto num_ws_workers = num_cpu_work_stealing_workers();
+  if (num_ws_workers > 1 && not_reentrant_backward_call &&
+      c10::AutogradState::get_tls_state().get_multithreading_enabled()) {
+    graph_task->cpu_work_stealing_pool_ =
+        std::make_shared<CpuWorkStealingPool>(num_ws_workers);
+  }
+
   // If we receive a single root, skip creating extra root node
   bool skip_dummy_node = root_edges.size() == 1;
   auto graph_root = skip_dummy_node
@@ -1161,8 +1618,15 @@ auto Engine::execute(
       : std::make_shared<GraphRoot>(root_edges, inputs);
 
   auto min_topo_nr = compute_min_topological_nr(outputs);
-  // Now compute the dependencies for all executable functions
-  compute_dependencies(graph_root.get(), *graph_task, min_topo_nr);
+  // Now compute the dependencies for all executable functions, reusing the
+  // cached topology of the previous backward over the same graph if
+  // possible. See Note [Cached graph task topology]
+  if (!try_reuse_cached_graph_topology(
+          root_edges, outputs, accumulate_grad, min_topo_nr, *graph_task)) {
+    compute_dependencies(graph_root.get(), *graph_task, min_topo_nr);
+    cache_graph_topology(
+        root_edges, outputs, accumulate_grad, min_topo_nr, *graph_task);
+  }
 
   if (!outputs.empty()) {
     graph_task->init_to_execute(
@@ -1176,7 +1640,7 @@ auto Engine::execute(
 
     const auto input_stream = InputMetadata(input).stream();
     const auto opt_next_stream =
-        root_edges.at(0).function->stream(c10::DeviceType::CUDA);
+        graph_task->stream_for(root_edges.at(0).function.get());
     input_buffer.add(
         root_edges.at(0).input_nr,
         std::move(input),
@@ -1228,14 +1692,43 @@ c10::intrusive_ptr<at::ivalue::Future> Engine::execute_with_graph_task(
     graph_task->owner_ = worker_device;
 
     // Now that all the non-thread safe fields of the graph_task have been
-    // populated, we can enqueue it.
-    queue->push(
-        NodeTask(graph_task, std::move(graph_root), std::move(input_buffer)));
+    // populated, we can enqueue it. A CPU-bound root of a graph task with a
+    // work stealing pool goes to the pool like any other CPU task.
+    // See Note [CPU work stealing]
+    auto& pool = graph_task->cpu_work_stealing_pool_;
+    if (pool && should_run_in_cpu_ready_queue(input_buffer.device().type())) {
+      pool->push(
+          NodeTask(graph_task, std::move(graph_root), std::move(input_buffer)));
+    } else {
+      queue->push(
+          NodeTask(graph_task, std::move(graph_root), std::move(input_buffer)));
+    }
 
     // The owning thread start to drive the engine execution for any CPU task
     // that was just pushed or will be added later from other worker threads
     lock.unlock();
-    thread_main(graph_task);
+    if (pool) {
+      // The owning thread participates as worker 0; the helpers live for the
+      // duration of this one graph task and are joined before we return.
+      std::vector<std::thread> helpers;
+      helpers.reserve(pool->num_workers() - 1);
+      for (size_t i = 1; i < pool->num_workers(); ++i) {
+        helpers.emplace_back([this, graph_task, i]() {
+          at::init_num_threads();
+          set_device(CPU_DEVICE);
+          // Allocate a thread local ready queue in case a node does a
+          // reentrant backward from this helper thread.
+          init_local_ready_queue();
+          work_stealing_main(graph_task, i);
+        });
+      }
+      work_stealing_main(graph_task, /*worker_id=*/0);
+      for (auto& helper : helpers) {
+        helper.join();
+      }
+    } else {
+      thread_main(graph_task);
+    }
     TORCH_INTERNAL_ASSERT(graph_task->future_result_->completed());
     // reset the worker_device after the completion of the graph_task, this is
     // so that the initial state of the engine remains the same across every
@@ -1300,6 +1793,13 @@ Engine& Engine::get_default_engine() {
   return engine_stub.load()();
 }
 
+std::unique_ptr<SavedVariableHooks> Engine::get_default_saved_variable_hooks() {
+  if (saved_variable_offload_enabled()) {
+    return std::make_unique<CpuOffloadSavedVariableHooks>();
+  }
+  return nullptr;
+}
+
 void Engine::queue_callback(std::function<void()> callback) {
   TORCH_CHECK(
       current_graph_task,
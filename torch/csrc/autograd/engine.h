@@ -16,14 +16,19 @@
 #include <torch/csrc/autograd/utils/warnings.h>
 
 #include <c10/util/CallOnce.h>
+#include <c10/util/Optional.h>
 
+#include <atomic>
+#include <condition_variable>
 #include <deque>
 #include <exception>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -61,6 +66,11 @@ struct NodeTask {
   // exit. The engine sends a shutdown task to every queue upon its destruction.
   bool isShutdownTask_;
 
+  // How many bytes running fn_ is expected to release, net of the grads it
+  // produces. Zero unless the memory-aware policy is on; filled in by
+  // ReadyQueue::push. See Note [Memory-aware backward scheduling]
+  int64_t mem_release_score_ = 0;
+
   int getReentrantDepth() const;
 
   NodeTask(
@@ -86,6 +96,22 @@ class CheckpointValidGuard {
   bool prev_checkpoint_valid_state;
 };
 
+// Note [Memory-aware backward scheduling]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The ready queue orders tasks by reentrant depth and then sequence number,
+// which replays the forward pass roughly in reverse but knows nothing about
+// memory: when several branches are ready, a gradient-producing branch can
+// run long before the node that would have consumed (and freed) multi-GB
+// gradient buffers, inflating peak memory on large models. With
+// TORCH_AUTOGRAD_MEMORY_PRIORITY=1, ReadyQueue::push scores each task with
+// the bytes its node is about to release - the node's own accumulated
+// gradient inputs, whose sizes InputMetadata already records - minus the
+// bytes of the gradients it will produce, taken from its next functions'
+// InputMetadata. Ready tasks that free the most memory then pop first,
+// with sequence number as the tie break. Reentrant depth still dominates,
+// since reentrant correctness relies on it. The policy is process-wide
+// rather than a backward() argument because device ready queues are shared
+// by all concurrently running backwards.
 struct ReadyQueue {
  private:
   // Returns true when t2 should be (weakly) BEFORE t1 in the queue.
@@ -100,6 +126,12 @@ struct ReadyQueue {
       } else if (!t2.fn_) {
         return true;
       } else if (t1.getReentrantDepth() == t2.getReentrantDepth()) {
+        // Tasks expected to release more memory pop first; the scores are
+        // all zero unless the memory-aware policy is on.
+        // See Note [Memory-aware backward scheduling]
+        if (t1.mem_release_score_ != t2.mem_release_score_) {
+          return t1.mem_release_score_ < t2.mem_release_score_;
+        }
         return t1.fn_->sequence_nr() < t2.fn_->sequence_nr();
       } else {
         return t1.getReentrantDepth() < t2.getReentrantDepth();
@@ -127,6 +159,63 @@ struct ReadyQueue {
   size_t size() const;
 };
 
+// Note [CPU work stealing]
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+// By default all CPU nodes of a backward pass run on the single thread that
+// drives the GraphTask (see Note [Reentrant backwards]): device nodes fan
+// out to the per-device threads, but a backward graph dominated by many
+// small CPU nodes executes effectively single threaded no matter how many
+// cores are available. Setting TORCH_AUTOGRAD_CPU_WORKERS=N (N > 1) opts
+// non-reentrant graph tasks into a work stealing pool instead: the calling
+// thread plus N - 1 short-lived helper threads each own a private deque of
+// ready CPU tasks. New tasks are distributed round robin across the deques;
+// a worker pops from the front of its own deque and steals from the back of
+// a sibling's deque when its own runs dry.
+//
+// The pool is per GraphTask, so it only ever holds tasks of a single
+// non-reentrant backward; the reentrant-depth priority ordering that
+// ReadyQueue provides across nested graph tasks is not needed here and plain
+// FIFO deques are used. Reentrant backward calls and backwards run with
+// multithreading disabled keep the classic single cpu_ready_queue_.
+struct CpuWorkStealingPool {
+  explicit CpuWorkStealingPool(size_t num_workers);
+
+  // Pushes a CPU task onto one of the worker deques (round robin) and
+  // increments 'outstanding_tasks_' for the associated GraphTask, like
+  // ReadyQueue::push does.
+  void push(NodeTask item);
+  // Blocks until a task is available, first checking worker_id's own deque
+  // and then trying to steal from the siblings. Returns c10::nullopt once
+  // the pool has been shut down.
+  c10::optional<NodeTask> pop(size_t worker_id);
+  // Wakes all workers and makes subsequent pop() calls return c10::nullopt.
+  // Called when the owning GraphTask completes; safe to call multiple times.
+  void shutdown();
+
+  size_t num_workers() const {
+    return workers_.size();
+  }
+
+ private:
+  struct Worker {
+    // To protect reads and writes to deque_
+    std::mutex mutex_;
+    std::deque<NodeTask> deque_;
+  };
+  std::vector<std::unique_ptr<Worker>> workers_;
+
+  // Workers with nothing left to pop or steal sleep on not_empty_. pending_
+  // (the number of queued tasks across all deques) and shutdown_ are only
+  // modified with sleep_mutex_ held so that sleeping workers cannot miss a
+  // wakeup.
+  std::mutex sleep_mutex_;
+  std::condition_variable not_empty_;
+  std::atomic<int64_t> pending_{0};
+  std::atomic<bool> shutdown_{false};
+  // Round robin cursor for push()
+  std::atomic<size_t> next_worker_{0};
+};
+
 // A single instance of this struct should be created through the whole process
 // lifetime. The worker thread creation logic and Engine's destructor rely on
 // this.
@@ -164,9 +253,10 @@ struct TORCH_API Engine {
     return std::make_unique<AnomalyMetadata>();
   }
 
-  virtual std::unique_ptr<SavedVariableHooks> get_default_saved_variable_hooks() {
-    return nullptr;
-  }
+  // Returns the native CPU offload hooks when
+  // TORCH_AUTOGRAD_OFFLOAD_ACTIVATIONS is set, nullptr otherwise.
+  // See Note [Saved variable CPU offload]
+  virtual std::unique_ptr<SavedVariableHooks> get_default_saved_variable_hooks();
 
   // We pass cpu_ready_queue to evaluate_function, so that it knows
   // the correct ready queue to push to after a NodeTask is ready
@@ -220,7 +310,48 @@ struct TORCH_API Engine {
   void increment_non_reentrant_thread_count();
   void decrement_non_reentrant_thread_count();
   virtual void thread_main(const std::shared_ptr<GraphTask>& task);
+  // Worker loop for the per-GraphTask CPU work stealing pool.
+  // See Note [CPU work stealing]
+  void work_stealing_main(
+      const std::shared_ptr<GraphTask>& graph_task,
+      size_t worker_id);
   void reentrant_thread_init();
+
+  // Cached dependency topology of the most recent backward, reused across
+  // repeated backwards over the same retained graph when
+  // TORCH_AUTOGRAD_CACHE_GRAPH_TASK=1.
+  // See Note [Cached graph task topology]
+  struct CachedGraphTopology {
+    // Fingerprint: the exact roots and outputs the cached maps were computed
+    // for. Roots are held weakly so the cache does not keep a dead graph
+    // alive; all of them must still lock to the same nodes for a hit.
+    std::vector<std::pair<std::weak_ptr<Node>, uint32_t>> root_edges;
+    std::vector<std::pair<Node*, uint32_t>> output_edges;
+    bool accumulate_grad;
+    uint64_t min_topo_nr;
+    // Pristine copies; execution consumes GraphTask::dependencies_, so each
+    // hit copies these into the new graph task.
+    std::unordered_map<Node*, int> dependencies;
+    std::unordered_set<Node*> nodes_in_graph;
+    // See Note [Stream-parallel backwards]; empty unless
+    // TORCH_AUTOGRAD_STREAM_POOL is set. Assignments survive reuse because
+    // pool streams are process-lived and keyed by the same node pointers
+    // the fingerprint validates.
+    std::unordered_map<Node*, c10::Stream> stream_assignments;
+    bool will_use_cuda;
+  };
+  bool try_reuse_cached_graph_topology(
+      const edge_list& root_edges,
+      const edge_list& outputs,
+      bool accumulate_grad,
+      uint64_t min_topo_nr,
+      GraphTask& task);
+  void cache_graph_topology(
+      const edge_list& root_edges,
+      const edge_list& outputs,
+      bool accumulate_grad,
+      uint64_t min_topo_nr,
+      const GraphTask& task);
   void add_thread_pool_task(const std::weak_ptr<GraphTask>& graph_task);
 
   // Ensures device_ready_queues_ are initialized only once
@@ -267,6 +398,11 @@ struct TORCH_API Engine {
   std::shared_ptr<ThreadPoolShared> thread_pool_shared_;
 
  private:
+  // Most recent cached topology (single entry) and its guard.
+  // See Note [Cached graph task topology]
+  std::mutex cached_graph_topology_mutex_;
+  std::unique_ptr<CachedGraphTopology> cached_graph_topology_;
+
   // Number of non-reentrant threads
   std::atomic<uint32_t> non_reentrant_device_thread_count_;
   // Destructor will wait for non-reentrant threads to finish
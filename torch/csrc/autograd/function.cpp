@@ -8,7 +8,11 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -103,6 +107,128 @@ void deleteNode(Node* function) {
   }
 }
 
+// Note [Autograd node memory pool]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Every differentiable forward op allocates its backward Node (e.g. the
+// generated AddBackward0) individually on the heap via
+// `std::shared_ptr<T>(new T(...), deleteNode)`, and graph teardown after
+// backward() then frees tens of thousands of such objects one by one, which
+// shows up as multi-millisecond spikes on graphs with many small nodes.
+//
+// Since nodes are created during forward and only die when the last
+// reference to the graph drops, their lifetime is not tied to any single
+// GraphTask, so instead of a per-backward arena we recycle node storage
+// through a process wide pool: Node::operator new/delete round the
+// allocation up to a 64 byte size class and serve it from a per-class
+// intrusive free list, falling back to carving fresh blocks out of 64 KiB
+// slabs with a bump pointer. Freeing a node is an O(1) push onto its free
+// list, and the next forward pass pops the block right back off, so
+// steady-state training neither mallocs nor frees node storage. Slabs are
+// retained for the lifetime of the process (bounded by the high-water mark
+// of live nodes), mirroring how the CUDA caching allocator holds on to
+// device blocks. Nodes larger than the biggest size class (rare, e.g.
+// backwards saving many tensor lists) go to the system allocator; a header
+// word in front of every allocation records where it came from, so a node
+// may be freed on a different thread than the one that allocated it.
+//
+// Nodes created with std::make_shared (e.g. the engine's GraphRoot) do not
+// go through class operator new/delete and are unaffected. Set
+// TORCH_AUTOGRAD_NODE_POOL=0 to fall back to the system allocator entirely.
+namespace {
+
+// Blocks are handed out at kHeaderBytes past their base so the payload
+// keeps max_align_t alignment; the header word stores the size class.
+constexpr size_t kHeaderBytes = alignof(std::max_align_t);
+constexpr size_t kClassBytes = 64;
+constexpr size_t kNumSizeClasses = 16; // largest pooled block is 1 KiB
+constexpr size_t kSlabBytes = 64 * 1024;
+constexpr size_t kHeapClass = std::numeric_limits<size_t>::max();
+
+inline size_t size_class_of(size_t bytes) {
+  return (bytes + kClassBytes - 1) / kClassBytes - 1;
+}
+
+class NodeMemoryPool {
+ public:
+  static NodeMemoryPool& instance() {
+    static NodeMemoryPool pool;
+    return pool;
+  }
+
+  void* allocate(size_t size_class) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (void* block = free_lists_[size_class]) {
+      free_lists_[size_class] = *static_cast<void**>(block);
+      return block;
+    }
+    const size_t block_bytes = (size_class + 1) * kClassBytes;
+    if (slab_remaining_ < block_bytes) {
+      slabs_.emplace_back(new char[kSlabBytes]);
+      slab_cursor_ = slabs_.back().get();
+      slab_remaining_ = kSlabBytes;
+    }
+    void* block = slab_cursor_;
+    slab_cursor_ += block_bytes;
+    slab_remaining_ -= block_bytes;
+    return block;
+  }
+
+  void free(size_t size_class, void* block) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    *static_cast<void**>(block) = free_lists_[size_class];
+    free_lists_[size_class] = block;
+  }
+
+ private:
+  // Guards free_lists_ and the slab bump cursor: nodes can be allocated and
+  // freed from different threads (forward thread vs. engine workers or GC).
+  std::mutex mutex_;
+  // Per size class intrusive singly linked lists of recycled blocks; the
+  // next pointer lives in the block itself, so pushing and popping never
+  // allocates.
+  void* free_lists_[kNumSizeClasses] = {};
+  std::vector<std::unique_ptr<char[]>> slabs_;
+  char* slab_cursor_ = nullptr;
+  size_t slab_remaining_ = 0;
+};
+
+bool node_pool_enabled() {
+  static bool enabled = []() {
+    const auto* env = getenv("TORCH_AUTOGRAD_NODE_POOL");
+    return env == nullptr || strcmp(env, "0") != 0;
+  }();
+  return enabled;
+}
+
+} // namespace
+
+void* Node::operator new(std::size_t size) {
+  const size_t total = size + kHeaderBytes;
+  if (node_pool_enabled() && total <= kNumSizeClasses * kClassBytes) {
+    const size_t size_class = size_class_of(total);
+    auto* block =
+        static_cast<char*>(NodeMemoryPool::instance().allocate(size_class));
+    *reinterpret_cast<size_t*>(block) = size_class;
+    return block + kHeaderBytes;
+  }
+  auto* block = static_cast<char*>(::operator new(total));
+  *reinterpret_cast<size_t*>(block) = kHeapClass;
+  return block + kHeaderBytes;
+}
+
+void Node::operator delete(void* ptr) {
+  if (!ptr) {
+    return;
+  }
+  auto* block = static_cast<char*>(ptr) - kHeaderBytes;
+  const size_t size_class = *reinterpret_cast<size_t*>(block);
+  if (size_class == kHeapClass) {
+    ::operator delete(block);
+    return;
+  }
+  NodeMemoryPool::instance().free(size_class, block);
+}
+
 namespace {
 bool kAutogradFunctionExtensionEnabled = false;
 }
@@ -157,6 +157,14 @@ struct TORCH_API Node : std::enable_shared_from_this<Node> {
   Node& operator=(Node&& other) = delete;
   virtual ~Node() = default;
 
+  /// Nodes (and thus all the generated backward functions deriving from
+  /// them) are allocated one per differentiable op in forward and freed en
+  /// masse when the graph is torn down after backward, so their storage is
+  /// recycled through a size-classed pool instead of the system allocator.
+  /// See Note [Autograd node memory pool] in function.cpp.
+  static void* operator new(std::size_t size);
+  static void operator delete(void* ptr);
+
   std::shared_ptr<Node> getptr() {
     return shared_from_this();
   }
@@ -1,12 +1,23 @@
 #include <torch/csrc/autograd/functions/accumulate_grad.h>
 
+#include <c10/core/impl/VirtualGuardImpl.h>
 #include <torch/csrc/autograd/functions/basic_ops.h>
 #include <torch/csrc/autograd/functions/tensor.h>
 #include <torch/csrc/autograd/functions/utils.h>
 #include <torch/csrc/autograd/grad_mode.h>
+#include <torch/csrc/autograd/graph_task.h>
 #include <torch/csrc/autograd/variable.h>
 
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#else
+#include <ATen/ops/_foreach_add.h>
+#endif
+
+#include <atomic>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <stdexcept>
 #include <utility>
 
@@ -22,6 +33,56 @@ AccumulateGrad::AccumulateGrad(Variable variable_)
   add_input_metadata(variable);
 }
 
+AccumulateGrad::~AccumulateGrad() {
+  // Free contributions that were never flushed, e.g. because the backward
+  // errored out between accumulation and post processing.
+  auto* pending = pending_grads_.exchange(nullptr, std::memory_order_acquire);
+  while (pending != nullptr) {
+    auto* next = pending->next;
+    delete pending;
+    pending = next;
+  }
+}
+
+bool deferred_grad_accumulation_enabled() {
+  static const bool enabled = []() {
+    const char* env = std::getenv("TORCH_AUTOGRAD_DEFER_GRAD_ACCUM");
+    return env != nullptr && std::strcmp(env, "1") == 0;
+  }();
+  return enabled;
+}
+
+namespace {
+// See Note [Generation-tagged gradients]
+std::atomic<uint64_t> grad_generation{0};
+
+// Whether `grad` is a stale buffer the first contribution of this
+// generation may simply overwrite in place.
+bool can_overwrite_stale_grad(const at::Tensor& grad, const at::Tensor& contribution) {
+  return grad.layout() == c10::kStrided &&
+      contribution.layout() == c10::kStrided &&
+      grad.device() == contribution.device() &&
+      grad.scalar_type() == contribution.scalar_type() &&
+      grad.sizes().equals(contribution.sizes());
+}
+} // namespace
+
+bool grad_generations_enabled() {
+  static const bool enabled = []() {
+    const char* env = std::getenv("TORCH_AUTOGRAD_GRAD_GENERATIONS");
+    return env != nullptr && std::strcmp(env, "1") == 0;
+  }();
+  return enabled;
+}
+
+uint64_t current_grad_generation() {
+  return grad_generation.load(std::memory_order_relaxed);
+}
+
+void bump_grad_generation() {
+  grad_generation.fetch_add(1, std::memory_order_relaxed);
+}
+
 auto AccumulateGrad::apply(variable_list&& grads) -> variable_list {
   check_input_variables("AccumulateGrad", grads, 1, 0);
 
@@ -36,6 +97,30 @@ auto AccumulateGrad::apply(variable_list&& grads) -> variable_list {
   // std::move(grads[0]) to avoid bumping up refcount
   at::Tensor new_grad = callHooks(variable, std::move(grads[0]));
 
+  // See Note [Deferred gradient accumulation]. Contributions made under
+  // GradMode must stay eager so that the accumulation itself is recorded in
+  // the graph, and post hooks (e.g. DDP allreduce) expect the grad to be
+  // up to date when they run.
+  if (deferred_grad_accumulation_enabled() && !GradMode::is_enabled() &&
+      post_hooks().empty() && new_grad.layout() == c10::kStrided) {
+    if (auto graph_task = get_current_graph_task()) {
+      auto* pending = new PendingGrad{std::move(new_grad), nullptr};
+      auto* head = pending_grads_.load(std::memory_order_relaxed);
+      do {
+        pending->next = head;
+      } while (!pending_grads_.compare_exchange_weak(
+          head, pending, std::memory_order_release, std::memory_order_relaxed));
+      if (head == nullptr) {
+        // First contribution during this backward: register so that
+        // exec_post_processing flushes us.
+        std::lock_guard<std::mutex> lock(
+            graph_task->deferred_accumulators_lock_);
+        graph_task->deferred_accumulators_.push_back(getptr());
+      }
+      return variable_list();
+    }
+  }
+
   // Acquire lock to here protect thread safety on variable, this ensures
   // AccumulateGrad does not race to shared variable from different threads
   // when updating the gradients. We don't ensure thread safety on hooks
@@ -45,6 +130,26 @@ auto AccumulateGrad::apply(variable_list&& grads) -> variable_list {
 
   at::Tensor& grad = variable.mutable_grad();
 
+  // See Note [Generation-tagged gradients]
+  if (grad_generations_enabled()) {
+    const uint64_t generation = current_grad_generation();
+    if (grad_generation_ != generation) {
+      grad_generation_ = generation;
+      if (grad.defined()) {
+        if (!GradMode::is_enabled() &&
+            can_overwrite_stale_grad(grad, new_grad)) {
+          // First contribution of this generation overwrites the stale
+          // buffer in place: no zero_() launch, no realloc.
+          grad.copy_(new_grad);
+          return variable_list();
+        }
+        // Incompatible stale buffer: drop it and take the usual
+        // undefined-grad path below.
+        grad = at::Tensor();
+      }
+    }
+  }
+
   // If the function has post hooks (for example, a DDP allreduce hook),
   // call_function in Engine.cpp will temporarily bump the expected refcount
   // by one, hence the addition of !post_hooks().empty() for 'num_expected_refs'
@@ -60,5 +165,108 @@ auto AccumulateGrad::apply(variable_list&& grads) -> variable_list {
 
   return variable_list();
 }
+
+void AccumulateGrad::flush_deferred_grads(
+    const std::vector<std::shared_ptr<Node>>& accumulators) {
+  // The reduction itself must never be recorded; double backward keeps the
+  // eager path in apply() above.
+  at::NoGradGuard no_grad;
+
+  // _foreach_add_ may process list entries concurrently, so a given grad
+  // tensor can appear in a bucket at most once; multiple contributions to
+  // the same parameter are pre-combined below.
+  struct Bucket {
+    c10::Device device;
+    c10::ScalarType dtype;
+    std::vector<at::Tensor> grads;
+    std::vector<at::Tensor> contributions;
+  };
+  std::vector<Bucket> buckets;
+
+  for (const auto& node : accumulators) {
+    auto* accumulator = static_cast<AccumulateGrad*>(node.get());
+    auto* pending =
+        accumulator->pending_grads_.exchange(nullptr, std::memory_order_acquire);
+
+    std::lock_guard<std::mutex> lock(accumulator->mutex_);
+    at::Tensor& grad = accumulator->variable.mutable_grad();
+
+    // Combine this parameter's contributions into one tensor. The list is
+    // push-only during execution, so after the exchange we own it outright.
+    at::Tensor contribution;
+    while (pending != nullptr) {
+      auto* next = pending->next;
+      if (!contribution.defined()) {
+        contribution = std::move(pending->grad);
+      } else if (contribution.use_count() == 1) {
+        contribution += pending->grad;
+      } else {
+        contribution = contribution + pending->grad;
+      }
+      delete pending;
+      pending = next;
+    }
+    if (!contribution.defined()) {
+      continue;
+    }
+    if (contribution.is_cuda()) {
+      // The contribution is consumed (and its producer's memory possibly
+      // reused) on the caller's current stream, which exec_post_processing
+      // has already synced with the leaf streams. Make the allocator aware.
+      const c10::impl::VirtualGuardImpl guard_impl{c10::DeviceType::CUDA};
+      contribution.record_stream(guard_impl.getStream(contribution.device()));
+    }
+
+    // See Note [Generation-tagged gradients]
+    if (grad_generations_enabled()) {
+      const uint64_t generation = current_grad_generation();
+      if (accumulator->grad_generation_ != generation) {
+        accumulator->grad_generation_ = generation;
+        if (grad.defined()) {
+          if (can_overwrite_stale_grad(grad, contribution)) {
+            grad.copy_(contribution);
+            continue;
+          }
+          grad = at::Tensor();
+        }
+      }
+    }
+
+    if (!grad.defined() || grad.layout() != c10::kStrided ||
+        grad.device() != contribution.device() ||
+        grad.scalar_type() != contribution.scalar_type() ||
+        !at::inplaceIsVmapCompatible(grad, contribution)) {
+      // First contribution, or a combination _foreach_add_ can't handle
+      // in-place: fall back to the usual steal-or-accumulate logic.
+      accumulateGrad(
+          accumulator->variable,
+          grad,
+          contribution,
+          1 /* num_expected_refs */,
+          [&grad](at::Tensor&& grad_update) { grad = std::move(grad_update); });
+      continue;
+    }
+
+    Bucket* bucket = nullptr;
+    for (auto& candidate : buckets) {
+      if (candidate.device == grad.device() &&
+          candidate.dtype == grad.scalar_type()) {
+        bucket = &candidate;
+        break;
+      }
+    }
+    if (bucket == nullptr) {
+      buckets.push_back(
+          Bucket{grad.device(), grad.scalar_type(), {}, {}});
+      bucket = &buckets.back();
+    }
+    bucket->grads.push_back(grad);
+    bucket->contributions.push_back(std::move(contribution));
+  }
+
+  for (auto& bucket : buckets) {
+    at::_foreach_add_(bucket.grads, bucket.contributions);
+  }
+}
 } // namespace autograd
 } // namespace torch
@@ -13,6 +13,7 @@
 #include <ATen/ops/_sparse_coo_tensor_unsafe.h>
 #endif
 
+#include <atomic>
 #include <mutex>
 
 namespace torch {
@@ -37,11 +38,59 @@ namespace autograd {
     }                                                                      \
   }
 
+// Note [Deferred gradient accumulation]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// By default every gradient contribution takes the node mutex and eagerly
+// runs `grad += new_grad`; with multi-stream backwards and parameters that
+// receive several contributions this both contends on the mutex and
+// launches many small add kernels. With TORCH_AUTOGRAD_DEFER_GRAD_ACCUM=1,
+// strided first-order contributions are instead pushed onto a lock-free
+// per-parameter list, and the accumulator registers itself with the current
+// GraphTask on its first contribution. When the backward completes,
+// exec_post_processing drains all registered accumulators and applies the
+// contributions in batched _foreach_add_ calls (bucketed by device and
+// dtype) before the final callbacks run, so optimizer-step callbacks still
+// observe fully reduced grads. Contributions made under GradMode (double
+// backward), to accumulators with post hooks (e.g. DDP allreduce), or with
+// non-strided grads keep the eager path.
+//
+// Note [Generation-tagged gradients]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// zero_grad() semantics force either one zero_() launch per parameter or
+// set_to_none churn that frees every grad buffer just for
+// AccumulateGrad to reallocate it on the next step. With
+// TORCH_AUTOGRAD_GRAD_GENERATIONS=1 there is a process-wide grad
+// generation counter instead: bump_grad_generation() (exposed to Python
+// as torch._C._autograd._bump_grad_generation) logically zeroes all
+// grads in O(1). AccumulateGrad remembers the generation its grad was
+// last written in, and on the first contribution of a newer generation
+// overwrites the stale buffer in place with copy_() - behaving like the
+// grad.defined()==false path but without freeing the buffer - so neither
+// the zero_() kernels nor the allocator churn happen. Incompatible stale
+// buffers (layout/shape/dtype/device changes, or create_graph) fall back
+// to dropping the buffer and taking the usual undefined-grad path. Note
+// that grads read between a bump and the next backward still hold their
+// stale values; callers of bump_grad_generation() opt into that, exactly
+// as they do with set_to_none=True.
 struct TORCH_API AccumulateGrad : public Node {
   explicit AccumulateGrad(Variable variable_);
+  ~AccumulateGrad() override;
 
   variable_list apply(variable_list&& grads) override;
 
+  // A gradient contribution whose reduction was deferred to the end of the
+  // backward pass. See Note [Deferred gradient accumulation]
+  struct PendingGrad {
+    at::Tensor grad;
+    PendingGrad* next;
+  };
+
+  // Drains the pending contribution lists of the given accumulators and
+  // reduces them into the parameters' grads with batched _foreach_add_
+  // calls. Runs exclusively, from GraphTask::exec_post_processing.
+  static void flush_deferred_grads(
+      const std::vector<std::shared_ptr<Node>>& accumulators);
+
   static at::Tensor callHooks(const Variable& variable, at::Tensor new_grad) {
     for (auto& hook : impl::hooks(variable)) {
       new_grad = (*hook)({new_grad})[0];
@@ -247,8 +296,29 @@ struct TORCH_API AccumulateGrad : public Node {
   }
 
   Variable variable;
+
+  // Lock-free LIFO list of contributions deferred to the end of the current
+  // backward. See Note [Deferred gradient accumulation]
+  std::atomic<PendingGrad*> pending_grads_{nullptr};
+
+  // The grad generation this accumulator's grad was last written in.
+  // Protected by mutex_. See Note [Generation-tagged gradients]
+  uint64_t grad_generation_ = 0;
 };
 
+// Whether contributions are deferred and batch-reduced at the end of the
+// backward pass (TORCH_AUTOGRAD_DEFER_GRAD_ACCUM).
+// See Note [Deferred gradient accumulation]
+TORCH_API bool deferred_grad_accumulation_enabled();
+
+// Whether stale-generation grads are treated as logically zero
+// (TORCH_AUTOGRAD_GRAD_GENERATIONS).
+// See Note [Generation-tagged gradients]
+TORCH_API bool grad_generations_enabled();
+TORCH_API uint64_t current_grad_generation();
+// Logically zeroes all generation-tagged grads.
+TORCH_API void bump_grad_generation();
+
 #undef CHECK_RESULT
 
 } // namespace autograd
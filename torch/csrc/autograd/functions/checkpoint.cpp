@@ -0,0 +1,184 @@
+#include <torch/csrc/autograd/functions/checkpoint.h>
+
+#include <torch/csrc/autograd/autograd.h>
+#include <torch/csrc/autograd/function.h>
+#include <torch/csrc/autograd/functions/utils.h>
+#include <torch/csrc/autograd/grad_mode.h>
+#include <torch/csrc/autograd/variable.h>
+
+#include <ATen/Context.h>
+#include <c10/util/irange.h>
+
+#include <utility>
+
+namespace torch {
+namespace autograd {
+
+CheckpointNode::CheckpointNode(
+    checkpoint_fn fn,
+    variable_list detached_inputs,
+    std::vector<at::Generator> generators,
+    std::vector<at::Tensor> rng_states)
+    : fn_(std::move(fn)),
+      detached_inputs_(std::move(detached_inputs)),
+      generators_(std::move(generators)),
+      rng_states_(std::move(rng_states)) {}
+
+auto CheckpointNode::apply(variable_list&& grads) -> variable_list {
+  TORCH_CHECK(
+      fn_,
+      "CheckpointNode has already recomputed and freed its segment. "
+      "Specify retain_graph=True if you need to backward through the "
+      "checkpointed segment a second time.");
+
+  // Swap in the generator states of the original forward so the
+  // recomputation reproduces it exactly (dropout masks etc.).
+  std::vector<at::Tensor> current_states;
+  current_states.reserve(generators_.size());
+  for (const auto i : c10::irange(generators_.size())) {
+    current_states.push_back(generators_[i].get_state());
+    generators_[i].set_state(rng_states_[i]);
+  }
+
+  variable_list recomputed;
+  {
+    AutoGradMode grad_mode(true);
+    recomputed = fn_(detached_inputs_);
+  }
+
+  for (const auto i : c10::irange(generators_.size())) {
+    generators_[i].set_state(current_states[i]);
+  }
+
+  // Pair the incoming grads with the recomputed outputs they belong to.
+  variable_list outputs_with_grads;
+  variable_list grad_outputs;
+  for (const auto i : c10::irange(grads.size())) {
+    if (!grads[i].defined()) {
+      continue;
+    }
+    const auto output_idx = differentiable_output_indices_.at(i);
+    TORCH_CHECK(
+        output_idx < recomputed.size(),
+        "checkpointed function returned fewer outputs on recomputation");
+    auto& output = recomputed[output_idx];
+    TORCH_CHECK(
+        output.defined() && output.requires_grad(),
+        "output ",
+        output_idx,
+        " of the checkpointed function no longer requires grad on "
+        "recomputation; the function must be deterministic in its use of "
+        "the inputs");
+    outputs_with_grads.push_back(output);
+    grad_outputs.push_back(grads[i]);
+  }
+
+  variable_list diff_inputs;
+  for (const auto& input : detached_inputs_) {
+    if (input.defined() && input.requires_grad()) {
+      diff_inputs.push_back(input);
+    }
+  }
+
+  // One slot per next edge, i.e. per original input.
+  variable_list input_grads(detached_inputs_.size());
+  if (!outputs_with_grads.empty() && !diff_inputs.empty()) {
+    // Reentrant backward over the recompute graph; the engine's reentrant
+    // machinery keeps this worker making progress.
+    auto computed = torch::autograd::grad(
+        outputs_with_grads,
+        diff_inputs,
+        grad_outputs,
+        /*retain_graph=*/false,
+        /*create_graph=*/GradMode::is_enabled(),
+        /*allow_unused=*/true);
+    size_t next_computed = 0;
+    for (const auto i : c10::irange(detached_inputs_.size())) {
+      if (detached_inputs_[i].defined() &&
+          detached_inputs_[i].requires_grad()) {
+        input_grads[i] = std::move(computed[next_computed++]);
+      }
+    }
+  }
+  return input_grads;
+}
+
+void CheckpointNode::release_variables() {
+  fn_ = nullptr;
+  detached_inputs_.clear();
+  generators_.clear();
+  rng_states_.clear();
+}
+
+variable_list checkpoint(checkpoint_fn fn, const variable_list& inputs) {
+  TORCH_CHECK(fn, "checkpoint expects a callable");
+
+  variable_list detached_inputs;
+  detached_inputs.reserve(inputs.size());
+  for (const auto& input : inputs) {
+    if (!input.defined()) {
+      detached_inputs.emplace_back();
+      continue;
+    }
+    auto detached = input.detach();
+    if (input.requires_grad()) {
+      detached.set_requires_grad(true);
+    }
+    detached_inputs.push_back(std::move(detached));
+  }
+
+  // Capture the generator states the recomputation must reproduce: the CPU
+  // default generator and the default generator of every CUDA device an
+  // input lives on.
+  std::vector<at::Generator> generators;
+  std::vector<at::Tensor> rng_states;
+  auto capture_generator = [&](const at::Device& device) {
+    auto gen = at::globalContext().defaultGenerator(device);
+    for (const auto& captured : generators) {
+      if (captured.device() == gen.device()) {
+        return;
+      }
+    }
+    rng_states.push_back(gen.get_state());
+    generators.push_back(std::move(gen));
+  };
+  capture_generator(at::Device(at::kCPU));
+  for (const auto& input : inputs) {
+    if (input.defined() && input.is_cuda()) {
+      capture_generator(input.device());
+    }
+  }
+
+  variable_list outputs;
+  {
+    at::NoGradGuard no_grad;
+    outputs = fn(detached_inputs);
+  }
+
+  if (!compute_requires_grad(inputs)) {
+    return outputs;
+  }
+
+  auto node = std::shared_ptr<CheckpointNode>(
+      new CheckpointNode(
+          std::move(fn),
+          std::move(detached_inputs),
+          std::move(generators),
+          std::move(rng_states)),
+      deleteNode);
+  node->set_next_edges(collect_next_edges(inputs));
+  for (const auto i : c10::irange(outputs.size())) {
+    auto& output = outputs[i];
+    if (output.defined() && isDifferentiableType(output.scalar_type())) {
+      set_history(output, node);
+      node->differentiable_output_indices_.push_back(i);
+    }
+  }
+  TORCH_CHECK(
+      !node->differentiable_output_indices_.empty(),
+      "checkpointed function returned no differentiable outputs");
+  return outputs;
+}
+
+} // namespace autograd
+} // namespace torch
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <ATen/core/Generator.h>
+#include <ATen/core/Tensor.h>
+#include <torch/csrc/Export.h>
+#include <torch/csrc/autograd/function.h>
+#include <torch/csrc/autograd/variable.h>
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace torch {
+namespace autograd {
+
+using checkpoint_fn = std::function<variable_list(const variable_list&)>;
+
+// Note [Engine-native checkpointing]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// torch.utils.checkpoint re-enters Python once per segment during backward,
+// which serializes recomputation behind the GIL and blocks overlap with
+// other branches' backward work. CheckpointNode keeps the whole
+// recompute-and-backward cycle in C++: checkpoint() runs the segment with
+// grad disabled, stashes detached inputs plus the default generator states
+// of the CPU and of every CUDA device an input lives on, and installs the
+// node as grad_fn of the segment's outputs. When the engine reaches the
+// node, apply() swaps the saved RNG states in, re-runs the callable with
+// grad enabled, computes the input grads with a reentrant
+// torch::autograd::grad call, and swaps the RNG states back. Because the
+// node is an ordinary Node evaluated inside Engine::evaluate_function, the
+// recomputation runs on whichever worker thread popped it while
+// independent branches keep draining their own ready queues, so recompute
+// overlaps the rest of the backward instead of serializing it.
+struct TORCH_API CheckpointNode : public Node {
+  CheckpointNode(
+      checkpoint_fn fn,
+      variable_list detached_inputs,
+      std::vector<at::Generator> generators,
+      std::vector<at::Tensor> rng_states);
+
+  variable_list apply(variable_list&& grads) override;
+
+  void release_variables() override;
+
+  // The checkpointed segment. Cleared by release_variables.
+  checkpoint_fn fn_;
+  // Leaves of the recompute graph; requires_grad mirrors the original
+  // inputs.
+  variable_list detached_inputs_;
+  // Default generators the segment may draw from and their states at
+  // capture time, index-aligned.
+  std::vector<at::Generator> generators_;
+  std::vector<at::Tensor> rng_states_;
+  // Positions in the callable's output list that carry this node's input
+  // metadata (the defined, differentiable outputs at capture time).
+  std::vector<size_t> differentiable_output_indices_;
+};
+
+// Runs `fn` on `inputs` with grad disabled and returns its outputs, with
+// backward provided by a CheckpointNode that recomputes the segment.
+// See Note [Engine-native checkpointing]
+TORCH_API variable_list
+checkpoint(checkpoint_fn fn, const variable_list& inputs);
+
+} // namespace autograd
+} // namespace torch
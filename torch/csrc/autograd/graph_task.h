@@ -11,6 +11,7 @@ namespace autograd {
 
 using edge_list = std::vector<Edge>;
 struct ReadyQueue;
+struct CpuWorkStealingPool;
 
 static constexpr int NO_DEVICE = -2;
 static constexpr int CPU_DEVICE = -1;
@@ -101,6 +102,16 @@ struct GraphTask : std::enable_shared_from_this<GraphTask> {
   // Collects caller_current_streams_
   void stash_current_streams();
 
+  // Per-node stream overrides that spread independent branches of the graph
+  // over a pool of streams. Written once while dependencies are computed,
+  // read-only during execution, so it is safe to read without
+  // synchronization. See Note [Stream-parallel backwards] in engine.cpp
+  std::unordered_map<Node*, c10::Stream> stream_assignments_;
+
+  // The stream `fn` runs and accumulates on: its pool assignment if it has
+  // one, otherwise the stream it recorded during forward.
+  c10::optional<c10::Stream> stream_for(Node* fn) const;
+
   void init_to_execute(
       Node& graph_root,
       const edge_list& outputs,
@@ -145,10 +156,26 @@ struct GraphTask : std::enable_shared_from_this<GraphTask> {
   // device thread (i.e. GPU) and but next NodeTask should be run on CPU.
   std::shared_ptr<ReadyQueue> cpu_ready_queue_;
 
+  // Optional pool of CPU worker threads that execute the CPU work of this
+  // graph task instead of the single owning thread. Set (if at all) before
+  // the root is enqueued and never changed afterwards, so it is safe to read
+  // without synchronization. See Note [CPU work stealing] in engine.h.
+  std::shared_ptr<CpuWorkStealingPool> cpu_work_stealing_pool_;
+
   // Future representing the completion of the graph task. Notified when all
   // tasks are done.
   c10::intrusive_ptr<at::ivalue::Future> future_result_;
 
+  // AccumulateGrad nodes that deferred gradient contributions during this
+  // backward; drained by exec_post_processing before the final callbacks
+  // run. See Note [Deferred gradient accumulation] in
+  // functions/accumulate_grad.h
+  std::vector<std::shared_ptr<Node>> deferred_accumulators_;
+  // To protect reads and writes to deferred_accumulators_. Intentionally not
+  // reusing mutex_; accumulators register while other threads still execute
+  // nodes under mutex_.
+  std::mutex deferred_accumulators_lock_;
+
   // Final callbacks installed during execution of this GraphTask
   std::vector<std::function<void()>> final_callbacks_;
   // To protect reads and writes to final_callbacks_. Intentionally no reusing
@@ -203,6 +230,7 @@ get_current_graph_task_nodes_in_graph();
 TORCH_API bool get_current_graph_task_keep_graph();
 TORCH_API std::vector<Node*> get_current_graph_task_execution_order();
 TORCH_API int get_current_graph_task_id();
+TORCH_API std::shared_ptr<GraphTask> get_current_graph_task();
 void add_node_to_current_graph_task_exec_info(Node* fn);
 
 } // namespace autograd
@@ -12,6 +12,7 @@
 #include <torch/csrc/Exceptions.h>
 #include <torch/csrc/autograd/autograd.h>
 #include <torch/csrc/autograd/function.h>
+#include <torch/csrc/autograd/functions/accumulate_grad.h>
 #include <torch/csrc/autograd/grad_mode.h>
 #include <torch/csrc/autograd/profiler.h>
 #include <torch/csrc/autograd/profiler_python.h>
@@ -328,6 +329,10 @@ PyObject* THPAutograd_initExtension(PyObject* _unused, PyObject* unused) {
   m.def("_pop_saved_tensors_default_hooks", []() {
     torch::autograd::PyDefaultSavedVariableHooks::pop_hooks();
   });
+  // See Note [Generation-tagged gradients]
+  m.def(
+      "_grad_generations_enabled", torch::autograd::grad_generations_enabled);
+  m.def("_bump_grad_generation", torch::autograd::bump_grad_generation);
 
   _C_m.def(
       "_register_py_class_for_device",
@@ -117,6 +117,24 @@ struct InputMetadata {
     return at::sum_to(std::move(grad), shape_as_dim_vector());
   }
 
+  // Best-effort size of the described gradient in bytes; 0 when it cannot
+  // be computed cheaply (nested tensors, symbolic shapes). Used by the
+  // memory-aware ready queue policy.
+  // See Note [Memory-aware backward scheduling] in engine.h
+  size_t nbytes_hint() const {
+    if (is_nested_tensor()) {
+      return 0;
+    }
+    size_t numel = 1;
+    for (const auto& dim : c10::get<SymIntSmallVec>(shape_)) {
+      if (dim.is_symbolic()) {
+        return 0;
+      }
+      numel *= dim.expect_int();
+    }
+    return numel * dtype().itemsize();
+  }
+
   std::stringstream incompatible_shape_error_message(
       const size_t index,
       const at::Tensor& grad) const {
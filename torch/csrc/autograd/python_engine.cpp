@@ -117,7 +117,13 @@ std::unique_ptr<AnomalyMetadata> PythonEngine::make_anomaly_metadata() {
 
 std::unique_ptr<SavedVariableHooks> PythonEngine::
     get_default_saved_variable_hooks() {
-  return PyDefaultSavedVariableHooks::get_hooks();
+  auto hooks = PyDefaultSavedVariableHooks::get_hooks();
+  if (hooks) {
+    return hooks;
+  }
+  // Fall back to the native default hooks (e.g. the CPU offload policy).
+  // See Note [Saved variable CPU offload]
+  return Engine::get_default_saved_variable_hooks();
 }
 
 variable_list PythonEngine::execute(
@@ -0,0 +1,136 @@
+#include <torch/csrc/autograd/saved_variable_offload_hooks.h>
+
+#include <ATen/ATen.h>
+#include <c10/core/StreamGuard.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+namespace torch {
+namespace autograd {
+
+namespace {
+
+// Tensors below this size are saved as-is; the transfer latency would
+// outweigh the memory saved.
+constexpr size_t kMinOffloadBytes = 1 << 16; // 64 KiB
+
+// How many still-offloaded predecessors (in pack order) each unpack starts
+// copying back. See Note [Saved variable CPU offload]
+constexpr size_t kPrefetchAhead = 2;
+
+// All currently offloaded hooks in pack order. Backward consumes saved
+// tensors in roughly reverse pack order, so walking backwards from an
+// unpacking hook yields the tensors needed next.
+std::mutex& registry_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::list<CpuOffloadSavedVariableHooks*>& registry() {
+  static std::list<CpuOffloadSavedVariableHooks*> list;
+  return list;
+}
+
+} // namespace
+
+bool saved_variable_offload_enabled() {
+  static bool enabled = []() {
+    const auto* env = getenv("TORCH_AUTOGRAD_OFFLOAD_ACTIVATIONS");
+    return env != nullptr && strcmp(env, "1") == 0;
+  }();
+  return enabled;
+}
+
+CpuOffloadSavedVariableHooks::~CpuOffloadSavedVariableHooks() {
+  if (registered_) {
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    registry().erase(registry_pos_);
+    registered_ = false;
+  }
+}
+
+void CpuOffloadSavedVariableHooks::call_pack_hook(const at::Tensor& tensor) {
+  if (!tensor.defined() || !tensor.device().is_cuda() ||
+      tensor.layout() != c10::kStrided ||
+      tensor.nbytes() < kMinOffloadBytes) {
+    passthrough_ = tensor;
+    return;
+  }
+  const auto device = tensor.device();
+  device_options_ = tensor.options();
+  const c10::impl::VirtualGuardImpl impl{c10::DeviceType::CUDA};
+  side_stream_ = impl.getStreamFromGlobalPool(device);
+  // The D2H copy has to observe the producer's writes to the activation.
+  auto ready = c10::Event{c10::DeviceType::CUDA};
+  ready.record(impl.getStream(device));
+  ready.block(*side_stream_);
+  {
+    c10::StreamGuard stream_guard{*side_stream_};
+    pinned_ = at::empty_like(
+        tensor, tensor.options().device(at::kCPU).pinned_memory(true));
+    pinned_.copy_(tensor, /*non_blocking=*/true);
+  }
+  // The caller drops its reference to the device copy right after we return;
+  // keep the caching allocator from handing the block to another stream
+  // before the transfer on the side stream finishes.
+  tensor.record_stream(*side_stream_);
+  pack_done_.emplace(c10::DeviceType::CUDA);
+  pack_done_->record(*side_stream_);
+
+  std::lock_guard<std::mutex> lock(registry_mutex());
+  registry().push_back(this);
+  registry_pos_ = std::prev(registry().end());
+  registered_ = true;
+}
+
+void CpuOffloadSavedVariableHooks::start_prefetch() {
+  // The reload runs on the same side stream the offload used, so it is
+  // already ordered after pack_done_ and can start as soon as the D2H copy
+  // finished, independently of the compute stream.
+  c10::StreamGuard stream_guard{*side_stream_};
+  prefetched_ = at::empty_like(pinned_, device_options_);
+  prefetched_.copy_(pinned_, /*non_blocking=*/true);
+  prefetch_done_.emplace(c10::DeviceType::CUDA);
+  prefetch_done_->record(*side_stream_);
+}
+
+at::Tensor CpuOffloadSavedVariableHooks::call_unpack_hook() {
+  if (!pinned_.defined()) {
+    return passthrough_;
+  }
+  {
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    if (!prefetch_done_) {
+      start_prefetch();
+    }
+    if (registered_) {
+      // Kick off the copy-back of the next few still-offloaded tensors in
+      // reverse pack order; their consuming nodes run shortly after ours.
+      auto it = registry_pos_;
+      size_t started = 0;
+      while (it != registry().begin() && started < kPrefetchAhead) {
+        --it;
+        auto* other = *it;
+        if (!other->prefetch_done_) {
+          other->start_prefetch();
+          ++started;
+        }
+      }
+      registry().erase(registry_pos_);
+      registered_ = false;
+    }
+  }
+  const c10::impl::VirtualGuardImpl impl{c10::DeviceType::CUDA};
+  auto current_stream = impl.getStream(prefetched_.device());
+  prefetch_done_->block(current_stream);
+  // The block was allocated on the side stream; it is in use on the
+  // consumer's stream from here on.
+  prefetched_.record_stream(current_stream);
+  return prefetched_;
+}
+
+} // namespace autograd
+} // namespace torch
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <torch/csrc/autograd/saved_variable_hooks.h>
+
+#include <ATen/core/Tensor.h>
+#include <c10/core/Event.h>
+#include <c10/core/Stream.h>
+#include <c10/util/Optional.h>
+
+#include <list>
+#include <memory>
+
+namespace torch {
+namespace autograd {
+
+// Note [Saved variable CPU offload]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Offloading activations to host memory through Python saved-tensor hooks
+// pays a Python round trip per saved tensor and runs every transfer
+// synchronously on the current stream. This native policy, enabled with
+// TORCH_AUTOGRAD_OFFLOAD_ACTIVATIONS=1, is installed as the engine's default
+// saved variable hooks instead:
+//
+//  - pack copies the saved CUDA tensor into pinned host memory on a side
+//    stream, so the D2H transfer overlaps the remaining forward compute.
+//    The device copy of the activation is released as soon as the caller
+//    drops its reference (record_stream keeps the block safe until the
+//    transfer finishes).
+//  - unpack copies the pinned buffer back to the device. Because backward
+//    consumes saved tensors in roughly reverse pack order, each unpack also
+//    starts the copy-back of the next few still-offloaded predecessors in
+//    pack order on the side stream, so the reload of upcoming backward nodes
+//    overlaps the current node's compute. (The engine's GraphTask topology
+//    is not visible from inside the hooks; reverse pack order is the proxy.)
+//
+// Tensors that are not CUDA, smaller than the offload threshold, or sparse
+// are saved as-is. The pool of pinned buffers is managed by the caching host
+// allocator, so buffers are recycled across iterations.
+struct TORCH_API CpuOffloadSavedVariableHooks : public SavedVariableHooks {
+  ~CpuOffloadSavedVariableHooks() override;
+
+  void call_pack_hook(const at::Tensor& tensor) override;
+  at::Tensor call_unpack_hook() override;
+
+ private:
+  // Starts the async H2D copy-back on the side stream. Caller must hold the
+  // registry mutex.
+  void start_prefetch();
+
+  // Saved as-is when the tensor does not qualify for offload.
+  at::Tensor passthrough_;
+
+  // Offload state. device_options_ remembers the original device and dtype
+  // of the packed tensor; pinned_ holds the host copy once pack_done_ fired.
+  at::Tensor pinned_;
+  at::TensorOptions device_options_;
+  c10::optional<c10::Stream> side_stream_;
+  c10::optional<c10::Event> pack_done_;
+
+  // Copy-back started by a prefetch (or by unpack itself).
+  at::Tensor prefetched_;
+  c10::optional<c10::Event> prefetch_done_;
+
+  // Position in the global pack-order registry, valid while registered.
+  std::list<CpuOffloadSavedVariableHooks*>::iterator registry_pos_;
+  bool registered_ = false;
+};
+
+// Whether the offload policy is enabled (TORCH_AUTOGRAD_OFFLOAD_ACTIVATIONS).
+TORCH_API bool saved_variable_offload_enabled();
+
+} // namespace autograd
+} // namespace torch
@@ -253,6 +253,49 @@ void CUDAPluggableAllocator::notifyCaptureDestroy(
   }
 }
 
+void CUDAPluggableAllocator::createUserPool(
+    int device,
+    c10::cuda::MempoolId_t mempool_id,
+    size_t memory_limit) {
+  TORCH_CHECK(
+      false,
+      "CUDAPluggableAllocator does not yet support user memory pools. "
+      "If you need them, please file an issue describing your use case.");
+}
+
+void CUDAPluggableAllocator::releaseUserPool(
+    int device,
+    c10::cuda::MempoolId_t mempool_id) {
+  TORCH_CHECK(
+      false,
+      "CUDAPluggableAllocator does not yet support user memory pools. "
+      "If you need them, please file an issue describing your use case.");
+}
+
+c10::cuda::MempoolId_t CUDAPluggableAllocator::beginAllocateToPool(
+    c10::cuda::MempoolId_t mempool_id) {
+  TORCH_CHECK(
+      false,
+      "CUDAPluggableAllocator does not yet support user memory pools. "
+      "If you need them, please file an issue describing your use case.");
+}
+
+void CUDAPluggableAllocator::endAllocateToPool(
+    c10::cuda::MempoolId_t mempool_id) {
+  TORCH_CHECK(
+      false,
+      "CUDAPluggableAllocator does not yet support user memory pools. "
+      "If you need them, please file an issue describing your use case.");
+}
+
+c10::cuda::CUDACachingAllocator::UserPoolStats CUDAPluggableAllocator::
+    getUserPoolStats(int device, c10::cuda::MempoolId_t mempool_id) {
+  TORCH_CHECK(
+      false,
+      "CUDAPluggableAllocator does not yet support user memory pools. "
+      "If you need them, please file an issue describing your use case.");
+}
+
 void CUDAPluggableAllocator::recordHistory(
     bool enabled,
     c10::cuda::CUDACachingAllocator::CreateContextFn context_recorder,
@@ -272,6 +315,22 @@ void CUDAPluggableAllocator::attachOutOfMemoryObserver(
       "If you need it, please file an issue describing your use case.");
 }
 
+void CUDAPluggableAllocator::attachAllocatorTraceTracker(
+    c10::cuda::CUDACachingAllocator::AllocatorTraceTracker tracker) {
+  TORCH_CHECK(
+      false,
+      "CUDAPluggableAllocator does not yet support attachAllocatorTraceTracker. "
+      "If you need it, please file an issue describing your use case.");
+}
+
+std::vector<c10::cuda::CUDACachingAllocator::StreamStats> CUDAPluggableAllocator::
+    getStreamStats(int device) {
+  TORCH_CHECK(
+      false,
+      "CUDAPluggableAllocator does not yet support getStreamStats. "
+      "If you need it, please file an issue describing your use case.");
+}
+
 bool CUDAPluggableAllocator::needsPoolSpecificPeerAccess() {
   return false;
 }
@@ -99,6 +99,18 @@ struct CUDAPluggableAllocator
   virtual void notifyCaptureDestroy(
       int device,
       c10::cuda::MempoolId_t mempool_id) override;
+  virtual void createUserPool(
+      int device,
+      c10::cuda::MempoolId_t mempool_id,
+      size_t memory_limit) override;
+  virtual void releaseUserPool(int device, c10::cuda::MempoolId_t mempool_id)
+      override;
+  virtual c10::cuda::MempoolId_t beginAllocateToPool(
+      c10::cuda::MempoolId_t mempool_id) override;
+  virtual void endAllocateToPool(c10::cuda::MempoolId_t mempool_id) override;
+  virtual c10::cuda::CUDACachingAllocator::UserPoolStats getUserPoolStats(
+      int device,
+      c10::cuda::MempoolId_t mempool_id) override;
   virtual std::shared_ptr<void> getIpcDevPtr(std::string handle) override;
   virtual void recordHistory(
       bool enabled,
@@ -107,6 +119,10 @@ struct CUDAPluggableAllocator
       bool alloc_trace_record_context) override;
   virtual void attachOutOfMemoryObserver(
       c10::cuda::CUDACachingAllocator::OutOfMemoryObserver observer) override;
+  virtual void attachAllocatorTraceTracker(
+      c10::cuda::CUDACachingAllocator::AllocatorTraceTracker tracker) override;
+  virtual std::vector<c10::cuda::CUDACachingAllocator::StreamStats>
+  getStreamStats(int device) override;
   virtual bool needsPoolSpecificPeerAccess() override;
   virtual std::string name() override;
 
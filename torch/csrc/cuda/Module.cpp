@@ -851,6 +851,36 @@ static void registerCudaDeviceProperties(PyObject* module) {
             alloc_trace_max_entries,
             alloc_trace_record_context);
       });
+
+  // User memory pools; see Note [User memory pools] in
+  // c10/cuda/CUDACachingAllocator.cpp.
+  m.def(
+      "_cuda_createUserPool",
+      [](int device, c10::cuda::MempoolId_t mempool_id, size_t memory_limit) {
+        c10::cuda::CUDACachingAllocator::createUserPool(
+            device, mempool_id, memory_limit);
+      });
+  m.def(
+      "_cuda_releaseUserPool",
+      [](int device, c10::cuda::MempoolId_t mempool_id) {
+        c10::cuda::CUDACachingAllocator::releaseUserPool(device, mempool_id);
+      });
+  m.def("_cuda_beginAllocateToPool", [](c10::cuda::MempoolId_t mempool_id) {
+    return c10::cuda::CUDACachingAllocator::beginAllocateToPool(mempool_id);
+  });
+  m.def("_cuda_endAllocateToPool", [](c10::cuda::MempoolId_t mempool_id) {
+    c10::cuda::CUDACachingAllocator::endAllocateToPool(mempool_id);
+  });
+  m.def(
+      "_cuda_getUserPoolStats",
+      [](int device, c10::cuda::MempoolId_t mempool_id) {
+        const auto stats = c10::cuda::CUDACachingAllocator::getUserPoolStats(
+            device, mempool_id);
+        py::dict result;
+        result["reserved_bytes"] = stats.reserved_bytes;
+        result["allocated_bytes"] = stats.allocated_bytes;
+        return result;
+      });
 }
 
 static void registerCudaPluggableAllocator(PyObject* module) {
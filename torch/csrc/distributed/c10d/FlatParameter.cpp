@@ -0,0 +1,88 @@
+#include <torch/csrc/distributed/c10d/FlatParameter.hpp>
+
+#include <c10/core/DeviceGuard.h>
+
+namespace c10d {
+
+namespace {
+
+// Resizes a storage in place, the way FSDP's Python _free_storage and
+// _alloc_storage helpers do. Views of the storage keep referring to it across
+// the resize, which is what lets unshard() revalidate every parameter view
+// without touching it.
+void resizeStorageBytes(const at::Tensor& tensor, size_t size_bytes) {
+  auto* storage = tensor.storage().unsafeGetStorageImpl();
+  TORCH_CHECK(
+      storage->resizable(),
+      "FlatParameter requires its flat buffer's storage to be resizable");
+  c10::DeviceGuard guard(tensor.device());
+  at::DataPtr new_data;
+  if (size_bytes != 0) {
+    new_data = storage->allocator()->allocate(size_bytes);
+  }
+  storage->set_data_ptr(std::move(new_data));
+  storage->set_nbytes(size_bytes);
+}
+
+} // namespace
+
+FlatParameter::FlatParameter(
+    std::vector<at::Tensor> parameters,
+    c10::intrusive_ptr<ProcessGroup> process_group)
+    : params_(std::move(parameters)),
+      process_group_(std::move(process_group)) {
+  TORCH_CHECK(
+      !params_.empty(), "FlatParameter requires at least one parameter");
+  const auto& first = params_.front();
+  numel_ = 0;
+  for (const auto& param : params_) {
+    TORCH_CHECK(
+        param.layout() == c10::kStrided,
+        "FlatParameter only supports strided parameters, got ",
+        param.layout());
+    TORCH_CHECK(
+        param.dtype() == first.dtype() && param.device() == first.device(),
+        "All parameters of a FlatParameter must share one dtype and device");
+    numel_ += param.numel();
+  }
+
+  // Pad so that every rank's shard has the same number of elements, as
+  // _allgather_base requires.
+  const int64_t world_size = process_group_->getSize();
+  const int64_t shard_numel = (numel_ + world_size - 1) / world_size;
+
+  at::NoGradGuard no_grad;
+  flat_ = at::empty({shard_numel * world_size}, first.options());
+  int64_t offset = 0;
+  for (auto& param : params_) {
+    auto view = flat_.narrow(0, offset, param.numel()).view(param.sizes());
+    view.copy_(param);
+    // The parameter keeps its autograd identity but aliases the flat buffer
+    // from here on.
+    param.set_data(view);
+    offset += param.numel();
+  }
+  shard_ = at::empty({shard_numel}, first.options());
+}
+
+void FlatParameter::shard() {
+  TORCH_CHECK(!sharded_, "FlatParameter is already sharded");
+  at::NoGradGuard no_grad;
+  // The parameters may have been updated in place since the last unshard, so
+  // this rank's slice has to be persisted before the buffer is freed. This is
+  // the only copy on the shard/unshard path.
+  const int64_t shard_numel = shard_.numel();
+  shard_.copy_(
+      flat_.narrow(0, process_group_->getRank() * shard_numel, shard_numel));
+  resizeStorageBytes(flat_, 0);
+  sharded_ = true;
+}
+
+c10::intrusive_ptr<Work> FlatParameter::unshard() {
+  TORCH_CHECK(sharded_, "FlatParameter is not sharded");
+  resizeStorageBytes(flat_, flat_.numel() * flat_.element_size());
+  sharded_ = false;
+  return process_group_->_allgather_base(flat_, shard_);
+}
+
+} // namespace c10d
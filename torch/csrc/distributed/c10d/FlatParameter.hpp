@@ -0,0 +1,75 @@
+#pragma once
+
+#include <ATen/ATen.h>
+#include <torch/csrc/Export.h>
+#include <torch/csrc/distributed/c10d/ProcessGroup.hpp>
+
+namespace c10d {
+
+// Views a set of parameters into one contiguous flat buffer so they can be
+// sharded across a process group and materialized again with a single
+// collective, FSDP style.
+//
+// On construction the parameters are copied into the buffer once and then
+// rebound (the C++ equivalent of `param.data = view`) as dense views of the
+// buffer's storage. shard() keeps only this rank's slice of the buffer and
+// frees the rest by resizing the buffer's storage in place; the parameters
+// stay bound to that storage, so unshard() only has to reallocate it and
+// issue one ProcessGroup::_allgather_base to make every parameter valid
+// again -- there are no per-parameter copies on the shard/unshard path.
+//
+// While sharded, the parameters alias an empty storage and must not be used
+// until the Work returned by unshard() completes.
+class TORCH_API FlatParameter {
+ public:
+  FlatParameter(
+      std::vector<at::Tensor> parameters,
+      c10::intrusive_ptr<ProcessGroup> process_group);
+
+  // Saves this rank's slice of the flat buffer and frees the buffer's
+  // storage. The parameters must not be used until the next unshard().
+  void shard();
+
+  // Reallocates the flat buffer and gathers all shards into it with a single
+  // _allgather_base. Returns the collective's Work; the parameters may be
+  // used once it completes.
+  c10::intrusive_ptr<Work> unshard();
+
+  bool isSharded() const {
+    return sharded_;
+  }
+
+  // The full flat buffer. Its storage is empty while sharded.
+  const at::Tensor& fullBuffer() const {
+    return flat_;
+  }
+
+  // This rank's slice of the flat buffer. Only current while sharded.
+  const at::Tensor& localShard() const {
+    return shard_;
+  }
+
+  // The parameters, rebound as views of the flat buffer, in the order they
+  // were passed to the constructor.
+  const std::vector<at::Tensor>& parameters() const {
+    return params_;
+  }
+
+  // Total number of parameter elements, excluding the padding that makes the
+  // flat buffer evenly divisible by the world size.
+  int64_t numel() const {
+    return numel_;
+  }
+
+ private:
+  std::vector<at::Tensor> params_;
+  c10::intrusive_ptr<ProcessGroup> process_group_;
+  // 1D buffer of numel() elements padded up to a multiple of the world size.
+  at::Tensor flat_;
+  // Holds this rank's slice of flat_ while sharded.
+  at::Tensor shard_;
+  int64_t numel_;
+  bool sharded_ = false;
+};
+
+} // namespace c10d
@@ -1060,6 +1060,44 @@ class AsyncAllreduceCoalescedWork : public AsyncAllreduceWork {
   }
 };
 
+// Tensors at least this large are all-reduced as multiple chunk
+// collectives (see the chunked path in ProcessGroupGloo::allreduce).
+constexpr size_t kChunkedAllreduceMinBytes = 32 * 1024 * 1024;
+// Lower bound on the work per chunk; also caps the number of chunks.
+constexpr size_t kChunkedAllreduceChunkBytes = 8 * 1024 * 1024;
+constexpr int64_t kChunkedAllreduceMaxChunks = 8;
+
+// Runs the trailing chunk of a chunked allreduce and then joins the
+// sibling chunk works. The siblings were enqueued ahead of this work, so
+// by the time it runs they are either complete or executing on other
+// pool threads, and joining them here cannot deadlock. This work is the
+// one handed back to the caller: its output tensors are the full input
+// tensors and its future fires only once the whole tensor is reduced.
+class AsyncChunkedAllreduceWork : public AsyncAllreduceWork {
+ public:
+  AsyncChunkedAllreduceWork(
+      const std::shared_ptr<gloo::Context>& context,
+      std::vector<at::Tensor>& inputs,
+      at::Tensor lastChunk,
+      std::vector<c10::intrusive_ptr<Work>> chunkWorks,
+      ReduceOp reduceOp,
+      uint32_t tag)
+      : AsyncAllreduceWork(context, inputs, reduceOp, tag),
+        lastChunk_({std::move(lastChunk)}),
+        chunkWorks_(std::move(chunkWorks)) {}
+
+  void run() override {
+    allreduce(lastChunk_);
+    for (auto& chunkWork : chunkWorks_) {
+      chunkWork->wait();
+    }
+  }
+
+ private:
+  std::vector<at::Tensor> lastChunk_;
+  std::vector<c10::intrusive_ptr<Work>> chunkWorks_;
+};
+
 class AsyncSparseAllreduceWork : public ProcessGroupGloo::AsyncWork {
  public:
   AsyncSparseAllreduceWork(
@@ -1462,6 +1500,54 @@ c10::intrusive_ptr<Work> ProcessGroupGloo::allreduce(
         "(allreduce of sparse tensors only works with ReduceOp.SUM)");
   }
 
+  // Large contiguous dense CPU tensors are all-reduced as several
+  // page-aligned chunk collectives that execute concurrently on the
+  // worker thread pool. Every chunk is a narrowed view of the tensor, so
+  // its memory is handed to the transport in place, exactly like the
+  // regular path; the chunking only splits the reduction arithmetic and
+  // the wire transfers. Aligning the chunk boundaries to pages keeps
+  // each worker thread on disjoint pages, which avoids cross-node
+  // traffic on NUMA machines where a large allocation's pages land on
+  // the nodes that first touched them. The chunk count is derived from
+  // the tensor size alone, so every rank issues the same set of chunk
+  // collectives with matching tags regardless of its thread count.
+  if (device.type() == at::kCPU && layout == c10::kStrided &&
+      inputs.size() == 1 && inputs[0].is_contiguous() &&
+      inputs[0].nbytes() >= kChunkedAllreduceMinBytes) {
+    const int64_t numel = inputs[0].numel();
+    const int64_t numChunks = std::min(
+        kChunkedAllreduceMaxChunks,
+        static_cast<int64_t>(
+            (inputs[0].nbytes() + kChunkedAllreduceChunkBytes - 1) /
+            kChunkedAllreduceChunkBytes));
+    const int64_t pageElems = 4096 / inputs[0].element_size();
+    int64_t chunkElems = (numel + numChunks - 1) / numChunks;
+    chunkElems = (chunkElems + pageElems - 1) / pageElems * pageElems;
+
+    auto flat = inputs[0].view({numel});
+    std::vector<c10::intrusive_ptr<Work>> chunkWorks;
+    int64_t offset = 0;
+    while (numel - offset > chunkElems) {
+      std::vector<at::Tensor> chunk = {flat.narrow(0, offset, chunkElems)};
+      const auto chunkTag = nextTag();
+      auto chunkWork = c10::make_intrusive<AsyncAllreduceWork>(
+          getContext(chunkTag), chunk, opts.reduceOp, chunkTag);
+      enqueue(chunkWork);
+      chunkWorks.push_back(std::move(chunkWork));
+      offset += chunkElems;
+    }
+    const auto lastTag = nextTag();
+    auto chunkedWork = c10::make_intrusive<AsyncChunkedAllreduceWork>(
+        getContext(lastTag),
+        inputs,
+        flat.narrow(0, offset, numel - offset),
+        std::move(chunkWorks),
+        opts.reduceOp,
+        lastTag);
+    enqueue(chunkedWork);
+    return chunkedWork;
+  }
+
   c10::intrusive_ptr<AsyncWork> work;
   auto tag = nextTag();
   auto context = getContext(tag);
@@ -5,6 +5,7 @@
 
 #ifdef USE_C10D_NCCL
 
+#include <array>
 #include <exception>
 #include <map>
 #include <stdexcept>
@@ -22,6 +23,7 @@
 #include <c10/util/Optional.h>
 #include <c10/util/irange.h>
 #include <torch/csrc/distributed/c10d/ParamCommsUtils.hpp>
+#include <torch/csrc/distributed/c10d/PrefixStore.hpp>
 #include <torch/csrc/distributed/c10d/TraceUtils.h>
 #include <torch/csrc/distributed/c10d/Utils.hpp>
 
@@ -284,6 +286,12 @@ const int64_t ProcessGroupNCCL::kWatchdogThreadSleepMillis = 10000;
 const int64_t ProcessGroupNCCL::kWorkCleanupThreadSleepMillis = 1000;
 constexpr int64_t kWaitForAbortCommStoreKey = 1000;
 constexpr int64_t kSynchronizeBusyWaitMillis = 10;
+// Default number of entries retained by the flight recorder, and the store
+// keys used to request and publish dumps. See Note [NCCL flight recorder].
+constexpr int kDefaultFlightRecorderCapacity = 256;
+constexpr const char* kFlightRecorderDumpRequestKey =
+    "nccl_flight_recorder_dump";
+constexpr const char* kFlightRecorderDumpKeyPrefix = "nccl_flight_recorder/";
 thread_local uint64_t ProcessGroupNCCL::ncclActiveGroupCounter_ = 0;
 
 std::ostream& operator<<(
@@ -352,6 +360,8 @@ ProcessGroupNCCL::WorkNCCL::WorkNCCL(const WorkNCCL& w)
       workStartTime_(w.workStartTime_),
       seq_(w.seq_),
       startTraceUpdated_(w.startTraceUpdated_),
+      flightId_(w.flightId_),
+      flightStartUpdated_(w.flightStartUpdated_),
       store_(w.store_) {
   exception_ = w.exception_;
 }
@@ -623,6 +633,12 @@ ProcessGroupNCCL::ProcessGroupNCCL(
       parseEnvVarIntDefault(NCCL_ASYNC_ERROR_HANDLING, 0));
   desyncDebug_ = parseEnvVarFlag(NCCL_DESYNC_DEBUG) ||
       (dist_debug_level_ >= DebugLevel::Detail);
+  const int flightCapacity = parseEnvVarIntDefault(
+      NCCL_FLIGHT_RECORDER, kDefaultFlightRecorderCapacity);
+  flightRecorderCapacity_ = flightCapacity > 0 ? flightCapacity : 0;
+  if (flightRecorderCapacity_ > 0) {
+    flightRecorderEntries_.reserve(flightRecorderCapacity_);
+  }
 
   if (blockingWait_) {
     if (asyncErrorHandling_ != NoHandling || desyncDebug_) {
@@ -669,7 +685,9 @@ ProcessGroupNCCL::ProcessGroupNCCL(
             << "\nNCCL_BLOCKING_WAIT: " << blockingWait_
             << "\nTIMEOUT(ms): " << options_->timeout.count()
             << "\nUSE_HIGH_PRIORITY_STREAM: "
-            << options_->is_high_priority_stream;
+            << options_->is_high_priority_stream
+            << "\nUSE_HIERARCHICAL_ALLREDUCE: "
+            << options_->use_hierarchical_allreduce;
 
   RECORD_PARAM_COMMS(
       0, // seq
@@ -971,6 +989,10 @@ void ProcessGroupNCCL::ncclCommWatchdogInternal() {
       }
     }
 
+    // Piggyback the flight recorder dump check on the watchdog cadence: one
+    // store check per sleep interval. See Note [NCCL flight recorder].
+    maybeDumpFlightRecorderToStore();
+
     std::unique_lock<std::mutex> lock(watchdogCVMutex_);
     watchdogCV_.wait_for(
         lock,
@@ -1008,7 +1030,18 @@ void ProcessGroupNCCL::workCleanupLoop() {
           }
         }
 
+        // Back-fill the flight recorder's start time. isStarted() is only
+        // meaningful when desync debug recorded start events on the stream.
+        if (desyncDebug_ && work.flightId_ != 0 && !work.flightStartUpdated_ &&
+            work.isStarted()) {
+          work.flightStartUpdated_ = true;
+          markFlightStarted(work.flightId_);
+        }
+
         if (work.isCompleted()) {
+          if (work.flightId_ != 0) {
+            markFlightCompleted(work.flightId_);
+          }
           if (desyncDebug_ && !work.exception()) {
             // To close the window between the check of work.isStarted() and
             // the check of work.isCompleted().
@@ -1487,6 +1520,123 @@ void ProcessGroupNCCL::workEnqueue(
   }
 }
 
+namespace {
+
+int64_t nowWallClockMs() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+} // namespace
+
+uint64_t ProcessGroupNCCL::recordFlightEvent(
+    OpType opType,
+    uint64_t seq,
+    size_t bytes,
+    int device,
+    int64_t streamId) {
+  if (flightRecorderCapacity_ == 0) {
+    return 0;
+  }
+  FlightRecorderEntry entry;
+  entry.seq = seq;
+  entry.opType = opType;
+  entry.bytes = bytes;
+  entry.device = device;
+  entry.streamId = streamId;
+  entry.enqueueTimeMs = nowWallClockMs();
+  std::lock_guard<std::mutex> lock(flightRecorderMutex_);
+  entry.id = flightRecorderNextId_++;
+  if (flightRecorderEntries_.size() < flightRecorderCapacity_) {
+    flightRecorderEntries_.push_back(entry);
+  } else {
+    flightRecorderEntries_[flightRecorderIdx_] = entry;
+    flightRecorderIdx_ = (flightRecorderIdx_ + 1) % flightRecorderCapacity_;
+  }
+  return entry.id;
+}
+
+void ProcessGroupNCCL::markFlightStarted(uint64_t flightId) {
+  std::lock_guard<std::mutex> lock(flightRecorderMutex_);
+  for (auto& entry : flightRecorderEntries_) {
+    if (entry.id == flightId) {
+      entry.startTimeMs = nowWallClockMs();
+      return;
+    }
+  }
+}
+
+void ProcessGroupNCCL::markFlightCompleted(uint64_t flightId) {
+  std::lock_guard<std::mutex> lock(flightRecorderMutex_);
+  for (auto& entry : flightRecorderEntries_) {
+    if (entry.id == flightId) {
+      entry.endTimeMs = nowWallClockMs();
+      return;
+    }
+  }
+}
+
+std::string ProcessGroupNCCL::dumpFlightRecorder() {
+  std::lock_guard<std::mutex> lock(flightRecorderMutex_);
+  if (flightRecorderEntries_.empty()) {
+    return "";
+  }
+  std::stringstream ss;
+  ss << "[Rank " << rank_ << "] NCCL flight recorder, "
+     << flightRecorderEntries_.size() << " entries, oldest first:\n";
+  // The ring wraps at flightRecorderIdx_ once full; start there to emit
+  // entries in chronological order.
+  const size_t n = flightRecorderEntries_.size();
+  const size_t begin = n < flightRecorderCapacity_ ? 0 : flightRecorderIdx_;
+  for (const auto i : c10::irange(n)) {
+    const auto& entry = flightRecorderEntries_[(begin + i) % n];
+    ss << "seq=" << entry.seq << " op=" << opTypeToString(entry.opType)
+       << " bytes=" << entry.bytes << " device=" << entry.device
+       << " stream=" << entry.streamId << " enqueued_ms=" << entry.enqueueTimeMs
+       << " started_ms=";
+    if (entry.startTimeMs != 0) {
+      ss << entry.startTimeMs;
+    } else {
+      ss << (desyncDebug_ ? "pending" : "untracked");
+    }
+    ss << " completed_ms=";
+    if (entry.endTimeMs != 0) {
+      ss << entry.endTimeMs;
+    } else {
+      ss << "pending";
+    }
+    ss << "\n";
+  }
+  return ss.str();
+}
+
+void ProcessGroupNCCL::maybeDumpFlightRecorderToStore() {
+  if (flightRecorderCapacity_ == 0 || flightRecorderDumped_ || storeError_) {
+    return;
+  }
+  try {
+    if (!store_->check({std::string(kFlightRecorderDumpRequestKey)})) {
+      return;
+    }
+    const auto dump = dumpFlightRecorder();
+    LOG(INFO) << dump;
+    store_->set(
+        kFlightRecorderDumpKeyPrefix + std::to_string(rank_),
+        std::vector<uint8_t>(dump.begin(), dump.end()));
+    // One dump per request: re-arming requires deleting and re-setting the
+    // request key along with the published dumps.
+    flightRecorderDumped_ = true;
+    LOG(INFO) << "[Rank " << rank_
+              << "] Wrote flight recorder dump to store key: "
+              << kFlightRecorderDumpKeyPrefix << rank_;
+  } catch (const std::exception& e) {
+    LOG(WARNING) << "[Rank " << rank_
+                 << "] Failed to dump flight recorder to store: " << e.what();
+    storeError_ = true;
+  }
+}
+
 ProcessGroupNCCL::Options::Options(bool is_high_priority_stream)
     : Backend::Options(NCCL_BACKEND_NAME),
       is_high_priority_stream(is_high_priority_stream) {}
@@ -1519,6 +1669,178 @@ void ProcessGroupNCCL::endCoalescing(
   coalescing_active_ = false;
 }
 
+c10::intrusive_ptr<Work> ProcessGroupNCCL::batchCollective(
+    std::vector<CollectiveBatchEntry>& entries) {
+  TORCH_CHECK(!entries.empty(), "batchCollective expects at least one entry");
+  TORCH_CHECK(
+      !coalescing_active_,
+      "batchCollective cannot be nested inside startCoalescing/endCoalescing");
+  for (auto& entry : entries) {
+    check_gpu_single_tensor(entry.tensor);
+    TORCH_CHECK(
+        entry.tensor.device() == entries.front().tensor.device(),
+        "batchCollective expects all tensors on the same device");
+    if (entry.op == OpType::ALLTOALL_BASE) {
+      check_gpu_single_tensor(entry.output);
+      TORCH_CHECK(
+          entry.output.device() == entry.tensor.device(),
+          "batchCollective expects all tensors on the same device");
+    }
+  }
+
+  errorIfCapturingNonCapturableNCCL();
+
+  // Bump collective counter
+  seq_++;
+
+  const std::vector<at::Device> devices = {entries.front().tensor.device()};
+  const auto key = getKeyFromDevices(devices);
+  auto& ncclComms = getNCCLComm(key, devices, OpType::UNKNOWN);
+  auto& ncclStreams = ncclStreams_[key];
+
+  // First let NCCL streams wait for input tensors allocation streams
+  syncStreams(devices, ncclEvents_[key], ncclStreams);
+
+  // One work object and one pair of CUDA events for the whole batch.
+  auto work = initWork(devices, rank_, OpType::UNKNOWN, "nccl:batch_collective");
+
+  std::vector<at::Tensor> outputs;
+  outputs.reserve(entries.size());
+  for (auto& entry : entries) {
+    outputs.push_back(
+        entry.op == OpType::ALLTOALL_BASE ? entry.output : entry.tensor);
+  }
+  work->outputs_ = std::make_shared<std::vector<at::Tensor>>(std::move(outputs));
+
+  if (flightRecorderCapacity_ > 0) {
+    size_t bytes = 0;
+    for (const auto& entry : entries) {
+      bytes += entry.tensor.numel() * entry.tensor.element_size();
+    }
+    work->flightId_ = recordFlightEvent(
+        OpType::UNKNOWN, seq_, bytes, devices[0].index(), ncclStreams[0].id());
+  }
+
+  at::cuda::OptionalCUDAGuard gpuGuard;
+  gpuGuard.set_index(devices[0].index());
+
+  auto& ncclStream = ncclStreams[0];
+  auto& ncclComm = ncclComms[0];
+
+  // Start event should only be recorded before the ncclGroupStart()
+  if (desyncDebug_) {
+    (*work->ncclStartEvents_)[0].record(ncclStream);
+  }
+
+  {
+    torch::cuda::nccl::AutoNcclGroup nccl_group_guard;
+    for (auto& entry : entries) {
+      auto& tensor = entry.tensor;
+      // See [Sync Streams].
+      c10::cuda::CUDACachingAllocator::recordStream(
+          tensor.storage().data_ptr(), ncclStream);
+      const auto ncclDataType = getNcclDataType(tensor.scalar_type());
+      ncclResult_t result = ncclSuccess;
+      switch (entry.op) {
+        case OpType::ALLREDUCE:
+          result = ncclAllReduce(
+              tensor.data_ptr(),
+              tensor.data_ptr(),
+              tensor.numel(),
+              ncclDataType,
+              getNcclReduceOp(
+                  entry.reduceOp,
+                  tensor,
+                  ncclDataType,
+                  ncclComm->getNcclComm(),
+                  0),
+              ncclComm->getNcclComm(),
+              ncclStream.stream());
+          break;
+        case OpType::BROADCAST:
+          result = ncclBroadcast(
+              tensor.data_ptr(),
+              tensor.data_ptr(),
+              tensor.numel(),
+              ncclDataType,
+              entry.root,
+              ncclComm->getNcclComm(),
+              ncclStream.stream());
+          break;
+        case OpType::REDUCE:
+          result = ncclReduce(
+              tensor.data_ptr(),
+              tensor.data_ptr(),
+              tensor.numel(),
+              ncclDataType,
+              getNcclReduceOp(
+                  entry.reduceOp,
+                  tensor,
+                  ncclDataType,
+                  ncclComm->getNcclComm(),
+                  0),
+              entry.root,
+              ncclComm->getNcclComm(),
+              ncclStream.stream());
+          break;
+        case OpType::ALLTOALL_BASE: {
+#ifdef ENABLE_NCCL_P2P_SUPPORT
+          TORCH_CHECK(
+              entry.output.numel() == tensor.numel(),
+              "batchCollective alltoall expects equal-sized input and output");
+          c10::cuda::CUDACachingAllocator::recordStream(
+              entry.output.storage().data_ptr(), ncclStream);
+          torch::cuda::nccl::all2all_single_equal_split(
+              tensor,
+              entry.output,
+              this->getSize(),
+              ncclComm->getNcclComm(),
+              ncclStream);
+#else
+          TORCH_CHECK(
+              false,
+              "ProcessGroupNCCL only supports alltoall* for NCCL lib version >= 2.7.0");
+#endif
+          break;
+        }
+        default:
+          TORCH_CHECK(
+              false,
+              "Unsupported op in batchCollective: ",
+              opTypeToString(entry.op));
+      }
+      C10D_NCCL_CHECK(result, ncclComm->getNcclCommFailureReason());
+    }
+  }
+
+  // End event should only be recorded after the ncclGroupEnd()
+  (*work->ncclEndEvents_)[0].record(ncclStream);
+  work->ncclComms_[0] = ncclComms[0];
+
+  {
+    c10::cuda::CUDAMultiStreamGuard streamGuard(ncclStreams);
+    work->future_ = c10::make_intrusive<at::ivalue::Future>(
+        c10::ListType::create(c10::TensorType::get()), devices);
+    if (work->recordFunctionEndCallback_) {
+      work->future_->addCallback([work](at::ivalue::Future& /* unused */) {
+        work->recordFunctionEndCallback_();
+      });
+    }
+    work->future_->markCompleted(at::IValue(*work->outputs_));
+  }
+
+  // Set appropriate work parameters.
+  work->blockingWait_ = blockingWait_;
+  work->opTimeout_ = options_->timeout;
+  work->store_ = store_;
+
+  if (asyncErrorHandling_ != NoHandling) {
+    workEnqueue(work);
+  }
+
+  return work;
+}
+
 template <typename Fn, typename PreProcess, typename PostProcess>
 c10::intrusive_ptr<Work> ProcessGroupNCCL::collective(
     std::vector<at::Tensor>& inputs,
@@ -1573,6 +1895,15 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::collective(
   // Store references to outputs to be used by WorkNCCL::result and operator<<.
   work->outputs_ = std::make_shared<std::vector<at::Tensor>>(outputs);
 
+  if (flightRecorderCapacity_ > 0) {
+    size_t bytes = 0;
+    for (const auto& input : inputs) {
+      bytes += input.numel() * input.element_size();
+    }
+    work->flightId_ = recordFlightEvent(
+        opType, seq_, bytes, devices[0].index(), ncclStreams[0].id());
+  }
+
   at::cuda::OptionalCUDAGuard gpuGuard;
 
   // Start event should only be recorded before the ncclGroupStart()
@@ -1703,6 +2034,15 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::pointToPoint(
   // profiling.
   work->outputs_ = std::make_shared<std::vector<at::Tensor>>(tensors);
 
+  if (flightRecorderCapacity_ > 0) {
+    size_t bytes = 0;
+    for (const auto& tensor : tensors) {
+      bytes += tensor.numel() * tensor.element_size();
+    }
+    work->flightId_ = recordFlightEvent(
+        opType, seq_, bytes, devices[0].index(), ncclStreams_[key][0].id());
+  }
+
   at::cuda::OptionalCUDAGuard gpuGuard;
 
   // Start event should only be recorded before the ncclGroupStart()
@@ -1839,9 +2179,280 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduce_impl(
       "nccl:all_reduce");
 }
 
+// Note [Hierarchical allreduce]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// A flat ring allreduce over N nodes x L local ranks sends every byte of
+// the bucket across the slow inter-node links roughly twice per remote
+// rank, while the NVLink-connected ranks inside a node could have
+// pre-reduced it first. When Options::use_hierarchical_allreduce is set,
+// allreduce is decomposed into:
+//
+//   1. reduce-scatter over the intra-node group (NVLink), leaving each
+//      local rank with a 1/L shard of the node-local sum,
+//   2. allreduce of that shard over the inter-node group formed by the
+//      ranks that occupy the same local slot on every node, and
+//   3. allgather over the intra-node group to rebuild the full bucket.
+//
+// Each byte then crosses the inter-node fabric exactly once per direction
+// and the L inter-node rings run concurrently on disjoint shards. The
+// sub-groups are ordinary ProcessGroupNCCL instances scoped with a
+// PrefixStore, so their communicators live in the usual per-instance
+// cache and are torn down with the parent. Ranks are mapped to nodes by
+// exchanging hostnames through the store on first use; topologies the
+// decomposition cannot handle (one node, one rank per node, uneven
+// nodes) and unsupported inputs (multi-tensor, non-contiguous, numel not
+// divisible by L, PREMUL_SUM) silently fall back to the flat path, which
+// is always correct.
+bool ProcessGroupNCCL::initHierarchicalPGs() {
+  std::lock_guard<std::mutex> lock(hierarchyMutex_);
+  if (hierarchyInitAttempted_) {
+    return hierarchyUsable_;
+  }
+  hierarchyInitAttempted_ = true;
+
+  std::array<char, 256> hostname{};
+  if (gethostname(hostname.data(), hostname.size() - 1) != 0) {
+    LOG(WARNING) << "[Rank " << rank_
+                 << "] gethostname failed, falling back to flat allreduce";
+    return false;
+  }
+  std::string myHost(hostname.data());
+  store_->set(
+      "hierarchical/hostname/" + std::to_string(rank_),
+      std::vector<uint8_t>(myHost.begin(), myHost.end()));
+
+  // Store::get blocks until the key is published, so this doubles as the
+  // rendezvous barrier for the mapping below.
+  std::unordered_map<std::string, int> nodeOfHost;
+  std::vector<int> nodeOfRank(size_);
+  std::vector<int> localRankOf(size_);
+  std::vector<int> nodeSizes;
+  for (const auto r : c10::irange(size_)) {
+    auto vec = store_->get("hierarchical/hostname/" + std::to_string(r));
+    std::string host(vec.begin(), vec.end());
+    auto it = nodeOfHost.find(host);
+    if (it == nodeOfHost.end()) {
+      it = nodeOfHost.emplace(host, static_cast<int>(nodeSizes.size())).first;
+      nodeSizes.push_back(0);
+    }
+    nodeOfRank[r] = it->second;
+    localRankOf[r] = nodeSizes[it->second]++;
+  }
+
+  numNodes_ = static_cast<int>(nodeSizes.size());
+  nodeId_ = nodeOfRank[rank_];
+  intraNodeRank_ = localRankOf[rank_];
+  intraNodeSize_ = nodeSizes[nodeId_];
+
+  if (numNodes_ < 2 || intraNodeSize_ < 2) {
+    // Flat allreduce is already optimal for a single node or for one
+    // rank per node.
+    return false;
+  }
+  for (const auto s : nodeSizes) {
+    if (s != intraNodeSize_) {
+      LOG(WARNING) << "[Rank " << rank_
+                   << "] nodes have unequal rank counts, falling back to "
+                      "flat allreduce";
+      return false;
+    }
+  }
+
+  auto subOptions = Options::create(options_->is_high_priority_stream);
+  subOptions->timeout = options_->timeout;
+  auto intraStore = c10::make_intrusive<PrefixStore>(
+      "hierarchical/intra/" + std::to_string(nodeId_), store_);
+  intraNodePG_ = c10::make_intrusive<ProcessGroupNCCL>(
+      intraStore, intraNodeRank_, intraNodeSize_, subOptions);
+  // One inter-node group per local slot, so the L shard allreduces use
+  // disjoint sets of ranks and can proceed concurrently.
+  auto interStore = c10::make_intrusive<PrefixStore>(
+      "hierarchical/inter/" + std::to_string(intraNodeRank_), store_);
+  interNodePG_ = c10::make_intrusive<ProcessGroupNCCL>(
+      interStore, nodeId_, numNodes_, subOptions);
+
+  LOG(INFO) << "[Rank " << rank_ << "] hierarchical allreduce enabled over "
+            << numNodes_ << " nodes x " << intraNodeSize_ << " local ranks";
+  hierarchyUsable_ = true;
+  return true;
+}
+
+c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduce_hierarchical(
+    std::vector<at::Tensor>& tensors,
+    const AllreduceOptions& opts) {
+  ReduceOp reduceOp = opts.reduceOp;
+  // PREMUL_SUM would apply its scaling factor once per level; the other
+  // ops compose (SUM/MIN/MAX trivially, AVG because the node counts are
+  // equal).
+  if (tensors.size() != 1 || reduceOp == ReduceOp::PREMUL_SUM ||
+      !initHierarchicalPGs()) {
+    return allreduce_impl(tensors, opts);
+  }
+  auto& tensor = tensors[0];
+  const int64_t numel = tensor.numel();
+  if (!tensor.is_contiguous() || numel == 0 || numel % intraNodeSize_ != 0) {
+    return allreduce_impl(tensors, opts);
+  }
+
+  auto flat = tensor.view({numel});
+  auto shard = at::empty({numel / intraNodeSize_}, tensor.options());
+
+  // The intermediate waits only make the current stream wait on the
+  // preceding collective's CUDA event; the CPU is not blocked, and the
+  // Work returned for the trailing allgather completes after the whole
+  // chain by stream order.
+  ReduceScatterOptions rsOpts;
+  rsOpts.reduceOp = reduceOp;
+  rsOpts.timeout = opts.timeout;
+  intraNodePG_->_reduce_scatter_base(shard, flat, rsOpts)->wait();
+
+  AllreduceOptions arOpts;
+  arOpts.reduceOp = reduceOp;
+  arOpts.timeout = opts.timeout;
+  std::vector<at::Tensor> shards = {shard};
+  interNodePG_->allreduce(shards, arOpts)->wait();
+
+  AllgatherOptions agOpts;
+  agOpts.timeout = opts.timeout;
+  return intraNodePG_->_allgather_base(flat, shard, agOpts);
+}
+
+// Sparse allreduce follows the same protocol as the Gloo backend's: the
+// ranks allgather their nnz counts, then allgather (zero-padded) indices
+// and values, and every rank unions and sums the gathered pieces
+// locally. Here the union runs on device: at::sparse_coo_tensor over the
+// concatenated pieces followed by coalesce(), whose CUDA kernels sort
+// the indices and segment-reduce duplicate entries, so the gradient
+// never round-trips through host memory. The only host synchronization
+// is the nnz exchange, which determines the allgather padding.
+c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduceSparse(
+    std::vector<at::Tensor>& tensors,
+    const AllreduceOptions& opts) {
+  TORCH_CHECK(
+      tensors.size() == 1,
+      "Sparse allreduce only supports a single tensor per rank");
+  ReduceOp reduceOp = opts.reduceOp;
+  TORCH_CHECK(
+      reduceOp == ReduceOp::SUM,
+      "Sparse allreduce only works with ReduceOp.SUM");
+  auto& tensor = tensors[0];
+
+  const std::vector<at::Device> devices = {tensor.device()};
+  const auto key = getKeyFromDevices(devices);
+  // Materialize the communicator up front so the work returned below can
+  // report communicator failures like every other collective.
+  auto& ncclComms = getNCCLComm(key, devices, OpType::ALLREDUCE);
+
+  auto work =
+      initWork(devices, rank_, OpType::ALLREDUCE, "nccl:sparse_all_reduce");
+  work->ncclComms_[0] = ncclComms[0];
+
+  at::cuda::OptionalCUDAGuard gpuGuard;
+  gpuGuard.set_index(devices[0].index());
+  auto currentStream = at::cuda::getCurrentCUDAStream(devices[0].index());
+
+  if (desyncDebug_) {
+    (*work->ncclStartEvents_)[0].record(currentStream);
+  }
+
+  auto input = tensor.coalesce();
+  const auto sparseDim = input.sparse_dim();
+  auto indices = input._indices();
+  auto values = input._values();
+  // Number of value elements per sparse entry (product of the dense
+  // dimensions).
+  int64_t valElems = 1;
+  for (const auto d : c10::irange(size_t(1), values.sizes().size())) {
+    valElems *= values.sizes()[d];
+  }
+
+  // 1. Exchange nnz counts; this is the only host synchronization.
+  auto longOpts = at::TensorOptions().dtype(at::kLong).device(tensor.device());
+  auto nnzIn = at::full({1}, input._nnz(), longOpts);
+  auto nnzOut = at::empty({size_}, longOpts);
+  _allgather_base(nnzOut, nnzIn)->wait();
+  auto nnzHost = nnzOut.cpu();
+  const int64_t* nnzData = nnzHost.data_ptr<int64_t>();
+  int64_t maxNnz = 0;
+  for (const auto r : c10::irange(size_)) {
+    maxNnz = std::max(maxNnz, nnzData[r]);
+  }
+
+  at::Tensor result;
+  if (maxNnz == 0) {
+    std::vector<int64_t> valShape(
+        values.sizes().begin(), values.sizes().end());
+    valShape[0] = 0;
+    result = at::sparse_coo_tensor(
+        at::empty({sparseDim, 0}, longOpts),
+        at::empty(valShape, values.options()),
+        input.sizes(),
+        input.options());
+  } else {
+    // 2. Allgather indices and values, zero-padded to the largest nnz.
+    auto paddedIndices = at::zeros({sparseDim, maxNnz}, longOpts);
+    paddedIndices.narrow(1, 0, input._nnz()).copy_(indices);
+    auto paddedValues = at::zeros({maxNnz, valElems}, values.options());
+    if (input._nnz() > 0) {
+      paddedValues.narrow(0, 0, input._nnz())
+          .copy_(values.reshape({input._nnz(), valElems}));
+    }
+    auto indicesOut = at::empty({size_ * sparseDim * maxNnz}, longOpts);
+    auto indicesIn = paddedIndices.view({-1});
+    _allgather_base(indicesOut, indicesIn)->wait();
+    auto valuesOut =
+        at::empty({size_ * maxNnz * valElems}, values.options());
+    auto valuesIn = paddedValues.view({-1});
+    _allgather_base(valuesOut, valuesIn)->wait();
+
+    // 3. Union on device: drop the padding of each rank's piece,
+    // concatenate, and let coalesce() sort and sum duplicate indices.
+    auto indicesAll = indicesOut.view({size_, sparseDim, maxNnz});
+    auto valuesAll = valuesOut.view({size_, maxNnz, valElems});
+    std::vector<at::Tensor> indexPieces;
+    std::vector<at::Tensor> valuePieces;
+    int64_t totalNnz = 0;
+    for (const auto r : c10::irange(size_)) {
+      if (nnzData[r] == 0) {
+        continue;
+      }
+      indexPieces.push_back(indicesAll[r].narrow(1, 0, nnzData[r]));
+      valuePieces.push_back(valuesAll[r].narrow(0, 0, nnzData[r]));
+      totalNnz += nnzData[r];
+    }
+    std::vector<int64_t> valShape(
+        values.sizes().begin(), values.sizes().end());
+    valShape[0] = totalNnz;
+    result = at::sparse_coo_tensor(
+                 at::cat(indexPieces, 1),
+                 at::cat(valuePieces, 0).reshape(valShape),
+                 input.sizes(),
+                 input.options())
+                 .coalesce();
+  }
+
+  tensor.copy_(result);
+
+  // Everything after the allgathers runs on the current stream, so one
+  // end event on it covers the whole operation.
+  (*work->ncclEndEvents_)[0].record(currentStream);
+  work->outputs_ =
+      std::make_shared<std::vector<at::Tensor>>(std::vector<at::Tensor>{tensor});
+  work->future_ = c10::make_intrusive<at::ivalue::Future>(
+      c10::ListType::create(c10::TensorType::get()), devices);
+  work->future_->markCompleted(at::IValue(*work->outputs_));
+  work->blockingWait_ = blockingWait_;
+  work->opTimeout_ = options_->timeout;
+  work->store_ = store_;
+  return work;
+}
+
 c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduce(
     std::vector<at::Tensor>& tensors,
     const AllreduceOptions& opts) {
+  if (tensors.size() == 1 && tensors[0].is_sparse()) {
+    return allreduceSparse(tensors, opts);
+  }
   check_gpu_tensors_different_devices(tensors);
 
   // @lint-ignore CLANGTIDY
@@ -1860,6 +2471,9 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduce(
       std::vector<int64_t>(), // inSplitSizes
       std::vector<int64_t>()); // outSplitSizes
 
+  if (options_->use_hierarchical_allreduce) {
+    return allreduce_hierarchical(tensors, opts);
+  }
   return allreduce_impl(tensors, opts);
 }
 
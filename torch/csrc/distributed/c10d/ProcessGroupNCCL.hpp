@@ -42,6 +42,11 @@ constexpr const char* NCCL_ASYNC_ERROR_HANDLING = "NCCL_ASYNC_ERROR_HANDLING";
 // This variable must be set together with NCCL_ASYNC_ERROR_HANDLING.
 constexpr const char* NCCL_DESYNC_DEBUG = "NCCL_DESYNC_DEBUG";
 
+// Environment variable which controls the capacity of the per-rank flight
+// recorder ring buffer (number of collective descriptors retained). 0
+// disables recording. See Note [NCCL flight recorder].
+constexpr const char* NCCL_FLIGHT_RECORDER = "NCCL_FLIGHT_RECORDER";
+
 constexpr const char* NCCL_BACKEND_NAME = "nccl";
 
 // TearDown mode: tear down process upon error, see `WorkNCCL::handleNCCLGuard`
@@ -182,6 +187,13 @@ class TORCH_API ProcessGroupNCCL : public Backend {
     // This will be used by desync debug.
     bool startTraceUpdated_{false};
 
+    // Id of this work's entry in the flight recorder ring buffer, 0 if the
+    // recorder is disabled. See Note [NCCL flight recorder].
+    uint64_t flightId_{0};
+
+    // Whether the flight recorder entry has been marked started yet.
+    bool flightStartUpdated_{false};
+
     // Wrapper method for the static checkForNCCLErrors which can be overridden
     // for tests.
     virtual std::exception_ptr checkForNCCLErrors(
@@ -258,6 +270,12 @@ class TORCH_API ProcessGroupNCCL : public Backend {
 
     // Schedule NCCL operations on high priority CUDA streams
     bool is_high_priority_stream;
+
+    // Run allreduce as an intra-node reduce-scatter, an inter-node
+    // allreduce over one rank per node, and an intra-node allgather, so
+    // that each byte crosses the slow inter-node links only once. See
+    // Note [Hierarchical allreduce] in ProcessGroupNCCL.cpp.
+    bool use_hierarchical_allreduce = false;
   };
 
   // If you wish to create multiple process groups, each with a potentially
@@ -306,6 +324,30 @@ class TORCH_API ProcessGroupNCCL : public Backend {
   void endCoalescing(
       std::vector<c10::intrusive_ptr<Work>>& reqs) override;
 
+  // One entry of a batched submission, see batchCollective below.
+  struct CollectiveBatchEntry {
+    OpType op = OpType::ALLREDUCE;
+    // Operated on in place for ALLREDUCE/BROADCAST/REDUCE; the input for
+    // ALLTOALL_BASE.
+    at::Tensor tensor;
+    // Only used by ALLTOALL_BASE (equal splits).
+    at::Tensor output;
+    // Only used by BROADCAST and REDUCE.
+    int root = 0;
+    // Only used by ALLREDUCE and REDUCE.
+    ReduceOp reduceOp = ReduceOp::SUM;
+  };
+
+  // Issues many small collectives as one batch. Unlike the
+  // startCoalescing/endCoalescing markers, which still allocate a
+  // WorkNCCL and CUDA events per call, the whole batch is launched
+  // inside a single ncclGroup on one communicator and stream and shares
+  // one work object and one pair of events. All tensors must be dense
+  // and live on the same single device. Supported ops: ALLREDUCE,
+  // BROADCAST, REDUCE and equal-split ALLTOALL_BASE.
+  c10::intrusive_ptr<Work> batchCollective(
+      std::vector<CollectiveBatchEntry>& entries);
+
   c10::intrusive_ptr<Work> broadcast(
       std::vector<at::Tensor>& tensors,
       const BroadcastOptions& opts = BroadcastOptions()) override;
@@ -414,6 +456,11 @@ class TORCH_API ProcessGroupNCCL : public Backend {
   // Tests if the UCC fallback path is available
   bool isUCCAvailable() const;
 
+  // Renders the flight recorder ring buffer as human-readable text, oldest
+  // entry first. Returns an empty string if recording is disabled. See
+  // Note [NCCL flight recorder].
+  std::string dumpFlightRecorder();
+
  protected:
   // Helper that broadcasts nccl unique ID to all ranks through the store
   void broadcastUniqueNCCLID(
@@ -496,6 +543,24 @@ class TORCH_API ProcessGroupNCCL : public Backend {
       std::vector<at::Tensor>& tensors,
       const AllreduceOptions& opts = AllreduceOptions());
 
+  // Lazily creates the intra-node and inter-node sub process groups used
+  // by the hierarchical allreduce path. Returns false if the topology
+  // cannot support it (single node, one rank per node, or nodes with
+  // unequal rank counts), in which case callers fall back to the flat
+  // path. See Note [Hierarchical allreduce].
+  bool initHierarchicalPGs();
+
+  c10::intrusive_ptr<Work> allreduce_hierarchical(
+      std::vector<at::Tensor>& tensors,
+      const AllreduceOptions& opts);
+
+  // Allreduce for sparse COO tensors: allgathers nnz counts, indices and
+  // values, then unions and sums the result on device. See the comment
+  // on the definition for the full protocol.
+  c10::intrusive_ptr<Work> allreduceSparse(
+      std::vector<at::Tensor>& tensors,
+      const AllreduceOptions& opts);
+
   // Checks for NCCL errors on each of the communicators and returns an
   // appropriate exception_ptr (nullptr if no errors).
   static std::exception_ptr checkForNCCLErrorsInternal(
@@ -550,6 +615,21 @@ class TORCH_API ProcessGroupNCCL : public Backend {
   // used to scope keys used in the store.
   uint64_t ncclCommCounter_{0};
 
+  // Sub process groups backing the hierarchical allreduce path, created
+  // lazily on the first hierarchical collective. The intra-node group
+  // spans the ranks on this host; the inter-node group spans the ranks
+  // that share this rank's position within their host. See
+  // Note [Hierarchical allreduce] in ProcessGroupNCCL.cpp.
+  c10::intrusive_ptr<ProcessGroupNCCL> intraNodePG_;
+  c10::intrusive_ptr<ProcessGroupNCCL> interNodePG_;
+  int intraNodeRank_{-1};
+  int intraNodeSize_{0};
+  int nodeId_{-1};
+  int numNodes_{0};
+  bool hierarchyInitAttempted_{false};
+  bool hierarchyUsable_{false};
+  std::mutex hierarchyMutex_;
+
   // The store keys to trace the last NCCL collective kernel CUDA events - start
   // event and end event respectively. These are used to do desync root cause
   // analysis.
@@ -682,6 +762,63 @@ class TORCH_API ProcessGroupNCCL : public Backend {
   // Counting for the sequential number of NCCL collective call.
   uint64_t seq_{0};
 
+  // Note [NCCL flight recorder]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Desync debug only produces information once a collective has already
+  // timed out, and its per-op store traffic is too expensive to leave on.
+  // The flight recorder is the always-on counterpart: every collective and
+  // p2p launch appends a small descriptor (seq, op, message bytes, device,
+  // stream, enqueue time) to a fixed-size per-rank ring buffer, and the
+  // cleanup thread back-fills the observed start/completion times it already
+  // polls for. The hot-path cost is one short critical section per launch;
+  // there is no store or CUDA API traffic beyond what already exists.
+  //
+  // The buffer can be dumped on demand: dumpFlightRecorder() renders it as
+  // text (exposed to Python as _dump_flight_recorder), and setting the store
+  // key "nccl_flight_recorder_dump" from any rank makes every rank's
+  // watchdog write its buffer to the store under
+  // "nccl_flight_recorder/rank_<r>" and to the log, so a stuck job can be
+  // inspected without attaching a debugger. Capacity is configurable via
+  // NCCL_FLIGHT_RECORDER (default 256 entries, 0 disables).
+  struct FlightRecorderEntry {
+    uint64_t id = 0;
+    uint64_t seq = 0;
+    OpType opType = OpType::UNKNOWN;
+    size_t bytes = 0;
+    int device = -1;
+    int64_t streamId = -1;
+    // Wall-clock milliseconds since epoch; start/end are 0 until the cleanup
+    // thread observes the kernel started/completed (start requires desync
+    // debug's start events; end is always tracked).
+    int64_t enqueueTimeMs = 0;
+    int64_t startTimeMs = 0;
+    int64_t endTimeMs = 0;
+  };
+
+  // Appends an entry for a newly launched op and returns its id (0 if
+  // recording is disabled).
+  uint64_t recordFlightEvent(
+      OpType opType,
+      uint64_t seq,
+      size_t bytes,
+      int device,
+      int64_t streamId);
+
+  // Back-fill the start/completion time of the entry with the given id.
+  void markFlightStarted(uint64_t flightId);
+  void markFlightCompleted(uint64_t flightId);
+
+  // Watchdog hook: dumps the ring buffer to the store once if the dump
+  // request key has been set.
+  void maybeDumpFlightRecorderToStore();
+
+  std::mutex flightRecorderMutex_;
+  std::vector<FlightRecorderEntry> flightRecorderEntries_;
+  size_t flightRecorderIdx_{0};
+  size_t flightRecorderCapacity_{0};
+  uint64_t flightRecorderNextId_{1};
+  bool flightRecorderDumped_{false};
+
 #ifdef USE_NCCL_WITH_UCC
   // ProcessGroupUCC shared library handle and ProcessGroup pointer
   static std::shared_ptr<at::DynamicLibrary> uccLib_;
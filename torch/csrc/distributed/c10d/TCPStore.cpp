@@ -1,3 +1,4 @@
+#include <c10/util/ScopeExit.h>
 #include <c10/util/irange.h>
 #include <torch/csrc/distributed/c10d/TCPStore.hpp>
 
@@ -17,6 +18,10 @@
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
+
 #ifdef _WIN32
 #include <torch/csrc/distributed/c10d/WinSockUtils.hpp>
 #else
@@ -170,6 +175,11 @@ class TCPStoreMasterDaemon : public BackgroundThread {
   void run();
   void queryFds(std::vector<struct pollfd>& fds);
   void query(int socket);
+#ifdef __linux__
+  void queryDrain(int socket);
+#endif
+  // Drops the wait bookkeeping of a client whose connection errored out
+  void clearSocketWaitState(int socket);
 
   // The master runs on a single thread so only
   // one handler can be executed at a time
@@ -234,27 +244,7 @@ void TCPStoreMasterDaemon::queryFds(std::vector<struct pollfd>& fds) {
       // we hit an exception here.
 
       // Remove all the tracking state of the close FD
-      for (auto it = waitingSockets_.begin(); it != waitingSockets_.end();) {
-        for (auto vecIt = it->second.begin(); vecIt != it->second.end();) {
-          if (*vecIt == fds[fdIdx].fd) {
-            vecIt = it->second.erase(vecIt);
-          } else {
-            ++vecIt;
-          }
-        }
-        if (it->second.size() == 0) {
-          it = waitingSockets_.erase(it);
-        } else {
-          ++it;
-        }
-      }
-      for (auto it = keysAwaited_.begin(); it != keysAwaited_.end();) {
-        if (it->first == fds[fdIdx].fd) {
-          it = keysAwaited_.erase(it);
-        } else {
-          ++it;
-        }
-      }
+      clearSocketWaitState(fds[fdIdx].fd);
       fds.erase(fds.begin() + fdIdx);
       sockets_.erase(sockets_.begin() + fdIdx - CONNECT_SOCKET_OFFSET);
       --fdIdx;
@@ -263,6 +253,48 @@ void TCPStoreMasterDaemon::queryFds(std::vector<struct pollfd>& fds) {
   }
 }
 
+void TCPStoreMasterDaemon::clearSocketWaitState(int socket) {
+  for (auto it = waitingSockets_.begin(); it != waitingSockets_.end();) {
+    for (auto vecIt = it->second.begin(); vecIt != it->second.end();) {
+      if (*vecIt == socket) {
+        vecIt = it->second.erase(vecIt);
+      } else {
+        ++vecIt;
+      }
+    }
+    if (it->second.size() == 0) {
+      it = waitingSockets_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  for (auto it = keysAwaited_.begin(); it != keysAwaited_.end();) {
+    if (it->first == socket) {
+      it = keysAwaited_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+#ifdef __linux__
+// Handles every request that is already buffered on the socket, so a
+// single epoll wake-up services a whole burst of pipelined requests
+// instead of paying one event-loop round trip per request.
+void TCPStoreMasterDaemon::queryDrain(int socket) {
+  do {
+    query(socket);
+    char byte;
+    ssize_t ret = ::recv(socket, &byte, 1, MSG_PEEK | MSG_DONTWAIT);
+    if (ret <= 0) {
+      // Nothing buffered (or the peer closed the connection, which the
+      // next epoll wake-up will surface as a recv failure).
+      break;
+    }
+  } while (true);
+}
+#endif
+
 // query communicates with the worker. The format
 // of the query is as follows:
 // type of query | size of arg1 | arg1 | size of arg2 | arg2 | ...
@@ -531,6 +563,82 @@ void TCPStoreMasterDaemon::run() {
     queryFds(fds);
   }
 }
+#elif defined(__linux__)
+// The daemon serves every client from this single thread, multiplexed
+// with epoll. Unlike the poll() loop used on the other platforms, the
+// kernel hands us only the descriptors that actually have data, so the
+// cost of a wake-up is proportional to the number of active clients
+// rather than to the number of connected ones. That difference is what
+// keeps large-scale rendezvous (thousands of ranks connecting and
+// hammering the store at once) from degrading quadratically.
+//
+// Wait notification is already a broadcast: a set/add wakes every
+// waiter of the key in one pass over waitingSockets_ (see
+// wakeupWaitingClients), and queryDrain() batches the requests that
+// pile up on a socket between two wake-ups.
+void TCPStoreMasterDaemon::run() {
+  int epollFd;
+  SYSCHECK_ERR_RETURN_NEG1(epollFd = ::epoll_create1(EPOLL_CLOEXEC));
+  auto epollGuard = c10::make_scope_exit([epollFd] { ::close(epollFd); });
+
+  auto addFd = [epollFd](int fd) {
+    struct epoll_event ev {};
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+    SYSCHECK_ERR_RETURN_NEG1(::epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev));
+  };
+  addFd(storeListenSocket_.handle());
+  // See the comment in the poll() variant below for why the control pipe
+  // is watched for POLLIN rather than just POLLHUP. EPOLLHUP is always
+  // reported, it does not need to be requested.
+  addFd(controlPipeFd_[0]);
+
+  std::array<struct epoll_event, 64> events{};
+  bool finished = false;
+  while (!finished) {
+    int numReady;
+    SYSCHECK_ERR_RETURN_NEG1(
+        numReady =
+            ::epoll_wait(epollFd, events.data(), events.size(), /*timeout=*/-1));
+
+    for (const auto i : c10::irange(numReady)) {
+      const int eventFd = events[i].data.fd;
+
+      // The pipe receives an event which tells us to shutdown the daemon
+      if (eventFd == controlPipeFd_[0]) {
+        finished = true;
+        break;
+      }
+
+      // TCPStore's listening socket has an event and it should now be able
+      // to accept new connections. Level-triggered epoll re-reports the
+      // listening socket while its backlog is non-empty, so accepting one
+      // connection per event is sufficient.
+      if (eventFd == storeListenSocket_.handle()) {
+        Socket socket = storeListenSocket_.accept();
+        int rawSocket = socket.handle();
+        sockets_.emplace_back(std::move(socket));
+        addFd(rawSocket);
+        continue;
+      }
+
+      try {
+        queryDrain(eventFd);
+      } catch (...) {
+        // See the comment in queryFds for why a failed query tears the
+        // connection down instead of propagating.
+        clearSocketWaitState(eventFd);
+        ::epoll_ctl(epollFd, EPOLL_CTL_DEL, eventFd, nullptr);
+        for (auto it = sockets_.begin(); it != sockets_.end(); ++it) {
+          if (it->handle() == eventFd) {
+            sockets_.erase(it);
+            break;
+          }
+        }
+      }
+    }
+  }
+}
 #else
 void TCPStoreMasterDaemon::run() {
   std::vector<struct pollfd> fds;
@@ -44,6 +44,76 @@ c10::intrusive_ptr<c10::ivalue::Future> FP16CompressCommHook::runHook(
   return allreduce_fut->then(decompress, allreduce_fut->elementType());
 }
 
+c10::intrusive_ptr<c10::ivalue::Future> BF16CompressCommHook::runHook(
+    GradBucket& bucket) {
+  auto compressed_tensor = bucket.getBufferRef().to(torch::kBFloat16);
+  // Apply the division first to avoid overflow.
+  compressed_tensor /= state_->getSize();
+  std::vector<at::Tensor> tensors = {compressed_tensor};
+
+  auto allreduce_fut = ops::allreduce(state_, tensors)->getFuture();
+  auto decompressed_tensor = bucket.getBufferRef();
+  auto decompress = [decompressed_tensor](c10::ivalue::Future& allreduce_fut) {
+    auto result = allreduce_fut.value();
+    TORCH_INTERNAL_ASSERT(
+        result.isTensorList(),
+        "ProcessGroup::allreduce should return TensorList");
+
+    auto reduce_tensor = result.toTensorVector()[0];
+    TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
+        reduce_tensor.scalar_type() == at::ScalarType::BFloat16,
+        "Expected reduced tensor to be bf16 in BF16CompressHook, but got type ",
+        reduce_tensor.scalar_type());
+    decompressed_tensor.copy_(reduce_tensor);
+    return c10::IValue(decompressed_tensor);
+  };
+
+  return allreduce_fut->then(decompress, allreduce_fut->elementType());
+}
+
+c10::intrusive_ptr<c10::ivalue::Future> Int8QuantizeCommHook::runHook(
+    GradBucket& bucket) {
+  auto& buffer = bucket.getBufferRef();
+  const auto world_size = static_cast<int64_t>(state_->getSize());
+  const int64_t numel = buffer.numel();
+  constexpr int64_t kScaleBytes = static_cast<int64_t>(sizeof(float));
+
+  // Symmetric per-bucket scale; clamp so an all-zero bucket does not
+  // divide by zero.
+  auto scale = buffer.abs().max().clamp_min_(1e-10).div_(127.0);
+
+  // Payload layout: [scale as 4 raw bytes | numel int8 values].
+  auto input =
+      at::empty({kScaleBytes + numel}, buffer.options().dtype(at::kChar));
+  input.narrow(0, 0, kScaleBytes).view(at::kFloat).copy_(scale);
+  input.narrow(0, kScaleBytes, numel)
+      .copy_(buffer.div(scale).round_().clamp_(-127, 127));
+
+  auto output =
+      at::empty({world_size * (kScaleBytes + numel)}, input.options());
+  auto allgather_fut = ops::_allgather_base(state_, output, input)->getFuture();
+
+  auto decompress = [buffer, output, world_size, numel](
+                        c10::ivalue::Future& fut) {
+    (void)fut.value();
+    auto chunks = output.view({world_size, kScaleBytes + numel});
+    auto scales = chunks.narrow(1, 0, kScaleBytes)
+                      .contiguous()
+                      .view(at::kFloat)
+                      .to(buffer.scalar_type())
+                      .view({world_size, 1});
+    auto dequantized = chunks.narrow(1, kScaleBytes, numel)
+                           .to(buffer.scalar_type())
+                           .mul_(scales)
+                           .sum(0)
+                           .div_(static_cast<double>(world_size));
+    buffer.copy_(dequantized);
+    return c10::IValue(buffer);
+  };
+
+  return allgather_fut->then(decompress, allgather_fut->elementType());
+}
+
 c10::intrusive_ptr<c10::ivalue::Future> _AllReduceBySumCommHook::runHook(
     GradBucket& bucket) {
   std::vector<at::Tensor> tensors = {bucket.getBufferRef()};
@@ -8,6 +8,8 @@ namespace c10d {
 enum class BuiltinCommHookType {
   ALLREDUCE = 1,
   FP16_COMPRESS = 2,
+  BF16_COMPRESS = 3,
+  INT8_QUANTIZE = 4,
 };
 
 class AllReduceCommHook : public CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>> {
@@ -30,6 +32,35 @@ class FP16CompressCommHook : public CppCommHookInterface<c10::intrusive_ptr<Proc
   c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
 };
 
+// Same as FP16CompressCommHook but casts to bfloat16, which keeps the
+// fp32 exponent range and so needs no loss scaling.
+class BF16CompressCommHook
+    : public CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>> {
+ public:
+  explicit BF16CompressCommHook(const c10::intrusive_ptr<ProcessGroup>& state)
+      : CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>>(state) {}
+
+  ~BF16CompressCommHook() override = default;
+
+  c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
+};
+
+// Quantizes the bucket to int8 with one symmetric scale per bucket. The
+// scale is packed into the payload's first four bytes so a single
+// allgather moves both; ranks then dequantize and average locally
+// (summing int8 payloads directly would overflow and per-rank scales
+// differ, so an allreduce cannot be used).
+class Int8QuantizeCommHook
+    : public CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>> {
+ public:
+  explicit Int8QuantizeCommHook(const c10::intrusive_ptr<ProcessGroup>& state)
+      : CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>>(state) {}
+
+  ~Int8QuantizeCommHook() override = default;
+
+  c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
+};
+
 // Almost same as AllReduceCommHook, but without division inside the hook.
 // This enables the optimization of fusing copy and division and saves one scan
 // over all the input parameters, when no communication hook is provided by the user.
@@ -32,6 +32,7 @@
 
 #include <fmt/format.h>
 #include <pybind11/chrono.h>
+#include <torch/csrc/distributed/c10d/FlatParameter.hpp>
 #include <torch/csrc/distributed/c10d/PrefixStore.hpp>
 
 #include <torch/csrc/distributed/c10d/comm.hpp>
@@ -381,10 +382,83 @@ Returns:
 Replaces the tensor in the bucket with the input tensor buffer.
 )");
 
+  shared_ptr_class_<::c10d::FlatParameter>(
+      module,
+      "_FlatParameter",
+      R"(
+Views a list of parameters into one contiguous flat buffer that can be
+sharded across a process group and gathered back with a single collective.
+The parameters are rebound as views of the buffer, so ``unshard`` makes all
+of them valid again without per-parameter copies.
+)")
+      .def(
+          py::init<
+              std::vector<at::Tensor>,
+              c10::intrusive_ptr<::c10d::ProcessGroup>>(),
+          py::arg("parameters"),
+          py::arg("process_group"))
+      .def(
+          "shard",
+          &::c10d::FlatParameter::shard,
+          py::call_guard<py::gil_scoped_release>(),
+          R"(
+Saves this rank's shard and frees the flat buffer. The parameters must not
+be used until the next :meth:`unshard` completes.
+)")
+      .def(
+          "unshard",
+          &::c10d::FlatParameter::unshard,
+          py::call_guard<py::gil_scoped_release>(),
+          R"(
+Reallocates the flat buffer and gathers all shards into it with a single
+all-gather.
+
+Returns:
+    The collective's ``Work``. The parameters may be used once it completes.
+)")
+      .def(
+          "is_sharded",
+          &::c10d::FlatParameter::isSharded,
+          R"(
+Returns:
+    Whether the flat buffer is currently freed down to this rank's shard.
+)")
+      .def(
+          "full_buffer",
+          &::c10d::FlatParameter::fullBuffer,
+          R"(
+Returns:
+    The 1D flat buffer. Its storage is empty while sharded.
+)")
+      .def(
+          "local_shard",
+          &::c10d::FlatParameter::localShard,
+          R"(
+Returns:
+    This rank's slice of the flat buffer. Only current while sharded.
+)")
+      .def(
+          "parameters",
+          &::c10d::FlatParameter::parameters,
+          R"(
+Returns:
+    The parameters, rebound as views of the flat buffer.
+)")
+      .def(
+          "numel",
+          &::c10d::FlatParameter::numel,
+          R"(
+Returns:
+    The total number of parameter elements, excluding padding.
+)");
+
   py::enum_<::c10d::BuiltinCommHookType>(module, "BuiltinCommHookType", R"(
-An enum-like class for built-in communication hooks: ``ALLREDUCE`` and ``FP16_COMPRESS``.)")
+An enum-like class for built-in communication hooks: ``ALLREDUCE``, ``FP16_COMPRESS``,
+``BF16_COMPRESS`` and ``INT8_QUANTIZE``.)")
       .value("ALLREDUCE", ::c10d::BuiltinCommHookType::ALLREDUCE)
-      .value("FP16_COMPRESS", ::c10d::BuiltinCommHookType::FP16_COMPRESS);
+      .value("FP16_COMPRESS", ::c10d::BuiltinCommHookType::FP16_COMPRESS)
+      .value("BF16_COMPRESS", ::c10d::BuiltinCommHookType::BF16_COMPRESS)
+      .value("INT8_QUANTIZE", ::c10d::BuiltinCommHookType::INT8_QUANTIZE);
 
   shared_ptr_class_<::c10d::Reducer>(module, "Reducer")
       .def(
@@ -439,6 +513,13 @@ An enum-like class for built-in communication hooks: ``ALLREDUCE`` and ``FP16_CO
             reducer.install_futures(std::move(futures));
           },
           py::call_guard<py::gil_scoped_release>())
+      .def(
+          "_set_fused_sgd_in_backward",
+          &::c10d::Reducer::set_fused_sgd_in_backward,
+          py::arg("lr"),
+          py::arg("momentum") = 0.0,
+          py::arg("weight_decay") = 0.0,
+          py::call_guard<py::gil_scoped_release>())
       .def(
           "_rebuild_buckets",
           &::c10d::Reducer::rebuild_buckets,
@@ -2059,6 +2140,10 @@ options :class:`~torch.distributed.ProcessGroupNCCL.Options`).
               py::arg("size"),
               py::arg("timeout") = kProcessGroupDefaultTimeout,
               py::call_guard<py::gil_scoped_release>())
+          .def(
+              "_dump_flight_recorder",
+              &::c10d::ProcessGroupNCCL::dumpFlightRecorder,
+              py::call_guard<py::gil_scoped_release>())
           .def_property_readonly(
               "options", &::c10d::ProcessGroupNCCL::getOptions)
           .def_property_readonly(
@@ -2077,6 +2162,14 @@ Arguments:
             to prioritize NCCL kernels when there are compute kernels waiting.
             Default is False.
 
+Attributes:
+    use_hierarchical_allreduce (bool): when True, allreduce runs as an
+            intra-node reduce-scatter, an inter-node allreduce and an
+            intra-node allgather, so each byte crosses the inter-node
+            links only once. Helps on multi-node clusters whose
+            inter-node bandwidth is much lower than NVLink.
+            Default is False.
+
 Example::
     >>> import torch.distributed as dist
     >>>
@@ -2087,7 +2180,10 @@ Example::
       .def(py::init<bool>(), py::arg("is_high_priority_stream") = false)
       .def_readwrite(
           "is_high_priority_stream",
-          &::c10d::ProcessGroupNCCL::Options::is_high_priority_stream);
+          &::c10d::ProcessGroupNCCL::Options::is_high_priority_stream)
+      .def_readwrite(
+          "use_hierarchical_allreduce",
+          &::c10d::ProcessGroupNCCL::Options::use_hierarchical_allreduce);
   processGroupNCCL.def_static(
       "_group_start", []() { ::c10d::ProcessGroupNCCL::groupStart(); });
   processGroupNCCL.def_static(
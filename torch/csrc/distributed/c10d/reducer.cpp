@@ -229,6 +229,17 @@ Reducer::Reducer(
     backward_stats_.resize(variable_count);
   }
 
+  // Arrival-time-profiled rebucketing: average gradient readiness times
+  // over this many warmup iterations before rebuilding buckets, instead
+  // of using the hook firing order of the first backward pass alone.
+  {
+    const auto profile_iters_str = parse_env("DDP_PROFILE_REBUILD_ITERS");
+    if (profile_iters_str.compare("N/A") != 0) {
+      profile_rebuild_iters_ = std::stoll(profile_iters_str);
+      param_ready_time_sum_.resize(params_.size(), 0);
+    }
+  }
+
   // See Note [Skip allreducing local_used_map_dev]
   if (find_unused_parameters_) {
     initialize_local_used_map();
@@ -905,6 +916,26 @@ void Reducer::all_reduce_bucket(Bucket& bucket) {
       bucket.sizes_vec,
       variables_for_bucket);
   bucket.future_work = run_comm_hook(grad_bucket);
+
+  if (per_bucket_optimizer_callback_) {
+    REDUCER_CHECK(
+        comm_hook_ == nullptr,
+        logger_,
+        "Per-bucket optimizer callbacks are not composable with custom "
+        "communication hooks.");
+    // The future runs callbacks under a stream guard on side streams that
+    // have already synchronized with the allreduce, so the optimizer step
+    // overlaps with the reduction of later buckets and remaining backward
+    // compute without racing on the gradients. The built-in allreduce hook
+    // reduces in place, so `bucket_views_out` alias the reduced gradients by
+    // the time the future completes.
+    bucket.future_work->addCallback(
+        [this,
+         params = std::move(variables_for_bucket),
+         grads = bucket.bucket_views_out](c10::ivalue::Future&) mutable {
+          per_bucket_optimizer_callback_(params, grads);
+        });
+  }
 }
 
 std::vector<at::Tensor> Reducer::get_variables_for_bucket(
@@ -974,6 +1005,65 @@ void Reducer::install_futures(
   }
 }
 
+void Reducer::set_per_bucket_optimizer_callback(
+    std::function<void(std::vector<at::Tensor>&, std::vector<at::Tensor>&)>
+        callback) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  per_bucket_optimizer_callback_ = std::move(callback);
+}
+
+void Reducer::set_fused_sgd_in_backward(
+    double lr,
+    double momentum,
+    double weight_decay) {
+  // Momentum buffers are keyed by parameter so they survive bucket rebuilds.
+  // Callbacks for different buckets may run concurrently on different side
+  // streams' threads, hence the mutex; buckets hold disjoint parameters, so
+  // the arithmetic itself never races.
+  struct SgdState {
+    std::mutex mutex;
+    std::unordered_map<c10::TensorImpl*, at::Tensor> momentum_buffers;
+  };
+  auto state = std::make_shared<SgdState>();
+  set_per_bucket_optimizer_callback(
+      [lr, momentum, weight_decay, state](
+          std::vector<at::Tensor>& params, std::vector<at::Tensor>& grads) {
+        if (params.empty()) {
+          return;
+        }
+        at::NoGradGuard no_grad;
+        std::vector<at::Tensor> updates;
+        if (weight_decay != 0) {
+          // Out of place so that the reduced gradients that later get copied
+          // into each parameter's `.grad` stay untouched.
+          updates = at::_foreach_add(grads, params, weight_decay);
+        } else {
+          updates = grads;
+        }
+        if (momentum != 0) {
+          std::lock_guard<std::mutex> lock(state->mutex);
+          std::vector<at::Tensor> seen_buffers;
+          std::vector<at::Tensor> seen_updates;
+          for (const auto i : c10::irange(params.size())) {
+            auto& buf =
+                state->momentum_buffers[params[i].unsafeGetTensorImpl()];
+            if (!buf.defined()) {
+              buf = updates[i].clone().detach();
+            } else {
+              seen_buffers.push_back(buf);
+              seen_updates.push_back(updates[i]);
+            }
+            updates[i] = buf;
+          }
+          if (!seen_buffers.empty()) {
+            at::_foreach_mul_(seen_buffers, momentum);
+            at::_foreach_add_(seen_buffers, seen_updates);
+          }
+        }
+        at::_foreach_add_(params, updates, -lr);
+      });
+}
+
 void Reducer::initialize_buckets(
     std::vector<std::vector<size_t>> bucket_indices) {
   // If initialize_buckets is called inside DDP constructor, then
@@ -1494,6 +1584,15 @@ void Reducer::finalize_backward() {
   TORCH_INTERNAL_ASSERT(require_finalize_);
   require_finalize_ = false;
 
+  // Accumulate this iteration's per-parameter readiness times while the
+  // arrival-time-profiled rebuild is still measuring.
+  if (profile_rebuild_iters_ > 0 && should_rebuild_buckets()) {
+    for (const auto i : c10::irange(backward_stats_.size())) {
+      param_ready_time_sum_[i] += backward_stats_[i];
+    }
+    ++profiled_iterations_;
+  }
+
   // Wait for asynchronous reduction to complete, and unflatten the bucket's
   // flattened `gradients` tensor.
   for (auto& bucket : buckets_) {
@@ -1671,6 +1770,31 @@ bool Reducer::rebuild_buckets() {
     return false;
   }
 
+  if (profile_rebuild_iters_ > 0) {
+    if (profiled_iterations_ < profile_rebuild_iters_) {
+      // Still profiling. Discard the hook-order record of this iteration;
+      // the autograd hooks repopulate it during the next backward pass.
+      rebuilt_params_.clear();
+      rebuilt_param_indices_.clear();
+      return false;
+    }
+    // Reorder the parameters by their mean measured readiness time
+    // rather than by the hook firing order of the last iteration, which
+    // can be unrepresentative (e.g. late embedding gradients that jitter
+    // across iterations). Ranks may disagree on the order here; the
+    // assignment computed below is synced from rank 0 as usual.
+    std::stable_sort(
+        rebuilt_param_indices_.begin(),
+        rebuilt_param_indices_.end(),
+        [this](int64_t lhs, int64_t rhs) {
+          return param_ready_time_sum_[lhs] < param_ready_time_sum_[rhs];
+        });
+    rebuilt_params_.clear();
+    for (const auto variable_index : rebuilt_param_indices_) {
+      rebuilt_params_.push_back(params_[variable_index]);
+    }
+  }
+
   TORCH_INTERNAL_ASSERT(
       rebuilt_params_.size() == rebuilt_param_indices_.size(),
       c10::str(
@@ -1688,8 +1812,20 @@ bool Reducer::rebuild_buckets() {
           rebuilt_param_indices_.size()));
   std::vector<std::vector<size_t>> rebuilt_bucket_indices;
   std::vector<size_t> bucket_size_limits;
-  bucket_size_limits.push_back(first_bucket_bytes_cap_);
-  bucket_size_limits.push_back(bucket_bytes_cap_);
+  if (profile_rebuild_iters_ > 0 && first_bucket_bytes_cap_ > 0 &&
+      first_bucket_bytes_cap_ < bucket_bytes_cap_) {
+    // Graduated schedule: the early buckets stay small so their
+    // reductions launch as soon as possible and overlap the rest of the
+    // backward pass, doubling up to the regular cap.
+    for (int64_t cap = first_bucket_bytes_cap_; cap < bucket_bytes_cap_;
+         cap += cap) {
+      bucket_size_limits.push_back(cap);
+    }
+    bucket_size_limits.push_back(bucket_bytes_cap_);
+  } else {
+    bucket_size_limits.push_back(first_bucket_bytes_cap_);
+    bucket_size_limits.push_back(bucket_bytes_cap_);
+  }
   std::vector<size_t> per_bucket_size_limits;
   auto ddp_set_last_bucket_as_small =
       (parse_env("DDP_SET_LAST_BUCKET_CAP").compare("1") == 0);
@@ -1767,6 +1903,14 @@ void Reducer::register_builtin_comm_hook(
       comm_hook_ = std::make_unique<c10d::FP16CompressCommHook>(process_group_);
       LOG(INFO) << "Built-in communication hook FP16_COMPRESS is registered.";
       break;
+    case c10d::BuiltinCommHookType::BF16_COMPRESS:
+      comm_hook_ = std::make_unique<c10d::BF16CompressCommHook>(process_group_);
+      LOG(INFO) << "Built-in communication hook BF16_COMPRESS is registered.";
+      break;
+    case c10d::BuiltinCommHookType::INT8_QUANTIZE:
+      comm_hook_ = std::make_unique<c10d::Int8QuantizeCommHook>(process_group_);
+      LOG(INFO) << "Built-in communication hook INT8_QUANTIZE is registered.";
+      break;
     default:
       TORCH_WARN_ONCE(
           "Unknown built-in DDP comm hook type is provided. No comm hook will be used.");
@@ -123,6 +123,25 @@ class TORCH_API Reducer {
   // to any user-originating futures that need to be awaited.
   void install_futures(c10::List<c10::intrusive_ptr<c10::ivalue::Future>> futs);
 
+  // Registers a callback that runs once per bucket as soon as that bucket's
+  // allreduce completes, receiving the bucket's parameters and their reduced
+  // gradients. The callback is attached to the bucket's future, so it runs
+  // under a stream guard on side streams that have synchronized with the
+  // allreduce, overlapping with the reduction of later buckets and any
+  // remaining backward compute. Not composable with custom communication
+  // hooks, gradient accumulation, or `no_sync`.
+  void set_per_bucket_optimizer_callback(
+      std::function<void(std::vector<at::Tensor>&, std::vector<at::Tensor>&)>
+          callback);
+
+  // Installs a built-in per-bucket callback running a fused
+  // `at::_foreach_`-based SGD step (with optional momentum and weight decay)
+  // on a bucket's parameters right after its gradients finish reducing.
+  void set_fused_sgd_in_backward(
+      double lr,
+      double momentum,
+      double weight_decay);
+
   // Returns true if we should rebuild buckets, else false. We only rebuild
   // buckets once after the first iteration and never rebuild them if
   // find_unused_parameters_.
@@ -229,6 +248,10 @@ class TORCH_API Reducer {
   // List of futures installed by Reducer::install_futures that should be awaited
   // at the end of backwards pass.
   c10::optional<c10::List<c10::intrusive_ptr<c10::ivalue::Future>>> installed_futures_{c10::nullopt};
+  // Callback fired per bucket when its allreduce completes. See
+  // set_per_bucket_optimizer_callback.
+  std::function<void(std::vector<at::Tensor>&, std::vector<at::Tensor>&)>
+      per_bucket_optimizer_callback_;
 
   // Work handle for allreduce on local_used_map_
   c10::intrusive_ptr<c10d::Work> local_used_work_;
@@ -416,6 +439,17 @@ class TORCH_API Reducer {
   bool has_rebuilt_bucket_;
   std::vector<at::Tensor> rebuilt_params_;
   std::vector<int64_t> rebuilt_param_indices_;
+
+  // Number of backward passes over which per-parameter readiness times
+  // (backward_stats_) are accumulated before buckets are rebuilt in
+  // measured mean arrival order instead of the hook firing order of a
+  // single iteration. Parsed from DDP_PROFILE_REBUILD_ITERS in the
+  // constructor; zero (the default) keeps the single-iteration rebuild.
+  int64_t profile_rebuild_iters_{0};
+  // Per parameter, the sum of backward_stats_ over the profiled
+  // iterations.
+  std::vector<int64_t> param_ready_time_sum_;
+  int64_t profiled_iterations_{0};
   const int64_t bucket_bytes_cap_;
 
 #ifndef _WIN32
@@ -3,9 +3,15 @@
 #ifdef USE_TENSORPIPE
 
 #include <c10/util/irange.h>
+#include <c10/util/llvmMathExtras.h>
 
 #include <tensorpipe/tensorpipe.h>
 
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
 namespace torch {
 namespace distributed {
 namespace rpc {
@@ -33,6 +39,101 @@ inline c10::Device indexToDevice(c10::DeviceIndex index) {
   }
 }
 
+// Note [TensorPipe receive buffer pool]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Every incoming RPC tensor used to be received into a freshly malloc'd
+// buffer, and fabric backends (e.g. ibverbs) pay a registration cost that is
+// keyed on the buffer's address range, so a fresh allocation per message
+// defeats the registration caches those backends keep. To make steady-state
+// transfers hit warm buffers, receive-side allocations are served from a
+// small pool of recycled blocks, bucketed by power-of-two size class. Blocks
+// are handed back to the pool by the DataPtr deleter when the receiving
+// tensor dies, so a parameter server pulling the same payload shapes every
+// iteration keeps reusing the same few address ranges. The pool is bounded:
+// blocks above kMaxPooledBlockBytes bypass it, and once kMaxPooledTotalBytes
+// of blocks are cached further returns are simply freed. It can be disabled
+// with TORCH_RPC_DISABLE_RECV_BUFFER_POOL=1.
+class CpuRecvBufferPool {
+ public:
+  static CpuRecvBufferPool& instance() {
+    // Leaky singleton: receive buffers may outlive static destruction.
+    static CpuRecvBufferPool* pool = new CpuRecvBufferPool();
+    return *pool;
+  }
+
+  at::DataPtr allocate(size_t length) {
+    if (disabled_ || length == 0 || length > kMaxPooledBlockBytes) {
+      return at::getCPUAllocator()->allocate(length);
+    }
+    size_t sizeClass = sizeClassFor(length);
+    at::DataPtr block;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto& freeList = freeLists_[sizeClass];
+      if (!freeList.empty()) {
+        block = std::move(freeList.back());
+        freeList.pop_back();
+        cachedBytes_ -= blockBytes(sizeClass);
+      }
+    }
+    if (!block) {
+      block = at::getCPUAllocator()->allocate(blockBytes(sizeClass));
+    }
+    void* data = block.get();
+    auto* ctx = new PooledBlockContext{std::move(block), sizeClass};
+    return at::DataPtr(
+        data, ctx, &CpuRecvBufferPool::returnBlock, c10::DeviceType::CPU);
+  }
+
+ private:
+  static constexpr size_t kMinPooledBlockBytes = 4096;
+  static constexpr size_t kMaxPooledBlockBytes = 64 * 1024 * 1024;
+  static constexpr size_t kMaxPooledTotalBytes = 1024 * 1024 * 1024;
+  static constexpr size_t kNumSizeClasses = 15; // 4KB, 8KB, ..., 64MB
+
+  struct PooledBlockContext {
+    at::DataPtr block;
+    size_t sizeClass;
+  };
+
+  CpuRecvBufferPool() {
+    const char* disable = std::getenv("TORCH_RPC_DISABLE_RECV_BUFFER_POOL");
+    disabled_ = disable != nullptr && std::strcmp(disable, "1") == 0;
+  }
+
+  static size_t sizeClassFor(size_t length) {
+    if (length <= kMinPooledBlockBytes) {
+      return 0;
+    }
+    return llvm::Log2_64_Ceil(length) - llvm::Log2_64_Ceil(kMinPooledBlockBytes);
+  }
+
+  static size_t blockBytes(size_t sizeClass) {
+    return kMinPooledBlockBytes << sizeClass;
+  }
+
+  static void returnBlock(void* rawCtx) {
+    auto* ctx = static_cast<PooledBlockContext*>(rawCtx);
+    auto& pool = instance();
+    {
+      std::lock_guard<std::mutex> lock(pool.mutex_);
+      size_t bytes = blockBytes(ctx->sizeClass);
+      if (pool.cachedBytes_ + bytes <= kMaxPooledTotalBytes) {
+        pool.freeLists_[ctx->sizeClass].push_back(std::move(ctx->block));
+        pool.cachedBytes_ += bytes;
+      }
+    }
+    // If the cache was full, ctx->block still holds the buffer and frees it
+    // through the underlying allocator here.
+    delete ctx;
+  }
+
+  bool disabled_;
+  std::mutex mutex_;
+  std::array<std::vector<at::DataPtr>, kNumSizeClasses> freeLists_;
+  size_t cachedBytes_ = 0;
+};
+
 class TensorpipeCpuConverter : public TensorpipeDeviceTypeConverter {
  public:
   c10::optional<std::vector<char>> prepareTensorForSending(
@@ -75,7 +176,9 @@ class TensorpipeCpuConverter : public TensorpipeDeviceTypeConverter {
       size_t length,
       const std::vector<c10::Stream>& /* streams */,
       tensorpipe::Allocation& allocation) const override {
-    at::DataPtr dataPtr = at::getCPUAllocator()->allocate(length);
+    // See Note [TensorPipe receive buffer pool]: recycling receive buffers
+    // keeps fabric backends hitting their memory-registration caches.
+    at::DataPtr dataPtr = CpuRecvBufferPool::instance().allocate(length);
 
     tensorpipe::CpuBuffer buffer;
     buffer.ptr = dataPtr.get();
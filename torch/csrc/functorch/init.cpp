@@ -440,6 +440,12 @@ void initFuncTorchBindings(PyObject* module) {
       "Set vmap fallback warnings");
   m.def("_set_vmap_fallback_enabled", &at::functorch::setVmapFallbackEnabled);
   m.def("_is_vmap_fallback_enabled", &at::functorch::isVmapFallbackEnabled);
+  m.def(
+      "_vmap_fallback_usage",
+      &at::functorch::getVmapFallbackUsage,
+      "Per-operator counts of vmap fallback executions");
+  m.def(
+      "_reset_vmap_fallback_usage", &at::functorch::resetVmapFallbackUsage);
   m.def(
       "set_inplace_requires_grad_allowed",
       &at::functorch::setInplaceRequiresGradAllowed);
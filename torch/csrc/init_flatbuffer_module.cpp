@@ -14,6 +14,7 @@
 #include <Python.h> // NOLINT
 #include <torch/csrc/jit/mobile/flatbuffer_loader.h>
 #include <torch/csrc/jit/python/module_python.h>
+#include <torch/csrc/jit/python/pybind_utils.h>
 #include <torch/csrc/jit/python/python_ivalue.h>
 #include <torch/csrc/jit/python/python_sugared_value.h>
 #include <torch/csrc/jit/serialization/export.h>
@@ -113,6 +114,26 @@ extern "C"
             reinterpret_cast<char*>(detached_buffer->data()),
             detached_buffer->size());
       });
+  pym.def("_save_ivalue_to_bytes", [](const py::object& obj) {
+    auto ivalue = toTypeInferredIValue(obj);
+    auto detached_buffer = torch::jit::save_ivalue_to_bytes(ivalue);
+    return py::bytes(
+        reinterpret_cast<char*>(detached_buffer->data()),
+        detached_buffer->size());
+  });
+  pym.def("_save_ivalue_to_file", [](const py::object& obj, const std::string& filename) {
+    auto ivalue = toTypeInferredIValue(obj);
+    torch::jit::save_ivalue_to_file(ivalue, filename);
+  });
+  pym.def("_load_ivalue_from_bytes", [](const std::string& bytes) {
+    auto bytes_copy = copyStr(bytes);
+    auto ivalue =
+        torch::jit::parse_ivalue_from_flatbuffer(bytes_copy.get(), bytes.size());
+    return toPyObject(std::move(ivalue));
+  });
+  pym.def("_load_ivalue_from_file", [](const std::string& filename) {
+    return toPyObject(torch::jit::load_ivalue_from_flatbuffer_file(filename));
+  });
   pym.def(
       "_get_module_info_from_flatbuffer", [](std::string flatbuffer_content) {
         py::gil_scoped_acquire acquire;
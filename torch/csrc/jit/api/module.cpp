@@ -317,6 +317,35 @@ Module Module::deepcopy() const {
   return Module(_ivalue()->deepcopy());
 }
 
+Module Module::warm_copy() const {
+  at::NoGradGuard no_grad;
+  auto object = c10::ivalue::Object::create(
+      c10::StrongTypePtr(_ivalue()->compilation_unit(), type()),
+      type()->numAttributes());
+  for (const auto i : c10::irange(type()->numAttributes())) {
+    IValue s = _ivalue()->getSlot(i);
+    if (type()->getAttribute(i)->is_module()) {
+      object->setSlot(i, Module(s.toObject()).warm_copy()._ivalue());
+    } else if (s.isTensor()) {
+      const auto& t = s.toTensor();
+      if (type()->is_buffer(i) || !t.has_storage()) {
+        // Buffers (running stats, caches) are replica-private state; opaque
+        // tensors have no storage to share.
+        object->setSlot(i, s.deepcopy());
+      } else {
+        // Parameters and tensor attributes are treated as frozen weights: a
+        // fresh TensorImpl over the same storage, so only metadata is
+        // duplicated.
+        object->setSlot(i, t.alias());
+      }
+    } else {
+      // Non-tensor state (counters, containers) is private to the replica.
+      object->setSlot(i, s.deepcopy());
+    }
+  }
+  return Module(std::move(object));
+}
+
 Module Module::clone(bool inplace) const {
   std::unordered_map<TypePtr, TypePtr> type_remap;
   IValue::HashAliasedIValueMap memo;
@@ -236,6 +236,16 @@ struct TORCH_API Module : public Object {
 
   Module deepcopy() const;
 
+  // Creates a warm replica of the module for multi-interpreter serving:
+  // the ClassType and methods are shared, submodule objects are recreated,
+  // buffers and non-tensor attributes are deep-copied (they are the
+  // replica-private mutable state), and parameters and tensor attributes get
+  // fresh TensorImpls over the *same* storages, so the model's weights are
+  // not duplicated. The shared weights must be treated as frozen constants:
+  // in-place writes to them are visible to every replica. Spinning up a
+  // replica therefore costs only the buffer copies, not a model reload.
+  Module warm_copy() const;
+
   // Clones both the underlying `ClassType` and the module instance(data), this
   // function creates a new `ClassType` and returns a new instance that has the
   // same data as the current instance but with the new type, shared ClassType
@@ -1,14 +1,92 @@
 #include <torch/csrc/jit/ir/constants.h>
 
 #include <ATen/core/functional.h>
+#include <c10/util/hash.h>
 #include <torch/csrc/autograd/variable.h>
 #include <torch/csrc/jit/ir/ir.h>
 #include <torch/csrc/jit/runtime/custom_operator.h>
 #include <torch/csrc/jit/runtime/operator.h>
 
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
 namespace torch {
 namespace jit {
 
+namespace {
+
+// Note [Constant tensor interning]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// When the same scripted model is loaded into several interpreters (or the
+// same weight tensor becomes a constant in many graphs after freezing), each
+// insertConstant call normally keeps its own copy of the tensor alive. Since
+// constant tensors are already assumed immutable by the rest of the stack
+// (ConstantPooling merges nodes whose values compare equal, and AliasDb gives
+// them the read-only wildcard treatment), it is safe to also share the
+// *storage* of value-equal constants across graphs. This process-wide table
+// maps a content hash to previously inserted constant tensors; on a confirmed
+// match tryInsertConstant reuses the existing tensor instead of the incoming
+// copy. Entries hold weak references so the table never extends a tensor's
+// lifetime. Guarded by TORCH_JIT_INTERN_CONSTANT_TENSORS since user code that
+// unsafely mutates constants via data_ptr would now alias across modules.
+bool internConstantTensorsEnabled() {
+  static const bool enabled = []() {
+    const char* env = std::getenv("TORCH_JIT_INTERN_CONSTANT_TENSORS");
+    return env != nullptr && std::strcmp(env, "0") != 0;
+  }();
+  return enabled;
+}
+
+size_t hashConstantTensor(const at::Tensor& t) {
+  size_t seed = static_cast<size_t>(t.scalar_type());
+  seed = c10::hash_combine(seed, static_cast<size_t>(t.dim()));
+  seed = c10::hash_combine(seed, t.nbytes());
+  for (auto size : t.sizes()) {
+    seed = c10::hash_combine(seed, static_cast<size_t>(size));
+  }
+  // Sample up to 256 bytes from each end of the buffer; full equality is
+  // confirmed with Tensor::equal before a table hit is reused.
+  const auto* data = static_cast<const uint8_t*>(t.data_ptr());
+  size_t sample = std::min<size_t>(t.nbytes(), 256);
+  for (size_t i = 0; i < sample; ++i) {
+    seed = c10::hash_combine(seed, data[i]);
+    seed = c10::hash_combine(seed, data[t.nbytes() - 1 - i]);
+  }
+  return seed;
+}
+
+at::Tensor internConstantTensor(at::Tensor t) {
+  if (!internConstantTensorsEnabled() || !t.is_cpu() ||
+      !t.is_contiguous(at::MemoryFormat::Contiguous) || t.is_quantized() ||
+      t.nbytes() == 0) {
+    return t;
+  }
+  static std::mutex mutex;
+  static std::unordered_multimap<size_t, WeakIValue> interned;
+  std::lock_guard<std::mutex> lock(mutex);
+  size_t key = hashConstantTensor(t);
+  auto range = interned.equal_range(key);
+  for (auto it = range.first; it != range.second;) {
+    IValue candidate = it->second.lock();
+    if (candidate.isNone()) {
+      it = interned.erase(it);
+      continue;
+    }
+    at::Tensor cached = candidate.toTensor();
+    if (cached.scalar_type() == t.scalar_type() &&
+        cached.sizes() == t.sizes() && cached.equal(t)) {
+      return cached;
+    }
+    ++it;
+  }
+  interned.emplace(key, WeakIValue(IValue(t)));
+  return t;
+}
+
+} // namespace
+
 bool insertableTensor(const at::Tensor& ten) {
   // bail if tensor has no storage i.e. opaque tensor used in MKLdnn.
   // or gradients because we have no way of serializing them & are mutable
@@ -76,6 +154,8 @@ c10::optional<Value*> tryInsertConstant(
       return g.insertNode(g.createNone())->output();
     }
     TORCH_INTERNAL_ASSERT(!ref.requires_grad());
+    // See Note [Constant tensor interning]
+    ref = internConstantTensor(std::move(ref));
     n->output()->inferTypeFrom(
         ref); // note: before t_ because of std::move(ref)
     n->t_(attr::value, std::move(ref));
@@ -191,7 +271,10 @@ c10::optional<IValue> toIValue(const Value* v) {
     return tup;
   } else if (type == StringType::get()) {
     const auto& s = node->s(attr::value);
-    return s;
+    // constants with the same text share one ConstantString; graphs are
+    // lowered to Code once per specialization, so without interning every
+    // specialization re-allocates every string constant
+    return IValue(c10::ivalue::ConstantString::intern(s));
   } else if (type == DeviceObjType::get()) {
     auto d = c10::Device(node->s(attr::value));
     return d;
@@ -3,6 +3,8 @@
 #endif // FLATBUFFERS_VERSION_MAJOR
 
 #include <array>
+#include <cstdlib>
+#include <cstring>
 #include <istream>
 #include <memory>
 #include <string>
@@ -87,6 +89,11 @@ class FlatbufferLoader final {
       IValueParser parser);
   mobile::Module parseModule(mobile::serialization::Module* module);
 
+  // Parses a flatbuffer produced by save_ivalue_to_bytes: same Module
+  // table, but state_obj is an arbitrary IValue rather than a module
+  // object.
+  IValue parseStateIValue(mobile::serialization::Module* module);
+
   void extractJitSourceAndConstants(
       ExtraFilesMap* jit_sources,
       std::vector<IValue>* constants);
@@ -321,6 +328,33 @@ mobile::Module FlatbufferLoader::parseModule(
   return m;
 }
 
+IValue FlatbufferLoader::parseStateIValue(
+    mobile::serialization::Module* module) {
+  module_ = module;
+  all_ivalues_.clear();
+  all_types_.clear();
+  storages_.clear();
+  storage_loaded_.clear();
+  module_parsed_ = false;
+
+  const auto* ivalues = module->ivalues();
+  all_ivalues_.resize(ivalues->size());
+  all_types_.resize(module->object_types()->size());
+  storages_.resize(module->storage_data_size());
+  storage_loaded_.resize(module->storage_data_size(), false);
+
+  mobile_ivalue_size_ = module_->mobile_ivalue_size();
+  if (mobile_ivalue_size_ == 0) {
+    mobile_ivalue_size_ = ivalues->size();
+  }
+
+  for (uint32_t i = 0; i < mobile_ivalue_size_; i++) {
+    parseAndPopulate(i, ivalues->Get(i));
+  }
+  module_parsed_ = true;
+  return getIValue(module->state_obj());
+}
+
 void appendUpgraderFunctions(mobile::Function* function) {
 #ifndef DISABLE_UPGRADER
   for (auto& byteCodeFunctionWithOperator : getUpgraderBytecodeList()) {
@@ -329,10 +363,31 @@ void appendUpgraderFunctions(mobile::Function* function) {
 #endif
 }
 
+// Resolving every operator against the dispatcher at load time is a
+// measurable part of cold start on edge devices. When this is set the
+// resolution happens on the first call of each method instead
+// (Function::run already initializes lazily); the cost is that a missing
+// operator surfaces at first execution rather than at load.
+bool deferOperatorInitEnabled() {
+  static const bool enabled = []() {
+    const char* env = std::getenv("TORCH_MOBILE_DEFER_OPERATOR_INIT");
+    return env != nullptr && std::strcmp(env, "0") != 0;
+  }();
+  return enabled;
+}
+
 std::unique_ptr<mobile::Function> FlatbufferLoader::parseFunction(
     const mobile::serialization::Function* method) {
   auto function = std::make_unique<mobile::Function>(
       c10::QualifiedName(method->qn()->str()));
+  // The flatbuffer already knows every size, so allocate each Code vector
+  // exactly once instead of growing it append by append.
+  mobile::Code& code = function->get_code();
+  code.instructions_.reserve(method->instructions()->size());
+  code.constants_.reserve(method->constants()->size());
+  code.op_names_.reserve(method->operators()->size());
+  code.operator_input_sizes_.reserve(method->operators()->size());
+  code.types_.reserve(method->type_annotations()->size());
   // TODO(qihan) add debug handle
   // const auto* debug_handle = method->debug_info()->debug_handle();
   for (const auto* inst : *method->instructions()) {
@@ -360,7 +415,9 @@ std::unique_ptr<mobile::Function> FlatbufferLoader::parseFunction(
         op->name()->str(), op->overload_name()->str(), num_args);
   }
 
-  function->initialize_operators(true);
+  if (!deferOperatorInitEnabled()) {
+    function->initialize_operators(true);
+  }
 
   for (const auto i : *method->type_annotations()) {
     function->append_type(getOrCreateTypeAnnotations(i));
@@ -803,6 +860,24 @@ mobile::Module parse_and_initialize_mobile_module_for_jit(
   return m;
 }
 
+c10::IValue parse_ivalue_from_flatbuffer(void* data, size_t) {
+  TORCH_CHECK(
+      mobile::serialization::ModuleBufferHasIdentifier(data), "Format error");
+  FlatbufferLoader loader;
+  // The returned IValue has no way to keep the flatbuffer alive, so
+  // tensor storages are always copied out of it.
+  loader.setShouldCopyTensorMemory(true);
+  auto* flatbuffer_module = mobile::serialization::GetMutableModule(data);
+  return loader.parseStateIValue(flatbuffer_module);
+}
+
+c10::IValue load_ivalue_from_flatbuffer_file(const std::string& filename) {
+  std::shared_ptr<char> data;
+  size_t size = 0;
+  std::tie(data, size) = get_file_content(filename.c_str());
+  return parse_ivalue_from_flatbuffer(data.get(), size);
+}
+
 mobile::Module load_mobile_module_from_file(
     const std::string& filename,
     c10::optional<c10::Device> device,
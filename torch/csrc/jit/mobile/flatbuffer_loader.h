@@ -103,6 +103,14 @@ TORCH_API mobile::Module load_mobile_module_from_file(
     c10::optional<at::Device> device = c10::nullopt,
     ExtraFilesMap* extra_files = nullptr);
 
+// Parses a flatbuffer produced by save_ivalue_to_bytes (e.g. an eager
+// state dict) without executing any pickle opcodes. Tensor storages are
+// copied out of the buffer, so the caller may free it afterwards.
+TORCH_API c10::IValue parse_ivalue_from_flatbuffer(void* data, size_t size);
+
+TORCH_API c10::IValue load_ivalue_from_flatbuffer_file(
+    const std::string& filename);
+
 TORCH_API uint64_t get_bytecode_version(std::istream& in);
 TORCH_API uint64_t get_bytecode_version(const std::string& filename);
 TORCH_API uint64_t get_bytecode_version_from_bytes(char* flatbuffer_content);
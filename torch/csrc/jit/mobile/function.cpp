@@ -8,6 +8,9 @@
 #include <torch/csrc/jit/runtime/instruction.h>
 #include <torch/csrc/jit/runtime/operator.h>
 
+#include <mutex>
+#include <unordered_set>
+
 namespace torch {
 namespace jit {
 
@@ -53,6 +56,23 @@ void Function::append_operator(
   code_.operator_input_sizes_.emplace_back(num_specified_args.value_or(-1));
 }
 
+namespace {
+// Operators that could only be resolved to the boxed dispatcher entry point.
+// Kept around so callers can find candidates for unboxed resolution; see
+// getBoxedOperators() below.
+std::mutex boxed_ops_mutex;
+std::unordered_set<std::string>& boxedOperatorNames() {
+  static std::unordered_set<std::string> names;
+  return names;
+}
+} // namespace
+
+std::vector<std::string> getBoxedOperators() {
+  std::lock_guard<std::mutex> guard(boxed_ops_mutex);
+  const auto& names = boxedOperatorNames();
+  return std::vector<std::string>(names.begin(), names.end());
+}
+
 std::string operator_str(const c10::OperatorName& opname) {
   std::string result = opname.name;
   if (!opname.overload_name.empty()) {
@@ -178,12 +198,22 @@ c10::optional<std::function<void(Stack&)>> makeOperatorFunction(
   } else {
     std::shared_ptr<Operator> jit_op = findOperatorFor(opname);
     if (jit_op) {
-      fn = [jit_op](Stack& stack) { jit_op->getOperation()(stack); };
+      // Resolve the Operation once here instead of on every call:
+      // getOperation() folds over the Either holding the op and copies a
+      // std::function, which dominates call overhead for cheap ops. jit_op is
+      // captured as well to keep the schema (pArgs below) alive.
+      fn = [jit_op, op_fn = jit_op->getOperation()](Stack& stack) mutable {
+        op_fn(stack);
+      };
       pArgs = &jit_op->schema().arguments();
     } else {
       auto op = c10::Dispatcher::singleton().findSchema(opname);
       if (op.has_value()) {
-        fn = [op](Stack& stack) { op->callBoxed(&stack); };
+        {
+          std::lock_guard<std::mutex> guard(boxed_ops_mutex);
+          boxedOperatorNames().insert(full_name);
+        }
+        fn = [handle = *op](Stack& stack) { handle.callBoxed(&stack); };
         if (op->hasSchema()) {
           pArgs = &op->schema().arguments();
         } else {
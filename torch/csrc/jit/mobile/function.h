@@ -81,6 +81,12 @@ c10::optional<std::function<void(Stack&)>> makeOperatorFunction(
 
 TORCH_API std::string operator_str(const c10::OperatorName& opname);
 
+// Names of operators that makeOperatorFunction could only resolve through the
+// boxed dispatcher entry point (i.e. not a prim op and not a JIT operator).
+// These still pay boxing overhead per call and are the candidates to promote
+// if mobile call overhead shows up in profiles.
+TORCH_API std::vector<std::string> getBoxedOperators();
+
 } // namespace mobile
 } // namespace jit
 } // namespace torch
@@ -0,0 +1,246 @@
+#include <torch/csrc/jit/passes/aot_autodiff.h>
+
+#include <c10/util/irange.h>
+#include <torch/csrc/jit/passes/common_subexpression_elimination.h>
+#include <torch/csrc/jit/passes/constant_pooling.h>
+#include <torch/csrc/jit/passes/dead_code_elimination.h>
+#include <torch/csrc/jit/passes/inliner.h>
+#include <torch/csrc/jit/passes/lower_graph.h>
+#include <torch/csrc/jit/runtime/autodiff.h>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+bool isAutogradZero(Value* v) {
+  return v->node()->kind() == prim::AutogradZero;
+}
+
+// Lowers the runtime-only autograd placeholders out of the backward graph so
+// it can be serialized like any other method. The exported backward assumes
+// all vjps it receives are defined, so AutogradAdd degenerates to aten::add,
+// and vjp outputs that are AutogradZero (inputs with no gradient path) are
+// dropped together with their df_output_vjps entries.
+void lowerAutogradOpsForExport(Gradient& grad) {
+  auto& df = *grad.df;
+
+  std::vector<Node*> autograd_adds;
+  for (Node* node : df.nodes()) {
+    if (node->kind() == prim::AutogradAdd) {
+      autograd_adds.push_back(node);
+    }
+  }
+  for (Node* node : autograd_adds) {
+    Value* a = node->input(0);
+    Value* b = node->input(1);
+    Value* sum = nullptr;
+    if (isAutogradZero(a)) {
+      sum = b;
+    } else if (isAutogradZero(b)) {
+      sum = a;
+    } else {
+      WithInsertPoint guard(node);
+      sum = df.insert(aten::add, {a, b});
+    }
+    node->output()->replaceAllUsesWith(sum);
+    node->destroy();
+  }
+
+  // differentiate packs df's outputs into a single tuple; prune the elements
+  // that carry no gradient and rebuild the tuple so its type stays accurate.
+  Node* tuple = df.outputs().at(0)->node();
+  TORCH_INTERNAL_ASSERT(tuple->kind() == prim::TupleConstruct);
+  std::vector<Value*> kept_elements;
+  std::vector<size_t> kept_vjps;
+  TORCH_INTERNAL_ASSERT(tuple->inputs().size() == grad.df_output_vjps.size());
+  for (const auto i : c10::irange(tuple->inputs().size())) {
+    Value* element = tuple->input(i);
+    if (isAutogradZero(element)) {
+      continue;
+    }
+    kept_elements.push_back(element);
+    kept_vjps.push_back(grad.df_output_vjps[i]);
+  }
+  if (kept_elements.size() != tuple->inputs().size()) {
+    WithInsertPoint guard(tuple);
+    Node* new_tuple = df.insertNode(df.createTuple(kept_elements));
+    tuple->output()->replaceAllUsesWith(new_tuple->output());
+    tuple->destroy();
+    grad.df_output_vjps = std::move(kept_vjps);
+  }
+
+  EliminateDeadCode(grad.df);
+  for (Node* node : df.nodes()) {
+    TORCH_CHECK(
+        node->kind() != prim::AutogradZero &&
+            node->kind() != prim::AutogradAdd,
+        "ahead-of-time differentiation could not lower ",
+        node->kind().toDisplayString(),
+        " out of the backward graph");
+  }
+}
+
+// Runs CSE on the forward graph and propagates the result across the
+// forward/backward boundary: if two captured outputs of f collapsed to the
+// same value, df only needs one of the captures, and purely-captured outputs
+// of f that became redundant are removed entirely.
+void eliminateCommonCapturesAcrossBoundary(Gradient& grad) {
+  EliminateCommonSubexpression(grad.f);
+
+  // df's inputs are laid out as [vjps][captured inputs][captured outputs].
+  const size_t captured_outputs_base =
+      grad.df_input_vjps.size() + grad.df_input_captured_inputs.size();
+
+  // First position among the captured outputs at which each value appears.
+  std::unordered_map<Value*, size_t> first_pos;
+  for (const auto k : c10::irange(grad.df_input_captured_outputs.size())) {
+    Value* v = grad.f->outputs().at(grad.df_input_captured_outputs[k]);
+    first_pos.emplace(v, k);
+  }
+
+  // Walk backwards so erasing formals and outputs doesn't shift the indices
+  // of the entries still to be visited.
+  for (size_t k = grad.df_input_captured_outputs.size(); k-- > 0;) {
+    const size_t out_idx = grad.df_input_captured_outputs[k];
+    Value* v = grad.f->outputs().at(out_idx);
+    const size_t p = first_pos.at(v);
+    if (p == k) {
+      continue;
+    }
+    // Reroute df through the first capture of this value and drop ours.
+    grad.df->inputs()
+        .at(captured_outputs_base + k)
+        ->replaceAllUsesWith(grad.df->inputs().at(captured_outputs_base + p));
+    grad.df->eraseInput(captured_outputs_base + k);
+    grad.df_input_captured_outputs.erase(
+        grad.df_input_captured_outputs.begin() + k);
+
+    // If the output existed only to be captured, remove it from f as well.
+    // Real outputs and outputs that a vjp attaches to must stay.
+    const bool is_temporary = out_idx >= grad.f_real_outputs &&
+        std::find(
+            grad.df_input_vjps.begin(), grad.df_input_vjps.end(), out_idx) ==
+            grad.df_input_vjps.end() &&
+        std::find(
+            grad.df_input_captured_outputs.begin(),
+            grad.df_input_captured_outputs.end(),
+            out_idx) == grad.df_input_captured_outputs.end();
+    if (!is_temporary) {
+      continue;
+    }
+    grad.f->eraseOutput(out_idx);
+    for (auto& offset : grad.df_input_vjps) {
+      if (offset > out_idx) {
+        --offset;
+      }
+    }
+    for (auto& offset : grad.df_input_captured_outputs) {
+      if (offset > out_idx) {
+        --offset;
+      }
+    }
+  }
+}
+
+// Installs a self-less graph as a method on the module. The unused self
+// formal is prepended so the graph obeys the method calling convention.
+void installMethod(
+    Module& module,
+    const std::string& name,
+    const std::shared_ptr<Graph>& graph) {
+  graph->insertInput(0, "self")->setType(module.type());
+  auto* fn = module._ivalue()->compilation_unit()->create_function(
+      c10::QualifiedName(*module.type()->name(), name), graph);
+  module.type()->addMethod(fn);
+}
+
+IValue toIntList(const std::vector<size_t>& offsets) {
+  c10::List<int64_t> list;
+  list.reserve(offsets.size());
+  for (size_t offset : offsets) {
+    list.push_back(static_cast<int64_t>(offset));
+  }
+  return list;
+}
+
+} // namespace
+
+void DifferentiateMethodAheadOfTime(
+    Module& module,
+    const std::string& method_name) {
+  const std::string forward_name = method_name + "_aot_forward";
+  const std::string backward_name = method_name + "_aot_backward";
+  TORCH_CHECK(
+      !module.find_method(forward_name) && !module.find_method(backward_name),
+      "module already has an ahead-of-time derivative of '",
+      method_name,
+      "'");
+
+  auto graph = module.get_method(method_name).graph()->copy();
+  Inline(*graph);
+  // Lift parameters and attributes to explicit trailing inputs so the
+  // autodiff sees them and produces vjps for the parameters.
+  std::vector<IValue> lifted_params;
+  std::tie(graph, lifted_params) = LowerGraph(*graph, module._ivalue());
+  for (Node* node : graph->nodes()) {
+    TORCH_CHECK(
+        isDifferentiable(node),
+        "cannot differentiate '",
+        method_name,
+        "' ahead of time: ",
+        node->kind().toDisplayString(),
+        " does not have a symbolic derivative");
+  }
+
+  Gradient grad = differentiate(graph);
+  eliminateCommonCapturesAcrossBoundary(grad);
+  lowerAutogradOpsForExport(grad);
+  for (const auto& g : {grad.f, grad.df}) {
+    EliminateCommonSubexpression(g);
+    ConstantPooling(g);
+    EliminateDeadCode(g);
+  }
+
+  c10::List<at::Tensor> param_tensors;
+  param_tensors.reserve(lifted_params.size());
+  for (const auto& param : lifted_params) {
+    TORCH_CHECK(
+        param.isTensor(),
+        "cannot differentiate '",
+        method_name,
+        "' ahead of time: it uses a non-tensor attribute of type ",
+        param.type()->repr_str());
+    param_tensors.push_back(param.toTensor());
+  }
+
+  installMethod(module, forward_name, grad.f);
+  installMethod(module, backward_name, grad.df);
+
+  const std::string prefix = method_name + "_aot_";
+  module.register_attribute(
+      prefix + "f_real_outputs",
+      IntType::get(),
+      static_cast<int64_t>(grad.f_real_outputs));
+  module.register_attribute(
+      prefix + "df_input_vjps",
+      ListType::ofInts(),
+      toIntList(grad.df_input_vjps));
+  module.register_attribute(
+      prefix + "df_input_captured_inputs",
+      ListType::ofInts(),
+      toIntList(grad.df_input_captured_inputs));
+  module.register_attribute(
+      prefix + "df_input_captured_outputs",
+      ListType::ofInts(),
+      toIntList(grad.df_input_captured_outputs));
+  module.register_attribute(
+      prefix + "df_output_vjps",
+      ListType::ofInts(),
+      toIntList(grad.df_output_vjps));
+  module.register_attribute(
+      prefix + "lifted_params", ListType::ofTensors(), param_tensors);
+}
+
+} // namespace jit
+} // namespace torch
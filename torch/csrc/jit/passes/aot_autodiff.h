@@ -0,0 +1,46 @@
+/** \brief Ahead-of-time differentiation of scripted module methods.
+ *
+ * The profiling executor calls jit::differentiate at runtime, once per
+ * specialization of every differentiable subgraph. For a fixed training
+ * graph the derivative can instead be taken once at export time, letting the
+ * forward and backward be optimized together and shipped with the module.
+ */
+#pragma once
+
+#include <torch/csrc/jit/api/module.h>
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+/** \brief Differentiate a method of \p module ahead of time.
+ *
+ * Inlines and lowers the method's graph (lifting parameters and attributes
+ * to explicit trailing inputs), runs jit::differentiate on the whole graph,
+ * optimizes the forward and backward together -- common subexpression
+ * elimination on the forward is propagated across the boundary by
+ * deduplicating the captures the backward consumes -- and installs the two
+ * graphs as new methods `<name>_aot_forward` and `<name>_aot_backward`, so
+ * they are serialized with the module like any other method.
+ *
+ * The Gradient bookkeeping needed to wire the pair into autograd (see the
+ * Gradient struct in torch/csrc/jit/runtime/autodiff.h) is
+ * stored as `<name>_aot_*` integer-list attributes, and the lifted
+ * parameter values as `<name>_aot_lifted_params`. All offsets refer to the
+ * explicit (non-self) inputs and outputs of the installed methods.
+ *
+ * The exported backward assumes every vjp passed to it is defined: the
+ * prim::AutogradAdd/prim::AutogradZero placeholders that handle undefined
+ * gradients at runtime are lowered to plain aten::add (or pruned) so that
+ * both graphs are serializable. Inputs that receive no gradient are dropped
+ * from the backward's outputs and from `<name>_aot_df_output_vjps`.
+ *
+ * Every top-level node of the lowered graph must have a symbolic derivative;
+ * otherwise this pass throws.
+ */
+TORCH_API void DifferentiateMethodAheadOfTime(
+    Module& module,
+    const std::string& method_name = "forward");
+
+} // namespace jit
+} // namespace torch
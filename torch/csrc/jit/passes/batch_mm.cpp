@@ -3,6 +3,7 @@
 #include <ATen/core/functional.h>
 #include <ATen/core/symbol.h>
 #include <c10/util/Exception.h>
+#include <c10/util/accumulate.h>
 #include <c10/util/irange.h>
 #include <torch/csrc/jit/ir/alias_analysis.h>
 #include <torch/csrc/jit/ir/constants.h>
@@ -108,6 +109,23 @@ bool shape_is_fast_for_reduce(const at::Tensor& lhs, const at::Tensor& rhs) {
   return m < 512 || ((l < 256 && r < 256) || (l > 256 && r > 256));
 }
 
+// Note [Size-aware batching]
+// The checks in the fused ops (have_same_shape etc.) happen at runtime, on
+// every call. When this pass runs in the profiling executor it runs after
+// profile nodes have been removed and Value types specialized, so mm inputs
+// frequently carry concrete profiled sizes. We use those, when present, to
+// avoid emitting batched ops that would always take the runtime fallback
+// (e.g. mixture-of-experts dispatch, where a shared input feeds expert
+// weights of wildly different sizes), and to split side batches into
+// shape-homogeneous groups so each group can actually take the fast
+// cat+mm+chunk path. Unknown sizes keep the old, purely syntactic behavior.
+c10::optional<std::vector<int64_t>> profiled_sizes(Value* v) {
+  if (auto tt = v->type()->cast<TensorType>()) {
+    return tt->sizes().concrete_sizes();
+  }
+  return c10::nullopt;
+}
+
 RegisterOperators mm_tree_reduction_reg({Operator(
     "prim::MMTreeReduce(...) -> Tensor",
     [](Stack& stack) {
@@ -248,6 +266,32 @@ struct TreeToken {
   }
 };
 
+// See Note [Size-aware batching]. Returns false only when profiled sizes
+// prove that the fused op would take its runtime fallback (heterogeneous
+// leaf shapes, or a shape regime where the cat+mm is slower than the
+// individual mms), i.e. when batching can only pessimize.
+bool tree_shapes_look_batchable(const std::vector<Node*>& matmuls) {
+  auto expected_lhs = profiled_sizes(matmuls[0]->inputs().at(0));
+  auto expected_rhs = profiled_sizes(matmuls[0]->inputs().at(1));
+  if (!expected_lhs || !expected_rhs) {
+    return true;
+  }
+  for (Node* matmul : matmuls) {
+    if (profiled_sizes(matmul->inputs().at(0)) != expected_lhs ||
+        profiled_sizes(matmul->inputs().at(1)) != expected_rhs) {
+      return false;
+    }
+  }
+  if (expected_lhs->size() != 2 || expected_rhs->size() != 2) {
+    return true;
+  }
+  // Static mirror of shape_is_fast_for_reduce
+  int64_t l = (*expected_lhs)[0];
+  int64_t m = (*expected_lhs)[1];
+  int64_t r = (*expected_rhs)[1];
+  return m < 512 || ((l < 256 && r < 256) || (l > 256 && r > 256));
+}
+
 enum class Side { LHS, RHS };
 
 void BatchMMTreeReduce(Block* block, AliasDb& alias_db) {
@@ -301,6 +345,9 @@ void BatchMMTreeReduce(Block* block, AliasDb& alias_db) {
     if (!root || root.tree_size < min_fusion_size)
       continue;
     auto matmuls = root.removeTransposesAndGatherMatmuls();
+    if (!tree_shapes_look_batchable(matmuls)) {
+      continue;
+    }
     WithInsertPoint insert_guard{root.node};
     Node* tree_reduce =
         graph->insertNode(graph->create(Symbol::prim("MMTreeReduce")));
@@ -436,6 +483,37 @@ void BatchMMSide(Block* block, AliasDb& alias_db) {
     }
   };
 
+  // See Note [Size-aware batching]. Partition the candidates into
+  // shape-homogeneous groups (keyed on the profiled size of the varying
+  // operand), and batch each sufficiently large group separately; a single
+  // heterogeneous batch would always take the runtime fallback. MMs with
+  // unknown sizes form their own group and keep the old syntactic behavior.
+  const auto batch_side_homogeneous = [&](std::vector<Node*>& mms, Side side) {
+    std::vector<std::vector<Node*>> groups;
+    std::vector<c10::optional<std::vector<int64_t>>> group_keys;
+    for (Node* mm : mms) {
+      auto key = profiled_sizes(mm->inputs().at(side == Side::LHS ? 1 : 0));
+      auto it = std::find(group_keys.begin(), group_keys.end(), key);
+      if (it == group_keys.end()) {
+        group_keys.push_back(key);
+        groups.emplace_back();
+        it = group_keys.end() - 1;
+      }
+      groups[it - group_keys.begin()].push_back(mm);
+    }
+    for (const auto i : c10::irange(groups.size())) {
+      if (groups[i].size() < how_many_is_many) {
+        continue;
+      }
+      // Static mirror of shape_is_fast_for_side
+      const auto& key = group_keys[i];
+      if (key && c10::multiply_integers(*key) > 1024 * 2048) {
+        continue;
+      }
+      batch_side(groups[i], side);
+    }
+  };
+
   std::unordered_set<Value*> considered_values;
   for (Node* node : block->nodes()) {
     if (node->matches("aten::mm(Tensor self, Tensor mat2) -> Tensor") &&
@@ -446,10 +524,10 @@ void BatchMMSide(Block* block, AliasDb& alias_db) {
         }
         auto uses_with_many = gatherIndependentMMUses(input, alias_db);
         if (uses_with_many.first.size() >= how_many_is_many) {
-          batch_side(uses_with_many.first, Side::LHS);
+          batch_side_homogeneous(uses_with_many.first, Side::LHS);
         }
         if (uses_with_many.second.size() >= how_many_is_many) {
-          batch_side(uses_with_many.second, Side::RHS);
+          batch_side_homogeneous(uses_with_many.second, Side::RHS);
         }
       }
     } else {
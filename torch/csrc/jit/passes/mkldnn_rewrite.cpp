@@ -1,5 +1,8 @@
 #include <ATen/Config.h>
 #include <ATen/code_template.h>
+#if AT_MKLDNN_ENABLED()
+#include <ATen/native/mkldnn/Utils.h>
+#endif
 #include <torch/csrc/jit/ir/ir.h>
 #include <torch/csrc/jit/jit_log.h>
 #include <torch/csrc/jit/passes/constant_propagation.h>
@@ -72,6 +75,80 @@ void insertPrePackedConvOpForNode(Node* n) {
   n->output()->replaceAllUsesWith(prepack_conv->output());
 }
 
+// Prepacking requires a dtype oneDNN can pack for: fp32 everywhere, bf16
+// only on CPUs with the native bf16 instructions.
+bool supportedPrePackedDtype(Node* n, size_t input_idx, size_t weight_idx) {
+  auto input_type = n->input(input_idx)->type()->cast<TensorType>();
+  auto weight_type = n->input(weight_idx)->type()->cast<TensorType>();
+  if (!input_type || !weight_type) {
+    return false;
+  }
+  auto input_dtype = input_type->scalarType();
+  auto weight_dtype = weight_type->scalarType();
+  if (input_dtype == c10::ScalarType::Float &&
+      weight_dtype == c10::ScalarType::Float) {
+    return true;
+  }
+  return input_dtype == c10::ScalarType::BFloat16 &&
+      weight_dtype == c10::ScalarType::BFloat16 &&
+      at::mkldnn_bf16_device_check();
+}
+
+void insertPrePackedLinearOpForNode(Node* n) {
+  constexpr int POS_INPUT = 0;
+  constexpr int POS_WEIGHT = 1;
+  if (!tensorexpr::isContiguous(n->input(POS_INPUT))) {
+    GRAPH_DEBUG("insertPrePackedLinearOpForNode: input is not contiguous");
+    return;
+  }
+
+  if (!tensorexpr::isContiguous(n->input(POS_WEIGHT))) {
+    GRAPH_DEBUG("insertPrePackedLinearOpForNode: weight is not contiguous");
+    return;
+  }
+
+  if (!supportedPrePackedDtype(n, POS_INPUT, POS_WEIGHT)) {
+    GRAPH_DEBUG(
+        "insertPrePackedLinearOpForNode: only float32 and bf16 allowed");
+    return;
+  }
+
+  auto input_sizes = getSizesOf(n, POS_INPUT);
+  if (!input_sizes.concrete_sizes()) {
+    GRAPH_DEBUG("insertPrePackedLinearOpForNode: input sizes are not known");
+    return;
+  }
+
+  WithInsertPoint guard(n);
+  auto graph = n->owningGraph();
+
+  IValue input_size_value(*input_sizes.concrete_sizes());
+  auto input_size = graph->insertConstant(input_size_value);
+
+  auto prepack_node = graph->create(
+      Symbol::fromQualString("mkldnn_prepacked::linear_prepack"), 1);
+
+  // skip input value
+  for (auto i = 1; i < n->inputs().size(); i++) {
+    Value* v = n->input(i);
+    prepack_node->addInput(v);
+  }
+  prepack_node->addInput(input_size);
+  auto attr = graph->insertConstant(IValue("none"));
+  prepack_node->addInput(attr);
+  prepack_node->output()->setType(
+      getCustomClass("__torch__.torch.classes.mkldnn.LinearOpContext"));
+  graph->insertNode(prepack_node);
+
+  auto prepack_linear = graph->insertNode(
+      graph->create(Symbol::fromQualString("mkldnn_prepacked::linear_run"), 1));
+  prepack_linear->addInput(n->input(0));
+  prepack_linear->addInput(prepack_node->output());
+  prepack_linear->output()->setType(n->output()->type()->cast<TensorType>());
+
+  n->output()->replaceAllUsesWith(prepack_linear->output());
+}
+
 bool isTensorTypeCPU(Node* node) {
   for (const auto& input : node->inputs()) {
     auto type = input->type()->cast<TensorType>();
@@ -89,27 +166,27 @@ bool isTensorTypeCPU(Node* node) {
   return true;
 }
 
-void insertPrePackedConvOp(Block* b) {
+void insertPrePackedOps(Block* b) {
   for (Node* n : b->nodes()) {
     for (Block* b : n->blocks()) {
-      insertPrePackedConvOp(b);
+      insertPrePackedOps(b);
     }
 
     if (n->kind() == aten::conv2d) {
       if (isTensorTypeCPU(n)) {
         insertPrePackedConvOpForNode(n);
       }
+    } else if (n->kind() == aten::linear) {
+      if (isTensorTypeCPU(n)) {
+        insertPrePackedLinearOpForNode(n);
+      }
     }
   }
   EliminateDeadCode(b);
 }
 
-void insertMkldnnPrePackedConv2dOp(std::shared_ptr<Graph>& graph) {
-  insertPrePackedConvOp(graph->block());
-}
-
 void insertMkldnnPrePackedOps(std::shared_ptr<Graph>& graph) {
-  insertMkldnnPrePackedConv2dOp(graph);
+  insertPrePackedOps(graph->block());
 }
 
 void insertMkldnnPrePackedOps(script::Module& module) {
@@ -143,6 +220,22 @@ void FuseReluWithPackedOps(std::shared_ptr<Graph>& graph) {
         %res = mkldnn_prepacked::conv2d_run(%input, %packed_weight_bias)
         return (%res))");
 
+  auto linear_op_rstring = at::jit::CodeTemplate(R"(
+    graph(%input, %weight, %bias, %input_size:int[], %dummy_attr:str):
+        %packed_weight_bias = mkldnn_prepacked::linear_prepack(
+            %weight, %bias, %input_size, %dummy_attr)
+        %linear_res = mkldnn_prepacked::linear_run(%input, %packed_weight_bias)
+        %res = aten::${op}(%linear_res)
+        return (%res))");
+
+  auto linear_op_fused_rstring = at::jit::CodeTemplate(R"(
+    graph(%input, %weight, %bias, %input_size:int[], %dummy_attr:str):
+        %attr: str = prim::Constant[value="${op_attr}"]()
+        %packed_weight_bias : __torch__.torch.classes.mkldnn.LinearOpContext = mkldnn_prepacked::linear_prepack(
+            %weight, %bias, %input_size, %attr)
+        %res = mkldnn_prepacked::linear_run(%input, %packed_weight_bias)
+        return (%res))");
+
   for (auto const& it : mkldnn::fusion_rewrite_map) {
     std::string op = it.first;
     if (op == std::string("none")) {
@@ -158,6 +251,9 @@ void FuseReluWithPackedOps(std::shared_ptr<Graph>& graph) {
     SubgraphRewriter rewriter;
     rewriter.RegisterRewritePattern(
         conv_op_rstring.format(env), conv_op_fused_rstring.format(env_fused));
+    rewriter.RegisterRewritePattern(
+        linear_op_rstring.format(env),
+        linear_op_fused_rstring.format(env_fused));
 
     auto filters = it.second;
     rewriter.runOnGraph(graph, filters);
@@ -168,7 +264,8 @@ void PrePackingOpsFolder(Block* b) {
   auto is_foldable_op = [](const Node* n) -> bool {
     return (
         n->kind() ==
-        Symbol::fromQualString("mkldnn_prepacked::conv2d_prepack"));
+            Symbol::fromQualString("mkldnn_prepacked::conv2d_prepack") ||
+        n->kind() == Symbol::fromQualString("mkldnn_prepacked::linear_prepack"));
   };
 
   std::unordered_set<Node*> nodes_to_delete;
@@ -11,40 +11,66 @@ namespace onnx {
 using namespace ::c10::onnx;
 }
 
+// FNV-1a over raw bytes; used to bucket initializers by content so that the
+// exact comparators below only run within a bucket.
+static size_t hashBytes(const void* data, size_t size, uint64_t seed) {
+  uint64_t h = seed ^ 14695981039346656037ULL;
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  for (const auto i : c10::irange(size)) {
+    h = (h ^ bytes[i]) * 1099511628211ULL;
+  }
+  return static_cast<size_t>(h);
+}
+
+static size_t initializerDataPtrHash(const at::Tensor& t) {
+  const void* ptr = t.has_storage() ? t.data_ptr() : nullptr;
+  return std::hash<const void*>()(ptr);
+}
+
+static size_t initializerContentHash(const at::Tensor& t) {
+  uint64_t seed = static_cast<uint64_t>(t.scalar_type());
+  for (const auto d : t.sizes()) {
+    seed = seed * 1099511628211ULL + static_cast<uint64_t>(d);
+  }
+  if (!t.has_storage() || t.is_quantized()) {
+    // Let the exact comparator decide; these are rare in exported params.
+    return static_cast<size_t>(seed);
+  }
+  at::Tensor flat = t.device().is_cpu() ? t.contiguous() : t.to("cpu").contiguous();
+  return hashBytes(
+      flat.data_ptr(), flat.element_size() * flat.numel(), seed);
+}
+
 void DeduplicateInitializers(
     std::shared_ptr<Graph>& g,
     ValueToParamPairMap& valsToParamsMap,
-    bool (*comp)(at::Tensor&, at::Tensor&)) {
-  auto is_same_tensor_as = [&valsToParamsMap, comp](Value* v1) {
-    return [&valsToParamsMap, v1, comp](Value* v2) {
-      if ((valsToParamsMap.find(v1) == valsToParamsMap.end()) ||
-          (valsToParamsMap.find(v2) == valsToParamsMap.end())) {
-        return false;
-      }
-      auto iv1 = valsToParamsMap.find(v1)->second.second;
-      auto iv2 = valsToParamsMap.find(v2)->second.second;
-      if (!iv1.isTensor() || !iv2.isTensor()) {
-        return false;
-      }
-      auto t1 = iv1.toTensor();
-      auto t2 = iv2.toTensor();
-      return comp(t1, t2);
-    };
-  };
-  std::vector<Value*> uniqueVals;
+    bool (*comp)(at::Tensor&, at::Tensor&),
+    size_t (*hash_fn)(const at::Tensor&)) {
+  // Bucketing by content hash keeps this pass linear in the number of
+  // initializers: an exported ensemble with hundreds of parameters used to
+  // compare every pair with full tensor equality.
+  std::unordered_map<size_t, std::vector<Value*>> uniqueVals;
   std::vector<size_t> inputsIndicesToRemove;
   auto b = g->block();
 
   for (auto i : c10::irange(b->inputs().size())) {
     auto v = g->inputs().at(i);
-    if (valsToParamsMap.find(v) == valsToParamsMap.end()) {
+    auto entry = valsToParamsMap.find(v);
+    if (entry == valsToParamsMap.end()) {
       // Skip model inputs
       continue;
     }
-    auto it = std::find_if(
-        uniqueVals.begin(), uniqueVals.end(), is_same_tensor_as(v));
-    if (it == uniqueVals.end()) {
-      uniqueVals.emplace_back(v);
+    if (!entry->second.second.isTensor()) {
+      continue;
+    }
+    auto t = entry->second.second.toTensor();
+    auto& bucket = uniqueVals[hash_fn(t)];
+    auto it = std::find_if(bucket.begin(), bucket.end(), [&](Value* u) {
+      auto u_t = valsToParamsMap.find(u)->second.second.toTensor();
+      return comp(t, u_t);
+    });
+    if (it == bucket.end()) {
+      bucket.emplace_back(v);
     } else {
       inputsIndicesToRemove.emplace_back(i);
       auto id_node = g->create(onnx::Identity);
@@ -88,13 +114,15 @@ void DeduplicateInitializers(
   auto valsToParamsMap = buildValueToParamsMap(g->block(), paramsDict);
   // ONNX spec does not support parameters with shared memory.
   // This pass de-duplicate those parameters. Training is not affected.
-  DeduplicateInitializers(g, valsToParamsMap, DeduplicateInitializersByDataPtr);
+  DeduplicateInitializers(
+      g, valsToParamsMap, DeduplicateInitializersByDataPtr, initializerDataPtrHash);
   if (!is_train) {
     // More aggressive parameters de-duplication based on tensor values.
     // Producing more compact model for inference.
     // For training, this pass is disabled,
     // because parameters may be updated differently.
-    DeduplicateInitializers(g, valsToParamsMap, DeduplicateInitializersByValue);
+    DeduplicateInitializers(
+        g, valsToParamsMap, DeduplicateInitializersByValue, initializerContentHash);
   }
   buildParamsMapFromValueToParamsMap(valsToParamsMap, paramsDict);
 }
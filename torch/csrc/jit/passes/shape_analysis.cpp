@@ -26,6 +26,7 @@
 #include <exception>
 #include <iostream>
 #include <memory>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -99,6 +100,70 @@ void PropertyPropBase::processLoop(Node* node) {
   applyTypes(loop.bodyCarriedInputs(), loop.carriedOutputs());
 }
 
+void PropertyPropBase::propagateFrom(
+    at::ArrayRef<Value*> changed_values,
+    bool insert_expands) {
+  // Worklist of nodes whose input types may have changed, kept in
+  // topological order so that each node is visited with all of its
+  // refreshed input types in place.
+  struct IsBefore {
+    bool operator()(Node* a, Node* b) const {
+      return a->isBefore(b);
+    }
+  };
+  std::set<Node*, IsBefore> worklist;
+
+  auto enqueue_users = [&](Value* v) {
+    for (const Use& use : v->uses()) {
+      Node* user = use.user;
+      if (user == user->owningBlock()->return_node()) {
+        // The value feeds a block return; reprocess the node owning the
+        // block (if/loop) so its outputs get re-merged.
+        if (Node* owner = user->owningBlock()->owningNode()) {
+          worklist.insert(owner);
+        }
+        continue;
+      }
+      worklist.insert(user);
+    }
+  };
+
+  for (Value* v : changed_values) {
+    enqueue_users(v);
+  }
+
+  while (!worklist.empty()) {
+    Node* node = *worklist.begin();
+    worklist.erase(worklist.begin());
+
+    std::vector<TypePtr> prev_types;
+    prev_types.reserve(node->outputs().size());
+    for (Value* output : node->outputs()) {
+      prev_types.push_back(output->type());
+    }
+
+    try {
+      propagateNode(node, insert_expands);
+    } catch (propagation_error& e) {
+      setUnshapedType(node);
+    } catch (std::exception& e) {
+      throw ErrorReport(node->sourceRange())
+          << ExceptionMessage(e)
+          << "\nThe above operation failed shape propagation in this context";
+    }
+
+    // Only push the frontier past outputs whose type actually changed;
+    // this is what keeps incremental propagation proportional to the
+    // size of the change instead of the size of the graph.
+    for (const auto i : c10::irange(node->outputs().size())) {
+      Value* output = node->outputs()[i];
+      if (*output->type() != *prev_types[i]) {
+        enqueue_users(output);
+      }
+    }
+  }
+}
+
 void PropertyPropBase::setUnshapedType(Value* o) {
   o->setType(unshapedType(o->type()));
 }
@@ -2144,6 +2209,15 @@ void PropagateInputShapes(const std::shared_ptr<Graph>& graph) {
   ShapePropagator(graph).propagateBlock(graph->block());
 }
 
+void PropagateInputShapesIncremental(
+    const std::shared_ptr<Graph>& graph,
+    at::ArrayRef<Value*> changed_values) {
+  // Building the propagator is linear in the graph (it constructs an
+  // AliasDb), but propagation itself only touches nodes downstream of
+  // the changed values, which is what dominates on large graphs.
+  ShapePropagator(graph).propagateFrom(changed_values);
+}
+
 namespace {
 
 using TypeCache = std::unordered_map<TypePtr, TypePtr>;
@@ -21,6 +21,13 @@ class PropertyPropBase {
   void propagateBlock(Block* block, bool insert_expands = true);
   // insert_expands is used for shape inference
 
+  // Incremental mode: instead of re-propagating the whole graph, visit
+  // only the nodes downstream of `changed_values` (in topological order),
+  // stopping along each path as soon as an output type is unchanged.
+  void propagateFrom(
+      at::ArrayRef<Value*> changed_values,
+      bool insert_expands = true);
+
   void processIf(Node* node);
   void processLoop(Node* node);
 
@@ -34,6 +41,16 @@ class PropertyPropBase {
 TORCH_API void EraseShapeInformation(const std::shared_ptr<Graph>& graph);
 TORCH_API void PropagateInputShapes(const std::shared_ptr<Graph>& graph);
 
+// Re-propagates shapes only downstream of `changed_values`, e.g. after an
+// optimization pass rewrote a region of a large graph. `changed_values`
+// should contain every value whose type the caller set or whose producer
+// was replaced; everything not reachable from them keeps its types. This
+// makes repeated propagation on big graphs proportional to the size of
+// the change rather than the size of the graph.
+TORCH_API void PropagateInputShapesIncremental(
+    const std::shared_ptr<Graph>& graph,
+    at::ArrayRef<Value*> changed_values);
+
 TORCH_API bool mergeTypes(
     ArrayRef<Value*> lhs,
     ArrayRef<Value*> rhs,
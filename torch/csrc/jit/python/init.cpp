@@ -18,6 +18,7 @@
 #include <torch/csrc/jit/frontend/tracer.h>
 #include <torch/csrc/jit/ir/irparser.h>
 #include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/passes/aot_autodiff.h>
 #include <torch/csrc/jit/passes/autocast.h>
 #include <torch/csrc/jit/passes/batch_mm.h>
 #include <torch/csrc/jit/passes/canonicalize.h>
@@ -382,6 +383,13 @@ void initJITBindings(PyObject* module) {
       .def(
           "_jit_pass_dbr_quant_remove_redundant_aliases",
           [](Module& module) { return DBRQuantRemoveRedundantAliases(module); })
+      .def(
+          "_jit_differentiate_method_aot",
+          [](Module& module, const std::string& method_name) {
+            DifferentiateMethodAheadOfTime(module, method_name);
+          },
+          py::arg("module"),
+          py::arg("method_name") = "forward")
       .def(
           "_freeze_module",
           [](Module& module,
@@ -974,6 +982,18 @@ void initJITBindings(PyObject* module) {
             using namespace torch::jit::tensorexpr;
             getTEMustUseLLVMOnCPU() = use_llvm;
           })
+      .def(
+          "_jit_get_te_approximate_transcendentals",
+          []() -> bool {
+            using namespace torch::jit::tensorexpr;
+            return getTEApproximateTranscendentals();
+          })
+      .def(
+          "_jit_set_te_approximate_transcendentals",
+          [](bool approximate) {
+            using namespace torch::jit::tensorexpr;
+            getTEApproximateTranscendentals() = approximate;
+          })
       .def(
           "_jit_cat_wo_conditionals",
           [](bool optimize_cat) {
@@ -1300,6 +1320,21 @@ void initJITBindings(PyObject* module) {
              size_t size) { return self.writeRecord(name, data, size); })
       .def("write_end_of_file", &PyTorchStreamWriter::writeEndOfFile)
       .def("set_min_version", &PyTorchStreamWriter::setMinVersion)
+      .def(
+          "set_record_alignment", &PyTorchStreamWriter::setRecordAlignment)
+      .def(
+          "set_checksums_enabled", &PyTorchStreamWriter::setChecksumsEnabled)
+      .def("set_delta_base", &PyTorchStreamWriter::setDeltaBase)
+      .def(
+          "enable_async_writes", &PyTorchStreamWriter::enableAsyncWrites)
+      .def(
+          "write_record_async",
+          [](PyTorchStreamWriter& self,
+             const std::string& name,
+             std::string data,
+             bool compress) {
+            return self.writeRecordAsync(name, std::move(data), compress);
+          })
       .def(
           "write_record",
           [](PyTorchStreamWriter& self,
@@ -1435,6 +1470,10 @@ void initJITBindings(PyObject* module) {
                     at::CPU(scalar_type).typeMeta());
             return at::Tensor(std::move(ptr));
           })
+      .def("set_delta_base", &PyTorchStreamReader::setDeltaBase)
+      .def("prefetch", &PyTorchStreamReader::prefetch)
+      .def("is_delta_archive", &PyTorchStreamReader::isDeltaArchive)
+      .def("get_record_checksum", &PyTorchStreamReader::getRecordChecksum)
       .def("get_all_records", [](PyTorchStreamReader& self) {
         return self.getAllRecords();
       });
@@ -1299,6 +1299,7 @@ void initJitScriptBindings(PyObject* module) {
           })
       .def("apply", &Module::apply)
       .def("__copy__", &Module::copy)
+      .def("_warm_copy", &Module::warm_copy)
       .def(
           "__hash__",
           [](const Module& self) {
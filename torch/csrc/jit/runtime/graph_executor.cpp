@@ -2,6 +2,7 @@
 
 #include <ATen/core/ivalue.h>
 #include <c10/util/Exception.h>
+#include <c10/util/LeftRight.h>
 #include <c10/util/irange.h>
 #include <torch/csrc/autograd/grad_mode.h>
 #include <torch/csrc/jit/frontend/tracer.h>
@@ -584,6 +585,21 @@ void GraphExecutorImplBase::run(Stack& stack) {
   last_executed_optimized_graph = plan.graph;
 }
 
+const ExecutionPlan& GraphExecutorImplBase::getPlanFor(
+    Stack& stack,
+    c10::optional<size_t> remaining_bailout_depth,
+    ExecutionPlanToken& token) {
+  if (C10_LIKELY(token.owner == this && token.plan != nullptr)) {
+    return *token.plan;
+  }
+  const ExecutionPlan& plan = getPlanFor(stack, remaining_bailout_depth);
+  if (isTokenizablePlan(plan)) {
+    token.owner = this;
+    token.plan = &plan;
+  }
+  return plan;
+}
+
 c10::intrusive_ptr<Future> GraphExecutorImplBase::runAsync(
     Stack& stack,
     TaskLauncher taskLauncher) {
@@ -667,6 +683,20 @@ struct GraphExecutorImpl : public GraphExecutorImplBase {
     // path ArgumentSpec even computes its hashCode here.
     ArgumentSpec spec =
         arg_spec_creator_.create(autograd::GradMode::is_enabled(), stack);
+    // Lock-free fast path: the LeftRight index mirrors plan_cache and its
+    // values point at plan_cache entries, whose addresses are stable because
+    // plans are never erased.
+    const ExecutionPlan* cached = plan_cache_index_.read(
+        [&](const std::unordered_map<ArgumentSpec, const ExecutionPlan*>&
+                index) -> const ExecutionPlan* {
+          auto it = index.find(spec);
+          return it == index.end() ? nullptr : it->second;
+        });
+    if (C10_LIKELY(cached != nullptr)) {
+      logging::getLogger()->addStatValue(
+          logging::runtime_counters::EXECUTION_PLAN_CACHE_HIT, 1.0);
+      return *cached;
+    }
     {
       std::lock_guard<std::mutex> lock(compile_mutex);
       auto it = plan_cache.find(spec);
@@ -677,6 +707,10 @@ struct GraphExecutorImpl : public GraphExecutorImplBase {
       }
       auto plan = compileSpec(spec);
       auto r = plan_cache.emplace(std::move(spec), std::move(plan));
+      plan_cache_index_.write(
+          [&](std::unordered_map<ArgumentSpec, const ExecutionPlan*>& index) {
+            index.emplace(r.first->first, &r.first->second);
+          });
       logging::getLogger()->addStatValue(
           logging::runtime_counters::EXECUTION_PLAN_CACHE_MISS, 1.0);
       return r.first->second;
@@ -787,6 +821,12 @@ struct GraphExecutorImpl : public GraphExecutorImplBase {
   // that are specialized to the spec.
   // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
   std::unordered_map<ArgumentSpec, ExecutionPlan> plan_cache;
+
+  // Wait-free read-side index over plan_cache; writers serialize on
+  // compile_mutex before publishing new entries.
+  // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+  c10::LeftRight<std::unordered_map<ArgumentSpec, const ExecutionPlan*>>
+      plan_cache_index_;
 };
 
 GraphExecutor::GraphExecutor(
@@ -838,6 +878,13 @@ const ExecutionPlan& GraphExecutor::getPlanFor(
   return pImpl->getPlanFor(inputs, remaining_bailout_depth);
 }
 
+const ExecutionPlan& GraphExecutor::getPlanFor(
+    Stack& inputs,
+    c10::optional<size_t> remaining_bailout_depth,
+    ExecutionPlanToken& token) {
+  return pImpl->getPlanFor(inputs, remaining_bailout_depth, token);
+}
+
 GraphExecutorState GraphExecutor::getDebugState() {
   return pImpl->getDebugState();
 }
@@ -34,6 +34,34 @@ struct ExecutionPlan {
   std::shared_ptr<Graph> graph;
 };
 
+// Note [Execution plan tokens]
+// getPlanFor() hashes an ArgumentSpec over the whole stack and consults the
+// executor's plan cache on every call, which shows up as overhead for
+// callers that execute the same graph with the same argument signature over
+// and over. Such callers can hold an ExecutionPlanToken across calls: once
+// filled in, the token pins the plan that was resolved on the first call,
+// and later calls skip both the spec construction and the cache lookup.
+// The caller owns the contract that the argument signature (shapes, dtypes,
+// definedness, requires_grad and GradMode state) does not change between
+// calls - reset() the token whenever it might have. Tokens hold non-owning
+// pointers: a token must not outlive its GraphExecutor, and flushing the
+// executor's compilation cache invalidates outstanding tokens. Executors
+// only fill in tokens for plans that are stable, so a token never pins
+// e.g. a still-profiling plan of the profiling executor.
+struct ExecutionPlanToken {
+  bool valid() const {
+    return plan != nullptr;
+  }
+
+  void reset() {
+    owner = nullptr;
+    plan = nullptr;
+  }
+
+  const void* owner = nullptr;
+  const ExecutionPlan* plan = nullptr;
+};
+
 // Notice that those structs don't manage lifetime of their members.
 // They are only valid only right after you call getDebugState() and should
 // never be used again once another GraphExecutor function is called.
@@ -83,6 +111,12 @@ struct TORCH_API GraphExecutor {
   const ExecutionPlan& getPlanFor(
       Stack& inputs,
       c10::optional<size_t> remaining_bailout_depth = c10::nullopt);
+  // Token-based variant for repeat callers with a fixed argument signature.
+  // See Note [Execution plan tokens]
+  const ExecutionPlan& getPlanFor(
+      Stack& inputs,
+      c10::optional<size_t> remaining_bailout_depth,
+      ExecutionPlanToken& token);
   GraphExecutorState getDebugState();
 
   void debugFlushCompilationCache();
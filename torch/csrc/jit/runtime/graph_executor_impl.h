@@ -80,6 +80,11 @@ struct GraphExecutorImplBase {
   virtual const ExecutionPlan& getPlanFor(
       Stack& stack,
       c10::optional<size_t> remaining_bailout_depth = c10::nullopt) = 0;
+  // See Note [Execution plan tokens] in graph_executor.h
+  const ExecutionPlan& getPlanFor(
+      Stack& stack,
+      c10::optional<size_t> remaining_bailout_depth,
+      ExecutionPlanToken& token);
   virtual GraphExecutorState getDebugState() = 0;
   virtual ~GraphExecutorImplBase() = default;
 
@@ -90,6 +95,13 @@ struct GraphExecutorImplBase {
  protected:
   friend struct GraphExecutor;
 
+  // Whether `plan` may be pinned by an ExecutionPlanToken, i.e. whether this
+  // executor will keep returning `plan` for an identical argument signature.
+  // See Note [Execution plan tokens] in graph_executor.h
+  virtual bool isTokenizablePlan(const ExecutionPlan& /*plan*/) const {
+    return true;
+  }
+
   // The unoptimized starting graph. This field is effectively const, but we
   // can't make it so because Graph::copy() is not const (and making it const is
   // not that easy at this point).
@@ -73,7 +73,11 @@ namespace jit {
   _(FORK, "CN") /* launch a thread to run code entry x with N inputs  */       \
   _(WARN, "I") /* emit a warning with line information */                      \
   _(ENTER, "EN") /* enter scope of a contextmanager */                         \
-  _(EXIT, "EX") /* exit the last entered contextmanager */
+  _(EXIT, "EX") /* exit the last entered contextmanager */                     \
+  /* superinstructions produced by peephole fusion at Code build time, see    \
+     Note [Interpreter superinstructions]; never emitted directly */          \
+  _(LOAD2, "RR") /* push values from registers X and N */                      \
+  _(OP_STORE, "OR") /* invoke operator X, store the result to register N */
 
 enum OpCode : uint8_t {
 #define DEFINE_OP(op, _) op,
@@ -168,6 +168,13 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
     registers.resize(registers.size() + code.pImpl->register_size_);
   }
 
+  // Reserves enough value-stack capacity for the frame's worst-case pushes
+  // (as estimated at emission time), so the hot push/pop traffic in
+  // runImpl never reallocates mid-frame.
+  static void reserveFrameStack(Stack& stack, const CodeImpl& code) {
+    stack.reserve(stack.size() + code.stack_peak_hint_);
+  }
+
   void leaveFrame() {
     registers.resize(registers.size() - frames.back().function->register_size_);
     frames.pop_back();
@@ -180,6 +187,7 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
       bool next = true) {
     bool newFrame = f.call(stack, bailOut, [&](const Code& code) {
       enterFrame(code, stack.size() - code.num_inputs());
+      reserveFrameStack(stack, *code.pImpl);
       checkAndStartRecordFunction(frames.back(), stack);
     });
     if (next) {
@@ -247,6 +255,7 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
     }
 
     TLSCurrentInterpreterGuard g(this);
+    reserveFrameStack(stack, *frames.back().function);
     if (frames.back().pc == 0 && stack_start_ == 0) {
       checkAndStartRecordFunction(frames.back(), stack);
     }
@@ -312,6 +321,24 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             stack.emplace_back(reg(inst.X));
           }
             INST_NEXT;
+          case INST(LOAD2): {
+            INST_GUARD;
+            stack.emplace_back(reg(inst.X));
+            stack.emplace_back(reg(inst.N));
+          }
+            INST_NEXT;
+          case INST(OP_STORE): {
+            INST_GUARD;
+#ifndef NDEBUG
+            size_t init_size = stack.size();
+#endif
+            frame.function->operator_table_[inst.X](stack);
+#ifndef NDEBUG
+            frame.function->assert_stack_size(inst.X, init_size, stack.size());
+#endif
+            reg(inst.N) = pop(stack);
+          }
+            INST_NEXT;
           case INST(MOVE): {
             INST_GUARD;
             stack.emplace_back(std::move(reg(inst.X)));
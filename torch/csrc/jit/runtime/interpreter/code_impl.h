@@ -1,5 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -33,6 +37,33 @@ Ttarget safe_narrow_cast(Tsource v) {
   return res;
 }
 
+// Note [Interpreter superinstructions]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Instruction traces of scripted models are dominated by short fixed
+// sequences around each operator call: pushes of the operands followed by
+// the call followed by a store of the result. Each of those instructions
+// pays a full dispatch, so after emission CodeImpl runs a peephole pass
+// that fuses the two most frequent adjacent pairs into single fused
+// opcodes:
+//
+//   LOAD r1; LOAD r2  -> LOAD2 r1, r2
+//   OP o; STORE r     -> OP_STORE o, r
+//
+// A pair is only fused when the second instruction is not a branch target
+// and its operand fits in the 16-bit N field. Fusion runs after bailout
+// blocks are inserted, so all relative jump offsets are remapped in one
+// pass. MobileCodeImpl skips the pass entirely: fused opcodes are a
+// server-interpreter detail and must never reach serialized mobile
+// bytecode. TORCH_JIT_DISABLE_SUPERINSTRUCTIONS=1 is a kill switch for
+// debugging miscompiles.
+inline bool superInstructionsEnabled() {
+  static const bool enabled = []() {
+    const char* env = std::getenv("TORCH_JIT_DISABLE_SUPERINSTRUCTIONS");
+    return env == nullptr || std::strcmp(env, "0") == 0;
+  }();
+  return enabled;
+}
+
 // BailoutBlocks are used to temporarily store
 // instructions (typically, argument LOADs and TAIL_CALL)
 // generated for prim::BailOut nodes
@@ -89,6 +120,16 @@ struct CodeImpl {
   int register_size_ = 0;
   size_t n_outputs;
   size_t n_inputs;
+
+  // Upper-bound estimate of how many values this code pushes onto the
+  // interpreter's shared value stack, tracked instruction by instruction as
+  // they are emitted. The interpreter reserves this much capacity when it
+  // enters a frame so that the per-instruction push/pop traffic never
+  // reallocates. Branchy code is counted as if all paths executed, so the
+  // estimate overshoots rather than undershoots; it is a capacity hint
+  // only, never a correctness bound.
+  size_t stack_peak_hint_ = 0;
+  int64_t emitted_stack_depth_ = 0;
   TypePtr return_type_;
   std::string function_name_;
 
@@ -174,6 +215,70 @@ struct CodeImpl {
     // we deferred the emission of bailout blocks so they appear at the end
     // emit them now and patch up the jumps
     insertBailoutBlocks();
+    // See Note [Interpreter superinstructions]
+    fuseSuperInstructions();
+  }
+
+  // Peephole-fuse adjacent instruction pairs into superinstructions.
+  // See Note [Interpreter superinstructions]
+  void fuseSuperInstructions() {
+    if (!superInstructionsEnabled()) {
+      return;
+    }
+    const size_t n = instructions_.size();
+    // A fused pair must not span a branch target: jumping into the middle
+    // of a superinstruction would skip its first half.
+    std::vector<bool> is_target(n + 1, false);
+    for (const auto pc : c10::irange(n)) {
+      const Instruction& inst = instructions_[pc];
+      if (inst.op == JF || inst.op == JMP || inst.op == LOOP) {
+        is_target[static_cast<size_t>(static_cast<int64_t>(pc) + inst.X)] =
+            true;
+      }
+    }
+    std::vector<Instruction> fused;
+    std::vector<Node*> fused_source;
+    fused.reserve(n);
+    fused_source.reserve(n);
+    // old pc -> new pc, with one extra slot for the one-past-the-end target
+    std::vector<int64_t> new_pc(n + 1, 0);
+    for (size_t pc = 0; pc < n; ++pc) {
+      new_pc[pc] = static_cast<int64_t>(fused.size());
+      const Instruction& cur = instructions_[pc];
+      if (pc + 1 < n && !is_target[pc + 1]) {
+        const Instruction& next = instructions_[pc + 1];
+        if (cur.op == LOAD && next.op == LOAD &&
+            next.X <= std::numeric_limits<uint16_t>::max()) {
+          fused.emplace_back(LOAD2, cur.X, next.X);
+          fused_source.emplace_back(instructions_source_[pc]);
+          new_pc[pc + 1] = static_cast<int64_t>(fused.size()) - 1;
+          ++pc;
+          continue;
+        }
+        if (cur.op == OP && next.op == STORE &&
+            next.X <= std::numeric_limits<uint16_t>::max()) {
+          fused.emplace_back(OP_STORE, cur.X, next.X);
+          fused_source.emplace_back(instructions_source_[pc]);
+          new_pc[pc + 1] = static_cast<int64_t>(fused.size()) - 1;
+          ++pc;
+          continue;
+        }
+      }
+      fused.emplace_back(cur);
+      fused_source.emplace_back(instructions_source_[pc]);
+    }
+    new_pc[n] = static_cast<int64_t>(fused.size());
+    // remap relative jump offsets (jumps are never fused themselves)
+    for (const auto pc : c10::irange(n)) {
+      const Instruction& inst = instructions_[pc];
+      if (inst.op == JF || inst.op == JMP || inst.op == LOOP) {
+        auto target = static_cast<size_t>(static_cast<int64_t>(pc) + inst.X);
+        fused[new_pc[pc]].X =
+            safe_narrow_cast<int32_t, int64_t>(new_pc[target] - new_pc[pc]);
+      }
+    }
+    instructions_ = std::move(fused);
+    instructions_source_ = std::move(fused_source);
   }
 
   const std::vector<c10::IValue>& constant_table() const {
@@ -212,6 +317,41 @@ struct CodeImpl {
     return instructions_source_;
   }
 
+  // Net number of values `op` leaves on the interpreter stack, used to
+  // maintain stack_peak_hint_. Stack-shuffling opcodes have fixed effects;
+  // node-level opcodes (OP, CALL, the construct/unpack family, ...) net to
+  // outputs-minus-inputs of the node being emitted, whose loads were
+  // already counted individually.
+  int64_t stackEffectOf(OpCode op, uint64_t N) const {
+    switch (op) {
+      case LOAD:
+      case MOVE:
+      case LOADC:
+        return 1;
+      case STORE:
+      case DROP:
+      case JF:
+      case TUPLE_INDEX:
+      case DICT_INDEX:
+        return -1;
+      case STOREN:
+        return -static_cast<int64_t>(N);
+      case SET_ATTR:
+        return -2;
+      case DROPR:
+      case JMP:
+      case LOOP:
+      case RET:
+      case GET_ATTR:
+      case ENTER:
+      case EXIT:
+        return 0;
+      default:
+        return static_cast<int64_t>(current_node_->outputs().size()) -
+            static_cast<int64_t>(current_node_->inputs().size());
+    }
+  }
+
   void insertInstruction(OpCode op, int64_t X = 0, uint64_t N = 0) {
     instructions_.emplace_back(
         op,
@@ -219,6 +359,11 @@ struct CodeImpl {
         safe_narrow_cast<uint16_t, uint64_t>(N));
     instructions_source_.emplace_back(current_node_);
 
+    emitted_stack_depth_ =
+        std::max<int64_t>(0, emitted_stack_depth_ + stackEffectOf(op, N));
+    stack_peak_hint_ = std::max(
+        stack_peak_hint_, static_cast<size_t>(emitted_stack_depth_));
+
     // check that we didn't accidentally emit nodes out of topological order
     if (op == OP) {
       if (last_inserted_op_ != nullptr && current_node_ != last_inserted_op_ &&
@@ -796,7 +941,7 @@ struct CodeImpl {
   void dump(std::ostream& out, size_t i) const {
     out << i << " " << instructions_[i];
     if (instructions_[i].op == OP || instructions_[i].op == CALL ||
-        instructions_[i].op == OPN) {
+        instructions_[i].op == OPN || instructions_[i].op == OP_STORE) {
       out << " # " << *instructions_source_[i];
     } else {
       out << "\n";
@@ -36,7 +36,10 @@
 #include <torch/csrc/jit/passes/tensorexpr_fuser.h>
 #include <torch/csrc/jit/passes/update_differentiable_graph_requires_grad.h>
 #include <torch/csrc/jit/passes/utils/subgraph_utils.h>
+#include <functional>
 #include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 C10_DEFINE_bool(
     torch_jit_enable_new_executor,
@@ -58,8 +61,19 @@ C10_DEFINE_bool(
     false,
     "fuse on 12 dynamic compilations");
 
+C10_DEFINE_bool(
+    torch_jit_enable_branch_pruning,
+    false,
+    "replace if-arms that were never taken during profiling with deoptimization fallbacks");
+
+C10_DEFINE_bool(
+    torch_jit_enable_sealed_execution,
+    false,
+    "after a burn-in period with a stable input signature, dispatch to a guard-free copy of the optimized plan behind a single input-fingerprint check");
+
 constexpr size_t kDefaultNumProfiledRuns = 1;
 constexpr size_t kDefaultBailoutDepth = 20;
+constexpr size_t kDefaultSealAfterRuns = 10;
 
 C10_DEFINE_int64(
     torch_jit_num_profiled_runs,
@@ -69,6 +83,10 @@ C10_DEFINE_int64(
     torch_jit_bailout_depth,
     kDefaultBailoutDepth,
     "Number of re-specializations");
+C10_DEFINE_int64(
+    torch_jit_seal_after_runs,
+    kDefaultSealAfterRuns,
+    "Number of consecutive runs with an identical input fingerprint before the optimized plan is sealed");
 
 namespace torch {
 namespace jit {
@@ -461,6 +479,174 @@ void ProfilingGraphExecutorImpl::runNoGradOptimizations(
   GRAPH_DEBUG("End of runNoGradOptimizations\n");
 }
 
+// Note [Profile-guided branch pruning]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// When FLAGS_torch_jit_enable_branch_pruning is set, the profiling runs
+// count how often each arm of a boolean prim::If was taken; the counts are
+// recorded as attributes on the If node by
+// ProfilingRecord::insertBranchProfile and travel with Graph::copy into the
+// graph being optimized. For a top-level If where one arm was never taken
+// we:
+//   1. sink the remainder of the block into both arms, so the hot arm and
+//      the code after the If form one straight-line region that autodiff
+//      and the fusers can see without a block boundary in the middle, and
+//   2. replace the body of the cold arm with a prim::FallbackGraph, which
+//      replaceFallbackGraphWithFallbackFunction later turns into a call to
+//      a separately compiled deoptimized function, exactly like the
+//      fallback paths inserted by the TensorExpr fuser.
+// The guard is the If condition itself -- re-checking an already computed
+// boolean is free, so unlike tensor bailouts no extra GUARD instructions
+// are needed -- and if the cold path is taken later it still runs
+// correctly through the fallback function.
+
+// Values defined outside of `b` that are used inside it. These become the
+// inputs of the fallback graph the cold arm is replaced with;
+// replaceBlockWithFallbackGraph maps only the inputs it is given, so the
+// list has to cover every free value of the block.
+static std::vector<Value*> liveValuesIntoBlock(Block* b) {
+  std::vector<Value*> live;
+  std::unordered_set<Value*> seen;
+  auto defined_inside = [&](Value* v) {
+    for (Block* cur = v->node()->owningBlock(); cur != nullptr;
+         cur = cur->owningNode() ? cur->owningNode()->owningBlock()
+                                 : nullptr) {
+      if (cur == b) {
+        return true;
+      }
+    }
+    return false;
+  };
+  auto record = [&](Value* v) {
+    if (!defined_inside(v) && seen.insert(v).second) {
+      live.push_back(v);
+    }
+  };
+  std::function<void(Block*)> visit = [&](Block* block) {
+    for (Node* n : block->nodes()) {
+      for (Value* v : n->inputs()) {
+        record(v);
+      }
+      for (Block* ib : n->blocks()) {
+        visit(ib);
+      }
+    }
+    for (Value* v : block->return_node()->inputs()) {
+      record(v);
+    }
+  };
+  visit(b);
+  return live;
+}
+
+// Sinks every node after `if_node` (and the enclosing block's return) into
+// both arms of `if_node`, then replaces the body of arm `cold_idx` with a
+// prim::FallbackGraph. See Note [Profile-guided branch pruning].
+static void pruneBranch(Node* if_node, size_t cold_idx) {
+  Block* owning = if_node->owningBlock();
+  Graph* graph = if_node->owningGraph();
+
+  std::vector<Node*> rest;
+  for (auto it = std::next(if_node->iterator()); it != owning->nodes().end();
+       ++it) {
+    rest.push_back(*it);
+  }
+
+  for (Block* arm : if_node->blocks()) {
+    std::unordered_map<Value*, Value*> env;
+    for (const auto i : c10::irange(if_node->outputs().size())) {
+      env[if_node->output(i)] = arm->outputs()[i];
+    }
+    auto lookup = [&](Value* v) {
+      auto it = env.find(v);
+      return it == env.end() ? v : it->second;
+    };
+    for (Node* n : rest) {
+      Node* clone = graph->createClone(n, lookup);
+      clone->insertBefore(arm->return_node());
+      for (const auto i : c10::irange(n->outputs().size())) {
+        env[n->output(i)] = clone->output(i);
+      }
+    }
+    auto mapped_returns = c10::fmap(owning->return_node()->inputs(), lookup);
+    while (!arm->outputs().empty()) {
+      arm->eraseOutput(arm->outputs().size() - 1);
+    }
+    for (Value* v : mapped_returns) {
+      arm->registerOutput(v);
+    }
+  }
+
+  // the If now computes the block's return values directly
+  size_t old_n_outputs = if_node->outputs().size();
+  Node* ret = owning->return_node();
+  for (const auto i : c10::irange(ret->inputs().size())) {
+    if_node->addOutput()->copyMetadata(ret->input(i));
+  }
+  for (const auto i : c10::irange(ret->inputs().size())) {
+    ret->replaceInput(i, if_node->output(old_n_outputs + i));
+  }
+  for (auto it = rest.rbegin(); it != rest.rend(); ++it) {
+    (*it)->destroy();
+  }
+  for (size_t i = old_n_outputs; i > 0; --i) {
+    if_node->eraseOutput(i - 1);
+  }
+
+  Block* cold = if_node->blocks()[cold_idx];
+  replaceBlockWithFallbackGraph(cold, liveValuesIntoBlock(cold));
+}
+
+// Prunes Ifs at the top level of `graph` (and, after each pruning,
+// transitively at the top level of the surviving arm, where the rest of
+// the block has been sunk). Nested Ifs are left alone: sinking the
+// remainder of a block into an If is only straightforward when the If's
+// owning block is the one being returned from.
+static bool pruneNeverTakenBranches(std::shared_ptr<Graph>& graph) {
+  static const auto true_count_attr = Symbol::attr("seen_true_count");
+  static const auto false_count_attr = Symbol::attr("seen_false_count");
+  bool changed = false;
+  Block* block = graph->block();
+  while (block != nullptr) {
+    Block* next_block = nullptr;
+    for (Node* n : block->nodes()) {
+      if (n->kind() != prim::If || !n->hasAttribute(true_count_attr) ||
+          !n->hasAttribute(false_count_attr)) {
+        continue;
+      }
+      auto true_count = n->i(true_count_attr);
+      auto false_count = n->i(false_count_attr);
+      // prune only when one arm was never taken and the other was
+      // actually observed
+      size_t cold_idx = 0;
+      if (true_count > 0 && false_count == 0) {
+        cold_idx = 1;
+      } else if (false_count > 0 && true_count == 0) {
+        cold_idx = 0;
+      } else {
+        continue;
+      }
+      GRAPH_DEBUG(
+          "Pruning ",
+          cold_idx == 0 ? "true" : "false",
+          " arm of ",
+          getHeader(n),
+          " (taken ",
+          true_count,
+          "/",
+          false_count,
+          " times)");
+      pruneBranch(n, cold_idx);
+      changed = true;
+      // the rest of the block has moved into the surviving arm; continue
+      // scanning there
+      next_block = n->blocks()[1 - cold_idx];
+      break;
+    }
+    block = next_block;
+  }
+  return changed;
+}
+
 void ProfilingGraphExecutorImpl::runProfilingOptimizations(
     std::shared_ptr<Graph>& copy,
     size_t remaining_bailout_depth) {
@@ -470,6 +656,12 @@ void ProfilingGraphExecutorImpl::runProfilingOptimizations(
     return;
   }
 
+  if (FLAGS_torch_jit_enable_branch_pruning) {
+    // See Note [Profile-guided branch pruning]
+    pruneNeverTakenBranches(copy);
+    GRAPH_DEBUG("After pruneNeverTakenBranches\n", *copy);
+  }
+
   runPreAutodiffPassPipeline(copy);
 
   if (needsGradientInProfilingMode(copy->block())) {
@@ -678,6 +870,77 @@ const ExecutionPlan& ProfilingGraphExecutorImpl::getOptimizedPlanFor(
   return *optimized_plan_;
 }
 
+// Note [Sealed execution]
+// The optimized plan still executes prim::TypeCheck / prim::RequiresGradCheck
+// guards on every call so that it can deoptimize when the inputs stop
+// matching the profiled signature. For deployments with fixed shapes these
+// guards are pure steady-state overhead. With
+// --torch_jit_enable_sealed_execution, once the same input fingerprint (a
+// CompleteArgumentSpec: dtypes, devices, sizes, strides, requires_grad and
+// GradMode) has been seen for torch_jit_seal_after_runs consecutive calls, we
+// clone the optimized plan, assume every guard passes (the guarded values are
+// forwarded and the guard booleans become constant `true`, which lets
+// constant propagation fold the deoptimization arms away), and dispatch to
+// that sealed plan behind a single fingerprint comparison at entry. Calls
+// whose fingerprint doesn't match fall back to the guarded plan, which
+// handles them correctly; the fingerprint stands in for "clean run" since
+// guard failures inside the interpreter are not observable from here.
+static void removeRuntimeChecks(Block* b) {
+  for (auto it = b->nodes().begin(); it != b->nodes().end();) {
+    Node* n = *it;
+    ++it;
+    for (Block* ib : n->blocks()) {
+      removeRuntimeChecks(ib);
+    }
+    if (n->kind() == prim::TypeCheck || n->kind() == prim::RequiresGradCheck) {
+      auto num_checked = n->inputs().size();
+      WithInsertPoint wip{n};
+      Value* true_value = n->owningGraph()->insertConstant(true);
+      for (const auto i : c10::irange(num_checked)) {
+        n->output(i)->replaceAllUsesWith(n->input(i));
+      }
+      n->output(num_checked)->replaceAllUsesWith(true_value);
+      n->destroy();
+    }
+  }
+}
+
+void ProfilingGraphExecutorImpl::sealOptimizedPlan() {
+  auto copy = optimized_plan_->graph->copy();
+  removeRuntimeChecks(copy->block());
+  // The guard booleans are now constant `true`, so this folds the
+  // deoptimization arms away entirely.
+  ConstantPropagation(copy);
+  EliminateDeadCode(copy);
+  GRAPH_DUMP("Sealed Graph: ", copy);
+  sealed_plan_ = ExecutionPlan(copy, function_name_);
+}
+
+const ExecutionPlan& ProfilingGraphExecutorImpl::getSealedPlanFor(
+    Stack& stack) {
+  // See Note [Sealed execution]
+  CompleteArgumentSpec spec(
+      autograd::GradMode::is_enabled(), last(stack, num_inputs));
+  if (sealed_plan_) {
+    if (spec == *sealed_spec_) {
+      return *sealed_plan_;
+    }
+    // Unexpected signature: the guarded plan deoptimizes correctly.
+    return *optimized_plan_;
+  }
+  if (sealed_spec_ && spec == *sealed_spec_) {
+    if (++stable_runs_ >= static_cast<size_t>(FLAGS_torch_jit_seal_after_runs)) {
+      sealOptimizedPlan();
+      return *sealed_plan_;
+    }
+  } else {
+    // the burn-in period (re)starts whenever the fingerprint changes
+    sealed_spec_ = std::move(spec);
+    stable_runs_ = 1;
+  }
+  return *optimized_plan_;
+}
+
 const ExecutionPlan& ProfilingGraphExecutorImpl::getPlanFor(
     Stack& stack,
     c10::optional<size_t> remaining_bailout_depth) {
@@ -686,6 +949,9 @@ const ExecutionPlan& ProfilingGraphExecutorImpl::getPlanFor(
   // IMPORTANT: This is a hot path of calling a torchscript function. Try not to
   // add any code above this.
   if (optimized_plan_) {
+    if (C10_UNLIKELY(FLAGS_torch_jit_enable_sealed_execution)) {
+      return getSealedPlanFor(stack);
+    }
     return *optimized_plan_;
   }
   // if depth is not set, use
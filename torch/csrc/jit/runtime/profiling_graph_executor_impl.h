@@ -7,6 +7,10 @@ C10_DECLARE_bool(torch_jit_static_then_dynamic);
 
 C10_DECLARE_bool(torch_jit_always_dynamic);
 
+C10_DECLARE_bool(torch_jit_enable_branch_pruning);
+
+C10_DECLARE_bool(torch_jit_enable_sealed_execution);
+
 namespace torch {
 namespace jit {
 
@@ -29,6 +33,9 @@ struct TORCH_API ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
     fallback_plan_.reset();
     profiling_plan_.reset();
     optimized_plan_.reset();
+    sealed_plan_.reset();
+    sealed_spec_.reset();
+    stable_runs_ = 0;
     // prevent memory leaks
     fallback_functions_.clear();
     remaining_bailout_depth_.reset();
@@ -40,10 +47,26 @@ struct TORCH_API ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
     return optimized_plan_.has_value();
   }
 
+ protected:
+  // Only the final optimized plan is stable across calls; profiling and
+  // fallback plans must keep going through getPlanFor() so that the
+  // executor can advance through its profiling stages.
+  // See Note [Execution plan tokens] in graph_executor.h
+  // With sealed execution enabled no plan may be pinned: every call has
+  // to reach the input-fingerprint check in getPlanFor so the executor
+  // can route between the sealed and the guarded plan.
+  // See Note [Sealed execution] in profiling_graph_executor_impl.cpp
+  bool isTokenizablePlan(const ExecutionPlan& plan) const override {
+    return !FLAGS_torch_jit_enable_sealed_execution &&
+        optimized_plan_.has_value() && &*optimized_plan_ == &plan;
+  }
+
  private:
   const ExecutionPlan& getOptimizedPlanFor(
       Stack& stack,
       c10::optional<size_t> remaining_bailout_depth);
+  const ExecutionPlan& getSealedPlanFor(Stack& stack);
+  void sealOptimizedPlan();
   void runProfilingInsensitiveOptimizations(std::shared_ptr<Graph>& graph);
   void runProfilingOptimizations(
       std::shared_ptr<Graph>& graph,
@@ -73,6 +96,14 @@ struct TORCH_API ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
   // of the GraphExecutor and only shared with InterpreterState
   std::vector<std::unique_ptr<Function>> fallback_functions_;
   c10::optional<size_t> remaining_bailout_depth_;
+
+  // See Note [Sealed execution]: a copy of the optimized plan with all
+  // runtime guards removed, dispatched to only when the inputs match
+  // sealed_spec_ exactly.
+  c10::optional<ExecutionPlan> sealed_plan_;
+  c10::optional<CompleteArgumentSpec> sealed_spec_;
+  // number of consecutive runs that matched sealed_spec_
+  size_t stable_runs_ = 0;
 };
 
 } // namespace jit
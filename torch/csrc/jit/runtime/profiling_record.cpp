@@ -10,6 +10,7 @@
 #include <torch/csrc/jit/runtime/autodiff.h>
 #include <torch/csrc/jit/runtime/graph_executor.h>
 #include <torch/csrc/jit/runtime/interpreter.h>
+#include <torch/csrc/jit/runtime/profiling_graph_executor_impl.h>
 namespace torch {
 namespace jit {
 
@@ -206,6 +207,38 @@ void ProfilingRecord::insertShapeProfile(
   n->replaceInput(offset, pn->output());
 }
 
+// Counts how often each arm of a boolean `prim::If` was taken during
+// profiling. The counts are stored as integer attributes directly on the
+// If node so that they survive `Graph::copy` and are visible to the
+// optimization passes running on the copied graph.
+// See Note [Profile-guided branch pruning] in
+// profiling_graph_executor_impl.cpp for how they are consumed.
+void ProfilingRecord::insertBranchProfile(Node* n) {
+  static const auto true_count_attr = Symbol::attr("seen_true_count");
+  static const auto false_count_attr = Symbol::attr("seen_false_count");
+  n->i_(true_count_attr, 0);
+  n->i_(false_count_attr, 0);
+  auto pn = createProfileIValueNode(n->input(0));
+  std::function<void(Stack&)> branch_profiler = [this, n](Stack& stack) {
+    int64_t frame_id = 0;
+    pop(stack, frame_id);
+    IValue v;
+    pop(stack, v);
+    if (v.isBool()) {
+      std::lock_guard<std::mutex> lock(this->mutex_);
+      if (profiling_count_ > 0) {
+        auto count_attr = v.toBool() ? true_count_attr : false_count_attr;
+        n->i_(count_attr, n->i(count_attr) + 1);
+      }
+    }
+    // passing the condition through
+    push(stack, v);
+  };
+  pn->setCallback(branch_profiler);
+  pn->insertBefore(n);
+  n->replaceInput(0, pn->output());
+}
+
 bool needsProfiledInputs(Node* n) {
   if (tensorexpr::isSupported(n) ||
 #ifndef C10_MOBILE
@@ -289,6 +322,11 @@ void ProfilingRecord::instrumentBlock(Block* block) {
       }
     }
 
+    if (FLAGS_torch_jit_enable_branch_pruning && n->kind() == prim::If &&
+        n->input(0)->type()->kind() == c10::TypeKind::BoolType) {
+      insertBranchProfile(n);
+    }
+
     for (auto b : n->blocks()) {
       instrumentBlock(b);
     }
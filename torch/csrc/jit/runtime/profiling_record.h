@@ -200,6 +200,7 @@ struct ProfilingRecord {
       at::ArrayRef<Value*> inputs);
   void instrumentBlock(Block* block);
   void insertShapeProfile(Node* n, size_t offset, const TypePtr& input_type);
+  void insertBranchProfile(Node* n);
   ProfilingRecord(std::shared_ptr<Graph> g);
 };
 
@@ -7,6 +7,7 @@
 #include <c10/core/InferenceMode.h>
 #include <c10/macros/Macros.h>
 #include <c10/util/MaybeOwned.h>
+#include <c10/util/hash.h>
 #include <c10/util/irange.h>
 #include <caffe2/core/scope_guard.h>
 #include <caffe2/core/timer.h>
@@ -34,8 +35,11 @@
 #include <ATen/ops/clone_native.h>
 #endif
 
+#include <atomic>
+#include <condition_variable>
 #include <iterator>
 #include <limits>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
 
@@ -870,6 +874,7 @@ BlockRunner::BlockRunner(
       // TODO(T108633124): Turn on manage output tensors for sub-blocks.
       manage_output_tensors_enabled_(
           is_root_block_ && sm.opts().manage_output_tensors),
+      launcher_(launcher),
       values_(values) {
   nodes_.reserve(block_info_.nodes().size());
   for (auto& pre_pnode : block_info_.nodes()) {
@@ -899,6 +904,165 @@ BlockRunner::BlockRunner(
     }
     pnode.set_metadata(std::move(block_runners));
   }
+
+  if (is_root_block_ && sm.opts().enable_node_parallelism) {
+    init_parallel_graph();
+  }
+}
+
+// Note [Static Runtime node parallelism]
+// With `enable_node_parallelism`, the root block is executed by a
+// dependency-graph scheduler instead of the strictly sequential loop in
+// run_impl. At load time we record, for every ProcessedNode, which other
+// nodes of the block consume its outputs. At run time each node carries an
+// outstanding-dependency counter; a node whose counter hits zero is ready,
+// and a finished node follows one ready dependent inline while handing any
+// additional ready dependents to the attached TaskLauncher (at::launch by
+// default, i.e. the inter-op thread pool). This lets independent chains -
+// e.g. the two towers of a ranking model - overlap on CPU while the final
+// join node naturally waits for all of its producers.
+//
+// Two interactions with the memory planner matter:
+// 1. Storage reuse (optimize_memory) assigns tensors whose sequential live
+//    ranges do not overlap to the same storage group. Under parallel
+//    execution those ranges can overlap in time, so blocks that run in
+//    parallel get one storage group per managed tensor. Memory still comes
+//    from the single planned arena; we only give up intra-arena reuse.
+// 2. The first iteration stays sequential: it runs the slow memory overlap
+//    checks and records the tensor sizes the planner needs, exactly as in
+//    the sequential path.
+//
+// Blocks with sub-blocks or side-effecting nodes, small blocks, and blocks
+// whose dependency graph is a single chain keep the sequential path.
+void BlockRunner::init_parallel_graph() {
+  constexpr size_t kMinNodesForParallelism = 16;
+  if (nodes_.size() < kMinNodesForParallelism) {
+    return;
+  }
+  FastMap<const Value*, uint32_t> producer;
+  for (const auto i : c10::irange(nodes_.size())) {
+    auto* node = nodes_[i].node();
+    if (!node->blocks().empty() || node->hasSideEffects()) {
+      return;
+    }
+    for (auto* output : node->outputs()) {
+      producer.emplace(output, static_cast<uint32_t>(i));
+    }
+  }
+  parallel_dep_counts_.assign(nodes_.size(), 0);
+  parallel_dependents_.assign(nodes_.size(), {});
+  parallel_roots_.clear();
+  size_t max_fanout = 0;
+  for (const auto i : c10::irange(nodes_.size())) {
+    FastSet<uint32_t> deps;
+    for (auto* input : nodes_[i].node()->inputs()) {
+      auto it = producer.find(input);
+      if (it != producer.end() && deps.insert(it->second).second) {
+        parallel_dependents_[it->second].push_back(static_cast<uint32_t>(i));
+        ++parallel_dep_counts_[i];
+      }
+    }
+    if (deps.empty()) {
+      parallel_roots_.push_back(static_cast<uint32_t>(i));
+    }
+  }
+  for (const auto& dependents : parallel_dependents_) {
+    max_fanout = std::max(max_fanout, dependents.size());
+  }
+  // A single chain (one root, no fan-out) gains nothing from the scheduler.
+  if (parallel_roots_.size() < 2 && max_fanout < 2) {
+    parallel_roots_.clear();
+    parallel_dep_counts_.clear();
+    parallel_dependents_.clear();
+    return;
+  }
+  parallel_pending_ =
+      std::make_unique<std::atomic<uint32_t>[]>(nodes_.size());
+  parallel_exec_enabled_ = true;
+}
+
+void BlockRunner::run_parallel_nodes() {
+  struct ExecState {
+    std::atomic<uint32_t> remaining;
+    std::atomic<bool> failed{false};
+    std::mutex mutex;
+    std::condition_variable done_cv;
+    // Guarded by `mutex`. The last finishing task sets `done` and notifies
+    // while holding the lock, so `state` cannot be destroyed while a task
+    // still touches it.
+    bool done{false};
+    std::exception_ptr error;
+  };
+  ExecState state;
+  state.remaining.store(
+      static_cast<uint32_t>(nodes_.size()), std::memory_order_relaxed);
+  for (const auto i : c10::irange(nodes_.size())) {
+    parallel_pending_[i].store(
+        parallel_dep_counts_[i], std::memory_order_relaxed);
+  }
+
+  // Runs `idx`, then follows one newly ready dependent inline and hands any
+  // additional ready dependents to the launcher. `run_chain` outlives all
+  // tasks because we block on `remaining` below, so capturing it by
+  // reference is safe.
+  std::function<void(uint32_t)> run_chain = [&](uint32_t idx) {
+    while (true) {
+      auto& pnode = nodes_[idx];
+      if (C10_LIKELY(!state.failed.load(std::memory_order_relaxed))) {
+        try {
+          pnode.run();
+          verify_and_correct_memory_overlap(pnode);
+        } catch (...) {
+          state.failed.store(true, std::memory_order_relaxed);
+          std::lock_guard<std::mutex> lock(state.mutex);
+          if (!state.error) {
+            state.error = std::current_exception();
+          }
+        }
+      }
+      c10::optional<uint32_t> next;
+      for (const auto dependent : parallel_dependents_[idx]) {
+        if (parallel_pending_[dependent].fetch_sub(
+                1, std::memory_order_acq_rel) == 1) {
+          if (!next) {
+            next = dependent;
+          } else {
+            const auto task_idx = dependent;
+            (*launcher_)([&run_chain, task_idx] {
+              // Thread pool threads don't inherit the caller's TLS; redo
+              // the InferenceMode entered in run_impl.
+              c10::InferenceMode mode;
+              run_chain(task_idx);
+            });
+          }
+        }
+      }
+      if (state.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.done = true;
+        state.done_cv.notify_all();
+      }
+      if (!next) {
+        return;
+      }
+      idx = *next;
+    }
+  };
+
+  for (size_t i = 1; i < parallel_roots_.size(); ++i) {
+    const auto root_idx = parallel_roots_[i];
+    (*launcher_)([&run_chain, root_idx] {
+      c10::InferenceMode mode;
+      run_chain(root_idx);
+    });
+  }
+  run_chain(parallel_roots_[0]);
+
+  std::unique_lock<std::mutex> lock(state.mutex);
+  state.done_cv.wait(lock, [&state] { return state.done; });
+  if (state.error) {
+    std::rethrow_exception(state.error);
+  }
 }
 
 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
@@ -996,7 +1160,53 @@ void BlockRunner::create_memory_planner() {
         block_info_,
         static_module_.opts().enable_out_variant,
         manage_output_tensors_enabled_,
-        static_module_.opts().optimize_memory);
+        // Storage reuse assumes sequential live ranges.
+        // See Note [Static Runtime node parallelism]
+        static_module_.opts().optimize_memory && !parallel_exec_enabled_);
+    // Seed the new planner with sizes another runtime instance already
+    // learned for this input shape signature, if any.
+    // See Note [Memory plan cache] in memory_planner.h.
+    if (plan_cache_key_ != 0) {
+      if (auto plan = MemoryPlanCache::get().find(plan_cache_key_)) {
+        planner_->adoptPlan(*plan);
+      }
+    }
+  }
+}
+
+size_t BlockRunner::compute_plan_cache_key() const {
+  // The BlockInfo is owned by our StaticModule, so its address identifies
+  // both the module and the block; plans never transfer between different
+  // StaticModules even if they share a graph.
+  size_t key = std::hash<const BlockInfo*>()(&block_info_);
+  for (const auto i : c10::irange(block_info_.num_inputs())) {
+    const IValue& input = values_[i + inputs_begin_];
+    if (!input.isTensor()) {
+      key = c10::hash_combine(key, input.isNone() ? 1 : 2);
+      continue;
+    }
+    const auto& tensor = input.toTensor();
+    key = c10::hash_combine(key, static_cast<size_t>(tensor.scalar_type()));
+    for (const auto size : tensor.sizes()) {
+      key = c10::hash_combine(key, static_cast<size_t>(size));
+    }
+    key = c10::hash_combine(key, static_cast<size_t>(tensor.dim()));
+  }
+  // 0 is reserved for "no key computed".
+  return key == 0 ? 1 : key;
+}
+
+void BlockRunner::publish_memory_plan() {
+  if (plan_cache_key_ == 0 || !planner_) {
+    return;
+  }
+  const auto managed_bytes = planner_->total_managed();
+  if (managed_bytes == published_plan_bytes_) {
+    return;
+  }
+  if (auto snapshot = planner_->makePlanSnapshot()) {
+    MemoryPlanCache::get().update(plan_cache_key_, std::move(*snapshot));
+    published_plan_bytes_ = managed_bytes;
   }
 }
 
@@ -1194,6 +1404,9 @@ void BlockRunner::Deallocator::cleanupImpl() {
 
   if (C10_LIKELY(block_runner_.planner_)) {
     block_runner_.planner_->deallocate();
+    // Sizes are final for this iteration once deallocate() has folded the
+    // observed tensor sizes into the storage groups.
+    block_runner_.publish_memory_plan();
   } else {
     // This is the first run, and it didn't finish, so we can't use a
     // `MemoryPlanner` to deallocate stuff. Just reset everything mannually.
@@ -1226,11 +1439,22 @@ c10::IValue BlockRunner::run_impl(
 
     set_inputs(std::forward<IValueList>(args), kwargs);
 
-    for (auto& n : nodes_) {
-      // LOG(INFO) << "Running node: " << PrintNode(n.node());
-      n.run();
-      // Check for incorrect schema alias info.
-      verify_and_correct_memory_overlap(n);
+    // See Note [Memory plan cache] in memory_planner.h.
+    if (static_module_.opts().enable_out_variant) {
+      plan_cache_key_ = compute_plan_cache_key();
+    }
+
+    if (C10_UNLIKELY(parallel_exec_enabled_ && planner_)) {
+      // See Note [Static Runtime node parallelism]. The first iteration
+      // (before the planner exists) always takes the sequential path.
+      run_parallel_nodes();
+    } else {
+      for (auto& n : nodes_) {
+        // LOG(INFO) << "Running node: " << PrintNode(n.node());
+        n.run();
+        // Check for incorrect schema alias info.
+        verify_and_correct_memory_overlap(n);
+      }
     }
     on_exit.setFinished();
   }
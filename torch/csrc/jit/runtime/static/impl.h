@@ -14,6 +14,7 @@
 #include <torch/csrc/jit/passes/inliner.h>
 #include <torch/csrc/jit/runtime/static/ProcessedNodeInputs.h>
 #include <torch/custom_class.h>
+#include <atomic>
 #include <limits>
 
 #ifdef FBCODE_CAFFE2
@@ -186,6 +187,13 @@ struct TORCH_API StaticModuleOptions {
   bool use_maybe_copy_variants{true};
   // enable TensorExpr fusion of ops at model loading time
   bool enable_tensorexpr_fusion{false};
+  // Run independent ProcessedNode chains on the inter-op thread pool
+  // instead of executing the block strictly sequentially. Small or purely
+  // sequential graphs keep the sequential path. Because parallel execution
+  // changes tensor lifetimes, storage reuse (optimize_memory) is disabled
+  // for blocks that run in parallel.
+  // See Note [Static Runtime node parallelism]
+  bool enable_node_parallelism{false};
 };
 
 /*
@@ -745,6 +753,26 @@ class TORCH_API BlockRunner {
 
   void create_memory_planner();
 
+  // Builds the dependency graph used to run independent node chains in
+  // parallel; leaves parallel execution disabled if the block is too small
+  // or has no exploitable branching.
+  // See Note [Static Runtime node parallelism]
+  void init_parallel_graph();
+
+  // Runs all nodes of this block, scheduling ready chains onto the
+  // attached task launcher. Requires init_parallel_graph() to have enabled
+  // parallel execution and the memory planner to exist.
+  void run_parallel_nodes();
+
+  // Hash of this runner's identity and the current input shapes; keys the
+  // process-wide MemoryPlanCache. See Note [Memory plan cache] in
+  // memory_planner.h.
+  size_t compute_plan_cache_key() const;
+
+  // Share the planner's storage group sizes with other runtime instances if
+  // they changed since the last publication.
+  void publish_memory_plan();
+
   float benchmark_model(
       const std::vector<std::vector<c10::IValue>>& args_list,
       const std::vector<KeywordArgs>& kwargs_list,
@@ -766,6 +794,21 @@ class TORCH_API BlockRunner {
 
   bool manage_output_tensors_enabled_ = false;
   std::unique_ptr<MemoryPlanner> planner_;
+  // Dependency graph for parallel execution; empty when this block runs
+  // sequentially. See Note [Static Runtime node parallelism]
+  torch::jit::TaskLauncher* launcher_;
+  bool parallel_exec_enabled_ = false;
+  std::vector<uint32_t> parallel_roots_;
+  std::vector<uint32_t> parallel_dep_counts_;
+  std::vector<std::vector<uint32_t>> parallel_dependents_;
+  // Per-iteration scratch space: outstanding dependency counts.
+  std::unique_ptr<std::atomic<uint32_t>[]> parallel_pending_;
+  // Plan cache key of the current iteration's inputs; 0 means "not
+  // computed". See Note [Memory plan cache] in memory_planner.h.
+  size_t plan_cache_key_ = 0;
+  // Sum of managed bytes at the last plan cache publication; lets us skip
+  // re-publishing when the plan did not grow.
+  size_t published_plan_bytes_ = 0;
   // [Shared values array]
   // ProcessedNodes reference their inputs and outputs with
   // offsets into this array, which saves memory.
@@ -859,6 +902,9 @@ class TORCH_API StaticNodeInfo {
   - prim::If/prim::Loop ops contains block_runners_ as their metadata
   - prim::fork op contains TaskLauncher (std::function) responsible for
     execution of forked subgraph
+  - list-returning view ops (aten::split and friends) keep their previous
+    output list here so its elements can be recycled across iterations;
+    see Note [Recycled list outputs] in native_ops.cpp
 */
 class TORCH_API ProcessedNodeMetadata {
  public:
@@ -891,9 +937,15 @@ class TORCH_API ProcessedNodeMetadata {
     return launcher_;
   }
 
+  c10::IValue& recycled_list_output() {
+    return recycled_list_output_;
+  }
+
  private:
   std::vector<BlockRunner> block_runners_;
   torch::jit::TaskLauncher* launcher_;
+  // See Note [Recycled list outputs] in native_ops.cpp
+  c10::IValue recycled_list_output_;
 };
 
 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
@@ -1021,6 +1073,16 @@ class TORCH_API ProcessedNode {
     metadata_->set_launcher(launcher);
   }
 
+  // Scratch slot that list-returning view ops use to keep their output
+  // list alive across iterations so its elements can be recycled.
+  // See Note [Recycled list outputs] in native_ops.cpp
+  c10::IValue& recycled_list_output() {
+    if (metadata_ == nullptr) {
+      metadata_ = std::make_unique<ProcessedNodeMetadata>();
+    }
+    return metadata_->recycled_list_output();
+  }
+
  private:
   C10_NODISCARD bool verify_outputs_dont_overlap_each_other() const;
 
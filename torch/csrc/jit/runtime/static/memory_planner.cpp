@@ -134,6 +134,24 @@ std::vector<StorageGroup> assignStorageToManagedTensors(
   return managed_tensor_groups;
 }
 
+MemoryPlanCache& MemoryPlanCache::get() {
+  static MemoryPlanCache cache;
+  return cache;
+}
+
+std::shared_ptr<const MemoryPlanSnapshot> MemoryPlanCache::find(
+    size_t key) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = plans_.find(key);
+  return it == plans_.end() ? nullptr : it->second;
+}
+
+void MemoryPlanCache::update(size_t key, MemoryPlanSnapshot snapshot) {
+  auto plan = std::make_shared<const MemoryPlanSnapshot>(std::move(snapshot));
+  std::lock_guard<std::mutex> lock(mutex_);
+  plans_[key] = std::move(plan);
+}
+
 namespace {
 
 bool setIncludes(const FastSet<const Value*>& set, const Value* v) {
@@ -359,6 +377,31 @@ StandardMemoryPlanner::StandardMemoryPlanner(
   }
 }
 
+bool StandardMemoryPlanner::adoptPlan(const MemoryPlanSnapshot& plan) {
+  if (plan.group_sizes.size() != managed_tensors_.size()) {
+    return false;
+  }
+  for (const auto i : c10::irange(managed_tensors_.size())) {
+    auto& group = managed_tensors_[i];
+    group.setMaxTensorSize(
+        std::max(group.maxTensorSize(), plan.group_sizes[i]));
+  }
+  return true;
+}
+
+c10::optional<MemoryPlanSnapshot> StandardMemoryPlanner::makePlanSnapshot()
+    const {
+  if (managed_tensors_.empty()) {
+    return c10::nullopt;
+  }
+  MemoryPlanSnapshot snapshot;
+  snapshot.group_sizes.reserve(managed_tensors_.size());
+  for (const auto& group : managed_tensors_) {
+    snapshot.group_sizes.push_back(group.maxTensorSize());
+  }
+  return snapshot;
+}
+
 void StandardMemoryPlanner::allocateManagedTensors() {
   if (managed_bytes_ == 0) {
     return;
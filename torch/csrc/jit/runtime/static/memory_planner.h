@@ -2,6 +2,10 @@
 
 #include <torch/csrc/jit/runtime/static/impl.h>
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace torch {
 namespace jit {
 
@@ -44,6 +48,34 @@ TORCH_API std::vector<StorageGroup> assignStorageToManagedTensors(
     const ManagedTensorRanges& ranges,
     const FastMap<const Value*, at::Tensor*>& tensor_value_to_tensor);
 
+// Note [Memory plan cache]
+// The sizes that drive a memory plan are discovered dynamically: the first
+// iteration runs with the default allocator and records per-storage-group
+// maxima, and the arena only reaches steady state once every recurring input
+// shape signature has been seen. Each StaticRuntime instance of the same
+// StaticModule would otherwise re-learn the same sizes from scratch.
+// MemoryPlanCache is a process-wide map from (block runner identity, input
+// shape signature) to the storage group sizes recorded by whichever runner
+// last grew the plan for that signature, so a fresh planner can start from
+// the steady-state arena instead of growing into it. Adopted sizes are only
+// size hints - a stale snapshot can at worst over-allocate, and adoptPlan()
+// rejects snapshots whose group count does not match.
+struct MemoryPlanSnapshot {
+  std::vector<size_t> group_sizes;
+};
+
+class TORCH_API MemoryPlanCache {
+ public:
+  static MemoryPlanCache& get();
+
+  std::shared_ptr<const MemoryPlanSnapshot> find(size_t key) const;
+  void update(size_t key, MemoryPlanSnapshot snapshot);
+
+ private:
+  mutable std::mutex mutex_;
+  FastMap<size_t, std::shared_ptr<const MemoryPlanSnapshot>> plans_;
+};
+
 // There are three types of ops in a processed graph in Static Runtime:
 //   1. op with _out variant
 //   2. view-producing op
@@ -109,6 +141,19 @@ class MemoryPlanner {
   void deallocate();
   void deallocateOutputTensors();
 
+  // Seed storage group sizes from a plan recorded by another planner for the
+  // same block and input shape signature. Returns false if the snapshot is
+  // incompatible with this planner. See Note [Memory plan cache].
+  virtual bool adoptPlan(const MemoryPlanSnapshot& /*plan*/) {
+    return false;
+  }
+
+  // Record the current storage group sizes for the plan cache; nullopt if
+  // this planner has nothing worth sharing.
+  virtual c10::optional<MemoryPlanSnapshot> makePlanSnapshot() const {
+    return c10::nullopt;
+  }
+
   size_t total_num_managed_tensors() const {
     return num_managed_tensors_;
   }
@@ -241,6 +286,9 @@ class StandardMemoryPlanner : public MemoryPlanner {
       bool manage_output_tensors,
       bool optimize_memory);
 
+  bool adoptPlan(const MemoryPlanSnapshot& plan) override;
+  c10::optional<MemoryPlanSnapshot> makePlanSnapshot() const override;
+
  protected:
   void allocateManagedTensors() override;
   void deallocateManagedTensors() override;
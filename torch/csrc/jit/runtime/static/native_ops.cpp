@@ -4,6 +4,7 @@
 
 #include <ATen/CPUFunctions.h>
 #include <ATen/NativeFunctions.h>
+#include <ATen/core/DimVector.h>
 #include <ATen/ScalarOps.h>
 #include <ATen/TensorUtils.h>
 #include <ATen/native/IndexingUtils.h>
@@ -713,6 +714,137 @@ REGISTER_NATIVE_OPERATOR_FUNCTOR(
       };
     });
 
+namespace {
+
+// Note [Recycled list outputs]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// split/chunk/unbind return a list of views of their input, so every call
+// would normally allocate a fresh ListImpl plus one TensorImpl per element.
+// Since the memory planner resets unmanaged output IValues between
+// iterations, the list produced by the previous iteration is usually
+// exclusively owned by this node's metadata slot (see
+// ProcessedNodeMetadata::recycled_list_output) by the time the node runs
+// again. In that case we re-point the existing TensorImpls at the current
+// input's storage instead of allocating new ones. Every reuse is gated on
+// refcounts: if the list or any element escaped the last iteration (e.g.
+// the list is a graph output the client kept alive), we fall back to the
+// allocating path. Recycled elements keep a reference to the previous
+// input's storage until they are re-pointed, which is at most one
+// iteration of extra lifetime for a buffer the planner reuses anyway.
+
+// Describes element `i` of the output list as a view of the node's input.
+struct ListViewSpec {
+  int64_t storage_offset;
+  at::DimVector sizes;
+  at::DimVector strides;
+};
+
+// `fallback` computes the output list from scratch; `view_spec` is invoked
+// exactly once per element, in order, on the recycling path. Pass
+// num_elems < 0 to force the fallback (e.g. for edge cases the view-spec
+// arithmetic does not cover).
+template <typename FallbackFn, typename ViewSpecFn>
+void assignViewListOutput(
+    ProcessedNode* p_node,
+    const at::Tensor& self,
+    int64_t num_elems,
+    const FallbackFn& fallback,
+    const ViewSpecFn& view_spec) {
+  IValue& cached = p_node->recycled_list_output();
+  bool reuse = num_elems >= 0 && !self.is_conj() && !self.is_neg() &&
+      cached.isTensorList() && cached.use_count() == 1 &&
+      cached.toListRef().size() == static_cast<size_t>(num_elems);
+  if (reuse) {
+    auto list = cached.toTensorList();
+    for (const auto i : c10::irange(num_elems)) {
+      const at::Tensor elem = list.get(i);
+      // the list and our local handle are the only owners iff the
+      // refcount is exactly 2
+      if (!elem.defined() || elem.use_count() != 2 ||
+          elem.dtype() != self.dtype() || elem.device() != self.device()) {
+        reuse = false;
+        break;
+      }
+      const auto spec = view_spec(i);
+      auto* impl = elem.unsafeGetTensorImpl();
+      impl->set_storage_keep_dtype(self.storage());
+      impl->set_sizes_and_strides(
+          spec.sizes, spec.strides, spec.storage_offset);
+    }
+  }
+  if (!reuse) {
+    cached = fallback();
+  }
+  p_node->Output(0) = cached;
+}
+
+// Shared by aten::split (fixed split size) and aten::chunk.
+void assignEquallySplitOutput(
+    ProcessedNode* p_node,
+    const at::Tensor& self,
+    int64_t split_size,
+    int64_t dim_unwrapped,
+    const std::function<std::vector<at::Tensor>()>& fallback) {
+  const auto dim = self.dim() > 0
+      ? c10::maybe_wrap_dim(dim_unwrapped, self.dim())
+      : dim_unwrapped;
+  const int64_t dim_size = self.dim() > 0 ? self.sizes()[dim] : 0;
+  const int64_t num_elems = (self.dim() > 0 && split_size > 0 && dim_size > 0)
+      ? (dim_size + split_size - 1) / split_size
+      : -1;
+  assignViewListOutput(
+      p_node, self, num_elems, fallback, [&](int64_t i) {
+        const int64_t start = i * split_size;
+        ListViewSpec spec;
+        spec.storage_offset =
+            self.storage_offset() + start * self.strides()[dim];
+        spec.sizes = at::DimVector(self.sizes());
+        spec.sizes[dim] = std::min(split_size, dim_size - start);
+        spec.strides = at::DimVector(self.strides());
+        return spec;
+      });
+}
+
+void assignSplitWithSizesOutput(
+    ProcessedNode* p_node,
+    const at::Tensor& self,
+    const c10::List<int64_t>& split_sizes,
+    int64_t dim_unwrapped) {
+  const auto dim = self.dim() > 0
+      ? c10::maybe_wrap_dim(dim_unwrapped, self.dim())
+      : dim_unwrapped;
+  // the recycling path does not re-validate the split sizes, so force the
+  // fallback (which raises the proper error) unless they are consistent
+  int64_t sizes_sum = 0;
+  bool sizes_valid = self.dim() > 0;
+  for (const auto i : c10::irange(split_sizes.size())) {
+    const auto size = split_sizes[i];
+    sizes_valid = sizes_valid && size >= 0;
+    sizes_sum += size;
+  }
+  sizes_valid = sizes_valid && sizes_sum == self.sizes()[dim];
+  const int64_t num_elems =
+      sizes_valid ? static_cast<int64_t>(split_sizes.size()) : -1;
+  int64_t running_start = 0;
+  assignViewListOutput(
+      p_node,
+      self,
+      num_elems,
+      [&]() { return at::native::split_with_sizes(self, split_sizes.vec(), dim); },
+      [&](int64_t i) {
+        ListViewSpec spec;
+        spec.storage_offset =
+            self.storage_offset() + running_start * self.strides()[dim];
+        spec.sizes = at::DimVector(self.sizes());
+        spec.sizes[dim] = split_sizes[i];
+        spec.strides = at::DimVector(self.strides());
+        running_start += split_sizes[i];
+        return spec;
+      });
+}
+
+} // namespace
+
 REGISTER_NATIVE_OPERATOR_FUNCTOR(aten::split, aten_split, [](Node* n) -> SROperator {
   if (n->matches(torch::schema(
           "aten::split(Tensor(a -> *) self, int split_size, int dim=0) -> Tensor(a)[]"))) {
@@ -720,7 +852,9 @@ REGISTER_NATIVE_OPERATOR_FUNCTOR(aten::split, aten_split, [](Node* n) -> SROpera
       const auto& self = p_node->Input(0).toTensor();
       const auto split_size = p_node->Input(1).toInt();
       const auto dim = p_node->Input(2).toInt();
-      p_node->Output(0) = at::native::split(self, split_size, dim);
+      assignEquallySplitOutput(p_node, self, split_size, dim, [&]() {
+        return at::native::split(self, split_size, dim);
+      });
     };
   }
 
@@ -730,8 +864,7 @@ REGISTER_NATIVE_OPERATOR_FUNCTOR(aten::split, aten_split, [](Node* n) -> SROpera
       const auto& self = p_node->Input(0).toTensor();
       const auto& split_sizes = p_node->Input(1).toIntList();
       const auto dim = p_node->Input(2).toInt();
-      p_node->Output(0) =
-          at::native::split_with_sizes(self, split_sizes.vec(), dim);
+      assignSplitWithSizesOutput(p_node, self, split_sizes, dim);
     };
   }
 
@@ -754,8 +887,65 @@ REGISTER_NATIVE_OPERATOR_FUNCTOR(
         const auto& self = p_node->Input(0).toTensor();
         const auto& split_sizes = p_node->Input(1).toIntList();
         const auto dim = p_node->Input(2).toInt();
-        p_node->Output(0) =
-            at::native::split_with_sizes(self, split_sizes.vec(), dim);
+        assignSplitWithSizesOutput(p_node, self, split_sizes, dim);
+      };
+    });
+
+REGISTER_NATIVE_OPERATOR_FUNCTOR(
+    aten::chunk,
+    aten_chunk,
+    [](Node* n) -> SROperator {
+      if (!n->matches(torch::schema(
+              "aten::chunk(Tensor(a -> *) self, int chunks, int dim=0) -> Tensor(a)[]"))) {
+        LogAndDumpSchema(n);
+        return nullptr;
+      }
+      return [](ProcessedNode* p_node) {
+        const auto& self = p_node->Input(0).toTensor();
+        const auto chunks = p_node->Input(1).toInt();
+        const auto dim = p_node->Input(2).toInt();
+        const int64_t dim_size = self.dim() > 0
+            ? self.sizes()[c10::maybe_wrap_dim(dim, self.dim())]
+            : 0;
+        const int64_t split_size =
+            chunks > 0 ? (dim_size + chunks - 1) / chunks : 0;
+        assignEquallySplitOutput(p_node, self, split_size, dim, [&]() {
+          return at::native::chunk(self, chunks, dim);
+        });
+      };
+    });
+
+REGISTER_NATIVE_OPERATOR_FUNCTOR(
+    aten::unbind,
+    aten_unbind,
+    [](Node* n) -> SROperator {
+      if (!n->matches(torch::schema(
+              "aten::unbind.int(Tensor(a -> *) self, int dim=0) -> Tensor(a)[]"))) {
+        LogAndDumpSchema(n);
+        return nullptr;
+      }
+      return [](ProcessedNode* p_node) {
+        const auto& self = p_node->Input(0).toTensor();
+        const auto dim_unwrapped = p_node->Input(1).toInt();
+        const auto dim = self.dim() > 0
+            ? c10::maybe_wrap_dim(dim_unwrapped, self.dim())
+            : dim_unwrapped;
+        const int64_t num_elems = self.dim() > 0 ? self.sizes()[dim] : -1;
+        assignViewListOutput(
+            p_node,
+            self,
+            num_elems,
+            [&]() { return at::native::unbind(self, dim); },
+            [&](int64_t i) {
+              ListViewSpec spec;
+              spec.storage_offset =
+                  self.storage_offset() + i * self.strides()[dim];
+              spec.sizes = at::DimVector(self.sizes());
+              spec.sizes.erase(spec.sizes.begin() + dim);
+              spec.strides = at::DimVector(self.strides());
+              spec.strides.erase(spec.strides.begin() + dim);
+              return spec;
+            });
       };
     });
 
@@ -544,11 +544,24 @@ void ScriptModuleSerializer::writeArchive(
       writer_.writeRecord(tensor_dir + tensor_name, nullptr, 0);
       continue;
     }
-    WriteableTensorData writable_td = getWriteableTensorData(td);
     if (use_storage_context && serialized_tensors.count(tensor_name)) {
       // storage has been serialzed already, skip
       continue;
     }
+    if (td.storage().device_type() != DeviceType::CPU) {
+      // Stream device storages to the archive in chunks instead of
+      // materializing a whole-storage host copy first.
+      // See Note [Streaming tensor serialization] in pickler.cpp
+      StreamingTensorData streaming_td(td);
+      writer_.writeRecord(
+          tensor_dir + tensor_name,
+          [&streaming_td](uint64_t pos, void* buf, size_t n) {
+            return streaming_td.read(pos, buf, n);
+          },
+          streaming_td.sizeInBytes());
+      continue;
+    }
+    WriteableTensorData writable_td = getWriteableTensorData(td);
     writer_.writeRecord(
         tensor_dir + tensor_name,
         writable_td.data(),
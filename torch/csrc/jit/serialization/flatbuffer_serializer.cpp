@@ -84,6 +84,11 @@ class FlatbufferSerializer {
       const ExtraFilesMap& jit_sources = ExtraFilesMap(),
       const std::vector<IValue>& jit_constants = {});
 
+  // Serializes a bare IValue (e.g. an eager state dict) into the same
+  // Module table: no methods, the value itself as state_obj. See
+  // save_ivalue_to_bytes.
+  flatbuffers::DetachedBuffer serializeIValue(const c10::IValue& ivalue);
+
  private:
   template <typename It>
   std::vector<uint32_t> storeIValuesAndGetIndexes(
@@ -434,6 +439,63 @@ flatbuffers::DetachedBuffer FlatbufferSerializer::serializeModule(
   return fbb.Release();
 }
 
+flatbuffers::DetachedBuffer FlatbufferSerializer::serializeIValue(
+    const c10::IValue& ivalue) {
+  FlatBufferBuilder fbb;
+
+  // first element is None.
+  insertIValue(CreateIValue(fbb, mobile::serialization::IValueUnion::NONE, 0));
+
+  uint32_t ivalue_index = storeIValueAndGetIndex(fbb, ivalue);
+
+  std::vector<uint32_t> empty_indexes;
+  auto functions_offset = fbb.CreateVector(empty_indexes);
+  auto extra_files_offset = storeExtraFilesAndGetOffset(fbb, ExtraFilesMap());
+  auto jit_source_offset = storeExtraFilesAndGetOffset(fbb, ExtraFilesMap());
+
+  // NOTE: saving of storage has to be the last thing to do.
+  std::vector<flatbuffers::Offset<mobile::serialization::StorageData>>
+      storage_data;
+  storage_data.reserve(tensor_data_.size());
+  for (auto td : tensor_data_) {
+    if (td.storage().device_type() != DeviceType::CPU) {
+      td = at::empty({0}, td.options())
+               .set_(
+                   td.storage(),
+                   /* storage_offset = */ 0,
+                   /* size = */
+                   {static_cast<int64_t>(
+                       td.storage().nbytes() / td.element_size())},
+                   /* stride = */ {1})
+               .cpu();
+    }
+    fbb.ForceVectorAlignment(
+        td.storage().nbytes(), sizeof(uint8_t), FLATBUFFERS_MAX_ALIGNMENT);
+    storage_data.push_back(mobile::serialization::CreateStorageData(
+        fbb,
+        fbb.CreateVector(
+            reinterpret_cast<const uint8_t*>(td.storage().data()),
+            td.storage().nbytes())));
+  }
+
+  auto mod = CreateModule(
+      fbb,
+      /*bytecode_version=*/kMinVersion,
+      extra_files_offset,
+      functions_offset,
+      /*state_obj=*/ivalue_index,
+      fbb.CreateVector(ivalue_offsets_),
+      tensor_data_.size(),
+      fbb.CreateVector(storage_data),
+      fbb.CreateVector(obj_types_offset_),
+      jit_source_offset,
+      fbb.CreateVector(empty_indexes),
+      /*operator_version=*/0,
+      /*mobile_ivalue_size=*/0);
+  FinishModuleBuffer(fbb, mod);
+  return fbb.Release();
+}
+
 flatbuffers::Offset<mobile::serialization::Tuple> FlatbufferSerializer::
     tupleToFB(flatbuffers::FlatBufferBuilder& fbb, const IValue& tuple) {
   const auto& elements = tuple.toTuple()->elements();
@@ -827,6 +889,26 @@ void save_mobile_module_to_func(
   writer_func(buffer->data(), buffer->size());
 }
 
+DetachedBuffer::UniqueDetachedBuffer save_ivalue_to_bytes(
+    const c10::IValue& ivalue) {
+  FlatbufferSerializer fb_serializer;
+  flatbuffers::DetachedBuffer buf = fb_serializer.serializeIValue(ivalue);
+  flatbuffers::DetachedBuffer* buf_ptr =
+      new flatbuffers::DetachedBuffer(std::move(buf));
+  DetachedBuffer* ret =
+      new DetachedBuffer(buf_ptr->data(), buf_ptr->size(), buf_ptr);
+  return DetachedBufferFriend::make_unique_detached_buffer(ret);
+}
+
+void save_ivalue_to_file(const c10::IValue& ivalue, const std::string& filename) {
+  auto buffer = save_ivalue_to_bytes(ivalue);
+  std::fstream ofile(filename, std::ios::binary | std::ios::out);
+  ofile.write(
+      reinterpret_cast<char*>(buffer->data()),
+      static_cast<std::streamsize>(buffer->size()));
+  ofile.close();
+}
+
 bool register_flatbuffer_serializer() {
   return true;
 }
@@ -87,6 +87,19 @@ TORCH_API void save_mobile_module_to_func(
     const mobile::Module& module,
     const std::function<size_t(const void*, size_t)>& writer_func);
 
+// Serializes a bare IValue (e.g. an eager state dict: nested
+// dicts/lists/tuples of tensors and primitives) into the flatbuffer
+// Module table, with the value as state_obj and no methods. Loading via
+// parse_ivalue_from_flatbuffer skips pickle opcode execution entirely,
+// which matters for checkpoints holding very many small tensors. Class
+// instances are only supported when they carry no mobile methods.
+TORCH_API DetachedBuffer::UniqueDetachedBuffer save_ivalue_to_bytes(
+    const c10::IValue& ivalue);
+
+TORCH_API void save_ivalue_to_file(
+    const c10::IValue& ivalue,
+    const std::string& filename);
+
 // TODO(qihan): delete
 TORCH_API bool register_flatbuffer_serializer();
 
@@ -388,14 +388,25 @@ Module import_ir_module(
     std::shared_ptr<CompilationUnit> cu,
     const std::string& filename,
     c10::optional<at::Device> device,
-    ExtraFilesMap& extra_files) {
+    ExtraFilesMap& extra_files,
+    bool mmap_weights) {
   // NOTE: Zipformat can be large files. So using stream version directly
   // instead of reading the file all at once.
   if (getFileFormat(filename) != FileFormat::FlatbufferFileFormat) {
     auto reader = torch::make_unique<PyTorchStreamReader>(filename);
+    if (mmap_weights) {
+      TORCH_CHECK(
+          reader->tryEnableRecordMmap(filename),
+          "import_ir_module: could not memory-map '",
+          filename,
+          "' for mmap_weights");
+    }
     ScriptModuleDeserializer deserializer(std::move(cu), std::move(reader));
     return deserializer.deserialize(device, extra_files);
   }
+  TORCH_CHECK(
+      !mmap_weights,
+      "import_ir_module: mmap_weights is not supported for flatbuffer files");
   std::shared_ptr<char> data;
   size_t size = 0;
   std::tie(data, size) = get_file_content(filename.c_str());
@@ -450,9 +461,11 @@ Module load(const std::string& filename, c10::optional<at::Device> device) {
 Module load(
     const std::string& filename,
     c10::optional<at::Device> device,
-    ExtraFilesMap& extra_files) {
+    ExtraFilesMap& extra_files,
+    bool mmap_weights) {
   auto cu = std::make_shared<CompilationUnit>();
-  return import_ir_module(std::move(cu), filename, device, extra_files);
+  return import_ir_module(
+      std::move(cu), filename, device, extra_files, mmap_weights);
 }
 
 Module load(
@@ -32,11 +32,21 @@ TORCH_API Module import_ir_module(
     std::unique_ptr<caffe2::serialize::ReadAdapterInterface> rai,
     c10::optional<c10::Device> device = c10::nullopt);
 
+// When `mmap_weights` is true, tensor data is backed by a copy-on-write
+// memory mapping of the archive instead of heap copies, so processes that
+// load the same file share its clean weight pages. Loading is also lazy:
+// a weight's pages are only faulted in from disk when the tensor is
+// first touched, so a load that exercises a small subset of a large
+// model only reads that subset (PyTorchStreamReader::prefetch can warm
+// known-hot records ahead of time). Only supported for the zip container
+// format (flatbuffer files are rejected); weights loaded this way must
+// stay on CPU or be moved via `device`.
 TORCH_API Module import_ir_module(
     std::shared_ptr<CompilationUnit> cu,
     const std::string& filename,
     c10::optional<c10::Device> device,
-    ExtraFilesMap& extra_files);
+    ExtraFilesMap& extra_files,
+    bool mmap_weights = false);
 
 // For reading unified serialization format from torch.Package
 TORCH_API Module import_ir_module(
@@ -85,10 +95,12 @@ TORCH_API Module load(
     const std::string& filename,
     c10::optional<c10::Device> device = c10::nullopt);
 
+// See the `mmap_weights` documentation on import_ir_module above.
 TORCH_API Module load(
     const std::string& filename,
     c10::optional<c10::Device> device,
-    ExtraFilesMap& extra_files);
+    ExtraFilesMap& extra_files,
+    bool mmap_weights = false);
 
 /// Loads a serialized `Module` from the given shared_ptr `rai`.
 ///
@@ -1,9 +1,175 @@
 #include <caffe2/serialize/inline_container.h>
 #include <torch/csrc/jit/serialization/import_read.h>
 
+#include <c10/util/irange.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
 namespace torch {
 namespace jit {
 
+namespace {
+
+bool parallelLoadEnabled() {
+  static const bool enabled = []() {
+    const char* env = std::getenv("TORCH_JIT_DISABLE_PARALLEL_LOAD");
+    return env == nullptr || env[0] == '0';
+  }();
+  return enabled;
+}
+
+// Note [Pipelined storage reads]
+// Every storage record the unpickler can ask for is known up front: they
+// all live under `tensor_dir_path` and are named by storage id. So while
+// the main thread unpickles, a few background threads fetch the records in
+// id order. The unpickler consumes each record exactly once and blocks
+// only when it reaches one whose read has not finished yet, which overlaps
+// storage I/O with unpickling without changing the order records are
+// consumed in -- the result is bit-identical to a serial load.
+// PyTorchStreamReader::getRecord is safe to call concurrently, and for
+// uncompressed records backed by a thread-safe adapter (regular file
+// loads) the reads themselves overlap too. Set
+// TORCH_JIT_DISABLE_PARALLEL_LOAD=1 to fall back to fully serial reads.
+class RecordPrefetcher {
+ public:
+  RecordPrefetcher(
+      caffe2::serialize::PyTorchStreamReader& reader,
+      std::string prefix,
+      bool enable)
+      : reader_(reader), prefix_(std::move(prefix)) {
+    if (!enable || !parallelLoadEnabled()) {
+      return;
+    }
+    for (auto& record : reader_.getAllRecords()) {
+      if (record.size() <= prefix_.size() ||
+          record.compare(0, prefix_.size(), prefix_) != 0) {
+        continue;
+      }
+      std::string key = record.substr(prefix_.size());
+      if (!std::all_of(key.begin(), key.end(), [](unsigned char c) {
+            return std::isdigit(c);
+          })) {
+        continue;
+      }
+      keys_.push_back(std::move(key));
+    }
+    if (keys_.size() < 2) {
+      keys_.clear();
+      return;
+    }
+    // storage ids are consumed roughly in ascending order
+    std::sort(keys_.begin(), keys_.end(), [](const auto& a, const auto& b) {
+      return a.size() != b.size() ? a.size() < b.size() : a < b;
+    });
+    for (const auto i : c10::irange(keys_.size())) {
+      index_.emplace(keys_[i], i);
+    }
+    entries_ = std::vector<Entry>(keys_.size());
+    auto num_threads = std::min<size_t>(
+        {kNumPrefetchThreads, keys_.size(), std::thread::hardware_concurrency()});
+    try {
+      for (const auto i : c10::irange(std::max<size_t>(num_threads, 1))) {
+        (void)i;
+        workers_.emplace_back([this]() { fetchLoop(); });
+      }
+    } catch (...) {
+      joinWorkers();
+      throw;
+    }
+  }
+
+  RecordPrefetcher(const RecordPrefetcher&) = delete;
+  RecordPrefetcher& operator=(const RecordPrefetcher&) = delete;
+
+  ~RecordPrefetcher() {
+    joinWorkers();
+  }
+
+  // Returns the prefetched record for a storage key, blocking until its
+  // read has finished, or nullopt if `key` is not being prefetched (the
+  // caller then reads it directly).
+  c10::optional<at::DataPtr> take(const std::string& key) {
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      return c10::nullopt;
+    }
+    Entry& entry = entries_[it->second];
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [&entry]() { return entry.done; });
+    if (entry.error) {
+      std::rethrow_exception(entry.error);
+    }
+    if (entry.taken) {
+      return c10::nullopt;
+    }
+    entry.taken = true;
+    return std::move(std::get<0>(entry.record));
+  }
+
+ private:
+  static constexpr size_t kNumPrefetchThreads = 4;
+
+  struct Entry {
+    std::tuple<at::DataPtr, size_t> record;
+    std::exception_ptr error;
+    bool done = false;
+    bool taken = false;
+  };
+
+  void fetchLoop() {
+    while (true) {
+      size_t i = next_.fetch_add(1);
+      if (i >= keys_.size()) {
+        return;
+      }
+      Entry& entry = entries_[i];
+      std::tuple<at::DataPtr, size_t> record;
+      std::exception_ptr error;
+      try {
+        record = reader_.getRecord(prefix_ + keys_[i]);
+      } catch (...) {
+        error = std::current_exception();
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entry.record = std::move(record);
+        entry.error = std::move(error);
+        entry.done = true;
+      }
+      cv_.notify_all();
+    }
+  }
+
+  void joinWorkers() {
+    // drains the queue even when unpickling throws; entries left behind
+    // are simply freed
+    for (auto& worker : workers_) {
+      if (worker.joinable()) {
+        worker.join();
+      }
+    }
+  }
+
+  caffe2::serialize::PyTorchStreamReader& reader_;
+  std::string prefix_;
+  std::vector<std::string> keys_;
+  std::unordered_map<std::string, size_t> index_;
+  std::vector<Entry> entries_;
+  std::vector<std::thread> workers_;
+  std::atomic<size_t> next_{0};
+  std::mutex mutex_;
+  std::condition_variable cv_;
+};
+
+} // namespace
+
 IValue readArchiveAndTensors(
     const std::string& archive_name,
     const std::string& pickle_prefix,
@@ -36,7 +202,15 @@ IValue readArchiveAndTensors(
   std::string tensor_dir_path =
       (tensor_prefix.compare("") != 0) ? tensor_prefix : archive_name + "/";
 
+  // See Note [Pipelined storage reads]. With a shared storage context
+  // (torch.package) some storages are served from the context instead of
+  // the archive, so prefetching them would read data nobody consumes.
+  RecordPrefetcher prefetcher(
+      stream_reader, tensor_dir_path, /*enable=*/storage_context == nullptr);
   auto read_record = [&](const std::string& name) {
+    if (auto prefetched = prefetcher.take(name)) {
+      return std::move(*prefetched);
+    }
     std::string ss = tensor_dir_path + name;
     return std::get<0>(stream_reader.getRecord(ss));
   };
@@ -51,6 +225,13 @@ IValue readArchiveAndTensors(
       type_parser,
       storage_context);
   unpickler.set_version(stream_reader.version());
+  // The record is fully materialized and its size is known from the zip
+  // index, so let the unpickler read straight out of it instead of
+  // staging 256-byte chunks through `reader`. A memoized object costs at
+  // least a handful of stream bytes, so pickle_size / 16 over-reserves
+  // the memo table without growing it incrementally.
+  unpickler.set_complete_buffer(data, pickle_size);
+  unpickler.set_memo_capacity_hint(pickle_size / 16);
   return unpickler.parse_ivalue();
 }
 
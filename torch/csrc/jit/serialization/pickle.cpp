@@ -133,22 +133,15 @@ IValue unpickle(
     TypeResolver type_resolver,
     c10::ArrayRef<at::Tensor> tensor_table,
     c10::TypePtr (*type_parser)(const std::string&)) {
-  size_t bytes_read = 0;
-  return unpickle(
-      [&](char* buffer, size_t len) -> size_t {
-        if (bytes_read >= size) {
-          return 0;
-        }
-        len = std::min(size - bytes_read, len);
-        // Copy len bytes into buffer
-        const char* start = data + bytes_read;
-        std::memcpy(buffer, start, len);
-        bytes_read += len;
-        return len;
-      },
+  // The whole stream is already in memory; read straight out of it
+  // instead of staging chunks through a reader function.
+  Unpickler unpickler(
+      [](char*, size_t) -> size_t { return 0; },
       std::move(type_resolver),
       tensor_table,
       type_parser);
+  unpickler.set_complete_buffer(data, size);
+  return unpickler.parse_ivalue();
 }
 
 } // namespace jit
@@ -728,6 +728,54 @@ WriteableTensorData getWriteableTensorData(
   return result;
 }
 
+// Note [Streaming tensor serialization]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// getWriteableTensorData copies a device tensor's entire storage to the
+// host before any byte reaches the writer, so checkpointing a
+// device-resident model transiently needs host memory for the full
+// storage on top of the writer's own buffers. StreamingTensorData
+// instead aliases the storage as a flat byte tensor and serves it
+// range by range: device ranges are copied through a single reusable
+// pinned staging chunk (pinned so transfers run at DMA speed and the
+// allocation is recycled by the caching host allocator), while CPU
+// ranges are read in place. Paired with the callback-based
+// PyTorchStreamWriter::writeRecord overload, the extra host memory per
+// tensor drops from the whole storage to one staging chunk.
+
+StreamingTensorData::StreamingTensorData(const at::Tensor& tensor) {
+  size_ = tensor.storage().nbytes();
+  // NB: a byte-typed alias is used so that read ranges do not have to be
+  // aligned to the tensor's element size.
+  flat_ = at::empty({0}, tensor.options().dtype(at::kByte))
+              .set_(
+                  tensor.storage(),
+                  /* storage_offset = */ 0,
+                  /* size = */ {static_cast<int64_t>(size_)},
+                  /* stride = */ {1});
+}
+
+size_t StreamingTensorData::read(uint64_t pos, void* buf, size_t n) {
+  if (pos >= size_) {
+    return 0;
+  }
+  n = std::min(n, static_cast<size_t>(size_ - pos));
+  if (flat_.device().is_cpu()) {
+    memcpy(buf, flat_.data_ptr<uint8_t>() + pos, n);
+    return n;
+  }
+  auto len = static_cast<int64_t>(n);
+  if (!staging_.defined() || staging_.numel() < len) {
+    staging_ = at::empty(
+        {len},
+        at::TensorOptions(at::kCPU).dtype(at::kByte).pinned_memory(
+            flat_.is_cuda()));
+  }
+  auto chunk = staging_.narrow(0, 0, len);
+  chunk.copy_(flat_.narrow(0, static_cast<int64_t>(pos), len));
+  memcpy(buf, chunk.data_ptr(), n);
+  return n;
+}
+
 bool checkHasValidSetGetState(const std::shared_ptr<c10::ClassType>& cls) {
   // Check that the schemas for __getstate__ and __setstate__ are correct
   auto getstate = cls->findMethod("__getstate__");
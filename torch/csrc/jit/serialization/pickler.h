@@ -114,6 +114,26 @@ struct WriteableTensorData {
   uint64_t size_;
 };
 
+// See Note [Streaming tensor serialization] in pickler.cpp. Produces the
+// bytes of a tensor's storage in bounded chunks, copying device storages
+// through a reusable pinned staging buffer instead of materializing a
+// whole-storage host copy up front.
+struct TORCH_API StreamingTensorData {
+  explicit StreamingTensorData(const at::Tensor& tensor);
+  size_t sizeInBytes() const {
+    return size_;
+  }
+  // Copies `n` bytes starting at byte `pos` of the storage into `buf` and
+  // returns the number of bytes copied; shaped to serve the
+  // callback-based PyTorchStreamWriter::writeRecord overload.
+  size_t read(uint64_t pos, void* buf, size_t n);
+
+ private:
+  at::Tensor flat_; // 1-d byte alias of the whole storage
+  at::Tensor staging_; // host staging chunk for device storages
+  uint64_t size_;
+};
+
 void setTypeTags(bool state);
 bool getTypeTags();
 
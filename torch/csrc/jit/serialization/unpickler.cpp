@@ -332,7 +332,16 @@ PickleOpCode Unpickler::readInstruction() {
     } break;
     case PickleOpCode::BINUNICODE: {
       uint32_t length = read<uint32_t>();
-      stack_.emplace_back(readBytes(length));
+      std::string str = readBytes(length);
+      // short strings in a module archive repeat heavily across
+      // submodules (attribute and dict keys), so share one ConstantString
+      // per distinct text instead of allocating a fresh one each time
+      constexpr uint32_t kMaxInternedStringLength = 64;
+      if (length <= kMaxInternedStringLength) {
+        stack_.emplace_back(c10::ivalue::ConstantString::intern(str));
+      } else {
+        stack_.emplace_back(std::move(str));
+      }
     } break;
     case PickleOpCode::BINFLOAT:
       stack_.emplace_back(readFloat());
@@ -967,9 +976,11 @@ void Unpickler::readSlowWithBuffer(char* dest, size_t sz) {
   // We explicitly assume that sz > buffer_remaining_,
   // and that sz is never bigger than buffer_.size().
   AT_ASSERT(sz > buffer_remaining_);
+  // with the complete stream in hand there is nothing left to refill from
+  TORCH_CHECK(!complete_buffer_, "Unexpected end of pickler archive.");
   const size_t from_old_buf = buffer_remaining_;
   if (from_old_buf != 0) {
-    memcpy(dest, buffer_.data() + buffer_pos_, from_old_buf);
+    memcpy(dest, buffer_data_ + buffer_pos_, from_old_buf);
   }
   const size_t needed = sz - from_old_buf;
   // Full read into the buffer. The calls here all explicitly
@@ -990,9 +1001,11 @@ std::string Unpickler::readBytes(size_t length) {
   static const size_t kSmallString = 64;
   if (length <= buffer_remaining_) {
     // Fast-path: entirely in buffer.
-    data.assign(buffer_.data() + buffer_pos_, length);
+    data.assign(buffer_data_ + buffer_pos_, length);
     buffer_pos_ += length;
     buffer_remaining_ -= length;
+  } else if (complete_buffer_) {
+    AT_ERROR("Unexpected end of pickler archive.");
   } else if (length <= kSmallString) {
     // If the string is smallish, do a full buffer read,
     // and read out of that buffer.
@@ -1004,7 +1017,7 @@ std::string Unpickler::readBytes(size_t length) {
     const size_t from_old_buf = buffer_remaining_;
     if (from_old_buf != 0) {
       data.reserve(length);
-      data.append(buffer_.data() + buffer_pos_, from_old_buf);
+      data.append(buffer_data_ + buffer_pos_, from_old_buf);
     }
     data.resize(length);
     const size_t needed = length - from_old_buf;
@@ -1072,10 +1085,11 @@ inline bool is_valid_python_id_char(char c) {
 std::string Unpickler::readString() {
   std::string ss;
   while (true) {
-    auto* const bufferStart = buffer_.data() + buffer_pos_;
-    const auto bufferLeft = buffer_.size() - buffer_pos_;
-    char* const newlinePtr =
-        static_cast<char*>(memchr(bufferStart, '\n', bufferLeft));
+    const char* const bufferStart = buffer_data_ + buffer_pos_;
+    const auto bufferLeft =
+        complete_buffer_ ? buffer_remaining_ : buffer_.size() - buffer_pos_;
+    const char* const newlinePtr = static_cast<const char*>(
+        memchr(bufferStart, '\n', bufferLeft));
     if (newlinePtr) {
       // read up to newline and we are done.
       auto const charsRead = newlinePtr - bufferStart;
@@ -1084,6 +1098,9 @@ std::string Unpickler::readString() {
       buffer_pos_ += charsRead + 1;
       break;
     } else {
+      // with the complete stream in hand a missing newline means the
+      // archive is truncated
+      TORCH_CHECK(!complete_buffer_, "Unexpected end of pickler archive.");
       // read whole buffer, refill
       for (const char* p = bufferStart; p < bufferStart + bufferLeft; ++p) {
         // Simple check just in case there is no terminating '\n'
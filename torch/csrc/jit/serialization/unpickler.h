@@ -90,6 +90,26 @@ class TORCH_API Unpickler {
     version_ = version_number;
   }
 
+  // Points the unpickler at the complete pickle stream, which must stay
+  // alive until parse_ivalue() returns. All reads then come straight out
+  // of `data` instead of being staged through reader_ in 256-byte
+  // chunks; reader_ is never called. Callers that materialize the whole
+  // record anyway (zip archives report its size up front) should prefer
+  // this.
+  void set_complete_buffer(const char* data, size_t size) {
+    buffer_data_ = data;
+    buffer_remaining_ = size;
+    buffer_pos_ = 0;
+    complete_buffer_ = true;
+  }
+
+  // Reserves the memo table up front. The pickle format carries no memo
+  // count, so callers pass an estimate (e.g. derived from the stream
+  // size); an over-estimate only costs reserved capacity.
+  void set_memo_capacity_hint(size_t num_entries) {
+    memo_table_.reserve(num_entries);
+  }
+
   static c10::TypePtr defaultTypeParser(const std::string& str) {
     ScriptTypeParser parser;
     return parser.parseType(str);
@@ -103,7 +123,7 @@ class TORCH_API Unpickler {
     T item;
     if (sizeof(T) <= buffer_remaining_) {
       // Fast path: entirely from buffer.
-      memcpy(&item, buffer_.data() + buffer_pos_, sizeof(T));
+      memcpy(&item, buffer_data_ + buffer_pos_, sizeof(T));
       buffer_remaining_ -= sizeof(T);
       buffer_pos_ += sizeof(T);
     } else {
@@ -139,6 +159,10 @@ class TORCH_API Unpickler {
   std::function<size_t(char*, size_t)> reader_;
   // Small buffer to avoid calling reader_ on a per-byte basis.
   std::array<char, 256> buffer_;
+  // Either buffer_.data(), or the caller's stream after
+  // set_complete_buffer.
+  const char* buffer_data_{buffer_.data()};
+  bool complete_buffer_{false};
   size_t buffer_pos_{0};
   size_t buffer_remaining_{0};
 
@@ -1434,6 +1434,26 @@ void nnc_mkldnn_prepacked_conv_run(
   context->run(x, buf_data[0]);
 }
 
+void nnc_mkldnn_prepacked_linear_run(
+    int64_t bufs_num,
+    void** buf_data,
+    int64_t* buf_ranks,
+    int64_t* buf_dims,
+    int64_t* buf_strides,
+    int8_t* buf_dtypes,
+    int64_t args_num,
+    int64_t* extra_args) {
+  using namespace at::native::mkldnn;
+
+  auto tensors = constructTensors(
+      bufs_num - 1, buf_data, buf_ranks, buf_dims, buf_strides, buf_dtypes);
+
+  const at::Tensor& x = tensors[1];
+  auto context = reinterpret_cast<LinearOpContext*>(buf_data[2]);
+
+  context->run(x, buf_data[0]);
+}
+
 #endif // AT_MKLDNN_ENABLED()
 
 #ifdef USE_XNNPACK
@@ -1618,6 +1638,9 @@ const static RegisterNNCExternalFunction nnc_embedding(
 const static RegisterNNCExternalFunction reg_nnc_mkldnn_prepacked_conv_run(
     "nnc_mkldnn_prepacked_conv_run",
     nnc_mkldnn_prepacked_conv_run);
+const static RegisterNNCExternalFunction reg_nnc_mkldnn_prepacked_linear_run(
+    "nnc_mkldnn_prepacked_linear_run",
+    nnc_mkldnn_prepacked_linear_run);
 #endif // AT_MKLDNN_ENABLED()
 
 #ifdef USE_XNNPACK
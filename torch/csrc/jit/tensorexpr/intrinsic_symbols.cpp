@@ -38,6 +38,22 @@ __m128 Sleef_atan2f4_u10(__m128, __m128);
 __m128 Sleef_powf4_u10(__m128, __m128);
 __m128 Sleef_fmodf4(__m128, __m128);
 
+// Reduced-precision (3.5 ULP) variants, used when approximate
+// transcendentals are requested. sleef does not provide faster versions
+// of exp, erf, pow or the log1p/expm1 family, so only the ops below have
+// an approximate lowering.
+__m128 Sleef_acosf4_u35(__m128);
+__m128 Sleef_asinf4_u35(__m128);
+__m128 Sleef_atanf4_u35(__m128);
+__m128 Sleef_cosf4_u35(__m128);
+__m128 Sleef_sinf4_u35(__m128);
+__m128 Sleef_tanf4_u35(__m128);
+__m128 Sleef_coshf4_u35(__m128);
+__m128 Sleef_sinhf4_u35(__m128);
+__m128 Sleef_tanhf4_u35(__m128);
+__m128 Sleef_logf4_u35(__m128);
+__m128 Sleef_atan2f4_u35(__m128, __m128);
+
 __m256 Sleef_acosf8_u10(__m256);
 __m256 Sleef_asinf8_u10(__m256);
 __m256 Sleef_atanf8_u10(__m256);
@@ -66,6 +82,18 @@ __m256 Sleef_atan2f8_u10(__m256, __m256);
 __m256 Sleef_powf8_u10(__m256, __m256);
 __m256 Sleef_fmodf8(__m256, __m256);
 
+__m256 Sleef_acosf8_u35(__m256);
+__m256 Sleef_asinf8_u35(__m256);
+__m256 Sleef_atanf8_u35(__m256);
+__m256 Sleef_cosf8_u35(__m256);
+__m256 Sleef_sinf8_u35(__m256);
+__m256 Sleef_tanf8_u35(__m256);
+__m256 Sleef_coshf8_u35(__m256);
+__m256 Sleef_sinhf8_u35(__m256);
+__m256 Sleef_tanhf8_u35(__m256);
+__m256 Sleef_logf8_u35(__m256);
+__m256 Sleef_atan2f8_u35(__m256, __m256);
+
 __m128d Sleef_acosd2_u10(__m128d);
 __m128d Sleef_asind2_u10(__m128d);
 __m128d Sleef_atand2_u10(__m128d);
@@ -94,6 +122,18 @@ __m128d Sleef_atan2d2_u10(__m128d, __m128d);
 __m128d Sleef_powd2_u10(__m128d, __m128d);
 __m128d Sleef_fmodd2(__m128d, __m128d);
 
+__m128d Sleef_acosd2_u35(__m128d);
+__m128d Sleef_asind2_u35(__m128d);
+__m128d Sleef_atand2_u35(__m128d);
+__m128d Sleef_cosd2_u35(__m128d);
+__m128d Sleef_sind2_u35(__m128d);
+__m128d Sleef_tand2_u35(__m128d);
+__m128d Sleef_coshd2_u35(__m128d);
+__m128d Sleef_sinhd2_u35(__m128d);
+__m128d Sleef_tanhd2_u35(__m128d);
+__m128d Sleef_logd2_u35(__m128d);
+__m128d Sleef_atan2d2_u35(__m128d, __m128d);
+
 __m256d Sleef_acosd4_u10(__m256d);
 __m256d Sleef_asind4_u10(__m256d);
 __m256d Sleef_atand4_u10(__m256d);
@@ -122,6 +162,18 @@ __m256d Sleef_atan2d4_u10(__m256d, __m256d);
 __m256d Sleef_powd4_u10(__m256d, __m256d);
 __m256d Sleef_fmodd4(__m256d, __m256d);
 
+__m256d Sleef_acosd4_u35(__m256d);
+__m256d Sleef_asind4_u35(__m256d);
+__m256d Sleef_atand4_u35(__m256d);
+__m256d Sleef_cosd4_u35(__m256d);
+__m256d Sleef_sind4_u35(__m256d);
+__m256d Sleef_tand4_u35(__m256d);
+__m256d Sleef_coshd4_u35(__m256d);
+__m256d Sleef_sinhd4_u35(__m256d);
+__m256d Sleef_tanhd4_u35(__m256d);
+__m256d Sleef_logd4_u35(__m256d);
+__m256d Sleef_atan2d4_u35(__m256d, __m256d);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -194,6 +246,18 @@ c10::ArrayRef<SymbolAddress> getIntrinsicSymbols() {
     {"Sleef_powf4", reinterpret_cast<void*>(&Sleef_powf4_u10)},
     {"Sleef_fmodf4", reinterpret_cast<void*>(&Sleef_fmodf4)},
 
+    {"Sleef_acosf4_u35", reinterpret_cast<void*>(&Sleef_acosf4_u35)},
+    {"Sleef_asinf4_u35", reinterpret_cast<void*>(&Sleef_asinf4_u35)},
+    {"Sleef_atanf4_u35", reinterpret_cast<void*>(&Sleef_atanf4_u35)},
+    {"Sleef_cosf4_u35", reinterpret_cast<void*>(&Sleef_cosf4_u35)},
+    {"Sleef_sinf4_u35", reinterpret_cast<void*>(&Sleef_sinf4_u35)},
+    {"Sleef_tanf4_u35", reinterpret_cast<void*>(&Sleef_tanf4_u35)},
+    {"Sleef_coshf4_u35", reinterpret_cast<void*>(&Sleef_coshf4_u35)},
+    {"Sleef_sinhf4_u35", reinterpret_cast<void*>(&Sleef_sinhf4_u35)},
+    {"Sleef_tanhf4_u35", reinterpret_cast<void*>(&Sleef_tanhf4_u35)},
+    {"Sleef_logf4_u35", reinterpret_cast<void*>(&Sleef_logf4_u35)},
+    {"Sleef_atan2f4_u35", reinterpret_cast<void*>(&Sleef_atan2f4_u35)},
+
     // FP32 Sleef functions -- AVX2
     {"Sleef_acosf8", reinterpret_cast<void*>(&Sleef_acosf8_u10)},
     {"Sleef_asinf8", reinterpret_cast<void*>(&Sleef_asinf8_u10)},
@@ -223,6 +287,18 @@ c10::ArrayRef<SymbolAddress> getIntrinsicSymbols() {
     {"Sleef_powf8", reinterpret_cast<void*>(&Sleef_powf8_u10)},
     {"Sleef_fmodf8", reinterpret_cast<void*>(&Sleef_fmodf8)},
 
+    {"Sleef_acosf8_u35", reinterpret_cast<void*>(&Sleef_acosf8_u35)},
+    {"Sleef_asinf8_u35", reinterpret_cast<void*>(&Sleef_asinf8_u35)},
+    {"Sleef_atanf8_u35", reinterpret_cast<void*>(&Sleef_atanf8_u35)},
+    {"Sleef_cosf8_u35", reinterpret_cast<void*>(&Sleef_cosf8_u35)},
+    {"Sleef_sinf8_u35", reinterpret_cast<void*>(&Sleef_sinf8_u35)},
+    {"Sleef_tanf8_u35", reinterpret_cast<void*>(&Sleef_tanf8_u35)},
+    {"Sleef_coshf8_u35", reinterpret_cast<void*>(&Sleef_coshf8_u35)},
+    {"Sleef_sinhf8_u35", reinterpret_cast<void*>(&Sleef_sinhf8_u35)},
+    {"Sleef_tanhf8_u35", reinterpret_cast<void*>(&Sleef_tanhf8_u35)},
+    {"Sleef_logf8_u35", reinterpret_cast<void*>(&Sleef_logf8_u35)},
+    {"Sleef_atan2f8_u35", reinterpret_cast<void*>(&Sleef_atan2f8_u35)},
+
     // FP64 Sleef functions -- SSE
     {"Sleef_acosd2", reinterpret_cast<void*>(&Sleef_acosd2_u10)},
     {"Sleef_asind2", reinterpret_cast<void*>(&Sleef_asind2_u10)},
@@ -252,6 +328,18 @@ c10::ArrayRef<SymbolAddress> getIntrinsicSymbols() {
     {"Sleef_powd2", reinterpret_cast<void*>(&Sleef_powd2_u10)},
     {"Sleef_fmodd2", reinterpret_cast<void*>(&Sleef_fmodd2)},
 
+    {"Sleef_acosd2_u35", reinterpret_cast<void*>(&Sleef_acosd2_u35)},
+    {"Sleef_asind2_u35", reinterpret_cast<void*>(&Sleef_asind2_u35)},
+    {"Sleef_atand2_u35", reinterpret_cast<void*>(&Sleef_atand2_u35)},
+    {"Sleef_cosd2_u35", reinterpret_cast<void*>(&Sleef_cosd2_u35)},
+    {"Sleef_sind2_u35", reinterpret_cast<void*>(&Sleef_sind2_u35)},
+    {"Sleef_tand2_u35", reinterpret_cast<void*>(&Sleef_tand2_u35)},
+    {"Sleef_coshd2_u35", reinterpret_cast<void*>(&Sleef_coshd2_u35)},
+    {"Sleef_sinhd2_u35", reinterpret_cast<void*>(&Sleef_sinhd2_u35)},
+    {"Sleef_tanhd2_u35", reinterpret_cast<void*>(&Sleef_tanhd2_u35)},
+    {"Sleef_logd2_u35", reinterpret_cast<void*>(&Sleef_logd2_u35)},
+    {"Sleef_atan2d2_u35", reinterpret_cast<void*>(&Sleef_atan2d2_u35)},
+
     // FP64 Sleef functions -- AVX2
     {"Sleef_acosd4", reinterpret_cast<void*>(&Sleef_acosd4_u10)},
     {"Sleef_asind4", reinterpret_cast<void*>(&Sleef_asind4_u10)},
@@ -280,6 +368,18 @@ c10::ArrayRef<SymbolAddress> getIntrinsicSymbols() {
     {"Sleef_atan2d4", reinterpret_cast<void*>(&Sleef_atan2d4_u10)},
     {"Sleef_powd4", reinterpret_cast<void*>(&Sleef_powd4_u10)},
     {"Sleef_fmodd4", reinterpret_cast<void*>(&Sleef_fmodd4)},
+
+    {"Sleef_acosd4_u35", reinterpret_cast<void*>(&Sleef_acosd4_u35)},
+    {"Sleef_asind4_u35", reinterpret_cast<void*>(&Sleef_asind4_u35)},
+    {"Sleef_atand4_u35", reinterpret_cast<void*>(&Sleef_atand4_u35)},
+    {"Sleef_cosd4_u35", reinterpret_cast<void*>(&Sleef_cosd4_u35)},
+    {"Sleef_sind4_u35", reinterpret_cast<void*>(&Sleef_sind4_u35)},
+    {"Sleef_tand4_u35", reinterpret_cast<void*>(&Sleef_tand4_u35)},
+    {"Sleef_coshd4_u35", reinterpret_cast<void*>(&Sleef_coshd4_u35)},
+    {"Sleef_sinhd4_u35", reinterpret_cast<void*>(&Sleef_sinhd4_u35)},
+    {"Sleef_tanhd4_u35", reinterpret_cast<void*>(&Sleef_tanhd4_u35)},
+    {"Sleef_logd4_u35", reinterpret_cast<void*>(&Sleef_logd4_u35)},
+    {"Sleef_atan2d4_u35", reinterpret_cast<void*>(&Sleef_atan2d4_u35)},
 #endif
   };
   return c10::ArrayRef<SymbolAddress>(symbolAddresses);
@@ -48,6 +48,7 @@ static bool te_generate_block_code = false;
 static bool te_must_use_llvm_on_cpu = true;
 static bool cat_wo_conditionals = true; // NOLINT
 static bool opt_conditionals = false; // NOLINT
+static bool te_approximate_transcendentals = false; // NOLINT
 
 bool setFallbackAllowed(bool value) {
   bool old_value = fallback_allowed;
@@ -121,6 +122,13 @@ bool& getTEMustUseLLVMOnCPU() {
   return te_must_use_llvm_on_cpu;
 }
 
+// When set, transcendental intrinsics are lowered to the faster
+// reduced-precision (3.5 ULP) sleef kernels where available. Read at
+// compilation time, so it can be toggled per kernel.
+bool& getTEApproximateTranscendentals() {
+  return te_approximate_transcendentals;
+}
+
 bool& getCatWoConditionals() {
   return cat_wo_conditionals;
 }
@@ -669,7 +677,14 @@ bool loopBoundsAllEqual(const std::vector<ForPtr>& loops) {
 // on matching bounds exists to avoid inserting conditionals on the loop
 // indices where none would be needed, which would significantly complicate
 // vectorization.
-void fuseAllLoops(StmtPtr st) {
+//
+// Loop nests containing a reduction normally break up a fusible run: fusing a
+// consumer into a reduction nest keeps the reduction's innermost loop from
+// being vectorized.  When `fuse_reductions` is set (for groups containing a
+// convolution) they participate instead, so a conv's epilogue is computed in
+// the conv's own output tile loop rather than in a second full pass over the
+// activation; LoopNest::fuseLoops still verifies legality per fusion.
+void fuseAllLoops(StmtPtr st, bool fuse_reductions = false) {
   auto block = to<tensorexpr::Block>(st);
   if (block == nullptr) {
     return;
@@ -679,7 +694,8 @@ void fuseAllLoops(StmtPtr st) {
   std::vector<ForPtr> outer_loops;
   for (const auto& stmt : *block) {
     auto loop = to<For>(stmt);
-    auto hasReduction = NodeFinder<ReduceOp>::find(stmt).size() != 0;
+    auto hasReduction =
+        !fuse_reductions && NodeFinder<ReduceOp>::find(stmt).size() != 0;
     if (!loop || hasReduction) {
       all_outer_loops.push_back(outer_loops);
       outer_loops.clear();
@@ -704,7 +720,7 @@ void fuseAllLoops(StmtPtr st) {
       continue;
     }
 
-    fuseAllLoops(fusedLoop->body());
+    fuseAllLoops(fusedLoop->body(), fuse_reductions);
   }
 }
 
@@ -745,6 +761,10 @@ static void pruneByThreadCount(std::vector<ForPtr>& loops) {
     }
     auto tc = tripCount(*it);
     if (!tc) {
+      // A symbolic bound (dynamic-shape kernel) has an unknown, typically
+      // large, trip count; keep this loop so the nest still parallelizes --
+      // the parallel runtime sizes the actual work at dispatch time.
+      ++it;
       break;
     }
     trips *= *tc;
@@ -801,8 +821,6 @@ StmtPtr TensorExprKernel::transformLoops(BackendType backendType, StmtPtr st) {
         "After random transform:\n", std::to_string(l.root_stmt()), "\n");
   }
 
-  bool hasReduction = NodeFinder<ReduceOp>::find(l.root_stmt()).size() != 0;
-
   // For Block codegen we create a map of tensor dims before
   // inlining. Like GPU codegen we need to inline. But the order
   // where this analysis is run matters.
@@ -838,7 +856,14 @@ StmtPtr TensorExprKernel::transformLoops(BackendType backendType, StmtPtr st) {
   // Fuse loops "horizontally".  This pass allows us to combine loops that
   // write to different output buffers, as long as they have the same bounds.
   if (backendType == kLLVMCodeGen) {
-    fuseAllLoops(l.root_stmt());
+    bool has_conv = false;
+    for (auto const& n : graph_->block()->nodes()) {
+      if (n->kind() == aten::conv2d || n->kind() == aten::_convolution) {
+        has_conv = true;
+        break;
+      }
+    }
+    fuseAllLoops(l.root_stmt(), /*fuse_reductions=*/has_conv);
     GRAPH_DEBUG("after fuse", *l.root_stmt());
     parallelizeOuterLoops(l, bufsToBeParallelized_);
     GRAPH_DEBUG("after parallelize", *l.root_stmt());
@@ -930,7 +955,10 @@ StmtPtr TensorExprKernel::transformLoops(BackendType backendType, StmtPtr st) {
   l.simplify();
   GRAPH_DEBUG("after simplification", *l.root_stmt());
 
-  if (backendType == kLLVMCodeGen && !hasReduction) {
+  if (backendType == kLLVMCodeGen) {
+    // Innermost loops containing a reduction are skipped inside
+    // vectorizeInnerLoops, so a reduction somewhere in the fusion group no
+    // longer blocks vectorization of the remaining pointwise loops.
     l.vectorizeInnerLoops();
     GRAPH_DEBUG("after vectorization", *l.root_stmt());
   }
@@ -59,6 +59,7 @@
 #include <torch/csrc/jit/tensorexpr/external_functions_registry.h>
 #include <torch/csrc/jit/tensorexpr/half_support.h>
 #include <torch/csrc/jit/tensorexpr/ir.h>
+#include <torch/csrc/jit/tensorexpr/kernel.h>
 #include <torch/csrc/jit/tensorexpr/ir_printer.h>
 #include <torch/csrc/jit/tensorexpr/tensor.h>
 #include <torch/csrc/jit/tensorexpr/types.h>
@@ -1801,6 +1802,13 @@ LLVMCodeGenImpl::SimdCallee LLVMCodeGenImpl::getSimdFunction(
   std::string typeSuffix = basetype == DoubleTy_ ? "d" : "";
   std::string sleefName =
       "Sleef_" + basename + typeSuffix + std::to_string(lanes);
+  // With approximate transcendentals requested, prefer the 3.5 ULP sleef
+  // kernels over the default 1 ULP ones. Ops for which sleef has no
+  // reduced-precision version (e.g. exp, erf, pow) keep the exact lowering.
+  if (getTEApproximateTranscendentals() && wantSleef(basename) && hasAVX &&
+      jit_->hasSymbol(sleefName + "_u35")) {
+    sleefName += "_u35";
+  }
   if (wantSleef(basename) && hasAVX && jit_->hasSymbol(sleefName)) {
     name = std::move(sleefName);
     type = llvm::VectorType::get(basetype, ElementCount(lanes));
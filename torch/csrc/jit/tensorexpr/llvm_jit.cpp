@@ -20,6 +20,7 @@ C10_DIAGNOSTIC_POP()
 #pragma GCC diagnostic ignored "-Wnon-virtual-dtor"
 #include <llvm/ExecutionEngine/Orc/LLJIT.h>
 #pragma GCC diagnostic pop
+#include <llvm/ExecutionEngine/ObjectCache.h>
 #include <llvm/ExecutionEngine/Orc/RTDyldObjectLinkingLayer.h>
 #include <llvm/ExecutionEngine/Orc/SymbolStringPool.h>
 #include <llvm/ExecutionEngine/RTDyldMemoryManager.h>
@@ -28,7 +29,11 @@ C10_DIAGNOSTIC_POP()
 #include <llvm/IR/Mangler.h>
 #include <llvm/Support/CFGUpdate.h>
 #include <llvm/Support/DynamicLibrary.h>
+#include <llvm/Support/FileSystem.h>
 #include <llvm/Support/Host.h>
+#include <llvm/Support/MD5.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Target/TargetMachine.h>
 
@@ -37,6 +42,7 @@ C10_DIAGNOSTIC_POP()
 #include <c10/util/Half.h>
 
 #include <algorithm>
+#include <cstdlib>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -137,12 +143,87 @@ static void registerIntrinsics(
 namespace llvm {
 namespace orc {
 
+#if LLVM_VERSION_MAJOR >= 10
+// Note [NNC kernel object cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Compiling fusion groups with LLVM dominates warmup for CPU-heavy
+// scripted models, and the kernels a model produces are identical from
+// run to run. When TORCH_NNC_KERNEL_CACHE_DIR is set, compiled object
+// files are persisted in that directory and reloaded (memory-mapped) on
+// the next start instead of re-running LLVM codegen. The cache key is an
+// MD5 of the module's textual IR -- LLVMCodeGenImpl runs its optimization
+// pipeline before handing the module to the JIT, so the print is a
+// complete description of codegen's input -- combined with the target
+// triple, CPU, feature string and LLVM version. Entries are written to a
+// unique temp file and renamed into place, so processes sharing a
+// directory race benignly. Stale entries are never reused (any change to
+// the key inputs misses) but also never evicted; delete the directory to
+// reclaim space.
+class PytorchObjectCache : public ObjectCache {
+ public:
+  PytorchObjectCache(std::string dir, std::string target_tag)
+      : dir_(std::move(dir)), target_tag_(std::move(target_tag)) {
+    llvm::sys::fs::create_directories(dir_);
+  }
+
+  void notifyObjectCompiled(const Module* M, MemoryBufferRef Obj) override {
+    SmallString<256> path = cachePath(M);
+    int fd = 0;
+    SmallString<256> tmp_file;
+    if (llvm::sys::fs::createUniqueFile(
+            Twine(path) + ".%%%%%%.tmp", fd, tmp_file)) {
+      return;
+    }
+    {
+      raw_fd_ostream os(fd, /*shouldClose=*/true);
+      os << Obj.getBuffer();
+    }
+    if (llvm::sys::fs::rename(tmp_file, path)) {
+      llvm::sys::fs::remove(tmp_file);
+    }
+  }
+
+  std::unique_ptr<MemoryBuffer> getObject(const Module* M) override {
+    auto buffer = MemoryBuffer::getFile(cachePath(M));
+    if (!buffer) {
+      return nullptr;
+    }
+    return std::move(*buffer);
+  }
+
+ private:
+  SmallString<256> cachePath(const Module* M) const {
+    std::string ir;
+    raw_string_ostream ir_stream(ir);
+    M->print(ir_stream, nullptr);
+    ir_stream.flush();
+    MD5 hash;
+    hash.update(ir);
+    hash.update(target_tag_);
+    MD5::MD5Result result;
+    hash.final(result);
+    SmallString<32> digest;
+    MD5::stringifyResult(result, digest);
+    SmallString<256> path(dir_);
+    llvm::sys::path::append(path, Twine("nnc_") + digest + ".o");
+    return path;
+  }
+
+  std::string dir_;
+  std::string target_tag_;
+};
+#endif // LLVM_VERSION_MAJOR >= 10
+
 // Lightly modified implementation from LLVM's Kaleidoscope JIT tutorial:
 // https://llvm.org/docs/tutorial/BuildingAJIT1.html
 #if LLVM_VERSION_MAJOR >= 9
 class TORCH_API PytorchLLVMJITImpl {
  private:
   std::unique_ptr<TargetMachine> TM;
+#if LLVM_VERSION_MAJOR >= 10
+  // must outlive LLJ, whose compiler holds a pointer to it
+  std::unique_ptr<PytorchObjectCache> object_cache_;
+#endif
   std::unique_ptr<LLJIT> LLJ;
   std::unordered_set<std::string> intrinsics;
 
@@ -152,11 +233,35 @@ class TORCH_API PytorchLLVMJITImpl {
       c10::optional<std::string> cpu,
       c10::optional<std::string> attrs)
       : TM(assertSuccess(makeTargetMachineBuilder(triple, cpu, attrs)
-                             .createTargetMachine())),
-        LLJ(assertSuccess(LLJITBuilder()
-                              .setJITTargetMachineBuilder(
-                                  makeTargetMachineBuilder(triple, cpu, attrs))
-                              .create())) {
+                             .createTargetMachine())) {
+    LLJITBuilder Builder;
+    Builder.setJITTargetMachineBuilder(
+        makeTargetMachineBuilder(triple, cpu, attrs));
+#if LLVM_VERSION_MAJOR >= 10
+    // See Note [NNC kernel object cache]
+    const char* cache_dir = std::getenv("TORCH_NNC_KERNEL_CACHE_DIR");
+    if (cache_dir != nullptr && *cache_dir != '\0') {
+      std::string target_tag;
+      raw_string_ostream tag_stream(target_tag);
+      tag_stream << TM->getTargetTriple().str() << ';' << TM->getTargetCPU()
+                 << ';' << TM->getTargetFeatureString() << ';'
+                 << LLVM_VERSION_MAJOR << '.' << LLVM_VERSION_MINOR;
+      tag_stream.flush();
+      object_cache_ = std::make_unique<PytorchObjectCache>(
+          cache_dir, std::move(target_tag));
+      Builder.setCompileFunctionCreator(
+          [cache = object_cache_.get()](JITTargetMachineBuilder JTMB)
+              -> Expected<std::unique_ptr<IRCompileLayer::IRCompiler>> {
+            auto TM = JTMB.createTargetMachine();
+            if (!TM) {
+              return TM.takeError();
+            }
+            return std::make_unique<TMOwningSimpleCompiler>(
+                std::move(*TM), cache);
+          });
+    }
+#endif
+    LLJ = assertSuccess(Builder.create());
     auto ProcSymbolsGenerator =
         assertSuccess(DynamicLibrarySearchGenerator::GetForCurrentProcess(
             LLJ->getDataLayout().getGlobalPrefix()));
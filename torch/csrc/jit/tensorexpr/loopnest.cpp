@@ -1471,22 +1471,43 @@ void LoopNest::vectorizeInnerLoops() {
   }
 
   // vectorize inner loops.
+  static const int kBodyVectorWidth = 8;
+  static const int kTailVectorWidth = 4;
   for (const ForPtr& loop : innerLoops) {
+    // Splitting first and only then discovering that the body cannot be
+    // vectorized would leave behind a needlessly split scalar loop, so run
+    // the cheap legality checks up front. Loops containing a reduction are
+    // left alone: vectorize() refuses to vectorize a reduction axis, and
+    // vectorizing the non-reduction axis of a ReduceOp body is not
+    // profitable on CPU.
+    if (!NodeFinder<ReduceOp>::find(loop).empty()) {
+      continue;
+    }
+    // A statically known trip count below the narrowest vector width can
+    // only produce dead vector loops plus a scalar tail.
+    auto start = intValue(loop->start());
+    auto stop = intValue(loop->stop());
+    if (start && stop && *stop - *start < kTailVectorWidth) {
+      continue;
+    }
+
     // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
     ForPtr split1;
     // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
     ForPtr tail1;
 
-    static const int kBodyVectorWidth = 8;
     splitWithTail(loop, kBodyVectorWidth, &split1, &tail1);
-    vectorize(split1);
+    bool vectorized = vectorize(split1);
 
-    if (tail1) {
+    // When the loop bound is not a compile-time constant, splitWithTail
+    // computes the tail extent at runtime, so the wide loop, the narrow
+    // loop, and the scalar remainder dispatch on the actual size. Only
+    // bother with the narrow version if the wide one vectorized.
+    if (vectorized && tail1) {
       // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
       ForPtr split2;
       // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
       ForPtr tail2;
-      static const int kTailVectorWidth = 4;
       splitWithTail(tail1, kTailVectorWidth, &split2, &tail2);
       vectorize(split2);
     }
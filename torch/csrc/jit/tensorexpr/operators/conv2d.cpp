@@ -1,4 +1,7 @@
 #include <ATen/Config.h>
+#if AT_MKLDNN_ENABLED()
+#include <ATen/native/mkldnn/Utils.h>
+#endif
 #include <torch/csrc/jit/jit_log.h>
 #include <torch/csrc/jit/tensorexpr/loopnest.h>
 #include <torch/csrc/jit/tensorexpr/operators/conv2d.h>
@@ -316,9 +319,17 @@ bool mkldnnPrepackedConvIsSupported(
     const std::vector<int64_t>& dilation,
     int64_t groups) {
 #if AT_MKLDNN_ENABLED()
-  if (input.dtype != c10::ScalarType::Float ||
-      weight.dtype != c10::ScalarType::Float) {
-    GRAPH_DEBUG("mkldnnPrepackedConvIsSupported: only float32 allowed");
+  // onednn computes the fused epilogue in the conv's output tile, so this
+  // path covers both fp32 and (on hardware with native support) bf16
+  // channels-last convolutions.
+  bool is_bf16 = input.dtype == c10::ScalarType::BFloat16 &&
+      weight.dtype == c10::ScalarType::BFloat16 &&
+      at::mkldnn_bf16_device_check();
+  if (!is_bf16 &&
+      (input.dtype != c10::ScalarType::Float ||
+       weight.dtype != c10::ScalarType::Float)) {
+    GRAPH_DEBUG(
+        "mkldnnPrepackedConvIsSupported: only float32 and bf16 allowed");
     return false;
   }
   if (input.dims.size() != 4 || weight.dims.size() != 4) {
@@ -489,6 +500,26 @@ Tensor computeMkldnnPrepackedConvRun(
   return Tensor(ResultBuf.node(), s);
 }
 
+Tensor computeMkldnnPrepackedLinearRun(
+    const std::vector<ArgValue>& inputs,
+    const std::vector<ExprHandle>& outputShape,
+    const std::vector<ExprHandle>& outputStrides,
+    const c10::optional<ScalarType>& outputType,
+    at::Device device) {
+  Dtype dtype = kFloat;
+  if (outputType) {
+    dtype = Dtype(*outputType);
+  }
+
+  BufHandle ResultBuf(
+      "mkldnn_prepacked_linear_run", outputShape, outputStrides, dtype);
+  const BufHandle& inp = c10::get<BufHandle>(inputs[0]);
+  const BufHandle& prepacked = c10::get<BufHandle>(inputs[1]);
+  StmtPtr s = ExternalCall::make(
+      ResultBuf, "nnc_mkldnn_prepacked_linear_run", {inp, prepacked}, {});
+  return Tensor(ResultBuf.node(), s);
+}
+
 } // namespace tensorexpr
 } // namespace jit
 } // namespace torch
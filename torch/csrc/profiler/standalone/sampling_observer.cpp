@@ -0,0 +1,157 @@
+#include <torch/csrc/profiler/standalone/sampling_observer.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <ATen/record_function.h>
+#include <torch/csrc/profiler/containers.h>
+#include <torch/csrc/profiler/util.h>
+
+namespace torch {
+namespace profiler {
+namespace impl {
+namespace {
+
+// Number of samples a thread accumulates before folding them into the shared
+// histograms. Bounds both the per-thread memory and the lock frequency; with
+// the default sampling probability a thread takes the histogram mutex once
+// per ~100k ops.
+constexpr size_t kAggregationInterval = 1024;
+
+struct Sample {
+  std::string name_;
+  uint64_t duration_ns_;
+};
+
+struct OpSamplingContext : public at::ObserverContext {
+  int64_t start_time_{0};
+};
+
+struct SamplingState {
+  static SamplingState& get() {
+    static SamplingState state;
+    return state;
+  }
+
+  std::atomic<bool> enabled_{false};
+  at::CallbackHandle handle_{0};
+
+  std::mutex histogram_mutex_;
+  std::unordered_map<std::string, OpDurationHistogram> histograms_;
+};
+
+// Per-thread sample buffer. `AppendOnlyList` keeps the record path to a
+// pointer bump in the common case; the buffer never outgrows a single chunk
+// because it is folded and cleared at `kAggregationInterval` entries. The
+// destructor folds whatever is left so samples from exiting threads are not
+// lost.
+struct ThreadSampleBuffer {
+  ~ThreadSampleBuffer() {
+    fold();
+  }
+
+  void record(const char* name, uint64_t duration_ns) {
+    samples_.emplace_back(Sample{name, duration_ns});
+    if (C10_UNLIKELY(samples_.size() >= kAggregationInterval)) {
+      fold();
+    }
+  }
+
+  void fold() {
+    auto& state = SamplingState::get();
+    std::lock_guard<std::mutex> guard(state.histogram_mutex_);
+    for (auto& sample : samples_) {
+      state.histograms_[sample.name_].add(sample.duration_ns_);
+    }
+    samples_.clear();
+  }
+
+  AppendOnlyList<Sample, kAggregationInterval> samples_;
+};
+
+ThreadSampleBuffer& sampleBuffer() {
+  static thread_local ThreadSampleBuffer buffer;
+  return buffer;
+}
+
+std::unique_ptr<at::ObserverContext> onSampledOpEnter(
+    const at::RecordFunction& /*fn*/) {
+  auto ctx = std::make_unique<OpSamplingContext>();
+  ctx->start_time_ = getTime(/*allow_monotonic=*/true);
+  return ctx;
+}
+
+void onSampledOpExit(const at::RecordFunction& fn, at::ObserverContext* ctx) {
+  auto* sampling_ctx = static_cast<OpSamplingContext*>(ctx);
+  if (C10_UNLIKELY(sampling_ctx == nullptr)) {
+    return;
+  }
+  const auto end_time = getTime(/*allow_monotonic=*/true);
+  const auto duration = end_time - sampling_ctx->start_time_;
+  sampleBuffer().record(
+      fn.name(), duration > 0 ? static_cast<uint64_t>(duration) : 0);
+}
+
+} // namespace
+
+void OpDurationHistogram::add(uint64_t duration_ns) {
+  size_t bucket = 0;
+  while (bucket + 1 < kNumBuckets && (duration_ns >> (bucket + 1)) != 0) {
+    ++bucket;
+  }
+  buckets[bucket]++;
+  count++;
+  total_ns += duration_ns;
+}
+
+void enableOpSampling(double sampling_prob) {
+  TORCH_CHECK(
+      sampling_prob > 0.0 && sampling_prob <= 1.0,
+      "enableOpSampling expects a sampling probability in (0, 1], got ",
+      sampling_prob);
+  auto& state = SamplingState::get();
+  if (state.enabled_.exchange(true)) {
+    return;
+  }
+  state.handle_ = at::addGlobalCallback(
+      at::RecordFunctionCallback(&onSampledOpEnter, &onSampledOpExit)
+          .samplingProb(sampling_prob)
+          .scopes({at::RecordScope::FUNCTION, at::RecordScope::USER_SCOPE}));
+}
+
+void disableOpSampling() {
+  auto& state = SamplingState::get();
+  if (!state.enabled_.exchange(false)) {
+    return;
+  }
+  at::removeCallback(state.handle_);
+  state.handle_ = 0;
+}
+
+bool opSamplingEnabled() {
+  return SamplingState::get().enabled_.load(std::memory_order_relaxed);
+}
+
+std::vector<std::pair<std::string, OpDurationHistogram>>
+getOpSamplingHistograms() {
+  auto& state = SamplingState::get();
+  std::lock_guard<std::mutex> guard(state.histogram_mutex_);
+  std::vector<std::pair<std::string, OpDurationHistogram>> out;
+  out.reserve(state.histograms_.size());
+  for (const auto& kv : state.histograms_) {
+    out.emplace_back(kv.first, kv.second);
+  }
+  return out;
+}
+
+void clearOpSamplingHistograms() {
+  auto& state = SamplingState::get();
+  std::lock_guard<std::mutex> guard(state.histogram_mutex_);
+  state.histograms_.clear();
+}
+
+} // namespace impl
+} // namespace profiler
+} // namespace torch
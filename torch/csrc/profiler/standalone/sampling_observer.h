@@ -0,0 +1,58 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <c10/macros/Export.h>
+
+namespace torch {
+namespace profiler {
+namespace impl {
+
+// Always-on sampling profiler.
+//
+// Unlike the full Kineto path (torch/csrc/profiler/collection.cpp), which
+// buffers complete event records and is only suitable for short traces, the
+// sampling observer records nothing but op name and duration for a sampled
+// subset of calls. Samples accumulate in a fixed-capacity per-thread buffer
+// and are periodically folded into per-op duration histograms, which can be
+// read at any time without stopping collection. This keeps the steady-state
+// overhead low enough to leave enabled in production.
+//
+// Durations are bucketed by power of two: bucket `i` of an
+// `OpDurationHistogram` counts calls with `duration_ns` in
+// `[2^i, 2^(i+1))` (bucket 0 also includes sub-nanosecond readings).
+struct TORCH_API OpDurationHistogram {
+  static constexpr size_t kNumBuckets = 40; // 2^40 ns ~= 18 minutes.
+
+  std::array<uint64_t, kNumBuckets> buckets{};
+  uint64_t count{0};
+  uint64_t total_ns{0};
+
+  void add(uint64_t duration_ns);
+};
+
+// Registers a global RecordFunction callback which samples op calls with
+// probability `sampling_prob`. No-op if sampling is already enabled.
+TORCH_API void enableOpSampling(double sampling_prob = 0.01);
+
+// Removes the sampling callback. Samples which have not yet been folded into
+// the histograms (at most one buffer per thread) are dropped.
+TORCH_API void disableOpSampling();
+
+TORCH_API bool opSamplingEnabled();
+
+// Snapshots the aggregated histograms. Safe to call while sampling is
+// active; samples still sitting in thread-local buffers appear after the
+// owning thread's next fold.
+TORCH_API std::vector<std::pair<std::string, OpDurationHistogram>>
+getOpSamplingHistograms();
+
+TORCH_API void clearOpSamplingHistograms();
+
+} // namespace impl
+} // namespace profiler
+} // namespace torch
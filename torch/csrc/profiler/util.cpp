@@ -6,6 +6,8 @@
 #include <c10/util/irange.h>
 #include <fmt/format.h>
 
+#include <mutex>
+
 #ifdef USE_KINETO
 #include <libkineto.h>
 #endif
@@ -330,9 +332,44 @@ static constexpr auto kGroups = "groups";
 static constexpr auto kPadding = "padding";
 static constexpr auto kStride = "stride";
 static constexpr auto kDilation = "dilation";
+static constexpr auto kSDPAOp = "aten::_scaled_dot_product_attention";
+
 static constexpr auto kMatSize = "mat_size";
 static constexpr auto kMat1Size = "mat1_size";
 static constexpr auto kMat2Size = "mat2_size";
+static constexpr auto kQuerySize = "query_size";
+static constexpr auto kKeySize = "key_size";
+static constexpr auto kValueSize = "value_size";
+
+// Registered formulas for ops not covered by the built-in chains below.
+// Registration happens at static-init/library-load time while lookups happen
+// on profiled threads, so both sides take the mutex and lookups copy the
+// formula out.
+static std::mutex& flopsFormulaMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+static std::unordered_map<std::string, FlopsFormula>& flopsFormulaRegistry() {
+  static std::unordered_map<std::string, FlopsFormula> registry;
+  return registry;
+}
+
+void registerFlopsFormula(const std::string& op_name, FlopsFormula formula) {
+  std::lock_guard<std::mutex> guard(flopsFormulaMutex());
+  flopsFormulaRegistry()[op_name] = std::move(formula);
+}
+
+static c10::optional<FlopsFormula> lookupFlopsFormula(
+    const std::string& op_name) {
+  std::lock_guard<std::mutex> guard(flopsFormulaMutex());
+  auto& registry = flopsFormulaRegistry();
+  auto it = registry.find(op_name);
+  if (it == registry.end()) {
+    return c10::nullopt;
+  }
+  return it->second;
+}
 
 static bool validateInput(
     const std::string& op_name,
@@ -453,6 +490,11 @@ std::unordered_map<std::string, c10::IValue> saveExtraArgs(
     at::Tensor right = inputs[2].toTensor();
     map[kMat1Size] = at::IValue(left.sizes());
     map[kMat2Size] = at::IValue(right.sizes());
+  } else {
+    auto formula = lookupFlopsFormula(fname);
+    if (formula.has_value() && formula->save_args) {
+      map = formula->save_args(fname, inputs);
+    }
   }
 
   return map;
@@ -663,9 +705,89 @@ uint64_t computeFlops(
     }
     return flops;
   }
+  auto formula = lookupFlopsFormula(op_name);
+  if (formula.has_value() && formula->compute) {
+    return formula->compute(extra_args);
+  }
   return 0;
 }
 
+namespace {
+
+// Attention is covered through the registry rather than the chains above so
+// that the registration path is exercised in-tree.
+std::unordered_map<std::string, c10::IValue> saveSDPAArgs(
+    const std::string& op_name,
+    c10::ArrayRef<const c10::IValue> inputs) {
+  std::unordered_map<std::string, c10::IValue> map;
+  if (!validateInput(op_name, 3, inputs, {0, 1, 2})) {
+    return map;
+  }
+  map[kQuerySize] = at::IValue(inputs[0].toTensor().sizes());
+  map[kKeySize] = at::IValue(inputs[1].toTensor().sizes());
+  map[kValueSize] = at::IValue(inputs[2].toTensor().sizes());
+  return map;
+}
+
+uint64_t computeSDPAFlops(
+    const std::unordered_map<std::string, c10::IValue>& extra_args) {
+  if (extra_args.find(kQuerySize) == extra_args.end() ||
+      extra_args.find(kKeySize) == extra_args.end() ||
+      extra_args.find(kValueSize) == extra_args.end()) {
+    TORCH_WARN(
+        "Calculating flops for ",
+        kSDPAOp,
+        " requires query_size, key_size, and value_size in saved arguments.");
+    return 0;
+  }
+  auto query_sizes_ref = extra_args.at(kQuerySize);
+  auto key_sizes_ref = extra_args.at(kKeySize);
+  auto value_sizes_ref = extra_args.at(kValueSize);
+  if (!query_sizes_ref.isIntList() || !key_sizes_ref.isIntList() ||
+      !value_sizes_ref.isIntList()) {
+    TORCH_WARN(
+        "Failed to compute flops for op ",
+        kSDPAOp,
+        " because it requires query_size, key_size, and value_size to be IntList.");
+    return 0;
+  }
+
+  const auto query_size = query_sizes_ref.toDimVector();
+  const auto key_size = key_sizes_ref.toDimVector();
+  const auto value_size = value_sizes_ref.toDimVector();
+  if (query_size.size() < 2 || key_size.size() != query_size.size() ||
+      value_size.size() != query_size.size()) {
+    TORCH_WARN(
+        "Failed to compute flops for op ",
+        kSDPAOp,
+        " because query, key, and value must have matching rank of at least 2.");
+    return 0;
+  }
+
+  // query is [..., q_len, embed], key is [..., kv_len, embed], and value is
+  // [..., kv_len, embed_v]; the leading dims are batch/head dims shared by
+  // all three. Count both GEMMs (QK^T and attn @ V) and ignore the softmax,
+  // scaling, and masking, which are lower order.
+  const uint64_t embed = query_size.back();
+  const uint64_t q_len = query_size[query_size.size() - 2];
+  const uint64_t kv_len = key_size[key_size.size() - 2];
+  const uint64_t embed_v = value_size.back();
+  uint64_t batch = 1;
+  for (const auto i : c10::irange(query_size.size() - 2)) {
+    batch *= query_size[i];
+  }
+
+  const uint64_t gemm_multiply_factor = 2;
+  return gemm_multiply_factor * batch * q_len * kv_len * (embed + embed_v);
+}
+
+C10_UNUSED const bool sdpa_formula_registered = []() {
+  registerFlopsFormula(kSDPAOp, {&saveSDPAArgs, &computeSDPAFlops});
+  return true;
+}();
+
+} // namespace
+
 } // namespace impl
 } // namespace profiler
 } // namespace torch
@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <list>
 #include <string>
 #include <unordered_map>
@@ -174,6 +175,28 @@ uint64_t TORCH_API computeFlops(
     const std::string& op_name,
     const std::unordered_map<std::string, c10::IValue>& extra_args);
 
+// A cost formula for one operator, consulted by saveExtraArgs/computeFlops
+// for ops they do not handle natively. `save_args` runs inside the profiler's
+// RecordFunction callback and extracts whatever shapes/parameters `compute`
+// needs into the extra_args map (it must only inspect metadata, never read
+// tensor data); `compute` runs at post-processing time and turns those saved
+// arguments into a FLOP count. Formulas for the matmul/conv families are
+// built in; additional ops (in-tree or out-of-tree) can be covered via
+// registerFlopsFormula.
+struct FlopsFormula {
+  std::function<std::unordered_map<std::string, c10::IValue>(
+      const std::string& op_name,
+      c10::ArrayRef<const c10::IValue> inputs)>
+      save_args;
+  std::function<uint64_t(
+      const std::unordered_map<std::string, c10::IValue>& extra_args)>
+      compute;
+};
+
+TORCH_API void registerFlopsFormula(
+    const std::string& op_name,
+    FlopsFormula formula);
+
 template <typename T>
 class TORCH_API GlobalStateManager {
  public:
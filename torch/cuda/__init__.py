@@ -20,8 +20,8 @@ from typing import Any, List, Optional, Set, Tuple, Union
 from ._utils import _get_device_index, _dummy_type
 from .._utils import classproperty
 from .graphs import CUDAGraph, graph_pool_handle, graph, \
-    make_graphed_callables, is_current_stream_capturing
-from .streams import ExternalStream, Stream, Event
+    make_graphed_callables, is_current_stream_capturing, ShapeBucketedGraphedCallable
+from .streams import ExternalStream, Stream, Event, fork_join
 from .. import device as _device
 import torch._C
 
@@ -909,9 +909,10 @@ __all__ = [
     'LongStorage', 'LongTensor',
     'ShortStorage', 'ShortTensor',
     'CUDAGraph', 'CudaError', 'DeferredCudaCallError', 'Event', 'ExternalStream', 'OutOfMemoryError',
+    'ShapeBucketedGraphedCallable',
     'Stream', 'StreamContext', 'amp', 'caching_allocator_alloc', 'caching_allocator_delete', 'can_device_access_peer',
     'check_error', 'cudaStatus', 'cudart', 'current_blas_handle', 'current_device', 'current_stream', 'default_generators',
-    'default_stream', 'device', 'device_count', 'device_of', 'empty_cache', 'get_allocator_backend', 'CUDAPluggableAllocator',
+    'default_stream', 'device', 'device_count', 'device_of', 'empty_cache', 'fork_join', 'get_allocator_backend', 'CUDAPluggableAllocator',
     'change_current_allocator', 'get_arch_list', 'get_device_capability', 'get_device_name', 'get_device_properties',
     'get_gencode_flags', 'get_rng_state', 'get_rng_state_all', 'get_sync_debug_mode', 'graph', 'graph_pool_handle', 'graphs',
     'has_half', 'has_magma', 'init', 'initial_seed', 'ipc_collect', 'is_available', 'is_bf16_supported',
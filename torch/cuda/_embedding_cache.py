@@ -0,0 +1,139 @@
+r"""Prototype hot-row cached embedding for tables larger than GPU memory.
+
+The table lives in pinned host memory and a fixed-size GPU cache holds the
+hottest rows at row granularity with LRU replacement. Lookups translate rows
+to cache slots on the host (recsys indices typically originate on the CPU
+side of the dataloader), fill misses with one asynchronous H2D gather, and
+then run an ordinary ``F.embedding`` over the cache, so no custom kernels are
+involved. ``prefetch`` runs the miss-fill for the next batch on a side stream
+while the current batch computes.
+
+This is an inference/serving prototype: gradients would flow into cache slots
+rather than the host table, so training is not supported.
+"""
+
+from collections import OrderedDict
+from typing import Dict, List, Optional
+
+import torch
+import torch.nn.functional as F
+
+__all__ = ["CachedHostEmbedding"]
+
+
+class CachedHostEmbedding(torch.nn.Module):
+    r"""An embedding table in pinned host memory with a GPU hot-row cache.
+
+    Args:
+        weight (torch.Tensor): 2D CPU tensor holding the full table. It is
+            pinned (copied if necessary) so cache fills can be asynchronous.
+        cache_rows (int): number of rows the GPU cache holds.
+        device (torch.device or int, optional): device for the cache. Uses
+            the current CUDA device if ``None``.
+
+    Example::
+
+        >>> # xdoctest: +SKIP("undefined variables")
+        >>> emb = CachedHostEmbedding(table, cache_rows=1_000_000)
+        >>> for batch, next_batch in pairwise(batches):
+        ...     emb.prefetch(next_batch.indices)
+        ...     out = emb(batch.indices)
+    """
+
+    def __init__(self, weight: torch.Tensor, cache_rows: int,
+                 device=None) -> None:
+        super().__init__()
+        if weight.dim() != 2:
+            raise ValueError(
+                f"expected a 2D embedding table, got {weight.dim()}D")
+        if weight.is_cuda:
+            raise ValueError("expected the table to be a CPU tensor")
+        if cache_rows <= 0:
+            raise ValueError(f"cache_rows must be positive, got {cache_rows}")
+        if device is None:
+            device = torch.cuda.current_device()
+        self.device = torch.device("cuda", torch.cuda._utils._get_device_index(device))
+        self.weight = weight if weight.is_pinned() else weight.pin_memory()
+        self.cache_rows = min(cache_rows, weight.size(0))
+        self._cache = torch.empty(
+            (self.cache_rows, weight.size(1)),
+            dtype=weight.dtype,
+            device=self.device,
+        )
+        # row id -> cache slot, in LRU order (least recent first).
+        self._slot_of_row: "OrderedDict[int, int]" = OrderedDict()
+        self._free_slots: List[int] = list(range(self.cache_rows - 1, -1, -1))
+        self._prefetch_stream: Optional[torch.cuda.Stream] = None
+        self.hits = 0
+        self.misses = 0
+
+    @torch.no_grad()
+    def _fill(self, rows: torch.Tensor) -> Dict[int, int]:
+        """Ensures ``rows`` (a 1D CPU long tensor of unique row ids) are
+        cached, evicting least-recently-used rows, and returns the row->slot
+        mapping for them. Issues at most one H2D copy, on the current
+        stream."""
+        slots = self._slot_of_row
+        mapping: Dict[int, int] = {}
+        miss_rows: List[int] = []
+        miss_slots: List[int] = []
+        for row in rows.tolist():
+            slot = slots.get(row)
+            if slot is not None:
+                slots.move_to_end(row)
+                mapping[row] = slot
+                self.hits += 1
+                continue
+            self.misses += 1
+            if self._free_slots:
+                slot = self._free_slots.pop()
+            else:
+                # Evict the least-recently-used row. Rows of the current
+                # batch were all move_to_end'ed or freshly inserted, so they
+                # are never evicted by later misses of the same batch.
+                _, slot = slots.popitem(last=False)
+            slots[row] = slot
+            mapping[row] = slot
+            miss_rows.append(row)
+            miss_slots.append(slot)
+        if miss_rows:
+            gathered = self.weight.index_select(
+                0, torch.tensor(miss_rows, dtype=torch.long))
+            slot_index = torch.tensor(
+                miss_slots, dtype=torch.long, device=self.device)
+            self._cache.index_copy_(
+                0, slot_index, gathered.to(self.device, non_blocking=True))
+        return mapping
+
+    @torch.no_grad()
+    def prefetch(self, indices: torch.Tensor) -> None:
+        r"""Fills the cache for the next batch's ``indices`` on a side
+        stream, overlapping with compute on the current stream."""
+        if self._prefetch_stream is None:
+            self._prefetch_stream = torch.cuda.Stream(device=self.device)
+        rows = torch.unique(indices.cpu())
+        self._prefetch_stream.wait_stream(torch.cuda.current_stream(self.device))
+        with torch.cuda.stream(self._prefetch_stream):
+            self._fill(rows)
+
+    def forward(self, indices: torch.Tensor) -> torch.Tensor:
+        if self.training:
+            raise RuntimeError(
+                "CachedHostEmbedding is an inference prototype: gradients "
+                "would update cache slots, not the host table")
+        cpu_indices = indices.cpu()
+        rows, inverse = torch.unique(cpu_indices, return_inverse=True)
+        if self._prefetch_stream is not None:
+            # Fills issued by prefetch must be visible before we read them.
+            torch.cuda.current_stream(self.device).wait_stream(
+                self._prefetch_stream)
+        mapping = self._fill(rows)
+        row_slots = torch.tensor(
+            [mapping[row] for row in rows.tolist()], dtype=torch.long)
+        slot_indices = row_slots[inverse].to(self.device, non_blocking=True)
+        return F.embedding(slot_indices.view(indices.shape), self._cache)
+
+    def hit_rate(self) -> float:
+        r"""Fraction of row lookups served from the GPU cache so far."""
+        total = self.hits + self.misses
+        return self.hits / total if total > 0 else 0.0
@@ -1,3 +1,4 @@
+import collections
 import gc
 import torch
 
@@ -439,3 +440,126 @@ def make_graphed_callables(callables, sample_args, num_warmup_iters=3, allow_unu
         return ret[0]
 
     return tuple(ret)
+
+
+class ShapeBucketedGraphedCallable(object):
+    r"""
+    Wraps an inference callable in a cache of CUDA graphs keyed on the shapes
+    of its Tensor arguments.
+
+    Workloads whose input shapes vary from call to call (for example a decode
+    server whose batch size fluctuates) can't use a single
+    :class:`~torch.cuda.CUDAGraph`, because a capture bakes in the shapes it
+    saw. This class captures one graph per distinct shape signature the first
+    time that signature is seen and replays it on subsequent calls, so steady
+    state per-call cost is a few ``copy_``\ s plus one graph launch. All
+    captures share a single memory pool (see
+    :ref:`Graph memory management<graph-memory-management>`), so the memory
+    cost of caching N shape buckets is close to the largest bucket, not the
+    sum of all of them.
+
+    Arguments:
+        callable (Python function or :class:`nn.Module<torch.nn.Module>`): Callable to graph.
+            Must take only Tensors as arguments, and its CUDA work must be
+            capture-safe (no stream syncs, no dynamic control flow on data).
+        max_graphs (int, optional): Maximum number of cached graphs. When a new
+            shape signature would exceed this, the least recently used graph is
+            freed and its bucket will recapture if seen again. Default: ``64``.
+        bucket_fn (callable, optional): If supplied, maps the user's arguments
+            to a canonical set of arguments before lookup and capture (for
+            example, padding the batch dimension up to the next power of two so
+            64 batch sizes collapse into 7 buckets). The callable runs on the
+            bucketed arguments, and the outputs correspond to them; slicing the
+            results back down is the caller's responsibility.
+        pool (optional): Token returned by :func:`~torch.cuda.graph_pool_handle`
+            hinting that captures should share the given memory pool instead of
+            one private to this cache.
+        num_warmup_iters (int, optional): Number of eager warmup iterations run
+            on a side stream before each capture. Default: ``3``.
+
+    .. note::
+        Like :func:`~torch.cuda.make_graphed_callables`, replays write results
+        into static output tensors, so the returned Tensors of one call are
+        overwritten by the next call with the same shape signature. Clone them
+        if they must outlive that.
+
+    .. warning::
+        The wrapped callable runs under ``torch.no_grad()``; this class is for
+        inference only.
+
+    .. warning::
+        This API is in beta and may change in future releases.
+    """
+
+    def __init__(self, callable, max_graphs=64, bucket_fn=None, pool=None, num_warmup_iters=3):
+        assert max_graphs > 0, "max_graphs must be positive"
+        self._callable = callable
+        self._max_graphs = max_graphs
+        self._bucket_fn = bucket_fn
+        self._mempool = pool if pool is not None else graph_pool_handle()
+        self._num_warmup_iters = num_warmup_iters
+        # signature -> (graph, static flat inputs, static flat outputs, output spec)
+        self._graphs = collections.OrderedDict()
+
+    @staticmethod
+    def _signature(flat_args):
+        return tuple((tuple(arg.shape), arg.dtype, arg.device) for arg in flat_args)
+
+    def _capture(self, args, flat_args, args_spec):
+        # Inputs must live in tensors the graph can read from on every replay.
+        static_inputs = tuple(arg.clone() for arg in flat_args)
+        static_args = _tree_unflatten(list(static_inputs), args_spec)
+
+        # Warmup on a side stream, as in make_graphed_callables, so cudnn
+        # benchmarking and other lazy-initialization work stays out of the
+        # capture.
+        torch.cuda.synchronize()
+        with torch.cuda.stream(torch.cuda.Stream()):
+            for _ in range(self._num_warmup_iters):
+                self._callable(*static_args)
+        torch.cuda.synchronize()
+
+        g = CUDAGraph()
+        with graph(g, pool=self._mempool):
+            outputs = self._callable(*static_args)
+        flat_outputs, output_spec = _tree_flatten(outputs)
+
+        if len(self._graphs) >= self._max_graphs:
+            _, evicted = self._graphs.popitem(last=False)
+            evicted[0].reset()
+        return (g, static_inputs, tuple(flat_outputs), output_spec)
+
+    def warmup(self, *args):
+        r"""
+        Pre-captures the graph for the shape signature of ``args`` so the
+        first real call with those shapes doesn't pay capture latency.
+        """
+        with torch.no_grad():
+            self._lookup(args)
+
+    def _lookup(self, args):
+        if self._bucket_fn is not None:
+            args = self._bucket_fn(*args)
+            if not isinstance(args, tuple):
+                args = (args,)
+        flat_args, args_spec = _tree_flatten(args)
+        assert all(isinstance(arg, torch.Tensor) for arg in flat_args), \
+            "In the beta API, arguments to a ShapeBucketedGraphedCallable must contain only Tensors. " + \
+            "Other types are not allowed."
+        key = self._signature(flat_args)
+        entry = self._graphs.get(key)
+        if entry is None:
+            entry = self._capture(args, flat_args, args_spec)
+            self._graphs[key] = entry
+        else:
+            self._graphs.move_to_end(key)
+        return flat_args, entry
+
+    def __call__(self, *args):
+        with torch.no_grad():
+            flat_args, (g, static_inputs, static_outputs, output_spec) = self._lookup(args)
+            for static_input, arg in zip(static_inputs, flat_args):
+                if static_input.data_ptr() != arg.data_ptr():
+                    static_input.copy_(arg)
+            g.replay()
+            return _tree_unflatten(list(static_outputs), output_spec)
@@ -18,7 +18,8 @@ __all__ = ["caching_allocator_alloc", "caching_allocator_delete", "set_per_proce
            "reset_peak_memory_stats", "reset_max_memory_allocated", "reset_max_memory_cached",
            "memory_allocated", "max_memory_allocated", "memory_reserved", "max_memory_reserved",
            "memory_cached", "max_memory_cached", "memory_snapshot", "memory_summary", "list_gpu_processes",
-           "mem_get_info", "get_allocator_backend", "CUDAPluggableAllocator", "change_current_allocator"]
+           "mem_get_info", "get_allocator_backend", "CUDAPluggableAllocator", "change_current_allocator",
+           "MemPool", "use_mem_pool"]
 
 
 if not hasattr(torch._C, '_cuda_CUDAAllocator'):
@@ -722,3 +723,77 @@ def _get_current_allocator() -> _CUDAAllocator:
         See :ref:`cuda-memory-management` for details on creating and using a custom allocator
     """
     return _CUDAAllocator(torch._C._cuda_getAllocator())
+
+
+class MemPool:
+    r"""An isolated pool of GPU memory inside the CUDA caching allocator.
+
+    Allocations routed into a pool (see :func:`~torch.cuda.use_mem_pool`)
+    never share segments with the global cache or with other pools, so one
+    workload's allocation bursts cannot evict or fragment another's cached
+    blocks. This is intended for multi-tenant serving, where each inference
+    session gets its own pool with an optional per-pool memory cap.
+
+    Args:
+        device (torch.device or int, optional): device the pool lives on.
+            Uses the current device, given by
+            :func:`~torch.cuda.current_device`, if :attr:`device` is ``None``
+            (default).
+        max_size (int, optional): cap, in bytes, on memory the pool may
+            reserve from the device. Allocations that would push the pool's
+            reserved memory above the cap raise an out of memory error even
+            if the device has free memory. ``0`` (default) means uncapped.
+
+    .. note::
+        Memory already cached in a pool is returned to the device by
+        :meth:`~torch.cuda.MemPool.release` only once all tensors allocated
+        from the pool have been freed.
+    """
+    def __init__(self, device: Union[Device, int] = None, max_size: int = 0):
+        _lazy_init()
+        if device is None:
+            device = torch.cuda.current_device()
+        self.device = _get_device_index(device)
+        self.id: Tuple[int, int] = torch._C._graph_pool_handle()
+        self._released = False
+        torch._C._cuda_createUserPool(self.device, self.id, max_size)
+
+    def stats(self) -> Dict[str, int]:
+        r"""Returns a dictionary with the pool's ``reserved_bytes`` (memory
+        held by the pool's segments) and ``allocated_bytes`` (memory owned by
+        live tensors allocated from the pool)."""
+        return torch._C._cuda_getUserPoolStats(self.device, self.id)
+
+    def release(self) -> None:
+        r"""Detaches from the pool and allows its cached memory to be
+        returned to the device as the tensors allocated from it die."""
+        if not self._released:
+            self._released = True
+            torch._C._cuda_releaseUserPool(self.device, self.id)
+
+    def __del__(self):
+        try:
+            self.release()
+        except Exception:
+            # The allocator may already be torn down at interpreter shutdown.
+            pass
+
+
+@contextlib.contextmanager
+def use_mem_pool(pool: MemPool):
+    r"""Context manager that routes allocations made by the calling thread to
+    :attr:`pool`.
+
+    The routing is thread-local, so concurrent server threads can direct
+    their requests to different pools, and guards may nest. Allocations on
+    devices other than ``pool.device`` made inside the context raise an
+    error.
+
+    Args:
+        pool (torch.cuda.MemPool): pool to allocate from inside the context.
+    """
+    prev = torch._C._cuda_beginAllocateToPool(pool.id)
+    try:
+        yield
+    finally:
+        torch._C._cuda_endAllocateToPool(prev)
@@ -114,6 +114,77 @@ class Stream(torch._C._CudaStreamBase):
                 .format(self.device, self.cuda_stream))
 
 
+_fork_join_pools = {}
+
+
+def _fork_join_streams(device_index, count):
+    r"""Returns ``count`` cached side streams for the given device, growing
+    the per-device pool on demand."""
+    pool = _fork_join_pools.setdefault(device_index, [])
+    while len(pool) < count:
+        pool.append(Stream(device=device_index))
+    return pool[:count]
+
+
+def fork_join(branches):
+    r"""Runs independent callables concurrently on side streams and joins them.
+
+    Each branch is launched on its own stream from a cached per-device pool.
+    Every side stream first waits on the work already queued on the current
+    stream, and the current stream waits on all side streams before this
+    function returns, so ordering with respect to surrounding work is the same
+    as running the branches sequentially. CUDA tensors found in the branch
+    results are tied back to the current stream with
+    :meth:`~torch.Tensor.record_stream`, so the caching allocator will not
+    hand their memory to another stream prematurely.
+
+    Args:
+        branches (iterable of callables): the branches to run. They are called
+            with no arguments; capture inputs by closure.
+
+    Returns:
+        A list with each branch's return value, in branch order.
+
+    If CUDA is unavailable or only a single branch is given, the branches are
+    simply run in order on the current stream.
+
+    .. warning:: The branches must be independent: no branch may write to
+        memory (including views or other aliases) that another branch reads or
+        writes. Dependencies between branches are not detected.
+
+    Example::
+
+        >>> # xdoctest: +SKIP("requires cuda")
+        >>> left, right = torch.cuda.fork_join([
+        ...     lambda: branch_a(x),
+        ...     lambda: branch_b(x),
+        ... ])
+    """
+    branches = list(branches)
+    if len(branches) == 0:
+        return []
+    if len(branches) == 1 or not torch.cuda.is_available():
+        return [fn() for fn in branches]
+    import torch.utils._pytree as pytree
+
+    current = torch.cuda.current_stream()
+    streams = _fork_join_streams(current.device.index, len(branches))
+    fork_event = Event()
+    fork_event.record(current)
+    results = []
+    for fn, side_stream in zip(branches, streams):
+        fork_event.wait(side_stream)
+        with torch.cuda.stream(side_stream):
+            results.append(fn())
+    for side_stream in streams:
+        current.wait_stream(side_stream)
+    for result in results:
+        for value in pytree.tree_flatten(result)[0]:
+            if isinstance(value, torch.Tensor) and value.is_cuda:
+                value.record_stream(current)
+    return results
+
+
 class ExternalStream(Stream):
     r"""Wrapper around an externally allocated CUDA stream.
 
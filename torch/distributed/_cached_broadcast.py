@@ -0,0 +1,126 @@
+import hashlib
+import io
+import logging
+import os
+import tempfile
+
+import torch
+import torch.distributed as dist
+
+__all__ = ["broadcast_cached"]
+
+logger = logging.getLogger(__name__)
+
+# Store keys for published digests live under this prefix to keep them out of
+# the way of the keys used by ``init_process_group`` and friends.
+_BLOB_CACHE_PREFIX = "blob_cache"
+
+
+def _default_cache_dir():
+    cache_dir = os.environ.get("TORCH_DISTRIBUTED_BLOB_CACHE_DIR")
+    if cache_dir is None:
+        cache_dir = os.path.join(
+            os.path.expanduser("~"), ".cache", "torch", "distributed_blob_cache"
+        )
+    return cache_dir
+
+
+def _blob_path(cache_dir, digest):
+    return os.path.join(cache_dir, "{}.pt".format(digest))
+
+
+def _serialize(tensor):
+    buffer = io.BytesIO()
+    torch.save(tensor.detach().cpu(), buffer)
+    return buffer.getvalue()
+
+
+def _write_blob(cache_dir, digest, data):
+    # Write-to-temp plus rename so that concurrent workers sharing a cache
+    # directory (e.g. multiple ranks per host) never observe partial files.
+    os.makedirs(cache_dir, exist_ok=True)
+    path = _blob_path(cache_dir, digest)
+    if os.path.exists(path):
+        return
+    fd, tmp_path = tempfile.mkstemp(dir=cache_dir, suffix=".tmp")
+    try:
+        with os.fdopen(fd, "wb") as f:
+            f.write(data)
+        os.replace(tmp_path, path)
+    except Exception:
+        try:
+            os.remove(tmp_path)
+        except OSError:
+            pass
+        raise
+
+
+def broadcast_cached(tensor, src, key, store=None, group=None, cache_dir=None):
+    """
+    Broadcasts ``tensor`` from ``src``, skipping the data transfer for ranks
+    that already hold the content in a local on-disk cache.
+
+    The source rank publishes a content digest of the tensor in ``store``
+    under ``key``; every rank then probes its cache directory for a blob with
+    that digest. The bytes only move when at least one rank misses, so
+    re-broadcasting frozen weights after an elastic restart costs a store
+    lookup and a one-element allreduce instead of the full payload. The blob
+    associated with ``key`` is expected to be immutable: the published digest
+    is written once and reused by later joiners.
+
+    Args:
+        tensor (Tensor): Data to be sent if ``src`` is the rank of the
+            current process, and tensor to be filled otherwise. Must have the
+            same shape and dtype on all ranks.
+        src (int): Source rank.
+        key (str): Logical name for the blob, used to locate its digest in
+            the store. Distinct blobs must use distinct keys.
+        store (Store, optional): Store used to publish the digest. Defaults
+            to the store of the default process group.
+        group (ProcessGroup, optional): The process group to work on. If
+            None, the default process group will be used.
+        cache_dir (str, optional): Directory holding cached blobs. Defaults
+            to ``$TORCH_DISTRIBUTED_BLOB_CACHE_DIR`` or
+            ``~/.cache/torch/distributed_blob_cache``.
+
+    Returns:
+        ``True`` if this rank was served from its local cache, ``False`` if
+        it received the data through the broadcast.
+    """
+    if store is None:
+        store = dist.distributed_c10d._get_default_store()
+    if cache_dir is None:
+        cache_dir = _default_cache_dir()
+    store_key = "{}:{}".format(_BLOB_CACHE_PREFIX, key)
+
+    rank = dist.get_rank()
+    if rank == src:
+        data = _serialize(tensor)
+        digest = hashlib.sha256(data).hexdigest()
+        _write_blob(cache_dir, digest, data)
+        store.set(store_key, digest)
+    else:
+        # Blocks until the source rank has published the digest.
+        digest = store.get(store_key).decode()
+
+    path = _blob_path(cache_dir, digest)
+    hit = rank == src or os.path.exists(path)
+
+    # All ranks must agree on whether the broadcast happens; a one-element
+    # MAX allreduce settles it without moving the payload.
+    any_miss = torch.tensor(
+        [0 if hit else 1], dtype=torch.long, device=tensor.device
+    )
+    dist.all_reduce(any_miss, op=dist.ReduceOp.MAX, group=group)
+
+    if any_miss.item():
+        dist.broadcast(tensor, src, group=group)
+        if not hit:
+            _write_blob(cache_dir, digest, _serialize(tensor))
+    elif rank != src:
+        cached = torch.load(path, map_location="cpu")
+        tensor.copy_(cached)
+        logger.info(
+            "Rank %s: served blob %s (digest %s) from local cache", rank, key, digest
+        )
+    return hit
@@ -908,7 +908,10 @@ def _input_mask(input: Union[Tensor, MaskedTensor], *args, **kwargs) -> Tensor:
                 "_input_mask expected broadcastable mask (got mask dimensionality higher than of the input)"
             )
         if mask.layout == torch.strided:
-            mask = torch.broadcast_to(mask.clone(), input.shape).to(dtype=torch.bool)
+            # Convert to bool before broadcasting so that the canonical mask
+            # stays a zero-stride broadcast view; converting afterwards would
+            # materialize a full-size copy of the broadcasted mask.
+            mask = torch.broadcast_to(mask.clone().to(dtype=torch.bool), input.shape)
         elif mask.layout == torch.sparse_coo:
             mask = torch._sparse_broadcast_to(mask, input.shape)
         else:
@@ -333,6 +333,12 @@ def rebuild_storage_filename(cls, manager, handle, size, dtype=None):
     return storage._shared_decref()
 
 
+def rebuild_storage_arena(cls, manager, handle, capacity, size):
+    # No shared_cache here: arena segments are recycled for new batches,
+    # so a cached storage for the same handle may hold stale bytes.
+    return torch.UntypedStorage._new_shared_arena_cpu(manager, handle, capacity, size)
+
+
 def rebuild_storage_empty(cls):
     return cls()
 
@@ -350,11 +356,26 @@ def rebuild_typed_storage_child(storage, storage_type):
 def reduce_typed_storage_child(storage):
     return (rebuild_typed_storage_child, (storage._untyped_storage, type(storage)))
 
+# Shares storages through a ring of persistently mapped shm segments
+# instead of one segment per storage, skipping the per-tensor
+# shm_open/mmap syscalls on both sides of a DataLoader pipe.
+# See Note [Shared-memory arena transport] in torch/csrc/StorageSharing.cpp
+_use_shm_arena = os.environ.get('TORCH_SHM_ARENA', '0') == '1'
+
+
 def reduce_storage(storage):
     from . import get_sharing_strategy
     if storage.is_cuda:
         raise RuntimeError("Cannot pickle CUDA storage; try pickling a CUDA tensor instead")
-    elif get_sharing_strategy() == 'file_system':
+    elif _use_shm_arena and not isinstance(storage, torch.TypedStorage) \
+            and storage.size() > 0:
+        metadata = storage._share_arena_cpu_()
+        if metadata is not None:
+            # Consumers must see the slot's current bytes, not a cached
+            # storage from an earlier batch that used the same segment.
+            return (rebuild_storage_arena, (type(storage),) + metadata)
+        # the segment ring is exhausted; fall back to per-storage sharing
+    if get_sharing_strategy() == 'file_system':
         metadata = storage._share_filename_cpu_()
         cache_key = metadata[1]
         rebuild = rebuild_storage_filename
@@ -39,6 +39,9 @@ class _StorageBase(object):
     # Defined in torch/csrc/generic/StorageSharing.cpp
     def _share_filename_cpu_(self, *args, **kwargs): ...  # noqa: E704
     def _share_fd_cpu_(self, *args, **kwargs): ...  # noqa: E704
+    def _share_arena_cpu_(self, *args, **kwargs): ...  # noqa: E704
+    @classmethod
+    def _new_shared_arena_cpu(cls, manager, obj, capacity, size) -> T: ...  # noqa: E704
     @classmethod
     def _new_using_filename_cpu(cls: Type[T], size: int) -> T: ...  # noqa: E704
     @classmethod
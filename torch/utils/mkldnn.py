@@ -4,7 +4,10 @@ import torch
 class MkldnnLinear(torch.jit.ScriptModule):
     def __init__(self, dense_module, dtype):
         super(MkldnnLinear, self).__init__()
-        self.register_buffer('weight', dense_module.weight.to_mkldnn(dtype))
+        # Pre-pack the weight into the blocked layout the inner product
+        # primitive expects, so the first forward call doesn't repack.
+        self.register_buffer('weight', torch._C._nn.mkldnn_reorder_linear_weight(
+            dense_module.weight.to_mkldnn(dtype)))
         if dense_module.bias is not None:
             # Bias can be fp32 or bf16 for OneDNN bf16 path, but for good accuracy,
             # we use fp32 dtype.
@@ -21,7 +24,7 @@ class MkldnnLinear(torch.jit.ScriptModule):
 
     @torch.jit.script_method
     def __setstate__(self, state):
-        self.weight = state[0].to_mkldnn()
+        self.weight = torch._C._nn.mkldnn_reorder_linear_weight(state[0].to_mkldnn())
         self.bias = state[1].to_mkldnn()
         self.training = state[2]
 
@@ -530,6 +530,13 @@ def static_dispatch(
 # Generates RegisterSchema.cpp.  Depending on the selector, either
 # all schemas are registered, or only some are (in the case of
 # selective build)
+#
+# Note [Table-driven schema registration]
+# Most schemas carry no tags, so instead of emitting one inlined def() call
+# site per operator (which makes the registration function - and with it this
+# translation unit's static initializer - enormous), untagged schemas are
+# collected into a flat string table that is registered with a single loop.
+# Schemas with tags are still registered individually.
 @dataclass(frozen=True)
 class RegisterSchema:
     selector: SelectiveBuilder
@@ -538,10 +545,39 @@ class RegisterSchema:
     def __call__(self, f: NativeFunction) -> Optional[str]:
         if not self.selector.is_native_function_selected(f):
             return None
+        if not f.tags:
+            # Registered through the schema table instead.
+            # See Note [Table-driven schema registration]
+            return None
         tags = "{" + ", ".join([f"at::Tag::{tag}" for tag in f.tags]) + "}"
         return f"m.def({cpp_string(str(f.func))}, {tags});\n"
 
 
+def schema_registration_table(
+    funcs: Sequence[NativeFunction], selector: SelectiveBuilder
+) -> List[str]:
+    # See Note [Table-driven schema registration]
+    schema_strs = [
+        str(f.func)
+        for f in funcs
+        if selector.is_native_function_selected(f) and not f.tags
+    ]
+    if not schema_strs:
+        return []
+    table = "\n    ".join(f"{cpp_string(s)}," for s in schema_strs)
+    return [
+        f"""\
+// See Note [Table-driven schema registration]
+static const char* const schemas[] = {{
+    {table}
+}};
+for (const char* schema_str : schemas) {{
+  m.def(schema_str);
+}}
+"""
+    ]
+
+
 # Generates Operators.h and Operators.cpp.
 # These provide macros that, given an operator and overload name, allow users
 # to access an "un-overloaded" function version of the operator. This
@@ -1652,9 +1688,9 @@ def get_native_function_schema_registrations(
     custom_namespace = None
     for namespace, funcs in ns_native_functions.items():
 
-        schema_registrations_body = list(
-            mapMaybe(RegisterSchema(schema_selector), funcs)
-        )
+        schema_registrations_body = schema_registration_table(
+            funcs, schema_selector
+        ) + list(mapMaybe(RegisterSchema(schema_selector), funcs))
         # NB: we have to separate aten namespace registration from other namespaces,
         # because in the template we hardcoded an operator for ATen already.
         if namespace == "aten":
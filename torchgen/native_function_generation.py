@@ -51,6 +51,7 @@ FUNCTIONAL_OPS_THAT_CANNOT_GET_AN_OUT_VARIANT = [
     "_assert_async",  # no return
     "_dimI",  # returns an int
     "_dimV",  # returns an int
+    "_find_byte",  # returns an int
     "_has_same_storage_numel",  # returns a boolean
     "_linalg_check_errors",  # no return
     "_local_scalar_dense",  # returns a Scalar